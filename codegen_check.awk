@@ -0,0 +1,127 @@
+# codegen_check.awk
+#
+# Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+# Distributed under the Boost Software License - Version 1.0
+#
+# Check GNU assembler output against directives embedded in the C++ source
+# from which it was compiled. Usage:
+#
+#     awk -f codegen_check.awk foo.codegen.cpp foo.codegen.s
+#
+# The functions named in the directives should be declared `extern "C"` so
+# that their assembly labels are unmangled. Supported directives:
+#
+#     // CHECK-SAME: f g             f and g compile to identical instructions
+#     // CHECK-NO-CALL: f            f contains no calls (including tail calls)
+#     // CHECK-NO-INDIRECT-CALL: f   f contains no calls through a pointer
+#     // CHECK-NO-STORE-BEFORE-CALL: f
+#                                  f writes no memory before its first call,
+#                                  other than pushing saved registers
+#
+# Local labels are normalized before comparison. Exits with status 1 if any
+# check fails.
+
+# First file: the C++ source
+FNR == NR {
+  if (match($0, /\/\/ CHECK-[A-Z-]+:/)) {
+    kind = substr($0, RSTART + 9, RLENGTH - 10)
+    args = substr($0, RSTART + RLENGTH)
+    checks[++nchecks] = kind
+    check_args[nchecks] = args
+  }
+  next
+}
+
+# Second file: the assembly
+/^[A-Za-z_][A-Za-z0-9_]*:/ {
+  func_name = substr($0, 1, index($0, ":") - 1)
+  body[func_name] = ""
+  next
+}
+
+/^\t\.cfi_endproc/ || /^\t\.size/ {
+  func_name = ""
+  next
+}
+
+func_name != "" && /^\t[a-z]/ {
+  insn = $0
+  sub(/^\t/, "", insn)
+  gsub(/\.L[A-Za-z]*[0-9]+/, ".L", insn)
+  body[func_name] = body[func_name] insn "\n"
+}
+
+function has_func(f) {
+  if (f in body)
+    return 1
+  printf "FAIL %s: no function named %s\n", kind, f
+  return 0
+}
+
+# True if `f` calls or tail-calls anything; if `indirect_only`, only calls
+# through a register or memory operand count.
+function calls(f, indirect_only,    n, lines, i, op) {
+  n = split(body[f], lines, "\n")
+  for (i = 1; i <= n; ++i) {
+    op = lines[i]
+    if (op ~ /^call/ || (op ~ /^jmp/ && op !~ /^jmp[ \t]+\.L/)) {
+      if (! indirect_only || op ~ /\*/)
+        return 1
+    }
+  }
+  return 0
+}
+
+# True if `f` has an instruction with a memory destination before its first
+# call or tail call. Pushes, compares, and tests are not stores.
+function stores_before_call(f,    n, lines, i, op) {
+  n = split(body[f], lines, "\n")
+  for (i = 1; i <= n; ++i) {
+    op = lines[i]
+    if (op ~ /^call/ || (op ~ /^jmp/ && op !~ /^jmp[ \t]+\.L/))
+      return 0
+    if (op ~ /^(push|cmp|test|nop|prefetch)/)
+      continue
+    if (op ~ /\)[ \t]*$/)
+      return 1
+  }
+  return 0
+}
+
+END {
+  failed = 0
+  for (c = 1; c <= nchecks; ++c) {
+    kind = checks[c]
+    nargs = split(check_args[c], a, " ")
+    ok = 1
+    if (kind == "SAME") {
+      ok = has_func(a[1]) && has_func(a[2]) && body[a[1]] == body[a[2]]
+      if (! ok && (a[1] in body) && (a[2] in body))
+        printf "---- %s\n%s---- %s\n%s", a[1], body[a[1]], a[2], body[a[2]]
+    }
+    else if (kind == "NO-CALL" || kind == "NO-INDIRECT-CALL") {
+      for (i = 1; i <= nargs; ++i) {
+        if (! has_func(a[i]) || calls(a[i], kind == "NO-INDIRECT-CALL")) {
+          ok = 0
+          printf "---- %s\n%s", a[i], body[a[i]]
+        }
+      }
+    }
+    else if (kind == "NO-STORE-BEFORE-CALL") {
+      for (i = 1; i <= nargs; ++i) {
+        if (! has_func(a[i]) || stores_before_call(a[i])) {
+          ok = 0
+          printf "---- %s\n%s", a[i], body[a[i]]
+        }
+      }
+    }
+    else {
+      printf "FAIL unknown directive CHECK-%s\n", kind
+      ok = 0
+    }
+    printf "%s CHECK-%s:%s\n", (ok ? "ok  " : "FAIL"), kind, check_args[c]
+    if (! ok)
+      failed = 1
+  }
+  exit failed
+}
@@ -0,0 +1,64 @@
+/* ctor_args.codegen.cpp                                              -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// Codegen test: when the construction of a `ctor_args` is visible at the
+// point of use, its operations table is a known constant, the indirect calls
+// through it are inlined away, and constructing through it compiles to the
+// same code as constructing directly. Run with `make ctor_args.codegen`.
+
+#include <ctor_args.h>
+
+#include <new>
+
+struct Point
+{
+  long m_x, m_y;
+  Point(long x, long y) : m_x(x), m_y(y) { }
+};
+
+using xstd::ctor_args;
+using xstd::make_ctor_args;
+
+// CHECK-SAME: direct_emplace erased_emplace
+// CHECK-SAME: direct_emplace lazy_emplace
+// CHECK-NO-CALL: erased_emplace lazy_emplace
+extern "C" Point *direct_emplace(void *p, long x, long y)
+{
+  return ::new (p) Point(x, y);
+}
+extern "C" Point *erased_emplace(void *p, long x, long y)
+{
+  return ctor_args<Point>(x, y).emplace_into(p);
+}
+extern "C" Point *lazy_emplace(void *p, long x, long y)
+{
+  return ctor_args<Point>([=]{ return Point(x, y); }).emplace_into(p);
+}
+
+// CHECK-SAME: direct_value erased_value
+// CHECK-SAME: direct_value typed_value
+// CHECK-NO-CALL: erased_value typed_value
+extern "C" Point direct_value(long x, long y) { return Point(x, y); }
+extern "C" Point erased_value(long x, long y)
+{
+  return ctor_args<Point>(x, y)();
+}
+extern "C" Point typed_value(long x, long y)
+{
+  return make_ctor_args<Point>(x, y);
+}
+
+// `ctor_args_for` keeps its argument types, so it never needs the table.
+// CHECK-SAME: direct_emplace typed_emplace
+// CHECK-NO-INDIRECT-CALL: typed_emplace
+extern "C" Point *typed_emplace(void *p, long x, long y)
+{
+  return ::new (p) Point(make_ctor_args<Point>(x, y));
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
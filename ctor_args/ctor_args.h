@@ -4,9 +4,23 @@
  * Distributed under the Boost Software License - Version 1.0
  */
 
+#ifndef INCLUDED_CTOR_ARGS
+#define INCLUDED_CTOR_ARGS
+
 #include <tuple>
+#include <algorithm>
 #include <array>
+#include <exception>
+#include <execution>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace xstd
 {
@@ -14,70 +28,503 @@ using namespace std;
 
 constexpr size_t max_ctor_args = 5;
 
-// Can hold a pack of up to `max_ctor_args` ctor arguments for `Tp`
-template <class Tp>
+// Default size of the inline buffer of `ctor_args`, enough for references to
+// `max_ctor_args` arguments
+constexpr size_t default_ctor_args_capacity =
+  sizeof(array<tuple<int&&>, max_ctor_args>);
+
+template <class Tp, class... Args>
+requires constructible_from<Tp, Args&&...>
+struct ctor_args_for;
+
+template <class T>
+struct is_ctor_args_for : false_type { };
+
+template <class Tp, class... Args>
+struct is_ctor_args_for<ctor_args_for<Tp, Args...>> : true_type { };
+
+// Can hold a pack of ctor arguments for `Tp` (by default, up to
+// `max_ctor_args` of them) or a callable returning `Tp`, erased into an
+// inline buffer of `Capacity` bytes. A callable too large for the buffer
+// can instead be spilled into a caller-supplied memory resource.
+template <class Tp, size_t Capacity = default_ctor_args_capacity>
 struct ctor_args
 {
+  static_assert(Capacity >= sizeof(void*), "ctor_args capacity too small");
+
   using value_type = Tp;
+  static constexpr size_t capacity = Capacity;
 
   // Sadly, these constructors cannot be constexpr because they use
   // type erasure.
   template <class... Args>
-  requires constructible_from<Tp, Args&&...>
-  ctor_args(Args&&... args) : p_make_value(make_value<Args...>)
+  requires (constructible_from<Tp, Args&&...> &&
+            ! (is_ctor_args_for<remove_cvref_t<Args>>::value || ...))
+  ctor_args(Args&&... args)
+    : p_ops(&pack_ops<Args...>)
   {
-    static_assert(sizeof...(args) <= max_ctor_args,
+    static_assert(sizeof(tuple<Args&&...>) <= Capacity,
                   "Exceeded number of supported ctor args");
     std::construct_at(static_cast<tuple<Args&&...>*>((void*)buffer.bytes),
                       std::forward<Args>(args)...);
   }
 
   template <class F>
-  requires constructible_from<Tp, invoke_result_t<const F>>
-  ctor_args(F&& f) : p_make_value(lazy_value<F>)
+  requires (constructible_from<Tp, invoke_result_t<const F>> &&
+            ! is_ctor_args_for<remove_cvref_t<F>>::value)
+  ctor_args(F&& f)
+    : p_ops(&lazy_ops<remove_cvref_t<F>>)
   {
-    static_assert(sizeof(F) <= sizeof(buffer),
-                  "Exceeded maximum size for creation function");
-    std::construct_at(static_cast<F*>((void*)buffer.bytes),
+    static_assert(fits_inline<F>, "Exceeded maximum size for creation "
+                  "function; increase Capacity or supply a spill resource");
+    std::construct_at(static_cast<remove_cvref_t<F>*>((void*)buffer.bytes),
                       std::forward<F>(f));
   }
 
-  constexpr Tp operator()() const { return p_make_value(&buffer); }
+  // Store `f` inline if it fits; otherwise, move it into memory allocated
+  // from `spill`, typically a `monotonic_buffer_resource` over a
+  // caller-supplied buffer. The spilled callable is never destroyed or
+  // deallocated, so `spill` must outlive every use of this object and should
+  // be an arena whose memory is reclaimed all at once.
+  template <class F>
+  requires (constructible_from<Tp, invoke_result_t<const F>> &&
+            ! is_ctor_args_for<remove_cvref_t<F>>::value)
+  ctor_args(F&& f, pmr::memory_resource& spill)
+  {
+    using Fn = remove_cvref_t<F>;
+    if constexpr (fits_inline<F>) {
+      p_ops = &lazy_ops<Fn>;
+      std::construct_at(static_cast<Fn*>((void*)buffer.bytes),
+                        std::forward<F>(f));
+    }
+    else {
+      void *p = spill.allocate(sizeof(Fn), alignof(Fn));
+      p_ops = &lazy_ops<spilled<Fn>>;
+      std::construct_at(static_cast<spilled<Fn>*>((void*)buffer.bytes),
+                        std::construct_at(static_cast<Fn*>(p),
+                                          std::forward<F>(f)));
+    }
+  }
+
+  // Erase a `ctor_args_for`, referring to the same arguments.
+  template <class... Args>
+  ctor_args(const ctor_args_for<Tp, Args...>& args)
+    : p_ops(&pack_ops<Args...>)
+  {
+    static_assert(sizeof(tuple<Args&&...>) <= Capacity,
+                  "Exceeded number of supported ctor args");
+    std::construct_at(static_cast<tuple<Args&&...>*>((void*)buffer.bytes),
+                      args.forward_args());
+  }
+
+  constexpr Tp operator()() const { return p_ops->make_value(&buffer); }
+
+  // Construct the value directly in `storage`, which must be suitably sized
+  // and aligned for `Tp`, and return a pointer to it. Unlike `operator()`,
+  // the pack form does not require `Tp` to be movable.
+  Tp* emplace_into(void *storage) const
+    { return p_ops->emplace_into(storage, &buffer); }
+
+  // Construct `n` values in the array at `storage`, each from the same
+  // arguments, and return a pointer past the last one. The arguments are
+  // decoded once and passed to every constructor as lvalues (the lazy form
+  // invokes its callable once per element). If a constructor throws, the
+  // values already constructed are destroyed. Throws `invalid_argument` if
+  // `n > 1` but `Tp` is not constructible from lvalues of the arguments.
+  Tp* emplace_n_into(void *storage, size_t n) const
+    { return p_ops->emplace_n_into(storage, n, &buffer); }
+
+  // Return a value constructed by uses-allocator construction with `alloc`,
+  // following the rules of `uses_allocator_construction_args`: if `Tp` uses
+  // the allocator, it is passed with the arguments (leading, after
+  // `allocator_arg`, or trailing), and the elements of a `pair` are each
+  // constructed using the allocator. In the lazy form, a callable that is
+  // invocable with `alloc` is passed it; otherwise its result is moved into
+  // a value constructed using `alloc`. Throws `invalid_argument` if `Tp`
+  // uses the allocator but cannot be constructed with it from the arguments.
+  Tp make_using_allocator(const pmr::polymorphic_allocator<>& alloc) const
+    { return p_ops->make_using_allocator(&buffer, alloc); }
+
+  // Like `make_using_allocator`, but construct the value in `storage`.
+  Tp* emplace_into(void *storage,
+                   const pmr::polymorphic_allocator<>& alloc) const
+    { return p_ops->emplace_using_allocator(storage, &buffer, alloc); }
 
 private:
+  using alloc_t = pmr::polymorphic_allocator<>;
+
+  template <class F>
+  static constexpr bool fits_inline =
+    sizeof(remove_cvref_t<F>) <= Capacity &&
+    alignof(remove_cvref_t<F>) <= alignof(void*);
+
+  // Stored inline in place of a callable that did not fit
+  template <class F>
+  struct spilled
+  {
+    const F *p_f;
+
+    template <class... A>
+    auto operator()(A&&... a) const -> invoke_result_t<const F&, A...>
+      { return (*p_f)(std::forward<A>(a)...); }
+  };
+
   template <class... Args>
   static Tp make_value(const void *p_arg_pack);
 
   template <class F>
   static Tp lazy_value(const void *f);
 
+  template <class... Args>
+  static Tp* emplace_value(void *storage, const void *p_arg_pack);
+
+  template <class F>
+  static Tp* emplace_lazy_value(void *storage, const void *f);
+
+  template <class... Args>
+  static Tp* emplace_n_value(void *storage, size_t n, const void *p_arg_pack);
+
+  template <class F>
+  static Tp* emplace_n_lazy_value(void *storage, size_t n, const void *f);
+
+  template <class Make>
+  static Tp* emplace_n(Tp *first, size_t n, Make make);
+
+  template <class... Args>
+  static Tp make_value_using_allocator(const void *p_arg_pack,
+                                       const alloc_t& alloc);
+
+  template <class F>
+  static Tp lazy_value_using_allocator(const void *f, const alloc_t& alloc);
+
+  template <class... Args>
+  static Tp* emplace_value_using_allocator(void *storage,
+                                           const void *p_arg_pack,
+                                           const alloc_t& alloc);
+
+  template <class F>
+  static Tp* emplace_lazy_value_using_allocator(void *storage, const void *f,
+                                                const alloc_t& alloc);
+
+  // Operations on the argument pack or callable erased into `buffer`
+  struct ops_table
+  {
+    Tp  (*make_value)(const void *p_arg_pack);
+    Tp* (*emplace_into)(void *storage, const void *p_arg_pack);
+    Tp* (*emplace_n_into)(void *storage, size_t n, const void *p_arg_pack);
+    Tp  (*make_using_allocator)(const void *p_arg_pack, const alloc_t&);
+    Tp* (*emplace_using_allocator)(void *storage, const void *p_arg_pack,
+                                   const alloc_t&);
+  };
+
+  template <class... Args>
+  static constexpr ops_table pack_ops = {
+    make_value<Args...>, emplace_value<Args...>, emplace_n_value<Args...>,
+    make_value_using_allocator<Args...>, emplace_value_using_allocator<Args...>
+  };
+
+  template <class F>
+  static constexpr ops_table lazy_ops = {
+    lazy_value<F>, emplace_lazy_value<F>, emplace_n_lazy_value<F>,
+    lazy_value_using_allocator<F>, emplace_lazy_value_using_allocator<F>
+  };
+
   union buf {
-    array<tuple<int&&>, max_ctor_args> sizer;  // Set size and alignment
-    char bytes[sizeof(sizer)];
+    void *aligner;  // Set alignment
+    char  bytes[Capacity];
     constexpr buf() {}
   };
 
-  Tp   (*p_make_value)(const void *p_arg_pack);
-  buf  buffer;
+  const ops_table *p_ops;
+  buf              buffer;
 };
 
-template <class Tp>
+template <class Tp, size_t Capacity>
 template <class... Args>
-Tp ctor_args<Tp>::make_value(const void *p_arg_pack)
+Tp ctor_args<Tp, Capacity>::make_value(const void *p_arg_pack)
 {
   using tp_arg_pack = const tuple<Args&&...>;
-  return make_from_tuple<Tp>(*static_cast<tp_arg_pack*>(p_arg_pack));
+  return apply([](auto&&... args) { return Tp(std::forward<Args>(args)...); },
+               *static_cast<tp_arg_pack*>(p_arg_pack));
 }
 
-template <class Tp>
+template <class Tp, size_t Capacity>
 template <class F>
-Tp ctor_args<Tp>::lazy_value(const void *f)
+Tp ctor_args<Tp, Capacity>::lazy_value(const void *f)
 {
   return (*static_cast<const F*>(f))();
 }
 
+template <class Tp, size_t Capacity>
+template <class... Args>
+Tp* ctor_args<Tp, Capacity>::emplace_value(void *storage, const void *p_arg_pack)
+{
+  using tp_arg_pack = const tuple<Args&&...>;
+  return apply([storage](auto&&... args) {
+    return ::new (storage) Tp(std::forward<Args>(args)...); },
+    *static_cast<tp_arg_pack*>(p_arg_pack));
+}
+
+template <class Tp, size_t Capacity>
+template <class F>
+Tp* ctor_args<Tp, Capacity>::emplace_lazy_value(void *storage, const void *f)
+{
+  // The prvalue result is materialized directly in `storage`.
+  return ::new (storage) Tp((*static_cast<const F*>(f))());
+}
+
+template <class Tp, size_t Capacity>
+template <class Make>
+Tp* ctor_args<Tp, Capacity>::emplace_n(Tp *first, size_t n, Make make)
+{
+  size_t i = 0;
+  try {
+    for (; i < n; ++i)
+      make(first + i);
+  }
+  catch (...) {
+    std::destroy_n(first, i);
+    throw;
+  }
+  return first + n;
+}
+
+template <class Tp, size_t Capacity>
+template <class... Args>
+Tp* ctor_args<Tp, Capacity>::emplace_n_value(void *storage, size_t n,
+                                             const void *p_arg_pack)
+{
+  using tp_arg_pack = const tuple<Args&&...>;
+  tp_arg_pack& arg_pack = *static_cast<tp_arg_pack*>(p_arg_pack);
+  Tp *first = static_cast<Tp*>(storage);
+
+  if constexpr (constructible_from<Tp, Args&...>)
+    return apply([first, n](Args&... args) {
+      return emplace_n(first, n, [&](Tp *p) { ::new (p) Tp(args...); });
+    }, arg_pack);
+  else if (n <= 1)
+    return n ? emplace_value<Args...>(storage, p_arg_pack) + 1 : first;
+  else
+    throw invalid_argument("ctor_args: arguments cannot be reused");
+}
+
+template <class Tp, size_t Capacity>
+template <class F>
+Tp* ctor_args<Tp, Capacity>::emplace_n_lazy_value(void *storage, size_t n,
+                                                  const void *f)
+{
+  const F& make = *static_cast<const F*>(f);
+  return emplace_n(static_cast<Tp*>(storage), n,
+                   [&make](Tp *p) { ::new (p) Tp(make()); });
+}
+
+template <class T>
+struct is_pair : false_type { };
+
+template <class T1, class T2>
+struct is_pair<pair<T1, T2>> : true_type { };
+
+// True if `Tp` can be constructed from `Args...` by uses-allocator
+// construction with an allocator of type `Alloc`.
+template <class Tp, class Alloc, class... Args>
+concept uses_allocator_constructible =
+  (! uses_allocator_v<Tp, Alloc> && constructible_from<Tp, Args...>) ||
+  (uses_allocator_v<Tp, Alloc> &&
+   (constructible_from<Tp, allocator_arg_t, const Alloc&, Args...> ||
+    constructible_from<Tp, Args..., const Alloc&>));
+
+template <class Tp, size_t Capacity>
+template <class... Args>
+Tp ctor_args<Tp, Capacity>::make_value_using_allocator(const void *p_arg_pack,
+                                                       const alloc_t& alloc)
+{
+  using tp_arg_pack = const tuple<Args&&...>;
+  if constexpr (uses_allocator_constructible<Tp, alloc_t, Args...>)
+    return apply([&alloc](auto&&... args) {
+      return make_obj_using_allocator<Tp>(alloc, std::forward<Args>(args)...);
+    }, *static_cast<tp_arg_pack*>(p_arg_pack));
+  else
+    throw invalid_argument("ctor_args: arguments do not accept an allocator");
+}
+
+template <class Tp, size_t Capacity>
+template <class F>
+Tp ctor_args<Tp, Capacity>::lazy_value_using_allocator(const void *f,
+                                                       const alloc_t& alloc)
+{
+  const F& make = *static_cast<const F*>(f);
+  if constexpr (is_invocable_r_v<Tp, const F&, const alloc_t&>)
+    return make(alloc);
+  else if constexpr (! uses_allocator_v<Tp, alloc_t> && ! is_pair<Tp>::value)
+    return make();
+  else if constexpr (uses_allocator_constructible<Tp, alloc_t, Tp>)
+    return make_obj_using_allocator<Tp>(alloc, make());
+  else
+    throw invalid_argument("ctor_args: value does not accept an allocator");
+}
+
+template <class Tp, size_t Capacity>
+template <class... Args>
+Tp* ctor_args<Tp, Capacity>::emplace_value_using_allocator(void *storage,
+                                                           const void *p_arg_pack,
+                                                           const alloc_t& alloc)
+{
+  using tp_arg_pack = const tuple<Args&&...>;
+  if constexpr (uses_allocator_constructible<Tp, alloc_t, Args...>)
+    return apply([storage, &alloc](auto&&... args) {
+      return uninitialized_construct_using_allocator(
+        static_cast<Tp*>(storage), alloc, std::forward<Args>(args)...);
+    }, *static_cast<tp_arg_pack*>(p_arg_pack));
+  else
+    throw invalid_argument("ctor_args: arguments do not accept an allocator");
+}
+
+template <class Tp, size_t Capacity>
+template <class F>
+Tp* ctor_args<Tp, Capacity>::emplace_lazy_value_using_allocator(void *storage,
+                                                                const void *f,
+                                                                const alloc_t& alloc)
+{
+  // Every path yields a prvalue, which is materialized directly in `storage`.
+  return ::new (storage) Tp(lazy_value_using_allocator<F>(f, alloc));
+}
+
+// Construct `n` objects in the uninitialized array at `first`, each from
+// `args`, and return `first + n`. The arguments are decoded once for the
+// whole array. See `ctor_args<Tp>::emplace_n_into`.
+template <class Tp>
+Tp* uninitialized_construct_n(Tp *first, size_t n,
+                              const type_identity_t<ctor_args<Tp>>& args)
+{
+  return args.emplace_n_into(first, n);
+}
+
+// Same, for `ctor_args` with a non-default capacity. (A separate overload,
+// so that the one above still accepts braced lists and callables.)
+template <class Tp, size_t Capacity>
+requires (Capacity != default_ctor_args_capacity)
+Tp* uninitialized_construct_n(Tp *first, size_t n,
+                              const ctor_args<Tp, Capacity>& args)
+{
+  return args.emplace_n_into(first, n);
+}
+
+// Implementation of the parallel `uninitialized_construct_n`, below.
+template <class ExecutionPolicy, class Tp, size_t Capacity>
+Tp* construct_n_in_chunks(Tp *first, size_t n,
+                          const ctor_args<Tp, Capacity>& args)
+{
+  constexpr size_t min_chunk = 4096;  // Amortize the cost of a thread
+
+  size_t nthreads = std::min<size_t>(std::thread::hardware_concurrency(),
+                                     n / min_chunk);
+  if (is_same_v<ExecutionPolicy, execution::sequenced_policy> || nthreads <= 1)
+    return args.emplace_n_into(first, n);
+
+  vector<exception_ptr> errors(nthreads);
+  vector<thread>        threads;
+  threads.reserve(nthreads - 1);
+  auto chunk_begin = [=](size_t t) { return n * t / nthreads; };
+  auto construct_chunk = [&](size_t t) {
+    try {
+      args.emplace_n_into(first + chunk_begin(t),
+                          chunk_begin(t + 1) - chunk_begin(t));
+    }
+    catch (...) {
+      errors[t] = current_exception();
+    }
+  };
+
+  for (size_t t = 1; t < nthreads; ++t)
+    threads.emplace_back(construct_chunk, t);
+  construct_chunk(0);
+  for (thread& th : threads)
+    th.join();
+
+  auto error = find_if(errors.begin(), errors.end(),
+                       [](const exception_ptr& e) { return bool(e); });
+  if (error == errors.end())
+    return first + n;
+
+  for (size_t t = 0; t < nthreads; ++t)
+    if (! errors[t])
+      std::destroy(first + chunk_begin(t), first + chunk_begin(t + 1));
+  rethrow_exception(*error);
+}
+
+// Parallel form of `uninitialized_construct_n`: unless `policy` is
+// `execution::seq`, the array is split into contiguous chunks that are
+// constructed concurrently, so `args` must be safe to use from several
+// threads at once. If any constructor throws, every constructed object is
+// destroyed and one of the exceptions is rethrown.
+template <class ExecutionPolicy, class Tp>
+requires is_execution_policy_v<remove_cvref_t<ExecutionPolicy>>
+Tp* uninitialized_construct_n(ExecutionPolicy&&, Tp *first, size_t n,
+                              const type_identity_t<ctor_args<Tp>>& args)
+{
+  return construct_n_in_chunks<remove_cvref_t<ExecutionPolicy>>(first, n,
+                                                                args);
+}
+
+// Same, for `ctor_args` with a non-default capacity.
+template <class ExecutionPolicy, class Tp, size_t Capacity>
+requires (is_execution_policy_v<remove_cvref_t<ExecutionPolicy>> &&
+          Capacity != default_ctor_args_capacity)
+Tp* uninitialized_construct_n(ExecutionPolicy&&, Tp *first, size_t n,
+                              const ctor_args<Tp, Capacity>& args)
+{
+  return construct_n_in_chunks<remove_cvref_t<ExecutionPolicy>>(first, n,
+                                                                args);
+}
+
+// Non-erased counterpart of `ctor_args<Tp>` holding references to exactly
+// the argument types `Args...`. Because no function pointer is involved, it
+// is `constexpr` and construction through it inlines completely. Create one
+// with `make_ctor_args<Tp>(args...)`. It converts implicitly both to `Tp`
+// (so that it can be passed to any `emplace` function) and to the erased
+// `ctor_args<Tp>`. Like `ctor_args`, it refers to its arguments and should
+// be used within the full-expression that created it, and invoked only once.
+template <class Tp, class... Args>
+requires constructible_from<Tp, Args&&...>
+struct ctor_args_for
+{
+  using value_type = Tp;
+
+  constexpr explicit ctor_args_for(Args&&... args)
+    : m_args(std::forward<Args>(args)...) { }
+
+  constexpr Tp operator()() const
+  {
+    return apply([](auto&&... args) { return Tp(std::forward<Args>(args)...); },
+                 m_args);
+  }
+
+  constexpr operator Tp() const { return (*this)(); }
+
+private:
+  template <class, size_t>
+  friend struct ctor_args;
+
+  constexpr tuple<Args&&...> forward_args() const
+  {
+    return apply([](auto&&... args) {
+      return tuple<Args&&...>(std::forward<Args>(args)...); }, m_args);
+  }
+
+  tuple<Args&&...> m_args;
+};
+
+template <class Tp, class... Args>
+requires constructible_from<Tp, Args&&...>
+constexpr ctor_args_for<Tp, Args...> make_ctor_args(Args&&... args)
+{
+  return ctor_args_for<Tp, Args...>(std::forward<Args>(args)...);
+}
+
 } // close namespace xstd
 
+#endif // ! defined(INCLUDED_CTOR_ARGS)
+
 // Local Variables:
 // c-basic-offset: 2
 // End:
@@ -6,6 +6,11 @@
 
 #include <ctor_args.h>
 #include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <memory_resource>
 #include <iostream>
 #include <cassert>
 
@@ -47,10 +52,374 @@ struct TTWrapper
   TTWrapper(int, xstd::ctor_args<TestType> args) : m_tt(args()) { }
 };
 
-int main()
+// `ctor_args_for` is usable in constant expressions.
+static_assert(xstd::make_ctor_args<TestType>(3, "ct")().m_i == 3);
+static_assert(TestType(xstd::make_ctor_args<TestType>(4)).m_s == "none");
+static_assert(xstd::make_ctor_args<TestType>()().m_s == "default");
+
+/// Construct a `TestType` inside a generic `emplace`-style function.
+template <class... Args>
+constexpr TestType emplace_generic(Args&&... args)
+{
+  return TestType(std::forward<Args>(args)...);
+}
+
+static_assert(emplace_generic(xstd::make_ctor_args<TestType>(5)).m_i == 5);
+
+void test_ctor_args_for()
 {
   short v = 6;
 
+  // Converts to the erased form, referring to the same arguments.
+  verify(emplace(7, xstd::make_ctor_args<TestType>(55, &v)),
+         7, "none", 55, &v);
+  verify(emplace(8, xstd::make_ctor_args<TestType>(std::string_view("mv"))),
+         8, "mv", 0, nullptr);
+
+  // Usable with standard `emplace` functions.
+  std::vector<TestType> vec;
+  vec.emplace_back(xstd::make_ctor_args<TestType>(44, "vec"));
+  assert(1 == vec.size() && 44 == vec[0].m_i && "vec" == vec[0].m_s);
+
+  // Forwards rvalue arguments as rvalues.
+  struct MoveOnly
+  {
+    std::unique_ptr<int> m_p;
+    explicit MoveOnly(std::unique_ptr<int>&& p) : m_p(std::move(p)) { }
+  };
+  auto up = std::make_unique<int>(9);
+  MoveOnly mo = xstd::make_ctor_args<MoveOnly>(std::move(up))();
+  assert(! up && 9 == *mo.m_p);
+
+  auto up2 = std::make_unique<int>(10);
+  xstd::ctor_args<MoveOnly> erased = [&]{ return MoveOnly(std::move(up2)); };
+  assert(10 == *erased().m_p);
+}
+
+void test_construct_n()
+{
+  constexpr std::size_t n = 20'000;
+  alignas(TestType) static unsigned char raw[n * sizeof(TestType)];
+  TestType *first = reinterpret_cast<TestType*>(raw);
+  short v = 6;
+
+  // The same arguments are used for every element.
+  TestType *last = xstd::uninitialized_construct_n(first, n, { 12, &v });
+  assert(first + n == last);
+  for (TestType *p = first; p != last; ++p)
+    assert(12 == p->m_i && &v == p->m_p);
+  std::destroy_n(first, n);
+
+  int calls = 0;
+  xstd::uninitialized_construct_n(first, 3,
+                                  [&] { return TestType(++calls); });
+  assert(3 == calls && 1 == first[0].m_i && 3 == first[2].m_i);
+  std::destroy_n(first, 3);
+
+  last = xstd::uninitialized_construct_n(std::execution::par, first, n,
+                                         { 21, "par" });
+  for (TestType *p = first; p != last; ++p)
+    assert(21 == p->m_i && "par" == p->m_s);
+  std::destroy_n(first, n);
+
+  // Any capacity will do.
+  int    i  = 31;
+  short *pv = &v;
+  xstd::ctor_args<TestType, 16> small(i, pv);
+  last = xstd::uninitialized_construct_n(first, n, small);
+  assert(first + n == last && 31 == first[n - 1].m_i);
+  std::destroy_n(first, n);
+  last = xstd::uninitialized_construct_n(std::execution::par, first, n, small);
+  for (TestType *p = first; p != last; ++p)
+    assert(31 == p->m_i && &v == p->m_p);
+  std::destroy_n(first, n);
+
+  // An argument that is only accepted as an rvalue can be used only once.
+  xstd::uninitialized_construct_n(first, 1, { std::string_view("once") });
+  assert("once" == first[0].m_s);
+  std::destroy_n(first, 1);
+  bool threw = false;
+  try {
+    xstd::uninitialized_construct_n(first, 2, { std::string_view("twice") });
+  }
+  catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+}
+
+template <class... F>
+struct overloaded : F... { using F::operator()...; };
+
+// Allocator-aware type using the leading-allocator convention
+struct Named
+{
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+
+  std::pmr::string m_name;
+  int              m_id = 0;
+
+  Named(std::allocator_arg_t, const allocator_type& a, std::string_view name,
+        int id = 0)
+    : m_name(name, a), m_id(id) { }
+  Named(std::allocator_arg_t, const allocator_type& a, Named&& other)
+    : m_name(std::move(other.m_name), a), m_id(other.m_id) { }
+  Named(std::string_view name, int id = 0) : m_name(name), m_id(id) { }
+  Named(Named&&) = default;
+};
+
+// Claims to use an allocator, but accepts none
+struct Stubborn
+{
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+  int m_v;
+  Stubborn(int v) : m_v(v) { }
+};
+
+void test_capacity()
+{
+  static_assert(40 == xstd::default_ctor_args_capacity);
+  static_assert(sizeof(xstd::ctor_args<TestType, 16>) == 3 * sizeof(void*));
+
+  // Small buffer holding two argument references
+  short  v  = 6;
+  int    i  = 9;
+  short *pv = &v;
+  xstd::ctor_args<TestType, 16> small(i, pv);
+  assert(9 == small().m_i && &v == small().m_p);
+
+  // Large buffer holding a large callable
+  std::array<int, 20> nums{ 1, 2, 3 };
+  auto sum_nums = [nums] {
+    int sum = 0;
+    for (int n : nums)
+      sum += n;
+    return TestType(sum);
+  };
+  static_assert(sizeof(sum_nums) > xstd::default_ctor_args_capacity);
+  xstd::ctor_args<TestType, 128> large(sum_nums);  // An lvalue callable
+  assert(6 == large().m_i);
+
+  // A callable that fits is kept inline even when a spill resource is
+  // supplied.
+  xstd::ctor_args<TestType> inline_lazy([v] { return TestType(v); },
+                                        *std::pmr::null_memory_resource());
+  assert(6 == inline_lazy().m_i);
+
+  // One that does not fit is spilled into the resource.
+  alignas(std::max_align_t) char bytes[256];
+  std::pmr::monotonic_buffer_resource arena(bytes, sizeof(bytes),
+                                            std::pmr::null_memory_resource());
+  xstd::ctor_args<TestType> spilled(sum_nums, arena);
+  assert(6 == spilled().m_i);
+  alignas(TestType) unsigned char raw[sizeof(TestType)];
+  assert(6 == spilled.emplace_into(raw)->m_i);
+  assert(6 == spilled.make_using_allocator({}).m_i);
+  xstd::ctor_args<TestType, 16> spilled_small(std::move(sum_nums), arena);
+  assert(6 == spilled_small().m_i);
+  assert(6 == spilled().m_i);
+}
+
+void test_allocator()
+{
+  // All allocations must come from `arena`.
+  alignas(std::max_align_t) char bytes[4096];
+  std::pmr::monotonic_buffer_resource arena(bytes, sizeof(bytes),
+                                            std::pmr::null_memory_resource());
+  std::pmr::polymorphic_allocator<> alloc(&arena);
+  const char long_name[] = "a name too long for the small-string buffer";
+
+  auto in_arena = [&](const void *p) {
+    return bytes <= static_cast<const char*>(p) &&
+      static_cast<const char*>(p) < bytes + sizeof(bytes);
+  };
+
+  // Pack form, trailing-allocator convention
+  xstd::ctor_args<std::pmr::string> str_args(long_name);
+  std::pmr::string s = str_args.make_using_allocator(alloc);
+  assert(long_name == s && &arena == s.get_allocator().resource());
+  assert(in_arena(s.data()));
+
+  // Pack form, leading-allocator convention, in place
+  // (A `ctor_args` refers to its arguments, so it is used here within the
+  // full-expression that creates the temporary arguments.)
+  alignas(Named) unsigned char raw[sizeof(Named)];
+  Named *np = xstd::ctor_args<Named>(std::string_view(long_name), 5)
+    .emplace_into(raw, alloc);
+  assert(5 == np->m_id && in_arena(np->m_name.data()));
+  np->~Named();
+
+  // Pairs have the allocator applied to each element.
+  using Pair = std::pair<std::pmr::string, int>;
+  Pair pr = xstd::ctor_args<Pair>(long_name, 3).make_using_allocator(alloc);
+  assert(3 == pr.second && in_arena(pr.first.data()));
+
+  // Types that do not use allocators are constructed as usual.
+  assert(7 == xstd::ctor_args<TestType>(7, "plain")
+                .make_using_allocator(alloc).m_i);
+
+  // Lazy form: a callable taking the allocator is passed it ...
+  bool passed = false;
+  xstd::ctor_args<Named> lazy_alloc(
+    overloaded{
+      [&] { return Named(long_name); },
+      [&](const std::pmr::polymorphic_allocator<>& a) {
+        passed = true;
+        return Named(std::allocator_arg, a, long_name, 8);
+      } });
+  Named n1 = lazy_alloc.make_using_allocator(alloc);
+  assert(passed && 8 == n1.m_id && in_arena(n1.m_name.data()));
+
+  // ... otherwise its result is moved into a value using the allocator.
+  std::pmr::string heap_name(long_name, std::pmr::new_delete_resource());
+  xstd::ctor_args<Named> lazy([&] { return Named(heap_name, 9); });
+  Named *lp = lazy.emplace_into(raw, alloc);
+  assert(9 == lp->m_id && in_arena(lp->m_name.data()));
+  lp->~Named();
+
+  // A type that uses an allocator but cannot accept one for these arguments
+  int one = 1;
+  xstd::ctor_args<Stubborn> stubborn_args(one);
+  bool threw = false;
+  try {
+    (void) stubborn_args.make_using_allocator(alloc);
+  }
+  catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw && 1 == stubborn_args().m_v);
+}
+
+// Compare emplacing directly, through `ctor_args_for`, and through the
+// type-erased `ctor_args`. The first two should take the same time. Run with
+// `make ctor_args.test TEST_ARGS=bench CXXOPT=-O2`.
+template <class F>
+double time_ns_per_op(std::size_t n, F&& f)
+{
+  auto start = std::chrono::steady_clock::now();
+  f(n);
+  std::chrono::duration<double, std::nano> d =
+    std::chrono::steady_clock::now() - start;
+  return d.count() / n;
+}
+
+void bench()
+{
+  constexpr std::size_t n = 10'000'000;
+  std::vector<TestType> vec;
+  vec.resize(n);  // Fault in the pages before timing
+  vec.clear();
+  long sum = 0;
+
+  double direct = time_ns_per_op(n, [&](std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i)
+      vec.emplace_back(int(i), "bench");
+    sum += vec.back().m_i;
+    vec.clear();
+  });
+
+  double args_for = time_ns_per_op(n, [&](std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i)
+      vec.emplace_back(xstd::make_ctor_args<TestType>(int(i), "bench"));
+    sum += vec.back().m_i;
+    vec.clear();
+  });
+
+  double erased = time_ns_per_op(n, [&](std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i)
+      vec.emplace_back(xstd::ctor_args<TestType>(int(i), "bench")());
+    sum += vec.back().m_i;
+    vec.clear();
+  });
+
+  std::cout << "emplace_back ns/op: direct " << direct
+            << ", ctor_args_for " << args_for
+            << ", ctor_args " << erased
+            << " (checksum " << sum << ")\n";
+}
+
+// Out-of-line emplace functions, as `ctor_args` is meant to be used: one
+// taking the constructor arguments directly and one taking them erased.
+[[gnu::noinline]]
+void emplace_direct(std::vector<TestType>& v, int i, std::string_view s)
+{
+  v.emplace_back(i, s);
+}
+
+template <std::size_t Capacity>
+[[gnu::noinline]]
+void emplace_erased(std::vector<TestType>& v,
+                    xstd::ctor_args<TestType, Capacity> args)
+{
+  v.push_back(args());
+}
+
+// Measure the overhead of passing arguments through `ctor_args` across a
+// function boundary, for several buffer capacities and for the pack, lazy,
+// and spilled-lazy forms, to guide the choice of `Capacity`.
+void bench_capacity()
+{
+  constexpr std::size_t n = 10'000'000;
+  constexpr std::size_t small = 2 * sizeof(void*);  // Just fits 2 args
+  constexpr std::size_t large = 128;
+  std::vector<TestType> vec;
+  vec.resize(n);  // Fault in the pages before timing
+  vec.clear();
+  std::string_view sv = "bench";
+  long sum = 0;
+
+  auto run = [&](auto emplace) {
+    return time_ns_per_op(n, [&](std::size_t n) {
+      for (std::size_t i = 0; i < n; ++i)
+        emplace(int(i));
+      sum += vec.back().m_i;
+      vec.clear();
+    });
+  };
+
+  double direct = run([&](int i) { emplace_direct(vec, i, sv); });
+  double pack_small = run([&](int i) {
+    emplace_erased<small>(vec, { i, sv }); });
+  double pack_default = run([&](int i) {
+    emplace_erased<xstd::default_ctor_args_capacity>(vec, { i, sv }); });
+  double pack_large = run([&](int i) {
+    emplace_erased<large>(vec, { i, sv }); });
+  double lazy = run([&](int i) {
+    emplace_erased<xstd::default_ctor_args_capacity>(
+      vec, [i, &sv] { return TestType(i, sv); }); });
+
+  // Captures 56 bytes, which do not fit in the default buffer, so they are
+  // spilled into a buffer on the caller's stack.
+  double lazy_spilled = run([&](int i) {
+    std::string_view a = sv, b = sv, c = sv;
+    auto make = [i, a, b, c] { return TestType(i + int(b.size()), c); };
+    static_assert(sizeof(make) > xstd::default_ctor_args_capacity);
+    alignas(std::max_align_t) char bytes[64];
+    std::pmr::monotonic_buffer_resource spill(
+      bytes, sizeof(bytes), std::pmr::null_memory_resource());
+    emplace_erased<xstd::default_ctor_args_capacity>(vec, { make, spill });
+  });
+
+  std::cout << "out-of-line emplace ns/op: direct " << direct
+            << "\n  pack, capacity " << small << ": " << pack_small
+            << "\n  pack, capacity " << xstd::default_ctor_args_capacity
+            << ": " << pack_default
+            << "\n  pack, capacity " << large << ": " << pack_large
+            << "\n  lazy, inline: " << lazy
+            << "\n  lazy, spilled to caller's buffer: " << lazy_spilled
+            << "\n(checksum " << sum << ")\n";
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1 && std::string(argv[1]) == "bench") {
+    bench();
+    bench_capacity();
+    return 0;
+  }
+
+  short v = 6;
+
   verify(emplace(1, {}), 1, "default", 0, nullptr);
   verify(emplace(2, { "hello" }), 2, "hello", 0, nullptr);
   verify(emplace(3, { 99 }), 3, "none", 99, nullptr);
@@ -61,6 +430,11 @@ int main()
 
   TTWrapper x(0, { 5 });
   assert(x.m_tt.m_i == 5);
+
+  test_ctor_args_for();
+  test_construct_n();
+  test_allocator();
+  test_capacity();
 }
 
 // Local Variables:
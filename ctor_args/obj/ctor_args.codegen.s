@@ -0,0 +1,46482 @@
+	.file	"ctor_args.codegen.cpp"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/ctor_args" "ctor_args.codegen.cpp"
+	.section	.text._ZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS4_EEES1_PKv,"axG",@progbits,_ZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS4_EEES1_PKv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS4_EEES1_PKv
+	.type	_ZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS4_EEES1_PKv, @function
+_ZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS4_EEES1_PKv:
+.LVL0:
+.LFB14484:
+	.file 1 "./ctor_args.h"
+	.loc 1 244 4 view -0
+	.cfi_startproc
+.LBB1089:
+.LBI1089:
+	.file 2 "/usr/include/c++/12/tuple"
+	.loc 2 1858 5 view .LVU1
+.LBB1090:
+.LBB1091:
+.LBI1091:
+	.loc 2 1850 5 view .LVU2
+.LBB1092:
+.LBI1092:
+	.loc 2 1386 5 view .LVU3
+.LBB1093:
+.LBI1093:
+	.loc 2 1369 5 view .LVU4
+.LBB1094:
+.LBI1094:
+	.loc 2 427 7 view .LVU5
+.LBB1095:
+.LBI1095:
+	.loc 2 236 7 view .LVU6
+	.loc 2 236 7 is_stmt 0 view .LVU7
+.LBE1095:
+.LBE1094:
+.LBE1093:
+.LBE1092:
+.LBB1096:
+.LBI1096:
+	.loc 2 1386 5 is_stmt 1 view .LVU8
+.LBB1097:
+.LBI1097:
+	.loc 2 1369 5 view .LVU9
+.LBB1098:
+.LBI1098:
+	.loc 2 271 7 view .LVU10
+.LBB1099:
+.LBI1099:
+	.loc 2 236 7 view .LVU11
+	.loc 2 236 7 is_stmt 0 view .LVU12
+.LBE1099:
+.LBE1098:
+.LBE1097:
+.LBE1096:
+.LBB1100:
+.LBI1100:
+	.file 3 "/usr/include/c++/12/bits/invoke.h"
+	.loc 3 90 5 is_stmt 1 view .LVU13
+.LBB1101:
+.LBB1102:
+.LBI1102:
+	.loc 3 60 5 view .LVU14
+.LBB1103:
+.LBI1103:
+	.loc 1 247 16 view .LVU15
+.LBB1104:
+	.loc 1 247 44 is_stmt 0 view .LVU16
+	movq	(%rdi), %rax
+	movq	(%rax), %rdx
+.LVL1:
+.LBB1105:
+.LBI1105:
+	.file 4 "ctor_args.codegen.cpp"
+	.loc 4 19 3 is_stmt 1 view .LVU17
+	.loc 4 19 3 is_stmt 0 view .LVU18
+.LBE1105:
+	.loc 1 247 44 view .LVU19
+	movq	8(%rdi), %rax
+	movq	(%rax), %rax
+.LVL2:
+	.loc 1 247 44 view .LVU20
+.LBE1104:
+.LBE1103:
+.LBE1102:
+.LBE1101:
+.LBE1100:
+.LBE1091:
+.LBE1090:
+.LBE1089:
+	.loc 1 249 1 view .LVU21
+	ret
+	.cfi_endproc
+.LFE14484:
+	.size	_ZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS4_EEES1_PKv, .-_ZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS4_EEES1_PKv
+	.section	.text._ZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS4_EEEPS1_PvPKv,"axG",@progbits,_ZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS4_EEEPS1_PvPKv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS4_EEEPS1_PvPKv
+	.type	_ZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS4_EEEPS1_PvPKv, @function
+_ZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS4_EEEPS1_PvPKv:
+.LVL3:
+.LFB14493:
+	.loc 1 260 5 is_stmt 1 view -0
+	.cfi_startproc
+.LBB1127:
+.LBI1127:
+	.loc 2 1858 5 view .LVU23
+.LBB1128:
+.LBB1129:
+.LBI1129:
+	.loc 2 1850 5 view .LVU24
+.LBB1130:
+.LBI1130:
+	.loc 2 1386 5 view .LVU25
+.LBB1131:
+.LBI1131:
+	.loc 2 1369 5 view .LVU26
+.LBB1132:
+.LBI1132:
+	.loc 2 427 7 view .LVU27
+.LBB1133:
+.LBI1133:
+	.loc 2 236 7 view .LVU28
+	.loc 2 236 7 is_stmt 0 view .LVU29
+.LBE1133:
+.LBE1132:
+.LBE1131:
+.LBE1130:
+.LBB1134:
+.LBI1134:
+	.loc 2 1386 5 is_stmt 1 view .LVU30
+.LBB1135:
+.LBI1135:
+	.loc 2 1369 5 view .LVU31
+.LBB1136:
+.LBI1136:
+	.loc 2 271 7 view .LVU32
+.LBB1137:
+.LBI1137:
+	.loc 2 236 7 view .LVU33
+	.loc 2 236 7 is_stmt 0 view .LVU34
+.LBE1137:
+.LBE1136:
+.LBE1135:
+.LBE1134:
+.LBB1138:
+.LBI1138:
+	.loc 3 90 5 is_stmt 1 view .LVU35
+.LBB1139:
+.LBB1140:
+.LBI1140:
+	.loc 3 60 5 view .LVU36
+.LBB1141:
+.LBI1141:
+	.loc 1 263 16 view .LVU37
+.LBB1142:
+.LBB1143:
+.LBI1143:
+	.loc 4 19 3 view .LVU38
+.LBE1143:
+	.loc 1 264 12 is_stmt 0 view .LVU39
+	movq	8(%rsi), %rcx
+	movq	(%rsi), %rdx
+.LBE1142:
+.LBE1141:
+.LBE1140:
+.LBE1139:
+.LBE1138:
+.LBE1129:
+.LBE1128:
+.LBE1127:
+	.loc 1 260 5 view .LVU40
+	movq	%rdi, %rax
+.LBB1153:
+.LBB1152:
+.LBB1151:
+.LBB1150:
+.LBB1149:
+.LBB1148:
+.LBB1147:
+.LBB1146:
+.LBB1145:
+.LBB1144:
+	.loc 4 19 27 view .LVU41
+	movq	(%rcx), %xmm0
+	movhps	(%rdx), %xmm0
+	movups	%xmm0, (%rdi)
+.LVL4:
+	.loc 4 19 27 view .LVU42
+.LBE1144:
+.LBE1145:
+.LBE1146:
+.LBE1147:
+.LBE1148:
+.LBE1149:
+.LBE1150:
+.LBE1151:
+.LBE1152:
+.LBE1153:
+	.loc 1 266 1 view .LVU43
+	ret
+	.cfi_endproc
+.LFE14493:
+	.size	_ZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS4_EEEPS1_PvPKv, .-_ZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS4_EEEPS1_PvPKv
+	.section	.text._ZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS4_EEES1_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEE,"axG",@progbits,_ZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS4_EEES1_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEE,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS4_EEES1_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEE
+	.type	_ZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS4_EEES1_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEE, @function
+_ZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS4_EEES1_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEE:
+.LVL5:
+.LFB14507:
+	.loc 1 338 4 is_stmt 1 view -0
+	.cfi_startproc
+.LBB1154:
+.LBB1155:
+.LBI1155:
+	.loc 2 1858 5 view .LVU45
+.LBB1156:
+.LBB1157:
+.LBI1157:
+	.loc 2 1850 5 view .LVU46
+.LBB1158:
+.LBI1158:
+	.loc 2 1386 5 view .LVU47
+.LBB1159:
+.LBI1159:
+	.loc 2 1369 5 view .LVU48
+.LBB1160:
+.LBI1160:
+	.loc 2 427 7 view .LVU49
+.LBB1161:
+.LBI1161:
+	.loc 2 236 7 view .LVU50
+	.loc 2 236 7 is_stmt 0 view .LVU51
+.LBE1161:
+.LBE1160:
+.LBE1159:
+.LBE1158:
+.LBB1162:
+.LBI1162:
+	.loc 2 1386 5 is_stmt 1 view .LVU52
+.LBB1163:
+.LBI1163:
+	.loc 2 1369 5 view .LVU53
+.LBB1164:
+.LBI1164:
+	.loc 2 271 7 view .LVU54
+.LBB1165:
+.LBI1165:
+	.loc 2 236 7 view .LVU55
+	.loc 2 236 7 is_stmt 0 view .LVU56
+.LBE1165:
+.LBE1164:
+.LBE1163:
+.LBE1162:
+.LBB1166:
+.LBI1166:
+	.loc 3 90 5 is_stmt 1 view .LVU57
+.LBB1167:
+.LBB1168:
+.LBI1168:
+	.loc 3 60 5 view .LVU58
+.LBB1169:
+.LBI1169:
+	.loc 1 343 18 view .LVU59
+.LBB1170:
+.LBB1171:
+.LBI1171:
+	.file 5 "/usr/include/c++/12/bits/uses_allocator_args.h"
+	.loc 5 186 5 view .LVU60
+.LBB1172:
+.LBI1172:
+	.loc 5 58 5 view .LVU61
+.LBB1173:
+.LBI1173:
+	.loc 2 1063 2 view .LVU62
+.LBB1174:
+.LBI1174:
+	.loc 2 283 7 view .LVU63
+.LBB1175:
+.LBI1175:
+	.loc 2 434 7 view .LVU64
+.LBB1176:
+.LBI1176:
+	.loc 2 192 17 view .LVU65
+	.loc 2 192 17 is_stmt 0 view .LVU66
+.LBE1176:
+.LBE1175:
+.LBB1177:
+.LBI1177:
+	.loc 2 192 17 is_stmt 1 view .LVU67
+	.loc 2 192 17 is_stmt 0 view .LVU68
+.LBE1177:
+.LBE1174:
+.LBE1173:
+.LBE1172:
+.LBB1178:
+.LBI1178:
+	.loc 2 1877 5 is_stmt 1 view .LVU69
+.LBB1179:
+.LBI1179:
+	.loc 2 1872 5 view .LVU70
+.LBB1180:
+	.loc 2 1873 14 is_stmt 0 view .LVU71
+	movq	(%rdi), %rax
+	movq	(%rax), %rdx
+.LVL6:
+.LBB1181:
+.LBI1181:
+	.loc 4 19 3 is_stmt 1 view .LVU72
+	.loc 4 19 3 is_stmt 0 view .LVU73
+.LBE1181:
+	.loc 2 1873 14 view .LVU74
+	movq	8(%rdi), %rax
+	movq	(%rax), %rax
+.LVL7:
+	.loc 2 1873 14 view .LVU75
+.LBE1180:
+.LBE1179:
+.LBE1178:
+.LBE1171:
+.LBE1170:
+.LBE1169:
+.LBE1168:
+.LBE1167:
+.LBE1166:
+.LBE1157:
+.LBE1156:
+.LBE1155:
+.LBE1154:
+	.loc 1 348 1 view .LVU76
+	ret
+	.cfi_endproc
+.LFE14507:
+	.size	_ZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS4_EEES1_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEE, .-_ZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS4_EEES1_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEE
+	.section	.text._ZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS4_EEEPS1_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEE,"axG",@progbits,_ZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS4_EEEPS1_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEE,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS4_EEEPS1_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEE
+	.type	_ZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS4_EEEPS1_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEE, @function
+_ZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS4_EEEPS1_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEE:
+.LVL8:
+.LFB14514:
+	.loc 1 368 5 is_stmt 1 view -0
+	.cfi_startproc
+.LBB1182:
+.LBB1183:
+.LBI1183:
+	.loc 2 1858 5 view .LVU78
+.LBB1184:
+.LBB1185:
+.LBI1185:
+	.loc 2 1850 5 view .LVU79
+.LBB1186:
+.LBI1186:
+	.loc 2 1386 5 view .LVU80
+.LBB1187:
+.LBI1187:
+	.loc 2 1369 5 view .LVU81
+.LBB1188:
+.LBI1188:
+	.loc 2 427 7 view .LVU82
+.LBB1189:
+.LBI1189:
+	.loc 2 236 7 view .LVU83
+	.loc 2 236 7 is_stmt 0 view .LVU84
+.LBE1189:
+.LBE1188:
+.LBE1187:
+.LBE1186:
+.LBB1190:
+.LBI1190:
+	.loc 2 1386 5 is_stmt 1 view .LVU85
+.LBB1191:
+.LBI1191:
+	.loc 2 1369 5 view .LVU86
+.LBB1192:
+.LBI1192:
+	.loc 2 271 7 view .LVU87
+.LBB1193:
+.LBI1193:
+	.loc 2 236 7 view .LVU88
+	.loc 2 236 7 is_stmt 0 view .LVU89
+.LBE1193:
+.LBE1192:
+.LBE1191:
+.LBE1190:
+.LBB1194:
+.LBI1194:
+	.loc 3 90 5 is_stmt 1 view .LVU90
+.LBB1195:
+.LBB1196:
+.LBI1196:
+	.loc 3 60 5 view .LVU91
+.LBB1197:
+.LBI1197:
+	.loc 1 374 18 view .LVU92
+.LBB1198:
+.LBB1199:
+.LBI1199:
+	.loc 5 195 5 view .LVU93
+.LBB1200:
+.LBB1201:
+.LBI1201:
+	.loc 5 58 5 view .LVU94
+.LBB1202:
+.LBI1202:
+	.loc 2 1063 2 view .LVU95
+.LBB1203:
+.LBI1203:
+	.loc 2 283 7 view .LVU96
+.LBB1204:
+.LBI1204:
+	.loc 2 434 7 view .LVU97
+.LBB1205:
+.LBI1205:
+	.loc 2 192 17 view .LVU98
+	.loc 2 192 17 is_stmt 0 view .LVU99
+.LBE1205:
+.LBE1204:
+.LBB1206:
+.LBI1206:
+	.loc 2 192 17 is_stmt 1 view .LVU100
+	.loc 2 192 17 is_stmt 0 view .LVU101
+.LBE1206:
+.LBE1203:
+.LBE1202:
+.LBE1201:
+.LBB1207:
+.LBI1207:
+	.loc 2 1858 5 is_stmt 1 view .LVU102
+.LBB1208:
+.LBB1209:
+.LBI1209:
+	.loc 2 1850 5 view .LVU103
+.LBB1210:
+.LBI1210:
+	.loc 3 90 5 view .LVU104
+.LBB1211:
+.LBB1212:
+.LBI1212:
+	.loc 3 60 5 view .LVU105
+.LBB1213:
+.LBI1213:
+	.loc 5 198 25 view .LVU106
+.LBB1214:
+.LBB1215:
+.LBI1215:
+	.file 6 "/usr/include/c++/12/bits/stl_construct.h"
+	.loc 6 94 5 view .LVU107
+.LBB1216:
+.LBB1217:
+.LBI1217:
+	.loc 4 19 3 view .LVU108
+.LBE1217:
+	.loc 6 97 14 is_stmt 0 view .LVU109
+	movq	8(%rsi), %rcx
+	movq	(%rsi), %rdx
+.LVL9:
+	.loc 6 97 14 view .LVU110
+.LBE1216:
+.LBE1215:
+.LBE1214:
+.LBE1213:
+.LBE1212:
+.LBE1211:
+.LBE1210:
+.LBE1209:
+.LBE1208:
+.LBE1207:
+.LBE1200:
+.LBE1199:
+.LBE1198:
+.LBE1197:
+.LBE1196:
+.LBE1195:
+.LBE1194:
+.LBE1185:
+.LBE1184:
+.LBE1183:
+.LBE1182:
+	.loc 1 368 5 view .LVU111
+	movq	%rdi, %rax
+.LBB1240:
+.LBB1239:
+.LBB1238:
+.LBB1237:
+.LBB1236:
+.LBB1235:
+.LBB1234:
+.LBB1233:
+.LBB1232:
+.LBB1231:
+.LBB1230:
+.LBB1229:
+.LBB1228:
+.LBB1227:
+.LBB1226:
+.LBB1225:
+.LBB1224:
+.LBB1223:
+.LBB1222:
+.LBB1221:
+.LBB1220:
+.LBB1219:
+.LBB1218:
+	.loc 4 19 27 view .LVU112
+	movq	(%rcx), %xmm0
+	movhps	(%rdx), %xmm0
+	movups	%xmm0, (%rdi)
+.LVL10:
+	.loc 4 19 27 view .LVU113
+.LBE1218:
+.LBE1219:
+.LBE1220:
+.LBE1221:
+.LBE1222:
+.LBE1223:
+.LBE1224:
+.LBE1225:
+.LBE1226:
+.LBE1227:
+.LBE1228:
+.LBE1229:
+.LBE1230:
+.LBE1231:
+.LBE1232:
+.LBE1233:
+.LBE1234:
+.LBE1235:
+.LBE1236:
+.LBE1237:
+.LBE1238:
+.LBE1239:
+.LBE1240:
+	.loc 1 380 1 view .LVU114
+	ret
+	.cfi_endproc
+.LFE14514:
+	.size	_ZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS4_EEEPS1_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEE, .-_ZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS4_EEEPS1_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEE
+	.section	.text._ZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKv,"axG",@progbits,_ZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKv
+	.type	_ZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKv, @function
+_ZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKv:
+.LVL11:
+.LFB14500:
+	.loc 1 294 5 is_stmt 1 view -0
+	.cfi_startproc
+.LBB1292:
+.LBB1293:
+.LBI1293:
+	.loc 2 1858 5 view .LVU116
+.LBB1294:
+.LBB1295:
+.LBI1295:
+	.loc 2 1850 5 view .LVU117
+.LBB1296:
+.LBI1296:
+	.loc 2 1386 5 view .LVU118
+.LBB1297:
+.LBI1297:
+	.loc 2 1369 5 view .LVU119
+.LBB1298:
+.LBI1298:
+	.loc 2 427 7 view .LVU120
+.LBB1299:
+.LBI1299:
+	.loc 2 236 7 view .LVU121
+.LBB1300:
+	.loc 2 236 60 is_stmt 0 view .LVU122
+	movq	(%rdx), %r8
+.LVL12:
+	.loc 2 236 60 view .LVU123
+.LBE1300:
+.LBE1299:
+.LBE1298:
+.LBE1297:
+.LBE1296:
+.LBB1301:
+.LBI1301:
+	.loc 2 1386 5 is_stmt 1 view .LVU124
+.LBB1302:
+.LBI1302:
+	.loc 2 1369 5 view .LVU125
+.LBB1303:
+.LBI1303:
+	.loc 2 271 7 view .LVU126
+.LBB1304:
+.LBI1304:
+	.loc 2 236 7 view .LVU127
+.LBB1305:
+	.loc 2 236 60 is_stmt 0 view .LVU128
+	movq	8(%rdx), %r9
+.LVL13:
+	.loc 2 236 60 view .LVU129
+.LBE1305:
+.LBE1304:
+.LBE1303:
+.LBE1302:
+.LBE1301:
+.LBB1306:
+.LBI1306:
+	.loc 3 90 5 is_stmt 1 view .LVU130
+.LBB1307:
+.LBB1308:
+.LBI1308:
+	.loc 3 60 5 view .LVU131
+.LBB1309:
+.LBI1309:
+	.loc 1 302 18 view .LVU132
+.LBB1310:
+.LBB1311:
+.LBB1312:
+.LBI1312:
+	.loc 1 278 5 view .LVU133
+.LBB1313:
+	.loc 1 282 14 view .LVU134
+	testq	%rsi, %rsi
+	je	.L7
+	movq	%rsi, %rcx
+	movq	%rdi, %rdx
+.LVL14:
+	.loc 1 282 14 is_stmt 0 view .LVU135
+	salq	$4, %rcx
+	addq	%rdi, %rcx
+.LVL15:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+.LBB1314:
+.LBI1314:
+	.loc 1 303 34 is_stmt 1 view .LVU136
+.LBB1315:
+.LBB1316:
+.LBI1316:
+	.loc 4 19 3 view .LVU137
+.LBB1317:
+	.loc 4 19 27 is_stmt 0 view .LVU138
+	movq	(%r9), %xmm0
+.LBE1317:
+.LBE1316:
+.LBE1315:
+.LBE1314:
+	.loc 1 282 14 view .LVU139
+	addq	$16, %rdx
+.LVL16:
+.LBB1321:
+.LBB1320:
+.LBB1319:
+.LBB1318:
+	.loc 4 19 27 view .LVU140
+	movhps	(%r8), %xmm0
+	movups	%xmm0, -16(%rdx)
+.LVL17:
+	.loc 4 19 27 view .LVU141
+.LBE1318:
+.LBE1319:
+.LBE1320:
+.LBE1321:
+	.loc 1 282 5 is_stmt 1 view .LVU142
+	.loc 1 282 14 view .LVU143
+	cmpq	%rdx, %rcx
+	jne	.L8
+.L7:
+.LVL18:
+	.loc 1 289 16 is_stmt 0 view .LVU144
+	salq	$4, %rsi
+.LVL19:
+	.loc 1 289 18 view .LVU145
+	leaq	(%rdi,%rsi), %rax
+.LBE1313:
+.LBE1312:
+.LBE1311:
+.LBE1310:
+.LBE1309:
+.LBE1308:
+.LBE1307:
+.LBE1306:
+.LBE1295:
+.LBE1294:
+.LBE1293:
+.LBE1292:
+	.loc 1 309 1 view .LVU146
+	ret
+	.cfi_endproc
+.LFE14500:
+	.size	_ZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKv, .-_ZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKv
+	.text
+	.p2align 4
+	.globl	direct_emplace
+	.type	direct_emplace, @function
+direct_emplace:
+.LVL20:
+.LFB13619:
+	.loc 4 29 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 4 30 3 view .LVU148
+.LBB1322:
+.LBI1322:
+	.loc 4 19 3 view .LVU149
+.LBB1323:
+	.loc 4 19 27 is_stmt 0 view .LVU150
+	movq	%rsi, (%rdi)
+.LBE1323:
+.LBE1322:
+	.loc 4 29 1 view .LVU151
+	movq	%rdi, %rax
+.LBB1325:
+.LBB1324:
+	.loc 4 19 35 view .LVU152
+	movq	%rdx, 8(%rdi)
+.LVL21:
+	.loc 4 19 35 view .LVU153
+.LBE1324:
+.LBE1325:
+	.loc 4 31 1 view .LVU154
+	ret
+	.cfi_endproc
+.LFE13619:
+	.size	direct_emplace, .-direct_emplace
+	.p2align 4
+	.globl	erased_emplace
+	.type	erased_emplace, @function
+erased_emplace:
+.LVL22:
+.LFB13620:
+	.loc 4 33 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 4 34 3 view .LVU156
+.LBB1365:
+.LBI1365:
+	.loc 1 63 3 view .LVU157
+.LBB1366:
+.LBI1366:
+	.loc 1 235 15 view .LVU158
+	.loc 1 235 15 is_stmt 0 view .LVU159
+.LBE1366:
+.LBB1367:
+.LBI1367:
+	.loc 6 94 5 is_stmt 1 view .LVU160
+.LBB1368:
+.LBI1368:
+	.loc 2 1063 2 view .LVU161
+.LBB1369:
+.LBI1369:
+	.loc 2 283 7 view .LVU162
+.LBB1370:
+.LBI1370:
+	.loc 2 434 7 view .LVU163
+.LBB1371:
+.LBI1371:
+	.loc 2 192 17 view .LVU164
+	.loc 2 192 17 is_stmt 0 view .LVU165
+.LBE1371:
+.LBE1370:
+.LBB1372:
+.LBI1372:
+	.loc 2 192 17 is_stmt 1 view .LVU166
+	.loc 2 192 17 is_stmt 0 view .LVU167
+.LBE1372:
+.LBE1369:
+.LBE1368:
+.LBE1367:
+.LBE1365:
+.LBB1373:
+.LBI1373:
+	.loc 1 125 7 is_stmt 1 view .LVU168
+.LBB1374:
+.LBI1374:
+	.loc 1 260 5 view .LVU169
+.LBB1375:
+.LBB1376:
+.LBI1376:
+	.loc 2 1858 5 view .LVU170
+.LBB1377:
+.LBB1378:
+.LBI1378:
+	.loc 2 1850 5 view .LVU171
+.LBB1379:
+.LBI1379:
+	.loc 3 90 5 view .LVU172
+.LBB1380:
+.LBB1381:
+.LBI1381:
+	.loc 3 60 5 view .LVU173
+.LBB1382:
+.LBI1382:
+	.loc 1 263 16 view .LVU174
+.LBB1383:
+.LBB1384:
+.LBI1384:
+	.loc 4 19 3 view .LVU175
+.LBB1385:
+	.loc 4 19 27 is_stmt 0 view .LVU176
+	movq	%rsi, (%rdi)
+.LBE1385:
+.LBE1384:
+.LBE1383:
+.LBE1382:
+.LBE1381:
+.LBE1380:
+.LBE1379:
+.LBE1378:
+.LBE1377:
+.LBE1376:
+.LBE1375:
+.LBE1374:
+.LBE1373:
+	.loc 4 33 1 view .LVU177
+	movq	%rdi, %rax
+.LBB1398:
+.LBB1397:
+.LBB1396:
+.LBB1395:
+.LBB1394:
+.LBB1393:
+.LBB1392:
+.LBB1391:
+.LBB1390:
+.LBB1389:
+.LBB1388:
+.LBB1387:
+.LBB1386:
+	.loc 4 19 35 view .LVU178
+	movq	%rdx, 8(%rdi)
+.LVL23:
+	.loc 4 19 35 view .LVU179
+.LBE1386:
+.LBE1387:
+.LBE1388:
+.LBE1389:
+.LBE1390:
+.LBE1391:
+.LBE1392:
+.LBE1393:
+.LBE1394:
+.LBE1395:
+.LBE1396:
+.LBE1397:
+.LBE1398:
+	.loc 4 35 1 view .LVU180
+	ret
+	.cfi_endproc
+.LFE13620:
+	.size	erased_emplace, .-erased_emplace
+	.p2align 4
+	.globl	lazy_emplace
+	.type	lazy_emplace, @function
+lazy_emplace:
+.LVL24:
+.LFB13623:
+	.loc 4 37 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 4 38 3 view .LVU182
+.LBB1412:
+.LBI1412:
+	.loc 1 75 3 view .LVU183
+.LBB1413:
+.LBI1413:
+	.loc 1 235 15 view .LVU184
+	.loc 1 235 15 is_stmt 0 view .LVU185
+.LBE1413:
+.LBB1414:
+.LBI1414:
+	.loc 6 94 5 is_stmt 1 view .LVU186
+	.loc 6 94 5 is_stmt 0 view .LVU187
+.LBE1414:
+.LBE1412:
+.LBB1415:
+.LBI1415:
+	.loc 1 125 7 is_stmt 1 view .LVU188
+.LBB1416:
+.LBI1416:
+	.loc 1 270 5 view .LVU189
+.LBB1417:
+.LBB1418:
+.LBI1418:
+	.loc 4 38 27 view .LVU190
+.LBB1419:
+	.loc 4 38 32 view .LVU191
+.LBB1420:
+.LBI1420:
+	.loc 4 19 3 view .LVU192
+	.loc 4 19 3 is_stmt 0 view .LVU193
+.LBE1420:
+.LBE1419:
+.LBE1418:
+	.loc 1 273 56 view .LVU194
+	movq	%rsi, (%rdi)
+.LBE1417:
+.LBE1416:
+.LBE1415:
+	.loc 4 37 1 view .LVU195
+	movq	%rdi, %rax
+.LBB1423:
+.LBB1422:
+.LBB1421:
+	.loc 1 273 56 view .LVU196
+	movq	%rdx, 8(%rdi)
+.LVL25:
+	.loc 1 273 56 view .LVU197
+.LBE1421:
+.LBE1422:
+.LBE1423:
+	.loc 4 39 1 view .LVU198
+	ret
+	.cfi_endproc
+.LFE13623:
+	.size	lazy_emplace, .-lazy_emplace
+	.p2align 4
+	.globl	direct_value
+	.type	direct_value, @function
+direct_value:
+.LVL26:
+.LFB13626:
+	.loc 4 44 47 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 4 44 49 view .LVU200
+	.loc 4 44 47 is_stmt 0 view .LVU201
+	movq	%rdi, %rax
+.LVL27:
+	.loc 4 44 47 view .LVU202
+	movq	%rsi, %rdx
+.LVL28:
+.LBB1424:
+.LBI1424:
+	.loc 4 19 3 is_stmt 1 view .LVU203
+	.loc 4 19 3 is_stmt 0 view .LVU204
+.LBE1424:
+	.loc 4 44 69 view .LVU205
+	ret
+	.cfi_endproc
+.LFE13626:
+	.size	direct_value, .-direct_value
+	.p2align 4
+	.globl	erased_value
+	.type	erased_value, @function
+erased_value:
+.LVL29:
+.LFB13627:
+	.loc 4 46 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 4 47 3 view .LVU207
+.LBB1462:
+.LBI1462:
+	.loc 1 63 3 view .LVU208
+.LBB1463:
+.LBI1463:
+	.loc 1 235 15 view .LVU209
+	.loc 1 235 15 is_stmt 0 view .LVU210
+.LBE1463:
+.LBB1464:
+.LBI1464:
+	.loc 6 94 5 is_stmt 1 view .LVU211
+.LBB1465:
+.LBI1465:
+	.loc 2 1063 2 view .LVU212
+.LBB1466:
+.LBI1466:
+	.loc 2 283 7 view .LVU213
+.LBB1467:
+.LBI1467:
+	.loc 2 434 7 view .LVU214
+.LBB1468:
+.LBI1468:
+	.loc 2 192 17 view .LVU215
+	.loc 2 192 17 is_stmt 0 view .LVU216
+.LBE1468:
+.LBE1467:
+.LBB1469:
+.LBI1469:
+	.loc 2 192 17 is_stmt 1 view .LVU217
+	.loc 2 192 17 is_stmt 0 view .LVU218
+.LBE1469:
+.LBE1466:
+.LBE1465:
+.LBE1464:
+.LBE1462:
+.LBB1470:
+.LBI1470:
+	.loc 1 120 16 is_stmt 1 view .LVU219
+.LBB1471:
+.LBI1471:
+	.loc 1 244 4 view .LVU220
+.LBB1472:
+.LBB1473:
+.LBI1473:
+	.loc 2 1858 5 view .LVU221
+.LBB1474:
+.LBB1475:
+.LBI1475:
+	.loc 2 1850 5 view .LVU222
+.LBB1476:
+.LBI1476:
+	.loc 3 90 5 view .LVU223
+.LBB1477:
+.LBB1478:
+.LBI1478:
+	.loc 3 60 5 view .LVU224
+.LBB1479:
+.LBI1479:
+	.loc 1 247 16 view .LVU225
+.LBE1479:
+.LBE1478:
+.LBE1477:
+.LBE1476:
+.LBE1475:
+.LBE1474:
+.LBE1473:
+.LBE1472:
+.LBE1471:
+.LBE1470:
+	.loc 4 46 1 is_stmt 0 view .LVU226
+	movq	%rdi, %rax
+.LVL30:
+	.loc 4 46 1 view .LVU227
+	movq	%rsi, %rdx
+.LVL31:
+.LBB1490:
+.LBB1489:
+.LBB1488:
+.LBB1487:
+.LBB1486:
+.LBB1485:
+.LBB1484:
+.LBB1483:
+.LBB1482:
+.LBB1481:
+.LBB1480:
+.LBI1480:
+	.loc 4 19 3 is_stmt 1 view .LVU228
+	.loc 4 19 3 is_stmt 0 view .LVU229
+.LBE1480:
+.LBE1481:
+.LBE1482:
+.LBE1483:
+.LBE1484:
+.LBE1485:
+.LBE1486:
+.LBE1487:
+.LBE1488:
+.LBE1489:
+.LBE1490:
+	.loc 4 48 1 view .LVU230
+	ret
+	.cfi_endproc
+.LFE13627:
+	.size	erased_value, .-erased_value
+	.p2align 4
+	.globl	typed_value
+	.type	typed_value, @function
+typed_value:
+.LVL32:
+.LFB13628:
+	.loc 4 50 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 4 51 3 view .LVU232
+.LBB1491:
+.LBI1491:
+	.loc 1 519 38 view .LVU233
+.LBB1492:
+.LBI1492:
+	.loc 1 493 22 view .LVU234
+.LBB1493:
+.LBI1493:
+	.loc 2 1063 2 view .LVU235
+.LBB1494:
+.LBI1494:
+	.loc 2 283 7 view .LVU236
+.LBB1495:
+.LBI1495:
+	.loc 2 434 7 view .LVU237
+.LBB1496:
+.LBI1496:
+	.loc 2 192 17 view .LVU238
+	.loc 2 192 17 is_stmt 0 view .LVU239
+.LBE1496:
+.LBE1495:
+.LBB1497:
+.LBI1497:
+	.loc 2 192 17 is_stmt 1 view .LVU240
+	.loc 2 192 17 is_stmt 0 view .LVU241
+.LBE1497:
+.LBE1494:
+.LBE1493:
+.LBE1492:
+.LBE1491:
+.LBB1498:
+.LBI1498:
+	.loc 1 502 13 is_stmt 1 view .LVU242
+.LBB1499:
+.LBI1499:
+	.loc 1 496 16 view .LVU243
+.LBB1500:
+.LBB1501:
+.LBI1501:
+	.loc 2 1858 5 view .LVU244
+.LBB1502:
+.LBB1503:
+.LBI1503:
+	.loc 2 1850 5 view .LVU245
+.LBB1504:
+.LBI1504:
+	.loc 3 90 5 view .LVU246
+.LBB1505:
+.LBB1506:
+.LBI1506:
+	.loc 3 60 5 view .LVU247
+.LBB1507:
+.LBI1507:
+	.loc 1 498 18 view .LVU248
+.LBE1507:
+.LBE1506:
+.LBE1505:
+.LBE1504:
+.LBE1503:
+.LBE1502:
+.LBE1501:
+.LBE1500:
+.LBE1499:
+.LBE1498:
+	.loc 4 50 1 is_stmt 0 view .LVU249
+	movq	%rdi, %rax
+.LVL33:
+	.loc 4 50 1 view .LVU250
+	movq	%rsi, %rdx
+.LVL34:
+.LBB1518:
+.LBB1517:
+.LBB1516:
+.LBB1515:
+.LBB1514:
+.LBB1513:
+.LBB1512:
+.LBB1511:
+.LBB1510:
+.LBB1509:
+.LBB1508:
+.LBI1508:
+	.loc 4 19 3 is_stmt 1 view .LVU251
+	.loc 4 19 3 is_stmt 0 view .LVU252
+.LBE1508:
+.LBE1509:
+.LBE1510:
+.LBE1511:
+.LBE1512:
+.LBE1513:
+.LBE1514:
+.LBE1515:
+.LBE1516:
+.LBE1517:
+.LBE1518:
+	.loc 4 52 1 view .LVU253
+	ret
+	.cfi_endproc
+.LFE13628:
+	.size	typed_value, .-typed_value
+	.p2align 4
+	.globl	typed_emplace
+	.type	typed_emplace, @function
+typed_emplace:
+.LVL35:
+.LFB13656:
+	.loc 4 58 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 4 59 3 view .LVU255
+.LBB1519:
+.LBI1519:
+	.loc 1 519 38 view .LVU256
+.LBB1520:
+.LBI1520:
+	.loc 1 493 22 view .LVU257
+.LBB1521:
+.LBI1521:
+	.loc 2 1063 2 view .LVU258
+.LBB1522:
+.LBI1522:
+	.loc 2 283 7 view .LVU259
+.LBB1523:
+.LBI1523:
+	.loc 2 434 7 view .LVU260
+.LBB1524:
+.LBI1524:
+	.loc 2 192 17 view .LVU261
+	.loc 2 192 17 is_stmt 0 view .LVU262
+.LBE1524:
+.LBE1523:
+.LBB1525:
+.LBI1525:
+	.loc 2 192 17 is_stmt 1 view .LVU263
+	.loc 2 192 17 is_stmt 0 view .LVU264
+.LBE1525:
+.LBE1522:
+.LBE1521:
+.LBE1520:
+.LBE1519:
+.LBB1526:
+.LBI1526:
+	.loc 1 502 13 is_stmt 1 view .LVU265
+.LBB1527:
+.LBI1527:
+	.loc 1 496 16 view .LVU266
+.LBB1528:
+.LBB1529:
+.LBI1529:
+	.loc 2 1858 5 view .LVU267
+.LBB1530:
+.LBB1531:
+.LBI1531:
+	.loc 2 1850 5 view .LVU268
+.LBB1532:
+.LBI1532:
+	.loc 3 90 5 view .LVU269
+.LBB1533:
+.LBB1534:
+.LBI1534:
+	.loc 3 60 5 view .LVU270
+.LBB1535:
+.LBI1535:
+	.loc 1 498 18 view .LVU271
+.LBB1536:
+.LBI1536:
+	.loc 4 19 3 view .LVU272
+	.loc 4 19 3 is_stmt 0 view .LVU273
+.LBE1536:
+.LBE1535:
+.LBE1534:
+.LBE1533:
+.LBE1532:
+.LBE1531:
+.LBE1530:
+.LBE1529:
+.LBE1528:
+.LBE1527:
+.LBE1526:
+	.loc 4 59 53 view .LVU274
+	movq	%rsi, (%rdi)
+	.loc 4 58 1 view .LVU275
+	movq	%rdi, %rax
+	.loc 4 59 53 view .LVU276
+	movq	%rdx, 8(%rdi)
+	.loc 4 60 1 view .LVU277
+	ret
+	.cfi_endproc
+.LFE13656:
+	.size	typed_emplace, .-typed_emplace
+.Letext0:
+	.file 7 "/usr/include/c++/12/type_traits"
+	.file 8 "/usr/include/x86_64-linux-gnu/c++/12/bits/c++config.h"
+	.file 9 "/usr/include/c++/12/concepts"
+	.file 10 "/usr/include/c++/12/bits/iterator_concepts.h"
+	.file 11 "/usr/include/c++/12/bits/ranges_cmp.h"
+	.file 12 "/usr/include/c++/12/compare"
+	.file 13 "/usr/include/c++/12/bits/atomic_wait.h"
+	.file 14 "/usr/include/c++/12/bits/uses_allocator.h"
+	.file 15 "/usr/include/c++/12/debug/debug.h"
+	.file 16 "/usr/include/c++/12/cstdlib"
+	.file 17 "/usr/include/c++/12/numbers"
+	.file 18 "/usr/include/c++/12/bits/exception_ptr.h"
+	.file 19 "/usr/include/c++/12/pstl/glue_execution_defs.h"
+	.file 20 "/usr/include/c++/12/cwchar"
+	.file 21 "/usr/include/c++/12/clocale"
+	.file 22 "/usr/include/c++/12/bits/char_traits.h"
+	.file 23 "/usr/include/c++/12/cstdint"
+	.file 24 "/usr/include/c++/12/bits/new_allocator.h"
+	.file 25 "/usr/include/c++/12/bits/allocator.h"
+	.file 26 "/usr/include/c++/12/string_view"
+	.file 27 "/usr/include/c++/12/cstdio"
+	.file 28 "/usr/include/c++/12/bits/alloc_traits.h"
+	.file 29 "/usr/include/c++/12/bits/basic_string.h"
+	.file 30 "/usr/include/c++/12/initializer_list"
+	.file 31 "/usr/include/c++/12/bits/stringfwd.h"
+	.file 32 "/usr/include/c++/12/functional"
+	.file 33 "/usr/include/c++/12/cstddef"
+	.file 34 "/usr/include/c++/12/bits/atomic_base.h"
+	.file 35 "/usr/include/c++/12/atomic"
+	.file 36 "/usr/include/c++/12/bits/std_abs.h"
+	.file 37 "/usr/include/c++/12/cwctype"
+	.file 38 "/usr/include/c++/12/ctime"
+	.file 39 "/usr/include/c++/12/bits/chrono.h"
+	.file 40 "/usr/include/c++/12/bits/algorithmfwd.h"
+	.file 41 "/usr/include/c++/12/bits/parse_numbers.h"
+	.file 42 "/usr/include/c++/12/bits/std_thread.h"
+	.file 43 "/usr/include/c++/12/bits/shared_ptr_base.h"
+	.file 44 "/usr/include/c++/12/string"
+	.file 45 "/usr/include/c++/12/memory_resource"
+	.file 46 "/usr/include/c++/12/bits/unique_ptr.h"
+	.file 47 "/usr/include/c++/12/bits/stl_vector.h"
+	.file 48 "/usr/include/c++/12/bits/vector.tcc"
+	.file 49 "/usr/include/c++/12/bits/stl_iterator_base_types.h"
+	.file 50 "/usr/include/c++/12/bits/utility.h"
+	.file 51 "/usr/include/c++/12/bits/predefined_ops.h"
+	.file 52 "/usr/include/c++/12/ext/alloc_traits.h"
+	.file 53 "/usr/include/c++/12/bits/stl_iterator.h"
+	.file 54 "/usr/include/c++/12/bits/ptr_traits.h"
+	.file 55 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 56 "/usr/include/stdlib.h"
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.file 64 "/usr/include/c++/12/pstl/execution_defs.h"
+	.file 65 "/usr/include/c++/12/pstl/execution_impl.h"
+	.file 66 "/usr/include/c++/12/pstl/algorithm_impl.h"
+	.file 67 "/usr/include/c++/12/pstl/unseq_backend_simd.h"
+	.file 68 "/usr/include/c++/12/ext/concurrence.h"
+	.file 69 "/usr/include/c++/12/pstl/parallel_backend_utils.h"
+	.file 70 "/usr/include/c++/12/pstl/parallel_backend_tbb.h"
+	.file 71 "<built-in>"
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/wint_t.h"
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 78 "/usr/include/wchar.h"
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.file 80 "/usr/include/locale.h"
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 82 "/usr/include/stdint.h"
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.file 84 "/usr/include/stdio.h"
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.file 86 "/usr/include/c++/12/stdlib.h"
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/wctype-wchar.h"
+	.file 88 "/usr/include/wctype.h"
+	.file 89 "/usr/include/time.h"
+	.file 90 "/usr/include/oneapi/tbb/detail/_assert.h"
+	.file 91 "/usr/include/oneapi/tbb/detail/_machine.h"
+	.file 92 "/usr/include/oneapi/tbb/detail/_utils.h"
+	.file 93 "/usr/include/oneapi/tbb/detail/_range_common.h"
+	.file 94 "/usr/include/oneapi/tbb/detail/_exception.h"
+	.file 95 "/usr/include/oneapi/tbb/profiling.h"
+	.file 96 "/usr/include/oneapi/tbb/detail/_small_object_pool.h"
+	.file 97 "/usr/include/oneapi/tbb/detail/_task.h"
+	.file 98 "/usr/include/oneapi/tbb/task_group.h"
+	.file 99 "/usr/include/oneapi/tbb/cache_aligned_allocator.h"
+	.file 100 "/usr/include/oneapi/tbb/detail/_intrusive_list_node.h"
+	.file 101 "/usr/include/oneapi/tbb/detail/_attach.h"
+	.file 102 "/usr/include/oneapi/tbb/info.h"
+	.file 103 "/usr/include/oneapi/tbb/task_arena.h"
+	.file 104 "/usr/include/oneapi/tbb/partitioner.h"
+	.file 105 "/usr/include/oneapi/tbb/parallel_scan.h"
+	.file 106 "/usr/include/oneapi/tbb/detail/_task_handle.h"
+	.file 107 "/usr/include/oneapi/tbb/blocked_range.h"
+	.file 108 "/usr/include/oneapi/tbb/parallel_for.h"
+	.file 109 "/usr/include/oneapi/tbb/parallel_reduce.h"
+	.file 110 "/usr/include/oneapi/tbb/task.h"
+	.file 111 "/usr/include/oneapi/tbb/detail/_namespace_injection.h"
+	.file 112 "/usr/include/c++/12/new"
+	.file 113 "/usr/include/c++/12/pstl/parallel_backend.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1349a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xb5
+	.long	.LASF2339
+	.byte	0x21
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL311
+	.quad	0
+	.long	.Ldebug_line0
+	.uleb128 0xb6
+	.string	"std"
+	.byte	0x8
+	.value	0x128
+	.byte	0xb
+	.long	0xacaa
+	.uleb128 0x1d
+	.long	.LASF6
+	.byte	0x1
+	.byte	0x7
+	.byte	0x3e
+	.byte	0xc
+	.long	0xa2
+	.uleb128 0xd
+	.long	.LASF8
+	.byte	0x7
+	.byte	0x41
+	.byte	0x2d
+	.long	0xacaa
+	.uleb128 0x25
+	.long	.LASF2
+	.byte	0x7
+	.byte	0x43
+	.byte	0x11
+	.long	.LASF4
+	.long	0x46
+	.long	0x6a
+	.long	0x70
+	.uleb128 0x2
+	.long	0xacb6
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF3
+	.byte	0x7
+	.byte	0x48
+	.byte	0x1c
+	.long	.LASF5
+	.long	0x46
+	.long	0x88
+	.long	0x8e
+	.uleb128 0x2
+	.long	0xacb6
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xacaa
+	.uleb128 0x33
+	.string	"__v"
+	.long	0xacaa
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x39
+	.uleb128 0x1d
+	.long	.LASF7
+	.byte	0x1
+	.byte	0x7
+	.byte	0x3e
+	.byte	0xc
+	.long	0x110
+	.uleb128 0xd
+	.long	.LASF8
+	.byte	0x7
+	.byte	0x41
+	.byte	0x2d
+	.long	0xacaa
+	.uleb128 0x25
+	.long	.LASF9
+	.byte	0x7
+	.byte	0x43
+	.byte	0x11
+	.long	.LASF10
+	.long	0xb4
+	.long	0xd8
+	.long	0xde
+	.uleb128 0x2
+	.long	0xacbb
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF3
+	.byte	0x7
+	.byte	0x48
+	.byte	0x1c
+	.long	.LASF11
+	.long	0xb4
+	.long	0xf6
+	.long	0xfc
+	.uleb128 0x2
+	.long	0xacbb
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xacaa
+	.uleb128 0x33
+	.string	"__v"
+	.long	0xacaa
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	0xa7
+	.uleb128 0xd
+	.long	.LASF12
+	.byte	0x7
+	.byte	0x55
+	.byte	0x9
+	.long	0x39
+	.uleb128 0x21
+	.long	.LASF13
+	.byte	0x8
+	.value	0x12a
+	.byte	0x1a
+	.long	0xacc0
+	.uleb128 0xa
+	.long	0x121
+	.uleb128 0xb7
+	.long	.LASF31
+	.byte	0x1
+	.byte	0x7
+	.value	0x96d
+	.byte	0xa
+	.uleb128 0x60
+	.long	.LASF14
+	.byte	0x7
+	.value	0xa9f
+	.byte	0xd
+	.uleb128 0x60
+	.long	.LASF15
+	.byte	0x7
+	.value	0xaf5
+	.byte	0xd
+	.uleb128 0x39
+	.long	.LASF16
+	.byte	0x9
+	.byte	0xa3
+	.byte	0xd
+	.long	0x190
+	.uleb128 0x45
+	.long	.LASF17
+	.byte	0x9
+	.byte	0xa5
+	.byte	0xf
+	.uleb128 0xb8
+	.long	.LASF27
+	.byte	0x9
+	.byte	0xe1
+	.byte	0x16
+	.uleb128 0x45
+	.long	.LASF18
+	.byte	0xa
+	.byte	0x50
+	.byte	0xf
+	.uleb128 0x60
+	.long	.LASF19
+	.byte	0xa
+	.value	0x320
+	.byte	0xd
+	.uleb128 0x60
+	.long	.LASF20
+	.byte	0xa
+	.value	0x3a3
+	.byte	0x15
+	.uleb128 0x45
+	.long	.LASF21
+	.byte	0xb
+	.byte	0x40
+	.byte	0xd
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF22
+	.byte	0xc
+	.byte	0x31
+	.byte	0xd
+	.uleb128 0x39
+	.long	.LASF21
+	.byte	0x9
+	.byte	0x36
+	.byte	0xd
+	.long	0x1cc
+	.uleb128 0x4d
+	.long	.LASF23
+	.byte	0xd
+	.byte	0x3d
+	.byte	0x1d
+	.long	0x12e
+	.byte	0x4
+	.uleb128 0x4d
+	.long	.LASF24
+	.byte	0xd
+	.byte	0x91
+	.byte	0x14
+	.long	0xacf9
+	.byte	0xc
+	.uleb128 0x4d
+	.long	.LASF25
+	.byte	0xd
+	.byte	0x92
+	.byte	0x14
+	.long	0xacf9
+	.byte	0x10
+	.byte	0
+	.uleb128 0x60
+	.long	.LASF26
+	.byte	0xc
+	.value	0x23b
+	.byte	0xd
+	.uleb128 0x91
+	.long	.LASF28
+	.byte	0xc
+	.value	0x497
+	.uleb128 0x1d
+	.long	.LASF29
+	.byte	0x1
+	.byte	0xe
+	.byte	0x33
+	.byte	0xa
+	.long	0x204
+	.uleb128 0xb9
+	.long	.LASF29
+	.byte	0xe
+	.byte	0x33
+	.byte	0x25
+	.long	.LASF30
+	.byte	0x1
+	.long	0x1fd
+	.uleb128 0x2
+	.long	0xad32
+	.byte	0
+	.byte	0
+	.uleb128 0x92
+	.long	.LASF32
+	.byte	0xe
+	.byte	0x48
+	.byte	0xa
+	.uleb128 0x1d
+	.long	.LASF33
+	.byte	0x1
+	.byte	0xe
+	.byte	0x4a
+	.byte	0xa
+	.long	0x256
+	.uleb128 0x1d
+	.long	.LASF34
+	.byte	0x1
+	.byte	0xe
+	.byte	0x4c
+	.byte	0xc
+	.long	0x243
+	.uleb128 0x61
+	.long	.LASF53
+	.byte	0xe
+	.byte	0x4c
+	.byte	0x2e
+	.long	.LASF1046
+	.long	0x237
+	.uleb128 0x2
+	.long	0xad37
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	0x204
+	.uleb128 0xc
+	.long	.LASF39
+	.byte	0xe
+	.byte	0x4c
+	.byte	0x4b
+	.long	0x21a
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF35
+	.byte	0xf
+	.byte	0x32
+	.byte	0xd
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x7f
+	.byte	0xb
+	.long	0xb54a
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x80
+	.byte	0xb
+	.long	0xb57e
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x86
+	.byte	0xb
+	.long	0xb7cf
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x89
+	.byte	0xb
+	.long	0xb7ed
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x8c
+	.byte	0xb
+	.long	0xb808
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x8d
+	.byte	0xb
+	.long	0xb81e
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x8e
+	.byte	0xb
+	.long	0xb835
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x8f
+	.byte	0xb
+	.long	0xb84c
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x91
+	.byte	0xb
+	.long	0xb876
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x94
+	.byte	0xb
+	.long	0xb893
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x96
+	.byte	0xb
+	.long	0xb8aa
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x99
+	.byte	0xb
+	.long	0xb8c6
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x9a
+	.byte	0xb
+	.long	0xb8e2
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x9b
+	.byte	0xb
+	.long	0xb908
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x9d
+	.byte	0xb
+	.long	0xb929
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xa0
+	.byte	0xb
+	.long	0xb94a
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xa3
+	.byte	0xb
+	.long	0xb95e
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xa5
+	.byte	0xb
+	.long	0xb96c
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xa6
+	.byte	0xb
+	.long	0xb97e
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xa7
+	.byte	0xb
+	.long	0xb99e
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xa8
+	.byte	0xb
+	.long	0xb9be
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xa9
+	.byte	0xb
+	.long	0xb9de
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xab
+	.byte	0xb
+	.long	0xb9f5
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xac
+	.byte	0xb
+	.long	0xba1b
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xf0
+	.byte	0x16
+	.long	0xb5b2
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xf5
+	.byte	0x16
+	.long	0xad91
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xf6
+	.byte	0x16
+	.long	0xba37
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xf8
+	.byte	0x16
+	.long	0xba53
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xf9
+	.byte	0x16
+	.long	0xbaaa
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xfa
+	.byte	0x16
+	.long	0xba6a
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xfb
+	.byte	0x16
+	.long	0xba8a
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xfc
+	.byte	0x16
+	.long	0xbac5
+	.uleb128 0x45
+	.long	.LASF36
+	.byte	0x11
+	.byte	0x30
+	.byte	0xb
+	.uleb128 0xd
+	.long	.LASF37
+	.byte	0x7
+	.byte	0x52
+	.byte	0x9
+	.long	0xa7
+	.uleb128 0x39
+	.long	.LASF38
+	.byte	0x12
+	.byte	0x3f
+	.byte	0xd
+	.long	0x556
+	.uleb128 0x29
+	.long	.LASF41
+	.byte	0x8
+	.byte	0x12
+	.byte	0x5a
+	.byte	0xb
+	.long	0x548
+	.uleb128 0xc
+	.long	.LASF40
+	.byte	0x12
+	.byte	0x5c
+	.byte	0xd
+	.long	0xb6e6
+	.byte	0
+	.uleb128 0x7f
+	.long	.LASF41
+	.byte	0x12
+	.byte	0x5e
+	.byte	0x10
+	.long	.LASF42
+	.long	0x3ac
+	.long	0x3b7
+	.uleb128 0x2
+	.long	0xbcec
+	.uleb128 0x1
+	.long	0xb6e6
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF43
+	.byte	0x12
+	.byte	0x60
+	.byte	0xc
+	.long	.LASF45
+	.long	0x3cb
+	.long	0x3d1
+	.uleb128 0x2
+	.long	0xbcec
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF44
+	.byte	0x12
+	.byte	0x61
+	.byte	0xc
+	.long	.LASF46
+	.long	0x3e5
+	.long	0x3eb
+	.uleb128 0x2
+	.long	0xbcec
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF47
+	.byte	0x12
+	.byte	0x63
+	.byte	0xd
+	.long	.LASF48
+	.long	0xb6e6
+	.long	0x403
+	.long	0x409
+	.uleb128 0x2
+	.long	0xbcf1
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF41
+	.byte	0x12
+	.byte	0x6b
+	.byte	0x7
+	.long	.LASF49
+	.byte	0x1
+	.long	0x41e
+	.long	0x424
+	.uleb128 0x2
+	.long	0xbcec
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF41
+	.byte	0x12
+	.byte	0x6d
+	.byte	0x7
+	.long	.LASF50
+	.byte	0x1
+	.long	0x439
+	.long	0x444
+	.uleb128 0x2
+	.long	0xbcec
+	.uleb128 0x1
+	.long	0xbcf6
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF41
+	.byte	0x12
+	.byte	0x70
+	.byte	0x7
+	.long	.LASF51
+	.byte	0x1
+	.long	0x459
+	.long	0x464
+	.uleb128 0x2
+	.long	0xbcec
+	.uleb128 0x1
+	.long	0x575
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF41
+	.byte	0x12
+	.byte	0x74
+	.byte	0x7
+	.long	.LASF52
+	.byte	0x1
+	.long	0x479
+	.long	0x484
+	.uleb128 0x2
+	.long	0xbcec
+	.uleb128 0x1
+	.long	0xbcfb
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF53
+	.byte	0x12
+	.byte	0x81
+	.byte	0x7
+	.long	.LASF54
+	.long	0xbd00
+	.byte	0x1
+	.long	0x49d
+	.long	0x4a8
+	.uleb128 0x2
+	.long	0xbcec
+	.uleb128 0x1
+	.long	0xbcf6
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF53
+	.byte	0x12
+	.byte	0x85
+	.byte	0x7
+	.long	.LASF55
+	.long	0xbd00
+	.byte	0x1
+	.long	0x4c1
+	.long	0x4cc
+	.uleb128 0x2
+	.long	0xbcec
+	.uleb128 0x1
+	.long	0xbcfb
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF56
+	.byte	0x12
+	.byte	0x8c
+	.byte	0x7
+	.long	.LASF57
+	.byte	0x1
+	.long	0x4e1
+	.long	0x4ec
+	.uleb128 0x2
+	.long	0xbcec
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF58
+	.byte	0x12
+	.byte	0x8f
+	.byte	0x7
+	.long	.LASF59
+	.byte	0x1
+	.long	0x501
+	.long	0x50c
+	.uleb128 0x2
+	.long	0xbcec
+	.uleb128 0x1
+	.long	0xbd00
+	.byte	0
+	.uleb128 0x80
+	.long	.LASF107
+	.byte	0x12
+	.byte	0x9b
+	.byte	0x10
+	.long	.LASF108
+	.long	0xacaa
+	.long	0x525
+	.long	0x52b
+	.uleb128 0x2
+	.long	0xbcf1
+	.byte	0
+	.uleb128 0xba
+	.long	.LASF60
+	.byte	0x12
+	.byte	0xb0
+	.byte	0x7
+	.long	.LASF61
+	.long	0xbd05
+	.byte	0x1
+	.long	0x541
+	.uleb128 0x2
+	.long	0xbcf1
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x37e
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x54
+	.byte	0x10
+	.long	0x55e
+	.byte	0
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x44
+	.byte	0x1a
+	.long	0x37e
+	.uleb128 0xbb
+	.long	.LASF62
+	.byte	0x12
+	.byte	0x50
+	.byte	0x8
+	.long	.LASF63
+	.long	0x575
+	.uleb128 0x1
+	.long	0x37e
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF64
+	.byte	0x8
+	.value	0x12e
+	.byte	0x1d
+	.long	0xbce6
+	.uleb128 0x3e
+	.long	.LASF217
+	.uleb128 0xa
+	.long	0x582
+	.uleb128 0x39
+	.long	.LASF65
+	.byte	0x13
+	.byte	0x1e
+	.byte	0xb
+	.long	0x5d9
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x21
+	.byte	0x1a
+	.long	0xbb44
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x22
+	.byte	0x1a
+	.long	0xbb81
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x23
+	.byte	0x1a
+	.long	0xbb07
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x26
+	.byte	0x1a
+	.long	0xbc99
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x27
+	.byte	0x1a
+	.long	0xbc9e
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x28
+	.byte	0x1a
+	.long	0xbc94
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x2d
+	.byte	0x1a
+	.long	0xbca3
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x2e
+	.byte	0x1a
+	.long	0xbbbe
+	.byte	0
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x40
+	.byte	0xb
+	.long	0xbda3
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x8d
+	.byte	0xb
+	.long	0xbd40
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x8f
+	.byte	0xb
+	.long	0xbf53
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x90
+	.byte	0xb
+	.long	0xbf6a
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x91
+	.byte	0xb
+	.long	0xbf86
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x92
+	.byte	0xb
+	.long	0xbfa7
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x93
+	.byte	0xb
+	.long	0xbfc3
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x94
+	.byte	0xb
+	.long	0xbfdf
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x95
+	.byte	0xb
+	.long	0xbffb
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x96
+	.byte	0xb
+	.long	0xc018
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x97
+	.byte	0xb
+	.long	0xc039
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x98
+	.byte	0xb
+	.long	0xc050
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x99
+	.byte	0xb
+	.long	0xc05e
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x9a
+	.byte	0xb
+	.long	0xc084
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x9b
+	.byte	0xb
+	.long	0xc0aa
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x9c
+	.byte	0xb
+	.long	0xc0c6
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x9d
+	.byte	0xb
+	.long	0xc0f1
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x9e
+	.byte	0xb
+	.long	0xc10d
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xa0
+	.byte	0xb
+	.long	0xc124
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xa2
+	.byte	0xb
+	.long	0xc146
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xa3
+	.byte	0xb
+	.long	0xc167
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xa4
+	.byte	0xb
+	.long	0xc183
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xa6
+	.byte	0xb
+	.long	0xc1a9
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xa9
+	.byte	0xb
+	.long	0xc1ce
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xac
+	.byte	0xb
+	.long	0xc1f4
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xae
+	.byte	0xb
+	.long	0xc219
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xb0
+	.byte	0xb
+	.long	0xc235
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xb2
+	.byte	0xb
+	.long	0xc255
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xb3
+	.byte	0xb
+	.long	0xc276
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xb4
+	.byte	0xb
+	.long	0xc291
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xb5
+	.byte	0xb
+	.long	0xc2ac
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xb6
+	.byte	0xb
+	.long	0xc2c7
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xb7
+	.byte	0xb
+	.long	0xc2e2
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xb8
+	.byte	0xb
+	.long	0xc2fd
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xb9
+	.byte	0xb
+	.long	0xc3ca
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xba
+	.byte	0xb
+	.long	0xc3e0
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xbb
+	.byte	0xb
+	.long	0xc400
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xbc
+	.byte	0xb
+	.long	0xc420
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xbd
+	.byte	0xb
+	.long	0xc440
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xbe
+	.byte	0xb
+	.long	0xc46b
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xbf
+	.byte	0xb
+	.long	0xc486
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xc1
+	.byte	0xb
+	.long	0xc4a7
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xc3
+	.byte	0xb
+	.long	0xc4c3
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xc4
+	.byte	0xb
+	.long	0xc4e3
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xc5
+	.byte	0xb
+	.long	0xc504
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xc6
+	.byte	0xb
+	.long	0xc525
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xc7
+	.byte	0xb
+	.long	0xc545
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xc8
+	.byte	0xb
+	.long	0xc55c
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xc9
+	.byte	0xb
+	.long	0xc57d
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xca
+	.byte	0xb
+	.long	0xc59e
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xcb
+	.byte	0xb
+	.long	0xc5bf
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xcc
+	.byte	0xb
+	.long	0xc5e0
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xcd
+	.byte	0xb
+	.long	0xc5f8
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xce
+	.byte	0xb
+	.long	0xc614
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xce
+	.byte	0xb
+	.long	0xc633
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xcf
+	.byte	0xb
+	.long	0xc652
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xcf
+	.byte	0xb
+	.long	0xc671
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xd0
+	.byte	0xb
+	.long	0xc690
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xd0
+	.byte	0xb
+	.long	0xc6af
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xd1
+	.byte	0xb
+	.long	0xc6ce
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xd1
+	.byte	0xb
+	.long	0xc6ed
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xd2
+	.byte	0xb
+	.long	0xc70c
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xd2
+	.byte	0xb
+	.long	0xc730
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x10b
+	.byte	0x16
+	.long	0xc754
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x10c
+	.byte	0x16
+	.long	0xc770
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x10d
+	.byte	0x16
+	.long	0xc791
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x11b
+	.byte	0xe
+	.long	0xc4a7
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x11e
+	.byte	0xe
+	.long	0xc1a9
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x121
+	.byte	0xe
+	.long	0xc1f4
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x124
+	.byte	0xe
+	.long	0xc235
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x128
+	.byte	0xe
+	.long	0xc754
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x129
+	.byte	0xe
+	.long	0xc770
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x12a
+	.byte	0xe
+	.long	0xc791
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x35
+	.byte	0xb
+	.long	0xc7b2
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x36
+	.byte	0xb
+	.long	0xc8f8
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x37
+	.byte	0xb
+	.long	0xc913
+	.uleb128 0x3a
+	.long	.LASF66
+	.byte	0x1
+	.byte	0x16
+	.value	0x14f
+	.byte	0xc
+	.long	0xa2e
+	.uleb128 0x46
+	.long	.LASF67
+	.byte	0x16
+	.value	0x15b
+	.byte	0x7
+	.long	.LASF225
+	.long	0x86d
+	.uleb128 0x1
+	.long	0xc924
+	.uleb128 0x1
+	.long	0xc929
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF68
+	.byte	0x16
+	.value	0x151
+	.byte	0x21
+	.long	0xb5cd
+	.uleb128 0xa
+	.long	0x86d
+	.uleb128 0x93
+	.string	"eq"
+	.value	0x166
+	.long	.LASF69
+	.long	0xacaa
+	.long	0x89d
+	.uleb128 0x1
+	.long	0xc929
+	.uleb128 0x1
+	.long	0xc929
+	.byte	0
+	.uleb128 0x93
+	.string	"lt"
+	.value	0x16a
+	.long	.LASF70
+	.long	0xacaa
+	.long	0x8bb
+	.uleb128 0x1
+	.long	0xc929
+	.uleb128 0x1
+	.long	0xc929
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF71
+	.byte	0x16
+	.value	0x172
+	.byte	0x7
+	.long	.LASF73
+	.long	0xacf1
+	.long	0x8e0
+	.uleb128 0x1
+	.long	0xc92e
+	.uleb128 0x1
+	.long	0xc92e
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF72
+	.byte	0x16
+	.value	0x185
+	.byte	0x7
+	.long	.LASF74
+	.long	0x121
+	.long	0x8fb
+	.uleb128 0x1
+	.long	0xc92e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF75
+	.byte	0x16
+	.value	0x18f
+	.byte	0x7
+	.long	.LASF76
+	.long	0xc92e
+	.long	0x920
+	.uleb128 0x1
+	.long	0xc92e
+	.uleb128 0x1
+	.long	0x121
+	.uleb128 0x1
+	.long	0xc929
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF77
+	.byte	0x16
+	.value	0x19b
+	.byte	0x7
+	.long	.LASF78
+	.long	0xc933
+	.long	0x945
+	.uleb128 0x1
+	.long	0xc933
+	.uleb128 0x1
+	.long	0xc92e
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF79
+	.byte	0x16
+	.value	0x1a7
+	.byte	0x7
+	.long	.LASF80
+	.long	0xc933
+	.long	0x96a
+	.uleb128 0x1
+	.long	0xc933
+	.uleb128 0x1
+	.long	0xc92e
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF67
+	.byte	0x16
+	.value	0x1b3
+	.byte	0x7
+	.long	.LASF81
+	.long	0xc933
+	.long	0x98f
+	.uleb128 0x1
+	.long	0xc933
+	.uleb128 0x1
+	.long	0x121
+	.uleb128 0x1
+	.long	0x86d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF82
+	.byte	0x16
+	.value	0x1bf
+	.byte	0x7
+	.long	.LASF83
+	.long	0x86d
+	.long	0x9aa
+	.uleb128 0x1
+	.long	0xc938
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF84
+	.byte	0x16
+	.value	0x152
+	.byte	0x21
+	.long	0xacf1
+	.uleb128 0xa
+	.long	0x9aa
+	.uleb128 0x14
+	.long	.LASF85
+	.byte	0x16
+	.value	0x1c5
+	.byte	0x7
+	.long	.LASF86
+	.long	0x9aa
+	.long	0x9d7
+	.uleb128 0x1
+	.long	0xc929
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF87
+	.byte	0x16
+	.value	0x1c9
+	.byte	0x7
+	.long	.LASF88
+	.long	0xacaa
+	.long	0x9f7
+	.uleb128 0x1
+	.long	0xc938
+	.uleb128 0x1
+	.long	0xc938
+	.byte	0
+	.uleb128 0xbc
+	.string	"eof"
+	.byte	0x16
+	.value	0x1cd
+	.byte	0x7
+	.long	.LASF2340
+	.long	0x9aa
+	.uleb128 0x14
+	.long	.LASF89
+	.byte	0x16
+	.value	0x1d1
+	.byte	0x7
+	.long	.LASF90
+	.long	0x9aa
+	.long	0xa24
+	.uleb128 0x1
+	.long	0xc938
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF91
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x2f
+	.byte	0xb
+	.long	0xb721
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x30
+	.byte	0xb
+	.long	0xb72d
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x31
+	.byte	0xb
+	.long	0xb739
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x32
+	.byte	0xb
+	.long	0xb745
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x34
+	.byte	0xb
+	.long	0xc9d7
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x35
+	.byte	0xb
+	.long	0xc9e3
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x36
+	.byte	0xb
+	.long	0xc9ef
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x37
+	.byte	0xb
+	.long	0xc9fb
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x39
+	.byte	0xb
+	.long	0xc977
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x3a
+	.byte	0xb
+	.long	0xc983
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x3b
+	.byte	0xb
+	.long	0xc98f
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x3c
+	.byte	0xb
+	.long	0xc99b
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x3e
+	.byte	0xb
+	.long	0xca4f
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x3f
+	.byte	0xb
+	.long	0xca37
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x41
+	.byte	0xb
+	.long	0xc93d
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x42
+	.byte	0xb
+	.long	0xc94e
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x43
+	.byte	0xb
+	.long	0xc95a
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x44
+	.byte	0xb
+	.long	0xc966
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x46
+	.byte	0xb
+	.long	0xca07
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x47
+	.byte	0xb
+	.long	0xca13
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x48
+	.byte	0xb
+	.long	0xca1f
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x49
+	.byte	0xb
+	.long	0xca2b
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x4b
+	.byte	0xb
+	.long	0xc9a7
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x4c
+	.byte	0xb
+	.long	0xc9b3
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x4d
+	.byte	0xb
+	.long	0xc9bf
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x4e
+	.byte	0xb
+	.long	0xc9cb
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x50
+	.byte	0xb
+	.long	0xca5b
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x51
+	.byte	0xb
+	.long	0xca43
+	.uleb128 0x21
+	.long	.LASF92
+	.byte	0x8
+	.value	0x12b
+	.byte	0x1c
+	.long	0xacfe
+	.uleb128 0x29
+	.long	.LASF93
+	.byte	0x1
+	.byte	0x18
+	.byte	0x38
+	.byte	0xb
+	.long	0xbe6
+	.uleb128 0x1b
+	.long	.LASF94
+	.byte	0x18
+	.byte	0x50
+	.byte	0x7
+	.long	.LASF95
+	.byte	0x1
+	.long	0xb3d
+	.long	0xb43
+	.uleb128 0x2
+	.long	0xca67
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF94
+	.byte	0x18
+	.byte	0x53
+	.byte	0x7
+	.long	.LASF96
+	.byte	0x1
+	.long	0xb58
+	.long	0xb63
+	.uleb128 0x2
+	.long	0xca67
+	.uleb128 0x1
+	.long	0xca6c
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF97
+	.byte	0x18
+	.byte	0x70
+	.byte	0x7
+	.long	.LASF98
+	.long	0xb6fa
+	.byte	0x1
+	.long	0xb7c
+	.long	0xb8c
+	.uleb128 0x2
+	.long	0xca67
+	.uleb128 0x1
+	.long	0xb8c
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF115
+	.byte	0x18
+	.byte	0x3c
+	.byte	0x1f
+	.long	0x121
+	.byte	0x1
+	.uleb128 0x1b
+	.long	.LASF99
+	.byte	0x18
+	.byte	0x8e
+	.byte	0x7
+	.long	.LASF100
+	.byte	0x1
+	.long	0xbae
+	.long	0xbbe
+	.uleb128 0x2
+	.long	0xca67
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xb8c
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF101
+	.byte	0x18
+	.byte	0xd2
+	.byte	0x7
+	.long	.LASF102
+	.long	0xb8c
+	.long	0xbd6
+	.long	0xbdc
+	.uleb128 0x2
+	.long	0xca71
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0xa
+	.long	0xb1b
+	.uleb128 0x29
+	.long	.LASF103
+	.byte	0x1
+	.byte	0x19
+	.byte	0x7c
+	.byte	0xb
+	.long	0xcc3
+	.uleb128 0x3b
+	.long	0xb1b
+	.byte	0
+	.byte	0x1
+	.uleb128 0x1b
+	.long	.LASF104
+	.byte	0x19
+	.byte	0x9c
+	.byte	0x7
+	.long	.LASF105
+	.byte	0x1
+	.long	0xc14
+	.long	0xc1a
+	.uleb128 0x2
+	.long	0xca76
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF104
+	.byte	0x19
+	.byte	0x9f
+	.byte	0x7
+	.long	.LASF106
+	.byte	0x1
+	.long	0xc2f
+	.long	0xc3a
+	.uleb128 0x2
+	.long	0xca76
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x70
+	.long	.LASF53
+	.byte	0x19
+	.byte	0xa4
+	.byte	0x12
+	.long	.LASF109
+	.long	0xca80
+	.long	0xc52
+	.long	0xc5d
+	.uleb128 0x2
+	.long	0xca76
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF110
+	.byte	0x19
+	.byte	0xae
+	.byte	0x7
+	.long	.LASF111
+	.byte	0x1
+	.long	0xc72
+	.long	0xc7d
+	.uleb128 0x2
+	.long	0xca76
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF97
+	.byte	0x19
+	.byte	0xb3
+	.byte	0x7
+	.long	.LASF112
+	.long	0xb6fa
+	.byte	0x1
+	.long	0xc96
+	.long	0xca1
+	.uleb128 0x2
+	.long	0xca76
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x81
+	.long	.LASF99
+	.byte	0x19
+	.byte	0xc1
+	.byte	0x7
+	.long	.LASF113
+	.long	0xcb2
+	.uleb128 0x2
+	.long	0xca76
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xbeb
+	.uleb128 0x29
+	.long	.LASF114
+	.byte	0x10
+	.byte	0x1a
+	.byte	0x64
+	.byte	0xb
+	.long	0x177a
+	.uleb128 0x23
+	.long	.LASF115
+	.byte	0x1a
+	.byte	0x77
+	.byte	0xd
+	.long	0x121
+	.byte	0x1
+	.uleb128 0x1b
+	.long	.LASF116
+	.byte	0x1a
+	.byte	0x7e
+	.byte	0x7
+	.long	.LASF117
+	.byte	0x1
+	.long	0xcf7
+	.long	0xcfd
+	.uleb128 0x2
+	.long	0xca85
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF116
+	.byte	0x1a
+	.byte	0x82
+	.byte	0x11
+	.long	.LASF118
+	.long	0xd11
+	.long	0xd1c
+	.uleb128 0x2
+	.long	0xca85
+	.uleb128 0x1
+	.long	0xca8a
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF116
+	.byte	0x1a
+	.byte	0x85
+	.byte	0x7
+	.long	.LASF119
+	.byte	0x1
+	.long	0xd31
+	.long	0xd3c
+	.uleb128 0x2
+	.long	0xca85
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF116
+	.byte	0x1a
+	.byte	0x8b
+	.byte	0x7
+	.long	.LASF120
+	.byte	0x1
+	.long	0xd51
+	.long	0xd61
+	.uleb128 0x2
+	.long	0xca85
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x66
+	.long	.LASF116
+	.byte	0x1a
+	.byte	0xab
+	.byte	0x7
+	.long	.LASF121
+	.long	0xd75
+	.long	0xd80
+	.uleb128 0x2
+	.long	0xca85
+	.uleb128 0x1
+	.long	0x575
+	.byte	0
+	.uleb128 0x70
+	.long	.LASF53
+	.byte	0x1a
+	.byte	0xb1
+	.byte	0x7
+	.long	.LASF122
+	.long	0xca8f
+	.long	0xd98
+	.long	0xda3
+	.uleb128 0x2
+	.long	0xca85
+	.uleb128 0x1
+	.long	0xca8a
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF123
+	.byte	0x1a
+	.byte	0x73
+	.byte	0xd
+	.long	0xca94
+	.byte	0x1
+	.uleb128 0x23
+	.long	.LASF8
+	.byte	0x1a
+	.byte	0x6e
+	.byte	0xd
+	.long	0xb5cd
+	.byte	0x1
+	.uleb128 0xa
+	.long	0xdb0
+	.uleb128 0x1a
+	.long	.LASF124
+	.byte	0x1a
+	.byte	0xb6
+	.byte	0x7
+	.long	.LASF125
+	.long	0xda3
+	.byte	0x1
+	.long	0xddb
+	.long	0xde1
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x71
+	.string	"end"
+	.byte	0x1a
+	.byte	0xba
+	.long	.LASF149
+	.long	0xda3
+	.long	0xdf8
+	.long	0xdfe
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF126
+	.byte	0x1a
+	.byte	0xbe
+	.byte	0x7
+	.long	.LASF127
+	.long	0xda3
+	.byte	0x1
+	.long	0xe17
+	.long	0xe1d
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF128
+	.byte	0x1a
+	.byte	0xc2
+	.byte	0x7
+	.long	.LASF129
+	.long	0xda3
+	.byte	0x1
+	.long	0xe36
+	.long	0xe3c
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF130
+	.byte	0x1a
+	.byte	0x75
+	.byte	0xd
+	.long	0x177f
+	.byte	0x1
+	.uleb128 0x1a
+	.long	.LASF131
+	.byte	0x1a
+	.byte	0xc6
+	.byte	0x7
+	.long	.LASF132
+	.long	0xe3c
+	.byte	0x1
+	.long	0xe62
+	.long	0xe68
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF133
+	.byte	0x1a
+	.byte	0xca
+	.byte	0x7
+	.long	.LASF134
+	.long	0xe3c
+	.byte	0x1
+	.long	0xe81
+	.long	0xe87
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF135
+	.byte	0x1a
+	.byte	0xce
+	.byte	0x7
+	.long	.LASF136
+	.long	0xe3c
+	.byte	0x1
+	.long	0xea0
+	.long	0xea6
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF137
+	.byte	0x1a
+	.byte	0xd2
+	.byte	0x7
+	.long	.LASF138
+	.long	0xe3c
+	.byte	0x1
+	.long	0xebf
+	.long	0xec5
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF139
+	.byte	0x1a
+	.byte	0xd8
+	.byte	0x7
+	.long	.LASF140
+	.long	0xcd5
+	.byte	0x1
+	.long	0xede
+	.long	0xee4
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF72
+	.byte	0x1a
+	.byte	0xdc
+	.byte	0x7
+	.long	.LASF141
+	.long	0xcd5
+	.byte	0x1
+	.long	0xefd
+	.long	0xf03
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF142
+	.byte	0x1a
+	.byte	0xe0
+	.byte	0x7
+	.long	.LASF143
+	.long	0xcd5
+	.byte	0x1
+	.long	0xf1c
+	.long	0xf22
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF144
+	.byte	0x1a
+	.byte	0xe7
+	.byte	0x7
+	.long	.LASF145
+	.long	0xacaa
+	.byte	0x1
+	.long	0xf3b
+	.long	0xf41
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF146
+	.byte	0x1a
+	.byte	0x72
+	.byte	0xd
+	.long	0xca9e
+	.byte	0x1
+	.uleb128 0x1a
+	.long	.LASF147
+	.byte	0x1a
+	.byte	0xed
+	.byte	0x7
+	.long	.LASF148
+	.long	0xf41
+	.byte	0x1
+	.long	0xf67
+	.long	0xf72
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x71
+	.string	"at"
+	.byte	0x1a
+	.byte	0xf4
+	.long	.LASF150
+	.long	0xf41
+	.long	0xf88
+	.long	0xf93
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF151
+	.byte	0x1a
+	.byte	0xfe
+	.byte	0x7
+	.long	.LASF152
+	.long	0xf41
+	.byte	0x1
+	.long	0xfac
+	.long	0xfb2
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF153
+	.byte	0x1a
+	.value	0x105
+	.byte	0x7
+	.long	.LASF156
+	.long	0xf41
+	.byte	0x1
+	.long	0xfcc
+	.long	0xfd2
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF154
+	.byte	0x1a
+	.byte	0x70
+	.byte	0xd
+	.long	0xca94
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF155
+	.byte	0x1a
+	.value	0x10c
+	.byte	0x7
+	.long	.LASF157
+	.long	0xfd2
+	.byte	0x1
+	.long	0xff9
+	.long	0xfff
+	.uleb128 0x2
+	.long	0xca99
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF158
+	.byte	0x1a
+	.value	0x112
+	.byte	0x7
+	.long	.LASF160
+	.byte	0x1
+	.long	0x1015
+	.long	0x1020
+	.uleb128 0x2
+	.long	0xca85
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF159
+	.byte	0x1a
+	.value	0x11a
+	.byte	0x7
+	.long	.LASF161
+	.byte	0x1
+	.long	0x1036
+	.long	0x1041
+	.uleb128 0x2
+	.long	0xca85
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF58
+	.byte	0x1a
+	.value	0x11e
+	.byte	0x7
+	.long	.LASF162
+	.byte	0x1
+	.long	0x1057
+	.long	0x1062
+	.uleb128 0x2
+	.long	0xca85
+	.uleb128 0x1
+	.long	0xca8f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF79
+	.byte	0x1a
+	.value	0x129
+	.byte	0x7
+	.long	.LASF163
+	.long	0xcd5
+	.byte	0x1
+	.long	0x107c
+	.long	0x1091
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF164
+	.byte	0x1a
+	.value	0x135
+	.byte	0x7
+	.long	.LASF165
+	.long	0xcc8
+	.byte	0x1
+	.long	0x10ab
+	.long	0x10bb
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1a
+	.value	0x13d
+	.byte	0x7
+	.long	.LASF166
+	.long	0xacf1
+	.byte	0x1
+	.long	0x10d5
+	.long	0x10e0
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcc8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1a
+	.value	0x147
+	.byte	0x7
+	.long	.LASF167
+	.long	0xacf1
+	.byte	0x1
+	.long	0x10fa
+	.long	0x110f
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcc8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1a
+	.value	0x14b
+	.byte	0x7
+	.long	.LASF168
+	.long	0xacf1
+	.byte	0x1
+	.long	0x1129
+	.long	0x1148
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcc8
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1a
+	.value	0x152
+	.byte	0x7
+	.long	.LASF169
+	.long	0xacf1
+	.byte	0x1
+	.long	0x1162
+	.long	0x116d
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1a
+	.value	0x156
+	.byte	0x7
+	.long	.LASF170
+	.long	0xacf1
+	.byte	0x1
+	.long	0x1187
+	.long	0x119c
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1a
+	.value	0x15a
+	.byte	0x7
+	.long	.LASF171
+	.long	0xacf1
+	.byte	0x1
+	.long	0x11b6
+	.long	0x11d0
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF172
+	.byte	0x1a
+	.value	0x164
+	.byte	0x7
+	.long	.LASF173
+	.long	0xacaa
+	.byte	0x1
+	.long	0x11ea
+	.long	0x11f5
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcc8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF172
+	.byte	0x1a
+	.value	0x168
+	.byte	0x7
+	.long	.LASF174
+	.long	0xacaa
+	.byte	0x1
+	.long	0x120f
+	.long	0x121a
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF172
+	.byte	0x1a
+	.value	0x16c
+	.byte	0x7
+	.long	.LASF175
+	.long	0xacaa
+	.byte	0x1
+	.long	0x1234
+	.long	0x123f
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF176
+	.byte	0x1a
+	.value	0x170
+	.byte	0x7
+	.long	.LASF177
+	.long	0xacaa
+	.byte	0x1
+	.long	0x1259
+	.long	0x1264
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcc8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF176
+	.byte	0x1a
+	.value	0x179
+	.byte	0x7
+	.long	.LASF178
+	.long	0xacaa
+	.byte	0x1
+	.long	0x127e
+	.long	0x1289
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF176
+	.byte	0x1a
+	.value	0x17d
+	.byte	0x7
+	.long	.LASF179
+	.long	0xacaa
+	.byte	0x1
+	.long	0x12a3
+	.long	0x12ae
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF180
+	.byte	0x1a
+	.value	0x184
+	.byte	0x7
+	.long	.LASF181
+	.long	0xacaa
+	.byte	0x1
+	.long	0x12c8
+	.long	0x12d3
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcc8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF180
+	.byte	0x1a
+	.value	0x188
+	.byte	0x7
+	.long	.LASF182
+	.long	0xacaa
+	.byte	0x1
+	.long	0x12ed
+	.long	0x12f8
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF180
+	.byte	0x1a
+	.value	0x18c
+	.byte	0x7
+	.long	.LASF183
+	.long	0xacaa
+	.byte	0x1
+	.long	0x1312
+	.long	0x131d
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0x1a
+	.value	0x193
+	.byte	0x7
+	.long	.LASF184
+	.long	0xcd5
+	.byte	0x1
+	.long	0x1337
+	.long	0x1347
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcc8
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0x1a
+	.value	0x197
+	.byte	0x7
+	.long	.LASF185
+	.long	0xcd5
+	.byte	0x1
+	.long	0x1361
+	.long	0x1371
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0x1a
+	.value	0x19a
+	.byte	0x7
+	.long	.LASF186
+	.long	0xcd5
+	.byte	0x1
+	.long	0x138b
+	.long	0x13a0
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0x1a
+	.value	0x19d
+	.byte	0x7
+	.long	.LASF187
+	.long	0xcd5
+	.byte	0x1
+	.long	0x13ba
+	.long	0x13ca
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF188
+	.byte	0x1a
+	.value	0x1a1
+	.byte	0x7
+	.long	.LASF189
+	.long	0xcd5
+	.byte	0x1
+	.long	0x13e4
+	.long	0x13f4
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcc8
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF188
+	.byte	0x1a
+	.value	0x1a5
+	.byte	0x7
+	.long	.LASF190
+	.long	0xcd5
+	.byte	0x1
+	.long	0x140e
+	.long	0x141e
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF188
+	.byte	0x1a
+	.value	0x1a8
+	.byte	0x7
+	.long	.LASF191
+	.long	0xcd5
+	.byte	0x1
+	.long	0x1438
+	.long	0x144d
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF188
+	.byte	0x1a
+	.value	0x1ab
+	.byte	0x7
+	.long	.LASF192
+	.long	0xcd5
+	.byte	0x1
+	.long	0x1467
+	.long	0x1477
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF193
+	.byte	0x1a
+	.value	0x1af
+	.byte	0x7
+	.long	.LASF194
+	.long	0xcd5
+	.byte	0x1
+	.long	0x1491
+	.long	0x14a1
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcc8
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF193
+	.byte	0x1a
+	.value	0x1b3
+	.byte	0x7
+	.long	.LASF195
+	.long	0xcd5
+	.byte	0x1
+	.long	0x14bb
+	.long	0x14cb
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF193
+	.byte	0x1a
+	.value	0x1b7
+	.byte	0x7
+	.long	.LASF196
+	.long	0xcd5
+	.byte	0x1
+	.long	0x14e5
+	.long	0x14fa
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF193
+	.byte	0x1a
+	.value	0x1bb
+	.byte	0x7
+	.long	.LASF197
+	.long	0xcd5
+	.byte	0x1
+	.long	0x1514
+	.long	0x1524
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF198
+	.byte	0x1a
+	.value	0x1bf
+	.byte	0x7
+	.long	.LASF199
+	.long	0xcd5
+	.byte	0x1
+	.long	0x153e
+	.long	0x154e
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcc8
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF198
+	.byte	0x1a
+	.value	0x1c4
+	.byte	0x7
+	.long	.LASF200
+	.long	0xcd5
+	.byte	0x1
+	.long	0x1568
+	.long	0x1578
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF198
+	.byte	0x1a
+	.value	0x1c8
+	.byte	0x7
+	.long	.LASF201
+	.long	0xcd5
+	.byte	0x1
+	.long	0x1592
+	.long	0x15a7
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF198
+	.byte	0x1a
+	.value	0x1cc
+	.byte	0x7
+	.long	.LASF202
+	.long	0xcd5
+	.byte	0x1
+	.long	0x15c1
+	.long	0x15d1
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF203
+	.byte	0x1a
+	.value	0x1d0
+	.byte	0x7
+	.long	.LASF204
+	.long	0xcd5
+	.byte	0x1
+	.long	0x15eb
+	.long	0x15fb
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcc8
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF203
+	.byte	0x1a
+	.value	0x1d5
+	.byte	0x7
+	.long	.LASF205
+	.long	0xcd5
+	.byte	0x1
+	.long	0x1615
+	.long	0x1625
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF203
+	.byte	0x1a
+	.value	0x1d8
+	.byte	0x7
+	.long	.LASF206
+	.long	0xcd5
+	.byte	0x1
+	.long	0x163f
+	.long	0x1654
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF203
+	.byte	0x1a
+	.value	0x1dc
+	.byte	0x7
+	.long	.LASF207
+	.long	0xcd5
+	.byte	0x1
+	.long	0x166e
+	.long	0x167e
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF208
+	.byte	0x1a
+	.value	0x1e3
+	.byte	0x7
+	.long	.LASF209
+	.long	0xcd5
+	.byte	0x1
+	.long	0x1698
+	.long	0x16a8
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xcc8
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF208
+	.byte	0x1a
+	.value	0x1e8
+	.byte	0x7
+	.long	.LASF210
+	.long	0xcd5
+	.byte	0x1
+	.long	0x16c2
+	.long	0x16d2
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF208
+	.byte	0x1a
+	.value	0x1eb
+	.byte	0x7
+	.long	.LASF211
+	.long	0xcd5
+	.byte	0x1
+	.long	0x16ec
+	.long	0x1701
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF208
+	.byte	0x1a
+	.value	0x1ef
+	.byte	0x7
+	.long	.LASF212
+	.long	0xcd5
+	.byte	0x1
+	.long	0x171b
+	.long	0x172b
+	.uleb128 0x2
+	.long	0xca99
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF213
+	.byte	0x1a
+	.value	0x1f9
+	.byte	0x7
+	.long	.LASF214
+	.long	0xacf1
+	.long	0x174b
+	.uleb128 0x1
+	.long	0xcd5
+	.uleb128 0x1
+	.long	0xcd5
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF215
+	.byte	0x1a
+	.value	0x204
+	.byte	0x12
+	.long	0x121
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF216
+	.byte	0x1a
+	.value	0x205
+	.byte	0x15
+	.long	0xb5c3
+	.byte	0x8
+	.uleb128 0xf
+	.long	.LASF91
+	.long	0xb5cd
+	.uleb128 0x72
+	.long	.LASF468
+	.long	0x843
+	.byte	0
+	.uleb128 0xa
+	.long	0xcc8
+	.uleb128 0x3e
+	.long	.LASF218
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x62
+	.byte	0xb
+	.long	0xbf47
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x63
+	.byte	0xb
+	.long	0xcb28
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x65
+	.byte	0xb
+	.long	0xcb3e
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x66
+	.byte	0xb
+	.long	0xcb50
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x67
+	.byte	0xb
+	.long	0xcb66
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x68
+	.byte	0xb
+	.long	0xcb7d
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x69
+	.byte	0xb
+	.long	0xcb94
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x6a
+	.byte	0xb
+	.long	0xcbaa
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x6b
+	.byte	0xb
+	.long	0xcbc1
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x6c
+	.byte	0xb
+	.long	0xcbe2
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x6d
+	.byte	0xb
+	.long	0xcc03
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x71
+	.byte	0xb
+	.long	0xcc1f
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x72
+	.byte	0xb
+	.long	0xcc45
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x74
+	.byte	0xb
+	.long	0xcc66
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x75
+	.byte	0xb
+	.long	0xcc87
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x76
+	.byte	0xb
+	.long	0xcca8
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x78
+	.byte	0xb
+	.long	0xccbf
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x79
+	.byte	0xb
+	.long	0xccd6
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x7e
+	.byte	0xb
+	.long	0xcce2
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x83
+	.byte	0xb
+	.long	0xccf4
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x84
+	.byte	0xb
+	.long	0xcd0a
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x85
+	.byte	0xb
+	.long	0xcd25
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x87
+	.byte	0xb
+	.long	0xcd37
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x88
+	.byte	0xb
+	.long	0xcd4e
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x8b
+	.byte	0xb
+	.long	0xcd74
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x8d
+	.byte	0xb
+	.long	0xcd80
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x8f
+	.byte	0xb
+	.long	0xcd96
+	.uleb128 0x3a
+	.long	.LASF219
+	.byte	0x1
+	.byte	0x1c
+	.value	0x19b
+	.byte	0xc
+	.long	0x1967
+	.uleb128 0x21
+	.long	.LASF220
+	.byte	0x1c
+	.value	0x1a4
+	.byte	0xd
+	.long	0xb6fa
+	.uleb128 0x14
+	.long	.LASF97
+	.byte	0x1c
+	.value	0x1cf
+	.byte	0x7
+	.long	.LASF221
+	.long	0x186a
+	.long	0x1897
+	.uleb128 0x1
+	.long	0xcdb2
+	.uleb128 0x1
+	.long	0x18a9
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF222
+	.byte	0x1c
+	.value	0x19e
+	.byte	0xd
+	.long	0xbeb
+	.uleb128 0xa
+	.long	0x1897
+	.uleb128 0x21
+	.long	.LASF115
+	.byte	0x1c
+	.value	0x1b3
+	.byte	0xd
+	.long	0x121
+	.uleb128 0x14
+	.long	.LASF97
+	.byte	0x1c
+	.value	0x1dd
+	.byte	0x7
+	.long	.LASF223
+	.long	0x186a
+	.long	0x18db
+	.uleb128 0x1
+	.long	0xcdb2
+	.uleb128 0x1
+	.long	0x18a9
+	.uleb128 0x1
+	.long	0x18db
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF224
+	.byte	0x1c
+	.value	0x1ad
+	.byte	0xd
+	.long	0xad3c
+	.uleb128 0x46
+	.long	.LASF99
+	.byte	0x1c
+	.value	0x1ef
+	.byte	0x7
+	.long	.LASF226
+	.long	0x1909
+	.uleb128 0x1
+	.long	0xcdb2
+	.uleb128 0x1
+	.long	0x186a
+	.uleb128 0x1
+	.long	0x18a9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF142
+	.byte	0x1c
+	.value	0x223
+	.byte	0x7
+	.long	.LASF227
+	.long	0x18a9
+	.long	0x1924
+	.uleb128 0x1
+	.long	0xcdb7
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF228
+	.byte	0x1c
+	.value	0x232
+	.byte	0x7
+	.long	.LASF229
+	.long	0x1897
+	.long	0x193f
+	.uleb128 0x1
+	.long	0xcdb7
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF8
+	.byte	0x1c
+	.value	0x1a1
+	.byte	0xd
+	.long	0xb5cd
+	.uleb128 0x21
+	.long	.LASF154
+	.byte	0x1c
+	.value	0x1a7
+	.byte	0xd
+	.long	0xb5c3
+	.uleb128 0x21
+	.long	.LASF230
+	.byte	0x1c
+	.value	0x1c2
+	.byte	0x8
+	.long	0xbeb
+	.byte	0
+	.uleb128 0x94
+	.long	.LASF731
+	.byte	0x8
+	.value	0x14b
+	.byte	0x41
+	.long	0x35a8
+	.uleb128 0x29
+	.long	.LASF231
+	.byte	0x20
+	.byte	0x1d
+	.byte	0x55
+	.byte	0xb
+	.long	0x35a2
+	.uleb128 0x1d
+	.long	.LASF232
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xc0
+	.byte	0xe
+	.long	0x19ea
+	.uleb128 0x34
+	.long	0xbeb
+	.uleb128 0x1f
+	.long	.LASF232
+	.byte	0x1d
+	.byte	0xc7
+	.byte	0x2
+	.long	.LASF233
+	.long	0x19a8
+	.long	0x19b8
+	.uleb128 0x2
+	.long	0xcdc6
+	.uleb128 0x1
+	.long	0x19ea
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF232
+	.byte	0x1d
+	.byte	0xcb
+	.byte	0x2
+	.long	.LASF234
+	.long	0x19cc
+	.long	0x19dc
+	.uleb128 0x2
+	.long	0xcdc6
+	.uleb128 0x1
+	.long	0x19ea
+	.uleb128 0x1
+	.long	0xcdcb
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF235
+	.byte	0x1d
+	.byte	0xcf
+	.byte	0xa
+	.long	0x19ea
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF220
+	.byte	0x1d
+	.byte	0x82
+	.byte	0x30
+	.long	0xae91
+	.byte	0x1
+	.uleb128 0x82
+	.byte	0x10
+	.byte	0x1d
+	.byte	0xd8
+	.byte	0x7
+	.long	0x1a1a
+	.uleb128 0x4f
+	.long	.LASF236
+	.byte	0x1d
+	.byte	0xd9
+	.byte	0x13
+	.long	0xcdd0
+	.uleb128 0x4f
+	.long	.LASF237
+	.byte	0x1d
+	.byte	0xda
+	.byte	0x13
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF115
+	.byte	0x1d
+	.byte	0x7e
+	.byte	0x32
+	.long	0xaea9
+	.byte	0x1
+	.uleb128 0xd
+	.long	.LASF238
+	.byte	0x1d
+	.byte	0x98
+	.byte	0x32
+	.long	0xcc8
+	.uleb128 0x1c
+	.long	.LASF239
+	.byte	0x1d
+	.byte	0xa4
+	.byte	0x7
+	.long	.LASF240
+	.long	0x1a27
+	.long	0x1a4d
+	.uleb128 0x1
+	.long	0x1a27
+	.byte	0
+	.uleb128 0x7f
+	.long	.LASF241
+	.byte	0x1d
+	.byte	0xbb
+	.byte	0x7
+	.long	.LASF242
+	.long	0x1a61
+	.long	0x1a71
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a71
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF243
+	.byte	0x10
+	.byte	0x1d
+	.byte	0xab
+	.byte	0xe
+	.long	0x1aab
+	.uleb128 0x7f
+	.long	.LASF243
+	.byte	0x1d
+	.byte	0xae
+	.byte	0x2
+	.long	.LASF244
+	.long	0x1a92
+	.long	0x1a9d
+	.uleb128 0x2
+	.long	0xce08
+	.uleb128 0x1
+	.long	0x1a27
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF245
+	.byte	0x1d
+	.byte	0xb0
+	.byte	0xc
+	.long	0x1a27
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF246
+	.byte	0x1d
+	.byte	0xd2
+	.byte	0x14
+	.long	0x1982
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF247
+	.byte	0x1d
+	.byte	0xd3
+	.byte	0x12
+	.long	0x1a1a
+	.byte	0x8
+	.uleb128 0x95
+	.long	0x19f7
+	.uleb128 0x1f
+	.long	.LASF248
+	.byte	0x1d
+	.byte	0xdf
+	.byte	0x7
+	.long	.LASF249
+	.long	0x1adf
+	.long	0x1aea
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x19ea
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF250
+	.byte	0x1d
+	.byte	0xe4
+	.byte	0x7
+	.long	.LASF251
+	.long	0x1afe
+	.long	0x1b09
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF248
+	.byte	0x1d
+	.byte	0xe9
+	.byte	0x7
+	.long	.LASF252
+	.long	0x19ea
+	.long	0x1b21
+	.long	0x1b27
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF253
+	.byte	0x1d
+	.byte	0xee
+	.byte	0x7
+	.long	.LASF254
+	.long	0x19ea
+	.long	0x1b3f
+	.long	0x1b45
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF154
+	.byte	0x1d
+	.byte	0x83
+	.byte	0x35
+	.long	0xae9d
+	.byte	0x1
+	.uleb128 0x25
+	.long	.LASF253
+	.byte	0x1d
+	.byte	0xf9
+	.byte	0x7
+	.long	.LASF255
+	.long	0x1b45
+	.long	0x1b6a
+	.long	0x1b70
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF256
+	.byte	0x1d
+	.value	0x104
+	.byte	0x7
+	.long	.LASF257
+	.long	0x1b85
+	.long	0x1b90
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF258
+	.byte	0x1d
+	.value	0x109
+	.byte	0x7
+	.long	.LASF259
+	.long	0x1ba5
+	.long	0x1bb0
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF260
+	.byte	0x1d
+	.value	0x111
+	.byte	0x7
+	.long	.LASF261
+	.long	0xacaa
+	.long	0x1bc9
+	.long	0x1bcf
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF262
+	.byte	0x1d
+	.value	0x117
+	.byte	0x7
+	.long	.LASF263
+	.long	0x19ea
+	.long	0x1be8
+	.long	0x1bf8
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdea
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF264
+	.byte	0x1d
+	.value	0x11b
+	.byte	0x7
+	.long	.LASF265
+	.long	0x1c0d
+	.long	0x1c13
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF266
+	.byte	0x1d
+	.value	0x123
+	.byte	0x7
+	.long	.LASF267
+	.long	0x1c28
+	.long	0x1c33
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF268
+	.byte	0x1d
+	.value	0x14f
+	.byte	0x7
+	.long	.LASF269
+	.long	0x1c48
+	.long	0x1c58
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF222
+	.byte	0x1d
+	.byte	0x7d
+	.byte	0x23
+	.long	0x1c6a
+	.byte	0x1
+	.uleb128 0xa
+	.long	0x1c58
+	.uleb128 0xd
+	.long	.LASF270
+	.byte	0x1d
+	.byte	0x58
+	.byte	0x18
+	.long	0xaeda
+	.uleb128 0x5
+	.long	.LASF271
+	.byte	0x1d
+	.value	0x153
+	.byte	0x7
+	.long	.LASF272
+	.long	0xcdef
+	.long	0x1c8f
+	.long	0x1c95
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF271
+	.byte	0x1d
+	.value	0x158
+	.byte	0x7
+	.long	.LASF273
+	.long	0xcdf4
+	.long	0x1cae
+	.long	0x1cb4
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF274
+	.byte	0x1d
+	.value	0x15f
+	.byte	0x7
+	.long	.LASF275
+	.long	0x19ea
+	.long	0x1ccd
+	.long	0x1cd3
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF276
+	.byte	0x1d
+	.value	0x17b
+	.byte	0x7
+	.long	.LASF277
+	.long	0x1a1a
+	.long	0x1cec
+	.long	0x1cfc
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF278
+	.byte	0x1d
+	.value	0x186
+	.byte	0x7
+	.long	.LASF279
+	.long	0x1d11
+	.long	0x1d26
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF280
+	.byte	0x1d
+	.value	0x190
+	.byte	0x7
+	.long	.LASF281
+	.long	0x1a1a
+	.long	0x1d3f
+	.long	0x1d4f
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF282
+	.byte	0x1d
+	.value	0x198
+	.byte	0x7
+	.long	.LASF283
+	.long	0xacaa
+	.long	0x1d68
+	.long	0x1d73
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF284
+	.byte	0x1d
+	.value	0x1a2
+	.byte	0x7
+	.long	.LASF285
+	.long	0x1d94
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF286
+	.byte	0x1d
+	.value	0x1ac
+	.byte	0x7
+	.long	.LASF287
+	.long	0x1db5
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF288
+	.byte	0x1d
+	.value	0x1b6
+	.byte	0x7
+	.long	.LASF289
+	.long	0x1dd6
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF290
+	.byte	0x1d
+	.value	0x1cb
+	.byte	0x7
+	.long	.LASF291
+	.long	0x1df7
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0x1df7
+	.uleb128 0x1
+	.long	0x1df7
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF292
+	.byte	0x1d
+	.byte	0x84
+	.byte	0x44
+	.long	0xaefa
+	.byte	0x1
+	.uleb128 0x46
+	.long	.LASF290
+	.byte	0x1d
+	.value	0x1d0
+	.byte	0x7
+	.long	.LASF293
+	.long	0x1e25
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0x1e25
+	.uleb128 0x1
+	.long	0x1e25
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF123
+	.byte	0x1d
+	.byte	0x86
+	.byte	0x8
+	.long	0xb137
+	.byte	0x1
+	.uleb128 0x46
+	.long	.LASF290
+	.byte	0x1d
+	.value	0x1d6
+	.byte	0x7
+	.long	.LASF294
+	.long	0x1e53
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xb6fa
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF290
+	.byte	0x1d
+	.value	0x1db
+	.byte	0x7
+	.long	.LASF295
+	.long	0x1e74
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF213
+	.byte	0x1d
+	.value	0x1e1
+	.byte	0x7
+	.long	.LASF296
+	.long	0xacf1
+	.long	0x1e94
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF297
+	.byte	0x1d
+	.value	0x1ef
+	.byte	0x7
+	.long	.LASF298
+	.long	0x1ea9
+	.long	0x1eb4
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF299
+	.byte	0x1d
+	.value	0x1f3
+	.byte	0x7
+	.long	.LASF300
+	.long	0x1ec9
+	.long	0x1ee3
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF301
+	.byte	0x1d
+	.value	0x1f8
+	.byte	0x7
+	.long	.LASF302
+	.long	0x1ef8
+	.long	0x1f08
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x203
+	.byte	0x7
+	.long	.LASF303
+	.byte	0x1
+	.long	0x1f1e
+	.long	0x1f24
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x210
+	.byte	0x7
+	.long	.LASF304
+	.long	0x1f39
+	.long	0x1f44
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x21c
+	.byte	0x7
+	.long	.LASF305
+	.byte	0x1
+	.long	0x1f5a
+	.long	0x1f65
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x22d
+	.byte	0x7
+	.long	.LASF306
+	.byte	0x1
+	.long	0x1f7b
+	.long	0x1f90
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x23e
+	.byte	0x7
+	.long	.LASF307
+	.byte	0x1
+	.long	0x1fa6
+	.long	0x1fbb
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x250
+	.byte	0x7
+	.long	.LASF308
+	.byte	0x1
+	.long	0x1fd1
+	.long	0x1feb
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x264
+	.byte	0x7
+	.long	.LASF309
+	.byte	0x1
+	.long	0x2001
+	.long	0x2016
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x29e
+	.byte	0x7
+	.long	.LASF310
+	.byte	0x1
+	.long	0x202c
+	.long	0x2037
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdfe
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x2ba
+	.byte	0x7
+	.long	.LASF311
+	.byte	0x1
+	.long	0x204d
+	.long	0x205d
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x35a8
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x2bf
+	.byte	0x7
+	.long	.LASF312
+	.byte	0x1
+	.long	0x2073
+	.long	0x2083
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x2c4
+	.byte	0x7
+	.long	.LASF313
+	.byte	0x1
+	.long	0x2099
+	.long	0x20a9
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdfe
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x73
+	.long	.LASF241
+	.byte	0x1d
+	.value	0x2de
+	.long	.LASF314
+	.long	0x20bd
+	.long	0x20c8
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x575
+	.byte	0
+	.uleb128 0x62
+	.long	.LASF53
+	.byte	0x1d
+	.value	0x2df
+	.byte	0x15
+	.long	.LASF871
+	.long	0xce03
+	.long	0x20e1
+	.long	0x20ec
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x575
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF315
+	.byte	0x1d
+	.value	0x31a
+	.byte	0x7
+	.long	.LASF316
+	.byte	0x1
+	.long	0x2102
+	.long	0x210d
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x1d
+	.value	0x323
+	.byte	0x7
+	.long	.LASF317
+	.long	0xce03
+	.byte	0x1
+	.long	0x2127
+	.long	0x2132
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x1d
+	.value	0x32e
+	.byte	0x7
+	.long	.LASF318
+	.long	0xce03
+	.byte	0x1
+	.long	0x214c
+	.long	0x2157
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x1d
+	.value	0x33a
+	.byte	0x7
+	.long	.LASF319
+	.long	0xce03
+	.byte	0x1
+	.long	0x2171
+	.long	0x217c
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x1d
+	.value	0x34c
+	.byte	0x7
+	.long	.LASF320
+	.long	0xce03
+	.byte	0x1
+	.long	0x2196
+	.long	0x21a1
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdfe
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x1d
+	.value	0x391
+	.byte	0x7
+	.long	.LASF321
+	.long	0xce03
+	.byte	0x1
+	.long	0x21bb
+	.long	0x21c6
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x35a8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF322
+	.byte	0x1d
+	.value	0x3a8
+	.byte	0x7
+	.long	.LASF323
+	.long	0x1a27
+	.byte	0x1
+	.long	0x21e0
+	.long	0x21e6
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF124
+	.byte	0x1d
+	.value	0x3b3
+	.byte	0x7
+	.long	.LASF324
+	.long	0x1df7
+	.byte	0x1
+	.long	0x2200
+	.long	0x2206
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF124
+	.byte	0x1d
+	.value	0x3bc
+	.byte	0x7
+	.long	.LASF325
+	.long	0x1e25
+	.byte	0x1
+	.long	0x2220
+	.long	0x2226
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x4b
+	.string	"end"
+	.byte	0x1d
+	.value	0x3c5
+	.long	.LASF326
+	.long	0x1df7
+	.long	0x223e
+	.long	0x2244
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x4b
+	.string	"end"
+	.byte	0x1d
+	.value	0x3ce
+	.long	.LASF327
+	.long	0x1e25
+	.long	0x225c
+	.long	0x2262
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF328
+	.byte	0x1d
+	.byte	0x88
+	.byte	0x30
+	.long	0x369e
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF131
+	.byte	0x1d
+	.value	0x3d8
+	.byte	0x7
+	.long	.LASF329
+	.long	0x2262
+	.byte	0x1
+	.long	0x2289
+	.long	0x228f
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF130
+	.byte	0x1d
+	.byte	0x87
+	.byte	0x35
+	.long	0x36a3
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF131
+	.byte	0x1d
+	.value	0x3e2
+	.byte	0x7
+	.long	.LASF330
+	.long	0x228f
+	.byte	0x1
+	.long	0x22b6
+	.long	0x22bc
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF133
+	.byte	0x1d
+	.value	0x3ec
+	.byte	0x7
+	.long	.LASF331
+	.long	0x2262
+	.byte	0x1
+	.long	0x22d6
+	.long	0x22dc
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF133
+	.byte	0x1d
+	.value	0x3f6
+	.byte	0x7
+	.long	.LASF332
+	.long	0x228f
+	.byte	0x1
+	.long	0x22f6
+	.long	0x22fc
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF126
+	.byte	0x1d
+	.value	0x400
+	.byte	0x7
+	.long	.LASF333
+	.long	0x1e25
+	.byte	0x1
+	.long	0x2316
+	.long	0x231c
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF128
+	.byte	0x1d
+	.value	0x409
+	.byte	0x7
+	.long	.LASF334
+	.long	0x1e25
+	.byte	0x1
+	.long	0x2336
+	.long	0x233c
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF135
+	.byte	0x1d
+	.value	0x413
+	.byte	0x7
+	.long	.LASF335
+	.long	0x228f
+	.byte	0x1
+	.long	0x2356
+	.long	0x235c
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF137
+	.byte	0x1d
+	.value	0x41d
+	.byte	0x7
+	.long	.LASF336
+	.long	0x228f
+	.byte	0x1
+	.long	0x2376
+	.long	0x237c
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF139
+	.byte	0x1d
+	.value	0x427
+	.byte	0x7
+	.long	.LASF337
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x2396
+	.long	0x239c
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF72
+	.byte	0x1d
+	.value	0x42e
+	.byte	0x7
+	.long	.LASF338
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x23b6
+	.long	0x23bc
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF142
+	.byte	0x1d
+	.value	0x434
+	.byte	0x7
+	.long	.LASF339
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x23d6
+	.long	0x23dc
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF340
+	.byte	0x1d
+	.value	0x443
+	.byte	0x7
+	.long	.LASF341
+	.byte	0x1
+	.long	0x23f2
+	.long	0x2402
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF340
+	.byte	0x1d
+	.value	0x451
+	.byte	0x7
+	.long	.LASF342
+	.byte	0x1
+	.long	0x2418
+	.long	0x2423
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF343
+	.byte	0x1d
+	.value	0x45a
+	.byte	0x7
+	.long	.LASF344
+	.byte	0x1
+	.long	0x2439
+	.long	0x243f
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF345
+	.byte	0x1d
+	.value	0x46c
+	.byte	0x7
+	.long	.LASF346
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x2459
+	.long	0x245f
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF347
+	.byte	0x1d
+	.value	0x485
+	.byte	0x7
+	.long	.LASF348
+	.byte	0x1
+	.long	0x2475
+	.long	0x2480
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF347
+	.byte	0x1d
+	.value	0x48f
+	.byte	0x7
+	.long	.LASF349
+	.byte	0x1
+	.long	0x2496
+	.long	0x249c
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF350
+	.byte	0x1d
+	.value	0x496
+	.byte	0x7
+	.long	.LASF351
+	.byte	0x1
+	.long	0x24b2
+	.long	0x24b8
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF144
+	.byte	0x1d
+	.value	0x49f
+	.byte	0x7
+	.long	.LASF352
+	.long	0xacaa
+	.byte	0x1
+	.long	0x24d2
+	.long	0x24d8
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF146
+	.byte	0x1d
+	.byte	0x81
+	.byte	0x37
+	.long	0xaec1
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF147
+	.byte	0x1d
+	.value	0x4af
+	.byte	0x7
+	.long	.LASF353
+	.long	0x24d8
+	.byte	0x1
+	.long	0x24ff
+	.long	0x250a
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF354
+	.byte	0x1d
+	.byte	0x80
+	.byte	0x32
+	.long	0xaeb5
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF147
+	.byte	0x1d
+	.value	0x4c1
+	.byte	0x7
+	.long	.LASF355
+	.long	0x250a
+	.byte	0x1
+	.long	0x2531
+	.long	0x253c
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x4b
+	.string	"at"
+	.byte	0x1d
+	.value	0x4d7
+	.long	.LASF356
+	.long	0x24d8
+	.long	0x2553
+	.long	0x255e
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x4b
+	.string	"at"
+	.byte	0x1d
+	.value	0x4ed
+	.long	.LASF357
+	.long	0x250a
+	.long	0x2575
+	.long	0x2580
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF151
+	.byte	0x1d
+	.value	0x4fe
+	.byte	0x7
+	.long	.LASF358
+	.long	0x250a
+	.byte	0x1
+	.long	0x259a
+	.long	0x25a0
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF151
+	.byte	0x1d
+	.value	0x50a
+	.byte	0x7
+	.long	.LASF359
+	.long	0x24d8
+	.byte	0x1
+	.long	0x25ba
+	.long	0x25c0
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF153
+	.byte	0x1d
+	.value	0x516
+	.byte	0x7
+	.long	.LASF360
+	.long	0x250a
+	.byte	0x1
+	.long	0x25da
+	.long	0x25e0
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF153
+	.byte	0x1d
+	.value	0x522
+	.byte	0x7
+	.long	.LASF361
+	.long	0x24d8
+	.byte	0x1
+	.long	0x25fa
+	.long	0x2600
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF362
+	.byte	0x1d
+	.value	0x531
+	.byte	0x7
+	.long	.LASF363
+	.long	0xce03
+	.byte	0x1
+	.long	0x261a
+	.long	0x2625
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF362
+	.byte	0x1d
+	.value	0x53b
+	.byte	0x7
+	.long	.LASF364
+	.long	0xce03
+	.byte	0x1
+	.long	0x263f
+	.long	0x264a
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF362
+	.byte	0x1d
+	.value	0x545
+	.byte	0x7
+	.long	.LASF365
+	.long	0xce03
+	.byte	0x1
+	.long	0x2664
+	.long	0x266f
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF362
+	.byte	0x1d
+	.value	0x553
+	.byte	0x7
+	.long	.LASF366
+	.long	0xce03
+	.byte	0x1
+	.long	0x2689
+	.long	0x2694
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x35a8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF367
+	.byte	0x1d
+	.value	0x56b
+	.byte	0x7
+	.long	.LASF368
+	.long	0xce03
+	.byte	0x1
+	.long	0x26ae
+	.long	0x26b9
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF367
+	.byte	0x1d
+	.value	0x57d
+	.byte	0x7
+	.long	.LASF369
+	.long	0xce03
+	.byte	0x1
+	.long	0x26d3
+	.long	0x26e8
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF367
+	.byte	0x1d
+	.value	0x58a
+	.byte	0x7
+	.long	.LASF370
+	.long	0xce03
+	.byte	0x1
+	.long	0x2702
+	.long	0x2712
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF367
+	.byte	0x1d
+	.value	0x598
+	.byte	0x7
+	.long	.LASF371
+	.long	0xce03
+	.byte	0x1
+	.long	0x272c
+	.long	0x2737
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF367
+	.byte	0x1d
+	.value	0x5aa
+	.byte	0x7
+	.long	.LASF372
+	.long	0xce03
+	.byte	0x1
+	.long	0x2751
+	.long	0x2761
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF367
+	.byte	0x1d
+	.value	0x5b5
+	.byte	0x7
+	.long	.LASF373
+	.long	0xce03
+	.byte	0x1
+	.long	0x277b
+	.long	0x2786
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x35a8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF374
+	.byte	0x1d
+	.value	0x5f4
+	.byte	0x7
+	.long	.LASF375
+	.byte	0x1
+	.long	0x279c
+	.long	0x27a7
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF67
+	.byte	0x1d
+	.value	0x604
+	.byte	0x7
+	.long	.LASF376
+	.long	0xce03
+	.byte	0x1
+	.long	0x27c1
+	.long	0x27cc
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF67
+	.byte	0x1d
+	.value	0x632
+	.byte	0x7
+	.long	.LASF377
+	.long	0xce03
+	.byte	0x1
+	.long	0x27e6
+	.long	0x27f1
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdfe
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF67
+	.byte	0x1d
+	.value	0x64a
+	.byte	0x7
+	.long	.LASF378
+	.long	0xce03
+	.byte	0x1
+	.long	0x280b
+	.long	0x2820
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF67
+	.byte	0x1d
+	.value	0x65b
+	.byte	0x7
+	.long	.LASF379
+	.long	0xce03
+	.byte	0x1
+	.long	0x283a
+	.long	0x284a
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF67
+	.byte	0x1d
+	.value	0x66c
+	.byte	0x7
+	.long	.LASF380
+	.long	0xce03
+	.byte	0x1
+	.long	0x2864
+	.long	0x286f
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF67
+	.byte	0x1d
+	.value	0x67e
+	.byte	0x7
+	.long	.LASF381
+	.long	0xce03
+	.byte	0x1
+	.long	0x2889
+	.long	0x2899
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF67
+	.byte	0x1d
+	.value	0x69c
+	.byte	0x7
+	.long	.LASF382
+	.long	0xce03
+	.byte	0x1
+	.long	0x28b3
+	.long	0x28be
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x35a8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF383
+	.byte	0x1d
+	.value	0x6d5
+	.byte	0x7
+	.long	.LASF384
+	.long	0x1df7
+	.byte	0x1
+	.long	0x28d8
+	.long	0x28ed
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1e25
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF383
+	.byte	0x1d
+	.value	0x725
+	.byte	0x7
+	.long	.LASF385
+	.long	0x1df7
+	.byte	0x1
+	.long	0x2907
+	.long	0x2917
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1e25
+	.uleb128 0x1
+	.long	0x35a8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF383
+	.byte	0x1d
+	.value	0x741
+	.byte	0x7
+	.long	.LASF386
+	.long	0xce03
+	.byte	0x1
+	.long	0x2931
+	.long	0x2941
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xcdf9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF383
+	.byte	0x1d
+	.value	0x759
+	.byte	0x7
+	.long	.LASF387
+	.long	0xce03
+	.byte	0x1
+	.long	0x295b
+	.long	0x2975
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF383
+	.byte	0x1d
+	.value	0x771
+	.byte	0x7
+	.long	.LASF388
+	.long	0xce03
+	.byte	0x1
+	.long	0x298f
+	.long	0x29a4
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF383
+	.byte	0x1d
+	.value	0x785
+	.byte	0x7
+	.long	.LASF389
+	.long	0xce03
+	.byte	0x1
+	.long	0x29be
+	.long	0x29ce
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF383
+	.byte	0x1d
+	.value	0x79e
+	.byte	0x7
+	.long	.LASF390
+	.long	0xce03
+	.byte	0x1
+	.long	0x29e8
+	.long	0x29fd
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF383
+	.byte	0x1d
+	.value	0x7b1
+	.byte	0x7
+	.long	.LASF391
+	.long	0x1df7
+	.byte	0x1
+	.long	0x2a17
+	.long	0x2a27
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF392
+	.byte	0x1d
+	.byte	0x92
+	.byte	0x1e
+	.long	0x1e25
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF393
+	.byte	0x1d
+	.value	0x7f0
+	.byte	0x7
+	.long	.LASF394
+	.long	0xce03
+	.byte	0x1
+	.long	0x2a4e
+	.long	0x2a5e
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF393
+	.byte	0x1d
+	.value	0x804
+	.byte	0x7
+	.long	.LASF395
+	.long	0x1df7
+	.byte	0x1
+	.long	0x2a78
+	.long	0x2a83
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x2a27
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF393
+	.byte	0x1d
+	.value	0x818
+	.byte	0x7
+	.long	.LASF396
+	.long	0x1df7
+	.byte	0x1
+	.long	0x2a9d
+	.long	0x2aad
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x2a27
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF397
+	.byte	0x1d
+	.value	0x82c
+	.byte	0x7
+	.long	.LASF398
+	.byte	0x1
+	.long	0x2ac3
+	.long	0x2ac9
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x846
+	.byte	0x7
+	.long	.LASF400
+	.long	0xce03
+	.byte	0x1
+	.long	0x2ae3
+	.long	0x2af8
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xcdf9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x85d
+	.byte	0x7
+	.long	.LASF401
+	.long	0xce03
+	.byte	0x1
+	.long	0x2b12
+	.long	0x2b31
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x877
+	.byte	0x7
+	.long	.LASF402
+	.long	0xce03
+	.byte	0x1
+	.long	0x2b4b
+	.long	0x2b65
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x891
+	.byte	0x7
+	.long	.LASF403
+	.long	0xce03
+	.byte	0x1
+	.long	0x2b7f
+	.long	0x2b94
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x8aa
+	.byte	0x7
+	.long	.LASF404
+	.long	0xce03
+	.byte	0x1
+	.long	0x2bae
+	.long	0x2bc8
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x8bd
+	.byte	0x7
+	.long	.LASF405
+	.long	0xce03
+	.byte	0x1
+	.long	0x2be2
+	.long	0x2bf7
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0xcdf9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x8d2
+	.byte	0x7
+	.long	.LASF406
+	.long	0xce03
+	.byte	0x1
+	.long	0x2c11
+	.long	0x2c2b
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x8e9
+	.byte	0x7
+	.long	.LASF407
+	.long	0xce03
+	.byte	0x1
+	.long	0x2c45
+	.long	0x2c5a
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x8ff
+	.byte	0x7
+	.long	.LASF408
+	.long	0xce03
+	.byte	0x1
+	.long	0x2c74
+	.long	0x2c8e
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x93a
+	.byte	0x7
+	.long	.LASF409
+	.long	0xce03
+	.byte	0x1
+	.long	0x2ca8
+	.long	0x2cc2
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xb6fa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x946
+	.byte	0x7
+	.long	.LASF410
+	.long	0xce03
+	.byte	0x1
+	.long	0x2cdc
+	.long	0x2cf6
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x952
+	.byte	0x7
+	.long	.LASF411
+	.long	0xce03
+	.byte	0x1
+	.long	0x2d10
+	.long	0x2d2a
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x1df7
+	.uleb128 0x1
+	.long	0x1df7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x95e
+	.byte	0x7
+	.long	.LASF412
+	.long	0xce03
+	.byte	0x1
+	.long	0x2d44
+	.long	0x2d5e
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x2a27
+	.uleb128 0x1
+	.long	0x1e25
+	.uleb128 0x1
+	.long	0x1e25
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF399
+	.byte	0x1d
+	.value	0x978
+	.byte	0x15
+	.long	.LASF413
+	.long	0xce03
+	.byte	0x1
+	.long	0x2d78
+	.long	0x2d8d
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1e25
+	.uleb128 0x1
+	.long	0x1e25
+	.uleb128 0x1
+	.long	0x35a8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF414
+	.byte	0x1d
+	.value	0x9c8
+	.byte	0x7
+	.long	.LASF415
+	.long	0xce03
+	.long	0x2da6
+	.long	0x2dc0
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF416
+	.byte	0x1d
+	.value	0x9cd
+	.byte	0x7
+	.long	.LASF417
+	.long	0xce03
+	.long	0x2dd9
+	.long	0x2df3
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF418
+	.byte	0x1d
+	.value	0x9d2
+	.byte	0x7
+	.long	.LASF419
+	.long	0xce03
+	.long	0x2e0c
+	.long	0x2e1c
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF79
+	.byte	0x1d
+	.value	0x9e4
+	.byte	0x7
+	.long	.LASF420
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x2e36
+	.long	0x2e4b
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF58
+	.byte	0x1d
+	.value	0x9ef
+	.byte	0x7
+	.long	.LASF421
+	.byte	0x1
+	.long	0x2e61
+	.long	0x2e6c
+	.uleb128 0x2
+	.long	0xcde0
+	.uleb128 0x1
+	.long	0xce03
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF422
+	.byte	0x1d
+	.value	0x9fa
+	.byte	0x7
+	.long	.LASF423
+	.long	0xb5c3
+	.byte	0x1
+	.long	0x2e86
+	.long	0x2e8c
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF155
+	.byte	0x1d
+	.value	0xa07
+	.byte	0x7
+	.long	.LASF424
+	.long	0xb5c3
+	.byte	0x1
+	.long	0x2ea6
+	.long	0x2eac
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF155
+	.byte	0x1d
+	.value	0xa13
+	.byte	0x7
+	.long	.LASF425
+	.long	0xb6fa
+	.byte	0x1
+	.long	0x2ec6
+	.long	0x2ecc
+	.uleb128 0x2
+	.long	0xcde0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF426
+	.byte	0x1d
+	.value	0xa1c
+	.byte	0x7
+	.long	.LASF427
+	.long	0x1c58
+	.byte	0x1
+	.long	0x2ee6
+	.long	0x2eec
+	.uleb128 0x2
+	.long	0xcde5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0x1d
+	.value	0xa2d
+	.byte	0x7
+	.long	.LASF428
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x2f06
+	.long	0x2f1b
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0x1d
+	.value	0xa3c
+	.byte	0x7
+	.long	.LASF429
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x2f35
+	.long	0x2f45
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0x1d
+	.value	0xa5e
+	.byte	0x7
+	.long	.LASF430
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x2f5f
+	.long	0x2f6f
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0x1d
+	.value	0xa70
+	.byte	0x7
+	.long	.LASF431
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x2f89
+	.long	0x2f99
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF188
+	.byte	0x1d
+	.value	0xa7e
+	.byte	0x7
+	.long	.LASF432
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x2fb3
+	.long	0x2fc3
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF188
+	.byte	0x1d
+	.value	0xaa2
+	.byte	0x7
+	.long	.LASF433
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x2fdd
+	.long	0x2ff2
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF188
+	.byte	0x1d
+	.value	0xab1
+	.byte	0x7
+	.long	.LASF434
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x300c
+	.long	0x301c
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF188
+	.byte	0x1d
+	.value	0xac3
+	.byte	0x7
+	.long	.LASF435
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x3036
+	.long	0x3046
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF193
+	.byte	0x1d
+	.value	0xad2
+	.byte	0x7
+	.long	.LASF436
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x3060
+	.long	0x3070
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF193
+	.byte	0x1d
+	.value	0xaf7
+	.byte	0x7
+	.long	.LASF437
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x308a
+	.long	0x309f
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF193
+	.byte	0x1d
+	.value	0xb06
+	.byte	0x7
+	.long	.LASF438
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x30b9
+	.long	0x30c9
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF193
+	.byte	0x1d
+	.value	0xb1b
+	.byte	0x7
+	.long	.LASF439
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x30e3
+	.long	0x30f3
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF198
+	.byte	0x1d
+	.value	0xb2b
+	.byte	0x7
+	.long	.LASF440
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x310d
+	.long	0x311d
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF198
+	.byte	0x1d
+	.value	0xb50
+	.byte	0x7
+	.long	.LASF441
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x3137
+	.long	0x314c
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF198
+	.byte	0x1d
+	.value	0xb5f
+	.byte	0x7
+	.long	.LASF442
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x3166
+	.long	0x3176
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF198
+	.byte	0x1d
+	.value	0xb74
+	.byte	0x7
+	.long	.LASF443
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x3190
+	.long	0x31a0
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF203
+	.byte	0x1d
+	.value	0xb83
+	.byte	0x7
+	.long	.LASF444
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x31ba
+	.long	0x31ca
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF203
+	.byte	0x1d
+	.value	0xba8
+	.byte	0x7
+	.long	.LASF445
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x31e4
+	.long	0x31f9
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF203
+	.byte	0x1d
+	.value	0xbb7
+	.byte	0x7
+	.long	.LASF446
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x3213
+	.long	0x3223
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF203
+	.byte	0x1d
+	.value	0xbca
+	.byte	0x7
+	.long	.LASF447
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x323d
+	.long	0x324d
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF208
+	.byte	0x1d
+	.value	0xbda
+	.byte	0x7
+	.long	.LASF448
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x3267
+	.long	0x3277
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF208
+	.byte	0x1d
+	.value	0xbff
+	.byte	0x7
+	.long	.LASF449
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x3291
+	.long	0x32a6
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF208
+	.byte	0x1d
+	.value	0xc0e
+	.byte	0x7
+	.long	.LASF450
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x32c0
+	.long	0x32d0
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF208
+	.byte	0x1d
+	.value	0xc21
+	.byte	0x7
+	.long	.LASF451
+	.long	0x1a1a
+	.byte	0x1
+	.long	0x32ea
+	.long	0x32fa
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5cd
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF164
+	.byte	0x1d
+	.value	0xc32
+	.byte	0x7
+	.long	.LASF452
+	.long	0x1975
+	.byte	0x1
+	.long	0x3314
+	.long	0x3324
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1d
+	.value	0xc46
+	.byte	0x7
+	.long	.LASF453
+	.long	0xacf1
+	.byte	0x1
+	.long	0x333e
+	.long	0x3349
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xcdf9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1d
+	.value	0xca7
+	.byte	0x7
+	.long	.LASF454
+	.long	0xacf1
+	.byte	0x1
+	.long	0x3363
+	.long	0x3378
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xcdf9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1d
+	.value	0xcc2
+	.byte	0x7
+	.long	.LASF455
+	.long	0xacf1
+	.byte	0x1
+	.long	0x3392
+	.long	0x33b1
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xcdf9
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1d
+	.value	0xcd5
+	.byte	0x7
+	.long	.LASF456
+	.long	0xacf1
+	.byte	0x1
+	.long	0x33cb
+	.long	0x33d6
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1d
+	.value	0xcee
+	.byte	0x7
+	.long	.LASF457
+	.long	0xacf1
+	.byte	0x1
+	.long	0x33f0
+	.long	0x3405
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF71
+	.byte	0x1d
+	.value	0xd0a
+	.byte	0x7
+	.long	.LASF458
+	.long	0xacf1
+	.byte	0x1
+	.long	0x341f
+	.long	0x3439
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0x1a1a
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0x1a1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF172
+	.byte	0x1d
+	.value	0xd0f
+	.byte	0x7
+	.long	.LASF459
+	.long	0xacaa
+	.byte	0x1
+	.long	0x3453
+	.long	0x345e
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xcc8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF172
+	.byte	0x1d
+	.value	0xd13
+	.byte	0x7
+	.long	.LASF460
+	.long	0xacaa
+	.byte	0x1
+	.long	0x3478
+	.long	0x3483
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF172
+	.byte	0x1d
+	.value	0xd17
+	.byte	0x7
+	.long	.LASF461
+	.long	0xacaa
+	.byte	0x1
+	.long	0x349d
+	.long	0x34a8
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF176
+	.byte	0x1d
+	.value	0xd1b
+	.byte	0x7
+	.long	.LASF462
+	.long	0xacaa
+	.byte	0x1
+	.long	0x34c2
+	.long	0x34cd
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xcc8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF176
+	.byte	0x1d
+	.value	0xd1f
+	.byte	0x7
+	.long	.LASF463
+	.long	0xacaa
+	.byte	0x1
+	.long	0x34e7
+	.long	0x34f2
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF176
+	.byte	0x1d
+	.value	0xd23
+	.byte	0x7
+	.long	.LASF464
+	.long	0xacaa
+	.byte	0x1
+	.long	0x350c
+	.long	0x3517
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF180
+	.byte	0x1d
+	.value	0xd29
+	.byte	0x7
+	.long	.LASF465
+	.long	0xacaa
+	.byte	0x1
+	.long	0x3531
+	.long	0x353c
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xcc8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF180
+	.byte	0x1d
+	.value	0xd2d
+	.byte	0x7
+	.long	.LASF466
+	.long	0xacaa
+	.byte	0x1
+	.long	0x3556
+	.long	0x3561
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF180
+	.byte	0x1d
+	.value	0xd31
+	.byte	0x7
+	.long	.LASF467
+	.long	0xacaa
+	.byte	0x1
+	.long	0x357b
+	.long	0x3586
+	.uleb128 0x2
+	.long	0xcde5
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF91
+	.long	0xb5cd
+	.uleb128 0x72
+	.long	.LASF468
+	.long	0x843
+	.uleb128 0x72
+	.long	.LASF469
+	.long	0xbeb
+	.byte	0
+	.uleb128 0xa
+	.long	0x1975
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF470
+	.byte	0x10
+	.byte	0x1e
+	.byte	0x2f
+	.byte	0xb
+	.long	0x3699
+	.uleb128 0x23
+	.long	.LASF292
+	.byte	0x1e
+	.byte	0x36
+	.byte	0x1a
+	.long	0xb5c3
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF471
+	.byte	0x1e
+	.byte	0x3a
+	.byte	0x12
+	.long	0x35b5
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF115
+	.byte	0x1e
+	.byte	0x35
+	.byte	0x18
+	.long	0x121
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF215
+	.byte	0x1e
+	.byte	0x3b
+	.byte	0x13
+	.long	0x35cf
+	.byte	0x8
+	.uleb128 0x1f
+	.long	.LASF472
+	.byte	0x1e
+	.byte	0x3e
+	.byte	0x11
+	.long	.LASF473
+	.long	0x35fd
+	.long	0x360d
+	.uleb128 0x2
+	.long	0xce0d
+	.uleb128 0x1
+	.long	0x360d
+	.uleb128 0x1
+	.long	0x35cf
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF123
+	.byte	0x1e
+	.byte	0x37
+	.byte	0x1a
+	.long	0xb5c3
+	.byte	0x1
+	.uleb128 0x1b
+	.long	.LASF472
+	.byte	0x1e
+	.byte	0x42
+	.byte	0x11
+	.long	.LASF474
+	.byte	0x1
+	.long	0x362f
+	.long	0x3635
+	.uleb128 0x2
+	.long	0xce0d
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF139
+	.byte	0x1e
+	.byte	0x47
+	.byte	0x7
+	.long	.LASF475
+	.long	0x35cf
+	.byte	0x1
+	.long	0x364e
+	.long	0x3654
+	.uleb128 0x2
+	.long	0xce12
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF124
+	.byte	0x1e
+	.byte	0x4b
+	.byte	0x7
+	.long	.LASF476
+	.long	0x360d
+	.byte	0x1
+	.long	0x366d
+	.long	0x3673
+	.uleb128 0x2
+	.long	0xce12
+	.byte	0
+	.uleb128 0x71
+	.string	"end"
+	.byte	0x1e
+	.byte	0x4f
+	.long	.LASF477
+	.long	0x360d
+	.long	0x368a
+	.long	0x3690
+	.uleb128 0x2
+	.long	0xce12
+	.byte	0
+	.uleb128 0xe
+	.string	"_E"
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0xa
+	.long	0x35a8
+	.uleb128 0x3e
+	.long	.LASF478
+	.uleb128 0x3e
+	.long	.LASF479
+	.uleb128 0xd
+	.long	.LASF480
+	.byte	0x1f
+	.byte	0x4d
+	.byte	0x21
+	.long	0x1975
+	.uleb128 0xa
+	.long	0x36a8
+	.uleb128 0x96
+	.string	"_V2"
+	.byte	0x28
+	.value	0x25c
+	.byte	0x14
+	.uleb128 0x1d
+	.long	.LASF481
+	.byte	0x1
+	.byte	0x7
+	.byte	0x68
+	.byte	0xc
+	.long	0x3701
+	.uleb128 0xd
+	.long	.LASF482
+	.byte	0x7
+	.byte	0x6b
+	.byte	0x8
+	.long	0xeb59
+	.uleb128 0xd
+	.long	.LASF482
+	.byte	0x7
+	.byte	0x6b
+	.byte	0x8
+	.long	0xeb5e
+	.uleb128 0xd
+	.long	.LASF482
+	.byte	0x7
+	.byte	0x6b
+	.byte	0x8
+	.long	0xf48b
+	.uleb128 0xd
+	.long	.LASF482
+	.byte	0x7
+	.byte	0x6b
+	.byte	0x8
+	.long	0xf490
+	.byte	0
+	.uleb128 0x60
+	.long	.LASF483
+	.byte	0x20
+	.value	0x117
+	.byte	0xd
+	.uleb128 0x4
+	.byte	0x21
+	.byte	0x3a
+	.byte	0xb
+	.long	0xbcd7
+	.uleb128 0xbd
+	.long	.LASF2341
+	.byte	0x7
+	.byte	0x1
+	.long	0xacc7
+	.byte	0x21
+	.byte	0x45
+	.byte	0xe
+	.uleb128 0x67
+	.long	.LASF1850
+	.byte	0x5
+	.byte	0x4
+	.long	0xacf1
+	.byte	0x22
+	.byte	0x3d
+	.byte	0xe
+	.long	0x3758
+	.uleb128 0x11
+	.long	.LASF484
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF485
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF486
+	.byte	0x2
+	.uleb128 0x11
+	.long	.LASF487
+	.byte	0x3
+	.uleb128 0x11
+	.long	.LASF488
+	.byte	0x4
+	.uleb128 0x11
+	.long	.LASF489
+	.byte	0x5
+	.byte	0
+	.uleb128 0x63
+	.long	.LASF572
+	.byte	0x1
+	.byte	0x1
+	.byte	0x22
+	.value	0x144
+	.long	0x3ff4
+	.uleb128 0x83
+	.long	.LASF584
+	.long	.LASF585
+	.long	0xacf9
+	.byte	0x1
+	.uleb128 0x24
+	.long	.LASF490
+	.byte	0x22
+	.value	0x14a
+	.byte	0x15
+	.long	0xacc7
+	.byte	0x3
+	.uleb128 0x68
+	.long	.LASF587
+	.byte	0x22
+	.value	0x14f
+	.byte	0x28
+	.long	0x3775
+	.byte	0x1
+	.byte	0
+	.byte	0x3
+	.uleb128 0x26
+	.long	.LASF491
+	.byte	0x22
+	.value	0x152
+	.byte	0x7
+	.long	.LASF492
+	.long	0x37a8
+	.long	0x37ae
+	.uleb128 0x2
+	.long	0xce35
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF493
+	.byte	0x22
+	.value	0x153
+	.byte	0x7
+	.long	.LASF494
+	.long	0x37c3
+	.long	0x37ce
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF491
+	.byte	0x22
+	.value	0x154
+	.long	.LASF495
+	.long	0x37e2
+	.long	0x37ed
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0xce3a
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x22
+	.value	0x155
+	.byte	0x16
+	.long	.LASF496
+	.long	0xce3f
+	.long	0x3806
+	.long	0x3811
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0xce3a
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x22
+	.value	0x156
+	.byte	0x16
+	.long	.LASF497
+	.long	0xce3f
+	.long	0x382a
+	.long	0x3835
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0xce3a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF491
+	.byte	0x22
+	.value	0x159
+	.byte	0x11
+	.long	.LASF498
+	.long	0x384a
+	.long	0x3855
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF499
+	.byte	0x22
+	.value	0x15b
+	.byte	0x7
+	.long	.LASF500
+	.long	0x3775
+	.long	0x386e
+	.long	0x3874
+	.uleb128 0x2
+	.long	0xce49
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF499
+	.byte	0x22
+	.value	0x15e
+	.byte	0x7
+	.long	.LASF501
+	.long	0x3775
+	.long	0x388d
+	.long	0x3893
+	.uleb128 0x2
+	.long	0xce4e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x22
+	.value	0x162
+	.byte	0x7
+	.long	.LASF502
+	.long	0x3775
+	.long	0x38ac
+	.long	0x38b7
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x22
+	.value	0x169
+	.byte	0x7
+	.long	.LASF503
+	.long	0x3775
+	.long	0x38d0
+	.long	0x38db
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x170
+	.byte	0x7
+	.long	.LASF505
+	.long	0x3775
+	.long	0x38f4
+	.long	0x38ff
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x174
+	.byte	0x7
+	.long	.LASF506
+	.long	0x3775
+	.long	0x3918
+	.long	0x3923
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x178
+	.byte	0x7
+	.long	.LASF508
+	.long	0x3775
+	.long	0x393c
+	.long	0x3947
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x17c
+	.byte	0x7
+	.long	.LASF509
+	.long	0x3775
+	.long	0x3960
+	.long	0x396b
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x180
+	.byte	0x7
+	.long	.LASF510
+	.long	0x3775
+	.long	0x3984
+	.long	0x398a
+	.uleb128 0x2
+	.long	0xce35
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x184
+	.byte	0x7
+	.long	.LASF511
+	.long	0x3775
+	.long	0x39a3
+	.long	0x39a9
+	.uleb128 0x2
+	.long	0xce44
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x188
+	.byte	0x7
+	.long	.LASF512
+	.long	0x3775
+	.long	0x39c2
+	.long	0x39c8
+	.uleb128 0x2
+	.long	0xce35
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x18c
+	.byte	0x7
+	.long	.LASF513
+	.long	0x3775
+	.long	0x39e1
+	.long	0x39e7
+	.uleb128 0x2
+	.long	0xce44
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF362
+	.byte	0x22
+	.value	0x190
+	.byte	0x7
+	.long	.LASF514
+	.long	0x3775
+	.long	0x3a00
+	.long	0x3a0b
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF362
+	.byte	0x22
+	.value	0x194
+	.byte	0x7
+	.long	.LASF515
+	.long	0x3775
+	.long	0x3a24
+	.long	0x3a2f
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF516
+	.byte	0x22
+	.value	0x198
+	.byte	0x7
+	.long	.LASF517
+	.long	0x3775
+	.long	0x3a48
+	.long	0x3a53
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF516
+	.byte	0x22
+	.value	0x19c
+	.byte	0x7
+	.long	.LASF518
+	.long	0x3775
+	.long	0x3a6c
+	.long	0x3a77
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF519
+	.byte	0x22
+	.value	0x1a0
+	.byte	0x7
+	.long	.LASF520
+	.long	0x3775
+	.long	0x3a90
+	.long	0x3a9b
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF519
+	.byte	0x22
+	.value	0x1a4
+	.byte	0x7
+	.long	.LASF521
+	.long	0x3775
+	.long	0x3ab4
+	.long	0x3abf
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF522
+	.byte	0x22
+	.value	0x1a8
+	.byte	0x7
+	.long	.LASF523
+	.long	0x3775
+	.long	0x3ad8
+	.long	0x3ae3
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF522
+	.byte	0x22
+	.value	0x1ac
+	.byte	0x7
+	.long	.LASF524
+	.long	0x3775
+	.long	0x3afc
+	.long	0x3b07
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF525
+	.byte	0x22
+	.value	0x1b0
+	.byte	0x7
+	.long	.LASF526
+	.long	0x3775
+	.long	0x3b20
+	.long	0x3b2b
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF525
+	.byte	0x22
+	.value	0x1b4
+	.byte	0x7
+	.long	.LASF527
+	.long	0x3775
+	.long	0x3b44
+	.long	0x3b4f
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF528
+	.byte	0x22
+	.value	0x1b8
+	.byte	0x7
+	.long	.LASF529
+	.long	0xacaa
+	.long	0x3b68
+	.long	0x3b6e
+	.uleb128 0x2
+	.long	0xce49
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF528
+	.byte	0x22
+	.value	0x1c0
+	.byte	0x7
+	.long	.LASF530
+	.long	0xacaa
+	.long	0x3b87
+	.long	0x3b8d
+	.uleb128 0x2
+	.long	0xce4e
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x22
+	.value	0x1c8
+	.byte	0x7
+	.long	.LASF532
+	.long	0x3ba2
+	.long	0x3bb2
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x22
+	.value	0x1d4
+	.byte	0x7
+	.long	.LASF533
+	.long	0x3bc7
+	.long	0x3bd7
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x22
+	.value	0x1e1
+	.byte	0x7
+	.long	.LASF535
+	.long	0x3775
+	.long	0x3bf0
+	.long	0x3bfb
+	.uleb128 0x2
+	.long	0xce49
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x22
+	.value	0x1ec
+	.byte	0x7
+	.long	.LASF536
+	.long	0x3775
+	.long	0x3c14
+	.long	0x3c1f
+	.uleb128 0x2
+	.long	0xce4e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x22
+	.value	0x1f7
+	.byte	0x7
+	.long	.LASF538
+	.long	0x3775
+	.long	0x3c38
+	.long	0x3c48
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x22
+	.value	0x1ff
+	.byte	0x7
+	.long	.LASF539
+	.long	0x3775
+	.long	0x3c61
+	.long	0x3c71
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x206
+	.byte	0x7
+	.long	.LASF541
+	.long	0xacaa
+	.long	0x3c8a
+	.long	0x3ca4
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0xce53
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x210
+	.byte	0x7
+	.long	.LASF542
+	.long	0xacaa
+	.long	0x3cbd
+	.long	0x3cd7
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0xce53
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x21b
+	.byte	0x7
+	.long	.LASF543
+	.long	0xacaa
+	.long	0x3cf0
+	.long	0x3d05
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0xce53
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x223
+	.byte	0x7
+	.long	.LASF544
+	.long	0xacaa
+	.long	0x3d1e
+	.long	0x3d33
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0xce53
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x22b
+	.byte	0x7
+	.long	.LASF546
+	.long	0xacaa
+	.long	0x3d4c
+	.long	0x3d66
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0xce53
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x235
+	.byte	0x7
+	.long	.LASF547
+	.long	0xacaa
+	.long	0x3d7f
+	.long	0x3d99
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0xce53
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x240
+	.byte	0x7
+	.long	.LASF548
+	.long	0xacaa
+	.long	0x3db2
+	.long	0x3dc7
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0xce53
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x248
+	.byte	0x7
+	.long	.LASF549
+	.long	0xacaa
+	.long	0x3de0
+	.long	0x3df5
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0xce53
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF550
+	.byte	0x22
+	.value	0x251
+	.byte	0x7
+	.long	.LASF551
+	.long	0x3e0a
+	.long	0x3e1a
+	.uleb128 0x2
+	.long	0xce49
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF552
+	.byte	0x22
+	.value	0x25b
+	.byte	0x7
+	.long	.LASF553
+	.long	0x3e2f
+	.long	0x3e35
+	.uleb128 0x2
+	.long	0xce35
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF554
+	.byte	0x22
+	.value	0x261
+	.byte	0x7
+	.long	.LASF555
+	.long	0x3e4a
+	.long	0x3e50
+	.uleb128 0x2
+	.long	0xce35
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF556
+	.byte	0x22
+	.value	0x268
+	.byte	0x7
+	.long	.LASF557
+	.long	0x3775
+	.long	0x3e69
+	.long	0x3e79
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF556
+	.byte	0x22
+	.value	0x26d
+	.byte	0x7
+	.long	.LASF558
+	.long	0x3775
+	.long	0x3e92
+	.long	0x3ea2
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF559
+	.byte	0x22
+	.value	0x272
+	.byte	0x7
+	.long	.LASF560
+	.long	0x3775
+	.long	0x3ebb
+	.long	0x3ecb
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF559
+	.byte	0x22
+	.value	0x277
+	.byte	0x7
+	.long	.LASF561
+	.long	0x3775
+	.long	0x3ee4
+	.long	0x3ef4
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF562
+	.byte	0x22
+	.value	0x27c
+	.byte	0x7
+	.long	.LASF563
+	.long	0x3775
+	.long	0x3f0d
+	.long	0x3f1d
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF562
+	.byte	0x22
+	.value	0x281
+	.byte	0x7
+	.long	.LASF564
+	.long	0x3775
+	.long	0x3f36
+	.long	0x3f46
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF565
+	.byte	0x22
+	.value	0x286
+	.byte	0x7
+	.long	.LASF566
+	.long	0x3775
+	.long	0x3f5f
+	.long	0x3f6f
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF565
+	.byte	0x22
+	.value	0x28b
+	.byte	0x7
+	.long	.LASF567
+	.long	0x3775
+	.long	0x3f88
+	.long	0x3f98
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF568
+	.byte	0x22
+	.value	0x290
+	.byte	0x7
+	.long	.LASF569
+	.long	0x3775
+	.long	0x3fb1
+	.long	0x3fc1
+	.uleb128 0x2
+	.long	0xce35
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF568
+	.byte	0x22
+	.value	0x295
+	.byte	0x7
+	.long	.LASF570
+	.long	0x3775
+	.long	0x3fda
+	.long	0x3fea
+	.uleb128 0x2
+	.long	0xce44
+	.uleb128 0x1
+	.long	0x3775
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF571
+	.long	0xacc7
+	.byte	0
+	.uleb128 0xa
+	.long	0x3758
+	.uleb128 0x3c
+	.long	0x3758
+	.uleb128 0xa
+	.long	0x3ff9
+	.uleb128 0x63
+	.long	.LASF573
+	.byte	0x1
+	.byte	0x1
+	.byte	0x23
+	.value	0x2f3
+	.long	0x4135
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x2f3
+	.byte	0xc
+	.long	0x3855
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x2f3
+	.byte	0xc
+	.long	0x3874
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x2f3
+	.byte	0xc
+	.long	0x38b7
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x2f3
+	.byte	0xc
+	.long	0x3893
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x2f3
+	.byte	0xc
+	.long	0x3811
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x2f3
+	.byte	0xc
+	.long	0x37ed
+	.uleb128 0x34
+	.long	0x3758
+	.uleb128 0x26
+	.long	.LASF574
+	.byte	0x23
+	.value	0x2f8
+	.byte	0x7
+	.long	.LASF575
+	.long	0x4061
+	.long	0x4067
+	.uleb128 0x2
+	.long	0xce58
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF576
+	.byte	0x23
+	.value	0x2f9
+	.byte	0x7
+	.long	.LASF577
+	.long	0x407c
+	.long	0x4087
+	.uleb128 0x2
+	.long	0xce58
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF574
+	.byte	0x23
+	.value	0x2fa
+	.long	.LASF578
+	.long	0x409b
+	.long	0x40a6
+	.uleb128 0x2
+	.long	0xce58
+	.uleb128 0x1
+	.long	0xce5d
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x23
+	.value	0x2fb
+	.byte	0xf
+	.long	.LASF579
+	.long	0xce62
+	.long	0x40bf
+	.long	0x40ca
+	.uleb128 0x2
+	.long	0xce58
+	.uleb128 0x1
+	.long	0xce5d
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x23
+	.value	0x2fc
+	.byte	0xf
+	.long	.LASF580
+	.long	0xce62
+	.long	0x40e3
+	.long	0x40ee
+	.uleb128 0x2
+	.long	0xce67
+	.uleb128 0x1
+	.long	0xce5d
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF574
+	.byte	0x23
+	.value	0x2fe
+	.byte	0x11
+	.long	.LASF581
+	.long	0x4103
+	.long	0x410e
+	.uleb128 0x2
+	.long	0xce58
+	.uleb128 0x1
+	.long	0x410e
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF582
+	.byte	0x23
+	.value	0x2f5
+	.byte	0x1f
+	.long	0xacc7
+	.uleb128 0x84
+	.long	.LASF653
+	.value	0x304
+	.long	.LASF654
+	.long	0xacb1
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xacc7
+	.byte	0
+	.uleb128 0xa
+	.long	0x4003
+	.uleb128 0x3c
+	.long	0x4003
+	.uleb128 0x63
+	.long	.LASF583
+	.byte	0x4
+	.byte	0x4
+	.byte	0x22
+	.value	0x144
+	.long	0x49db
+	.uleb128 0x83
+	.long	.LASF584
+	.long	.LASF586
+	.long	0xacf9
+	.byte	0x4
+	.uleb128 0x24
+	.long	.LASF490
+	.byte	0x22
+	.value	0x14a
+	.byte	0x15
+	.long	0xacd5
+	.byte	0x3
+	.uleb128 0x68
+	.long	.LASF587
+	.byte	0x22
+	.value	0x14f
+	.byte	0x28
+	.long	0x415c
+	.byte	0x4
+	.byte	0
+	.byte	0x3
+	.uleb128 0x26
+	.long	.LASF491
+	.byte	0x22
+	.value	0x152
+	.byte	0x7
+	.long	.LASF588
+	.long	0x418f
+	.long	0x4195
+	.uleb128 0x2
+	.long	0xce6c
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF493
+	.byte	0x22
+	.value	0x153
+	.byte	0x7
+	.long	.LASF589
+	.long	0x41aa
+	.long	0x41b5
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF491
+	.byte	0x22
+	.value	0x154
+	.long	.LASF590
+	.long	0x41c9
+	.long	0x41d4
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0xce71
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x22
+	.value	0x155
+	.byte	0x16
+	.long	.LASF591
+	.long	0xce76
+	.long	0x41ed
+	.long	0x41f8
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0xce71
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x22
+	.value	0x156
+	.byte	0x16
+	.long	.LASF592
+	.long	0xce76
+	.long	0x4211
+	.long	0x421c
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0xce71
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF491
+	.byte	0x22
+	.value	0x159
+	.byte	0x11
+	.long	.LASF593
+	.long	0x4231
+	.long	0x423c
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF594
+	.byte	0x22
+	.value	0x15b
+	.byte	0x7
+	.long	.LASF595
+	.long	0x415c
+	.long	0x4255
+	.long	0x425b
+	.uleb128 0x2
+	.long	0xce80
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF594
+	.byte	0x22
+	.value	0x15e
+	.byte	0x7
+	.long	.LASF596
+	.long	0x415c
+	.long	0x4274
+	.long	0x427a
+	.uleb128 0x2
+	.long	0xce85
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x22
+	.value	0x162
+	.byte	0x7
+	.long	.LASF597
+	.long	0x415c
+	.long	0x4293
+	.long	0x429e
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x22
+	.value	0x169
+	.byte	0x7
+	.long	.LASF598
+	.long	0x415c
+	.long	0x42b7
+	.long	0x42c2
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x170
+	.byte	0x7
+	.long	.LASF599
+	.long	0x415c
+	.long	0x42db
+	.long	0x42e6
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x174
+	.byte	0x7
+	.long	.LASF600
+	.long	0x415c
+	.long	0x42ff
+	.long	0x430a
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x178
+	.byte	0x7
+	.long	.LASF601
+	.long	0x415c
+	.long	0x4323
+	.long	0x432e
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x17c
+	.byte	0x7
+	.long	.LASF602
+	.long	0x415c
+	.long	0x4347
+	.long	0x4352
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x180
+	.byte	0x7
+	.long	.LASF603
+	.long	0x415c
+	.long	0x436b
+	.long	0x4371
+	.uleb128 0x2
+	.long	0xce6c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x184
+	.byte	0x7
+	.long	.LASF604
+	.long	0x415c
+	.long	0x438a
+	.long	0x4390
+	.uleb128 0x2
+	.long	0xce7b
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x188
+	.byte	0x7
+	.long	.LASF605
+	.long	0x415c
+	.long	0x43a9
+	.long	0x43af
+	.uleb128 0x2
+	.long	0xce6c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x18c
+	.byte	0x7
+	.long	.LASF606
+	.long	0x415c
+	.long	0x43c8
+	.long	0x43ce
+	.uleb128 0x2
+	.long	0xce7b
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF362
+	.byte	0x22
+	.value	0x190
+	.byte	0x7
+	.long	.LASF607
+	.long	0x415c
+	.long	0x43e7
+	.long	0x43f2
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF362
+	.byte	0x22
+	.value	0x194
+	.byte	0x7
+	.long	.LASF608
+	.long	0x415c
+	.long	0x440b
+	.long	0x4416
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF516
+	.byte	0x22
+	.value	0x198
+	.byte	0x7
+	.long	.LASF609
+	.long	0x415c
+	.long	0x442f
+	.long	0x443a
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF516
+	.byte	0x22
+	.value	0x19c
+	.byte	0x7
+	.long	.LASF610
+	.long	0x415c
+	.long	0x4453
+	.long	0x445e
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF519
+	.byte	0x22
+	.value	0x1a0
+	.byte	0x7
+	.long	.LASF611
+	.long	0x415c
+	.long	0x4477
+	.long	0x4482
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF519
+	.byte	0x22
+	.value	0x1a4
+	.byte	0x7
+	.long	.LASF612
+	.long	0x415c
+	.long	0x449b
+	.long	0x44a6
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF522
+	.byte	0x22
+	.value	0x1a8
+	.byte	0x7
+	.long	.LASF613
+	.long	0x415c
+	.long	0x44bf
+	.long	0x44ca
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF522
+	.byte	0x22
+	.value	0x1ac
+	.byte	0x7
+	.long	.LASF614
+	.long	0x415c
+	.long	0x44e3
+	.long	0x44ee
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF525
+	.byte	0x22
+	.value	0x1b0
+	.byte	0x7
+	.long	.LASF615
+	.long	0x415c
+	.long	0x4507
+	.long	0x4512
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF525
+	.byte	0x22
+	.value	0x1b4
+	.byte	0x7
+	.long	.LASF616
+	.long	0x415c
+	.long	0x452b
+	.long	0x4536
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF528
+	.byte	0x22
+	.value	0x1b8
+	.byte	0x7
+	.long	.LASF617
+	.long	0xacaa
+	.long	0x454f
+	.long	0x4555
+	.uleb128 0x2
+	.long	0xce80
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF528
+	.byte	0x22
+	.value	0x1c0
+	.byte	0x7
+	.long	.LASF618
+	.long	0xacaa
+	.long	0x456e
+	.long	0x4574
+	.uleb128 0x2
+	.long	0xce85
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x22
+	.value	0x1c8
+	.byte	0x7
+	.long	.LASF619
+	.long	0x4589
+	.long	0x4599
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x22
+	.value	0x1d4
+	.byte	0x7
+	.long	.LASF620
+	.long	0x45ae
+	.long	0x45be
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x22
+	.value	0x1e1
+	.byte	0x7
+	.long	.LASF621
+	.long	0x415c
+	.long	0x45d7
+	.long	0x45e2
+	.uleb128 0x2
+	.long	0xce80
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x22
+	.value	0x1ec
+	.byte	0x7
+	.long	.LASF622
+	.long	0x415c
+	.long	0x45fb
+	.long	0x4606
+	.uleb128 0x2
+	.long	0xce85
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x22
+	.value	0x1f7
+	.byte	0x7
+	.long	.LASF623
+	.long	0x415c
+	.long	0x461f
+	.long	0x462f
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x22
+	.value	0x1ff
+	.byte	0x7
+	.long	.LASF624
+	.long	0x415c
+	.long	0x4648
+	.long	0x4658
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x206
+	.byte	0x7
+	.long	.LASF625
+	.long	0xacaa
+	.long	0x4671
+	.long	0x468b
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0xce8a
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x210
+	.byte	0x7
+	.long	.LASF626
+	.long	0xacaa
+	.long	0x46a4
+	.long	0x46be
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0xce8a
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x21b
+	.byte	0x7
+	.long	.LASF627
+	.long	0xacaa
+	.long	0x46d7
+	.long	0x46ec
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0xce8a
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x223
+	.byte	0x7
+	.long	.LASF628
+	.long	0xacaa
+	.long	0x4705
+	.long	0x471a
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0xce8a
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x22b
+	.byte	0x7
+	.long	.LASF629
+	.long	0xacaa
+	.long	0x4733
+	.long	0x474d
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0xce8a
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x235
+	.byte	0x7
+	.long	.LASF630
+	.long	0xacaa
+	.long	0x4766
+	.long	0x4780
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0xce8a
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x240
+	.byte	0x7
+	.long	.LASF631
+	.long	0xacaa
+	.long	0x4799
+	.long	0x47ae
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0xce8a
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x248
+	.byte	0x7
+	.long	.LASF632
+	.long	0xacaa
+	.long	0x47c7
+	.long	0x47dc
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0xce8a
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF550
+	.byte	0x22
+	.value	0x251
+	.byte	0x7
+	.long	.LASF633
+	.long	0x47f1
+	.long	0x4801
+	.uleb128 0x2
+	.long	0xce80
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF552
+	.byte	0x22
+	.value	0x25b
+	.byte	0x7
+	.long	.LASF634
+	.long	0x4816
+	.long	0x481c
+	.uleb128 0x2
+	.long	0xce6c
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF554
+	.byte	0x22
+	.value	0x261
+	.byte	0x7
+	.long	.LASF635
+	.long	0x4831
+	.long	0x4837
+	.uleb128 0x2
+	.long	0xce6c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF556
+	.byte	0x22
+	.value	0x268
+	.byte	0x7
+	.long	.LASF636
+	.long	0x415c
+	.long	0x4850
+	.long	0x4860
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF556
+	.byte	0x22
+	.value	0x26d
+	.byte	0x7
+	.long	.LASF637
+	.long	0x415c
+	.long	0x4879
+	.long	0x4889
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF559
+	.byte	0x22
+	.value	0x272
+	.byte	0x7
+	.long	.LASF638
+	.long	0x415c
+	.long	0x48a2
+	.long	0x48b2
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF559
+	.byte	0x22
+	.value	0x277
+	.byte	0x7
+	.long	.LASF639
+	.long	0x415c
+	.long	0x48cb
+	.long	0x48db
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF562
+	.byte	0x22
+	.value	0x27c
+	.byte	0x7
+	.long	.LASF640
+	.long	0x415c
+	.long	0x48f4
+	.long	0x4904
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF562
+	.byte	0x22
+	.value	0x281
+	.byte	0x7
+	.long	.LASF641
+	.long	0x415c
+	.long	0x491d
+	.long	0x492d
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF565
+	.byte	0x22
+	.value	0x286
+	.byte	0x7
+	.long	.LASF642
+	.long	0x415c
+	.long	0x4946
+	.long	0x4956
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF565
+	.byte	0x22
+	.value	0x28b
+	.byte	0x7
+	.long	.LASF643
+	.long	0x415c
+	.long	0x496f
+	.long	0x497f
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF568
+	.byte	0x22
+	.value	0x290
+	.byte	0x7
+	.long	.LASF644
+	.long	0x415c
+	.long	0x4998
+	.long	0x49a8
+	.uleb128 0x2
+	.long	0xce6c
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF568
+	.byte	0x22
+	.value	0x295
+	.byte	0x7
+	.long	.LASF645
+	.long	0x415c
+	.long	0x49c1
+	.long	0x49d1
+	.uleb128 0x2
+	.long	0xce7b
+	.uleb128 0x1
+	.long	0x415c
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF571
+	.long	0xacd5
+	.byte	0
+	.uleb128 0xa
+	.long	0x413f
+	.uleb128 0x3c
+	.long	0x413f
+	.uleb128 0xa
+	.long	0x49e0
+	.uleb128 0x63
+	.long	.LASF646
+	.byte	0x4
+	.byte	0x4
+	.byte	0x23
+	.value	0x34f
+	.long	0x4b1c
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x34f
+	.byte	0xc
+	.long	0x423c
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x34f
+	.byte	0xc
+	.long	0x425b
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x34f
+	.byte	0xc
+	.long	0x429e
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x34f
+	.byte	0xc
+	.long	0x427a
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x34f
+	.byte	0xc
+	.long	0x41f8
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x34f
+	.byte	0xc
+	.long	0x41d4
+	.uleb128 0x34
+	.long	0x413f
+	.uleb128 0x26
+	.long	.LASF574
+	.byte	0x23
+	.value	0x354
+	.byte	0x7
+	.long	.LASF647
+	.long	0x4a48
+	.long	0x4a4e
+	.uleb128 0x2
+	.long	0xce8f
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF576
+	.byte	0x23
+	.value	0x355
+	.byte	0x7
+	.long	.LASF648
+	.long	0x4a63
+	.long	0x4a6e
+	.uleb128 0x2
+	.long	0xce8f
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF574
+	.byte	0x23
+	.value	0x356
+	.long	.LASF649
+	.long	0x4a82
+	.long	0x4a8d
+	.uleb128 0x2
+	.long	0xce8f
+	.uleb128 0x1
+	.long	0xce94
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x23
+	.value	0x357
+	.byte	0xf
+	.long	.LASF650
+	.long	0xce99
+	.long	0x4aa6
+	.long	0x4ab1
+	.uleb128 0x2
+	.long	0xce8f
+	.uleb128 0x1
+	.long	0xce94
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x23
+	.value	0x358
+	.byte	0xf
+	.long	.LASF651
+	.long	0xce99
+	.long	0x4aca
+	.long	0x4ad5
+	.uleb128 0x2
+	.long	0xce9e
+	.uleb128 0x1
+	.long	0xce94
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF574
+	.byte	0x23
+	.value	0x35a
+	.byte	0x11
+	.long	.LASF652
+	.long	0x4aea
+	.long	0x4af5
+	.uleb128 0x2
+	.long	0xce8f
+	.uleb128 0x1
+	.long	0x4af5
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF582
+	.byte	0x23
+	.value	0x351
+	.byte	0x1d
+	.long	0xacd5
+	.uleb128 0x84
+	.long	.LASF653
+	.value	0x360
+	.long	.LASF655
+	.long	0xacb1
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xacd5
+	.byte	0
+	.uleb128 0xa
+	.long	0x49ea
+	.uleb128 0x3c
+	.long	0x49ea
+	.uleb128 0x63
+	.long	.LASF656
+	.byte	0x8
+	.byte	0x8
+	.byte	0x22
+	.value	0x144
+	.long	0x53c2
+	.uleb128 0x83
+	.long	.LASF584
+	.long	.LASF657
+	.long	0xacf9
+	.byte	0x8
+	.uleb128 0x24
+	.long	.LASF490
+	.byte	0x22
+	.value	0x14a
+	.byte	0x15
+	.long	0xacc0
+	.byte	0x3
+	.uleb128 0x68
+	.long	.LASF587
+	.byte	0x22
+	.value	0x14f
+	.byte	0x28
+	.long	0x4b43
+	.byte	0x8
+	.byte	0
+	.byte	0x3
+	.uleb128 0x26
+	.long	.LASF491
+	.byte	0x22
+	.value	0x152
+	.byte	0x7
+	.long	.LASF658
+	.long	0x4b76
+	.long	0x4b7c
+	.uleb128 0x2
+	.long	0xcea3
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF493
+	.byte	0x22
+	.value	0x153
+	.byte	0x7
+	.long	.LASF659
+	.long	0x4b91
+	.long	0x4b9c
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF491
+	.byte	0x22
+	.value	0x154
+	.long	.LASF660
+	.long	0x4bb0
+	.long	0x4bbb
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0xcea8
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x22
+	.value	0x155
+	.byte	0x16
+	.long	.LASF661
+	.long	0xcead
+	.long	0x4bd4
+	.long	0x4bdf
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0xcea8
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x22
+	.value	0x156
+	.byte	0x16
+	.long	.LASF662
+	.long	0xcead
+	.long	0x4bf8
+	.long	0x4c03
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0xcea8
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF491
+	.byte	0x22
+	.value	0x159
+	.byte	0x11
+	.long	.LASF663
+	.long	0x4c18
+	.long	0x4c23
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF664
+	.byte	0x22
+	.value	0x15b
+	.byte	0x7
+	.long	.LASF665
+	.long	0x4b43
+	.long	0x4c3c
+	.long	0x4c42
+	.uleb128 0x2
+	.long	0xceb7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF664
+	.byte	0x22
+	.value	0x15e
+	.byte	0x7
+	.long	.LASF666
+	.long	0x4b43
+	.long	0x4c5b
+	.long	0x4c61
+	.uleb128 0x2
+	.long	0xcebc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x22
+	.value	0x162
+	.byte	0x7
+	.long	.LASF667
+	.long	0x4b43
+	.long	0x4c7a
+	.long	0x4c85
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x22
+	.value	0x169
+	.byte	0x7
+	.long	.LASF668
+	.long	0x4b43
+	.long	0x4c9e
+	.long	0x4ca9
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x170
+	.byte	0x7
+	.long	.LASF669
+	.long	0x4b43
+	.long	0x4cc2
+	.long	0x4ccd
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x174
+	.byte	0x7
+	.long	.LASF670
+	.long	0x4b43
+	.long	0x4ce6
+	.long	0x4cf1
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x178
+	.byte	0x7
+	.long	.LASF671
+	.long	0x4b43
+	.long	0x4d0a
+	.long	0x4d15
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x17c
+	.byte	0x7
+	.long	.LASF672
+	.long	0x4b43
+	.long	0x4d2e
+	.long	0x4d39
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x180
+	.byte	0x7
+	.long	.LASF673
+	.long	0x4b43
+	.long	0x4d52
+	.long	0x4d58
+	.uleb128 0x2
+	.long	0xcea3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x184
+	.byte	0x7
+	.long	.LASF674
+	.long	0x4b43
+	.long	0x4d71
+	.long	0x4d77
+	.uleb128 0x2
+	.long	0xceb2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x188
+	.byte	0x7
+	.long	.LASF675
+	.long	0x4b43
+	.long	0x4d90
+	.long	0x4d96
+	.uleb128 0x2
+	.long	0xcea3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x18c
+	.byte	0x7
+	.long	.LASF676
+	.long	0x4b43
+	.long	0x4daf
+	.long	0x4db5
+	.uleb128 0x2
+	.long	0xceb2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF362
+	.byte	0x22
+	.value	0x190
+	.byte	0x7
+	.long	.LASF677
+	.long	0x4b43
+	.long	0x4dce
+	.long	0x4dd9
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF362
+	.byte	0x22
+	.value	0x194
+	.byte	0x7
+	.long	.LASF678
+	.long	0x4b43
+	.long	0x4df2
+	.long	0x4dfd
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF516
+	.byte	0x22
+	.value	0x198
+	.byte	0x7
+	.long	.LASF679
+	.long	0x4b43
+	.long	0x4e16
+	.long	0x4e21
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF516
+	.byte	0x22
+	.value	0x19c
+	.byte	0x7
+	.long	.LASF680
+	.long	0x4b43
+	.long	0x4e3a
+	.long	0x4e45
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF519
+	.byte	0x22
+	.value	0x1a0
+	.byte	0x7
+	.long	.LASF681
+	.long	0x4b43
+	.long	0x4e5e
+	.long	0x4e69
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF519
+	.byte	0x22
+	.value	0x1a4
+	.byte	0x7
+	.long	.LASF682
+	.long	0x4b43
+	.long	0x4e82
+	.long	0x4e8d
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF522
+	.byte	0x22
+	.value	0x1a8
+	.byte	0x7
+	.long	.LASF683
+	.long	0x4b43
+	.long	0x4ea6
+	.long	0x4eb1
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF522
+	.byte	0x22
+	.value	0x1ac
+	.byte	0x7
+	.long	.LASF684
+	.long	0x4b43
+	.long	0x4eca
+	.long	0x4ed5
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF525
+	.byte	0x22
+	.value	0x1b0
+	.byte	0x7
+	.long	.LASF685
+	.long	0x4b43
+	.long	0x4eee
+	.long	0x4ef9
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF525
+	.byte	0x22
+	.value	0x1b4
+	.byte	0x7
+	.long	.LASF686
+	.long	0x4b43
+	.long	0x4f12
+	.long	0x4f1d
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF528
+	.byte	0x22
+	.value	0x1b8
+	.byte	0x7
+	.long	.LASF687
+	.long	0xacaa
+	.long	0x4f36
+	.long	0x4f3c
+	.uleb128 0x2
+	.long	0xceb7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF528
+	.byte	0x22
+	.value	0x1c0
+	.byte	0x7
+	.long	.LASF688
+	.long	0xacaa
+	.long	0x4f55
+	.long	0x4f5b
+	.uleb128 0x2
+	.long	0xcebc
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x22
+	.value	0x1c8
+	.byte	0x7
+	.long	.LASF689
+	.long	0x4f70
+	.long	0x4f80
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x22
+	.value	0x1d4
+	.byte	0x7
+	.long	.LASF690
+	.long	0x4f95
+	.long	0x4fa5
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x22
+	.value	0x1e1
+	.byte	0x7
+	.long	.LASF691
+	.long	0x4b43
+	.long	0x4fbe
+	.long	0x4fc9
+	.uleb128 0x2
+	.long	0xceb7
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x22
+	.value	0x1ec
+	.byte	0x7
+	.long	.LASF692
+	.long	0x4b43
+	.long	0x4fe2
+	.long	0x4fed
+	.uleb128 0x2
+	.long	0xcebc
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x22
+	.value	0x1f7
+	.byte	0x7
+	.long	.LASF693
+	.long	0x4b43
+	.long	0x5006
+	.long	0x5016
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x22
+	.value	0x1ff
+	.byte	0x7
+	.long	.LASF694
+	.long	0x4b43
+	.long	0x502f
+	.long	0x503f
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x206
+	.byte	0x7
+	.long	.LASF695
+	.long	0xacaa
+	.long	0x5058
+	.long	0x5072
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0xcec1
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x210
+	.byte	0x7
+	.long	.LASF696
+	.long	0xacaa
+	.long	0x508b
+	.long	0x50a5
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0xcec1
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x21b
+	.byte	0x7
+	.long	.LASF697
+	.long	0xacaa
+	.long	0x50be
+	.long	0x50d3
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0xcec1
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x223
+	.byte	0x7
+	.long	.LASF698
+	.long	0xacaa
+	.long	0x50ec
+	.long	0x5101
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0xcec1
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x22b
+	.byte	0x7
+	.long	.LASF699
+	.long	0xacaa
+	.long	0x511a
+	.long	0x5134
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0xcec1
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x235
+	.byte	0x7
+	.long	.LASF700
+	.long	0xacaa
+	.long	0x514d
+	.long	0x5167
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0xcec1
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x240
+	.byte	0x7
+	.long	.LASF701
+	.long	0xacaa
+	.long	0x5180
+	.long	0x5195
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0xcec1
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x248
+	.byte	0x7
+	.long	.LASF702
+	.long	0xacaa
+	.long	0x51ae
+	.long	0x51c3
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0xcec1
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF550
+	.byte	0x22
+	.value	0x251
+	.byte	0x7
+	.long	.LASF703
+	.long	0x51d8
+	.long	0x51e8
+	.uleb128 0x2
+	.long	0xceb7
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF552
+	.byte	0x22
+	.value	0x25b
+	.byte	0x7
+	.long	.LASF704
+	.long	0x51fd
+	.long	0x5203
+	.uleb128 0x2
+	.long	0xcea3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF554
+	.byte	0x22
+	.value	0x261
+	.byte	0x7
+	.long	.LASF705
+	.long	0x5218
+	.long	0x521e
+	.uleb128 0x2
+	.long	0xcea3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF556
+	.byte	0x22
+	.value	0x268
+	.byte	0x7
+	.long	.LASF706
+	.long	0x4b43
+	.long	0x5237
+	.long	0x5247
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF556
+	.byte	0x22
+	.value	0x26d
+	.byte	0x7
+	.long	.LASF707
+	.long	0x4b43
+	.long	0x5260
+	.long	0x5270
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF559
+	.byte	0x22
+	.value	0x272
+	.byte	0x7
+	.long	.LASF708
+	.long	0x4b43
+	.long	0x5289
+	.long	0x5299
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF559
+	.byte	0x22
+	.value	0x277
+	.byte	0x7
+	.long	.LASF709
+	.long	0x4b43
+	.long	0x52b2
+	.long	0x52c2
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF562
+	.byte	0x22
+	.value	0x27c
+	.byte	0x7
+	.long	.LASF710
+	.long	0x4b43
+	.long	0x52db
+	.long	0x52eb
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF562
+	.byte	0x22
+	.value	0x281
+	.byte	0x7
+	.long	.LASF711
+	.long	0x4b43
+	.long	0x5304
+	.long	0x5314
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF565
+	.byte	0x22
+	.value	0x286
+	.byte	0x7
+	.long	.LASF712
+	.long	0x4b43
+	.long	0x532d
+	.long	0x533d
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF565
+	.byte	0x22
+	.value	0x28b
+	.byte	0x7
+	.long	.LASF713
+	.long	0x4b43
+	.long	0x5356
+	.long	0x5366
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF568
+	.byte	0x22
+	.value	0x290
+	.byte	0x7
+	.long	.LASF714
+	.long	0x4b43
+	.long	0x537f
+	.long	0x538f
+	.uleb128 0x2
+	.long	0xcea3
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF568
+	.byte	0x22
+	.value	0x295
+	.byte	0x7
+	.long	.LASF715
+	.long	0x4b43
+	.long	0x53a8
+	.long	0x53b8
+	.uleb128 0x2
+	.long	0xceb2
+	.uleb128 0x1
+	.long	0x4b43
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF571
+	.long	0xacc0
+	.byte	0
+	.uleb128 0xa
+	.long	0x4b26
+	.uleb128 0x3c
+	.long	0x4b26
+	.uleb128 0xa
+	.long	0x53c7
+	.uleb128 0x63
+	.long	.LASF716
+	.byte	0x8
+	.byte	0x8
+	.byte	0x23
+	.value	0x37d
+	.long	0x5503
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x37d
+	.byte	0xc
+	.long	0x4c23
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x37d
+	.byte	0xc
+	.long	0x4c42
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x37d
+	.byte	0xc
+	.long	0x4c85
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x37d
+	.byte	0xc
+	.long	0x4c61
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x37d
+	.byte	0xc
+	.long	0x4bdf
+	.uleb128 0x16
+	.byte	0x23
+	.value	0x37d
+	.byte	0xc
+	.long	0x4bbb
+	.uleb128 0x34
+	.long	0x4b26
+	.uleb128 0x26
+	.long	.LASF574
+	.byte	0x23
+	.value	0x382
+	.byte	0x7
+	.long	.LASF717
+	.long	0x542f
+	.long	0x5435
+	.uleb128 0x2
+	.long	0xcec6
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF576
+	.byte	0x23
+	.value	0x383
+	.byte	0x7
+	.long	.LASF718
+	.long	0x544a
+	.long	0x5455
+	.uleb128 0x2
+	.long	0xcec6
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF574
+	.byte	0x23
+	.value	0x384
+	.long	.LASF719
+	.long	0x5469
+	.long	0x5474
+	.uleb128 0x2
+	.long	0xcec6
+	.uleb128 0x1
+	.long	0xcecb
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x23
+	.value	0x385
+	.byte	0xf
+	.long	.LASF720
+	.long	0xced0
+	.long	0x548d
+	.long	0x5498
+	.uleb128 0x2
+	.long	0xcec6
+	.uleb128 0x1
+	.long	0xcecb
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x23
+	.value	0x386
+	.byte	0xf
+	.long	.LASF721
+	.long	0xced0
+	.long	0x54b1
+	.long	0x54bc
+	.uleb128 0x2
+	.long	0xced5
+	.uleb128 0x1
+	.long	0xcecb
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF574
+	.byte	0x23
+	.value	0x388
+	.byte	0x11
+	.long	.LASF722
+	.long	0x54d1
+	.long	0x54dc
+	.uleb128 0x2
+	.long	0xcec6
+	.uleb128 0x1
+	.long	0x54dc
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF582
+	.byte	0x23
+	.value	0x37f
+	.byte	0x1f
+	.long	0xacc0
+	.uleb128 0x84
+	.long	.LASF653
+	.value	0x38e
+	.long	.LASF723
+	.long	0xacb1
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xacc0
+	.byte	0
+	.uleb128 0xa
+	.long	0x53d1
+	.uleb128 0x3c
+	.long	0x53d1
+	.uleb128 0x56
+	.string	"abs"
+	.byte	0x24
+	.byte	0x4f
+	.long	.LASF724
+	.long	0xb4d1
+	.long	0x5526
+	.uleb128 0x1
+	.long	0xb4d1
+	.byte	0
+	.uleb128 0x56
+	.string	"abs"
+	.byte	0x24
+	.byte	0x4b
+	.long	.LASF725
+	.long	0xb4df
+	.long	0x553f
+	.uleb128 0x1
+	.long	0xb4df
+	.byte	0
+	.uleb128 0x56
+	.string	"abs"
+	.byte	0x24
+	.byte	0x47
+	.long	.LASF726
+	.long	0xb4d8
+	.long	0x5558
+	.uleb128 0x1
+	.long	0xb4d8
+	.byte	0
+	.uleb128 0x56
+	.string	"abs"
+	.byte	0x24
+	.byte	0x3d
+	.long	.LASF727
+	.long	0xad0a
+	.long	0x5571
+	.uleb128 0x1
+	.long	0xad0a
+	.byte	0
+	.uleb128 0x56
+	.string	"abs"
+	.byte	0x24
+	.byte	0x38
+	.long	.LASF728
+	.long	0xacfe
+	.long	0x558a
+	.uleb128 0x1
+	.long	0xacfe
+	.byte	0
+	.uleb128 0x56
+	.string	"div"
+	.byte	0x10
+	.byte	0xb1
+	.long	.LASF729
+	.long	0xb57e
+	.long	0x55a8
+	.uleb128 0x1
+	.long	0xacfe
+	.uleb128 0x1
+	.long	0xacfe
+	.byte	0
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x52
+	.byte	0xb
+	.long	0xcfe5
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x53
+	.byte	0xb
+	.long	0xcfd9
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x54
+	.byte	0xb
+	.long	0xbd40
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x5c
+	.byte	0xb
+	.long	0xcff6
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x65
+	.byte	0xb
+	.long	0xd011
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x68
+	.byte	0xb
+	.long	0xd02c
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x69
+	.byte	0xb
+	.long	0xd042
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x3c
+	.byte	0xb
+	.long	0xb704
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x3d
+	.byte	0xb
+	.long	0xb710
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x3e
+	.byte	0xb
+	.long	0xc328
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x40
+	.byte	0xb
+	.long	0xd058
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x41
+	.byte	0xb
+	.long	0xd064
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x42
+	.byte	0xb
+	.long	0xd07f
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x43
+	.byte	0xb
+	.long	0xd09a
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x44
+	.byte	0xb
+	.long	0xd0b5
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x45
+	.byte	0xb
+	.long	0xd0cb
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x46
+	.byte	0xb
+	.long	0xd0e6
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x47
+	.byte	0xb
+	.long	0xd0fc
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x4f
+	.byte	0xb
+	.long	0xb751
+	.uleb128 0x4
+	.byte	0x26
+	.byte	0x50
+	.byte	0xb
+	.long	0xd112
+	.uleb128 0x39
+	.long	.LASF730
+	.byte	0x27
+	.byte	0x37
+	.byte	0xd
+	.long	0x5669
+	.uleb128 0x96
+	.string	"_V2"
+	.byte	0x27
+	.value	0x44e
+	.byte	0x16
+	.uleb128 0xbe
+	.byte	0x27
+	.value	0x529
+	.byte	0x1f
+	.long	0x5677
+	.byte	0
+	.uleb128 0x94
+	.long	.LASF732
+	.byte	0x1a
+	.value	0x2fa
+	.byte	0x14
+	.long	0x5681
+	.uleb128 0x91
+	.long	.LASF733
+	.byte	0x27
+	.value	0x4cd
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF734
+	.byte	0x27
+	.byte	0x34
+	.byte	0xd
+	.uleb128 0x45
+	.long	.LASF735
+	.byte	0x29
+	.byte	0x2e
+	.byte	0xb
+	.uleb128 0x85
+	.long	.LASF736
+	.byte	0x2a
+	.value	0x12e
+	.byte	0xd
+	.long	0x56ae
+	.uleb128 0xbf
+	.long	.LASF1571
+	.byte	0x2a
+	.value	0x13f
+	.byte	0x5
+	.long	.LASF2342
+	.byte	0
+	.uleb128 0xc0
+	.long	.LASF737
+	.byte	0x4
+	.byte	0x4
+	.byte	0x23
+	.byte	0xc4
+	.byte	0xc
+	.long	0x5b32
+	.uleb128 0x97
+	.long	.LASF738
+	.byte	0xca
+	.long	.LASF739
+	.long	0xacf9
+	.uleb128 0x97
+	.long	.LASF584
+	.byte	0xce
+	.long	.LASF740
+	.long	0xacf9
+	.uleb128 0x98
+	.long	.LASF587
+	.byte	0x23
+	.byte	0xd1
+	.byte	0x21
+	.long	0xd22e
+	.byte	0
+	.byte	0x3
+	.uleb128 0x47
+	.long	.LASF574
+	.byte	0x23
+	.byte	0xe1
+	.byte	0x7
+	.long	.LASF741
+	.long	0x56fe
+	.long	0x5704
+	.uleb128 0x2
+	.long	0xe9ec
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF576
+	.byte	0x23
+	.byte	0xe2
+	.byte	0x7
+	.long	.LASF742
+	.long	0x5718
+	.long	0x5723
+	.uleb128 0x2
+	.long	0xe9ec
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xc1
+	.long	.LASF574
+	.byte	0x23
+	.byte	0xe3
+	.byte	0x7
+	.long	.LASF743
+	.long	0x5738
+	.long	0x5743
+	.uleb128 0x2
+	.long	0xe9ec
+	.uleb128 0x1
+	.long	0xe9f1
+	.byte	0
+	.uleb128 0x99
+	.long	.LASF53
+	.byte	0xe4
+	.long	.LASF744
+	.long	0xe9f6
+	.long	0x575a
+	.long	0x5765
+	.uleb128 0x2
+	.long	0xe9ec
+	.uleb128 0x1
+	.long	0xe9f1
+	.byte	0
+	.uleb128 0x99
+	.long	.LASF53
+	.byte	0xe5
+	.long	.LASF745
+	.long	0xe9f6
+	.long	0x577c
+	.long	0x5787
+	.uleb128 0x2
+	.long	0xe9fb
+	.uleb128 0x1
+	.long	0xe9f1
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF574
+	.byte	0x23
+	.byte	0xe7
+	.byte	0x11
+	.long	.LASF746
+	.long	0x579b
+	.long	0x57a6
+	.uleb128 0x2
+	.long	0xe9ec
+	.uleb128 0x1
+	.long	0xd22e
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF747
+	.byte	0x23
+	.byte	0xe9
+	.byte	0x7
+	.long	.LASF748
+	.long	0xd22e
+	.long	0x57be
+	.long	0x57c4
+	.uleb128 0x2
+	.long	0xea00
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF747
+	.byte	0x23
+	.byte	0xec
+	.byte	0x7
+	.long	.LASF749
+	.long	0xd22e
+	.long	0x57dc
+	.long	0x57e2
+	.uleb128 0x2
+	.long	0xea05
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF53
+	.byte	0x23
+	.byte	0xf0
+	.byte	0x7
+	.long	.LASF750
+	.long	0xd22e
+	.long	0x57fa
+	.long	0x5805
+	.uleb128 0x2
+	.long	0xe9ec
+	.uleb128 0x1
+	.long	0xd22e
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF53
+	.byte	0x23
+	.byte	0xf4
+	.byte	0x7
+	.long	.LASF751
+	.long	0xd22e
+	.long	0x581d
+	.long	0x5828
+	.uleb128 0x2
+	.long	0xe9fb
+	.uleb128 0x1
+	.long	0xd22e
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF528
+	.byte	0x23
+	.byte	0xf8
+	.byte	0x7
+	.long	.LASF752
+	.long	0xacaa
+	.long	0x5840
+	.long	0x5846
+	.uleb128 0x2
+	.long	0xea00
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF528
+	.byte	0x23
+	.value	0x100
+	.byte	0x7
+	.long	.LASF753
+	.long	0xacaa
+	.long	0x585f
+	.long	0x5865
+	.uleb128 0x2
+	.long	0xea05
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x23
+	.value	0x10d
+	.byte	0x7
+	.long	.LASF754
+	.long	0x587a
+	.long	0x588a
+	.uleb128 0x2
+	.long	0xe9ec
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x23
+	.value	0x113
+	.byte	0x7
+	.long	.LASF755
+	.long	0x589f
+	.long	0x58af
+	.uleb128 0x2
+	.long	0xe9fb
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x23
+	.value	0x119
+	.byte	0x7
+	.long	.LASF756
+	.long	0xd22e
+	.long	0x58c8
+	.long	0x58d3
+	.uleb128 0x2
+	.long	0xea00
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x23
+	.value	0x122
+	.byte	0x7
+	.long	.LASF757
+	.long	0xd22e
+	.long	0x58ec
+	.long	0x58f7
+	.uleb128 0x2
+	.long	0xea05
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x23
+	.value	0x12b
+	.byte	0x7
+	.long	.LASF758
+	.long	0xd22e
+	.long	0x5910
+	.long	0x5920
+	.uleb128 0x2
+	.long	0xe9ec
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x23
+	.value	0x135
+	.byte	0x7
+	.long	.LASF759
+	.long	0xd22e
+	.long	0x5939
+	.long	0x5949
+	.uleb128 0x2
+	.long	0xe9fb
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x23
+	.value	0x140
+	.byte	0x7
+	.long	.LASF760
+	.long	0xacaa
+	.long	0x5962
+	.long	0x597c
+	.uleb128 0x2
+	.long	0xe9ec
+	.uleb128 0x1
+	.long	0xea0a
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x23
+	.value	0x14c
+	.byte	0x7
+	.long	.LASF761
+	.long	0xacaa
+	.long	0x5995
+	.long	0x59af
+	.uleb128 0x2
+	.long	0xe9fb
+	.uleb128 0x1
+	.long	0xea0a
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x23
+	.value	0x158
+	.byte	0x7
+	.long	.LASF762
+	.long	0xacaa
+	.long	0x59c8
+	.long	0x59dd
+	.uleb128 0x2
+	.long	0xe9ec
+	.uleb128 0x1
+	.long	0xea0a
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x23
+	.value	0x15e
+	.byte	0x7
+	.long	.LASF763
+	.long	0xacaa
+	.long	0x59f6
+	.long	0x5a0b
+	.uleb128 0x2
+	.long	0xe9fb
+	.uleb128 0x1
+	.long	0xea0a
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x23
+	.value	0x164
+	.byte	0x7
+	.long	.LASF764
+	.long	0xacaa
+	.long	0x5a24
+	.long	0x5a3e
+	.uleb128 0x2
+	.long	0xe9ec
+	.uleb128 0x1
+	.long	0xea0a
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x23
+	.value	0x170
+	.byte	0x7
+	.long	.LASF765
+	.long	0xacaa
+	.long	0x5a57
+	.long	0x5a71
+	.uleb128 0x2
+	.long	0xe9fb
+	.uleb128 0x1
+	.long	0xea0a
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x23
+	.value	0x17c
+	.byte	0x7
+	.long	.LASF766
+	.long	0xacaa
+	.long	0x5a8a
+	.long	0x5a9f
+	.uleb128 0x2
+	.long	0xe9ec
+	.uleb128 0x1
+	.long	0xea0a
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x23
+	.value	0x182
+	.byte	0x7
+	.long	.LASF767
+	.long	0xacaa
+	.long	0x5ab8
+	.long	0x5acd
+	.uleb128 0x2
+	.long	0xe9fb
+	.uleb128 0x1
+	.long	0xea0a
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF550
+	.byte	0x23
+	.value	0x189
+	.byte	0x5
+	.long	.LASF768
+	.long	0x5ae2
+	.long	0x5af2
+	.uleb128 0x2
+	.long	0xea00
+	.uleb128 0x1
+	.long	0xd22e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF552
+	.byte	0x23
+	.value	0x192
+	.byte	0x5
+	.long	.LASF769
+	.long	0x5b07
+	.long	0x5b0d
+	.uleb128 0x2
+	.long	0xe9ec
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF554
+	.byte	0x23
+	.value	0x196
+	.byte	0x5
+	.long	.LASF770
+	.long	0x5b22
+	.long	0x5b28
+	.uleb128 0x2
+	.long	0xe9ec
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xd22e
+	.byte	0
+	.uleb128 0xa
+	.long	0x56ae
+	.uleb128 0x3c
+	.long	0x56ae
+	.uleb128 0x3c
+	.long	0x5b32
+	.uleb128 0x4
+	.byte	0x2b
+	.byte	0x62
+	.byte	0x14
+	.long	0xb374
+	.uleb128 0x4
+	.byte	0x2b
+	.byte	0x63
+	.byte	0x14
+	.long	0xea9b
+	.uleb128 0x4
+	.byte	0x2b
+	.byte	0x64
+	.byte	0x14
+	.long	0xb387
+	.uleb128 0x4
+	.byte	0x2b
+	.byte	0x65
+	.byte	0x14
+	.long	0xb38d
+	.uleb128 0x4
+	.byte	0x2b
+	.byte	0x66
+	.byte	0x14
+	.long	0xb393
+	.uleb128 0x74
+	.string	"pmr"
+	.byte	0x2c
+	.byte	0x3c
+	.byte	0xd
+	.long	0x5d05
+	.uleb128 0x3e
+	.long	.LASF771
+	.uleb128 0xa
+	.long	0x5b75
+	.uleb128 0x29
+	.long	.LASF772
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x8d
+	.byte	0xb
+	.long	0x5cff
+	.uleb128 0x1b
+	.long	.LASF773
+	.byte	0x2d
+	.byte	0x9a
+	.byte	0x7
+	.long	.LASF774
+	.byte	0x1
+	.long	0x5ba1
+	.long	0x5ba7
+	.uleb128 0x2
+	.long	0xf4f9
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF773
+	.byte	0x2d
+	.byte	0x9e
+	.byte	0x7
+	.long	.LASF775
+	.byte	0x1
+	.long	0x5bbc
+	.long	0x5bc7
+	.uleb128 0x2
+	.long	0xf4f9
+	.uleb128 0x1
+	.long	0xeacd
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF773
+	.byte	0x2d
+	.byte	0xa3
+	.byte	0x7
+	.long	.LASF776
+	.long	0x5bdb
+	.long	0x5be6
+	.uleb128 0x2
+	.long	0xf4f9
+	.uleb128 0x1
+	.long	0xf3fa
+	.byte	0
+	.uleb128 0x86
+	.long	.LASF53
+	.byte	0x2d
+	.byte	0xab
+	.byte	0x7
+	.long	.LASF777
+	.long	0xf4fe
+	.long	0x5bff
+	.long	0x5c0a
+	.uleb128 0x2
+	.long	0xf4f9
+	.uleb128 0x1
+	.long	0xf3fa
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF97
+	.byte	0x2d
+	.byte	0xaf
+	.byte	0x7
+	.long	.LASF778
+	.long	0xf503
+	.byte	0x1
+	.long	0x5c23
+	.long	0x5c2e
+	.uleb128 0x2
+	.long	0xf4f9
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF99
+	.byte	0x2d
+	.byte	0xb9
+	.byte	0x7
+	.long	.LASF779
+	.byte	0x1
+	.long	0x5c43
+	.long	0x5c53
+	.uleb128 0x2
+	.long	0xf4f9
+	.uleb128 0x1
+	.long	0xf503
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF780
+	.byte	0x2d
+	.byte	0xbf
+	.byte	0x7
+	.long	.LASF781
+	.long	0xb6e6
+	.byte	0x1
+	.long	0x5c6c
+	.long	0x5c7c
+	.uleb128 0x2
+	.long	0xf4f9
+	.uleb128 0x1
+	.long	0x121
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF782
+	.byte	0x2d
+	.byte	0xc4
+	.byte	0x7
+	.long	.LASF783
+	.byte	0x1
+	.long	0x5c91
+	.long	0x5ca6
+	.uleb128 0x2
+	.long	0xf4f9
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0x121
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF228
+	.byte	0x2d
+	.value	0x14d
+	.byte	0x7
+	.long	.LASF784
+	.long	0x5b7f
+	.byte	0x1
+	.long	0x5cc0
+	.long	0x5cc6
+	.uleb128 0x2
+	.long	0xf508
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF785
+	.byte	0x2d
+	.value	0x151
+	.byte	0x7
+	.long	.LASF786
+	.long	0xeacd
+	.byte	0x1
+	.long	0x5ce0
+	.long	0x5ce6
+	.uleb128 0x2
+	.long	0xf508
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF787
+	.byte	0x2d
+	.value	0x180
+	.byte	0x18
+	.long	0xeacd
+	.byte	0
+	.uleb128 0xc2
+	.string	"_Tp"
+	.long	0x3712
+	.byte	0
+	.uleb128 0xa
+	.long	0x5b7f
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF788
+	.byte	0x8
+	.byte	0x2e
+	.byte	0x8c
+	.byte	0xb
+	.long	0x5ec4
+	.uleb128 0x1d
+	.long	.LASF789
+	.byte	0x1
+	.byte	0x2e
+	.byte	0x8f
+	.byte	0x9
+	.long	0x5d3e
+	.uleb128 0xd
+	.long	.LASF482
+	.byte	0x2e
+	.byte	0x91
+	.byte	0xa
+	.long	0xeadc
+	.uleb128 0xe
+	.string	"_Up"
+	.long	0xe777
+	.uleb128 0xe
+	.string	"_Ep"
+	.long	0xe675
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF790
+	.byte	0x2e
+	.byte	0xa6
+	.byte	0x7
+	.long	.LASF791
+	.long	0x5d52
+	.long	0x5d58
+	.uleb128 0x2
+	.long	0xeb68
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF790
+	.byte	0x2e
+	.byte	0xa8
+	.byte	0x7
+	.long	.LASF792
+	.byte	0x1
+	.long	0x5d6d
+	.long	0x5d78
+	.uleb128 0x2
+	.long	0xeb68
+	.uleb128 0x1
+	.long	0x5d78
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF220
+	.byte	0x2e
+	.byte	0xa0
+	.byte	0xd
+	.long	0x5d1f
+	.byte	0x1
+	.uleb128 0x1b
+	.long	.LASF790
+	.byte	0x2e
+	.byte	0xb0
+	.byte	0x7
+	.long	.LASF793
+	.byte	0x1
+	.long	0x5d9a
+	.long	0x5da5
+	.uleb128 0x2
+	.long	0xeb68
+	.uleb128 0x1
+	.long	0xeb6d
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF53
+	.byte	0x2e
+	.byte	0xb5
+	.byte	0x18
+	.long	.LASF794
+	.long	0xeb72
+	.byte	0x1
+	.long	0x5dbe
+	.long	0x5dc9
+	.uleb128 0x2
+	.long	0xeb68
+	.uleb128 0x1
+	.long	0xeb6d
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF795
+	.byte	0x2e
+	.byte	0xbd
+	.byte	0x12
+	.long	.LASF796
+	.long	0xeb77
+	.byte	0x1
+	.long	0x5de2
+	.long	0x5de8
+	.uleb128 0x2
+	.long	0xeb68
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF795
+	.byte	0x2e
+	.byte	0xbf
+	.byte	0x12
+	.long	.LASF797
+	.long	0x5d78
+	.byte	0x1
+	.long	0x5e01
+	.long	0x5e07
+	.uleb128 0x2
+	.long	0xeb7c
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF798
+	.byte	0x2e
+	.byte	0xc1
+	.byte	0x12
+	.long	.LASF799
+	.long	0xeafa
+	.byte	0x1
+	.long	0x5e20
+	.long	0x5e26
+	.uleb128 0x2
+	.long	0xeb68
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF798
+	.byte	0x2e
+	.byte	0xc3
+	.byte	0x12
+	.long	.LASF800
+	.long	0xeaeb
+	.byte	0x1
+	.long	0x5e3f
+	.long	0x5e45
+	.uleb128 0x2
+	.long	0xeb7c
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF801
+	.byte	0x2e
+	.byte	0xc6
+	.byte	0xc
+	.long	.LASF802
+	.byte	0x1
+	.long	0x5e5a
+	.long	0x5e65
+	.uleb128 0x2
+	.long	0xeb68
+	.uleb128 0x1
+	.long	0x5d78
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF487
+	.byte	0x2e
+	.byte	0xcf
+	.byte	0xf
+	.long	.LASF803
+	.long	0x5d78
+	.byte	0x1
+	.long	0x5e7e
+	.long	0x5e84
+	.uleb128 0x2
+	.long	0xeb68
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF58
+	.byte	0x2e
+	.byte	0xd8
+	.byte	0x7
+	.long	.LASF804
+	.byte	0x1
+	.long	0x5e99
+	.long	0x5ea4
+	.uleb128 0x2
+	.long	0xeb68
+	.uleb128 0x1
+	.long	0xeb72
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF805
+	.byte	0x2e
+	.byte	0xe0
+	.byte	0x1b
+	.long	0x6370
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xe777
+	.uleb128 0xe
+	.string	"_Dp"
+	.long	0xe675
+	.byte	0
+	.uleb128 0xa
+	.long	0x5d05
+	.uleb128 0x1d
+	.long	.LASF806
+	.byte	0x1
+	.byte	0x2
+	.byte	0x4e
+	.byte	0xc
+	.long	0x5fc6
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0x50
+	.byte	0x11
+	.long	.LASF808
+	.long	0x5eea
+	.long	0x5ef0
+	.uleb128 0x2
+	.long	0xeae6
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0x53
+	.byte	0x11
+	.long	.LASF809
+	.long	0x5f04
+	.long	0x5f0f
+	.uleb128 0x2
+	.long	0xeae6
+	.uleb128 0x1
+	.long	0xeaeb
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF807
+	.byte	0x2
+	.byte	0x56
+	.byte	0x11
+	.long	.LASF810
+	.long	0x5f23
+	.long	0x5f2e
+	.uleb128 0x2
+	.long	0xeae6
+	.uleb128 0x1
+	.long	0xeaf0
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF807
+	.byte	0x2
+	.byte	0x57
+	.byte	0x11
+	.long	.LASF811
+	.long	0x5f42
+	.long	0x5f4d
+	.uleb128 0x2
+	.long	0xeae6
+	.uleb128 0x1
+	.long	0xeaf5
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0x5e
+	.byte	0x7
+	.long	.LASF812
+	.long	0x5f61
+	.long	0x5f71
+	.uleb128 0x2
+	.long	0xeae6
+	.uleb128 0x1
+	.long	0x1de
+	.uleb128 0x1
+	.long	0x20d
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF813
+	.byte	0x2
+	.byte	0x7c
+	.byte	0x7
+	.long	.LASF814
+	.long	0xeafa
+	.long	0x5f8b
+	.uleb128 0x1
+	.long	0xeaff
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF813
+	.byte	0x2
+	.byte	0x7f
+	.byte	0x7
+	.long	.LASF815
+	.long	0xeaeb
+	.long	0x5fa5
+	.uleb128 0x1
+	.long	0xeaf0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF816
+	.byte	0x2
+	.byte	0x81
+	.byte	0x27
+	.long	0xe675
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF817
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xe675
+	.byte	0
+	.uleb128 0xa
+	.long	0x5ec9
+	.uleb128 0x3a
+	.long	.LASF819
+	.byte	0x1
+	.byte	0x2
+	.value	0x1a0
+	.byte	0xc
+	.long	0x60ec
+	.uleb128 0x3b
+	.long	0x5ec9
+	.byte	0
+	.byte	0x3
+	.uleb128 0x14
+	.long	.LASF813
+	.byte	0x2
+	.value	0x1a8
+	.byte	0x7
+	.long	.LASF820
+	.long	0xeafa
+	.long	0x5ffb
+	.uleb128 0x1
+	.long	0xeb04
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF813
+	.byte	0x2
+	.value	0x1ab
+	.byte	0x7
+	.long	.LASF821
+	.long	0xeaeb
+	.long	0x6016
+	.uleb128 0x1
+	.long	0xeb09
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF822
+	.byte	0x2
+	.value	0x1ae
+	.byte	0x7
+	.long	.LASF823
+	.long	0x602b
+	.long	0x6031
+	.uleb128 0x2
+	.long	0xeb0e
+	.byte	0
+	.uleb128 0x69
+	.long	.LASF822
+	.byte	0x2
+	.value	0x1b2
+	.byte	0x7
+	.long	.LASF824
+	.long	0x6046
+	.long	0x6051
+	.uleb128 0x2
+	.long	0xeb0e
+	.uleb128 0x1
+	.long	0xeaeb
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF822
+	.byte	0x2
+	.value	0x1bc
+	.byte	0x11
+	.long	.LASF825
+	.long	0x6066
+	.long	0x6071
+	.uleb128 0x2
+	.long	0xeb0e
+	.uleb128 0x1
+	.long	0xeb09
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x2
+	.value	0x1c0
+	.byte	0x14
+	.long	.LASF826
+	.long	0xeb04
+	.long	0x608a
+	.long	0x6095
+	.uleb128 0x2
+	.long	0xeb0e
+	.uleb128 0x1
+	.long	0xeb09
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF822
+	.byte	0x2
+	.value	0x1c6
+	.byte	0x7
+	.long	.LASF827
+	.long	0x60aa
+	.long	0x60b5
+	.uleb128 0x2
+	.long	0xeb0e
+	.uleb128 0x1
+	.long	0xeb13
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF828
+	.byte	0x2
+	.value	0x220
+	.byte	0x7
+	.long	.LASF829
+	.byte	0x2
+	.long	0x60cb
+	.long	0x60d6
+	.uleb128 0x2
+	.long	0xeb0e
+	.uleb128 0x1
+	.long	0xeb04
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF817
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0x6a
+	.long	.LASF851
+	.uleb128 0x9
+	.long	0xe675
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x5fcb
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x8
+	.byte	0x2
+	.byte	0xbb
+	.byte	0xc
+	.long	0x61ee
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xbd
+	.byte	0x11
+	.long	.LASF831
+	.long	0x6112
+	.long	0x6118
+	.uleb128 0x2
+	.long	0xeb18
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xc0
+	.byte	0x11
+	.long	.LASF832
+	.long	0x612c
+	.long	0x6137
+	.uleb128 0x2
+	.long	0xeb18
+	.uleb128 0x1
+	.long	0xeb1d
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xc3
+	.byte	0x11
+	.long	.LASF833
+	.long	0x614b
+	.long	0x6156
+	.uleb128 0x2
+	.long	0xeb18
+	.uleb128 0x1
+	.long	0xeb22
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xc4
+	.byte	0x11
+	.long	.LASF834
+	.long	0x616a
+	.long	0x6175
+	.uleb128 0x2
+	.long	0xeb18
+	.uleb128 0x1
+	.long	0xeb27
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xcb
+	.byte	0x7
+	.long	.LASF835
+	.long	0x6189
+	.long	0x6199
+	.uleb128 0x2
+	.long	0xeb18
+	.uleb128 0x1
+	.long	0x1de
+	.uleb128 0x1
+	.long	0x20d
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF813
+	.byte	0x2
+	.byte	0xe9
+	.byte	0x7
+	.long	.LASF836
+	.long	0xeb2c
+	.long	0x61b3
+	.uleb128 0x1
+	.long	0xeb31
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF813
+	.byte	0x2
+	.byte	0xec
+	.byte	0x7
+	.long	.LASF837
+	.long	0xeb1d
+	.long	0x61cd
+	.uleb128 0x1
+	.long	0xeb22
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF816
+	.byte	0x2
+	.byte	0xee
+	.byte	0xd
+	.long	0xeadc
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF817
+	.long	0xacc0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xeadc
+	.byte	0
+	.uleb128 0xa
+	.long	0x60f1
+	.uleb128 0x3a
+	.long	.LASF838
+	.byte	0x8
+	.byte	0x2
+	.value	0x102
+	.byte	0xc
+	.long	0x636b
+	.uleb128 0x34
+	.long	0x5fcb
+	.uleb128 0x3b
+	.long	0x60f1
+	.byte	0
+	.byte	0x3
+	.uleb128 0x14
+	.long	.LASF813
+	.byte	0x2
+	.value	0x10c
+	.byte	0x7
+	.long	.LASF839
+	.long	0xeb2c
+	.long	0x6228
+	.uleb128 0x1
+	.long	0xeb36
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF813
+	.byte	0x2
+	.value	0x10f
+	.byte	0x7
+	.long	.LASF840
+	.long	0xeb1d
+	.long	0x6243
+	.uleb128 0x1
+	.long	0xeb3b
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF841
+	.byte	0x2
+	.value	0x108
+	.byte	0x2f
+	.long	0x5fcb
+	.uleb128 0xa
+	.long	0x6243
+	.uleb128 0x14
+	.long	.LASF842
+	.byte	0x2
+	.value	0x112
+	.byte	0x7
+	.long	.LASF843
+	.long	0xeb40
+	.long	0x6270
+	.uleb128 0x1
+	.long	0xeb36
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF842
+	.byte	0x2
+	.value	0x115
+	.byte	0x7
+	.long	.LASF844
+	.long	0xeb45
+	.long	0x628b
+	.uleb128 0x1
+	.long	0xeb3b
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF822
+	.byte	0x2
+	.value	0x117
+	.byte	0x11
+	.long	.LASF845
+	.long	0x62a0
+	.long	0x62a6
+	.uleb128 0x2
+	.long	0xeb4a
+	.byte	0
+	.uleb128 0x69
+	.long	.LASF822
+	.byte	0x2
+	.value	0x11b
+	.byte	0x7
+	.long	.LASF846
+	.long	0x62bb
+	.long	0x62cb
+	.uleb128 0x2
+	.long	0xeb4a
+	.uleb128 0x1
+	.long	0xeb1d
+	.uleb128 0x1
+	.long	0xeaeb
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF822
+	.byte	0x2
+	.value	0x127
+	.byte	0x11
+	.long	.LASF847
+	.long	0x62e0
+	.long	0x62eb
+	.uleb128 0x2
+	.long	0xeb4a
+	.uleb128 0x1
+	.long	0xeb3b
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x2
+	.value	0x12b
+	.byte	0x14
+	.long	.LASF848
+	.long	0xeb36
+	.long	0x6304
+	.long	0x630f
+	.uleb128 0x2
+	.long	0xeb4a
+	.uleb128 0x1
+	.long	0xeb3b
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF822
+	.byte	0x2
+	.value	0x12d
+	.byte	0x7
+	.long	.LASF849
+	.long	0x6324
+	.long	0x632f
+	.uleb128 0x2
+	.long	0xeb4a
+	.uleb128 0x1
+	.long	0xeb4f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF828
+	.byte	0x2
+	.value	0x196
+	.byte	0x7
+	.long	.LASF850
+	.byte	0x2
+	.long	0x6345
+	.long	0x6350
+	.uleb128 0x2
+	.long	0xeb4a
+	.uleb128 0x1
+	.long	0xeb36
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF817
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x6a
+	.long	.LASF851
+	.uleb128 0x9
+	.long	0xeadc
+	.uleb128 0x9
+	.long	0xe675
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x61f3
+	.uleb128 0x41
+	.long	.LASF852
+	.byte	0x8
+	.byte	0x2
+	.value	0x3d5
+	.byte	0xb
+	.long	0x6444
+	.uleb128 0x3b
+	.long	0x61f3
+	.byte	0
+	.byte	0x1
+	.uleb128 0x64
+	.long	.LASF853
+	.byte	0x2
+	.value	0x40b
+	.byte	0x1d
+	.long	.LASF1084
+	.long	0xacaa
+	.uleb128 0x48
+	.long	.LASF854
+	.byte	0x2
+	.value	0x440
+	.byte	0x11
+	.long	.LASF855
+	.long	0x63ab
+	.long	0x63b6
+	.uleb128 0x2
+	.long	0xeb54
+	.uleb128 0x1
+	.long	0xeb59
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF854
+	.byte	0x2
+	.value	0x442
+	.byte	0x11
+	.long	.LASF856
+	.long	0x63cb
+	.long	0x63d6
+	.uleb128 0x2
+	.long	0xeb54
+	.uleb128 0x1
+	.long	0xeb5e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x2
+	.value	0x4f3
+	.byte	0x7
+	.long	.LASF857
+	.long	0xeb63
+	.byte	0x1
+	.long	0x63f0
+	.long	0x63fb
+	.uleb128 0x2
+	.long	0xeb54
+	.uleb128 0x1
+	.long	0x6449
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x2
+	.value	0x4fe
+	.byte	0x7
+	.long	.LASF858
+	.long	0xeb63
+	.byte	0x1
+	.long	0x6415
+	.long	0x6420
+	.uleb128 0x2
+	.long	0xeb54
+	.uleb128 0x1
+	.long	0x6455
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF58
+	.byte	0x2
+	.value	0x533
+	.byte	0x7
+	.long	.LASF859
+	.byte	0x1
+	.long	0x6436
+	.long	0x6441
+	.uleb128 0x2
+	.long	0xeb54
+	.uleb128 0x1
+	.long	0xeb63
+	.byte	0
+	.uleb128 0x9a
+	.byte	0
+	.uleb128 0xa
+	.long	0x6370
+	.uleb128 0xd
+	.long	.LASF860
+	.byte	0x7
+	.byte	0x77
+	.byte	0xb
+	.long	0x36d0
+	.uleb128 0xd
+	.long	.LASF860
+	.byte	0x7
+	.byte	0x77
+	.byte	0xb
+	.long	0x36dc
+	.uleb128 0x1d
+	.long	.LASF861
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xe7
+	.byte	0xc
+	.long	0x64ca
+	.uleb128 0x34
+	.long	0x5d05
+	.uleb128 0x47
+	.long	.LASF862
+	.byte	0x2e
+	.byte	0xea
+	.byte	0x7
+	.long	.LASF863
+	.long	0x6487
+	.long	0x6492
+	.uleb128 0x2
+	.long	0xeb81
+	.uleb128 0x1
+	.long	0xeb86
+	.byte	0
+	.uleb128 0xc3
+	.long	.LASF53
+	.byte	0x2e
+	.byte	0xeb
+	.byte	0x18
+	.long	.LASF864
+	.long	0xeb8b
+	.byte	0x1
+	.long	0x64ac
+	.long	0x64b7
+	.uleb128 0x2
+	.long	0xeb81
+	.uleb128 0x1
+	.long	0xeb86
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xe777
+	.uleb128 0xe
+	.string	"_Dp"
+	.long	0xe675
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF865
+	.byte	0x1
+	.byte	0x7
+	.value	0x66c
+	.byte	0xc
+	.long	0x64ef
+	.uleb128 0x21
+	.long	.LASF482
+	.byte	0x7
+	.value	0x66d
+	.byte	0x16
+	.long	0xeb90
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xe777
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF866
+	.byte	0x8
+	.byte	0x2e
+	.value	0x10d
+	.byte	0xb
+	.long	0x6730
+	.uleb128 0x3f
+	.long	.LASF805
+	.byte	0x2e
+	.value	0x113
+	.byte	0x21
+	.long	0x6461
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF867
+	.byte	0x2e
+	.value	0x166
+	.byte	0x7
+	.long	.LASF868
+	.long	0x6520
+	.long	0x652b
+	.uleb128 0x2
+	.long	0xeb95
+	.uleb128 0x1
+	.long	0xeb9a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF869
+	.byte	0x2e
+	.value	0x186
+	.byte	0x7
+	.long	.LASF870
+	.byte	0x1
+	.long	0x6541
+	.long	0x654c
+	.uleb128 0x2
+	.long	0xeb95
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xc4
+	.long	.LASF53
+	.byte	0x2e
+	.value	0x196
+	.byte	0x13
+	.long	.LASF872
+	.long	0xeb9f
+	.byte	0x1
+	.byte	0x1
+	.long	0x6568
+	.long	0x6573
+	.uleb128 0x2
+	.long	0xeb95
+	.uleb128 0x1
+	.long	0xeb9a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x2e
+	.value	0x1b0
+	.byte	0x7
+	.long	.LASF873
+	.long	0xeb9f
+	.byte	0x1
+	.long	0x658d
+	.long	0x6598
+	.uleb128 0x2
+	.long	0xeb95
+	.uleb128 0x1
+	.long	0x575
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF874
+	.byte	0x2e
+	.value	0x1bb
+	.byte	0x7
+	.long	.LASF875
+	.long	0x64d8
+	.byte	0x1
+	.long	0x65b2
+	.long	0x65b8
+	.uleb128 0x2
+	.long	0xeba4
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF220
+	.byte	0x2e
+	.value	0x116
+	.byte	0xd
+	.long	0x5d78
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF876
+	.byte	0x2e
+	.value	0x1c4
+	.byte	0x7
+	.long	.LASF877
+	.long	0x65b8
+	.byte	0x1
+	.long	0x65e0
+	.long	0x65e6
+	.uleb128 0x2
+	.long	0xeba4
+	.byte	0
+	.uleb128 0x4b
+	.string	"get"
+	.byte	0x2e
+	.value	0x1cd
+	.long	.LASF878
+	.long	0x65b8
+	.long	0x65fe
+	.long	0x6604
+	.uleb128 0x2
+	.long	0xeba4
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF879
+	.byte	0x2e
+	.value	0x118
+	.byte	0xd
+	.long	0xe675
+	.byte	0x1
+	.uleb128 0xa
+	.long	0x6604
+	.uleb128 0x3
+	.long	.LASF880
+	.byte	0x2e
+	.value	0x1d3
+	.byte	0x7
+	.long	.LASF881
+	.long	0xeba9
+	.byte	0x1
+	.long	0x6631
+	.long	0x6637
+	.uleb128 0x2
+	.long	0xeb95
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF880
+	.byte	0x2e
+	.value	0x1d9
+	.byte	0x7
+	.long	.LASF882
+	.long	0xebae
+	.byte	0x1
+	.long	0x6651
+	.long	0x6657
+	.uleb128 0x2
+	.long	0xeba4
+	.byte	0
+	.uleb128 0xc5
+	.long	.LASF107
+	.byte	0x2e
+	.value	0x1de
+	.byte	0x10
+	.long	.LASF883
+	.long	0xacaa
+	.byte	0x1
+	.long	0x6672
+	.long	0x6678
+	.uleb128 0x2
+	.long	0xeba4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF487
+	.byte	0x2e
+	.value	0x1e6
+	.byte	0x7
+	.long	.LASF884
+	.long	0x65b8
+	.byte	0x1
+	.long	0x6692
+	.long	0x6698
+	.uleb128 0x2
+	.long	0xeb95
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF801
+	.byte	0x2e
+	.value	0x1f1
+	.byte	0x7
+	.long	.LASF885
+	.byte	0x1
+	.long	0x66ae
+	.long	0x66b9
+	.uleb128 0x2
+	.long	0xeb95
+	.uleb128 0x1
+	.long	0x65b8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF58
+	.byte	0x2e
+	.value	0x1fb
+	.byte	0x7
+	.long	.LASF886
+	.byte	0x1
+	.long	0x66cf
+	.long	0x66da
+	.uleb128 0x2
+	.long	0xeb95
+	.uleb128 0x1
+	.long	0xeb9f
+	.byte	0
+	.uleb128 0x73
+	.long	.LASF867
+	.byte	0x2e
+	.value	0x202
+	.long	.LASF887
+	.long	0x66ee
+	.long	0x66f9
+	.uleb128 0x2
+	.long	0xeb95
+	.uleb128 0x1
+	.long	0xebb3
+	.byte	0
+	.uleb128 0x62
+	.long	.LASF53
+	.byte	0x2e
+	.value	0x203
+	.byte	0x13
+	.long	.LASF888
+	.long	0xeb9f
+	.long	0x6712
+	.long	0x671d
+	.uleb128 0x2
+	.long	0xeb95
+	.uleb128 0x1
+	.long	0xebb3
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xe777
+	.uleb128 0xe
+	.string	"_Dp"
+	.long	0xe675
+	.byte	0
+	.uleb128 0xa
+	.long	0x64ef
+	.uleb128 0x6b
+	.long	.LASF1948
+	.byte	0x1
+	.byte	0x1
+	.byte	0x23
+	.byte	0xc4
+	.byte	0xc
+	.long	0x6bd6
+	.uleb128 0x87
+	.long	.LASF738
+	.byte	0x23
+	.byte	0xca
+	.byte	0x1c
+	.long	.LASF889
+	.long	0xacf9
+	.uleb128 0x87
+	.long	.LASF584
+	.byte	0x23
+	.byte	0xce
+	.byte	0x1c
+	.long	.LASF890
+	.long	0xacf9
+	.uleb128 0x6c
+	.long	.LASF587
+	.byte	0x23
+	.byte	0xd1
+	.byte	0x21
+	.long	0xd7c0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF574
+	.byte	0x23
+	.byte	0xe1
+	.byte	0x7
+	.long	.LASF891
+	.long	0x6787
+	.long	0x678d
+	.uleb128 0x2
+	.long	0xebd6
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF576
+	.byte	0x23
+	.byte	0xe2
+	.byte	0x7
+	.long	.LASF892
+	.long	0x67a1
+	.long	0x67ac
+	.uleb128 0x2
+	.long	0xebd6
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x66
+	.long	.LASF574
+	.byte	0x23
+	.byte	0xe3
+	.byte	0x7
+	.long	.LASF893
+	.long	0x67c0
+	.long	0x67cb
+	.uleb128 0x2
+	.long	0xebd6
+	.uleb128 0x1
+	.long	0xebdb
+	.byte	0
+	.uleb128 0x86
+	.long	.LASF53
+	.byte	0x23
+	.byte	0xe4
+	.byte	0xf
+	.long	.LASF894
+	.long	0xebe0
+	.long	0x67e4
+	.long	0x67ef
+	.uleb128 0x2
+	.long	0xebd6
+	.uleb128 0x1
+	.long	0xebdb
+	.byte	0
+	.uleb128 0x86
+	.long	.LASF53
+	.byte	0x23
+	.byte	0xe5
+	.byte	0xf
+	.long	.LASF895
+	.long	0xebe0
+	.long	0x6808
+	.long	0x6813
+	.uleb128 0x2
+	.long	0xebe5
+	.uleb128 0x1
+	.long	0xebdb
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF574
+	.byte	0x23
+	.byte	0xe7
+	.byte	0x11
+	.long	.LASF896
+	.byte	0x1
+	.long	0x6828
+	.long	0x6833
+	.uleb128 0x2
+	.long	0xebd6
+	.uleb128 0x1
+	.long	0xd7c0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF897
+	.byte	0x23
+	.byte	0xe9
+	.byte	0x7
+	.long	.LASF898
+	.long	0xd7c0
+	.byte	0x1
+	.long	0x684c
+	.long	0x6852
+	.uleb128 0x2
+	.long	0xebea
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF897
+	.byte	0x23
+	.byte	0xec
+	.byte	0x7
+	.long	.LASF899
+	.long	0xd7c0
+	.byte	0x1
+	.long	0x686b
+	.long	0x6871
+	.uleb128 0x2
+	.long	0xebef
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF53
+	.byte	0x23
+	.byte	0xf0
+	.byte	0x7
+	.long	.LASF900
+	.long	0xd7c0
+	.byte	0x1
+	.long	0x688a
+	.long	0x6895
+	.uleb128 0x2
+	.long	0xebd6
+	.uleb128 0x1
+	.long	0xd7c0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF53
+	.byte	0x23
+	.byte	0xf4
+	.byte	0x7
+	.long	.LASF901
+	.long	0xd7c0
+	.byte	0x1
+	.long	0x68ae
+	.long	0x68b9
+	.uleb128 0x2
+	.long	0xebe5
+	.uleb128 0x1
+	.long	0xd7c0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF528
+	.byte	0x23
+	.byte	0xf8
+	.byte	0x7
+	.long	.LASF902
+	.long	0xacaa
+	.byte	0x1
+	.long	0x68d2
+	.long	0x68d8
+	.uleb128 0x2
+	.long	0xebea
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF528
+	.byte	0x23
+	.value	0x100
+	.byte	0x7
+	.long	.LASF903
+	.long	0xacaa
+	.byte	0x1
+	.long	0x68f2
+	.long	0x68f8
+	.uleb128 0x2
+	.long	0xebef
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF531
+	.byte	0x23
+	.value	0x10d
+	.byte	0x7
+	.long	.LASF904
+	.byte	0x1
+	.long	0x690e
+	.long	0x691e
+	.uleb128 0x2
+	.long	0xebd6
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF531
+	.byte	0x23
+	.value	0x113
+	.byte	0x7
+	.long	.LASF905
+	.byte	0x1
+	.long	0x6934
+	.long	0x6944
+	.uleb128 0x2
+	.long	0xebe5
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF534
+	.byte	0x23
+	.value	0x119
+	.byte	0x7
+	.long	.LASF906
+	.long	0xd7c0
+	.byte	0x1
+	.long	0x695e
+	.long	0x6969
+	.uleb128 0x2
+	.long	0xebea
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF534
+	.byte	0x23
+	.value	0x122
+	.byte	0x7
+	.long	.LASF907
+	.long	0xd7c0
+	.byte	0x1
+	.long	0x6983
+	.long	0x698e
+	.uleb128 0x2
+	.long	0xebef
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF537
+	.byte	0x23
+	.value	0x12b
+	.byte	0x7
+	.long	.LASF908
+	.long	0xd7c0
+	.byte	0x1
+	.long	0x69a8
+	.long	0x69b8
+	.uleb128 0x2
+	.long	0xebd6
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF537
+	.byte	0x23
+	.value	0x135
+	.byte	0x7
+	.long	.LASF909
+	.long	0xd7c0
+	.byte	0x1
+	.long	0x69d2
+	.long	0x69e2
+	.uleb128 0x2
+	.long	0xebe5
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x140
+	.byte	0x7
+	.long	.LASF910
+	.long	0xacaa
+	.byte	0x1
+	.long	0x69fc
+	.long	0x6a16
+	.uleb128 0x2
+	.long	0xebd6
+	.uleb128 0x1
+	.long	0xebf4
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x14c
+	.byte	0x7
+	.long	.LASF911
+	.long	0xacaa
+	.byte	0x1
+	.long	0x6a30
+	.long	0x6a4a
+	.uleb128 0x2
+	.long	0xebe5
+	.uleb128 0x1
+	.long	0xebf4
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x158
+	.byte	0x7
+	.long	.LASF912
+	.long	0xacaa
+	.byte	0x1
+	.long	0x6a64
+	.long	0x6a79
+	.uleb128 0x2
+	.long	0xebd6
+	.uleb128 0x1
+	.long	0xebf4
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x15e
+	.byte	0x7
+	.long	.LASF913
+	.long	0xacaa
+	.byte	0x1
+	.long	0x6a93
+	.long	0x6aa8
+	.uleb128 0x2
+	.long	0xebe5
+	.uleb128 0x1
+	.long	0xebf4
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x164
+	.byte	0x7
+	.long	.LASF914
+	.long	0xacaa
+	.byte	0x1
+	.long	0x6ac2
+	.long	0x6adc
+	.uleb128 0x2
+	.long	0xebd6
+	.uleb128 0x1
+	.long	0xebf4
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x170
+	.byte	0x7
+	.long	.LASF915
+	.long	0xacaa
+	.byte	0x1
+	.long	0x6af6
+	.long	0x6b10
+	.uleb128 0x2
+	.long	0xebe5
+	.uleb128 0x1
+	.long	0xebf4
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x17c
+	.byte	0x7
+	.long	.LASF916
+	.long	0xacaa
+	.byte	0x1
+	.long	0x6b2a
+	.long	0x6b3f
+	.uleb128 0x2
+	.long	0xebd6
+	.uleb128 0x1
+	.long	0xebf4
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x182
+	.byte	0x7
+	.long	.LASF917
+	.long	0xacaa
+	.byte	0x1
+	.long	0x6b59
+	.long	0x6b6e
+	.uleb128 0x2
+	.long	0xebe5
+	.uleb128 0x1
+	.long	0xebf4
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF550
+	.byte	0x23
+	.value	0x189
+	.byte	0x5
+	.long	.LASF918
+	.byte	0x1
+	.long	0x6b84
+	.long	0x6b94
+	.uleb128 0x2
+	.long	0xebea
+	.uleb128 0x1
+	.long	0xd7c0
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x23
+	.value	0x192
+	.byte	0x5
+	.long	.LASF919
+	.byte	0x1
+	.long	0x6baa
+	.long	0x6bb0
+	.uleb128 0x2
+	.long	0xebd6
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x23
+	.value	0x196
+	.byte	0x5
+	.long	.LASF920
+	.byte	0x1
+	.long	0x6bc6
+	.long	0x6bcc
+	.uleb128 0x2
+	.long	0xebd6
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xd7c0
+	.byte	0
+	.uleb128 0xa
+	.long	0x6735
+	.uleb128 0x3c
+	.long	0x6735
+	.uleb128 0x3c
+	.long	0x6bd6
+	.uleb128 0x3a
+	.long	.LASF921
+	.byte	0x8
+	.byte	0x22
+	.value	0x29d
+	.byte	0xc
+	.long	0x7234
+	.uleb128 0x24
+	.long	.LASF922
+	.byte	0x22
+	.value	0x2a0
+	.byte	0x16
+	.long	0xebf9
+	.byte	0x3
+	.uleb128 0x57
+	.long	.LASF235
+	.byte	0x22
+	.value	0x2a2
+	.byte	0x17
+	.long	0x6bf3
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF923
+	.byte	0x22
+	.value	0x2a6
+	.byte	0x7
+	.long	.LASF924
+	.long	0xb0e
+	.byte	0x3
+	.long	0x6c29
+	.long	0x6c34
+	.uleb128 0x2
+	.long	0xebfe
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF923
+	.byte	0x22
+	.value	0x2a9
+	.byte	0x7
+	.long	.LASF925
+	.long	0xb0e
+	.byte	0x3
+	.long	0x6c4e
+	.long	0x6c59
+	.uleb128 0x2
+	.long	0xec03
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF491
+	.byte	0x22
+	.value	0x2ac
+	.byte	0x7
+	.long	.LASF926
+	.long	0x6c6e
+	.long	0x6c74
+	.uleb128 0x2
+	.long	0xec08
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF493
+	.byte	0x22
+	.value	0x2ad
+	.byte	0x7
+	.long	.LASF927
+	.long	0x6c89
+	.long	0x6c94
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF491
+	.byte	0x22
+	.value	0x2ae
+	.long	.LASF928
+	.long	0x6ca8
+	.long	0x6cb3
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0xec0d
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x22
+	.value	0x2af
+	.byte	0x16
+	.long	.LASF929
+	.long	0xec12
+	.long	0x6ccc
+	.long	0x6cd7
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0xec0d
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x22
+	.value	0x2b0
+	.byte	0x16
+	.long	.LASF930
+	.long	0xec12
+	.long	0x6cf0
+	.long	0x6cfb
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0xec0d
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF491
+	.byte	0x22
+	.value	0x2b3
+	.byte	0x11
+	.long	.LASF931
+	.long	0x6d10
+	.long	0x6d1b
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0x6bf3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF932
+	.byte	0x22
+	.value	0x2b5
+	.byte	0x7
+	.long	.LASF933
+	.long	0x6bf3
+	.long	0x6d34
+	.long	0x6d3a
+	.uleb128 0x2
+	.long	0xebfe
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF932
+	.byte	0x22
+	.value	0x2b8
+	.byte	0x7
+	.long	.LASF934
+	.long	0x6bf3
+	.long	0x6d53
+	.long	0x6d59
+	.uleb128 0x2
+	.long	0xec03
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x22
+	.value	0x2bc
+	.byte	0x7
+	.long	.LASF935
+	.long	0x6bf3
+	.long	0x6d72
+	.long	0x6d7d
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0x6bf3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x22
+	.value	0x2c3
+	.byte	0x7
+	.long	.LASF936
+	.long	0x6bf3
+	.long	0x6d96
+	.long	0x6da1
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0x6bf3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x2ca
+	.byte	0x7
+	.long	.LASF937
+	.long	0x6bf3
+	.long	0x6dba
+	.long	0x6dc5
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x2ce
+	.byte	0x7
+	.long	.LASF938
+	.long	0x6bf3
+	.long	0x6dde
+	.long	0x6de9
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x2d2
+	.byte	0x7
+	.long	.LASF939
+	.long	0x6bf3
+	.long	0x6e02
+	.long	0x6e0d
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x2d6
+	.byte	0x7
+	.long	.LASF940
+	.long	0x6bf3
+	.long	0x6e26
+	.long	0x6e31
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x2da
+	.byte	0x7
+	.long	.LASF941
+	.long	0x6bf3
+	.long	0x6e4a
+	.long	0x6e50
+	.uleb128 0x2
+	.long	0xec08
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x2df
+	.byte	0x7
+	.long	.LASF942
+	.long	0x6bf3
+	.long	0x6e69
+	.long	0x6e6f
+	.uleb128 0x2
+	.long	0xec17
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x2e4
+	.byte	0x7
+	.long	.LASF943
+	.long	0x6bf3
+	.long	0x6e88
+	.long	0x6e8e
+	.uleb128 0x2
+	.long	0xec08
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x2e9
+	.byte	0x7
+	.long	.LASF944
+	.long	0x6bf3
+	.long	0x6ea7
+	.long	0x6ead
+	.uleb128 0x2
+	.long	0xec17
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF362
+	.byte	0x22
+	.value	0x2ee
+	.byte	0x7
+	.long	.LASF945
+	.long	0x6bf3
+	.long	0x6ec6
+	.long	0x6ed1
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF362
+	.byte	0x22
+	.value	0x2f3
+	.byte	0x7
+	.long	.LASF946
+	.long	0x6bf3
+	.long	0x6eea
+	.long	0x6ef5
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF516
+	.byte	0x22
+	.value	0x2f8
+	.byte	0x7
+	.long	.LASF947
+	.long	0x6bf3
+	.long	0x6f0e
+	.long	0x6f19
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF516
+	.byte	0x22
+	.value	0x2fd
+	.byte	0x7
+	.long	.LASF948
+	.long	0x6bf3
+	.long	0x6f32
+	.long	0x6f3d
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF528
+	.byte	0x22
+	.value	0x302
+	.byte	0x7
+	.long	.LASF949
+	.long	0xacaa
+	.long	0x6f56
+	.long	0x6f5c
+	.uleb128 0x2
+	.long	0xebfe
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF528
+	.byte	0x22
+	.value	0x30a
+	.byte	0x7
+	.long	.LASF950
+	.long	0xacaa
+	.long	0x6f75
+	.long	0x6f7b
+	.uleb128 0x2
+	.long	0xec03
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x22
+	.value	0x312
+	.byte	0x7
+	.long	.LASF951
+	.long	0x6f90
+	.long	0x6fa0
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0x6bf3
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x22
+	.value	0x320
+	.byte	0x7
+	.long	.LASF952
+	.long	0x6fb5
+	.long	0x6fc5
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0x6bf3
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x22
+	.value	0x32d
+	.byte	0x7
+	.long	.LASF953
+	.long	0x6bf3
+	.long	0x6fde
+	.long	0x6fe9
+	.uleb128 0x2
+	.long	0xebfe
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x22
+	.value	0x338
+	.byte	0x7
+	.long	.LASF954
+	.long	0x6bf3
+	.long	0x7002
+	.long	0x700d
+	.uleb128 0x2
+	.long	0xec03
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x22
+	.value	0x343
+	.byte	0x7
+	.long	.LASF955
+	.long	0x6bf3
+	.long	0x7026
+	.long	0x7036
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0x6bf3
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x22
+	.value	0x34b
+	.byte	0x7
+	.long	.LASF956
+	.long	0x6bf3
+	.long	0x704f
+	.long	0x705f
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0x6bf3
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x352
+	.byte	0x7
+	.long	.LASF957
+	.long	0xacaa
+	.long	0x7078
+	.long	0x7092
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0xec1c
+	.uleb128 0x1
+	.long	0x6bf3
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x35d
+	.byte	0x7
+	.long	.LASF958
+	.long	0xacaa
+	.long	0x70ab
+	.long	0x70c5
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0xec1c
+	.uleb128 0x1
+	.long	0x6bf3
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x368
+	.byte	0x7
+	.long	.LASF959
+	.long	0xacaa
+	.long	0x70de
+	.long	0x70f8
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0xec1c
+	.uleb128 0x1
+	.long	0x6bf3
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x373
+	.byte	0x7
+	.long	.LASF960
+	.long	0xacaa
+	.long	0x7111
+	.long	0x712b
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0xec1c
+	.uleb128 0x1
+	.long	0x6bf3
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF550
+	.byte	0x22
+	.value	0x37f
+	.byte	0x7
+	.long	.LASF961
+	.long	0x7140
+	.long	0x7150
+	.uleb128 0x2
+	.long	0xebfe
+	.uleb128 0x1
+	.long	0x6bf3
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF552
+	.byte	0x22
+	.value	0x38a
+	.byte	0x7
+	.long	.LASF962
+	.long	0x7165
+	.long	0x716b
+	.uleb128 0x2
+	.long	0xebfe
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF554
+	.byte	0x22
+	.value	0x390
+	.byte	0x7
+	.long	.LASF963
+	.long	0x7180
+	.long	0x7186
+	.uleb128 0x2
+	.long	0xebfe
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF556
+	.byte	0x22
+	.value	0x397
+	.byte	0x7
+	.long	.LASF964
+	.long	0x6bf3
+	.long	0x719f
+	.long	0x71af
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF556
+	.byte	0x22
+	.value	0x39c
+	.byte	0x7
+	.long	.LASF965
+	.long	0x6bf3
+	.long	0x71c8
+	.long	0x71d8
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF559
+	.byte	0x22
+	.value	0x3a1
+	.byte	0x7
+	.long	.LASF966
+	.long	0x6bf3
+	.long	0x71f1
+	.long	0x7201
+	.uleb128 0x2
+	.long	0xec08
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF559
+	.byte	0x22
+	.value	0x3a6
+	.byte	0x7
+	.long	.LASF967
+	.long	0x6bf3
+	.long	0x721a
+	.long	0x722a
+	.uleb128 0x2
+	.long	0xec17
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF571
+	.long	0xebf9
+	.byte	0
+	.uleb128 0xa
+	.long	0x6be5
+	.uleb128 0x3c
+	.long	0x6be5
+	.uleb128 0xa
+	.long	0x7239
+	.uleb128 0x41
+	.long	.LASF968
+	.byte	0x8
+	.byte	0x23
+	.value	0x19f
+	.byte	0xc
+	.long	0x7936
+	.uleb128 0x24
+	.long	.LASF969
+	.byte	0x23
+	.value	0x1a5
+	.byte	0x23
+	.long	0x6be5
+	.byte	0x1
+	.uleb128 0x57
+	.long	.LASF970
+	.byte	0x23
+	.value	0x1a6
+	.byte	0x15
+	.long	0x7251
+	.byte	0x1
+	.uleb128 0x48
+	.long	.LASF574
+	.byte	0x23
+	.value	0x1a8
+	.byte	0x7
+	.long	.LASF971
+	.long	0x7282
+	.long	0x7288
+	.uleb128 0x2
+	.long	0xec21
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF576
+	.byte	0x23
+	.value	0x1a9
+	.byte	0x7
+	.long	.LASF972
+	.long	0x729d
+	.long	0x72a8
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x73
+	.long	.LASF574
+	.byte	0x23
+	.value	0x1aa
+	.long	.LASF973
+	.long	0x72bc
+	.long	0x72c7
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xec26
+	.byte	0
+	.uleb128 0x62
+	.long	.LASF53
+	.byte	0x23
+	.value	0x1ab
+	.byte	0xf
+	.long	.LASF974
+	.long	0xec2b
+	.long	0x72e0
+	.long	0x72eb
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xec26
+	.byte	0
+	.uleb128 0x62
+	.long	.LASF53
+	.byte	0x23
+	.value	0x1ac
+	.byte	0xf
+	.long	.LASF975
+	.long	0xec2b
+	.long	0x7304
+	.long	0x730f
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0xec26
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF574
+	.byte	0x23
+	.value	0x1ae
+	.byte	0x11
+	.long	.LASF976
+	.byte	0x1
+	.long	0x7325
+	.long	0x7330
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0x7330
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF922
+	.byte	0x23
+	.value	0x1a4
+	.byte	0x17
+	.long	0xebf9
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF977
+	.byte	0x23
+	.value	0x1b0
+	.byte	0x7
+	.long	.LASF978
+	.long	0x7330
+	.byte	0x1
+	.long	0x7358
+	.long	0x735e
+	.uleb128 0x2
+	.long	0xec35
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF977
+	.byte	0x23
+	.value	0x1b3
+	.byte	0x7
+	.long	.LASF979
+	.long	0x7330
+	.byte	0x1
+	.long	0x7378
+	.long	0x737e
+	.uleb128 0x2
+	.long	0xec3a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x23
+	.value	0x1b7
+	.byte	0x7
+	.long	.LASF980
+	.long	0x7330
+	.byte	0x1
+	.long	0x7398
+	.long	0x73a3
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0x7330
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x23
+	.value	0x1bb
+	.byte	0x7
+	.long	.LASF981
+	.long	0x7330
+	.byte	0x1
+	.long	0x73bd
+	.long	0x73c8
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0x7330
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x23
+	.value	0x1bf
+	.byte	0x7
+	.long	.LASF982
+	.long	0x7330
+	.byte	0x1
+	.long	0x73e2
+	.long	0x73ed
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x23
+	.value	0x1c8
+	.byte	0x7
+	.long	.LASF983
+	.long	0x7330
+	.byte	0x1
+	.long	0x7407
+	.long	0x7412
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x23
+	.value	0x1d1
+	.byte	0x7
+	.long	.LASF984
+	.long	0x7330
+	.byte	0x1
+	.long	0x742c
+	.long	0x7437
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x23
+	.value	0x1da
+	.byte	0x7
+	.long	.LASF985
+	.long	0x7330
+	.byte	0x1
+	.long	0x7451
+	.long	0x745c
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x23
+	.value	0x1e3
+	.byte	0x7
+	.long	.LASF986
+	.long	0x7330
+	.byte	0x1
+	.long	0x7476
+	.long	0x747c
+	.uleb128 0x2
+	.long	0xec21
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x23
+	.value	0x1ec
+	.byte	0x7
+	.long	.LASF987
+	.long	0x7330
+	.byte	0x1
+	.long	0x7496
+	.long	0x749c
+	.uleb128 0x2
+	.long	0xec30
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x23
+	.value	0x1f5
+	.byte	0x7
+	.long	.LASF988
+	.long	0x7330
+	.byte	0x1
+	.long	0x74b6
+	.long	0x74bc
+	.uleb128 0x2
+	.long	0xec21
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x23
+	.value	0x1fe
+	.byte	0x7
+	.long	.LASF989
+	.long	0x7330
+	.byte	0x1
+	.long	0x74d6
+	.long	0x74dc
+	.uleb128 0x2
+	.long	0xec30
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF362
+	.byte	0x23
+	.value	0x207
+	.byte	0x7
+	.long	.LASF990
+	.long	0x7330
+	.byte	0x1
+	.long	0x74f6
+	.long	0x7501
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF362
+	.byte	0x23
+	.value	0x210
+	.byte	0x7
+	.long	.LASF991
+	.long	0x7330
+	.byte	0x1
+	.long	0x751b
+	.long	0x7526
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF516
+	.byte	0x23
+	.value	0x219
+	.byte	0x7
+	.long	.LASF992
+	.long	0x7330
+	.byte	0x1
+	.long	0x7540
+	.long	0x754b
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF516
+	.byte	0x23
+	.value	0x222
+	.byte	0x7
+	.long	.LASF993
+	.long	0x7330
+	.byte	0x1
+	.long	0x7565
+	.long	0x7570
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF528
+	.byte	0x23
+	.value	0x22b
+	.byte	0x7
+	.long	.LASF994
+	.long	0xacaa
+	.byte	0x1
+	.long	0x758a
+	.long	0x7590
+	.uleb128 0x2
+	.long	0xec35
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF528
+	.byte	0x23
+	.value	0x22f
+	.byte	0x7
+	.long	.LASF995
+	.long	0xacaa
+	.byte	0x1
+	.long	0x75aa
+	.long	0x75b0
+	.uleb128 0x2
+	.long	0xec3a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF531
+	.byte	0x23
+	.value	0x238
+	.byte	0x7
+	.long	.LASF996
+	.byte	0x1
+	.long	0x75c6
+	.long	0x75d6
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF531
+	.byte	0x23
+	.value	0x23d
+	.byte	0x7
+	.long	.LASF997
+	.byte	0x1
+	.long	0x75ec
+	.long	0x75fc
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF534
+	.byte	0x23
+	.value	0x242
+	.byte	0x7
+	.long	.LASF998
+	.long	0x7330
+	.byte	0x1
+	.long	0x7616
+	.long	0x7621
+	.uleb128 0x2
+	.long	0xec35
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF534
+	.byte	0x23
+	.value	0x246
+	.byte	0x7
+	.long	.LASF999
+	.long	0x7330
+	.byte	0x1
+	.long	0x763b
+	.long	0x7646
+	.uleb128 0x2
+	.long	0xec3a
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF537
+	.byte	0x23
+	.value	0x24a
+	.byte	0x7
+	.long	.LASF1000
+	.long	0x7330
+	.byte	0x1
+	.long	0x7660
+	.long	0x7670
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF537
+	.byte	0x23
+	.value	0x24f
+	.byte	0x7
+	.long	.LASF1001
+	.long	0x7330
+	.byte	0x1
+	.long	0x768a
+	.long	0x769a
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x254
+	.byte	0x7
+	.long	.LASF1002
+	.long	0xacaa
+	.byte	0x1
+	.long	0x76b4
+	.long	0x76ce
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xec3f
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x259
+	.byte	0x7
+	.long	.LASF1003
+	.long	0xacaa
+	.byte	0x1
+	.long	0x76e8
+	.long	0x7702
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0xec3f
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x25f
+	.byte	0x7
+	.long	.LASF1004
+	.long	0xacaa
+	.byte	0x1
+	.long	0x771c
+	.long	0x7731
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xec3f
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x267
+	.byte	0x7
+	.long	.LASF1005
+	.long	0xacaa
+	.byte	0x1
+	.long	0x774b
+	.long	0x7760
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0xec3f
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x26f
+	.byte	0x7
+	.long	.LASF1006
+	.long	0xacaa
+	.byte	0x1
+	.long	0x777a
+	.long	0x7794
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xec3f
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x274
+	.byte	0x7
+	.long	.LASF1007
+	.long	0xacaa
+	.byte	0x1
+	.long	0x77ae
+	.long	0x77c8
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0xec3f
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x27a
+	.byte	0x7
+	.long	.LASF1008
+	.long	0xacaa
+	.byte	0x1
+	.long	0x77e2
+	.long	0x77f7
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xec3f
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x282
+	.byte	0x7
+	.long	.LASF1009
+	.long	0xacaa
+	.byte	0x1
+	.long	0x7811
+	.long	0x7826
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0xec3f
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF550
+	.byte	0x23
+	.value	0x28b
+	.byte	0x5
+	.long	.LASF1010
+	.byte	0x1
+	.long	0x783c
+	.long	0x784c
+	.uleb128 0x2
+	.long	0xec35
+	.uleb128 0x1
+	.long	0x7330
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x23
+	.value	0x291
+	.byte	0x5
+	.long	.LASF1011
+	.byte	0x1
+	.long	0x7862
+	.long	0x7868
+	.uleb128 0x2
+	.long	0xec21
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x23
+	.value	0x295
+	.byte	0x5
+	.long	.LASF1012
+	.byte	0x1
+	.long	0x787e
+	.long	0x7884
+	.uleb128 0x2
+	.long	0xec21
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF556
+	.byte	0x23
+	.value	0x29a
+	.byte	0x7
+	.long	.LASF1013
+	.long	0x7330
+	.byte	0x1
+	.long	0x789e
+	.long	0x78ae
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF556
+	.byte	0x23
+	.value	0x2a4
+	.byte	0x7
+	.long	.LASF1014
+	.long	0x7330
+	.byte	0x1
+	.long	0x78c8
+	.long	0x78d8
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF559
+	.byte	0x23
+	.value	0x2ae
+	.byte	0x7
+	.long	.LASF1015
+	.long	0x7330
+	.byte	0x1
+	.long	0x78f2
+	.long	0x7902
+	.uleb128 0x2
+	.long	0xec21
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF559
+	.byte	0x23
+	.value	0x2b8
+	.byte	0x7
+	.long	.LASF1016
+	.long	0x7330
+	.byte	0x1
+	.long	0x791c
+	.long	0x792c
+	.uleb128 0x2
+	.long	0xec30
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xebf9
+	.byte	0
+	.uleb128 0xa
+	.long	0x7243
+	.uleb128 0x3c
+	.long	0x7243
+	.uleb128 0xa
+	.long	0x793b
+	.uleb128 0x29
+	.long	.LASF1017
+	.byte	0x1
+	.byte	0x18
+	.byte	0x38
+	.byte	0xb
+	.long	0x7a10
+	.uleb128 0x1b
+	.long	.LASF94
+	.byte	0x18
+	.byte	0x50
+	.byte	0x7
+	.long	.LASF1018
+	.byte	0x1
+	.long	0x7967
+	.long	0x796d
+	.uleb128 0x2
+	.long	0xec67
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF94
+	.byte	0x18
+	.byte	0x53
+	.byte	0x7
+	.long	.LASF1019
+	.byte	0x1
+	.long	0x7982
+	.long	0x798d
+	.uleb128 0x2
+	.long	0xec67
+	.uleb128 0x1
+	.long	0xec6c
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF97
+	.byte	0x18
+	.byte	0x70
+	.byte	0x7
+	.long	.LASF1020
+	.long	0xec71
+	.byte	0x1
+	.long	0x79a6
+	.long	0x79b6
+	.uleb128 0x2
+	.long	0xec67
+	.uleb128 0x1
+	.long	0x79b6
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF115
+	.byte	0x18
+	.byte	0x3c
+	.byte	0x1f
+	.long	0x121
+	.byte	0x1
+	.uleb128 0x1b
+	.long	.LASF99
+	.byte	0x18
+	.byte	0x8e
+	.byte	0x7
+	.long	.LASF1021
+	.byte	0x1
+	.long	0x79d8
+	.long	0x79e8
+	.uleb128 0x2
+	.long	0xec67
+	.uleb128 0x1
+	.long	0xec71
+	.uleb128 0x1
+	.long	0x79b6
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF101
+	.byte	0x18
+	.byte	0xd2
+	.byte	0x7
+	.long	.LASF1022
+	.long	0x79b6
+	.long	0x7a00
+	.long	0x7a06
+	.uleb128 0x2
+	.long	0xec76
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xa
+	.long	0x7945
+	.uleb128 0x29
+	.long	.LASF1023
+	.byte	0x1
+	.byte	0x19
+	.byte	0x7c
+	.byte	0xb
+	.long	0x7aed
+	.uleb128 0x3b
+	.long	0x7945
+	.byte	0
+	.byte	0x1
+	.uleb128 0x1b
+	.long	.LASF104
+	.byte	0x19
+	.byte	0x9c
+	.byte	0x7
+	.long	.LASF1024
+	.byte	0x1
+	.long	0x7a3e
+	.long	0x7a44
+	.uleb128 0x2
+	.long	0xec7b
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF104
+	.byte	0x19
+	.byte	0x9f
+	.byte	0x7
+	.long	.LASF1025
+	.byte	0x1
+	.long	0x7a59
+	.long	0x7a64
+	.uleb128 0x2
+	.long	0xec7b
+	.uleb128 0x1
+	.long	0xec80
+	.byte	0
+	.uleb128 0x70
+	.long	.LASF53
+	.byte	0x19
+	.byte	0xa4
+	.byte	0x12
+	.long	.LASF1026
+	.long	0xec85
+	.long	0x7a7c
+	.long	0x7a87
+	.uleb128 0x2
+	.long	0xec7b
+	.uleb128 0x1
+	.long	0xec80
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF110
+	.byte	0x19
+	.byte	0xae
+	.byte	0x7
+	.long	.LASF1027
+	.byte	0x1
+	.long	0x7a9c
+	.long	0x7aa7
+	.uleb128 0x2
+	.long	0xec7b
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF97
+	.byte	0x19
+	.byte	0xb3
+	.byte	0x7
+	.long	.LASF1028
+	.long	0xec71
+	.byte	0x1
+	.long	0x7ac0
+	.long	0x7acb
+	.uleb128 0x2
+	.long	0xec7b
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x81
+	.long	.LASF99
+	.byte	0x19
+	.byte	0xc1
+	.byte	0x7
+	.long	.LASF1029
+	.long	0x7adc
+	.uleb128 0x2
+	.long	0xec7b
+	.uleb128 0x1
+	.long	0xec71
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x7a15
+	.uleb128 0x3a
+	.long	.LASF1030
+	.byte	0x1
+	.byte	0x1c
+	.value	0x19b
+	.byte	0xc
+	.long	0x7bf0
+	.uleb128 0x21
+	.long	.LASF220
+	.byte	0x1c
+	.value	0x1a4
+	.byte	0xd
+	.long	0xec71
+	.uleb128 0x14
+	.long	.LASF97
+	.byte	0x1c
+	.value	0x1cf
+	.byte	0x7
+	.long	.LASF1031
+	.long	0x7b00
+	.long	0x7b2d
+	.uleb128 0x1
+	.long	0xec8a
+	.uleb128 0x1
+	.long	0x7b3f
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF222
+	.byte	0x1c
+	.value	0x19e
+	.byte	0xd
+	.long	0x7a15
+	.uleb128 0xa
+	.long	0x7b2d
+	.uleb128 0x21
+	.long	.LASF115
+	.byte	0x1c
+	.value	0x1b3
+	.byte	0xd
+	.long	0x121
+	.uleb128 0x14
+	.long	.LASF97
+	.byte	0x1c
+	.value	0x1dd
+	.byte	0x7
+	.long	.LASF1032
+	.long	0x7b00
+	.long	0x7b71
+	.uleb128 0x1
+	.long	0xec8a
+	.uleb128 0x1
+	.long	0x7b3f
+	.uleb128 0x1
+	.long	0x7b71
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF224
+	.byte	0x1c
+	.value	0x1ad
+	.byte	0xd
+	.long	0xad3c
+	.uleb128 0x46
+	.long	.LASF99
+	.byte	0x1c
+	.value	0x1ef
+	.byte	0x7
+	.long	.LASF1033
+	.long	0x7b9f
+	.uleb128 0x1
+	.long	0xec8a
+	.uleb128 0x1
+	.long	0x7b00
+	.uleb128 0x1
+	.long	0x7b3f
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF142
+	.byte	0x1c
+	.value	0x223
+	.byte	0x7
+	.long	.LASF1034
+	.long	0x7b3f
+	.long	0x7bba
+	.uleb128 0x1
+	.long	0xec8f
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF228
+	.byte	0x1c
+	.value	0x232
+	.byte	0x7
+	.long	.LASF1035
+	.long	0x7b2d
+	.long	0x7bd5
+	.uleb128 0x1
+	.long	0xec8f
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF8
+	.byte	0x1c
+	.value	0x1a1
+	.byte	0xd
+	.long	0xacf1
+	.uleb128 0x21
+	.long	.LASF230
+	.byte	0x1c
+	.value	0x1c2
+	.byte	0x8
+	.long	0x7a15
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1036
+	.byte	0x18
+	.byte	0x2f
+	.byte	0x55
+	.byte	0xc
+	.long	0x7f9a
+	.uleb128 0x1d
+	.long	.LASF1037
+	.byte	0x18
+	.byte	0x2f
+	.byte	0x5c
+	.byte	0xe
+	.long	0x7ca5
+	.uleb128 0xc
+	.long	.LASF1038
+	.byte	0x2f
+	.byte	0x5e
+	.byte	0xa
+	.long	0x7caa
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1039
+	.byte	0x2f
+	.byte	0x5f
+	.byte	0xa
+	.long	0x7caa
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF1040
+	.byte	0x2f
+	.byte	0x60
+	.byte	0xa
+	.long	0x7caa
+	.byte	0x10
+	.uleb128 0x1f
+	.long	.LASF1037
+	.byte	0x2f
+	.byte	0x63
+	.byte	0x2
+	.long	.LASF1041
+	.long	0x7c45
+	.long	0x7c4b
+	.uleb128 0x2
+	.long	0xec9e
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1037
+	.byte	0x2f
+	.byte	0x69
+	.byte	0x2
+	.long	.LASF1042
+	.long	0x7c5f
+	.long	0x7c6a
+	.uleb128 0x2
+	.long	0xec9e
+	.uleb128 0x1
+	.long	0xeca3
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1043
+	.byte	0x2f
+	.byte	0x71
+	.byte	0x2
+	.long	.LASF1044
+	.long	0x7c7e
+	.long	0x7c89
+	.uleb128 0x2
+	.long	0xec9e
+	.uleb128 0x1
+	.long	0xeca8
+	.byte	0
+	.uleb128 0x61
+	.long	.LASF1045
+	.byte	0x2f
+	.byte	0x7a
+	.byte	0x2
+	.long	.LASF1047
+	.long	0x7c99
+	.uleb128 0x2
+	.long	0xec9e
+	.uleb128 0x1
+	.long	0xecad
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x7bfd
+	.uleb128 0xd
+	.long	.LASF220
+	.byte	0x2f
+	.byte	0x5a
+	.byte	0x9
+	.long	0xb475
+	.uleb128 0x1d
+	.long	.LASF1048
+	.byte	0x18
+	.byte	0x2f
+	.byte	0x85
+	.byte	0xe
+	.long	0x7d65
+	.uleb128 0x34
+	.long	0x7a15
+	.uleb128 0x34
+	.long	0x7bfd
+	.uleb128 0x1f
+	.long	.LASF1048
+	.byte	0x2f
+	.byte	0x89
+	.byte	0x2
+	.long	.LASF1049
+	.long	0x7ce1
+	.long	0x7ce7
+	.uleb128 0x2
+	.long	0xecb2
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1048
+	.byte	0x2f
+	.byte	0x8f
+	.byte	0x2
+	.long	.LASF1050
+	.long	0x7cfb
+	.long	0x7d06
+	.uleb128 0x2
+	.long	0xecb2
+	.uleb128 0x1
+	.long	0xecb7
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1048
+	.byte	0x2f
+	.byte	0x97
+	.byte	0x2
+	.long	.LASF1051
+	.long	0x7d1a
+	.long	0x7d25
+	.uleb128 0x2
+	.long	0xecb2
+	.uleb128 0x1
+	.long	0xecbc
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1048
+	.byte	0x2f
+	.byte	0x9c
+	.byte	0x2
+	.long	.LASF1052
+	.long	0x7d39
+	.long	0x7d44
+	.uleb128 0x2
+	.long	0xecb2
+	.uleb128 0x1
+	.long	0xecc1
+	.byte	0
+	.uleb128 0x61
+	.long	.LASF1048
+	.byte	0x2f
+	.byte	0xa1
+	.byte	0x2
+	.long	.LASF1053
+	.long	0x7d54
+	.uleb128 0x2
+	.long	0xecb2
+	.uleb128 0x1
+	.long	0xecc1
+	.uleb128 0x1
+	.long	0xecbc
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1054
+	.byte	0x2f
+	.byte	0x58
+	.byte	0x15
+	.long	0xb4a6
+	.uleb128 0xa
+	.long	0x7d65
+	.uleb128 0x5
+	.long	.LASF1055
+	.byte	0x2f
+	.value	0x12a
+	.byte	0x7
+	.long	.LASF1056
+	.long	0xecc6
+	.long	0x7d8f
+	.long	0x7d95
+	.uleb128 0x2
+	.long	0xeccb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1055
+	.byte	0x2f
+	.value	0x12f
+	.byte	0x7
+	.long	.LASF1057
+	.long	0xecb7
+	.long	0x7dae
+	.long	0x7db4
+	.uleb128 0x2
+	.long	0xecd0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF222
+	.byte	0x2f
+	.value	0x126
+	.byte	0x16
+	.long	0x7a15
+	.uleb128 0xa
+	.long	0x7db4
+	.uleb128 0x5
+	.long	.LASF426
+	.byte	0x2f
+	.value	0x134
+	.byte	0x7
+	.long	.LASF1058
+	.long	0x7db4
+	.long	0x7ddf
+	.long	0x7de5
+	.uleb128 0x2
+	.long	0xecd0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1059
+	.byte	0x2f
+	.value	0x138
+	.byte	0x7
+	.long	.LASF1060
+	.long	0x7dfa
+	.long	0x7e00
+	.uleb128 0x2
+	.long	0xeccb
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1059
+	.byte	0x2f
+	.value	0x13e
+	.byte	0x7
+	.long	.LASF1061
+	.long	0x7e15
+	.long	0x7e20
+	.uleb128 0x2
+	.long	0xeccb
+	.uleb128 0x1
+	.long	0xecd5
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1059
+	.byte	0x2f
+	.value	0x144
+	.byte	0x7
+	.long	.LASF1062
+	.long	0x7e35
+	.long	0x7e40
+	.uleb128 0x2
+	.long	0xeccb
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1059
+	.byte	0x2f
+	.value	0x14a
+	.byte	0x7
+	.long	.LASF1063
+	.long	0x7e55
+	.long	0x7e65
+	.uleb128 0x2
+	.long	0xeccb
+	.uleb128 0x1
+	.long	0x121
+	.uleb128 0x1
+	.long	0xecd5
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1059
+	.byte	0x2f
+	.value	0x14f
+	.byte	0x7
+	.long	.LASF1064
+	.long	0x7e7a
+	.long	0x7e85
+	.uleb128 0x2
+	.long	0xeccb
+	.uleb128 0x1
+	.long	0xecda
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1059
+	.byte	0x2f
+	.value	0x154
+	.byte	0x7
+	.long	.LASF1065
+	.long	0x7e9a
+	.long	0x7ea5
+	.uleb128 0x2
+	.long	0xeccb
+	.uleb128 0x1
+	.long	0xecc1
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1059
+	.byte	0x2f
+	.value	0x158
+	.byte	0x7
+	.long	.LASF1066
+	.long	0x7eba
+	.long	0x7eca
+	.uleb128 0x2
+	.long	0xeccb
+	.uleb128 0x1
+	.long	0xecda
+	.uleb128 0x1
+	.long	0xecd5
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1059
+	.byte	0x2f
+	.value	0x166
+	.byte	0x7
+	.long	.LASF1067
+	.long	0x7edf
+	.long	0x7eef
+	.uleb128 0x2
+	.long	0xeccb
+	.uleb128 0x1
+	.long	0xecd5
+	.uleb128 0x1
+	.long	0xecda
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1068
+	.byte	0x2f
+	.value	0x16c
+	.byte	0x7
+	.long	.LASF1069
+	.long	0x7f04
+	.long	0x7f0f
+	.uleb128 0x2
+	.long	0xeccb
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF1070
+	.byte	0x2f
+	.value	0x173
+	.byte	0x14
+	.long	0x7cb6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1071
+	.byte	0x2f
+	.value	0x177
+	.byte	0x7
+	.long	.LASF1072
+	.long	0x7caa
+	.long	0x7f36
+	.long	0x7f41
+	.uleb128 0x2
+	.long	0xeccb
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1073
+	.byte	0x2f
+	.value	0x17f
+	.byte	0x7
+	.long	.LASF1074
+	.long	0x7f56
+	.long	0x7f66
+	.uleb128 0x2
+	.long	0xeccb
+	.uleb128 0x1
+	.long	0x7caa
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1075
+	.byte	0x2f
+	.value	0x189
+	.byte	0x7
+	.long	.LASF1076
+	.byte	0x2
+	.long	0x7f7c
+	.long	0x7f87
+	.uleb128 0x2
+	.long	0xeccb
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xacf1
+	.uleb128 0xf
+	.long	.LASF469
+	.long	0x7a15
+	.byte	0
+	.uleb128 0xa
+	.long	0x7bf0
+	.uleb128 0x1d
+	.long	.LASF1077
+	.byte	0x1
+	.byte	0x7
+	.byte	0x7c
+	.byte	0xc
+	.long	0x7fc2
+	.uleb128 0xd
+	.long	.LASF482
+	.byte	0x7
+	.byte	0x7d
+	.byte	0xd
+	.long	0x7a15
+	.uleb128 0xf
+	.long	.LASF1078
+	.long	0x7a15
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF1079
+	.byte	0x18
+	.byte	0x2f
+	.value	0x1a7
+	.byte	0xb
+	.long	0x8bcf
+	.uleb128 0x16
+	.byte	0x2f
+	.value	0x1a7
+	.byte	0xb
+	.long	0x7f1d
+	.uleb128 0x16
+	.byte	0x2f
+	.value	0x1a7
+	.byte	0xb
+	.long	0x7f41
+	.uleb128 0x16
+	.byte	0x2f
+	.value	0x1a7
+	.byte	0xb
+	.long	0x7f0f
+	.uleb128 0x16
+	.byte	0x2f
+	.value	0x1a7
+	.byte	0xb
+	.long	0x7d95
+	.uleb128 0x16
+	.byte	0x2f
+	.value	0x1a7
+	.byte	0xb
+	.long	0x7d76
+	.uleb128 0x16
+	.byte	0x2f
+	.value	0x1a7
+	.byte	0xb
+	.long	0x7dc6
+	.uleb128 0x3b
+	.long	0x7bf0
+	.byte	0
+	.byte	0x2
+	.uleb128 0x14
+	.long	.LASF1080
+	.byte	0x2f
+	.value	0x1d1
+	.byte	0x7
+	.long	.LASF1081
+	.long	0xacaa
+	.long	0x8028
+	.uleb128 0x1
+	.long	0x366
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1080
+	.byte	0x2f
+	.value	0x1da
+	.byte	0x7
+	.long	.LASF1082
+	.long	0xacaa
+	.long	0x8043
+	.uleb128 0x1
+	.long	0x115
+	.byte	0
+	.uleb128 0x64
+	.long	.LASF1083
+	.byte	0x2f
+	.value	0x1de
+	.byte	0x7
+	.long	.LASF1085
+	.long	0xacaa
+	.uleb128 0x24
+	.long	.LASF220
+	.byte	0x2f
+	.value	0x1c1
+	.byte	0x29
+	.long	0x7caa
+	.byte	0x1
+	.uleb128 0x14
+	.long	.LASF1086
+	.byte	0x2f
+	.value	0x1e7
+	.byte	0x7
+	.long	.LASF1087
+	.long	0x8054
+	.long	0x8091
+	.uleb128 0x1
+	.long	0x8054
+	.uleb128 0x1
+	.long	0x8054
+	.uleb128 0x1
+	.long	0x8054
+	.uleb128 0x1
+	.long	0xecdf
+	.uleb128 0x1
+	.long	0x366
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1054
+	.byte	0x2f
+	.value	0x1bc
+	.byte	0x2f
+	.long	0x7d65
+	.uleb128 0xa
+	.long	0x8091
+	.uleb128 0x14
+	.long	.LASF1086
+	.byte	0x2f
+	.value	0x1ee
+	.byte	0x7
+	.long	.LASF1088
+	.long	0x8054
+	.long	0x80d2
+	.uleb128 0x1
+	.long	0x8054
+	.uleb128 0x1
+	.long	0x8054
+	.uleb128 0x1
+	.long	0x8054
+	.uleb128 0x1
+	.long	0xecdf
+	.uleb128 0x1
+	.long	0x115
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1089
+	.byte	0x2f
+	.value	0x1f3
+	.byte	0x7
+	.long	.LASF1090
+	.long	0x8054
+	.long	0x80fc
+	.uleb128 0x1
+	.long	0x8054
+	.uleb128 0x1
+	.long	0x8054
+	.uleb128 0x1
+	.long	0x8054
+	.uleb128 0x1
+	.long	0xecdf
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF1091
+	.byte	0x2f
+	.value	0x20e
+	.byte	0x7
+	.long	.LASF1092
+	.long	0x8111
+	.long	0x8117
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF1091
+	.byte	0x2f
+	.value	0x219
+	.byte	0x7
+	.long	.LASF1093
+	.long	0x812c
+	.long	0x8137
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xece9
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF222
+	.byte	0x2f
+	.value	0x1cc
+	.byte	0x1a
+	.long	0x7a15
+	.byte	0x1
+	.uleb128 0xa
+	.long	0x8137
+	.uleb128 0x55
+	.long	.LASF1091
+	.byte	0x2f
+	.value	0x227
+	.byte	0x7
+	.long	.LASF1094
+	.long	0x815f
+	.long	0x816f
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x816f
+	.uleb128 0x1
+	.long	0xece9
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF115
+	.byte	0x2f
+	.value	0x1ca
+	.byte	0x1a
+	.long	0x121
+	.byte	0x1
+	.uleb128 0x10
+	.long	.LASF1091
+	.byte	0x2f
+	.value	0x234
+	.byte	0x7
+	.long	.LASF1095
+	.byte	0x1
+	.long	0x8193
+	.long	0x81a8
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x816f
+	.uleb128 0x1
+	.long	0xecee
+	.uleb128 0x1
+	.long	0xece9
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF8
+	.byte	0x2f
+	.value	0x1c0
+	.byte	0x17
+	.long	0xacf1
+	.byte	0x1
+	.uleb128 0xa
+	.long	0x81a8
+	.uleb128 0x10
+	.long	.LASF1091
+	.byte	0x2f
+	.value	0x254
+	.byte	0x7
+	.long	.LASF1096
+	.byte	0x1
+	.long	0x81d1
+	.long	0x81dc
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xecf3
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF1091
+	.byte	0x2f
+	.value	0x267
+	.byte	0x7
+	.long	.LASF1097
+	.long	0x81f1
+	.long	0x81fc
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xecf8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1091
+	.byte	0x2f
+	.value	0x26b
+	.byte	0x7
+	.long	.LASF1098
+	.byte	0x1
+	.long	0x8212
+	.long	0x8222
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xecf3
+	.uleb128 0x1
+	.long	0xecfd
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1091
+	.byte	0x2f
+	.value	0x276
+	.byte	0x7
+	.long	.LASF1099
+	.long	0x8237
+	.long	0x824c
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xecf8
+	.uleb128 0x1
+	.long	0xece9
+	.uleb128 0x1
+	.long	0x366
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1091
+	.byte	0x2f
+	.value	0x27b
+	.byte	0x7
+	.long	.LASF1100
+	.long	0x8261
+	.long	0x8276
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xecf8
+	.uleb128 0x1
+	.long	0xece9
+	.uleb128 0x1
+	.long	0x115
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1091
+	.byte	0x2f
+	.value	0x28e
+	.byte	0x7
+	.long	.LASF1101
+	.byte	0x1
+	.long	0x828c
+	.long	0x829c
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xecf8
+	.uleb128 0x1
+	.long	0xecfd
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1091
+	.byte	0x2f
+	.value	0x2a1
+	.byte	0x7
+	.long	.LASF1102
+	.byte	0x1
+	.long	0x82b2
+	.long	0x82c2
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x8be5
+	.uleb128 0x1
+	.long	0xece9
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1103
+	.byte	0x2f
+	.value	0x2d8
+	.byte	0x7
+	.long	.LASF1104
+	.byte	0x1
+	.long	0x82d8
+	.long	0x82e3
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF53
+	.byte	0x30
+	.byte	0xcc
+	.byte	0x5
+	.long	.LASF1105
+	.long	0xed02
+	.byte	0x1
+	.long	0x82fc
+	.long	0x8307
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xecf3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x2f
+	.value	0x2f9
+	.byte	0x7
+	.long	.LASF1106
+	.long	0xed02
+	.byte	0x1
+	.long	0x8321
+	.long	0x832c
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xecf8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x2f
+	.value	0x30f
+	.byte	0x7
+	.long	.LASF1107
+	.long	0xed02
+	.byte	0x1
+	.long	0x8346
+	.long	0x8351
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x8be5
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF67
+	.byte	0x2f
+	.value	0x323
+	.byte	0x7
+	.long	.LASF1108
+	.byte	0x1
+	.long	0x8367
+	.long	0x8377
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x816f
+	.uleb128 0x1
+	.long	0xecee
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF67
+	.byte	0x2f
+	.value	0x352
+	.byte	0x7
+	.long	.LASF1109
+	.byte	0x1
+	.long	0x838d
+	.long	0x8398
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x8be5
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF292
+	.byte	0x2f
+	.value	0x1c5
+	.byte	0x3d
+	.long	0xb4c6
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF124
+	.byte	0x2f
+	.value	0x364
+	.byte	0x7
+	.long	.LASF1110
+	.long	0x8398
+	.byte	0x1
+	.long	0x83c0
+	.long	0x83c6
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF123
+	.byte	0x2f
+	.value	0x1c7
+	.byte	0x7
+	.long	0xb4cb
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF124
+	.byte	0x2f
+	.value	0x36e
+	.byte	0x7
+	.long	.LASF1111
+	.long	0x83c6
+	.byte	0x1
+	.long	0x83ee
+	.long	0x83f4
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x4b
+	.string	"end"
+	.byte	0x2f
+	.value	0x378
+	.long	.LASF1112
+	.long	0x8398
+	.long	0x840c
+	.long	0x8412
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x4b
+	.string	"end"
+	.byte	0x2f
+	.value	0x382
+	.long	.LASF1113
+	.long	0x83c6
+	.long	0x842a
+	.long	0x8430
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF328
+	.byte	0x2f
+	.value	0x1c9
+	.byte	0x30
+	.long	0x8cdb
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF131
+	.byte	0x2f
+	.value	0x38c
+	.byte	0x7
+	.long	.LASF1114
+	.long	0x8430
+	.byte	0x1
+	.long	0x8458
+	.long	0x845e
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF130
+	.byte	0x2f
+	.value	0x1c8
+	.byte	0x35
+	.long	0x8ce0
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF131
+	.byte	0x2f
+	.value	0x396
+	.byte	0x7
+	.long	.LASF1115
+	.long	0x845e
+	.byte	0x1
+	.long	0x8486
+	.long	0x848c
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF133
+	.byte	0x2f
+	.value	0x3a0
+	.byte	0x7
+	.long	.LASF1116
+	.long	0x8430
+	.byte	0x1
+	.long	0x84a6
+	.long	0x84ac
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF133
+	.byte	0x2f
+	.value	0x3aa
+	.byte	0x7
+	.long	.LASF1117
+	.long	0x845e
+	.byte	0x1
+	.long	0x84c6
+	.long	0x84cc
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF126
+	.byte	0x2f
+	.value	0x3b5
+	.byte	0x7
+	.long	.LASF1118
+	.long	0x83c6
+	.byte	0x1
+	.long	0x84e6
+	.long	0x84ec
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF128
+	.byte	0x2f
+	.value	0x3bf
+	.byte	0x7
+	.long	.LASF1119
+	.long	0x83c6
+	.byte	0x1
+	.long	0x8506
+	.long	0x850c
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF135
+	.byte	0x2f
+	.value	0x3c9
+	.byte	0x7
+	.long	.LASF1120
+	.long	0x845e
+	.byte	0x1
+	.long	0x8526
+	.long	0x852c
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF137
+	.byte	0x2f
+	.value	0x3d3
+	.byte	0x7
+	.long	.LASF1121
+	.long	0x845e
+	.byte	0x1
+	.long	0x8546
+	.long	0x854c
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF139
+	.byte	0x2f
+	.value	0x3db
+	.byte	0x7
+	.long	.LASF1122
+	.long	0x816f
+	.byte	0x1
+	.long	0x8566
+	.long	0x856c
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF142
+	.byte	0x2f
+	.value	0x3e1
+	.byte	0x7
+	.long	.LASF1123
+	.long	0x816f
+	.byte	0x1
+	.long	0x8586
+	.long	0x858c
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF340
+	.byte	0x2f
+	.value	0x3f0
+	.byte	0x7
+	.long	.LASF1124
+	.byte	0x1
+	.long	0x85a2
+	.long	0x85ad
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x816f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF340
+	.byte	0x2f
+	.value	0x405
+	.byte	0x7
+	.long	.LASF1125
+	.byte	0x1
+	.long	0x85c3
+	.long	0x85d3
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x816f
+	.uleb128 0x1
+	.long	0xecee
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF343
+	.byte	0x2f
+	.value	0x427
+	.byte	0x7
+	.long	.LASF1126
+	.byte	0x1
+	.long	0x85e9
+	.long	0x85ef
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF345
+	.byte	0x2f
+	.value	0x431
+	.byte	0x7
+	.long	.LASF1127
+	.long	0x816f
+	.byte	0x1
+	.long	0x8609
+	.long	0x860f
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF144
+	.byte	0x2f
+	.value	0x43b
+	.byte	0x7
+	.long	.LASF1128
+	.long	0xacaa
+	.byte	0x1
+	.long	0x8629
+	.long	0x862f
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF347
+	.byte	0x30
+	.byte	0x43
+	.byte	0x5
+	.long	.LASF1129
+	.byte	0x1
+	.long	0x8644
+	.long	0x864f
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x816f
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF354
+	.byte	0x2f
+	.value	0x1c3
+	.byte	0x32
+	.long	0xb481
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF147
+	.byte	0x2f
+	.value	0x461
+	.byte	0x7
+	.long	.LASF1130
+	.long	0x864f
+	.byte	0x1
+	.long	0x8677
+	.long	0x8682
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x816f
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF146
+	.byte	0x2f
+	.value	0x1c4
+	.byte	0x37
+	.long	0xb48d
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF147
+	.byte	0x2f
+	.value	0x474
+	.byte	0x7
+	.long	.LASF1131
+	.long	0x8682
+	.byte	0x1
+	.long	0x86aa
+	.long	0x86b5
+	.uleb128 0x2
+	.long	0xed07
+	.uleb128 0x1
+	.long	0x816f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1132
+	.byte	0x2f
+	.value	0x47e
+	.byte	0x7
+	.long	.LASF1133
+	.byte	0x2
+	.long	0x86cb
+	.long	0x86d6
+	.uleb128 0x2
+	.long	0xed07
+	.uleb128 0x1
+	.long	0x816f
+	.byte	0
+	.uleb128 0x4b
+	.string	"at"
+	.byte	0x2f
+	.value	0x495
+	.long	.LASF1134
+	.long	0x864f
+	.long	0x86ed
+	.long	0x86f8
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x816f
+	.byte	0
+	.uleb128 0x4b
+	.string	"at"
+	.byte	0x2f
+	.value	0x4a8
+	.long	.LASF1135
+	.long	0x8682
+	.long	0x870f
+	.long	0x871a
+	.uleb128 0x2
+	.long	0xed07
+	.uleb128 0x1
+	.long	0x816f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF151
+	.byte	0x2f
+	.value	0x4b4
+	.byte	0x7
+	.long	.LASF1136
+	.long	0x864f
+	.byte	0x1
+	.long	0x8734
+	.long	0x873a
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF151
+	.byte	0x2f
+	.value	0x4c0
+	.byte	0x7
+	.long	.LASF1137
+	.long	0x8682
+	.byte	0x1
+	.long	0x8754
+	.long	0x875a
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF153
+	.byte	0x2f
+	.value	0x4cc
+	.byte	0x7
+	.long	.LASF1138
+	.long	0x864f
+	.byte	0x1
+	.long	0x8774
+	.long	0x877a
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF153
+	.byte	0x2f
+	.value	0x4d8
+	.byte	0x7
+	.long	.LASF1139
+	.long	0x8682
+	.byte	0x1
+	.long	0x8794
+	.long	0x879a
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF155
+	.byte	0x2f
+	.value	0x4e7
+	.byte	0x7
+	.long	.LASF1140
+	.long	0xec71
+	.byte	0x1
+	.long	0x87b4
+	.long	0x87ba
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF155
+	.byte	0x2f
+	.value	0x4ec
+	.byte	0x7
+	.long	.LASF1141
+	.long	0xb5be
+	.byte	0x1
+	.long	0x87d4
+	.long	0x87da
+	.uleb128 0x2
+	.long	0xed07
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF374
+	.byte	0x2f
+	.value	0x4fc
+	.byte	0x7
+	.long	.LASF1142
+	.byte	0x1
+	.long	0x87f0
+	.long	0x87fb
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xecee
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF374
+	.byte	0x2f
+	.value	0x50d
+	.byte	0x7
+	.long	.LASF1143
+	.byte	0x1
+	.long	0x8811
+	.long	0x881c
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xed0c
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF397
+	.byte	0x2f
+	.value	0x525
+	.byte	0x7
+	.long	.LASF1144
+	.byte	0x1
+	.long	0x8832
+	.long	0x8838
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF383
+	.byte	0x30
+	.byte	0x85
+	.byte	0x5
+	.long	.LASF1145
+	.long	0x8398
+	.byte	0x1
+	.long	0x8851
+	.long	0x8861
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x83c6
+	.uleb128 0x1
+	.long	0xecee
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF383
+	.byte	0x2f
+	.value	0x56c
+	.byte	0x7
+	.long	.LASF1146
+	.long	0x8398
+	.byte	0x1
+	.long	0x887b
+	.long	0x888b
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x83c6
+	.uleb128 0x1
+	.long	0xed0c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF383
+	.byte	0x2f
+	.value	0x57e
+	.byte	0x7
+	.long	.LASF1147
+	.long	0x8398
+	.byte	0x1
+	.long	0x88a5
+	.long	0x88b5
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x83c6
+	.uleb128 0x1
+	.long	0x8be5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF383
+	.byte	0x2f
+	.value	0x598
+	.byte	0x7
+	.long	.LASF1148
+	.long	0x8398
+	.byte	0x1
+	.long	0x88cf
+	.long	0x88e4
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x83c6
+	.uleb128 0x1
+	.long	0x816f
+	.uleb128 0x1
+	.long	0xecee
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF393
+	.byte	0x2f
+	.value	0x5f9
+	.byte	0x7
+	.long	.LASF1149
+	.long	0x8398
+	.byte	0x1
+	.long	0x88fe
+	.long	0x8909
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x83c6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF393
+	.byte	0x2f
+	.value	0x615
+	.byte	0x7
+	.long	.LASF1150
+	.long	0x8398
+	.byte	0x1
+	.long	0x8923
+	.long	0x8933
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x83c6
+	.uleb128 0x1
+	.long	0x83c6
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF58
+	.byte	0x2f
+	.value	0x62d
+	.byte	0x7
+	.long	.LASF1151
+	.byte	0x1
+	.long	0x8949
+	.long	0x8954
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xed02
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF350
+	.byte	0x2f
+	.value	0x640
+	.byte	0x7
+	.long	.LASF1152
+	.byte	0x1
+	.long	0x896a
+	.long	0x8970
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1153
+	.byte	0x2f
+	.value	0x6a3
+	.byte	0x7
+	.long	.LASF1154
+	.byte	0x2
+	.long	0x8986
+	.long	0x8996
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x816f
+	.uleb128 0x1
+	.long	0xecee
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1155
+	.byte	0x2f
+	.value	0x6ae
+	.byte	0x7
+	.long	.LASF1156
+	.byte	0x2
+	.long	0x89ac
+	.long	0x89b7
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x816f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1157
+	.byte	0x30
+	.value	0x108
+	.byte	0x5
+	.long	.LASF1158
+	.byte	0x2
+	.long	0x89cd
+	.long	0x89dd
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x121
+	.uleb128 0x1
+	.long	0xecee
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1159
+	.byte	0x30
+	.value	0x20b
+	.byte	0x5
+	.long	.LASF1160
+	.byte	0x2
+	.long	0x89f3
+	.long	0x8a08
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x8398
+	.uleb128 0x1
+	.long	0x816f
+	.uleb128 0x1
+	.long	0xecee
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1161
+	.byte	0x30
+	.value	0x272
+	.byte	0x5
+	.long	.LASF1162
+	.byte	0x2
+	.long	0x8a1e
+	.long	0x8a29
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x816f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1163
+	.byte	0x30
+	.value	0x2bf
+	.byte	0x5
+	.long	.LASF1164
+	.long	0xacaa
+	.byte	0x2
+	.long	0x8a43
+	.long	0x8a49
+	.uleb128 0x2
+	.long	0xece4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1165
+	.byte	0x30
+	.value	0x15e
+	.byte	0x5
+	.long	.LASF1166
+	.long	0x8398
+	.byte	0x2
+	.long	0x8a63
+	.long	0x8a73
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x83c6
+	.uleb128 0x1
+	.long	0xed0c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1167
+	.byte	0x2f
+	.value	0x75c
+	.byte	0x7
+	.long	.LASF1168
+	.long	0x8398
+	.byte	0x2
+	.long	0x8a8d
+	.long	0x8a9d
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x83c6
+	.uleb128 0x1
+	.long	0xed0c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1169
+	.byte	0x2f
+	.value	0x763
+	.byte	0x7
+	.long	.LASF1170
+	.long	0x816f
+	.byte	0x2
+	.long	0x8ab7
+	.long	0x8ac7
+	.uleb128 0x2
+	.long	0xed07
+	.uleb128 0x1
+	.long	0x816f
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF1171
+	.byte	0x2f
+	.value	0x76e
+	.byte	0x7
+	.long	.LASF1172
+	.long	0x816f
+	.byte	0x2
+	.long	0x8ae8
+	.uleb128 0x1
+	.long	0x816f
+	.uleb128 0x1
+	.long	0xece9
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF1173
+	.byte	0x2f
+	.value	0x777
+	.byte	0x7
+	.long	.LASF1174
+	.long	0x816f
+	.byte	0x2
+	.long	0x8b04
+	.uleb128 0x1
+	.long	0xed11
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1175
+	.byte	0x2f
+	.value	0x788
+	.byte	0x7
+	.long	.LASF1176
+	.byte	0x2
+	.long	0x8b1a
+	.long	0x8b25
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x8054
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF301
+	.byte	0x30
+	.byte	0xaf
+	.byte	0x5
+	.long	.LASF1177
+	.long	0x8398
+	.byte	0x2
+	.long	0x8b3e
+	.long	0x8b49
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x8398
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF301
+	.byte	0x30
+	.byte	0xbd
+	.byte	0x5
+	.long	.LASF1178
+	.long	0x8398
+	.byte	0x2
+	.long	0x8b62
+	.long	0x8b72
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0x8398
+	.uleb128 0x1
+	.long	0x8398
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1179
+	.byte	0x2f
+	.value	0x7a2
+	.byte	0x7
+	.long	.LASF1180
+	.long	0x8b87
+	.long	0x8b97
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xecf8
+	.uleb128 0x1
+	.long	0x366
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1179
+	.byte	0x2f
+	.value	0x7ae
+	.byte	0x7
+	.long	.LASF1181
+	.long	0x8bac
+	.long	0x8bbc
+	.uleb128 0x2
+	.long	0xece4
+	.uleb128 0x1
+	.long	0xecf8
+	.uleb128 0x1
+	.long	0x115
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xacf1
+	.uleb128 0x72
+	.long	.LASF469
+	.long	0x7a15
+	.byte	0
+	.uleb128 0xa
+	.long	0x7fc2
+	.uleb128 0xd
+	.long	.LASF1182
+	.byte	0x7
+	.byte	0x80
+	.byte	0xb
+	.long	0x7fac
+	.uleb128 0xa
+	.long	0x8bd4
+	.uleb128 0x29
+	.long	.LASF1183
+	.byte	0x10
+	.byte	0x1e
+	.byte	0x2f
+	.byte	0xb
+	.long	0x8cd6
+	.uleb128 0x23
+	.long	.LASF292
+	.byte	0x1e
+	.byte	0x36
+	.byte	0x1a
+	.long	0xb5be
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF471
+	.byte	0x1e
+	.byte	0x3a
+	.byte	0x12
+	.long	0x8bf2
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF115
+	.byte	0x1e
+	.byte	0x35
+	.byte	0x18
+	.long	0x121
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF215
+	.byte	0x1e
+	.byte	0x3b
+	.byte	0x13
+	.long	0x8c0c
+	.byte	0x8
+	.uleb128 0x1f
+	.long	.LASF472
+	.byte	0x1e
+	.byte	0x3e
+	.byte	0x11
+	.long	.LASF1184
+	.long	0x8c3a
+	.long	0x8c4a
+	.uleb128 0x2
+	.long	0xed16
+	.uleb128 0x1
+	.long	0x8c4a
+	.uleb128 0x1
+	.long	0x8c0c
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF123
+	.byte	0x1e
+	.byte	0x37
+	.byte	0x1a
+	.long	0xb5be
+	.byte	0x1
+	.uleb128 0x1b
+	.long	.LASF472
+	.byte	0x1e
+	.byte	0x42
+	.byte	0x11
+	.long	.LASF1185
+	.byte	0x1
+	.long	0x8c6c
+	.long	0x8c72
+	.uleb128 0x2
+	.long	0xed16
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF139
+	.byte	0x1e
+	.byte	0x47
+	.byte	0x7
+	.long	.LASF1186
+	.long	0x8c0c
+	.byte	0x1
+	.long	0x8c8b
+	.long	0x8c91
+	.uleb128 0x2
+	.long	0xed1b
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF124
+	.byte	0x1e
+	.byte	0x4b
+	.byte	0x7
+	.long	.LASF1187
+	.long	0x8c4a
+	.byte	0x1
+	.long	0x8caa
+	.long	0x8cb0
+	.uleb128 0x2
+	.long	0xed1b
+	.byte	0
+	.uleb128 0x71
+	.string	"end"
+	.byte	0x1e
+	.byte	0x4f
+	.long	.LASF1188
+	.long	0x8c4a
+	.long	0x8cc7
+	.long	0x8ccd
+	.uleb128 0x2
+	.long	0xed1b
+	.byte	0
+	.uleb128 0xe
+	.string	"_E"
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xa
+	.long	0x8be5
+	.uleb128 0x3e
+	.long	.LASF1189
+	.uleb128 0x3e
+	.long	.LASF1190
+	.uleb128 0x3a
+	.long	.LASF1191
+	.byte	0x8
+	.byte	0x22
+	.value	0x29d
+	.byte	0xc
+	.long	0x9334
+	.uleb128 0x24
+	.long	.LASF922
+	.byte	0x22
+	.value	0x2a0
+	.byte	0x16
+	.long	0xed25
+	.byte	0x3
+	.uleb128 0x57
+	.long	.LASF235
+	.byte	0x22
+	.value	0x2a2
+	.byte	0x17
+	.long	0x8cf3
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF923
+	.byte	0x22
+	.value	0x2a6
+	.byte	0x7
+	.long	.LASF1192
+	.long	0xb0e
+	.byte	0x3
+	.long	0x8d29
+	.long	0x8d34
+	.uleb128 0x2
+	.long	0xed2a
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF923
+	.byte	0x22
+	.value	0x2a9
+	.byte	0x7
+	.long	.LASF1193
+	.long	0xb0e
+	.byte	0x3
+	.long	0x8d4e
+	.long	0x8d59
+	.uleb128 0x2
+	.long	0xed2f
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF491
+	.byte	0x22
+	.value	0x2ac
+	.byte	0x7
+	.long	.LASF1194
+	.long	0x8d6e
+	.long	0x8d74
+	.uleb128 0x2
+	.long	0xed34
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF493
+	.byte	0x22
+	.value	0x2ad
+	.byte	0x7
+	.long	.LASF1195
+	.long	0x8d89
+	.long	0x8d94
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF491
+	.byte	0x22
+	.value	0x2ae
+	.long	.LASF1196
+	.long	0x8da8
+	.long	0x8db3
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0xed39
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x22
+	.value	0x2af
+	.byte	0x16
+	.long	.LASF1197
+	.long	0xed3e
+	.long	0x8dcc
+	.long	0x8dd7
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0xed39
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x22
+	.value	0x2b0
+	.byte	0x16
+	.long	.LASF1198
+	.long	0xed3e
+	.long	0x8df0
+	.long	0x8dfb
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0xed39
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF491
+	.byte	0x22
+	.value	0x2b3
+	.byte	0x11
+	.long	.LASF1199
+	.long	0x8e10
+	.long	0x8e1b
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0x8cf3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1200
+	.byte	0x22
+	.value	0x2b5
+	.byte	0x7
+	.long	.LASF1201
+	.long	0x8cf3
+	.long	0x8e34
+	.long	0x8e3a
+	.uleb128 0x2
+	.long	0xed2a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1200
+	.byte	0x22
+	.value	0x2b8
+	.byte	0x7
+	.long	.LASF1202
+	.long	0x8cf3
+	.long	0x8e53
+	.long	0x8e59
+	.uleb128 0x2
+	.long	0xed2f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x22
+	.value	0x2bc
+	.byte	0x7
+	.long	.LASF1203
+	.long	0x8cf3
+	.long	0x8e72
+	.long	0x8e7d
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0x8cf3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x22
+	.value	0x2c3
+	.byte	0x7
+	.long	.LASF1204
+	.long	0x8cf3
+	.long	0x8e96
+	.long	0x8ea1
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0x8cf3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x2ca
+	.byte	0x7
+	.long	.LASF1205
+	.long	0x8cf3
+	.long	0x8eba
+	.long	0x8ec5
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x2ce
+	.byte	0x7
+	.long	.LASF1206
+	.long	0x8cf3
+	.long	0x8ede
+	.long	0x8ee9
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x2d2
+	.byte	0x7
+	.long	.LASF1207
+	.long	0x8cf3
+	.long	0x8f02
+	.long	0x8f0d
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x2d6
+	.byte	0x7
+	.long	.LASF1208
+	.long	0x8cf3
+	.long	0x8f26
+	.long	0x8f31
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x2da
+	.byte	0x7
+	.long	.LASF1209
+	.long	0x8cf3
+	.long	0x8f4a
+	.long	0x8f50
+	.uleb128 0x2
+	.long	0xed34
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF504
+	.byte	0x22
+	.value	0x2df
+	.byte	0x7
+	.long	.LASF1210
+	.long	0x8cf3
+	.long	0x8f69
+	.long	0x8f6f
+	.uleb128 0x2
+	.long	0xed43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x2e4
+	.byte	0x7
+	.long	.LASF1211
+	.long	0x8cf3
+	.long	0x8f88
+	.long	0x8f8e
+	.uleb128 0x2
+	.long	0xed34
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF507
+	.byte	0x22
+	.value	0x2e9
+	.byte	0x7
+	.long	.LASF1212
+	.long	0x8cf3
+	.long	0x8fa7
+	.long	0x8fad
+	.uleb128 0x2
+	.long	0xed43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF362
+	.byte	0x22
+	.value	0x2ee
+	.byte	0x7
+	.long	.LASF1213
+	.long	0x8cf3
+	.long	0x8fc6
+	.long	0x8fd1
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF362
+	.byte	0x22
+	.value	0x2f3
+	.byte	0x7
+	.long	.LASF1214
+	.long	0x8cf3
+	.long	0x8fea
+	.long	0x8ff5
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF516
+	.byte	0x22
+	.value	0x2f8
+	.byte	0x7
+	.long	.LASF1215
+	.long	0x8cf3
+	.long	0x900e
+	.long	0x9019
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF516
+	.byte	0x22
+	.value	0x2fd
+	.byte	0x7
+	.long	.LASF1216
+	.long	0x8cf3
+	.long	0x9032
+	.long	0x903d
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF528
+	.byte	0x22
+	.value	0x302
+	.byte	0x7
+	.long	.LASF1217
+	.long	0xacaa
+	.long	0x9056
+	.long	0x905c
+	.uleb128 0x2
+	.long	0xed2a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF528
+	.byte	0x22
+	.value	0x30a
+	.byte	0x7
+	.long	.LASF1218
+	.long	0xacaa
+	.long	0x9075
+	.long	0x907b
+	.uleb128 0x2
+	.long	0xed2f
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x22
+	.value	0x312
+	.byte	0x7
+	.long	.LASF1219
+	.long	0x9090
+	.long	0x90a0
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0x8cf3
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF531
+	.byte	0x22
+	.value	0x320
+	.byte	0x7
+	.long	.LASF1220
+	.long	0x90b5
+	.long	0x90c5
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0x8cf3
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x22
+	.value	0x32d
+	.byte	0x7
+	.long	.LASF1221
+	.long	0x8cf3
+	.long	0x90de
+	.long	0x90e9
+	.uleb128 0x2
+	.long	0xed2a
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF534
+	.byte	0x22
+	.value	0x338
+	.byte	0x7
+	.long	.LASF1222
+	.long	0x8cf3
+	.long	0x9102
+	.long	0x910d
+	.uleb128 0x2
+	.long	0xed2f
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x22
+	.value	0x343
+	.byte	0x7
+	.long	.LASF1223
+	.long	0x8cf3
+	.long	0x9126
+	.long	0x9136
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0x8cf3
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF537
+	.byte	0x22
+	.value	0x34b
+	.byte	0x7
+	.long	.LASF1224
+	.long	0x8cf3
+	.long	0x914f
+	.long	0x915f
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0x8cf3
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x352
+	.byte	0x7
+	.long	.LASF1225
+	.long	0xacaa
+	.long	0x9178
+	.long	0x9192
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0xed48
+	.uleb128 0x1
+	.long	0x8cf3
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF540
+	.byte	0x22
+	.value	0x35d
+	.byte	0x7
+	.long	.LASF1226
+	.long	0xacaa
+	.long	0x91ab
+	.long	0x91c5
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0xed48
+	.uleb128 0x1
+	.long	0x8cf3
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x368
+	.byte	0x7
+	.long	.LASF1227
+	.long	0xacaa
+	.long	0x91de
+	.long	0x91f8
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0xed48
+	.uleb128 0x1
+	.long	0x8cf3
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF545
+	.byte	0x22
+	.value	0x373
+	.byte	0x7
+	.long	.LASF1228
+	.long	0xacaa
+	.long	0x9211
+	.long	0x922b
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0xed48
+	.uleb128 0x1
+	.long	0x8cf3
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF550
+	.byte	0x22
+	.value	0x37f
+	.byte	0x7
+	.long	.LASF1229
+	.long	0x9240
+	.long	0x9250
+	.uleb128 0x2
+	.long	0xed2a
+	.uleb128 0x1
+	.long	0x8cf3
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF552
+	.byte	0x22
+	.value	0x38a
+	.byte	0x7
+	.long	.LASF1230
+	.long	0x9265
+	.long	0x926b
+	.uleb128 0x2
+	.long	0xed2a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF554
+	.byte	0x22
+	.value	0x390
+	.byte	0x7
+	.long	.LASF1231
+	.long	0x9280
+	.long	0x9286
+	.uleb128 0x2
+	.long	0xed2a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF556
+	.byte	0x22
+	.value	0x397
+	.byte	0x7
+	.long	.LASF1232
+	.long	0x8cf3
+	.long	0x929f
+	.long	0x92af
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF556
+	.byte	0x22
+	.value	0x39c
+	.byte	0x7
+	.long	.LASF1233
+	.long	0x8cf3
+	.long	0x92c8
+	.long	0x92d8
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF559
+	.byte	0x22
+	.value	0x3a1
+	.byte	0x7
+	.long	.LASF1234
+	.long	0x8cf3
+	.long	0x92f1
+	.long	0x9301
+	.uleb128 0x2
+	.long	0xed34
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF559
+	.byte	0x22
+	.value	0x3a6
+	.byte	0x7
+	.long	.LASF1235
+	.long	0x8cf3
+	.long	0x931a
+	.long	0x932a
+	.uleb128 0x2
+	.long	0xed43
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF571
+	.long	0xed25
+	.byte	0
+	.uleb128 0xa
+	.long	0x8ce5
+	.uleb128 0x3c
+	.long	0x8ce5
+	.uleb128 0xa
+	.long	0x9339
+	.uleb128 0x41
+	.long	.LASF1236
+	.byte	0x8
+	.byte	0x23
+	.value	0x19f
+	.byte	0xc
+	.long	0x9a36
+	.uleb128 0x24
+	.long	.LASF969
+	.byte	0x23
+	.value	0x1a5
+	.byte	0x23
+	.long	0x8ce5
+	.byte	0x1
+	.uleb128 0x57
+	.long	.LASF970
+	.byte	0x23
+	.value	0x1a6
+	.byte	0x15
+	.long	0x9351
+	.byte	0x1
+	.uleb128 0x48
+	.long	.LASF574
+	.byte	0x23
+	.value	0x1a8
+	.byte	0x7
+	.long	.LASF1237
+	.long	0x9382
+	.long	0x9388
+	.uleb128 0x2
+	.long	0xed4d
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF576
+	.byte	0x23
+	.value	0x1a9
+	.byte	0x7
+	.long	.LASF1238
+	.long	0x939d
+	.long	0x93a8
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x73
+	.long	.LASF574
+	.byte	0x23
+	.value	0x1aa
+	.long	.LASF1239
+	.long	0x93bc
+	.long	0x93c7
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xed52
+	.byte	0
+	.uleb128 0x62
+	.long	.LASF53
+	.byte	0x23
+	.value	0x1ab
+	.byte	0xf
+	.long	.LASF1240
+	.long	0xed57
+	.long	0x93e0
+	.long	0x93eb
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xed52
+	.byte	0
+	.uleb128 0x62
+	.long	.LASF53
+	.byte	0x23
+	.value	0x1ac
+	.byte	0xf
+	.long	.LASF1241
+	.long	0xed57
+	.long	0x9404
+	.long	0x940f
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0xed52
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF574
+	.byte	0x23
+	.value	0x1ae
+	.byte	0x11
+	.long	.LASF1242
+	.byte	0x1
+	.long	0x9425
+	.long	0x9430
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0x9430
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF922
+	.byte	0x23
+	.value	0x1a4
+	.byte	0x17
+	.long	0xed25
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1243
+	.byte	0x23
+	.value	0x1b0
+	.byte	0x7
+	.long	.LASF1244
+	.long	0x9430
+	.byte	0x1
+	.long	0x9458
+	.long	0x945e
+	.uleb128 0x2
+	.long	0xed61
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1243
+	.byte	0x23
+	.value	0x1b3
+	.byte	0x7
+	.long	.LASF1245
+	.long	0x9430
+	.byte	0x1
+	.long	0x9478
+	.long	0x947e
+	.uleb128 0x2
+	.long	0xed66
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x23
+	.value	0x1b7
+	.byte	0x7
+	.long	.LASF1246
+	.long	0x9430
+	.byte	0x1
+	.long	0x9498
+	.long	0x94a3
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0x9430
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x23
+	.value	0x1bb
+	.byte	0x7
+	.long	.LASF1247
+	.long	0x9430
+	.byte	0x1
+	.long	0x94bd
+	.long	0x94c8
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0x9430
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x23
+	.value	0x1bf
+	.byte	0x7
+	.long	.LASF1248
+	.long	0x9430
+	.byte	0x1
+	.long	0x94e2
+	.long	0x94ed
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x23
+	.value	0x1c8
+	.byte	0x7
+	.long	.LASF1249
+	.long	0x9430
+	.byte	0x1
+	.long	0x9507
+	.long	0x9512
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x23
+	.value	0x1d1
+	.byte	0x7
+	.long	.LASF1250
+	.long	0x9430
+	.byte	0x1
+	.long	0x952c
+	.long	0x9537
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x23
+	.value	0x1da
+	.byte	0x7
+	.long	.LASF1251
+	.long	0x9430
+	.byte	0x1
+	.long	0x9551
+	.long	0x955c
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x23
+	.value	0x1e3
+	.byte	0x7
+	.long	.LASF1252
+	.long	0x9430
+	.byte	0x1
+	.long	0x9576
+	.long	0x957c
+	.uleb128 0x2
+	.long	0xed4d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x23
+	.value	0x1ec
+	.byte	0x7
+	.long	.LASF1253
+	.long	0x9430
+	.byte	0x1
+	.long	0x9596
+	.long	0x959c
+	.uleb128 0x2
+	.long	0xed5c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x23
+	.value	0x1f5
+	.byte	0x7
+	.long	.LASF1254
+	.long	0x9430
+	.byte	0x1
+	.long	0x95b6
+	.long	0x95bc
+	.uleb128 0x2
+	.long	0xed4d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x23
+	.value	0x1fe
+	.byte	0x7
+	.long	.LASF1255
+	.long	0x9430
+	.byte	0x1
+	.long	0x95d6
+	.long	0x95dc
+	.uleb128 0x2
+	.long	0xed5c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF362
+	.byte	0x23
+	.value	0x207
+	.byte	0x7
+	.long	.LASF1256
+	.long	0x9430
+	.byte	0x1
+	.long	0x95f6
+	.long	0x9601
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF362
+	.byte	0x23
+	.value	0x210
+	.byte	0x7
+	.long	.LASF1257
+	.long	0x9430
+	.byte	0x1
+	.long	0x961b
+	.long	0x9626
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF516
+	.byte	0x23
+	.value	0x219
+	.byte	0x7
+	.long	.LASF1258
+	.long	0x9430
+	.byte	0x1
+	.long	0x9640
+	.long	0x964b
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF516
+	.byte	0x23
+	.value	0x222
+	.byte	0x7
+	.long	.LASF1259
+	.long	0x9430
+	.byte	0x1
+	.long	0x9665
+	.long	0x9670
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0xb0e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF528
+	.byte	0x23
+	.value	0x22b
+	.byte	0x7
+	.long	.LASF1260
+	.long	0xacaa
+	.byte	0x1
+	.long	0x968a
+	.long	0x9690
+	.uleb128 0x2
+	.long	0xed61
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF528
+	.byte	0x23
+	.value	0x22f
+	.byte	0x7
+	.long	.LASF1261
+	.long	0xacaa
+	.byte	0x1
+	.long	0x96aa
+	.long	0x96b0
+	.uleb128 0x2
+	.long	0xed66
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF531
+	.byte	0x23
+	.value	0x238
+	.byte	0x7
+	.long	.LASF1262
+	.byte	0x1
+	.long	0x96c6
+	.long	0x96d6
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF531
+	.byte	0x23
+	.value	0x23d
+	.byte	0x7
+	.long	.LASF1263
+	.byte	0x1
+	.long	0x96ec
+	.long	0x96fc
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF534
+	.byte	0x23
+	.value	0x242
+	.byte	0x7
+	.long	.LASF1264
+	.long	0x9430
+	.byte	0x1
+	.long	0x9716
+	.long	0x9721
+	.uleb128 0x2
+	.long	0xed61
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF534
+	.byte	0x23
+	.value	0x246
+	.byte	0x7
+	.long	.LASF1265
+	.long	0x9430
+	.byte	0x1
+	.long	0x973b
+	.long	0x9746
+	.uleb128 0x2
+	.long	0xed66
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF537
+	.byte	0x23
+	.value	0x24a
+	.byte	0x7
+	.long	.LASF1266
+	.long	0x9430
+	.byte	0x1
+	.long	0x9760
+	.long	0x9770
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF537
+	.byte	0x23
+	.value	0x24f
+	.byte	0x7
+	.long	.LASF1267
+	.long	0x9430
+	.byte	0x1
+	.long	0x978a
+	.long	0x979a
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x254
+	.byte	0x7
+	.long	.LASF1268
+	.long	0xacaa
+	.byte	0x1
+	.long	0x97b4
+	.long	0x97ce
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xed6b
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x259
+	.byte	0x7
+	.long	.LASF1269
+	.long	0xacaa
+	.byte	0x1
+	.long	0x97e8
+	.long	0x9802
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0xed6b
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x25f
+	.byte	0x7
+	.long	.LASF1270
+	.long	0xacaa
+	.byte	0x1
+	.long	0x981c
+	.long	0x9831
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xed6b
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF540
+	.byte	0x23
+	.value	0x267
+	.byte	0x7
+	.long	.LASF1271
+	.long	0xacaa
+	.byte	0x1
+	.long	0x984b
+	.long	0x9860
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0xed6b
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x26f
+	.byte	0x7
+	.long	.LASF1272
+	.long	0xacaa
+	.byte	0x1
+	.long	0x987a
+	.long	0x9894
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xed6b
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x274
+	.byte	0x7
+	.long	.LASF1273
+	.long	0xacaa
+	.byte	0x1
+	.long	0x98ae
+	.long	0x98c8
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0xed6b
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x27a
+	.byte	0x7
+	.long	.LASF1274
+	.long	0xacaa
+	.byte	0x1
+	.long	0x98e2
+	.long	0x98f7
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xed6b
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF545
+	.byte	0x23
+	.value	0x282
+	.byte	0x7
+	.long	.LASF1275
+	.long	0xacaa
+	.byte	0x1
+	.long	0x9911
+	.long	0x9926
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0xed6b
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF550
+	.byte	0x23
+	.value	0x28b
+	.byte	0x5
+	.long	.LASF1276
+	.byte	0x1
+	.long	0x993c
+	.long	0x994c
+	.uleb128 0x2
+	.long	0xed61
+	.uleb128 0x1
+	.long	0x9430
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x23
+	.value	0x291
+	.byte	0x5
+	.long	.LASF1277
+	.byte	0x1
+	.long	0x9962
+	.long	0x9968
+	.uleb128 0x2
+	.long	0xed4d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x23
+	.value	0x295
+	.byte	0x5
+	.long	.LASF1278
+	.byte	0x1
+	.long	0x997e
+	.long	0x9984
+	.uleb128 0x2
+	.long	0xed4d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF556
+	.byte	0x23
+	.value	0x29a
+	.byte	0x7
+	.long	.LASF1279
+	.long	0x9430
+	.byte	0x1
+	.long	0x999e
+	.long	0x99ae
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF556
+	.byte	0x23
+	.value	0x2a4
+	.byte	0x7
+	.long	.LASF1280
+	.long	0x9430
+	.byte	0x1
+	.long	0x99c8
+	.long	0x99d8
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF559
+	.byte	0x23
+	.value	0x2ae
+	.byte	0x7
+	.long	.LASF1281
+	.long	0x9430
+	.byte	0x1
+	.long	0x99f2
+	.long	0x9a02
+	.uleb128 0x2
+	.long	0xed4d
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF559
+	.byte	0x23
+	.value	0x2b8
+	.byte	0x7
+	.long	.LASF1282
+	.long	0x9430
+	.byte	0x1
+	.long	0x9a1c
+	.long	0x9a2c
+	.uleb128 0x2
+	.long	0xed5c
+	.uleb128 0x1
+	.long	0xb0e
+	.uleb128 0x1
+	.long	0x3721
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xed25
+	.byte	0
+	.uleb128 0xa
+	.long	0x9343
+	.uleb128 0x3c
+	.long	0x9343
+	.uleb128 0xa
+	.long	0x9a3b
+	.uleb128 0x3a
+	.long	.LASF1283
+	.byte	0x1
+	.byte	0x7
+	.value	0x65c
+	.byte	0xc
+	.long	0x9a62
+	.uleb128 0xa
+	.long	0x127f3
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x9a53
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF1284
+	.byte	0x1
+	.byte	0x7
+	.value	0x106
+	.byte	0xc
+	.long	0x9a87
+	.uleb128 0x21
+	.long	.LASF482
+	.byte	0x7
+	.value	0x107
+	.byte	0x13
+	.long	0xf30d
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1285
+	.byte	0x8
+	.byte	0x2
+	.byte	0xbb
+	.byte	0xc
+	.long	0x9b84
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xbd
+	.byte	0x11
+	.long	.LASF1286
+	.long	0x9aa8
+	.long	0x9aae
+	.uleb128 0x2
+	.long	0xf413
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xc0
+	.byte	0x11
+	.long	.LASF1287
+	.long	0x9ac2
+	.long	0x9acd
+	.uleb128 0x2
+	.long	0xf413
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xc3
+	.byte	0x11
+	.long	.LASF1288
+	.long	0x9ae1
+	.long	0x9aec
+	.uleb128 0x2
+	.long	0xf413
+	.uleb128 0x1
+	.long	0xf41d
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xc4
+	.byte	0x11
+	.long	.LASF1289
+	.long	0x9b00
+	.long	0x9b0b
+	.uleb128 0x2
+	.long	0xf413
+	.uleb128 0x1
+	.long	0xf422
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xcb
+	.byte	0x7
+	.long	.LASF1290
+	.long	0x9b1f
+	.long	0x9b2f
+	.uleb128 0x2
+	.long	0xf413
+	.uleb128 0x1
+	.long	0x1de
+	.uleb128 0x1
+	.long	0x20d
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF813
+	.byte	0x2
+	.byte	0xe9
+	.byte	0x7
+	.long	.LASF1291
+	.long	0xf404
+	.long	0x9b49
+	.uleb128 0x1
+	.long	0xf427
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF813
+	.byte	0x2
+	.byte	0xec
+	.byte	0x7
+	.long	.LASF1292
+	.long	0xf404
+	.long	0x9b63
+	.uleb128 0x1
+	.long	0xf41d
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF816
+	.byte	0x2
+	.byte	0xee
+	.byte	0xd
+	.long	0xf404
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF817
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xf404
+	.byte	0
+	.uleb128 0xa
+	.long	0x9a87
+	.uleb128 0x3a
+	.long	.LASF1293
+	.byte	0x8
+	.byte	0x2
+	.value	0x1a0
+	.byte	0xc
+	.long	0x9caa
+	.uleb128 0x3b
+	.long	0x9a87
+	.byte	0
+	.byte	0x3
+	.uleb128 0x14
+	.long	.LASF813
+	.byte	0x2
+	.value	0x1a8
+	.byte	0x7
+	.long	.LASF1294
+	.long	0xf404
+	.long	0x9bb9
+	.uleb128 0x1
+	.long	0xf42c
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF813
+	.byte	0x2
+	.value	0x1ab
+	.byte	0x7
+	.long	.LASF1295
+	.long	0xf404
+	.long	0x9bd4
+	.uleb128 0x1
+	.long	0xf431
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF822
+	.byte	0x2
+	.value	0x1ae
+	.byte	0x7
+	.long	.LASF1296
+	.long	0x9be9
+	.long	0x9bef
+	.uleb128 0x2
+	.long	0xf436
+	.byte	0
+	.uleb128 0x69
+	.long	.LASF822
+	.byte	0x2
+	.value	0x1b2
+	.byte	0x7
+	.long	.LASF1297
+	.long	0x9c04
+	.long	0x9c0f
+	.uleb128 0x2
+	.long	0xf436
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF822
+	.byte	0x2
+	.value	0x1bc
+	.byte	0x11
+	.long	.LASF1298
+	.long	0x9c24
+	.long	0x9c2f
+	.uleb128 0x2
+	.long	0xf436
+	.uleb128 0x1
+	.long	0xf431
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x2
+	.value	0x1c0
+	.byte	0x14
+	.long	.LASF1299
+	.long	0xf42c
+	.long	0x9c48
+	.long	0x9c53
+	.uleb128 0x2
+	.long	0xf436
+	.uleb128 0x1
+	.long	0xf431
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF822
+	.byte	0x2
+	.value	0x1c6
+	.byte	0x7
+	.long	.LASF1300
+	.long	0x9c68
+	.long	0x9c73
+	.uleb128 0x2
+	.long	0xf436
+	.uleb128 0x1
+	.long	0xf440
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF828
+	.byte	0x2
+	.value	0x220
+	.byte	0x7
+	.long	.LASF1301
+	.byte	0x2
+	.long	0x9c89
+	.long	0x9c94
+	.uleb128 0x2
+	.long	0xf436
+	.uleb128 0x1
+	.long	0xf42c
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF817
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0x6a
+	.long	.LASF851
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x9b89
+	.uleb128 0x1d
+	.long	.LASF1302
+	.byte	0x8
+	.byte	0x2
+	.byte	0xbb
+	.byte	0xc
+	.long	0x9dac
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xbd
+	.byte	0x11
+	.long	.LASF1303
+	.long	0x9cd0
+	.long	0x9cd6
+	.uleb128 0x2
+	.long	0xf445
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xc0
+	.byte	0x11
+	.long	.LASF1304
+	.long	0x9cea
+	.long	0x9cf5
+	.uleb128 0x2
+	.long	0xf445
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xc3
+	.byte	0x11
+	.long	.LASF1305
+	.long	0x9d09
+	.long	0x9d14
+	.uleb128 0x2
+	.long	0xf445
+	.uleb128 0x1
+	.long	0xf44f
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xc4
+	.byte	0x11
+	.long	.LASF1306
+	.long	0x9d28
+	.long	0x9d33
+	.uleb128 0x2
+	.long	0xf445
+	.uleb128 0x1
+	.long	0xf454
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF807
+	.byte	0x2
+	.byte	0xcb
+	.byte	0x7
+	.long	.LASF1307
+	.long	0x9d47
+	.long	0x9d57
+	.uleb128 0x2
+	.long	0xf445
+	.uleb128 0x1
+	.long	0x1de
+	.uleb128 0x1
+	.long	0x20d
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF813
+	.byte	0x2
+	.byte	0xe9
+	.byte	0x7
+	.long	.LASF1308
+	.long	0xf404
+	.long	0x9d71
+	.uleb128 0x1
+	.long	0xf459
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF813
+	.byte	0x2
+	.byte	0xec
+	.byte	0x7
+	.long	.LASF1309
+	.long	0xf404
+	.long	0x9d8b
+	.uleb128 0x1
+	.long	0xf44f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF816
+	.byte	0x2
+	.byte	0xee
+	.byte	0xd
+	.long	0xf404
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF817
+	.long	0xacc0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xf404
+	.byte	0
+	.uleb128 0xa
+	.long	0x9caf
+	.uleb128 0x3a
+	.long	.LASF1310
+	.byte	0x10
+	.byte	0x2
+	.value	0x102
+	.byte	0xc
+	.long	0x9f29
+	.uleb128 0x34
+	.long	0x9b89
+	.uleb128 0x3b
+	.long	0x9caf
+	.byte	0x8
+	.byte	0x3
+	.uleb128 0x14
+	.long	.LASF813
+	.byte	0x2
+	.value	0x10c
+	.byte	0x7
+	.long	.LASF1311
+	.long	0xf404
+	.long	0x9de6
+	.uleb128 0x1
+	.long	0xf45e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF813
+	.byte	0x2
+	.value	0x10f
+	.byte	0x7
+	.long	.LASF1312
+	.long	0xf404
+	.long	0x9e01
+	.uleb128 0x1
+	.long	0xf463
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF841
+	.byte	0x2
+	.value	0x108
+	.byte	0x2f
+	.long	0x9b89
+	.uleb128 0xa
+	.long	0x9e01
+	.uleb128 0x14
+	.long	.LASF842
+	.byte	0x2
+	.value	0x112
+	.byte	0x7
+	.long	.LASF1313
+	.long	0xf468
+	.long	0x9e2e
+	.uleb128 0x1
+	.long	0xf45e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF842
+	.byte	0x2
+	.value	0x115
+	.byte	0x7
+	.long	.LASF1314
+	.long	0xf46d
+	.long	0x9e49
+	.uleb128 0x1
+	.long	0xf463
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF822
+	.byte	0x2
+	.value	0x117
+	.byte	0x11
+	.long	.LASF1315
+	.long	0x9e5e
+	.long	0x9e64
+	.uleb128 0x2
+	.long	0xf472
+	.byte	0
+	.uleb128 0x69
+	.long	.LASF822
+	.byte	0x2
+	.value	0x11b
+	.byte	0x7
+	.long	.LASF1316
+	.long	0x9e79
+	.long	0x9e89
+	.uleb128 0x2
+	.long	0xf472
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF822
+	.byte	0x2
+	.value	0x127
+	.byte	0x11
+	.long	.LASF1317
+	.long	0x9e9e
+	.long	0x9ea9
+	.uleb128 0x2
+	.long	0xf472
+	.uleb128 0x1
+	.long	0xf463
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF53
+	.byte	0x2
+	.value	0x12b
+	.byte	0x14
+	.long	.LASF1318
+	.long	0xf45e
+	.long	0x9ec2
+	.long	0x9ecd
+	.uleb128 0x2
+	.long	0xf472
+	.uleb128 0x1
+	.long	0xf463
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF822
+	.byte	0x2
+	.value	0x12d
+	.byte	0x7
+	.long	.LASF1319
+	.long	0x9ee2
+	.long	0x9eed
+	.uleb128 0x2
+	.long	0xf472
+	.uleb128 0x1
+	.long	0xf47c
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF828
+	.byte	0x2
+	.value	0x196
+	.byte	0x7
+	.long	.LASF1320
+	.byte	0x2
+	.long	0x9f03
+	.long	0x9f0e
+	.uleb128 0x2
+	.long	0xf472
+	.uleb128 0x1
+	.long	0xf45e
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF817
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x6a
+	.long	.LASF851
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x9db1
+	.uleb128 0x41
+	.long	.LASF1321
+	.byte	0x10
+	.byte	0x2
+	.value	0x3d5
+	.byte	0xb
+	.long	0xa032
+	.uleb128 0x3b
+	.long	0x9db1
+	.byte	0
+	.byte	0x1
+	.uleb128 0x64
+	.long	.LASF853
+	.byte	0x2
+	.value	0x40b
+	.byte	0x1d
+	.long	.LASF1322
+	.long	0xacaa
+	.uleb128 0x48
+	.long	.LASF854
+	.byte	0x2
+	.value	0x440
+	.byte	0x11
+	.long	.LASF1323
+	.long	0x9f69
+	.long	0x9f74
+	.uleb128 0x2
+	.long	0xf481
+	.uleb128 0x1
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF854
+	.byte	0x2
+	.value	0x442
+	.byte	0x11
+	.long	.LASF1324
+	.long	0x9f89
+	.long	0x9f94
+	.uleb128 0x2
+	.long	0xf481
+	.uleb128 0x1
+	.long	0xf490
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x2
+	.value	0x4f3
+	.byte	0x7
+	.long	.LASF1325
+	.long	0xf495
+	.byte	0x1
+	.long	0x9fae
+	.long	0x9fb9
+	.uleb128 0x2
+	.long	0xf481
+	.uleb128 0x1
+	.long	0xa037
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x2
+	.value	0x4fe
+	.byte	0x7
+	.long	.LASF1326
+	.long	0xf495
+	.byte	0x1
+	.long	0x9fd3
+	.long	0x9fde
+	.uleb128 0x2
+	.long	0xf481
+	.uleb128 0x1
+	.long	0xa043
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF58
+	.byte	0x2
+	.value	0x533
+	.byte	0x7
+	.long	.LASF1327
+	.byte	0x1
+	.long	0x9ff4
+	.long	0x9fff
+	.uleb128 0x2
+	.long	0xf481
+	.uleb128 0x1
+	.long	0xf495
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1328
+	.byte	0x2
+	.value	0x427
+	.byte	0x2
+	.long	.LASF1329
+	.byte	0x1
+	.long	0xa01f
+	.long	0xa02f
+	.uleb128 0x75
+	.long	.LASF2252
+	.long	0xacaa
+	.byte	0x1
+	.uleb128 0x2
+	.long	0xf481
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x9a
+	.byte	0
+	.uleb128 0xa
+	.long	0x9f2e
+	.uleb128 0xd
+	.long	.LASF860
+	.byte	0x7
+	.byte	0x77
+	.byte	0xb
+	.long	0x36e8
+	.uleb128 0xd
+	.long	.LASF860
+	.byte	0x7
+	.byte	0x77
+	.byte	0xb
+	.long	0x36f4
+	.uleb128 0x1d
+	.long	.LASF1330
+	.byte	0x1
+	.byte	0x31
+	.byte	0xc6
+	.byte	0xc
+	.long	0xa081
+	.uleb128 0xd
+	.long	.LASF1331
+	.byte	0x31
+	.byte	0xcb
+	.byte	0xd
+	.long	0xb0e
+	.uleb128 0xd
+	.long	.LASF220
+	.byte	0x31
+	.byte	0xcc
+	.byte	0xd
+	.long	0xb6fa
+	.uleb128 0xd
+	.long	.LASF354
+	.byte	0x31
+	.byte	0xcd
+	.byte	0xd
+	.long	0xf4ae
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1332
+	.byte	0x1
+	.byte	0x31
+	.byte	0xc6
+	.byte	0xc
+	.long	0xa0b3
+	.uleb128 0xd
+	.long	.LASF1331
+	.byte	0x31
+	.byte	0xcb
+	.byte	0xd
+	.long	0xb0e
+	.uleb128 0xd
+	.long	.LASF220
+	.byte	0x31
+	.byte	0xcc
+	.byte	0xd
+	.long	0xb5c3
+	.uleb128 0xd
+	.long	.LASF354
+	.byte	0x31
+	.byte	0xcd
+	.byte	0xd
+	.long	0xce17
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1333
+	.byte	0x1
+	.byte	0x32
+	.byte	0xa4
+	.byte	0xc
+	.long	0xa0f0
+	.uleb128 0x38
+	.long	.LASF139
+	.byte	0x32
+	.byte	0xa7
+	.byte	0x1f
+	.long	.LASF1448
+	.long	0x121
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xacc0
+	.uleb128 0xc6
+	.long	.LASF817
+	.byte	0x32
+	.byte	0xa3
+	.byte	0x21
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF1334
+	.byte	0x1
+	.byte	0x7
+	.value	0x106
+	.byte	0xc
+	.long	0xa115
+	.uleb128 0x21
+	.long	.LASF482
+	.byte	0x7
+	.value	0x107
+	.byte	0x13
+	.long	0xf355
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf355
+	.byte	0
+	.uleb128 0x9b
+	.long	.LASF1335
+	.value	0xc7e
+	.long	0xacb1
+	.uleb128 0x9b
+	.long	.LASF1336
+	.value	0xcdb
+	.long	0xacb1
+	.uleb128 0x1c
+	.long	.LASF1337
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x5
+	.long	.LASF1338
+	.long	0xf355
+	.long	0xa181
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf355
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0xfbc8
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa167
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x1
+	.long	0xa171
+	.uleb128 0x22
+	.long	0xfbc8
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1340
+	.byte	0x2
+	.value	0x554
+	.byte	0x5
+	.long	.LASF1341
+	.long	0xf404
+	.long	0xa1b4
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xf404
+	.uleb128 0x76
+	.long	.LASF1345
+	.uleb128 0x1
+	.long	0xf42c
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1342
+	.byte	0x2
+	.value	0x554
+	.byte	0x5
+	.long	.LASF1343
+	.long	0xf404
+	.long	0xa1f1
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xf404
+	.uleb128 0x12
+	.long	.LASF1345
+	.long	0xa1eb
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf45e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1346
+	.byte	0x2
+	.value	0x750
+	.byte	0x5
+	.long	.LASF1347
+	.long	0xf30d
+	.long	0xa23b
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0x9f2e
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x74e
+	.long	0xa230
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1
+	.long	0xf490
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1349
+	.byte	0x32
+	.byte	0xb5
+	.byte	0xb
+	.long	0xa0b3
+	.uleb128 0x1c
+	.long	.LASF1350
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x5
+	.long	.LASF1351
+	.long	0xf355
+	.long	0xa29b
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf355
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10202
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa281
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x1
+	.long	0xa28b
+	.uleb128 0x22
+	.long	0x10202
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1352
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x5
+	.long	.LASF1353
+	.long	0xa0fe
+	.long	0xa2dc
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0xfbc8
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa2cc
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xa171
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1355
+	.byte	0x2
+	.value	0x570
+	.byte	0x5
+	.long	.LASF1356
+	.long	0xf404
+	.long	0xa315
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0x12
+	.long	.LASF851
+	.long	0xa30f
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf490
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1357
+	.byte	0x2
+	.value	0x570
+	.byte	0x5
+	.long	.LASF1358
+	.long	0xf404
+	.long	0xa34e
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF851
+	.long	0xa348
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf490
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1359
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x5
+	.long	.LASF1360
+	.long	0xf355
+	.long	0xa38f
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa37f
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf355
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1361
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x5
+	.long	.LASF1362
+	.long	0xf30d
+	.long	0xa3e3
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf30d
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10981
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa3c9
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x1
+	.long	0xa3d3
+	.uleb128 0x22
+	.long	0x10981
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1363
+	.byte	0x2
+	.value	0x755
+	.byte	0x5
+	.long	.LASF1364
+	.long	0xf30d
+	.long	0xa410
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0x9f2e
+	.uleb128 0x1
+	.long	0xf490
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1365
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x5
+	.long	.LASF1366
+	.long	0xf355
+	.long	0xa464
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf355
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1106b
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa44a
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x1
+	.long	0xa454
+	.uleb128 0x22
+	.long	0x1106b
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1367
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x5
+	.long	.LASF1368
+	.long	0xf355
+	.long	0xa4b8
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf355
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11602
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa49e
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x1
+	.long	0xa4a8
+	.uleb128 0x22
+	.long	0x11602
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1369
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x5
+	.long	.LASF1370
+	.long	0xf30d
+	.long	0xa50c
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf30d
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11763
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa4f2
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x1
+	.long	0xa4fc
+	.uleb128 0x22
+	.long	0x11763
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1371
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x5
+	.long	.LASF1372
+	.long	0xf30d
+	.long	0xa560
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf30d
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1188a
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa546
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x1
+	.long	0xa550
+	.uleb128 0x22
+	.long	0x1188a
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1340
+	.byte	0x2
+	.value	0x559
+	.byte	0x5
+	.long	.LASF1373
+	.long	0xf404
+	.long	0xa593
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xf404
+	.uleb128 0x76
+	.long	.LASF1345
+	.uleb128 0x1
+	.long	0xf431
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1342
+	.byte	0x2
+	.value	0x559
+	.byte	0x5
+	.long	.LASF1374
+	.long	0xf404
+	.long	0xa5d0
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xf404
+	.uleb128 0x12
+	.long	.LASF1345
+	.long	0xa5ca
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf463
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1375
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x5
+	.long	.LASF1376
+	.long	0xa0fe
+	.long	0xa611
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x10202
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa601
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xa28b
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1377
+	.byte	0x5
+	.byte	0xc3
+	.byte	0x5
+	.long	.LASF1378
+	.long	0xf355
+	.long	0xa660
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0xf
+	.long	.LASF469
+	.long	0x5b7f
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa64b
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf355
+	.uleb128 0x1
+	.long	0xf3fa
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1379
+	.byte	0x2
+	.value	0x742
+	.byte	0x5
+	.long	.LASF1380
+	.long	0xf355
+	.long	0xa692
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0xfbc8
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0x9f2e
+	.uleb128 0x1
+	.long	0xa171
+	.uleb128 0x1
+	.long	0xf490
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1381
+	.byte	0x2
+	.value	0x73a
+	.byte	0x5
+	.long	.LASF1382
+	.long	0xf355
+	.long	0xa6e1
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0xfbc8
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0x9f2e
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0xa6d1
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1
+	.long	0xa171
+	.uleb128 0x1
+	.long	0xf490
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1383
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x5
+	.long	.LASF1384
+	.long	0x9a70
+	.long	0xa722
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x10981
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa712
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xa3d3
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1385
+	.byte	0x5
+	.byte	0xba
+	.byte	0x5
+	.long	.LASF1386
+	.long	0xf30d
+	.long	0xa76c
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0xf
+	.long	.LASF469
+	.long	0x5b7f
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa75c
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf3fa
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1387
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x5
+	.long	.LASF1388
+	.long	0x9f2e
+	.long	0xa7b6
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0xf
+	.long	.LASF469
+	.long	0x5b7f
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa7a6
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf3fa
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1389
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x5
+	.long	.LASF1390
+	.long	0xa0fe
+	.long	0xa7f7
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x1106b
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa7e7
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xa454
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1391
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x5
+	.long	.LASF1392
+	.long	0xa0fe
+	.long	0xa838
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x11602
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa828
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xa4a8
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1393
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x5
+	.long	.LASF1394
+	.long	0x9a70
+	.long	0xa879
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x11763
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa869
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xa4fc
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1395
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x5
+	.long	.LASF1396
+	.long	0x9a70
+	.long	0xa8ba
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x1188a
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa8aa
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xa550
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1355
+	.byte	0x2
+	.value	0x56a
+	.byte	0x5
+	.long	.LASF1397
+	.long	0xf404
+	.long	0xa8f3
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0x12
+	.long	.LASF851
+	.long	0xa8ed
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1357
+	.byte	0x2
+	.value	0x56a
+	.byte	0x5
+	.long	.LASF1398
+	.long	0xf404
+	.long	0xa92c
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF851
+	.long	0xa926
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf48b
+	.byte	0
+	.uleb128 0xc7
+	.long	.LASF2248
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x5
+	.long	0xf409
+	.long	0xa965
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x127f3
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa955
+	.uleb128 0x9
+	.long	0x127f3
+	.byte	0
+	.uleb128 0x1
+	.long	0xf409
+	.uleb128 0x1
+	.long	0xa95f
+	.uleb128 0x22
+	.long	0x127f3
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1399
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x5
+	.long	.LASF1400
+	.long	0xf481
+	.long	0xa9a6
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x9f2e
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xa996
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf481
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1401
+	.byte	0x2
+	.value	0x742
+	.byte	0x5
+	.long	.LASF1402
+	.long	0xf355
+	.long	0xa9d8
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10202
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa28b
+	.uleb128 0x1
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1403
+	.byte	0x2
+	.value	0x73a
+	.byte	0x5
+	.long	.LASF1404
+	.long	0xf355
+	.long	0xaa27
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10202
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0xaa17
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1
+	.long	0xa28b
+	.uleb128 0x1
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1405
+	.byte	0x2
+	.value	0x742
+	.byte	0x5
+	.long	.LASF1406
+	.long	0xf30d
+	.long	0xaa59
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10981
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa3d3
+	.uleb128 0x1
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1407
+	.byte	0x2
+	.value	0x73a
+	.byte	0x5
+	.long	.LASF1408
+	.long	0xf30d
+	.long	0xaaa8
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10981
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0xaa98
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1
+	.long	0xa3d3
+	.uleb128 0x1
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1409
+	.byte	0x2
+	.value	0x742
+	.byte	0x5
+	.long	.LASF1410
+	.long	0xf355
+	.long	0xaada
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1106b
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa454
+	.uleb128 0x1
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1411
+	.byte	0x2
+	.value	0x73a
+	.byte	0x5
+	.long	.LASF1412
+	.long	0xf355
+	.long	0xab29
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1106b
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0xab19
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1
+	.long	0xa454
+	.uleb128 0x1
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1413
+	.byte	0x2
+	.value	0x742
+	.byte	0x5
+	.long	.LASF1414
+	.long	0xf355
+	.long	0xab5b
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11602
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa4a8
+	.uleb128 0x1
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1415
+	.byte	0x2
+	.value	0x73a
+	.byte	0x5
+	.long	.LASF1416
+	.long	0xf355
+	.long	0xabaa
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11602
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0xab9a
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1
+	.long	0xa4a8
+	.uleb128 0x1
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1417
+	.byte	0x2
+	.value	0x742
+	.byte	0x5
+	.long	.LASF1418
+	.long	0xf30d
+	.long	0xabdc
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11763
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa4fc
+	.uleb128 0x1
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1419
+	.byte	0x2
+	.value	0x73a
+	.byte	0x5
+	.long	.LASF1420
+	.long	0xf30d
+	.long	0xac2b
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11763
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0xac1b
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1
+	.long	0xa4fc
+	.uleb128 0x1
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1421
+	.byte	0x2
+	.value	0x742
+	.byte	0x5
+	.long	.LASF1422
+	.long	0xf30d
+	.long	0xac5d
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1188a
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa550
+	.uleb128 0x1
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x9c
+	.long	.LASF1423
+	.byte	0x2
+	.value	0x73a
+	.byte	0x5
+	.long	.LASF1424
+	.long	0xf30d
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1188a
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0xac99
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1
+	.long	0xa550
+	.uleb128 0x1
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1425
+	.uleb128 0xa
+	.long	0xacaa
+	.uleb128 0x7
+	.long	0xa2
+	.uleb128 0x7
+	.long	0x110
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1426
+	.uleb128 0x2a
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1427
+	.uleb128 0x2a
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1428
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1429
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1430
+	.uleb128 0x2a
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1431
+	.uleb128 0x2a
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1432
+	.uleb128 0xc8
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0xacf1
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1433
+	.uleb128 0xa
+	.long	0xacfe
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1434
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x5
+	.long	.LASF1435
+	.uleb128 0xa
+	.long	0xad11
+	.uleb128 0x2a
+	.byte	0x1
+	.byte	0x7
+	.long	.LASF1436
+	.uleb128 0x2a
+	.byte	0x2
+	.byte	0x10
+	.long	.LASF1437
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x10
+	.long	.LASF1438
+	.uleb128 0x7
+	.long	0x1de
+	.uleb128 0x7
+	.long	0x21a
+	.uleb128 0x7
+	.long	0xad41
+	.uleb128 0xc9
+	.uleb128 0x85
+	.long	.LASF1439
+	.byte	0x8
+	.value	0x14d
+	.byte	0xb
+	.long	0xb4d1
+	.uleb128 0x45
+	.long	.LASF1440
+	.byte	0x33
+	.byte	0x25
+	.byte	0xb
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xc8
+	.byte	0xb
+	.long	0xb5b2
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xd8
+	.byte	0xb
+	.long	0xba37
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xe3
+	.byte	0xb
+	.long	0xba53
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xe4
+	.byte	0xb
+	.long	0xba6a
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xe5
+	.byte	0xb
+	.long	0xba8a
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xe7
+	.byte	0xb
+	.long	0xbaaa
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0xe8
+	.byte	0xb
+	.long	0xbac5
+	.uleb128 0x56
+	.string	"div"
+	.byte	0x10
+	.byte	0xd5
+	.long	.LASF1441
+	.long	0xb5b2
+	.long	0xadaf
+	.uleb128 0x1
+	.long	0xad0a
+	.uleb128 0x1
+	.long	0xad0a
+	.byte	0
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0xfb
+	.byte	0xb
+	.long	0xc754
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x104
+	.byte	0xb
+	.long	0xc770
+	.uleb128 0x16
+	.byte	0x14
+	.value	0x105
+	.byte	0xb
+	.long	0xc791
+	.uleb128 0x1d
+	.long	.LASF1442
+	.byte	0x1
+	.byte	0x34
+	.byte	0x30
+	.byte	0xa
+	.long	0xaefa
+	.uleb128 0x4
+	.byte	0x34
+	.byte	0x30
+	.byte	0xa
+	.long	0x18b6
+	.uleb128 0x4
+	.byte	0x34
+	.byte	0x30
+	.byte	0xa
+	.long	0x1877
+	.uleb128 0x4
+	.byte	0x34
+	.byte	0x30
+	.byte	0xa
+	.long	0x18e8
+	.uleb128 0x4
+	.byte	0x34
+	.byte	0x30
+	.byte	0xa
+	.long	0x1909
+	.uleb128 0x34
+	.long	0x185c
+	.uleb128 0x1c
+	.long	.LASF1443
+	.byte	0x34
+	.byte	0x61
+	.byte	0x1d
+	.long	.LASF1444
+	.long	0xbeb
+	.long	0xae15
+	.uleb128 0x1
+	.long	0xca7b
+	.byte	0
+	.uleb128 0x77
+	.long	.LASF1445
+	.byte	0x34
+	.byte	0x64
+	.byte	0x26
+	.long	.LASF1446
+	.long	0xae30
+	.uleb128 0x1
+	.long	0xca80
+	.uleb128 0x1
+	.long	0xca80
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF1447
+	.byte	0x34
+	.byte	0x67
+	.byte	0x1b
+	.long	.LASF1449
+	.long	0xacaa
+	.uleb128 0x38
+	.long	.LASF1450
+	.byte	0x34
+	.byte	0x6a
+	.byte	0x1b
+	.long	.LASF1451
+	.long	0xacaa
+	.uleb128 0x38
+	.long	.LASF1452
+	.byte	0x34
+	.byte	0x6d
+	.byte	0x1b
+	.long	.LASF1453
+	.long	0xacaa
+	.uleb128 0x38
+	.long	.LASF1454
+	.byte	0x34
+	.byte	0x70
+	.byte	0x1b
+	.long	.LASF1455
+	.long	0xacaa
+	.uleb128 0x38
+	.long	.LASF1456
+	.byte	0x34
+	.byte	0x73
+	.byte	0x1b
+	.long	.LASF1457
+	.long	0xacaa
+	.uleb128 0xd
+	.long	.LASF8
+	.byte	0x34
+	.byte	0x38
+	.byte	0x35
+	.long	0x193f
+	.uleb128 0xa
+	.long	0xae80
+	.uleb128 0xd
+	.long	.LASF220
+	.byte	0x34
+	.byte	0x39
+	.byte	0x35
+	.long	0x186a
+	.uleb128 0xd
+	.long	.LASF154
+	.byte	0x34
+	.byte	0x3a
+	.byte	0x35
+	.long	0x194c
+	.uleb128 0xd
+	.long	.LASF115
+	.byte	0x34
+	.byte	0x3b
+	.byte	0x35
+	.long	0x18a9
+	.uleb128 0xd
+	.long	.LASF354
+	.byte	0x34
+	.byte	0x3e
+	.byte	0x35
+	.long	0xcdbc
+	.uleb128 0xd
+	.long	.LASF146
+	.byte	0x34
+	.byte	0x3f
+	.byte	0x35
+	.long	0xcdc1
+	.uleb128 0x1d
+	.long	.LASF1458
+	.byte	0x1
+	.byte	0x34
+	.byte	0x77
+	.byte	0xe
+	.long	0xaef0
+	.uleb128 0xd
+	.long	.LASF1459
+	.byte	0x34
+	.byte	0x78
+	.byte	0x41
+	.long	0x1959
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xb5cd
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF469
+	.long	0xbeb
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF1460
+	.byte	0x8
+	.byte	0x35
+	.value	0x413
+	.byte	0xb
+	.long	0xb132
+	.uleb128 0x57
+	.long	.LASF1461
+	.byte	0x35
+	.value	0x416
+	.byte	0x11
+	.long	0xb6fa
+	.byte	0x2
+	.uleb128 0x10
+	.long	.LASF1462
+	.byte	0x35
+	.value	0x42c
+	.byte	0x1a
+	.long	.LASF1463
+	.byte	0x1
+	.long	0xaf2c
+	.long	0xaf32
+	.uleb128 0x2
+	.long	0xf4d1
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF1462
+	.byte	0x35
+	.value	0x430
+	.byte	0x7
+	.long	.LASF1464
+	.long	0xaf47
+	.long	0xaf52
+	.uleb128 0x2
+	.long	0xf4d1
+	.uleb128 0x1
+	.long	0xf4b3
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF354
+	.byte	0x35
+	.value	0x425
+	.byte	0x32
+	.long	0xa074
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF874
+	.byte	0x35
+	.value	0x447
+	.byte	0x7
+	.long	.LASF1465
+	.long	0xaf52
+	.byte	0x1
+	.long	0xaf7a
+	.long	0xaf80
+	.uleb128 0x2
+	.long	0xf4d6
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF220
+	.byte	0x35
+	.value	0x426
+	.byte	0x32
+	.long	0xa068
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF876
+	.byte	0x35
+	.value	0x44c
+	.byte	0x7
+	.long	.LASF1466
+	.long	0xaf80
+	.byte	0x1
+	.long	0xafa8
+	.long	0xafae
+	.uleb128 0x2
+	.long	0xf4d6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x35
+	.value	0x451
+	.byte	0x7
+	.long	.LASF1467
+	.long	0xf4db
+	.byte	0x1
+	.long	0xafc8
+	.long	0xafce
+	.uleb128 0x2
+	.long	0xf4d1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x35
+	.value	0x459
+	.byte	0x7
+	.long	.LASF1468
+	.long	0xaefa
+	.byte	0x1
+	.long	0xafe8
+	.long	0xaff3
+	.uleb128 0x2
+	.long	0xf4d1
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x35
+	.value	0x45f
+	.byte	0x7
+	.long	.LASF1469
+	.long	0xf4db
+	.byte	0x1
+	.long	0xb00d
+	.long	0xb013
+	.uleb128 0x2
+	.long	0xf4d1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x35
+	.value	0x467
+	.byte	0x7
+	.long	.LASF1470
+	.long	0xaefa
+	.byte	0x1
+	.long	0xb02d
+	.long	0xb038
+	.uleb128 0x2
+	.long	0xf4d1
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF147
+	.byte	0x35
+	.value	0x46d
+	.byte	0x7
+	.long	.LASF1471
+	.long	0xaf52
+	.byte	0x1
+	.long	0xb052
+	.long	0xb05d
+	.uleb128 0x2
+	.long	0xf4d6
+	.uleb128 0x1
+	.long	0xb05d
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1331
+	.byte	0x35
+	.value	0x424
+	.byte	0x38
+	.long	0xa05c
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF362
+	.byte	0x35
+	.value	0x472
+	.byte	0x7
+	.long	.LASF1472
+	.long	0xf4db
+	.byte	0x1
+	.long	0xb085
+	.long	0xb090
+	.uleb128 0x2
+	.long	0xf4d1
+	.uleb128 0x1
+	.long	0xb05d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1473
+	.byte	0x35
+	.value	0x477
+	.byte	0x7
+	.long	.LASF1474
+	.long	0xaefa
+	.byte	0x1
+	.long	0xb0aa
+	.long	0xb0b5
+	.uleb128 0x2
+	.long	0xf4d6
+	.uleb128 0x1
+	.long	0xb05d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF516
+	.byte	0x35
+	.value	0x47c
+	.byte	0x7
+	.long	.LASF1475
+	.long	0xf4db
+	.byte	0x1
+	.long	0xb0cf
+	.long	0xb0da
+	.uleb128 0x2
+	.long	0xf4d1
+	.uleb128 0x1
+	.long	0xb05d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1476
+	.byte	0x35
+	.value	0x481
+	.byte	0x7
+	.long	.LASF1477
+	.long	0xaefa
+	.byte	0x1
+	.long	0xb0f4
+	.long	0xb0ff
+	.uleb128 0x2
+	.long	0xf4d6
+	.uleb128 0x1
+	.long	0xb05d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1478
+	.byte	0x35
+	.value	0x486
+	.byte	0x7
+	.long	.LASF1479
+	.long	0xf4b3
+	.byte	0x1
+	.long	0xb119
+	.long	0xb11f
+	.uleb128 0x2
+	.long	0xf4d6
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1480
+	.long	0xb6fa
+	.uleb128 0xf
+	.long	.LASF1481
+	.long	0x1975
+	.byte	0
+	.uleb128 0xa
+	.long	0xaefa
+	.uleb128 0x41
+	.long	.LASF1482
+	.byte	0x8
+	.byte	0x35
+	.value	0x413
+	.byte	0xb
+	.long	0xb36f
+	.uleb128 0x57
+	.long	.LASF1461
+	.byte	0x35
+	.value	0x416
+	.byte	0x11
+	.long	0xb5c3
+	.byte	0x2
+	.uleb128 0x10
+	.long	.LASF1462
+	.byte	0x35
+	.value	0x42c
+	.byte	0x1a
+	.long	.LASF1483
+	.byte	0x1
+	.long	0xb169
+	.long	0xb16f
+	.uleb128 0x2
+	.long	0xf4b8
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF1462
+	.byte	0x35
+	.value	0x430
+	.byte	0x7
+	.long	.LASF1484
+	.long	0xb184
+	.long	0xb18f
+	.uleb128 0x2
+	.long	0xf4b8
+	.uleb128 0x1
+	.long	0xf4bd
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF354
+	.byte	0x35
+	.value	0x425
+	.byte	0x32
+	.long	0xa0a6
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF874
+	.byte	0x35
+	.value	0x447
+	.byte	0x7
+	.long	.LASF1485
+	.long	0xb18f
+	.byte	0x1
+	.long	0xb1b7
+	.long	0xb1bd
+	.uleb128 0x2
+	.long	0xf4c2
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF220
+	.byte	0x35
+	.value	0x426
+	.byte	0x32
+	.long	0xa09a
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF876
+	.byte	0x35
+	.value	0x44c
+	.byte	0x7
+	.long	.LASF1486
+	.long	0xb1bd
+	.byte	0x1
+	.long	0xb1e5
+	.long	0xb1eb
+	.uleb128 0x2
+	.long	0xf4c2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x35
+	.value	0x451
+	.byte	0x7
+	.long	.LASF1487
+	.long	0xf4c7
+	.byte	0x1
+	.long	0xb205
+	.long	0xb20b
+	.uleb128 0x2
+	.long	0xf4b8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF504
+	.byte	0x35
+	.value	0x459
+	.byte	0x7
+	.long	.LASF1488
+	.long	0xb137
+	.byte	0x1
+	.long	0xb225
+	.long	0xb230
+	.uleb128 0x2
+	.long	0xf4b8
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x35
+	.value	0x45f
+	.byte	0x7
+	.long	.LASF1489
+	.long	0xf4c7
+	.byte	0x1
+	.long	0xb24a
+	.long	0xb250
+	.uleb128 0x2
+	.long	0xf4b8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF507
+	.byte	0x35
+	.value	0x467
+	.byte	0x7
+	.long	.LASF1490
+	.long	0xb137
+	.byte	0x1
+	.long	0xb26a
+	.long	0xb275
+	.uleb128 0x2
+	.long	0xf4b8
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF147
+	.byte	0x35
+	.value	0x46d
+	.byte	0x7
+	.long	.LASF1491
+	.long	0xb18f
+	.byte	0x1
+	.long	0xb28f
+	.long	0xb29a
+	.uleb128 0x2
+	.long	0xf4c2
+	.uleb128 0x1
+	.long	0xb29a
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1331
+	.byte	0x35
+	.value	0x424
+	.byte	0x38
+	.long	0xa08e
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF362
+	.byte	0x35
+	.value	0x472
+	.byte	0x7
+	.long	.LASF1492
+	.long	0xf4c7
+	.byte	0x1
+	.long	0xb2c2
+	.long	0xb2cd
+	.uleb128 0x2
+	.long	0xf4b8
+	.uleb128 0x1
+	.long	0xb29a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1473
+	.byte	0x35
+	.value	0x477
+	.byte	0x7
+	.long	.LASF1493
+	.long	0xb137
+	.byte	0x1
+	.long	0xb2e7
+	.long	0xb2f2
+	.uleb128 0x2
+	.long	0xf4c2
+	.uleb128 0x1
+	.long	0xb29a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF516
+	.byte	0x35
+	.value	0x47c
+	.byte	0x7
+	.long	.LASF1494
+	.long	0xf4c7
+	.byte	0x1
+	.long	0xb30c
+	.long	0xb317
+	.uleb128 0x2
+	.long	0xf4b8
+	.uleb128 0x1
+	.long	0xb29a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1476
+	.byte	0x35
+	.value	0x481
+	.byte	0x7
+	.long	.LASF1495
+	.long	0xb137
+	.byte	0x1
+	.long	0xb331
+	.long	0xb33c
+	.uleb128 0x2
+	.long	0xf4c2
+	.uleb128 0x1
+	.long	0xb29a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1478
+	.byte	0x35
+	.value	0x486
+	.byte	0x7
+	.long	.LASF1496
+	.long	0xf4bd
+	.byte	0x1
+	.long	0xb356
+	.long	0xb35c
+	.uleb128 0x2
+	.long	0xf4c2
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1480
+	.long	0xb5c3
+	.uleb128 0xf
+	.long	.LASF1481
+	.long	0x1975
+	.byte	0
+	.uleb128 0xa
+	.long	0xb137
+	.uleb128 0xca
+	.long	.LASF2060
+	.byte	0x7
+	.byte	0x4
+	.long	0xacd5
+	.byte	0x44
+	.byte	0x31
+	.byte	0x8
+	.long	0xb39a
+	.uleb128 0x11
+	.long	.LASF1497
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1498
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF1499
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	0xb374
+	.uleb128 0x9d
+	.long	.LASF1613
+	.byte	0x44
+	.byte	0x35
+	.byte	0x1d
+	.long	0xb39a
+	.byte	0x2
+	.uleb128 0x1d
+	.long	.LASF1500
+	.byte	0x1
+	.byte	0x34
+	.byte	0x30
+	.byte	0xa
+	.long	0xb4c6
+	.uleb128 0x4
+	.byte	0x34
+	.byte	0x30
+	.byte	0xa
+	.long	0x7b4c
+	.uleb128 0x4
+	.byte	0x34
+	.byte	0x30
+	.byte	0xa
+	.long	0x7b0d
+	.uleb128 0x4
+	.byte	0x34
+	.byte	0x30
+	.byte	0xa
+	.long	0x7b7e
+	.uleb128 0x4
+	.byte	0x34
+	.byte	0x30
+	.byte	0xa
+	.long	0x7b9f
+	.uleb128 0x34
+	.long	0x7af2
+	.uleb128 0x1c
+	.long	.LASF1443
+	.byte	0x34
+	.byte	0x61
+	.byte	0x1d
+	.long	.LASF1501
+	.long	0x7a15
+	.long	0xb3f9
+	.uleb128 0x1
+	.long	0xec80
+	.byte	0
+	.uleb128 0x77
+	.long	.LASF1445
+	.byte	0x34
+	.byte	0x64
+	.byte	0x26
+	.long	.LASF1502
+	.long	0xb414
+	.uleb128 0x1
+	.long	0xec85
+	.uleb128 0x1
+	.long	0xec85
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF1447
+	.byte	0x34
+	.byte	0x67
+	.byte	0x1b
+	.long	.LASF1503
+	.long	0xacaa
+	.uleb128 0x38
+	.long	.LASF1450
+	.byte	0x34
+	.byte	0x6a
+	.byte	0x1b
+	.long	.LASF1504
+	.long	0xacaa
+	.uleb128 0x38
+	.long	.LASF1452
+	.byte	0x34
+	.byte	0x6d
+	.byte	0x1b
+	.long	.LASF1505
+	.long	0xacaa
+	.uleb128 0x38
+	.long	.LASF1454
+	.byte	0x34
+	.byte	0x70
+	.byte	0x1b
+	.long	.LASF1506
+	.long	0xacaa
+	.uleb128 0x38
+	.long	.LASF1456
+	.byte	0x34
+	.byte	0x73
+	.byte	0x1b
+	.long	.LASF1507
+	.long	0xacaa
+	.uleb128 0xd
+	.long	.LASF8
+	.byte	0x34
+	.byte	0x38
+	.byte	0x35
+	.long	0x7bd5
+	.uleb128 0xa
+	.long	0xb464
+	.uleb128 0xd
+	.long	.LASF220
+	.byte	0x34
+	.byte	0x39
+	.byte	0x35
+	.long	0x7b00
+	.uleb128 0xd
+	.long	.LASF354
+	.byte	0x34
+	.byte	0x3e
+	.byte	0x35
+	.long	0xec94
+	.uleb128 0xd
+	.long	.LASF146
+	.byte	0x34
+	.byte	0x3f
+	.byte	0x35
+	.long	0xec99
+	.uleb128 0x1d
+	.long	.LASF1508
+	.byte	0x1
+	.byte	0x34
+	.byte	0x77
+	.byte	0xe
+	.long	0xb4bc
+	.uleb128 0xd
+	.long	.LASF1459
+	.byte	0x34
+	.byte	0x78
+	.byte	0x41
+	.long	0x7be2
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF469
+	.long	0x7a15
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF1509
+	.uleb128 0x3e
+	.long	.LASF1510
+	.byte	0
+	.uleb128 0x2a
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1511
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1512
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1513
+	.uleb128 0x2a
+	.byte	0x10
+	.byte	0x5
+	.long	.LASF1514
+	.uleb128 0x39
+	.long	.LASF1515
+	.byte	0x36
+	.byte	0x2b
+	.byte	0xb
+	.long	0xb503
+	.uleb128 0x88
+	.byte	0xf
+	.byte	0x3a
+	.byte	0x18
+	.long	0x256
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF13
+	.byte	0x37
+	.byte	0xd6
+	.byte	0x17
+	.long	0xacc0
+	.uleb128 0xa
+	.long	0xb503
+	.uleb128 0x2a
+	.byte	0x20
+	.byte	0x3
+	.long	.LASF1516
+	.uleb128 0x2a
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1517
+	.uleb128 0x78
+	.byte	0x8
+	.byte	0x38
+	.byte	0x3c
+	.byte	0x3
+	.long	.LASF1520
+	.long	0xb54a
+	.uleb128 0xc
+	.long	.LASF1518
+	.byte	0x38
+	.byte	0x3d
+	.byte	0x9
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x59
+	.string	"rem"
+	.byte	0x38
+	.byte	0x3e
+	.byte	0x9
+	.long	0xacf1
+	.byte	0x4
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1519
+	.byte	0x38
+	.byte	0x3f
+	.byte	0x5
+	.long	0xb522
+	.uleb128 0x78
+	.byte	0x10
+	.byte	0x38
+	.byte	0x44
+	.byte	0x3
+	.long	.LASF1521
+	.long	0xb57e
+	.uleb128 0xc
+	.long	.LASF1518
+	.byte	0x38
+	.byte	0x45
+	.byte	0xe
+	.long	0xacfe
+	.byte	0
+	.uleb128 0x59
+	.string	"rem"
+	.byte	0x38
+	.byte	0x46
+	.byte	0xe
+	.long	0xacfe
+	.byte	0x8
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1522
+	.byte	0x38
+	.byte	0x47
+	.byte	0x5
+	.long	0xb556
+	.uleb128 0x78
+	.byte	0x10
+	.byte	0x38
+	.byte	0x4e
+	.byte	0x3
+	.long	.LASF1523
+	.long	0xb5b2
+	.uleb128 0xc
+	.long	.LASF1518
+	.byte	0x38
+	.byte	0x4f
+	.byte	0x13
+	.long	0xad0a
+	.byte	0
+	.uleb128 0x59
+	.string	"rem"
+	.byte	0x38
+	.byte	0x50
+	.byte	0x13
+	.long	0xad0a
+	.byte	0x8
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1524
+	.byte	0x38
+	.byte	0x51
+	.byte	0x5
+	.long	0xb58a
+	.uleb128 0x7
+	.long	0xacf9
+	.uleb128 0x7
+	.long	0xb5d4
+	.uleb128 0xa
+	.long	0xb5c3
+	.uleb128 0x2a
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1525
+	.uleb128 0xa
+	.long	0xb5cd
+	.uleb128 0xd
+	.long	.LASF1526
+	.byte	0x39
+	.byte	0x25
+	.byte	0x15
+	.long	0xace3
+	.uleb128 0xd
+	.long	.LASF1527
+	.byte	0x39
+	.byte	0x26
+	.byte	0x17
+	.long	0xacc7
+	.uleb128 0xd
+	.long	.LASF1528
+	.byte	0x39
+	.byte	0x27
+	.byte	0x1a
+	.long	0xacea
+	.uleb128 0xd
+	.long	.LASF1529
+	.byte	0x39
+	.byte	0x28
+	.byte	0x1c
+	.long	0xacce
+	.uleb128 0xd
+	.long	.LASF1530
+	.byte	0x39
+	.byte	0x29
+	.byte	0x14
+	.long	0xacf1
+	.uleb128 0xa
+	.long	0xb609
+	.uleb128 0xd
+	.long	.LASF1531
+	.byte	0x39
+	.byte	0x2a
+	.byte	0x16
+	.long	0xacd5
+	.uleb128 0xd
+	.long	.LASF1532
+	.byte	0x39
+	.byte	0x2c
+	.byte	0x19
+	.long	0xacfe
+	.uleb128 0xd
+	.long	.LASF1533
+	.byte	0x39
+	.byte	0x2d
+	.byte	0x1b
+	.long	0xacc0
+	.uleb128 0xd
+	.long	.LASF1534
+	.byte	0x39
+	.byte	0x34
+	.byte	0x12
+	.long	0xb5d9
+	.uleb128 0xd
+	.long	.LASF1535
+	.byte	0x39
+	.byte	0x35
+	.byte	0x13
+	.long	0xb5e5
+	.uleb128 0xd
+	.long	.LASF1536
+	.byte	0x39
+	.byte	0x36
+	.byte	0x13
+	.long	0xb5f1
+	.uleb128 0xd
+	.long	.LASF1537
+	.byte	0x39
+	.byte	0x37
+	.byte	0x14
+	.long	0xb5fd
+	.uleb128 0xd
+	.long	.LASF1538
+	.byte	0x39
+	.byte	0x38
+	.byte	0x13
+	.long	0xb609
+	.uleb128 0xd
+	.long	.LASF1539
+	.byte	0x39
+	.byte	0x39
+	.byte	0x14
+	.long	0xb61a
+	.uleb128 0xd
+	.long	.LASF1540
+	.byte	0x39
+	.byte	0x3a
+	.byte	0x13
+	.long	0xb626
+	.uleb128 0xd
+	.long	.LASF1541
+	.byte	0x39
+	.byte	0x3b
+	.byte	0x14
+	.long	0xb632
+	.uleb128 0xd
+	.long	.LASF1542
+	.byte	0x39
+	.byte	0x48
+	.byte	0x12
+	.long	0xacfe
+	.uleb128 0xd
+	.long	.LASF1543
+	.byte	0x39
+	.byte	0x49
+	.byte	0x1b
+	.long	0xacc0
+	.uleb128 0xd
+	.long	.LASF1544
+	.byte	0x39
+	.byte	0x98
+	.byte	0x19
+	.long	0xacfe
+	.uleb128 0xd
+	.long	.LASF1545
+	.byte	0x39
+	.byte	0x99
+	.byte	0x1b
+	.long	0xacfe
+	.uleb128 0xd
+	.long	.LASF1546
+	.byte	0x39
+	.byte	0x9c
+	.byte	0x1b
+	.long	0xacfe
+	.uleb128 0xd
+	.long	.LASF1547
+	.byte	0x39
+	.byte	0xa0
+	.byte	0x1a
+	.long	0xacfe
+	.uleb128 0xcb
+	.byte	0x8
+	.uleb128 0xa
+	.long	0xb6e6
+	.uleb128 0xd
+	.long	.LASF1548
+	.byte	0x39
+	.byte	0xc5
+	.byte	0x21
+	.long	0xacfe
+	.uleb128 0x7
+	.long	0xb5cd
+	.uleb128 0xa
+	.long	0xb6fa
+	.uleb128 0xd
+	.long	.LASF1549
+	.byte	0x3a
+	.byte	0x7
+	.byte	0x13
+	.long	0xb6ce
+	.uleb128 0xd
+	.long	.LASF1550
+	.byte	0x3b
+	.byte	0xa
+	.byte	0x12
+	.long	0xb6da
+	.uleb128 0xa
+	.long	0xb710
+	.uleb128 0xd
+	.long	.LASF1551
+	.byte	0x3c
+	.byte	0x18
+	.byte	0x12
+	.long	0xb5d9
+	.uleb128 0xd
+	.long	.LASF1552
+	.byte	0x3c
+	.byte	0x19
+	.byte	0x13
+	.long	0xb5f1
+	.uleb128 0xd
+	.long	.LASF1553
+	.byte	0x3c
+	.byte	0x1a
+	.byte	0x13
+	.long	0xb609
+	.uleb128 0xd
+	.long	.LASF1554
+	.byte	0x3c
+	.byte	0x1b
+	.byte	0x13
+	.long	0xb626
+	.uleb128 0x1d
+	.long	.LASF1555
+	.byte	0x10
+	.byte	0x3d
+	.byte	0xb
+	.byte	0x8
+	.long	0xb779
+	.uleb128 0xc
+	.long	.LASF1556
+	.byte	0x3d
+	.byte	0x10
+	.byte	0xc
+	.long	0xb6da
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1557
+	.byte	0x3d
+	.byte	0x15
+	.byte	0x15
+	.long	0xb6ee
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5a
+	.long	0xb5cd
+	.long	0xb789
+	.uleb128 0x5b
+	.long	0xacc0
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5a
+	.long	0xb5cd
+	.long	0xb799
+	.uleb128 0x5b
+	.long	0xacc0
+	.byte	0x37
+	.byte	0
+	.uleb128 0x5a
+	.long	0xb5cd
+	.long	0xb7a9
+	.uleb128 0x5b
+	.long	0xacc0
+	.byte	0x27
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1558
+	.byte	0x38
+	.value	0x33d
+	.byte	0xf
+	.long	0xb7b6
+	.uleb128 0x7
+	.long	0xb7bb
+	.uleb128 0x5c
+	.long	0xacf1
+	.long	0xb7cf
+	.uleb128 0x1
+	.long	0xad3c
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1559
+	.byte	0x38
+	.value	0x267
+	.byte	0xc
+	.long	0xacf1
+	.long	0xb7e6
+	.uleb128 0x1
+	.long	0xb7e6
+	.byte	0
+	.uleb128 0x7
+	.long	0xb7eb
+	.uleb128 0xcc
+	.uleb128 0x14
+	.long	.LASF1560
+	.byte	0x38
+	.value	0x26c
+	.byte	0x12
+	.long	.LASF1560
+	.long	0xacf1
+	.long	0xb808
+	.uleb128 0x1
+	.long	0xb7e6
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1561
+	.byte	0x3e
+	.byte	0x19
+	.byte	0x1
+	.long	0xb4d8
+	.long	0xb81e
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1562
+	.byte	0x38
+	.value	0x16a
+	.byte	0x1
+	.long	0xacf1
+	.long	0xb835
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1563
+	.byte	0x38
+	.value	0x16f
+	.byte	0x1
+	.long	0xacfe
+	.long	0xb84c
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1564
+	.byte	0x3f
+	.byte	0x14
+	.byte	0x1
+	.long	0xb6e6
+	.long	0xb876
+	.uleb128 0x1
+	.long	0xad3c
+	.uleb128 0x1
+	.long	0xad3c
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xb7a9
+	.byte	0
+	.uleb128 0xcd
+	.string	"div"
+	.byte	0x38
+	.value	0x369
+	.byte	0xe
+	.long	0xb54a
+	.long	0xb893
+	.uleb128 0x1
+	.long	0xacf1
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1565
+	.byte	0x38
+	.value	0x28e
+	.byte	0xe
+	.long	0xb6fa
+	.long	0xb8aa
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1566
+	.byte	0x38
+	.value	0x36b
+	.byte	0xf
+	.long	0xb57e
+	.long	0xb8c6
+	.uleb128 0x1
+	.long	0xacfe
+	.uleb128 0x1
+	.long	0xacfe
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1567
+	.byte	0x38
+	.value	0x3af
+	.byte	0xc
+	.long	0xacf1
+	.long	0xb8e2
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1568
+	.byte	0x38
+	.value	0x3ba
+	.byte	0xf
+	.long	0xb503
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x7
+	.long	0xad11
+	.uleb128 0x17
+	.long	.LASF1569
+	.byte	0x38
+	.value	0x3b2
+	.byte	0xc
+	.long	0xacf1
+	.long	0xb929
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x65
+	.long	.LASF1573
+	.byte	0x38
+	.value	0x353
+	.long	0xb94a
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xb7a9
+	.byte	0
+	.uleb128 0xce
+	.long	.LASF1570
+	.byte	0x38
+	.value	0x283
+	.byte	0xd
+	.long	0xb95e
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x9e
+	.long	.LASF1572
+	.byte	0x38
+	.value	0x1c6
+	.byte	0xc
+	.long	0xacf1
+	.uleb128 0x65
+	.long	.LASF1574
+	.byte	0x38
+	.value	0x1c8
+	.long	0xb97e
+	.uleb128 0x1
+	.long	0xacd5
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1575
+	.byte	0x38
+	.byte	0x76
+	.byte	0xf
+	.long	0xb4d8
+	.long	0xb999
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb999
+	.byte	0
+	.uleb128 0x7
+	.long	0xb6fa
+	.uleb128 0x1e
+	.long	.LASF1576
+	.byte	0x38
+	.byte	0xb1
+	.byte	0x11
+	.long	0xacfe
+	.long	0xb9be
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb999
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1577
+	.byte	0x38
+	.byte	0xb5
+	.byte	0x1a
+	.long	0xacc0
+	.long	0xb9de
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb999
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1578
+	.byte	0x38
+	.value	0x324
+	.byte	0xc
+	.long	0xacf1
+	.long	0xb9f5
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1579
+	.byte	0x38
+	.value	0x3be
+	.byte	0xf
+	.long	0xb503
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x7
+	.long	0xad18
+	.uleb128 0x17
+	.long	.LASF1580
+	.byte	0x38
+	.value	0x3b6
+	.byte	0xc
+	.long	0xacf1
+	.long	0xba37
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xad11
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1581
+	.byte	0x38
+	.value	0x36f
+	.byte	0x1e
+	.long	0xb5b2
+	.long	0xba53
+	.uleb128 0x1
+	.long	0xad0a
+	.uleb128 0x1
+	.long	0xad0a
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1582
+	.byte	0x38
+	.value	0x176
+	.byte	0x1
+	.long	0xad0a
+	.long	0xba6a
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1583
+	.byte	0x38
+	.byte	0xc9
+	.byte	0x16
+	.long	0xad0a
+	.long	0xba8a
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb999
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1584
+	.byte	0x38
+	.byte	0xce
+	.byte	0x1f
+	.long	0xacdc
+	.long	0xbaaa
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb999
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1585
+	.byte	0x38
+	.byte	0x7c
+	.byte	0xe
+	.long	0xb4df
+	.long	0xbac5
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb999
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1586
+	.byte	0x38
+	.byte	0x7f
+	.byte	0x14
+	.long	0xb4d1
+	.long	0xbae0
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb999
+	.byte	0
+	.uleb128 0x2a
+	.byte	0x10
+	.byte	0x7
+	.long	.LASF1587
+	.uleb128 0x39
+	.long	.LASF1588
+	.byte	0x40
+	.byte	0xf
+	.byte	0xb
+	.long	0xbc94
+	.uleb128 0x39
+	.long	.LASF65
+	.byte	0x40
+	.byte	0x11
+	.byte	0xb
+	.long	0xbc35
+	.uleb128 0xcf
+	.string	"v1"
+	.byte	0x40
+	.byte	0x13
+	.byte	0x12
+	.uleb128 0x29
+	.long	.LASF1589
+	.byte	0x1
+	.byte	0x40
+	.byte	0x17
+	.byte	0x7
+	.long	0xbb3f
+	.uleb128 0x42
+	.long	.LASF1590
+	.byte	0x1c
+	.long	.LASF1592
+	.long	0x115
+	.uleb128 0x42
+	.long	.LASF1591
+	.byte	0x21
+	.long	.LASF1593
+	.long	0x115
+	.uleb128 0x42
+	.long	.LASF1594
+	.byte	0x26
+	.long	.LASF1595
+	.long	0x115
+	.byte	0
+	.uleb128 0xa
+	.long	0xbb07
+	.uleb128 0x29
+	.long	.LASF1596
+	.byte	0x1
+	.byte	0x40
+	.byte	0x2d
+	.byte	0x7
+	.long	0xbb7c
+	.uleb128 0x42
+	.long	.LASF1590
+	.byte	0x32
+	.long	.LASF1597
+	.long	0x115
+	.uleb128 0x42
+	.long	.LASF1591
+	.byte	0x37
+	.long	.LASF1598
+	.long	0x115
+	.uleb128 0x42
+	.long	.LASF1594
+	.byte	0x3c
+	.long	.LASF1599
+	.long	0x366
+	.byte	0
+	.uleb128 0xa
+	.long	0xbb44
+	.uleb128 0x29
+	.long	.LASF1600
+	.byte	0x1
+	.byte	0x40
+	.byte	0x43
+	.byte	0x7
+	.long	0xbbb9
+	.uleb128 0x42
+	.long	.LASF1590
+	.byte	0x48
+	.long	.LASF1601
+	.long	0x366
+	.uleb128 0x42
+	.long	.LASF1591
+	.byte	0x4d
+	.long	.LASF1602
+	.long	0x366
+	.uleb128 0x42
+	.long	.LASF1594
+	.byte	0x52
+	.long	.LASF1603
+	.long	0x366
+	.byte	0
+	.uleb128 0xa
+	.long	0xbb81
+	.uleb128 0x29
+	.long	.LASF1604
+	.byte	0x1
+	.byte	0x40
+	.byte	0x58
+	.byte	0x7
+	.long	0xbbf6
+	.uleb128 0x42
+	.long	.LASF1590
+	.byte	0x5d
+	.long	.LASF1605
+	.long	0x366
+	.uleb128 0x42
+	.long	.LASF1591
+	.byte	0x62
+	.long	.LASF1606
+	.long	0x366
+	.uleb128 0x42
+	.long	.LASF1594
+	.byte	0x67
+	.long	.LASF1607
+	.long	0x115
+	.byte	0
+	.uleb128 0xa
+	.long	0xbbbe
+	.uleb128 0x9f
+	.string	"seq"
+	.byte	0x6e
+	.byte	0x1c
+	.long	0xbb3f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9f
+	.string	"par"
+	.byte	0x6f
+	.byte	0x1b
+	.long	0xbb7c
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa0
+	.long	.LASF1608
+	.byte	0x70
+	.byte	0x27
+	.long	0xbbb9
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa0
+	.long	.LASF1609
+	.byte	0x71
+	.byte	0x1e
+	.long	0xbbf6
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF1610
+	.byte	0x40
+	.byte	0x92
+	.byte	0xb
+	.long	0xbc5b
+	.uleb128 0x88
+	.byte	0x41
+	.byte	0x17
+	.byte	0x19
+	.long	0xbaf3
+	.uleb128 0xd0
+	.long	.LASF1611
+	.byte	0x42
+	.value	0xae6
+	.byte	0x10
+	.long	0xacf9
+	.value	0x3e8
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF1612
+	.byte	0x43
+	.byte	0x15
+	.byte	0xb
+	.long	0xbc76
+	.uleb128 0x9d
+	.long	.LASF1614
+	.byte	0x43
+	.byte	0x19
+	.byte	0x13
+	.long	0x12e
+	.byte	0x40
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF1615
+	.byte	0x45
+	.byte	0x14
+	.byte	0xb
+	.uleb128 0x45
+	.long	.LASF1616
+	.byte	0x46
+	.byte	0x22
+	.byte	0xb
+	.uleb128 0xd1
+	.long	.LASF2207
+	.byte	0x71
+	.byte	0x17
+	.byte	0x28
+	.long	0xbc7e
+	.byte	0
+	.uleb128 0x31
+	.long	0xbbfb
+	.uleb128 0x31
+	.long	0xbc09
+	.uleb128 0x31
+	.long	0xbc17
+	.uleb128 0x31
+	.long	0xbc25
+	.uleb128 0xd2
+	.byte	0x20
+	.byte	0x10
+	.byte	0x37
+	.value	0x1a8
+	.byte	0x10
+	.long	.LASF2343
+	.long	0xbcd7
+	.uleb128 0xa1
+	.long	.LASF1617
+	.value	0x1a9
+	.byte	0xd
+	.long	0xad0a
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa1
+	.long	.LASF1618
+	.value	0x1aa
+	.byte	0xf
+	.long	0xb4d1
+	.byte	0x10
+	.byte	0x10
+	.byte	0
+	.uleb128 0xd3
+	.long	.LASF1619
+	.byte	0x37
+	.value	0x1b3
+	.byte	0x3
+	.long	0xbca8
+	.byte	0x10
+	.uleb128 0xd4
+	.long	.LASF2344
+	.uleb128 0x7
+	.long	0x37e
+	.uleb128 0x7
+	.long	0x548
+	.uleb128 0xb
+	.long	0x548
+	.uleb128 0x22
+	.long	0x37e
+	.uleb128 0xb
+	.long	0x37e
+	.uleb128 0x7
+	.long	0x587
+	.uleb128 0xd5
+	.long	.LASF2345
+	.byte	0x18
+	.byte	0x47
+	.byte	0
+	.long	0xbd40
+	.uleb128 0x79
+	.long	.LASF1620
+	.long	0xacd5
+	.byte	0
+	.uleb128 0x79
+	.long	.LASF1621
+	.long	0xacd5
+	.byte	0x4
+	.uleb128 0x79
+	.long	.LASF1622
+	.long	0xb6e6
+	.byte	0x8
+	.uleb128 0x79
+	.long	.LASF1623
+	.long	0xb6e6
+	.byte	0x10
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1624
+	.byte	0x48
+	.byte	0x14
+	.byte	0x17
+	.long	0xacd5
+	.uleb128 0x78
+	.byte	0x8
+	.byte	0x49
+	.byte	0xe
+	.byte	0x1
+	.long	.LASF1625
+	.long	0xbd97
+	.uleb128 0x82
+	.byte	0x4
+	.byte	0x49
+	.byte	0x11
+	.byte	0x3
+	.long	0xbd7c
+	.uleb128 0x4f
+	.long	.LASF1626
+	.byte	0x49
+	.byte	0x12
+	.byte	0x13
+	.long	0xacd5
+	.uleb128 0x4f
+	.long	.LASF1627
+	.byte	0x49
+	.byte	0x13
+	.byte	0xa
+	.long	0xb779
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1628
+	.byte	0x49
+	.byte	0xf
+	.byte	0x7
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1629
+	.byte	0x49
+	.byte	0x14
+	.byte	0x5
+	.long	0xbd59
+	.byte	0x4
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1630
+	.byte	0x49
+	.byte	0x15
+	.byte	0x3
+	.long	0xbd4c
+	.uleb128 0xd
+	.long	.LASF1631
+	.byte	0x4a
+	.byte	0x6
+	.byte	0x15
+	.long	0xbd97
+	.uleb128 0xa
+	.long	0xbda3
+	.uleb128 0xd
+	.long	.LASF1632
+	.byte	0x4b
+	.byte	0x5
+	.byte	0x19
+	.long	0xbdc0
+	.uleb128 0x1d
+	.long	.LASF1633
+	.byte	0xd8
+	.byte	0x4c
+	.byte	0x31
+	.byte	0x8
+	.long	0xbf47
+	.uleb128 0xc
+	.long	.LASF1634
+	.byte	0x4c
+	.byte	0x33
+	.byte	0x7
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1635
+	.byte	0x4c
+	.byte	0x36
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF1636
+	.byte	0x4c
+	.byte	0x37
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x10
+	.uleb128 0xc
+	.long	.LASF1637
+	.byte	0x4c
+	.byte	0x38
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x18
+	.uleb128 0xc
+	.long	.LASF1638
+	.byte	0x4c
+	.byte	0x39
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x20
+	.uleb128 0xc
+	.long	.LASF1639
+	.byte	0x4c
+	.byte	0x3a
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x28
+	.uleb128 0xc
+	.long	.LASF1640
+	.byte	0x4c
+	.byte	0x3b
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x30
+	.uleb128 0xc
+	.long	.LASF1641
+	.byte	0x4c
+	.byte	0x3c
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x38
+	.uleb128 0xc
+	.long	.LASF1642
+	.byte	0x4c
+	.byte	0x3d
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x40
+	.uleb128 0xc
+	.long	.LASF1643
+	.byte	0x4c
+	.byte	0x40
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x48
+	.uleb128 0xc
+	.long	.LASF1644
+	.byte	0x4c
+	.byte	0x41
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x50
+	.uleb128 0xc
+	.long	.LASF1645
+	.byte	0x4c
+	.byte	0x42
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x58
+	.uleb128 0xc
+	.long	.LASF1646
+	.byte	0x4c
+	.byte	0x44
+	.byte	0x16
+	.long	0xcae5
+	.byte	0x60
+	.uleb128 0xc
+	.long	.LASF1647
+	.byte	0x4c
+	.byte	0x46
+	.byte	0x14
+	.long	0xcaea
+	.byte	0x68
+	.uleb128 0xc
+	.long	.LASF1648
+	.byte	0x4c
+	.byte	0x48
+	.byte	0x7
+	.long	0xacf1
+	.byte	0x70
+	.uleb128 0xc
+	.long	.LASF1649
+	.byte	0x4c
+	.byte	0x49
+	.byte	0x7
+	.long	0xacf1
+	.byte	0x74
+	.uleb128 0xc
+	.long	.LASF1650
+	.byte	0x4c
+	.byte	0x4a
+	.byte	0xb
+	.long	0xb6b6
+	.byte	0x78
+	.uleb128 0xc
+	.long	.LASF1651
+	.byte	0x4c
+	.byte	0x4d
+	.byte	0x12
+	.long	0xacce
+	.byte	0x80
+	.uleb128 0xc
+	.long	.LASF1652
+	.byte	0x4c
+	.byte	0x4e
+	.byte	0xf
+	.long	0xace3
+	.byte	0x82
+	.uleb128 0xc
+	.long	.LASF1653
+	.byte	0x4c
+	.byte	0x4f
+	.byte	0x8
+	.long	0xcaef
+	.byte	0x83
+	.uleb128 0xc
+	.long	.LASF1654
+	.byte	0x4c
+	.byte	0x51
+	.byte	0xf
+	.long	0xcaff
+	.byte	0x88
+	.uleb128 0xc
+	.long	.LASF1655
+	.byte	0x4c
+	.byte	0x59
+	.byte	0xd
+	.long	0xb6c2
+	.byte	0x90
+	.uleb128 0xc
+	.long	.LASF1656
+	.byte	0x4c
+	.byte	0x5b
+	.byte	0x17
+	.long	0xcb09
+	.byte	0x98
+	.uleb128 0xc
+	.long	.LASF1657
+	.byte	0x4c
+	.byte	0x5c
+	.byte	0x19
+	.long	0xcb13
+	.byte	0xa0
+	.uleb128 0xc
+	.long	.LASF1658
+	.byte	0x4c
+	.byte	0x5d
+	.byte	0x14
+	.long	0xcaea
+	.byte	0xa8
+	.uleb128 0xc
+	.long	.LASF1659
+	.byte	0x4c
+	.byte	0x5e
+	.byte	0x9
+	.long	0xb6e6
+	.byte	0xb0
+	.uleb128 0xc
+	.long	.LASF1660
+	.byte	0x4c
+	.byte	0x5f
+	.byte	0xa
+	.long	0xb503
+	.byte	0xb8
+	.uleb128 0xc
+	.long	.LASF1661
+	.byte	0x4c
+	.byte	0x60
+	.byte	0x7
+	.long	0xacf1
+	.byte	0xc0
+	.uleb128 0xc
+	.long	.LASF1662
+	.byte	0x4c
+	.byte	0x62
+	.byte	0x8
+	.long	0xcb18
+	.byte	0xc4
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1663
+	.byte	0x4d
+	.byte	0x7
+	.byte	0x19
+	.long	0xbdc0
+	.uleb128 0x17
+	.long	.LASF1664
+	.byte	0x4e
+	.value	0x13f
+	.byte	0x1
+	.long	0xbd40
+	.long	0xbf6a
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1665
+	.byte	0x4e
+	.value	0x2e8
+	.byte	0xf
+	.long	0xbd40
+	.long	0xbf81
+	.uleb128 0x1
+	.long	0xbf81
+	.byte	0
+	.uleb128 0x7
+	.long	0xbdb4
+	.uleb128 0x17
+	.long	.LASF1666
+	.byte	0x4e
+	.value	0x305
+	.byte	0x11
+	.long	0xb903
+	.long	0xbfa7
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xacf1
+	.uleb128 0x1
+	.long	0xbf81
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1667
+	.byte	0x4e
+	.value	0x2f6
+	.byte	0xf
+	.long	0xbd40
+	.long	0xbfc3
+	.uleb128 0x1
+	.long	0xad11
+	.uleb128 0x1
+	.long	0xbf81
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1668
+	.byte	0x4e
+	.value	0x30c
+	.byte	0xc
+	.long	0xacf1
+	.long	0xbfdf
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xbf81
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1669
+	.byte	0x4e
+	.value	0x24c
+	.byte	0xc
+	.long	0xacf1
+	.long	0xbffb
+	.uleb128 0x1
+	.long	0xbf81
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1670
+	.byte	0x4e
+	.value	0x253
+	.byte	0xc
+	.long	0xacf1
+	.long	0xc018
+	.uleb128 0x1
+	.long	0xbf81
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x5d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1671
+	.byte	0x4e
+	.value	0x291
+	.byte	0xc
+	.long	.LASF1672
+	.long	0xacf1
+	.long	0xc039
+	.uleb128 0x1
+	.long	0xbf81
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x5d
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1673
+	.byte	0x4e
+	.value	0x2e9
+	.byte	0xf
+	.long	0xbd40
+	.long	0xc050
+	.uleb128 0x1
+	.long	0xbf81
+	.byte	0
+	.uleb128 0x9e
+	.long	.LASF1674
+	.byte	0x4e
+	.value	0x2ef
+	.byte	0xf
+	.long	0xbd40
+	.uleb128 0x17
+	.long	.LASF1675
+	.byte	0x4e
+	.value	0x14a
+	.byte	0x1
+	.long	0xb503
+	.long	0xc07f
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xc07f
+	.byte	0
+	.uleb128 0x7
+	.long	0xbda3
+	.uleb128 0x17
+	.long	.LASF1676
+	.byte	0x4e
+	.value	0x129
+	.byte	0xf
+	.long	0xb503
+	.long	0xc0aa
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xc07f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1677
+	.byte	0x4e
+	.value	0x125
+	.byte	0xc
+	.long	0xacf1
+	.long	0xc0c1
+	.uleb128 0x1
+	.long	0xc0c1
+	.byte	0
+	.uleb128 0x7
+	.long	0xbdaf
+	.uleb128 0x17
+	.long	.LASF1678
+	.byte	0x4e
+	.value	0x152
+	.byte	0xf
+	.long	0xb503
+	.long	0xc0ec
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xc0ec
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xc07f
+	.byte	0
+	.uleb128 0x7
+	.long	0xb5c3
+	.uleb128 0x17
+	.long	.LASF1679
+	.byte	0x4e
+	.value	0x2f7
+	.byte	0xf
+	.long	0xbd40
+	.long	0xc10d
+	.uleb128 0x1
+	.long	0xad11
+	.uleb128 0x1
+	.long	0xbf81
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1680
+	.byte	0x4e
+	.value	0x2fd
+	.byte	0xf
+	.long	0xbd40
+	.long	0xc124
+	.uleb128 0x1
+	.long	0xad11
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1681
+	.byte	0x4e
+	.value	0x25d
+	.byte	0xc
+	.long	0xacf1
+	.long	0xc146
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x5d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1682
+	.byte	0x4e
+	.value	0x298
+	.byte	0xc
+	.long	.LASF1683
+	.long	0xacf1
+	.long	0xc167
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x5d
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1684
+	.byte	0x4e
+	.value	0x314
+	.byte	0xf
+	.long	0xbd40
+	.long	0xc183
+	.uleb128 0x1
+	.long	0xbd40
+	.uleb128 0x1
+	.long	0xbf81
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1685
+	.byte	0x4e
+	.value	0x265
+	.byte	0xc
+	.long	0xacf1
+	.long	0xc1a4
+	.uleb128 0x1
+	.long	0xbf81
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc1a4
+	.byte	0
+	.uleb128 0x7
+	.long	0xbd0a
+	.uleb128 0x14
+	.long	.LASF1686
+	.byte	0x4e
+	.value	0x2c7
+	.byte	0xc
+	.long	.LASF1687
+	.long	0xacf1
+	.long	0xc1ce
+	.uleb128 0x1
+	.long	0xbf81
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc1a4
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1688
+	.byte	0x4e
+	.value	0x272
+	.byte	0xc
+	.long	0xacf1
+	.long	0xc1f4
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc1a4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1689
+	.byte	0x4e
+	.value	0x2ce
+	.byte	0xc
+	.long	.LASF1690
+	.long	0xacf1
+	.long	0xc219
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc1a4
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1691
+	.byte	0x4e
+	.value	0x26d
+	.byte	0xc
+	.long	0xacf1
+	.long	0xc235
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc1a4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1692
+	.byte	0x4e
+	.value	0x2cb
+	.byte	0xc
+	.long	.LASF1693
+	.long	0xacf1
+	.long	0xc255
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc1a4
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1694
+	.byte	0x4e
+	.value	0x12e
+	.byte	0xf
+	.long	0xb503
+	.long	0xc276
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xad11
+	.uleb128 0x1
+	.long	0xc07f
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1695
+	.byte	0x4e
+	.byte	0x61
+	.byte	0x11
+	.long	0xb903
+	.long	0xc291
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xba16
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1696
+	.byte	0x4e
+	.byte	0x6a
+	.byte	0xc
+	.long	0xacf1
+	.long	0xc2ac
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xba16
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1697
+	.byte	0x4e
+	.byte	0x83
+	.byte	0xc
+	.long	0xacf1
+	.long	0xc2c7
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xba16
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1698
+	.byte	0x4e
+	.byte	0x57
+	.byte	0x11
+	.long	0xb903
+	.long	0xc2e2
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xba16
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1699
+	.byte	0x4e
+	.byte	0xbc
+	.byte	0xf
+	.long	0xb503
+	.long	0xc2fd
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xba16
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1700
+	.byte	0x4e
+	.value	0x354
+	.byte	0xf
+	.long	0xb503
+	.long	0xc323
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc323
+	.byte	0
+	.uleb128 0x7
+	.long	0xc3c5
+	.uleb128 0xd6
+	.string	"tm"
+	.byte	0x38
+	.byte	0x4f
+	.byte	0x7
+	.byte	0x8
+	.long	0xc3c5
+	.uleb128 0xc
+	.long	.LASF1701
+	.byte	0x4f
+	.byte	0x9
+	.byte	0x7
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1702
+	.byte	0x4f
+	.byte	0xa
+	.byte	0x7
+	.long	0xacf1
+	.byte	0x4
+	.uleb128 0xc
+	.long	.LASF1703
+	.byte	0x4f
+	.byte	0xb
+	.byte	0x7
+	.long	0xacf1
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF1704
+	.byte	0x4f
+	.byte	0xc
+	.byte	0x7
+	.long	0xacf1
+	.byte	0xc
+	.uleb128 0xc
+	.long	.LASF1705
+	.byte	0x4f
+	.byte	0xd
+	.byte	0x7
+	.long	0xacf1
+	.byte	0x10
+	.uleb128 0xc
+	.long	.LASF1706
+	.byte	0x4f
+	.byte	0xe
+	.byte	0x7
+	.long	0xacf1
+	.byte	0x14
+	.uleb128 0xc
+	.long	.LASF1707
+	.byte	0x4f
+	.byte	0xf
+	.byte	0x7
+	.long	0xacf1
+	.byte	0x18
+	.uleb128 0xc
+	.long	.LASF1708
+	.byte	0x4f
+	.byte	0x10
+	.byte	0x7
+	.long	0xacf1
+	.byte	0x1c
+	.uleb128 0xc
+	.long	.LASF1709
+	.byte	0x4f
+	.byte	0x11
+	.byte	0x7
+	.long	0xacf1
+	.byte	0x20
+	.uleb128 0xc
+	.long	.LASF1710
+	.byte	0x4f
+	.byte	0x14
+	.byte	0xc
+	.long	0xacfe
+	.byte	0x28
+	.uleb128 0xc
+	.long	.LASF1711
+	.byte	0x4f
+	.byte	0x15
+	.byte	0xf
+	.long	0xb5c3
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.long	0xc328
+	.uleb128 0x1e
+	.long	.LASF1712
+	.byte	0x4e
+	.byte	0xdf
+	.byte	0xf
+	.long	0xb503
+	.long	0xc3e0
+	.uleb128 0x1
+	.long	0xba16
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1713
+	.byte	0x4e
+	.byte	0x65
+	.byte	0x11
+	.long	0xb903
+	.long	0xc400
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1714
+	.byte	0x4e
+	.byte	0x6d
+	.byte	0xc
+	.long	0xacf1
+	.long	0xc420
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1715
+	.byte	0x4e
+	.byte	0x5c
+	.byte	0x11
+	.long	0xb903
+	.long	0xc440
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1716
+	.byte	0x4e
+	.value	0x158
+	.byte	0xf
+	.long	0xb503
+	.long	0xc466
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xc466
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xc07f
+	.byte	0
+	.uleb128 0x7
+	.long	0xba16
+	.uleb128 0x1e
+	.long	.LASF1717
+	.byte	0x4e
+	.byte	0xc0
+	.byte	0xf
+	.long	0xb503
+	.long	0xc486
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xba16
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1718
+	.byte	0x4e
+	.value	0x17a
+	.byte	0xf
+	.long	0xb4d8
+	.long	0xc4a2
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc4a2
+	.byte	0
+	.uleb128 0x7
+	.long	0xb903
+	.uleb128 0x17
+	.long	.LASF1719
+	.byte	0x4e
+	.value	0x17f
+	.byte	0xe
+	.long	0xb4df
+	.long	0xc4c3
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc4a2
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1720
+	.byte	0x4e
+	.byte	0xda
+	.byte	0x11
+	.long	0xb903
+	.long	0xc4e3
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc4a2
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1721
+	.byte	0x4e
+	.value	0x1ad
+	.byte	0x11
+	.long	0xacfe
+	.long	0xc504
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc4a2
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1722
+	.byte	0x4e
+	.value	0x1b2
+	.byte	0x1a
+	.long	0xacc0
+	.long	0xc525
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc4a2
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1723
+	.byte	0x4e
+	.byte	0x87
+	.byte	0xf
+	.long	0xb503
+	.long	0xc545
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1724
+	.byte	0x4e
+	.value	0x145
+	.byte	0x1
+	.long	0xacf1
+	.long	0xc55c
+	.uleb128 0x1
+	.long	0xbd40
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1725
+	.byte	0x4e
+	.value	0x103
+	.byte	0xc
+	.long	0xacf1
+	.long	0xc57d
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1726
+	.byte	0x4e
+	.value	0x107
+	.byte	0x11
+	.long	0xb903
+	.long	0xc59e
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1727
+	.byte	0x4e
+	.value	0x10c
+	.byte	0x11
+	.long	0xb903
+	.long	0xc5bf
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1728
+	.byte	0x4e
+	.value	0x110
+	.byte	0x11
+	.long	0xb903
+	.long	0xc5e0
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xad11
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1729
+	.byte	0x4e
+	.value	0x25a
+	.byte	0xc
+	.long	0xacf1
+	.long	0xc5f8
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x5d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1730
+	.byte	0x4e
+	.value	0x295
+	.byte	0xc
+	.long	.LASF1731
+	.long	0xacf1
+	.long	0xc614
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x5d
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1732
+	.byte	0x4e
+	.byte	0xa2
+	.byte	0x1d
+	.long	.LASF1732
+	.long	0xba16
+	.long	0xc633
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xad11
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1732
+	.byte	0x4e
+	.byte	0xa0
+	.byte	0x17
+	.long	.LASF1732
+	.long	0xb903
+	.long	0xc652
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xad11
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1733
+	.byte	0x4e
+	.byte	0xc6
+	.byte	0x1d
+	.long	.LASF1733
+	.long	0xba16
+	.long	0xc671
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xba16
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1733
+	.byte	0x4e
+	.byte	0xc4
+	.byte	0x17
+	.long	.LASF1733
+	.long	0xb903
+	.long	0xc690
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xba16
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1734
+	.byte	0x4e
+	.byte	0xac
+	.byte	0x1d
+	.long	.LASF1734
+	.long	0xba16
+	.long	0xc6af
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xad11
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1734
+	.byte	0x4e
+	.byte	0xaa
+	.byte	0x17
+	.long	.LASF1734
+	.long	0xb903
+	.long	0xc6ce
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xad11
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1735
+	.byte	0x4e
+	.byte	0xd1
+	.byte	0x1d
+	.long	.LASF1735
+	.long	0xba16
+	.long	0xc6ed
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xba16
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1735
+	.byte	0x4e
+	.byte	0xcf
+	.byte	0x17
+	.long	.LASF1735
+	.long	0xb903
+	.long	0xc70c
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xba16
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1736
+	.byte	0x4e
+	.byte	0xfa
+	.byte	0x1d
+	.long	.LASF1736
+	.long	0xba16
+	.long	0xc730
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xad11
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1736
+	.byte	0x4e
+	.byte	0xf8
+	.byte	0x17
+	.long	.LASF1736
+	.long	0xb903
+	.long	0xc754
+	.uleb128 0x1
+	.long	0xb903
+	.uleb128 0x1
+	.long	0xad11
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1737
+	.byte	0x4e
+	.value	0x181
+	.byte	0x14
+	.long	0xb4d1
+	.long	0xc770
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc4a2
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1738
+	.byte	0x4e
+	.value	0x1ba
+	.byte	0x16
+	.long	0xad0a
+	.long	0xc791
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc4a2
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1739
+	.byte	0x4e
+	.value	0x1c1
+	.byte	0x1f
+	.long	0xacdc
+	.long	0xc7b2
+	.uleb128 0x1
+	.long	0xba16
+	.uleb128 0x1
+	.long	0xc4a2
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1740
+	.byte	0x60
+	.byte	0x50
+	.byte	0x33
+	.byte	0x8
+	.long	0xc8f8
+	.uleb128 0xc
+	.long	.LASF1741
+	.byte	0x50
+	.byte	0x37
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1742
+	.byte	0x50
+	.byte	0x38
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF1743
+	.byte	0x50
+	.byte	0x3e
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x10
+	.uleb128 0xc
+	.long	.LASF1744
+	.byte	0x50
+	.byte	0x44
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x18
+	.uleb128 0xc
+	.long	.LASF1745
+	.byte	0x50
+	.byte	0x45
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x20
+	.uleb128 0xc
+	.long	.LASF1746
+	.byte	0x50
+	.byte	0x46
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x28
+	.uleb128 0xc
+	.long	.LASF1747
+	.byte	0x50
+	.byte	0x47
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x30
+	.uleb128 0xc
+	.long	.LASF1748
+	.byte	0x50
+	.byte	0x48
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x38
+	.uleb128 0xc
+	.long	.LASF1749
+	.byte	0x50
+	.byte	0x49
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x40
+	.uleb128 0xc
+	.long	.LASF1750
+	.byte	0x50
+	.byte	0x4a
+	.byte	0x9
+	.long	0xb6fa
+	.byte	0x48
+	.uleb128 0xc
+	.long	.LASF1751
+	.byte	0x50
+	.byte	0x4b
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x50
+	.uleb128 0xc
+	.long	.LASF1752
+	.byte	0x50
+	.byte	0x4c
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x51
+	.uleb128 0xc
+	.long	.LASF1753
+	.byte	0x50
+	.byte	0x4e
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x52
+	.uleb128 0xc
+	.long	.LASF1754
+	.byte	0x50
+	.byte	0x50
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x53
+	.uleb128 0xc
+	.long	.LASF1755
+	.byte	0x50
+	.byte	0x52
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x54
+	.uleb128 0xc
+	.long	.LASF1756
+	.byte	0x50
+	.byte	0x54
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x55
+	.uleb128 0xc
+	.long	.LASF1757
+	.byte	0x50
+	.byte	0x5b
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x56
+	.uleb128 0xc
+	.long	.LASF1758
+	.byte	0x50
+	.byte	0x5c
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x57
+	.uleb128 0xc
+	.long	.LASF1759
+	.byte	0x50
+	.byte	0x5f
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x58
+	.uleb128 0xc
+	.long	.LASF1760
+	.byte	0x50
+	.byte	0x61
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x59
+	.uleb128 0xc
+	.long	.LASF1761
+	.byte	0x50
+	.byte	0x63
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x5a
+	.uleb128 0xc
+	.long	.LASF1762
+	.byte	0x50
+	.byte	0x65
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x5b
+	.uleb128 0xc
+	.long	.LASF1763
+	.byte	0x50
+	.byte	0x6c
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x5c
+	.uleb128 0xc
+	.long	.LASF1764
+	.byte	0x50
+	.byte	0x6d
+	.byte	0x8
+	.long	0xb5cd
+	.byte	0x5d
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1765
+	.byte	0x50
+	.byte	0x7a
+	.byte	0xe
+	.long	0xb6fa
+	.long	0xc913
+	.uleb128 0x1
+	.long	0xacf1
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x7a
+	.long	.LASF1766
+	.byte	0x50
+	.byte	0x7d
+	.byte	0x16
+	.long	0xc91f
+	.uleb128 0x7
+	.long	0xc7b2
+	.uleb128 0xb
+	.long	0x86d
+	.uleb128 0xb
+	.long	0x87a
+	.uleb128 0x7
+	.long	0x87a
+	.uleb128 0x7
+	.long	0x86d
+	.uleb128 0xb
+	.long	0x9b7
+	.uleb128 0xd
+	.long	.LASF1767
+	.byte	0x51
+	.byte	0x18
+	.byte	0x13
+	.long	0xb5e5
+	.uleb128 0xa
+	.long	0xc93d
+	.uleb128 0xd
+	.long	.LASF1768
+	.byte	0x51
+	.byte	0x19
+	.byte	0x14
+	.long	0xb5fd
+	.uleb128 0xd
+	.long	.LASF1769
+	.byte	0x51
+	.byte	0x1a
+	.byte	0x14
+	.long	0xb61a
+	.uleb128 0xd
+	.long	.LASF1770
+	.byte	0x51
+	.byte	0x1b
+	.byte	0x14
+	.long	0xb632
+	.uleb128 0xa
+	.long	0xc966
+	.uleb128 0xd
+	.long	.LASF1771
+	.byte	0x52
+	.byte	0x2b
+	.byte	0x18
+	.long	0xb63e
+	.uleb128 0xd
+	.long	.LASF1772
+	.byte	0x52
+	.byte	0x2c
+	.byte	0x19
+	.long	0xb656
+	.uleb128 0xd
+	.long	.LASF1773
+	.byte	0x52
+	.byte	0x2d
+	.byte	0x19
+	.long	0xb66e
+	.uleb128 0xd
+	.long	.LASF1774
+	.byte	0x52
+	.byte	0x2e
+	.byte	0x19
+	.long	0xb686
+	.uleb128 0xd
+	.long	.LASF1775
+	.byte	0x52
+	.byte	0x31
+	.byte	0x19
+	.long	0xb64a
+	.uleb128 0xd
+	.long	.LASF1776
+	.byte	0x52
+	.byte	0x32
+	.byte	0x1a
+	.long	0xb662
+	.uleb128 0xd
+	.long	.LASF1777
+	.byte	0x52
+	.byte	0x33
+	.byte	0x1a
+	.long	0xb67a
+	.uleb128 0xd
+	.long	.LASF1778
+	.byte	0x52
+	.byte	0x34
+	.byte	0x1a
+	.long	0xb692
+	.uleb128 0xd
+	.long	.LASF1779
+	.byte	0x52
+	.byte	0x3a
+	.byte	0x16
+	.long	0xace3
+	.uleb128 0xd
+	.long	.LASF1780
+	.byte	0x52
+	.byte	0x3c
+	.byte	0x13
+	.long	0xacfe
+	.uleb128 0xd
+	.long	.LASF1781
+	.byte	0x52
+	.byte	0x3d
+	.byte	0x13
+	.long	0xacfe
+	.uleb128 0xd
+	.long	.LASF1782
+	.byte	0x52
+	.byte	0x3e
+	.byte	0x13
+	.long	0xacfe
+	.uleb128 0xd
+	.long	.LASF1783
+	.byte	0x52
+	.byte	0x47
+	.byte	0x18
+	.long	0xacc7
+	.uleb128 0xd
+	.long	.LASF1784
+	.byte	0x52
+	.byte	0x49
+	.byte	0x1b
+	.long	0xacc0
+	.uleb128 0xd
+	.long	.LASF1785
+	.byte	0x52
+	.byte	0x4a
+	.byte	0x1b
+	.long	0xacc0
+	.uleb128 0xd
+	.long	.LASF1786
+	.byte	0x52
+	.byte	0x4b
+	.byte	0x1b
+	.long	0xacc0
+	.uleb128 0xd
+	.long	.LASF1787
+	.byte	0x52
+	.byte	0x57
+	.byte	0x13
+	.long	0xacfe
+	.uleb128 0xd
+	.long	.LASF1788
+	.byte	0x52
+	.byte	0x5a
+	.byte	0x1b
+	.long	0xacc0
+	.uleb128 0xd
+	.long	.LASF1789
+	.byte	0x52
+	.byte	0x65
+	.byte	0x15
+	.long	0xb69e
+	.uleb128 0xd
+	.long	.LASF1790
+	.byte	0x52
+	.byte	0x66
+	.byte	0x16
+	.long	0xb6aa
+	.uleb128 0x7
+	.long	0xb1b
+	.uleb128 0xb
+	.long	0xbe6
+	.uleb128 0x7
+	.long	0xbe6
+	.uleb128 0x7
+	.long	0xbeb
+	.uleb128 0xb
+	.long	0xcc3
+	.uleb128 0xb
+	.long	0xbeb
+	.uleb128 0x7
+	.long	0xcc8
+	.uleb128 0xb
+	.long	0x177a
+	.uleb128 0xb
+	.long	0xcc8
+	.uleb128 0x7
+	.long	0xdbd
+	.uleb128 0x7
+	.long	0x177a
+	.uleb128 0xb
+	.long	0xdbd
+	.uleb128 0x1d
+	.long	.LASF1791
+	.byte	0x10
+	.byte	0x53
+	.byte	0xa
+	.byte	0x10
+	.long	0xcacb
+	.uleb128 0xc
+	.long	.LASF1792
+	.byte	0x53
+	.byte	0xc
+	.byte	0xb
+	.long	0xb6b6
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1793
+	.byte	0x53
+	.byte	0xd
+	.byte	0xf
+	.long	0xbd97
+	.byte	0x8
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1794
+	.byte	0x53
+	.byte	0xe
+	.byte	0x3
+	.long	0xcaa3
+	.uleb128 0xd7
+	.long	.LASF2346
+	.byte	0x4c
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x7b
+	.long	.LASF1795
+	.uleb128 0x7
+	.long	0xcae0
+	.uleb128 0x7
+	.long	0xbdc0
+	.uleb128 0x5a
+	.long	0xb5cd
+	.long	0xcaff
+	.uleb128 0x5b
+	.long	0xacc0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0xcad7
+	.uleb128 0x7b
+	.long	.LASF1796
+	.uleb128 0x7
+	.long	0xcb04
+	.uleb128 0x7b
+	.long	.LASF1797
+	.uleb128 0x7
+	.long	0xcb0e
+	.uleb128 0x5a
+	.long	0xb5cd
+	.long	0xcb28
+	.uleb128 0x5b
+	.long	0xacc0
+	.byte	0x13
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1798
+	.byte	0x54
+	.byte	0x54
+	.byte	0x12
+	.long	0xcacb
+	.uleb128 0xa
+	.long	0xcb28
+	.uleb128 0x7
+	.long	0xbf47
+	.uleb128 0x65
+	.long	.LASF1799
+	.byte	0x54
+	.value	0x312
+	.long	0xcb50
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1800
+	.byte	0x54
+	.byte	0xb2
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcb66
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1801
+	.byte	0x54
+	.value	0x314
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcb7d
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1802
+	.byte	0x54
+	.value	0x316
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcb94
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1803
+	.byte	0x54
+	.byte	0xe6
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcbaa
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1804
+	.byte	0x54
+	.value	0x201
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcbc1
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1805
+	.byte	0x54
+	.value	0x2f8
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcbdd
+	.uleb128 0x1
+	.long	0xcb39
+	.uleb128 0x1
+	.long	0xcbdd
+	.byte	0
+	.uleb128 0x7
+	.long	0xcb28
+	.uleb128 0x17
+	.long	.LASF1806
+	.byte	0x54
+	.value	0x250
+	.byte	0xe
+	.long	0xb6fa
+	.long	0xcc03
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xacf1
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1807
+	.byte	0x54
+	.value	0x102
+	.byte	0xe
+	.long	0xcb39
+	.long	0xcc1f
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1808
+	.byte	0x54
+	.value	0x2a3
+	.byte	0xf
+	.long	0xb503
+	.long	0xcc45
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1809
+	.byte	0x54
+	.value	0x109
+	.byte	0xe
+	.long	0xcb39
+	.long	0xcc66
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1810
+	.byte	0x54
+	.value	0x2c9
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcc87
+	.uleb128 0x1
+	.long	0xcb39
+	.uleb128 0x1
+	.long	0xacfe
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1811
+	.byte	0x54
+	.value	0x2fd
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcca3
+	.uleb128 0x1
+	.long	0xcb39
+	.uleb128 0x1
+	.long	0xcca3
+	.byte	0
+	.uleb128 0x7
+	.long	0xcb34
+	.uleb128 0x17
+	.long	.LASF1812
+	.byte	0x54
+	.value	0x2ce
+	.byte	0x11
+	.long	0xacfe
+	.long	0xccbf
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1813
+	.byte	0x54
+	.value	0x202
+	.byte	0xc
+	.long	0xacf1
+	.long	0xccd6
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x7a
+	.long	.LASF1814
+	.byte	0x55
+	.byte	0x2f
+	.byte	0x1
+	.long	0xacf1
+	.uleb128 0x65
+	.long	.LASF1815
+	.byte	0x54
+	.value	0x324
+	.long	0xccf4
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1816
+	.byte	0x54
+	.byte	0x98
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcd0a
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1817
+	.byte	0x54
+	.byte	0x9a
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcd25
+	.uleb128 0x1
+	.long	0xb5c3
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x65
+	.long	.LASF1818
+	.byte	0x54
+	.value	0x2d3
+	.long	0xcd37
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0x65
+	.long	.LASF1819
+	.byte	0x54
+	.value	0x148
+	.long	0xcd4e
+	.uleb128 0x1
+	.long	0xcb39
+	.uleb128 0x1
+	.long	0xb6fa
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1820
+	.byte	0x54
+	.value	0x14c
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcd74
+	.uleb128 0x1
+	.long	0xcb39
+	.uleb128 0x1
+	.long	0xb6fa
+	.uleb128 0x1
+	.long	0xacf1
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x7a
+	.long	.LASF1821
+	.byte	0x54
+	.byte	0xbc
+	.byte	0xe
+	.long	0xcb39
+	.uleb128 0x1e
+	.long	.LASF1822
+	.byte	0x54
+	.byte	0xcd
+	.byte	0xe
+	.long	0xb6fa
+	.long	0xcd96
+	.uleb128 0x1
+	.long	0xb6fa
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1823
+	.byte	0x54
+	.value	0x29c
+	.byte	0xc
+	.long	0xacf1
+	.long	0xcdb2
+	.uleb128 0x1
+	.long	0xacf1
+	.uleb128 0x1
+	.long	0xcb39
+	.byte	0
+	.uleb128 0xb
+	.long	0x1897
+	.uleb128 0xb
+	.long	0x18a4
+	.uleb128 0xb
+	.long	0xae80
+	.uleb128 0xb
+	.long	0xae8c
+	.uleb128 0x7
+	.long	0x1982
+	.uleb128 0x22
+	.long	0xbeb
+	.uleb128 0x5a
+	.long	0xb5cd
+	.long	0xcde0
+	.uleb128 0x5b
+	.long	0xacc0
+	.byte	0xf
+	.byte	0
+	.uleb128 0x7
+	.long	0x1975
+	.uleb128 0x7
+	.long	0x35a2
+	.uleb128 0xb
+	.long	0x1a1a
+	.uleb128 0xb
+	.long	0x1c58
+	.uleb128 0xb
+	.long	0x1c65
+	.uleb128 0xb
+	.long	0x35a2
+	.uleb128 0x22
+	.long	0x1975
+	.uleb128 0xb
+	.long	0x1975
+	.uleb128 0x7
+	.long	0x1a71
+	.uleb128 0x7
+	.long	0x35a8
+	.uleb128 0x7
+	.long	0x3699
+	.uleb128 0xb
+	.long	0xb5d4
+	.uleb128 0xb
+	.long	0x36b4
+	.uleb128 0x31
+	.long	0xbc67
+	.uleb128 0x31
+	.long	0x1a4
+	.uleb128 0x31
+	.long	0x1b1
+	.uleb128 0x31
+	.long	0x1be
+	.uleb128 0x7
+	.long	0x3758
+	.uleb128 0xb
+	.long	0x3ff4
+	.uleb128 0xb
+	.long	0x3758
+	.uleb128 0x7
+	.long	0x3ff9
+	.uleb128 0x7
+	.long	0x3ff4
+	.uleb128 0x7
+	.long	0x3ffe
+	.uleb128 0xb
+	.long	0x3775
+	.uleb128 0x7
+	.long	0x4003
+	.uleb128 0xb
+	.long	0x4135
+	.uleb128 0xb
+	.long	0x4003
+	.uleb128 0x7
+	.long	0x413a
+	.uleb128 0x7
+	.long	0x413f
+	.uleb128 0xb
+	.long	0x49db
+	.uleb128 0xb
+	.long	0x413f
+	.uleb128 0x7
+	.long	0x49e0
+	.uleb128 0x7
+	.long	0x49db
+	.uleb128 0x7
+	.long	0x49e5
+	.uleb128 0xb
+	.long	0x415c
+	.uleb128 0x7
+	.long	0x49ea
+	.uleb128 0xb
+	.long	0x4b1c
+	.uleb128 0xb
+	.long	0x49ea
+	.uleb128 0x7
+	.long	0x4b21
+	.uleb128 0x7
+	.long	0x4b26
+	.uleb128 0xb
+	.long	0x53c2
+	.uleb128 0xb
+	.long	0x4b26
+	.uleb128 0x7
+	.long	0x53c7
+	.uleb128 0x7
+	.long	0x53c2
+	.uleb128 0x7
+	.long	0x53cc
+	.uleb128 0xb
+	.long	0x4b43
+	.uleb128 0x7
+	.long	0x53d1
+	.uleb128 0xb
+	.long	0x5503
+	.uleb128 0xb
+	.long	0x53d1
+	.uleb128 0x7
+	.long	0x5508
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x27
+	.byte	0xc
+	.long	0xb7cf
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x2b
+	.byte	0xe
+	.long	0xb7ed
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x2e
+	.byte	0xe
+	.long	0xb94a
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x33
+	.byte	0xc
+	.long	0xb54a
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x34
+	.byte	0xc
+	.long	0xb57e
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x36
+	.byte	0xc
+	.long	0x550d
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x36
+	.byte	0xc
+	.long	0x5526
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x36
+	.byte	0xc
+	.long	0x553f
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x36
+	.byte	0xc
+	.long	0x5558
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x36
+	.byte	0xc
+	.long	0x5571
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x37
+	.byte	0xc
+	.long	0xb808
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x38
+	.byte	0xc
+	.long	0xb81e
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x39
+	.byte	0xc
+	.long	0xb835
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x3a
+	.byte	0xc
+	.long	0xb84c
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x3c
+	.byte	0xc
+	.long	0xad91
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x3c
+	.byte	0xc
+	.long	0x558a
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x3c
+	.byte	0xc
+	.long	0xb876
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x3e
+	.byte	0xc
+	.long	0xb893
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x40
+	.byte	0xc
+	.long	0xb8aa
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x43
+	.byte	0xc
+	.long	0xb8c6
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x44
+	.byte	0xc
+	.long	0xb8e2
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x45
+	.byte	0xc
+	.long	0xb908
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x47
+	.byte	0xc
+	.long	0xb929
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x48
+	.byte	0xc
+	.long	0xb95e
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x4a
+	.byte	0xc
+	.long	0xb96c
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x4b
+	.byte	0xc
+	.long	0xb97e
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x4c
+	.byte	0xc
+	.long	0xb99e
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x4d
+	.byte	0xc
+	.long	0xb9be
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x4e
+	.byte	0xc
+	.long	0xb9de
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x50
+	.byte	0xc
+	.long	0xb9f5
+	.uleb128 0x4
+	.byte	0x56
+	.byte	0x51
+	.byte	0xc
+	.long	0xba1b
+	.uleb128 0x2a
+	.byte	0x2
+	.byte	0x4
+	.long	.LASF1824
+	.uleb128 0xd
+	.long	.LASF1825
+	.byte	0x57
+	.byte	0x26
+	.byte	0x1b
+	.long	0xacc0
+	.uleb128 0xd
+	.long	.LASF1826
+	.byte	0x58
+	.byte	0x30
+	.byte	0x1a
+	.long	0xcff1
+	.uleb128 0x7
+	.long	0xb615
+	.uleb128 0x1e
+	.long	.LASF1827
+	.byte	0x57
+	.byte	0x9f
+	.byte	0xc
+	.long	0xacf1
+	.long	0xd011
+	.uleb128 0x1
+	.long	0xbd40
+	.uleb128 0x1
+	.long	0xcfd9
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1828
+	.byte	0x58
+	.byte	0x37
+	.byte	0xf
+	.long	0xbd40
+	.long	0xd02c
+	.uleb128 0x1
+	.long	0xbd40
+	.uleb128 0x1
+	.long	0xcfe5
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1829
+	.byte	0x58
+	.byte	0x34
+	.byte	0x12
+	.long	0xcfe5
+	.long	0xd042
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1830
+	.byte	0x57
+	.byte	0x9b
+	.byte	0x11
+	.long	0xcfd9
+	.long	0xd058
+	.uleb128 0x1
+	.long	0xb5c3
+	.byte	0
+	.uleb128 0x7a
+	.long	.LASF1831
+	.byte	0x59
+	.byte	0x48
+	.byte	0x10
+	.long	0xb704
+	.uleb128 0x1e
+	.long	.LASF1832
+	.byte	0x59
+	.byte	0x4f
+	.byte	0xf
+	.long	0xb4d8
+	.long	0xd07f
+	.uleb128 0x1
+	.long	0xb710
+	.uleb128 0x1
+	.long	0xb710
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1833
+	.byte	0x59
+	.byte	0x53
+	.byte	0xf
+	.long	0xb710
+	.long	0xd095
+	.uleb128 0x1
+	.long	0xd095
+	.byte	0
+	.uleb128 0x7
+	.long	0xc328
+	.uleb128 0x1e
+	.long	.LASF1834
+	.byte	0x59
+	.byte	0x4c
+	.byte	0xf
+	.long	0xb710
+	.long	0xd0b0
+	.uleb128 0x1
+	.long	0xd0b0
+	.byte	0
+	.uleb128 0x7
+	.long	0xb710
+	.uleb128 0x1e
+	.long	.LASF1835
+	.byte	0x59
+	.byte	0xb3
+	.byte	0xe
+	.long	0xb6fa
+	.long	0xd0cb
+	.uleb128 0x1
+	.long	0xc323
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1836
+	.byte	0x59
+	.byte	0xb7
+	.byte	0xe
+	.long	0xb6fa
+	.long	0xd0e1
+	.uleb128 0x1
+	.long	0xd0e1
+	.byte	0
+	.uleb128 0x7
+	.long	0xb71c
+	.uleb128 0x1e
+	.long	.LASF1837
+	.byte	0x59
+	.byte	0x84
+	.byte	0x13
+	.long	0xd095
+	.long	0xd0fc
+	.uleb128 0x1
+	.long	0xd0e1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1838
+	.byte	0x59
+	.byte	0x88
+	.byte	0x13
+	.long	0xd095
+	.long	0xd112
+	.uleb128 0x1
+	.long	0xd0e1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1839
+	.byte	0x59
+	.value	0x17f
+	.byte	0xc
+	.long	0xacf1
+	.long	0xd12e
+	.uleb128 0x1
+	.long	0xd12e
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x7
+	.long	0xb751
+	.uleb128 0x74
+	.string	"tbb"
+	.byte	0x5a
+	.byte	0x19
+	.byte	0xb
+	.long	0xe9ce
+	.uleb128 0x39
+	.long	.LASF1840
+	.byte	0x5a
+	.byte	0x1a
+	.byte	0xb
+	.long	0xe859
+	.uleb128 0xa2
+	.string	"d0"
+	.byte	0x5b
+	.byte	0x3a
+	.long	0xd4e7
+	.uleb128 0x4
+	.byte	0x5b
+	.byte	0x4b
+	.byte	0x19
+	.long	0x569f
+	.uleb128 0x4d
+	.long	.LASF1841
+	.byte	0x5c
+	.byte	0x27
+	.byte	0x12
+	.long	0xb50f
+	.byte	0x80
+	.uleb128 0x4d
+	.long	.LASF1842
+	.byte	0x5c
+	.byte	0x28
+	.byte	0x17
+	.long	0x12e
+	.byte	0x7
+	.uleb128 0x29
+	.long	.LASF1843
+	.byte	0x1
+	.byte	0x5c
+	.byte	0xdf
+	.byte	0x7
+	.long	0xd1db
+	.uleb128 0x66
+	.long	.LASF53
+	.byte	0x5c
+	.byte	0xe1
+	.byte	0xa
+	.long	.LASF1844
+	.long	0xd199
+	.long	0xd1a4
+	.uleb128 0x2
+	.long	0xe9d8
+	.uleb128 0x1
+	.long	0xe9dd
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF1843
+	.byte	0x5c
+	.byte	0xe2
+	.byte	0x5
+	.long	.LASF1845
+	.long	0xd1b8
+	.long	0xd1c3
+	.uleb128 0x2
+	.long	0xe9d8
+	.uleb128 0x1
+	.long	0xe9dd
+	.byte	0
+	.uleb128 0x89
+	.long	.LASF1843
+	.byte	0x5c
+	.byte	0xe3
+	.long	.LASF1846
+	.byte	0x1
+	.long	0xd1d4
+	.uleb128 0x2
+	.long	0xe9d8
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xd178
+	.uleb128 0x29
+	.long	.LASF1847
+	.byte	0x1
+	.byte	0x5c
+	.byte	0xe7
+	.byte	0x7
+	.long	0xd229
+	.uleb128 0x34
+	.long	0xd178
+	.uleb128 0x66
+	.long	.LASF1847
+	.byte	0x5c
+	.byte	0xe9
+	.byte	0x5
+	.long	.LASF1848
+	.long	0xd206
+	.long	0xd211
+	.uleb128 0x2
+	.long	0xe9e2
+	.uleb128 0x1
+	.long	0xe9e7
+	.byte	0
+	.uleb128 0x89
+	.long	.LASF1847
+	.byte	0x5c
+	.byte	0xea
+	.long	.LASF1849
+	.byte	0x1
+	.long	0xd222
+	.uleb128 0x2
+	.long	0xe9e2
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xd1e0
+	.uleb128 0x67
+	.long	.LASF1851
+	.byte	0x5
+	.byte	0x4
+	.long	0xacf1
+	.byte	0x5c
+	.byte	0xf5
+	.byte	0xc
+	.long	0xd259
+	.uleb128 0x11
+	.long	.LASF1852
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1853
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF1854
+	.byte	0x2
+	.uleb128 0x11
+	.long	.LASF1855
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd8
+	.long	.LASF2347
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x24
+	.byte	0x7
+	.uleb128 0x29
+	.long	.LASF1856
+	.byte	0x10
+	.byte	0x5d
+	.byte	0x2b
+	.byte	0x7
+	.long	0xd312
+	.uleb128 0x34
+	.long	0xd178
+	.uleb128 0x1b
+	.long	.LASF1856
+	.byte	0x5d
+	.byte	0x2d
+	.byte	0x5
+	.long	.LASF1857
+	.byte	0x1
+	.long	0xd28a
+	.long	0xd29a
+	.uleb128 0x2
+	.long	0xea0f
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1858
+	.byte	0x5d
+	.byte	0x2f
+	.byte	0xc
+	.long	.LASF1859
+	.long	0xb503
+	.byte	0x1
+	.long	0xd2b3
+	.long	0xd2b9
+	.uleb128 0x2
+	.long	0xea14
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1860
+	.byte	0x5d
+	.byte	0x30
+	.byte	0xc
+	.long	.LASF1861
+	.long	0xb503
+	.byte	0x1
+	.long	0xd2d2
+	.long	0xd2d8
+	.uleb128 0x2
+	.long	0xea14
+	.byte	0
+	.uleb128 0x80
+	.long	.LASF1862
+	.byte	0x5d
+	.byte	0x33
+	.byte	0xe
+	.long	.LASF1863
+	.long	0xd259
+	.long	0xd2f1
+	.long	0xd2f7
+	.uleb128 0x2
+	.long	0xea14
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1864
+	.byte	0x5d
+	.byte	0x36
+	.byte	0xc
+	.long	0xb503
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1865
+	.byte	0x5d
+	.byte	0x36
+	.byte	0x15
+	.long	0xb503
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0xd263
+	.uleb128 0x67
+	.long	.LASF1866
+	.byte	0x5
+	.byte	0x4
+	.long	0xacf1
+	.byte	0x5e
+	.byte	0x1d
+	.byte	0xc
+	.long	0xd372
+	.uleb128 0x11
+	.long	.LASF1867
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF1868
+	.byte	0x2
+	.uleb128 0x11
+	.long	.LASF1869
+	.byte	0x3
+	.uleb128 0x11
+	.long	.LASF1870
+	.byte	0x4
+	.uleb128 0x11
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1872
+	.byte	0x6
+	.uleb128 0x11
+	.long	.LASF1873
+	.byte	0x7
+	.uleb128 0x11
+	.long	.LASF1874
+	.byte	0x8
+	.uleb128 0x11
+	.long	.LASF1875
+	.byte	0x9
+	.uleb128 0x11
+	.long	.LASF1876
+	.byte	0xa
+	.uleb128 0x11
+	.long	.LASF1877
+	.byte	0xb
+	.uleb128 0x11
+	.long	.LASF1878
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.byte	0x5e
+	.byte	0x51
+	.byte	0xb
+	.long	0xe5fb
+	.uleb128 0xd9
+	.long	.LASF2348
+	.byte	0x7
+	.byte	0x8
+	.long	0xca43
+	.byte	0x5f
+	.byte	0x1e
+	.byte	0xa
+	.uleb128 0x11
+	.long	.LASF1879
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1880
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF1881
+	.byte	0x2
+	.uleb128 0x11
+	.long	.LASF1882
+	.byte	0x3
+	.uleb128 0x11
+	.long	.LASF1883
+	.byte	0x4
+	.uleb128 0x11
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1885
+	.byte	0x6
+	.uleb128 0x11
+	.long	.LASF1886
+	.byte	0x7
+	.uleb128 0x11
+	.long	.LASF1887
+	.byte	0x8
+	.uleb128 0x11
+	.long	.LASF1888
+	.byte	0x9
+	.uleb128 0x11
+	.long	.LASF1889
+	.byte	0xa
+	.uleb128 0x11
+	.long	.LASF1890
+	.byte	0xb
+	.uleb128 0x11
+	.long	.LASF1891
+	.byte	0xc
+	.uleb128 0x11
+	.long	.LASF1892
+	.byte	0xd
+	.uleb128 0x11
+	.long	.LASF1893
+	.byte	0xe
+	.uleb128 0x11
+	.long	.LASF1894
+	.byte	0xf
+	.uleb128 0x11
+	.long	.LASF1895
+	.byte	0x10
+	.uleb128 0x11
+	.long	.LASF1896
+	.byte	0x11
+	.uleb128 0x11
+	.long	.LASF1897
+	.byte	0x12
+	.uleb128 0x11
+	.long	.LASF1898
+	.byte	0x13
+	.uleb128 0x11
+	.long	.LASF1899
+	.byte	0x14
+	.uleb128 0x11
+	.long	.LASF1900
+	.byte	0x15
+	.uleb128 0x11
+	.long	.LASF1901
+	.byte	0x16
+	.uleb128 0x11
+	.long	.LASF1902
+	.byte	0x17
+	.uleb128 0x11
+	.long	.LASF1903
+	.byte	0x18
+	.uleb128 0x11
+	.long	.LASF1904
+	.byte	0x19
+	.uleb128 0x11
+	.long	.LASF1905
+	.byte	0x1a
+	.uleb128 0x11
+	.long	.LASF1906
+	.byte	0x1b
+	.uleb128 0x11
+	.long	.LASF1907
+	.byte	0x1c
+	.uleb128 0x11
+	.long	.LASF1908
+	.byte	0x1d
+	.uleb128 0x11
+	.long	.LASF1909
+	.byte	0x1e
+	.uleb128 0x11
+	.long	.LASF1910
+	.byte	0x1f
+	.uleb128 0x11
+	.long	.LASF1911
+	.byte	0x20
+	.uleb128 0x11
+	.long	.LASF1912
+	.byte	0x21
+	.uleb128 0x11
+	.long	.LASF1913
+	.byte	0x22
+	.uleb128 0x11
+	.long	.LASF1914
+	.byte	0x23
+	.uleb128 0x11
+	.long	.LASF1915
+	.byte	0x24
+	.uleb128 0x11
+	.long	.LASF1916
+	.byte	0x25
+	.uleb128 0x11
+	.long	.LASF1917
+	.byte	0x26
+	.uleb128 0x11
+	.long	.LASF1918
+	.byte	0x27
+	.uleb128 0x11
+	.long	.LASF1919
+	.byte	0x28
+	.uleb128 0x11
+	.long	.LASF1920
+	.byte	0x29
+	.uleb128 0x11
+	.long	.LASF1921
+	.byte	0x2a
+	.uleb128 0x11
+	.long	.LASF1922
+	.byte	0x2b
+	.uleb128 0x11
+	.long	.LASF1923
+	.byte	0x2c
+	.uleb128 0x11
+	.long	.LASF1924
+	.byte	0x2d
+	.uleb128 0x11
+	.long	.LASF1925
+	.byte	0x2e
+	.uleb128 0x11
+	.long	.LASF1926
+	.byte	0x2f
+	.uleb128 0x11
+	.long	.LASF1927
+	.byte	0x30
+	.uleb128 0x11
+	.long	.LASF1928
+	.byte	0x31
+	.uleb128 0x11
+	.long	.LASF1929
+	.byte	0x32
+	.uleb128 0x11
+	.long	.LASF1930
+	.byte	0x33
+	.uleb128 0x11
+	.long	.LASF1931
+	.byte	0x34
+	.uleb128 0x11
+	.long	.LASF1932
+	.byte	0x35
+	.uleb128 0x11
+	.long	.LASF1933
+	.byte	0x36
+	.uleb128 0x11
+	.long	.LASF1934
+	.byte	0x37
+	.uleb128 0x11
+	.long	.LASF1935
+	.byte	0x38
+	.uleb128 0x11
+	.long	.LASF1936
+	.byte	0x39
+	.byte	0
+	.byte	0
+	.uleb128 0x74
+	.string	"d1"
+	.byte	0x5b
+	.byte	0xed
+	.byte	0xb
+	.long	0xe5f0
+	.uleb128 0x1d
+	.long	.LASF1937
+	.byte	0x1
+	.byte	0x5f
+	.byte	0xe2
+	.byte	0x8
+	.long	0xd54c
+	.uleb128 0x1f
+	.long	.LASF1937
+	.byte	0x5f
+	.byte	0xe3
+	.byte	0x5
+	.long	.LASF1938
+	.long	0xd513
+	.long	0xd51e
+	.uleb128 0x2
+	.long	0xeaa0
+	.uleb128 0x1
+	.long	0xce1c
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1939
+	.byte	0x5f
+	.byte	0xe5
+	.byte	0xa
+	.long	.LASF1940
+	.long	0xd532
+	.long	0xd538
+	.uleb128 0x2
+	.long	0xeaa0
+	.byte	0
+	.uleb128 0xa3
+	.long	.LASF1939
+	.byte	0x5f
+	.byte	0xe7
+	.byte	0x11
+	.long	.LASF2172
+	.uleb128 0x1
+	.long	0xce1c
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1941
+	.byte	0x1
+	.byte	0x60
+	.byte	0x20
+	.byte	0x7
+	.long	0xd571
+	.uleb128 0x89
+	.long	.LASF1941
+	.byte	0x60
+	.byte	0x22
+	.long	.LASF1942
+	.byte	0x2
+	.long	0xd56a
+	.uleb128 0x2
+	.long	0xeaa5
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1943
+	.byte	0x8
+	.byte	0x60
+	.byte	0x31
+	.byte	0x7
+	.long	0xd58c
+	.uleb128 0xc
+	.long	.LASF1944
+	.byte	0x60
+	.byte	0x65
+	.byte	0x18
+	.long	0xeaa5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1945
+	.byte	0x61
+	.byte	0x26
+	.byte	0x7
+	.long	0xacce
+	.uleb128 0xa
+	.long	0xd58c
+	.uleb128 0xa4
+	.long	.LASF1946
+	.byte	0x27
+	.long	0xd598
+	.value	0xffff
+	.uleb128 0xa4
+	.long	.LASF1947
+	.byte	0x28
+	.long	0xd598
+	.value	0xfffe
+	.uleb128 0x6b
+	.long	.LASF1949
+	.byte	0x10
+	.byte	0x8
+	.byte	0x61
+	.byte	0x62
+	.byte	0x7
+	.long	0xd6d3
+	.uleb128 0xda
+	.long	.LASF1950
+	.byte	0x61
+	.byte	0x63
+	.byte	0x24
+	.long	.LASF1951
+	.long	0xc972
+	.quad	0xffffffff00000000
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF1952
+	.byte	0x61
+	.byte	0x65
+	.byte	0x13
+	.long	0xc966
+	.byte	0
+	.uleb128 0x6c
+	.long	.LASF1953
+	.byte	0x61
+	.byte	0x66
+	.byte	0x20
+	.long	0x53d1
+	.byte	0x8
+	.byte	0x8
+	.uleb128 0x1f
+	.long	.LASF1954
+	.byte	0x61
+	.byte	0x68
+	.byte	0xa
+	.long	.LASF1955
+	.long	0xd60e
+	.long	0xd619
+	.uleb128 0x2
+	.long	0xeab4
+	.uleb128 0x1
+	.long	0xb745
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1956
+	.byte	0x61
+	.byte	0x76
+	.byte	0xa
+	.long	.LASF1957
+	.long	0xacaa
+	.long	0xd631
+	.long	0xd637
+	.uleb128 0x2
+	.long	0xeab9
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1949
+	.byte	0x61
+	.byte	0x86
+	.byte	0x5
+	.long	.LASF1958
+	.byte	0x1
+	.long	0xd64c
+	.long	0xd657
+	.uleb128 0x2
+	.long	0xeab4
+	.uleb128 0x1
+	.long	0xc95a
+	.byte	0
+	.uleb128 0x66
+	.long	.LASF1949
+	.byte	0x61
+	.byte	0x87
+	.byte	0x5
+	.long	.LASF1959
+	.long	0xd66b
+	.long	0xd676
+	.uleb128 0x2
+	.long	0xeab4
+	.uleb128 0x1
+	.long	0xeabe
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1960
+	.byte	0x61
+	.byte	0x89
+	.byte	0x5
+	.long	.LASF1961
+	.byte	0x1
+	.long	0xd68b
+	.long	0xd696
+	.uleb128 0x2
+	.long	0xeab4
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF347
+	.byte	0x61
+	.byte	0x8d
+	.byte	0xa
+	.long	.LASF1962
+	.byte	0x1
+	.long	0xd6ab
+	.long	0xd6b6
+	.uleb128 0x2
+	.long	0xeab4
+	.uleb128 0x1
+	.long	0xc95a
+	.byte	0
+	.uleb128 0x81
+	.long	.LASF487
+	.byte	0x61
+	.byte	0x91
+	.byte	0xa
+	.long	.LASF1963
+	.long	0xd6c7
+	.uleb128 0x2
+	.long	0xeab4
+	.uleb128 0x1
+	.long	0xc95a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xd5b7
+	.uleb128 0x1d
+	.long	.LASF1964
+	.byte	0x10
+	.byte	0x61
+	.byte	0x96
+	.byte	0x8
+	.long	0xd70d
+	.uleb128 0xc
+	.long	.LASF1965
+	.byte	0x61
+	.byte	0x97
+	.byte	0x19
+	.long	0xeac3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1966
+	.byte	0x61
+	.byte	0x98
+	.byte	0xd
+	.long	0xd58c
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF1967
+	.byte	0x61
+	.byte	0x99
+	.byte	0xd
+	.long	0xd58c
+	.byte	0xa
+	.byte	0
+	.uleb128 0xa
+	.long	0xd6d8
+	.uleb128 0x6b
+	.long	.LASF1968
+	.byte	0x80
+	.byte	0x8
+	.byte	0x62
+	.byte	0xa4
+	.byte	0x7
+	.long	0xda94
+	.uleb128 0xdb
+	.long	.LASF1969
+	.byte	0x7
+	.byte	0x4
+	.long	0xacd5
+	.byte	0x62
+	.byte	0xab
+	.byte	0xa
+	.byte	0x1
+	.long	0xd741
+	.uleb128 0x11
+	.long	.LASF1970
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1971
+	.byte	0x1
+	.byte	0
+	.uleb128 0x67
+	.long	.LASF1972
+	.byte	0x7
+	.byte	0x1
+	.long	0xc93d
+	.byte	0x62
+	.byte	0xb9
+	.byte	0x10
+	.long	0xd75a
+	.uleb128 0x11
+	.long	.LASF1973
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1974
+	.byte	0x1
+	.byte	0x62
+	.byte	0xbf
+	.byte	0xc
+	.long	0xd7c0
+	.uleb128 0x52
+	.long	.LASF1975
+	.byte	0xc0
+	.long	0xacaa
+	.byte	0
+	.uleb128 0x52
+	.long	.LASF1976
+	.byte	0xc1
+	.long	0xacaa
+	.byte	0x1
+	.uleb128 0x52
+	.long	.LASF1971
+	.byte	0xc2
+	.long	0xacaa
+	.byte	0x2
+	.uleb128 0x52
+	.long	.LASF1977
+	.byte	0xc3
+	.long	0xacaa
+	.byte	0x3
+	.uleb128 0x52
+	.long	.LASF1978
+	.byte	0xc4
+	.long	0xacaa
+	.byte	0x4
+	.uleb128 0x52
+	.long	.LASF1979
+	.byte	0xc5
+	.long	0xacaa
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1980
+	.byte	0xc6
+	.long	0xacaa
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1981
+	.byte	0xc7
+	.long	0xacaa
+	.byte	0x7
+	.byte	0
+	.uleb128 0x67
+	.long	.LASF1982
+	.byte	0x7
+	.byte	0x1
+	.long	0xc93d
+	.byte	0x62
+	.byte	0xd0
+	.byte	0x10
+	.long	0xd7f7
+	.uleb128 0x11
+	.long	.LASF1983
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1984
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF1970
+	.byte	0x2
+	.uleb128 0x11
+	.long	.LASF1971
+	.byte	0x3
+	.uleb128 0x11
+	.long	.LASF1985
+	.byte	0x4
+	.uleb128 0x11
+	.long	.LASF1986
+	.byte	0xff
+	.byte	0
+	.uleb128 0x82
+	.byte	0x8
+	.byte	0x62
+	.byte	0xdc
+	.byte	0xb
+	.long	0xd81a
+	.uleb128 0x4f
+	.long	.LASF1987
+	.byte	0x62
+	.byte	0xde
+	.byte	0x1d
+	.long	0xeac3
+	.uleb128 0x4f
+	.long	.LASF1988
+	.byte	0x62
+	.byte	0xe1
+	.byte	0x1d
+	.long	0xeac3
+	.byte	0
+	.uleb128 0x34
+	.long	0xd1e0
+	.uleb128 0xc
+	.long	.LASF1989
+	.byte	0x62
+	.byte	0xb3
+	.byte	0x13
+	.long	0xc966
+	.byte	0
+	.uleb128 0x6c
+	.long	.LASF1990
+	.byte	0x62
+	.byte	0xb6
+	.byte	0x20
+	.long	0x49ea
+	.byte	0x4
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF1991
+	.byte	0x62
+	.byte	0xbc
+	.byte	0x20
+	.long	0xd741
+	.byte	0xc
+	.uleb128 0xc
+	.long	.LASF1992
+	.byte	0x62
+	.byte	0xc8
+	.byte	0x7
+	.long	0xd75a
+	.byte	0xd
+	.uleb128 0x87
+	.long	.LASF1993
+	.byte	0x62
+	.byte	0xcc
+	.byte	0x23
+	.long	.LASF1994
+	.long	0xc949
+	.uleb128 0x6c
+	.long	.LASF1995
+	.byte	0x62
+	.byte	0xce
+	.byte	0x1f
+	.long	0x4003
+	.byte	0x1
+	.byte	0xe
+	.uleb128 0x6c
+	.long	.LASF1996
+	.byte	0x62
+	.byte	0xda
+	.byte	0x18
+	.long	0x6735
+	.byte	0x1
+	.byte	0xf
+	.uleb128 0x95
+	.long	0xd7f7
+	.uleb128 0xc
+	.long	.LASF1997
+	.byte	0x62
+	.byte	0xe5
+	.byte	0x17
+	.long	0xec44
+	.byte	0x18
+	.uleb128 0xc
+	.long	.LASF1998
+	.byte	0x62
+	.byte	0xeb
+	.byte	0x19
+	.long	0xdc78
+	.byte	0x20
+	.uleb128 0xc
+	.long	.LASF1999
+	.byte	0x62
+	.byte	0xef
+	.byte	0x29
+	.long	0x7243
+	.byte	0x30
+	.uleb128 0xc
+	.long	.LASF2000
+	.byte	0x62
+	.byte	0xf4
+	.byte	0xb
+	.long	0xb6e6
+	.byte	0x38
+	.uleb128 0xc
+	.long	.LASF2001
+	.byte	0x62
+	.byte	0xf7
+	.byte	0x1b
+	.long	0xd37a
+	.byte	0x40
+	.uleb128 0xc
+	.long	.LASF2002
+	.byte	0x62
+	.byte	0xf9
+	.byte	0xa
+	.long	0xb789
+	.byte	0x48
+	.uleb128 0x15
+	.long	.LASF1968
+	.byte	0x62
+	.value	0x108
+	.byte	0x5
+	.long	.LASF2003
+	.long	0xd8ea
+	.long	0xd8fa
+	.uleb128 0x2
+	.long	0xeac3
+	.uleb128 0x1
+	.long	0xd75a
+	.uleb128 0x1
+	.long	0xd37a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1968
+	.byte	0x62
+	.value	0x10f
+	.byte	0x5
+	.long	.LASF2004
+	.long	0xd90f
+	.long	0xd91a
+	.uleb128 0x2
+	.long	0xeac3
+	.uleb128 0x1
+	.long	0xeac3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2005
+	.byte	0x62
+	.value	0x11b
+	.byte	0x1b
+	.long	.LASF2006
+	.long	0xd75a
+	.long	0xd93a
+	.uleb128 0x1
+	.long	0xd720
+	.uleb128 0x1
+	.long	0xca43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2007
+	.byte	0x62
+	.value	0x124
+	.byte	0xa
+	.long	.LASF2008
+	.long	0xacaa
+	.long	0xd953
+	.long	0xd959
+	.uleb128 0x2
+	.long	0xec49
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2009
+	.byte	0x62
+	.value	0x128
+	.byte	0x19
+	.long	.LASF2010
+	.long	0xebd1
+	.long	0xd972
+	.long	0xd978
+	.uleb128 0x2
+	.long	0xeac3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2009
+	.byte	0x62
+	.value	0x130
+	.byte	0x1f
+	.long	.LASF2011
+	.long	0xec4e
+	.long	0xd991
+	.long	0xd997
+	.uleb128 0x2
+	.long	0xec49
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1968
+	.byte	0x62
+	.value	0x153
+	.byte	0x5
+	.long	.LASF2012
+	.byte	0x1
+	.long	0xd9ad
+	.long	0xd9bd
+	.uleb128 0x2
+	.long	0xeac3
+	.uleb128 0x1
+	.long	0xd720
+	.uleb128 0x1
+	.long	0xca43
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1968
+	.byte	0x62
+	.value	0x158
+	.byte	0x5
+	.long	.LASF2013
+	.byte	0x1
+	.long	0xd9d3
+	.long	0xd9de
+	.uleb128 0x2
+	.long	0xeac3
+	.uleb128 0x1
+	.long	0xd37a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2014
+	.byte	0x62
+	.value	0x15c
+	.byte	0x5
+	.long	.LASF2015
+	.byte	0x1
+	.long	0xd9f4
+	.long	0xd9ff
+	.uleb128 0x2
+	.long	0xeac3
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF801
+	.byte	0x62
+	.value	0x16d
+	.byte	0xa
+	.long	.LASF2016
+	.byte	0x1
+	.long	0xda15
+	.long	0xda1b
+	.uleb128 0x2
+	.long	0xeac3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2017
+	.byte	0x62
+	.value	0x179
+	.byte	0xa
+	.long	.LASF2018
+	.long	0xacaa
+	.byte	0x1
+	.long	0xda35
+	.long	0xda3b
+	.uleb128 0x2
+	.long	0xeac3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2019
+	.byte	0x62
+	.value	0x17e
+	.byte	0xa
+	.long	.LASF2020
+	.long	0xacaa
+	.byte	0x1
+	.long	0xda55
+	.long	0xda5b
+	.uleb128 0x2
+	.long	0xeac3
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2021
+	.byte	0x62
+	.value	0x18b
+	.byte	0xa
+	.long	.LASF2022
+	.byte	0x1
+	.long	0xda71
+	.long	0xda77
+	.uleb128 0x2
+	.long	0xeac3
+	.byte	0
+	.uleb128 0x8a
+	.long	.LASF2023
+	.byte	0x62
+	.value	0x191
+	.byte	0x14
+	.long	.LASF2024
+	.long	0xca43
+	.long	0xda8d
+	.uleb128 0x2
+	.long	0xec49
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xd712
+	.uleb128 0x4
+	.byte	0x61
+	.byte	0xca
+	.byte	0xb
+	.long	0xe611
+	.uleb128 0x29
+	.long	.LASF2025
+	.byte	0x8
+	.byte	0x61
+	.byte	0xcc
+	.byte	0x7
+	.long	0xdabc
+	.uleb128 0xc
+	.long	.LASF1952
+	.byte	0x61
+	.byte	0xcd
+	.byte	0x13
+	.long	0xc966
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF2026
+	.byte	0x61
+	.byte	0xd2
+	.byte	0x1e
+	.long	0x12e
+	.byte	0x40
+	.uleb128 0xdc
+	.long	.LASF2027
+	.byte	0x10
+	.byte	0x63
+	.byte	0x6e
+	.byte	0x7
+	.long	0x5b75
+	.long	0xdc73
+	.uleb128 0x3b
+	.long	0x5b75
+	.byte	0
+	.byte	0x1
+	.uleb128 0x7c
+	.long	.LASF2027
+	.long	.LASF2028
+	.long	0xdaf3
+	.long	0xdafe
+	.uleb128 0x2
+	.long	0xf52b
+	.uleb128 0x1
+	.long	0xf530
+	.byte	0
+	.uleb128 0x7c
+	.long	.LASF2027
+	.long	.LASF2029
+	.long	0xdb0f
+	.long	0xdb1a
+	.uleb128 0x2
+	.long	0xf52b
+	.uleb128 0x1
+	.long	0xf535
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2027
+	.byte	0x63
+	.byte	0x70
+	.byte	0x5
+	.long	.LASF2030
+	.byte	0x1
+	.long	0xdb2f
+	.long	0xdb35
+	.uleb128 0x2
+	.long	0xf52b
+	.byte	0
+	.uleb128 0xdd
+	.long	.LASF2027
+	.byte	0x63
+	.byte	0x71
+	.byte	0xe
+	.long	.LASF2031
+	.byte	0x1
+	.long	0xdb4b
+	.long	0xdb56
+	.uleb128 0x2
+	.long	0xf52b
+	.uleb128 0x1
+	.long	0xeacd
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2032
+	.byte	0x63
+	.byte	0x73
+	.byte	0x20
+	.long	.LASF2033
+	.long	0xeacd
+	.byte	0x1
+	.long	0xdb6f
+	.long	0xdb75
+	.uleb128 0x2
+	.long	0xf53a
+	.byte	0
+	.uleb128 0xa5
+	.long	.LASF2036
+	.byte	0x79
+	.byte	0xb
+	.long	.LASF2038
+	.long	0xb6e6
+	.uleb128 0x2
+	.byte	0x10
+	.uleb128 0x2
+	.long	0xdac9
+	.long	0xdb94
+	.long	0xdba4
+	.uleb128 0x2
+	.long	0xf52b
+	.uleb128 0x1
+	.long	0x121
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0xde
+	.long	.LASF2034
+	.byte	0x63
+	.byte	0x8a
+	.byte	0xa
+	.long	.LASF2035
+	.byte	0x1
+	.uleb128 0x2
+	.byte	0x10
+	.uleb128 0x3
+	.long	0xdac9
+	.long	0xdbc1
+	.long	0xdbd6
+	.uleb128 0x2
+	.long	0xf52b
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0x121
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0xa5
+	.long	.LASF2037
+	.byte	0x92
+	.byte	0xa
+	.long	.LASF2039
+	.long	0xacaa
+	.uleb128 0x2
+	.byte	0x10
+	.uleb128 0x4
+	.long	0xdac9
+	.long	0xdbf5
+	.long	0xdc00
+	.uleb128 0x2
+	.long	0xf53a
+	.uleb128 0x1
+	.long	0xf53f
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2040
+	.byte	0x63
+	.byte	0x9c
+	.byte	0x11
+	.long	.LASF2041
+	.long	0x121
+	.long	0xdc18
+	.long	0xdc23
+	.uleb128 0x2
+	.long	0xf52b
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2042
+	.byte	0x63
+	.byte	0xa6
+	.byte	0x11
+	.long	.LASF2043
+	.long	0x121
+	.long	0xdc3b
+	.long	0xdc46
+	.uleb128 0x2
+	.long	0xf52b
+	.uleb128 0x1
+	.long	0x121
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2044
+	.byte	0x63
+	.byte	0xac
+	.byte	0x20
+	.long	0xeacd
+	.byte	0x8
+	.uleb128 0xdf
+	.long	.LASF2045
+	.long	.LASF2349
+	.byte	0x1
+	.long	0xdac9
+	.byte	0x1
+	.long	0xdc67
+	.uleb128 0x2
+	.long	0xf52b
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xdac9
+	.uleb128 0x1d
+	.long	.LASF2046
+	.byte	0x10
+	.byte	0x64
+	.byte	0x1d
+	.byte	0x8
+	.long	0xdca0
+	.uleb128 0xc
+	.long	.LASF2047
+	.byte	0x64
+	.byte	0x1e
+	.byte	0x1a
+	.long	0xead2
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2048
+	.byte	0x64
+	.byte	0x1f
+	.byte	0x1a
+	.long	0xead2
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa6
+	.long	.LASF2049
+	.byte	0x40
+	.byte	0x40
+	.byte	0x61
+	.byte	0xd6
+	.byte	0x1f
+	.long	0xdca0
+	.long	0xdd80
+	.uleb128 0x3b
+	.long	0xdaa1
+	.byte	0x8
+	.byte	0x1
+	.uleb128 0x7c
+	.long	.LASF2049
+	.long	.LASF2050
+	.long	0xdccb
+	.long	0xdcd6
+	.uleb128 0x2
+	.long	0xebcc
+	.uleb128 0x1
+	.long	0xf544
+	.byte	0
+	.uleb128 0x7c
+	.long	.LASF2049
+	.long	.LASF2051
+	.long	0xdce7
+	.long	0xdced
+	.uleb128 0x2
+	.long	0xebcc
+	.byte	0
+	.uleb128 0xe0
+	.long	.LASF2052
+	.long	0xf554
+	.byte	0
+	.byte	0x1
+	.uleb128 0xe1
+	.long	.LASF2053
+	.byte	0x61
+	.byte	0xd8
+	.byte	0xd
+	.long	.LASF2054
+	.byte	0x1
+	.long	0xdca0
+	.byte	0x2
+	.byte	0x1
+	.long	0xdd15
+	.long	0xdd20
+	.uleb128 0x2
+	.long	0xebcc
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xa7
+	.long	.LASF2055
+	.byte	0xdb
+	.long	.LASF2057
+	.long	0xebcc
+	.uleb128 0x2
+	.byte	0x10
+	.uleb128 0x2
+	.long	0xdca0
+	.long	0xdd3e
+	.long	0xdd49
+	.uleb128 0x2
+	.long	0xebcc
+	.uleb128 0x1
+	.long	0xf564
+	.byte	0
+	.uleb128 0xa7
+	.long	.LASF2056
+	.byte	0xdc
+	.long	.LASF2058
+	.long	0xebcc
+	.uleb128 0x2
+	.byte	0x10
+	.uleb128 0x3
+	.long	0xdca0
+	.long	0xdd67
+	.long	0xdd72
+	.uleb128 0x2
+	.long	0xebcc
+	.uleb128 0x1
+	.long	0xf564
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2059
+	.byte	0x61
+	.byte	0xdf
+	.byte	0x13
+	.long	0xf569
+	.byte	0x10
+	.byte	0
+	.uleb128 0xa
+	.long	0xdca0
+	.uleb128 0xe2
+	.long	.LASF2061
+	.byte	0x7
+	.byte	0x4
+	.long	0xacd5
+	.byte	0x62
+	.value	0x1a6
+	.byte	0x6
+	.long	0xddac
+	.uleb128 0x11
+	.long	.LASF2062
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2063
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF2064
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa8
+	.long	.LASF2065
+	.byte	0x90
+	.value	0x1ed
+	.long	0xdebe
+	.uleb128 0x34
+	.long	0xd1e0
+	.uleb128 0x68
+	.long	.LASF2066
+	.byte	0x62
+	.value	0x1ef
+	.byte	0x12
+	.long	0xd5b7
+	.byte	0x8
+	.byte	0
+	.byte	0x2
+	.uleb128 0x68
+	.long	.LASF2067
+	.byte	0x62
+	.value	0x1f0
+	.byte	0x18
+	.long	0xd712
+	.byte	0x8
+	.byte	0x10
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF2068
+	.byte	0x62
+	.value	0x201
+	.byte	0x17
+	.long	.LASF2069
+	.long	0xdd85
+	.byte	0x2
+	.long	0xddf8
+	.long	0xde03
+	.uleb128 0x2
+	.long	0xec53
+	.uleb128 0x1
+	.long	0xebbd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1965
+	.byte	0x62
+	.value	0x219
+	.byte	0x19
+	.long	.LASF2070
+	.long	0xebd1
+	.byte	0x2
+	.long	0xde1d
+	.long	0xde23
+	.uleb128 0x2
+	.long	0xec53
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2065
+	.byte	0x62
+	.value	0x228
+	.byte	0x5
+	.long	.LASF2071
+	.byte	0x1
+	.long	0xde39
+	.long	0xde44
+	.uleb128 0x2
+	.long	0xec53
+	.uleb128 0x1
+	.long	0xca43
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2065
+	.byte	0x62
+	.value	0x22d
+	.byte	0x5
+	.long	.LASF2072
+	.byte	0x1
+	.long	0xde5a
+	.long	0xde65
+	.uleb128 0x2
+	.long	0xec53
+	.uleb128 0x1
+	.long	0xebd1
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2073
+	.byte	0x62
+	.value	0x232
+	.byte	0x5
+	.long	.LASF2074
+	.byte	0x1
+	.long	0xde7b
+	.long	0xde86
+	.uleb128 0x2
+	.long	0xec53
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF550
+	.byte	0x62
+	.value	0x243
+	.byte	0x17
+	.long	.LASF2075
+	.long	0xdd85
+	.byte	0x1
+	.long	0xdea0
+	.long	0xdea6
+	.uleb128 0x2
+	.long	0xec53
+	.byte	0
+	.uleb128 0x6d
+	.long	.LASF2056
+	.byte	0x62
+	.value	0x24f
+	.byte	0xa
+	.long	.LASF2076
+	.long	0xdeb7
+	.uleb128 0x2
+	.long	0xec53
+	.byte	0
+	.byte	0
+	.uleb128 0xa8
+	.long	.LASF2077
+	.byte	0x90
+	.value	0x254
+	.long	0xdf53
+	.uleb128 0x3b
+	.long	0xddac
+	.byte	0
+	.byte	0x1
+	.uleb128 0x10
+	.long	.LASF2077
+	.byte	0x62
+	.value	0x256
+	.byte	0x5
+	.long	.LASF2078
+	.byte	0x1
+	.long	0xdee8
+	.long	0xdeee
+	.uleb128 0x2
+	.long	0xec58
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2077
+	.byte	0x62
+	.value	0x257
+	.byte	0x5
+	.long	.LASF2079
+	.byte	0x1
+	.long	0xdf04
+	.long	0xdf0f
+	.uleb128 0x2
+	.long	0xec58
+	.uleb128 0x1
+	.long	0xebd1
+	.byte	0
+	.uleb128 0xe3
+	.string	"run"
+	.byte	0x62
+	.value	0x25e
+	.byte	0xa
+	.long	.LASF2350
+	.byte	0x1
+	.long	0xdf26
+	.long	0xdf31
+	.uleb128 0x2
+	.long	0xec58
+	.uleb128 0x1
+	.long	0xebbd
+	.byte	0
+	.uleb128 0x8a
+	.long	.LASF2080
+	.byte	0x62
+	.value	0x272
+	.byte	0x17
+	.long	.LASF2081
+	.long	0xdd85
+	.long	0xdf47
+	.uleb128 0x2
+	.long	0xec58
+	.uleb128 0x1
+	.long	0xebbd
+	.byte	0
+	.byte	0
+	.uleb128 0x64
+	.long	.LASF2082
+	.byte	0x62
+	.value	0x2ca
+	.byte	0xd
+	.long	.LASF2083
+	.long	0xacaa
+	.uleb128 0x92
+	.long	.LASF2084
+	.byte	0x65
+	.byte	0x1a
+	.byte	0xc
+	.uleb128 0x1d
+	.long	.LASF2085
+	.byte	0x8
+	.byte	0x66
+	.byte	0x24
+	.byte	0x8
+	.long	0xdfdb
+	.uleb128 0x25
+	.long	.LASF2086
+	.byte	0x66
+	.byte	0x2c
+	.byte	0x12
+	.long	.LASF2087
+	.long	0xec5d
+	.long	0xdf92
+	.long	0xdf9d
+	.uleb128 0x2
+	.long	0xec62
+	.uleb128 0x1
+	.long	0xdfdb
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2088
+	.byte	0x66
+	.byte	0x30
+	.byte	0x12
+	.long	.LASF2089
+	.long	0xec5d
+	.long	0xdfb5
+	.long	0xdfc0
+	.uleb128 0x2
+	.long	0xec62
+	.uleb128 0x1
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2090
+	.byte	0x66
+	.byte	0x3f
+	.byte	0x12
+	.long	0xdfdb
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2091
+	.byte	0x66
+	.byte	0x40
+	.byte	0x9
+	.long	0xacf1
+	.byte	0x4
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2092
+	.byte	0x66
+	.byte	0x20
+	.byte	0x7
+	.long	0xacf1
+	.uleb128 0x38
+	.long	.LASF2093
+	.byte	0x66
+	.byte	0x59
+	.byte	0x22
+	.long	.LASF2094
+	.long	0x7fc2
+	.uleb128 0x1c
+	.long	.LASF2095
+	.byte	0x66
+	.byte	0x5f
+	.byte	0xc
+	.long	.LASF2096
+	.long	0xacf1
+	.long	0xe011
+	.uleb128 0x1
+	.long	0xdfdb
+	.byte	0
+	.uleb128 0xe4
+	.long	.LASF2097
+	.byte	0x67
+	.byte	0x71
+	.byte	0x16
+	.long	0xacf9
+	.long	0x1fffffff
+	.uleb128 0x6b
+	.long	.LASF2098
+	.byte	0x30
+	.byte	0x8
+	.byte	0x67
+	.byte	0x73
+	.byte	0x7
+	.long	0xe1a7
+	.uleb128 0xe5
+	.long	.LASF2351
+	.byte	0x5
+	.byte	0x4
+	.long	0xacf1
+	.byte	0x67
+	.byte	0x77
+	.byte	0x10
+	.byte	0x1
+	.long	0xe063
+	.uleb128 0xe6
+	.string	"low"
+	.long	0x1fffffff
+	.uleb128 0xa9
+	.long	.LASF2099
+	.long	0x3ffffffe
+	.uleb128 0xa9
+	.long	.LASF2100
+	.long	0x5ffffffd
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF2101
+	.byte	0x67
+	.byte	0x81
+	.byte	0xe
+	.long	0xca37
+	.byte	0
+	.byte	0x2
+	.uleb128 0x98
+	.long	.LASF2102
+	.byte	0x67
+	.byte	0x83
+	.byte	0x20
+	.long	0x56ae
+	.byte	0x8
+	.byte	0x2
+	.uleb128 0x49
+	.long	.LASF2103
+	.byte	0x67
+	.byte	0x86
+	.byte	0x1d
+	.long	0x9343
+	.byte	0x10
+	.byte	0x2
+	.uleb128 0x49
+	.long	.LASF2104
+	.byte	0x67
+	.byte	0x8b
+	.byte	0x9
+	.long	0xacf1
+	.byte	0x18
+	.byte	0x2
+	.uleb128 0x49
+	.long	.LASF2105
+	.byte	0x67
+	.byte	0x8e
+	.byte	0xe
+	.long	0xacd5
+	.byte	0x1c
+	.byte	0x2
+	.uleb128 0x49
+	.long	.LASF2106
+	.byte	0x67
+	.byte	0x91
+	.byte	0xe
+	.long	0xe030
+	.byte	0x20
+	.byte	0x2
+	.uleb128 0x49
+	.long	.LASF2107
+	.byte	0x67
+	.byte	0x94
+	.byte	0x12
+	.long	0xdfdb
+	.byte	0x24
+	.byte	0x2
+	.uleb128 0x49
+	.long	.LASF2108
+	.byte	0x67
+	.byte	0x97
+	.byte	0x12
+	.long	0xe1ac
+	.byte	0x28
+	.byte	0x2
+	.uleb128 0x49
+	.long	.LASF2109
+	.byte	0x67
+	.byte	0x9a
+	.byte	0x9
+	.long	0xacf1
+	.byte	0x2c
+	.byte	0x2
+	.uleb128 0x1a
+	.long	.LASF2110
+	.byte	0x67
+	.byte	0x9d
+	.byte	0x12
+	.long	.LASF2111
+	.long	0xe1ac
+	.byte	0x2
+	.long	0xe0fb
+	.long	0xe101
+	.uleb128 0x2
+	.long	0xed70
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2112
+	.byte	0x67
+	.byte	0xa0
+	.byte	0x9
+	.long	.LASF2113
+	.long	0xacf1
+	.byte	0x2
+	.long	0xe11a
+	.long	0xe120
+	.uleb128 0x2
+	.long	0xed70
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2098
+	.byte	0x67
+	.byte	0xa9
+	.byte	0x5
+	.long	.LASF2114
+	.byte	0x2
+	.long	0xe135
+	.long	0xe14a
+	.uleb128 0x2
+	.long	0xed75
+	.uleb128 0x1
+	.long	0xacf1
+	.uleb128 0x1
+	.long	0xacd5
+	.uleb128 0x1
+	.long	0xe030
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2098
+	.byte	0x67
+	.byte	0xb6
+	.byte	0x5
+	.long	.LASF2115
+	.byte	0x2
+	.long	0xe15f
+	.long	0xe174
+	.uleb128 0x2
+	.long	0xed75
+	.uleb128 0x1
+	.long	0xed7a
+	.uleb128 0x1
+	.long	0xacd5
+	.uleb128 0x1
+	.long	0xe030
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2085
+	.byte	0x67
+	.byte	0x7d
+	.byte	0xb
+	.long	0xdf6d
+	.byte	0x1
+	.uleb128 0xa
+	.long	0xe174
+	.uleb128 0xaa
+	.long	.LASF2116
+	.byte	0xc9
+	.long	.LASF2118
+	.long	0xacf9
+	.sleb128 -1
+	.uleb128 0xaa
+	.long	.LASF2117
+	.byte	0xca
+	.long	.LASF2119
+	.long	0xacf9
+	.sleb128 -2
+	.byte	0
+	.uleb128 0xa
+	.long	0xe022
+	.uleb128 0xd
+	.long	.LASF2120
+	.byte	0x66
+	.byte	0x21
+	.byte	0x7
+	.long	0xacf1
+	.uleb128 0x6b
+	.long	.LASF2121
+	.byte	0x30
+	.byte	0x8
+	.byte	0x67
+	.byte	0xf4
+	.byte	0x7
+	.long	0xe3f9
+	.uleb128 0xe7
+	.long	.LASF2084
+	.byte	0x1
+	.byte	0x67
+	.value	0x129
+	.byte	0xc
+	.byte	0x1
+	.uleb128 0x3b
+	.long	0xe022
+	.byte	0
+	.byte	0x1
+	.uleb128 0x1f
+	.long	.LASF2122
+	.byte	0x67
+	.byte	0xf6
+	.byte	0xa
+	.long	.LASF2123
+	.long	0xe1ed
+	.long	0xe1f3
+	.uleb128 0x2
+	.long	0xed7f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2121
+	.byte	0x67
+	.value	0x109
+	.byte	0x5
+	.long	.LASF2124
+	.byte	0x1
+	.long	0xe209
+	.long	0xe21e
+	.uleb128 0x2
+	.long	0xed7f
+	.uleb128 0x1
+	.long	0xacf1
+	.uleb128 0x1
+	.long	0xacd5
+	.uleb128 0x1
+	.long	0xe030
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2121
+	.byte	0x67
+	.value	0x110
+	.byte	0x5
+	.long	.LASF2125
+	.byte	0x1
+	.long	0xe234
+	.long	0xe249
+	.uleb128 0x2
+	.long	0xed7f
+	.uleb128 0x1
+	.long	0xed7a
+	.uleb128 0x1
+	.long	0xacd5
+	.uleb128 0x1
+	.long	0xe030
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2121
+	.byte	0x67
+	.value	0x116
+	.byte	0x5
+	.long	.LASF2126
+	.byte	0x1
+	.long	0xe25f
+	.long	0xe26a
+	.uleb128 0x2
+	.long	0xed7f
+	.uleb128 0x1
+	.long	0xed84
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF2121
+	.byte	0x67
+	.value	0x12c
+	.byte	0xe
+	.long	.LASF2127
+	.long	0xe27f
+	.long	0xe28a
+	.uleb128 0x2
+	.long	0xed7f
+	.uleb128 0x1
+	.long	0xe1c6
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF2121
+	.byte	0x67
+	.value	0x135
+	.byte	0xe
+	.long	.LASF2128
+	.long	0xe29f
+	.long	0xe2aa
+	.uleb128 0x2
+	.long	0xed7f
+	.uleb128 0x1
+	.long	0xdf64
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2129
+	.byte	0x67
+	.value	0x13a
+	.byte	0xa
+	.long	.LASF2130
+	.byte	0x1
+	.long	0xe2c0
+	.long	0xe2c6
+	.uleb128 0x2
+	.long	0xed7f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2129
+	.byte	0x67
+	.value	0x13f
+	.byte	0xa
+	.long	.LASF2131
+	.byte	0x1
+	.long	0xe2dc
+	.long	0xe2f1
+	.uleb128 0x2
+	.long	0xed7f
+	.uleb128 0x1
+	.long	0xacf1
+	.uleb128 0x1
+	.long	0xacd5
+	.uleb128 0x1
+	.long	0xe030
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2129
+	.byte	0x67
+	.value	0x14d
+	.byte	0xa
+	.long	.LASF2132
+	.byte	0x1
+	.long	0xe307
+	.long	0xe31c
+	.uleb128 0x2
+	.long	0xed7f
+	.uleb128 0x1
+	.long	0xe174
+	.uleb128 0x1
+	.long	0xacd5
+	.uleb128 0x1
+	.long	0xe030
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2129
+	.byte	0x67
+	.value	0x161
+	.byte	0xa
+	.long	.LASF2133
+	.byte	0x1
+	.long	0xe332
+	.long	0xe33d
+	.uleb128 0x2
+	.long	0xed7f
+	.uleb128 0x1
+	.long	0xe1c6
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2129
+	.byte	0x67
+	.value	0x16d
+	.byte	0xa
+	.long	.LASF2134
+	.byte	0x1
+	.long	0xe353
+	.long	0xe35e
+	.uleb128 0x2
+	.long	0xed7f
+	.uleb128 0x1
+	.long	0xdf64
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2135
+	.byte	0x67
+	.value	0x173
+	.byte	0xa
+	.long	.LASF2136
+	.byte	0x1
+	.long	0xe374
+	.long	0xe37a
+	.uleb128 0x2
+	.long	0xed7f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2137
+	.byte	0x67
+	.value	0x17c
+	.byte	0x5
+	.long	.LASF2138
+	.byte	0x1
+	.long	0xe390
+	.long	0xe39b
+	.uleb128 0x2
+	.long	0xed7f
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2139
+	.byte	0x67
+	.value	0x182
+	.byte	0xa
+	.long	.LASF2140
+	.long	0xacaa
+	.byte	0x1
+	.long	0xe3b5
+	.long	0xe3bb
+	.uleb128 0x2
+	.long	0xed89
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2141
+	.byte	0x67
+	.value	0x191
+	.byte	0xa
+	.long	.LASF2142
+	.byte	0x1
+	.long	0xe3d1
+	.long	0xe3dc
+	.uleb128 0x2
+	.long	0xed7f
+	.uleb128 0x1
+	.long	0xebbd
+	.byte	0
+	.uleb128 0x8a
+	.long	.LASF2091
+	.byte	0x67
+	.value	0x1b6
+	.byte	0x9
+	.long	.LASF2143
+	.long	0xacf1
+	.long	0xe3f2
+	.uleb128 0x2
+	.long	0xed89
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xe1b8
+	.uleb128 0x16
+	.byte	0x67
+	.value	0x1e3
+	.byte	0xb
+	.long	0xe635
+	.uleb128 0x64
+	.long	.LASF2144
+	.byte	0x67
+	.value	0x1ca
+	.byte	0xc
+	.long	.LASF2145
+	.long	0xacf1
+	.uleb128 0x64
+	.long	.LASF2091
+	.byte	0x67
+	.value	0x1d6
+	.byte	0xc
+	.long	.LASF2146
+	.long	0xacf1
+	.uleb128 0x46
+	.long	.LASF2141
+	.byte	0x67
+	.value	0x1da
+	.byte	0xd
+	.long	.LASF2147
+	.long	0xe440
+	.uleb128 0x1
+	.long	0xebbd
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2148
+	.byte	0x10
+	.byte	0x68
+	.byte	0x4d
+	.byte	0x7
+	.long	0xe4c1
+	.uleb128 0x34
+	.long	0xd1e0
+	.uleb128 0xc
+	.long	.LASF2149
+	.byte	0x68
+	.byte	0x52
+	.byte	0xe
+	.long	0xed93
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2150
+	.byte	0x68
+	.byte	0x54
+	.byte	0x11
+	.long	0x121
+	.byte	0x8
+	.uleb128 0x1f
+	.long	.LASF2148
+	.byte	0x68
+	.byte	0x56
+	.byte	0x5
+	.long	.LASF2151
+	.long	0xe480
+	.long	0xe486
+	.uleb128 0x2
+	.long	0xed98
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2152
+	.byte	0x68
+	.byte	0x58
+	.byte	0x5
+	.long	.LASF2153
+	.long	0xe49a
+	.long	0xe4a5
+	.uleb128 0x2
+	.long	0xed98
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x61
+	.long	.LASF340
+	.byte	0x68
+	.byte	0x5b
+	.byte	0xa
+	.long	.LASF2154
+	.long	0xe4b5
+	.uleb128 0x2
+	.long	0xed98
+	.uleb128 0x1
+	.long	0xacd5
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF2155
+	.byte	0x1
+	.byte	0x68
+	.value	0x251
+	.byte	0x7
+	.long	0xe4e7
+	.uleb128 0x6d
+	.long	.LASF2155
+	.byte	0x68
+	.value	0x253
+	.byte	0x5
+	.long	.LASF2156
+	.long	0xe4e0
+	.uleb128 0x2
+	.long	0xeda7
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF2157
+	.byte	0x1
+	.byte	0x68
+	.value	0x237
+	.byte	0x7
+	.long	0xe50d
+	.uleb128 0x6d
+	.long	.LASF2157
+	.byte	0x68
+	.value	0x239
+	.byte	0x5
+	.long	.LASF2158
+	.long	0xe506
+	.uleb128 0x2
+	.long	0xeda2
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF2159
+	.byte	0x1
+	.byte	0x68
+	.value	0x272
+	.byte	0x7
+	.long	0xe533
+	.uleb128 0x6d
+	.long	.LASF2159
+	.byte	0x68
+	.value	0x274
+	.byte	0x5
+	.long	.LASF2160
+	.long	0xe52c
+	.uleb128 0x2
+	.long	0xedac
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF2161
+	.byte	0x10
+	.byte	0x68
+	.value	0x281
+	.byte	0x7
+	.long	0xe55e
+	.uleb128 0x34
+	.long	0xe440
+	.uleb128 0x6d
+	.long	.LASF2161
+	.byte	0x68
+	.value	0x283
+	.byte	0x5
+	.long	.LASF2162
+	.long	0xe557
+	.uleb128 0x2
+	.long	0xedb1
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2163
+	.byte	0x1
+	.byte	0x69
+	.byte	0x26
+	.byte	0x8
+	.long	0xe597
+	.uleb128 0x38
+	.long	.LASF2164
+	.byte	0x69
+	.byte	0x27
+	.byte	0x11
+	.long	.LASF2165
+	.long	0xacaa
+	.uleb128 0x8b
+	.long	.LASF107
+	.byte	0x69
+	.byte	0x28
+	.byte	0x5
+	.long	.LASF2166
+	.long	0xacaa
+	.long	0xe590
+	.uleb128 0x2
+	.long	0xedb6
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2167
+	.byte	0x1
+	.byte	0x69
+	.byte	0x2d
+	.byte	0x8
+	.long	0xe5d0
+	.uleb128 0x38
+	.long	.LASF2164
+	.byte	0x69
+	.byte	0x2e
+	.byte	0x11
+	.long	.LASF2168
+	.long	0xacaa
+	.uleb128 0x8b
+	.long	.LASF107
+	.byte	0x69
+	.byte	0x2f
+	.byte	0x5
+	.long	.LASF2169
+	.long	0xacaa
+	.long	0xe5c9
+	.uleb128 0x2
+	.long	0xedbb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2170
+	.byte	0x61
+	.byte	0x4c
+	.byte	0x7
+	.long	0xedc5
+	.uleb128 0xa3
+	.long	.LASF2171
+	.byte	0x61
+	.byte	0x5c
+	.byte	0xd
+	.long	.LASF2173
+	.uleb128 0x1
+	.long	0xe5d0
+	.byte	0
+	.byte	0
+	.uleb128 0x74
+	.string	"r1"
+	.byte	0x5a
+	.byte	0x1b
+	.byte	0xb
+	.long	0xe660
+	.uleb128 0x77
+	.long	.LASF2174
+	.byte	0x5e
+	.byte	0x4d
+	.byte	0x25
+	.long	.LASF2175
+	.long	0xe611
+	.uleb128 0x1
+	.long	0xd317
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF2176
+	.byte	0x61
+	.byte	0x37
+	.byte	0x38
+	.long	.LASF2177
+	.long	0xeac3
+	.uleb128 0x3e
+	.long	.LASF2178
+	.uleb128 0x3e
+	.long	.LASF2179
+	.uleb128 0x3e
+	.long	.LASF1873
+	.uleb128 0x3e
+	.long	.LASF2180
+	.uleb128 0x77
+	.long	.LASF2181
+	.byte	0x67
+	.byte	0x61
+	.byte	0x25
+	.long	.LASF2182
+	.long	0xe65a
+	.uleb128 0x1
+	.long	0xed8e
+	.uleb128 0x1
+	.long	0xebd1
+	.uleb128 0x1
+	.long	0xed25
+	.uleb128 0x1
+	.long	0xca43
+	.byte	0
+	.uleb128 0x7b
+	.long	.LASF2183
+	.byte	0
+	.uleb128 0xe8
+	.string	"d2"
+	.byte	0x6a
+	.byte	0x1f
+	.byte	0xb
+	.uleb128 0x29
+	.long	.LASF2184
+	.byte	0x8
+	.byte	0x6a
+	.byte	0x40
+	.byte	0x7
+	.long	0xe772
+	.uleb128 0x1d
+	.long	.LASF2185
+	.byte	0x1
+	.byte	0x6a
+	.byte	0x41
+	.byte	0xc
+	.long	0xe69e
+	.uleb128 0x61
+	.long	.LASF3
+	.byte	0x6a
+	.byte	0x42
+	.byte	0xe
+	.long	.LASF2186
+	.long	0xe692
+	.uleb128 0x2
+	.long	0xead7
+	.uleb128 0x1
+	.long	0xeadc
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xe675
+	.uleb128 0xd
+	.long	.LASF2187
+	.byte	0x6a
+	.byte	0x44
+	.byte	0xb
+	.long	0x64ef
+	.uleb128 0xc
+	.long	.LASF2188
+	.byte	0x6a
+	.byte	0x46
+	.byte	0x13
+	.long	0xe6a3
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF2184
+	.byte	0x6a
+	.byte	0x48
+	.byte	0x5
+	.long	.LASF2189
+	.long	0xe6d0
+	.long	0xe6d6
+	.uleb128 0x2
+	.long	0xebb8
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF2184
+	.byte	0x6a
+	.byte	0x49
+	.byte	0x5
+	.long	.LASF2190
+	.long	0xe6ea
+	.long	0xe6f5
+	.uleb128 0x2
+	.long	0xebb8
+	.uleb128 0x1
+	.long	0xebbd
+	.byte	0
+	.uleb128 0x70
+	.long	.LASF53
+	.byte	0x6a
+	.byte	0x4a
+	.byte	0x12
+	.long	.LASF2191
+	.long	0xebc2
+	.long	0xe70d
+	.long	0xe718
+	.uleb128 0x2
+	.long	0xebb8
+	.uleb128 0x1
+	.long	0xebbd
+	.byte	0
+	.uleb128 0x80
+	.long	.LASF107
+	.byte	0x6a
+	.byte	0x4c
+	.byte	0xe
+	.long	.LASF2192
+	.long	0xacaa
+	.long	0xe731
+	.long	0xe737
+	.uleb128 0x2
+	.long	0xebc7
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2184
+	.byte	0x6a
+	.byte	0x57
+	.byte	0x5
+	.long	.LASF2193
+	.long	0xe74b
+	.long	0xe756
+	.uleb128 0x2
+	.long	0xebb8
+	.uleb128 0x1
+	.long	0xeadc
+	.byte	0
+	.uleb128 0x8b
+	.long	.LASF487
+	.byte	0x6a
+	.byte	0x59
+	.byte	0xf
+	.long	.LASF2194
+	.long	0xebcc
+	.long	0xe76b
+	.uleb128 0x2
+	.long	0xebb8
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xe668
+	.uleb128 0xa6
+	.long	.LASF2195
+	.byte	0x80
+	.byte	0x40
+	.byte	0x6a
+	.byte	0x23
+	.byte	0x7
+	.long	0xdca0
+	.long	0xe852
+	.uleb128 0x3b
+	.long	0xdca0
+	.byte	0
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF1952
+	.byte	0x6a
+	.byte	0x24
+	.byte	0x13
+	.long	0xc966
+	.byte	0x40
+	.uleb128 0xc
+	.long	.LASF2066
+	.byte	0x6a
+	.byte	0x25
+	.byte	0x17
+	.long	0xedc0
+	.byte	0x48
+	.uleb128 0xc
+	.long	.LASF2196
+	.byte	0x6a
+	.byte	0x26
+	.byte	0x1d
+	.long	0xebd1
+	.byte	0x50
+	.uleb128 0xc
+	.long	.LASF2197
+	.byte	0x6a
+	.byte	0x27
+	.byte	0x20
+	.long	0xd571
+	.byte	0x58
+	.uleb128 0x1b
+	.long	.LASF2198
+	.byte	0x6a
+	.byte	0x29
+	.byte	0xa
+	.long	.LASF2199
+	.byte	0x1
+	.long	0xe7da
+	.long	0xe7e5
+	.uleb128 0x2
+	.long	0xeadc
+	.uleb128 0x1
+	.long	0xf521
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2195
+	.byte	0x6a
+	.byte	0x31
+	.byte	0x5
+	.long	.LASF2200
+	.byte	0x1
+	.long	0xe7fa
+	.long	0xe80f
+	.uleb128 0x2
+	.long	0xeadc
+	.uleb128 0x1
+	.long	0xedc0
+	.uleb128 0x1
+	.long	0xebd1
+	.uleb128 0x1
+	.long	0xed9d
+	.byte	0
+	.uleb128 0xe9
+	.long	.LASF2201
+	.byte	0x6a
+	.byte	0x38
+	.byte	0x5
+	.long	.LASF2202
+	.byte	0x1
+	.long	0xe777
+	.byte	0x1
+	.long	0xe82a
+	.long	0xe835
+	.uleb128 0x2
+	.long	0xeadc
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xea
+	.string	"ctx"
+	.byte	0x6a
+	.byte	0x3c
+	.byte	0x1d
+	.long	.LASF2352
+	.long	0xebd1
+	.byte	0x1
+	.long	0xe84b
+	.uleb128 0x2
+	.long	0xf526
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xe777
+	.byte	0
+	.byte	0
+	.uleb128 0xa2
+	.string	"v1"
+	.byte	0x6b
+	.byte	0xa1
+	.long	0xe9bc
+	.uleb128 0x4
+	.byte	0x6b
+	.byte	0xa4
+	.byte	0xf
+	.long	0xd259
+	.uleb128 0x4
+	.byte	0x6b
+	.byte	0xa5
+	.byte	0xf
+	.long	0xd263
+	.uleb128 0x4
+	.byte	0x63
+	.byte	0xb7
+	.byte	0x13
+	.long	0xdac9
+	.uleb128 0x16
+	.byte	0x62
+	.value	0x2d3
+	.byte	0x13
+	.long	0xd712
+	.uleb128 0x16
+	.byte	0x62
+	.value	0x2d4
+	.byte	0x13
+	.long	0xdebe
+	.uleb128 0x16
+	.byte	0x62
+	.value	0x2d9
+	.byte	0x13
+	.long	0xdd85
+	.uleb128 0x16
+	.byte	0x62
+	.value	0x2da
+	.byte	0x13
+	.long	0xdd99
+	.uleb128 0x16
+	.byte	0x62
+	.value	0x2db
+	.byte	0x13
+	.long	0xdd9f
+	.uleb128 0x16
+	.byte	0x62
+	.value	0x2dc
+	.byte	0x13
+	.long	0xdda5
+	.uleb128 0x16
+	.byte	0x62
+	.value	0x2de
+	.byte	0x13
+	.long	0xdf53
+	.uleb128 0x16
+	.byte	0x62
+	.value	0x2df
+	.byte	0x13
+	.long	0xe62b
+	.uleb128 0x16
+	.byte	0x62
+	.value	0x2e1
+	.byte	0x13
+	.long	0xe668
+	.uleb128 0x4
+	.byte	0x66
+	.byte	0x74
+	.byte	0x13
+	.long	0xdfdb
+	.uleb128 0x39
+	.long	.LASF2203
+	.byte	0x66
+	.byte	0x79
+	.byte	0xb
+	.long	0xe8f2
+	.uleb128 0x4
+	.byte	0x66
+	.byte	0x7a
+	.byte	0x13
+	.long	0xdfe7
+	.uleb128 0x4
+	.byte	0x66
+	.byte	0x7f
+	.byte	0x13
+	.long	0xdff7
+	.byte	0
+	.uleb128 0x16
+	.byte	0x67
+	.value	0x1e9
+	.byte	0x13
+	.long	0xe1b8
+	.uleb128 0x16
+	.byte	0x67
+	.value	0x1ea
+	.byte	0x13
+	.long	0xdf64
+	.uleb128 0x85
+	.long	.LASF2204
+	.byte	0x67
+	.value	0x1f0
+	.byte	0xb
+	.long	0xe92e
+	.uleb128 0x16
+	.byte	0x67
+	.value	0x1f1
+	.byte	0x13
+	.long	0xe407
+	.uleb128 0x16
+	.byte	0x67
+	.value	0x1f2
+	.byte	0x13
+	.long	0xe418
+	.uleb128 0x16
+	.byte	0x67
+	.value	0x1f5
+	.byte	0x13
+	.long	0xe429
+	.byte	0
+	.uleb128 0x16
+	.byte	0x68
+	.value	0x295
+	.byte	0x13
+	.long	0xe4c1
+	.uleb128 0x16
+	.byte	0x68
+	.value	0x296
+	.byte	0x13
+	.long	0xe4e7
+	.uleb128 0x16
+	.byte	0x68
+	.value	0x297
+	.byte	0x13
+	.long	0xe50d
+	.uleb128 0x16
+	.byte	0x68
+	.value	0x298
+	.byte	0x13
+	.long	0xe533
+	.uleb128 0x16
+	.byte	0x68
+	.value	0x29a
+	.byte	0xf
+	.long	0xd259
+	.uleb128 0x16
+	.byte	0x68
+	.value	0x29b
+	.byte	0xf
+	.long	0xd263
+	.uleb128 0x16
+	.byte	0x6c
+	.value	0x1d1
+	.byte	0xf
+	.long	0xd259
+	.uleb128 0x16
+	.byte	0x6c
+	.value	0x1d2
+	.byte	0xf
+	.long	0xd263
+	.uleb128 0x16
+	.byte	0x6d
+	.value	0x2f6
+	.byte	0xf
+	.long	0xd259
+	.uleb128 0x16
+	.byte	0x6d
+	.value	0x2f7
+	.byte	0xf
+	.long	0xd263
+	.uleb128 0x16
+	.byte	0x69
+	.value	0x26e
+	.byte	0x17
+	.long	0xe55e
+	.uleb128 0x16
+	.byte	0x69
+	.value	0x26f
+	.byte	0x17
+	.long	0xe597
+	.uleb128 0xab
+	.long	.LASF2049
+	.byte	0x6e
+	.byte	0x1a
+	.uleb128 0x4
+	.byte	0x6e
+	.byte	0x1c
+	.byte	0x17
+	.long	0xe5d0
+	.uleb128 0x4
+	.byte	0x6e
+	.byte	0x1d
+	.byte	0x17
+	.long	0xe5dc
+	.uleb128 0x4
+	.byte	0x6e
+	.byte	0x20
+	.byte	0x17
+	.long	0xe611
+	.byte	0
+	.byte	0
+	.uleb128 0xab
+	.long	.LASF2205
+	.byte	0x5f
+	.byte	0xed
+	.uleb128 0x4
+	.byte	0x5f
+	.byte	0xee
+	.byte	0x17
+	.long	0xd4f2
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.long	0xd15e
+	.uleb128 0x31
+	.long	0xd16b
+	.uleb128 0x7
+	.long	0xd178
+	.uleb128 0xb
+	.long	0xd1db
+	.uleb128 0x7
+	.long	0xd1e0
+	.uleb128 0xb
+	.long	0xd229
+	.uleb128 0x7
+	.long	0x56ae
+	.uleb128 0xb
+	.long	0x5b32
+	.uleb128 0xb
+	.long	0x56ae
+	.uleb128 0x7
+	.long	0x5b37
+	.uleb128 0x7
+	.long	0x5b32
+	.uleb128 0x7
+	.long	0x5b3c
+	.uleb128 0xb
+	.long	0xd22e
+	.uleb128 0x7
+	.long	0xd263
+	.uleb128 0x7
+	.long	0xd312
+	.uleb128 0x39
+	.long	.LASF2206
+	.byte	0x6f
+	.byte	0x16
+	.byte	0xb
+	.long	0xea9b
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.uleb128 0x40
+	.string	"tbb"
+	.long	0xd133
+	.byte	0
+	.uleb128 0x31
+	.long	0xb39f
+	.uleb128 0x7
+	.long	0xd4f2
+	.uleb128 0x7
+	.long	0xd54c
+	.uleb128 0x31
+	.long	0xd59d
+	.uleb128 0x31
+	.long	0xd5aa
+	.uleb128 0x7
+	.long	0xd5b7
+	.uleb128 0x7
+	.long	0xd6d3
+	.uleb128 0xb
+	.long	0xd6d3
+	.uleb128 0x7
+	.long	0xd712
+	.uleb128 0x31
+	.long	0xdabc
+	.uleb128 0x7
+	.long	0x5b75
+	.uleb128 0x7
+	.long	0xdc78
+	.uleb128 0x7
+	.long	0xe675
+	.uleb128 0x7
+	.long	0xe777
+	.uleb128 0xa
+	.long	0xeadc
+	.uleb128 0x7
+	.long	0x5ec9
+	.uleb128 0xb
+	.long	0xe69e
+	.uleb128 0xb
+	.long	0x5fc6
+	.uleb128 0x22
+	.long	0x5ec9
+	.uleb128 0xb
+	.long	0xe675
+	.uleb128 0xb
+	.long	0x5ec9
+	.uleb128 0xb
+	.long	0x5fcb
+	.uleb128 0xb
+	.long	0x60ec
+	.uleb128 0x7
+	.long	0x5fcb
+	.uleb128 0x22
+	.long	0x5fcb
+	.uleb128 0x7
+	.long	0x60f1
+	.uleb128 0xb
+	.long	0xeae1
+	.uleb128 0xb
+	.long	0x61ee
+	.uleb128 0x22
+	.long	0x60f1
+	.uleb128 0xb
+	.long	0xeadc
+	.uleb128 0xb
+	.long	0x60f1
+	.uleb128 0xb
+	.long	0x61f3
+	.uleb128 0xb
+	.long	0x636b
+	.uleb128 0xb
+	.long	0x6243
+	.uleb128 0xb
+	.long	0x6250
+	.uleb128 0x7
+	.long	0x61f3
+	.uleb128 0x22
+	.long	0x61f3
+	.uleb128 0x7
+	.long	0x6370
+	.uleb128 0xb
+	.long	0x6444
+	.uleb128 0x22
+	.long	0x6370
+	.uleb128 0xb
+	.long	0x6370
+	.uleb128 0x7
+	.long	0x5d05
+	.uleb128 0x22
+	.long	0x5d05
+	.uleb128 0xb
+	.long	0x5d05
+	.uleb128 0xb
+	.long	0x5d78
+	.uleb128 0x7
+	.long	0x5ec4
+	.uleb128 0x7
+	.long	0x6461
+	.uleb128 0x22
+	.long	0x6461
+	.uleb128 0xb
+	.long	0x6461
+	.uleb128 0xb
+	.long	0xe777
+	.uleb128 0x7
+	.long	0x64ef
+	.uleb128 0x22
+	.long	0x64ef
+	.uleb128 0xb
+	.long	0x64ef
+	.uleb128 0x7
+	.long	0x6730
+	.uleb128 0xb
+	.long	0x6604
+	.uleb128 0xb
+	.long	0x6612
+	.uleb128 0xb
+	.long	0x6730
+	.uleb128 0x7
+	.long	0xe668
+	.uleb128 0x22
+	.long	0xe668
+	.uleb128 0xb
+	.long	0xe668
+	.uleb128 0x7
+	.long	0xe772
+	.uleb128 0x7
+	.long	0xdca0
+	.uleb128 0xb
+	.long	0xd712
+	.uleb128 0x7
+	.long	0x6735
+	.uleb128 0xb
+	.long	0x6bd6
+	.uleb128 0xb
+	.long	0x6735
+	.uleb128 0x7
+	.long	0x6bdb
+	.uleb128 0x7
+	.long	0x6bd6
+	.uleb128 0x7
+	.long	0x6be0
+	.uleb128 0xb
+	.long	0xd7c0
+	.uleb128 0x7
+	.long	0xe621
+	.uleb128 0x7
+	.long	0x7234
+	.uleb128 0x7
+	.long	0x723e
+	.uleb128 0x7
+	.long	0x6be5
+	.uleb128 0xb
+	.long	0x7234
+	.uleb128 0xb
+	.long	0x6be5
+	.uleb128 0x7
+	.long	0x7239
+	.uleb128 0xb
+	.long	0x6bf3
+	.uleb128 0x7
+	.long	0x7243
+	.uleb128 0xb
+	.long	0x7936
+	.uleb128 0xb
+	.long	0x7243
+	.uleb128 0x7
+	.long	0x793b
+	.uleb128 0x7
+	.long	0x7936
+	.uleb128 0x7
+	.long	0x7940
+	.uleb128 0xb
+	.long	0x7330
+	.uleb128 0x7
+	.long	0xe626
+	.uleb128 0x7
+	.long	0xda94
+	.uleb128 0xb
+	.long	0xda94
+	.uleb128 0x7
+	.long	0xddac
+	.uleb128 0x7
+	.long	0xdebe
+	.uleb128 0xb
+	.long	0xdf6d
+	.uleb128 0x7
+	.long	0xdf6d
+	.uleb128 0x7
+	.long	0x7945
+	.uleb128 0xb
+	.long	0x7a10
+	.uleb128 0x7
+	.long	0xacf1
+	.uleb128 0x7
+	.long	0x7a10
+	.uleb128 0x7
+	.long	0x7a15
+	.uleb128 0xb
+	.long	0x7aed
+	.uleb128 0xb
+	.long	0x7a15
+	.uleb128 0xb
+	.long	0x7b2d
+	.uleb128 0xb
+	.long	0x7b3a
+	.uleb128 0xb
+	.long	0xb464
+	.uleb128 0xb
+	.long	0xb470
+	.uleb128 0x7
+	.long	0x7bfd
+	.uleb128 0x22
+	.long	0x7bfd
+	.uleb128 0xb
+	.long	0x7ca5
+	.uleb128 0xb
+	.long	0x7bfd
+	.uleb128 0x7
+	.long	0x7cb6
+	.uleb128 0xb
+	.long	0x7d71
+	.uleb128 0x22
+	.long	0x7cb6
+	.uleb128 0x22
+	.long	0x7d65
+	.uleb128 0xb
+	.long	0x7d65
+	.uleb128 0x7
+	.long	0x7bf0
+	.uleb128 0x7
+	.long	0x7f9a
+	.uleb128 0xb
+	.long	0x7dc1
+	.uleb128 0x22
+	.long	0x7bf0
+	.uleb128 0xb
+	.long	0x8091
+	.uleb128 0x7
+	.long	0x7fc2
+	.uleb128 0xb
+	.long	0x8145
+	.uleb128 0xb
+	.long	0x81b6
+	.uleb128 0xb
+	.long	0x8bcf
+	.uleb128 0x22
+	.long	0x7fc2
+	.uleb128 0xb
+	.long	0x8be0
+	.uleb128 0xb
+	.long	0x7fc2
+	.uleb128 0x7
+	.long	0x8bcf
+	.uleb128 0x22
+	.long	0x81a8
+	.uleb128 0xb
+	.long	0x809e
+	.uleb128 0x7
+	.long	0x8be5
+	.uleb128 0x7
+	.long	0x8cd6
+	.uleb128 0x31
+	.long	0xe011
+	.uleb128 0x7
+	.long	0xe630
+	.uleb128 0x7
+	.long	0x9334
+	.uleb128 0x7
+	.long	0x933e
+	.uleb128 0x7
+	.long	0x8ce5
+	.uleb128 0xb
+	.long	0x9334
+	.uleb128 0xb
+	.long	0x8ce5
+	.uleb128 0x7
+	.long	0x9339
+	.uleb128 0xb
+	.long	0x8cf3
+	.uleb128 0x7
+	.long	0x9343
+	.uleb128 0xb
+	.long	0x9a36
+	.uleb128 0xb
+	.long	0x9343
+	.uleb128 0x7
+	.long	0x9a3b
+	.uleb128 0x7
+	.long	0x9a36
+	.uleb128 0x7
+	.long	0x9a40
+	.uleb128 0xb
+	.long	0x9430
+	.uleb128 0x7
+	.long	0xe1a7
+	.uleb128 0x7
+	.long	0xe022
+	.uleb128 0xb
+	.long	0xe181
+	.uleb128 0x7
+	.long	0xe1b8
+	.uleb128 0xb
+	.long	0xe3f9
+	.uleb128 0x7
+	.long	0xe3f9
+	.uleb128 0xb
+	.long	0xdca0
+	.uleb128 0x7
+	.long	0xd58c
+	.uleb128 0x7
+	.long	0xe440
+	.uleb128 0xb
+	.long	0xd571
+	.uleb128 0x7
+	.long	0xe4e7
+	.uleb128 0x7
+	.long	0xe4c1
+	.uleb128 0x7
+	.long	0xe50d
+	.uleb128 0x7
+	.long	0xe533
+	.uleb128 0x7
+	.long	0xe55e
+	.uleb128 0x7
+	.long	0xe597
+	.uleb128 0xb
+	.long	0xd5b7
+	.uleb128 0x7
+	.long	0xe65a
+	.uleb128 0x31
+	.long	0xbc4a
+	.uleb128 0x39
+	.long	.LASF2208
+	.byte	0x1
+	.byte	0x19
+	.byte	0xb
+	.long	0xf303
+	.uleb128 0x88
+	.byte	0x1
+	.byte	0x1b
+	.byte	0x11
+	.long	0x2b
+	.uleb128 0x4d
+	.long	.LASF2209
+	.byte	0x1
+	.byte	0x1d
+	.byte	0x12
+	.long	0xb50f
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2210
+	.byte	0x1
+	.byte	0x21
+	.byte	0x12
+	.long	0xb50f
+	.byte	0x28
+	.uleb128 0x1d
+	.long	.LASF2211
+	.byte	0x30
+	.byte	0x1
+	.byte	0x33
+	.byte	0x8
+	.long	0xf207
+	.uleb128 0xeb
+	.long	.LASF2212
+	.byte	0x28
+	.byte	0x1
+	.byte	0xd2
+	.byte	0xa
+	.byte	0x3
+	.long	0xee5c
+	.uleb128 0xc
+	.long	.LASF2213
+	.byte	0x1
+	.byte	0xd4
+	.byte	0xb
+	.long	0xf36e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2214
+	.byte	0x1
+	.byte	0xd5
+	.byte	0xb
+	.long	0xf387
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF2215
+	.byte	0x1
+	.byte	0xd6
+	.byte	0xb
+	.long	0xf3a5
+	.byte	0x10
+	.uleb128 0xc
+	.long	.LASF2216
+	.byte	0x1
+	.byte	0xd7
+	.byte	0xb
+	.long	0xf3c3
+	.byte	0x18
+	.uleb128 0xc
+	.long	.LASF2217
+	.byte	0x1
+	.byte	0xd8
+	.byte	0xb
+	.long	0xf3e1
+	.byte	0x20
+	.byte	0
+	.uleb128 0xa
+	.long	0xee0b
+	.uleb128 0x23
+	.long	.LASF2218
+	.byte	0x1
+	.byte	0x9a
+	.byte	0x9
+	.long	0x5b7f
+	.byte	0x3
+	.uleb128 0xa
+	.long	0xee61
+	.uleb128 0xec
+	.string	"buf"
+	.byte	0x28
+	.byte	0x1
+	.byte	0xe8
+	.byte	0x9
+	.byte	0x3
+	.long	0xeeb2
+	.uleb128 0x4f
+	.long	.LASF2219
+	.byte	0x1
+	.byte	0xe9
+	.byte	0xb
+	.long	0xb6e6
+	.uleb128 0x4f
+	.long	.LASF2220
+	.byte	0x1
+	.byte	0xea
+	.byte	0xb
+	.long	0xb799
+	.uleb128 0xed
+	.string	"buf"
+	.byte	0x1
+	.byte	0xeb
+	.byte	0xf
+	.long	.LASF2353
+	.long	0xeeab
+	.uleb128 0x2
+	.long	0xf3e6
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF3
+	.byte	0x1
+	.byte	0x78
+	.byte	0x10
+	.long	.LASF2221
+	.long	0xf30d
+	.long	0xeeca
+	.long	0xeed0
+	.uleb128 0x2
+	.long	0xf3f0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2214
+	.byte	0x1
+	.byte	0x7d
+	.byte	0x7
+	.long	.LASF2222
+	.long	0xf355
+	.long	0xeee8
+	.long	0xeef3
+	.uleb128 0x2
+	.long	0xf3f0
+	.uleb128 0x1
+	.long	0xb6e6
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2215
+	.byte	0x1
+	.byte	0x86
+	.byte	0x7
+	.long	.LASF2223
+	.long	0xf355
+	.long	0xef0b
+	.long	0xef1b
+	.uleb128 0x2
+	.long	0xf3f0
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xb503
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2216
+	.byte	0x1
+	.byte	0x91
+	.byte	0x6
+	.long	.LASF2224
+	.long	0xf30d
+	.long	0xef33
+	.long	0xef3e
+	.uleb128 0x2
+	.long	0xf3f0
+	.uleb128 0x1
+	.long	0xf3fa
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2214
+	.byte	0x1
+	.byte	0x95
+	.byte	0x7
+	.long	.LASF2225
+	.long	0xf355
+	.long	0xef56
+	.long	0xef66
+	.uleb128 0x2
+	.long	0xf3f0
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xf3fa
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF2226
+	.byte	0x1
+	.byte	0xee
+	.byte	0x14
+	.long	0xf3ff
+	.byte	0
+	.byte	0x3
+	.uleb128 0x49
+	.long	.LASF2227
+	.byte	0x1
+	.byte	0xef
+	.byte	0x14
+	.long	0xee73
+	.byte	0x8
+	.byte	0x3
+	.uleb128 0x6e
+	.long	.LASF2231
+	.value	0x116
+	.byte	0x5
+	.long	0xf355
+	.long	0xefab
+	.uleb128 0xf
+	.long	.LASF2228
+	.long	0x10076
+	.uleb128 0x1
+	.long	0xf355
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0x10076
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF2229
+	.byte	0x1
+	.value	0x116
+	.byte	0x5
+	.long	.LASF2230
+	.long	0xf355
+	.byte	0x3
+	.long	0xefda
+	.uleb128 0xf
+	.long	.LASF2228
+	.long	0x110fd
+	.uleb128 0x1
+	.long	0xf355
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0x110fd
+	.byte	0
+	.uleb128 0x6e
+	.long	.LASF2232
+	.value	0x180
+	.byte	0x5
+	.long	0xf355
+	.long	0xf001
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xad3c
+	.uleb128 0x1
+	.long	0xf3be
+	.byte	0
+	.uleb128 0x6e
+	.long	.LASF2233
+	.value	0x160
+	.byte	0x4
+	.long	0xf30d
+	.long	0xf023
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x1
+	.long	0xad3c
+	.uleb128 0x1
+	.long	0xf3be
+	.byte	0
+	.uleb128 0x6e
+	.long	.LASF2234
+	.value	0x139
+	.byte	0x5
+	.long	0xf355
+	.long	0xf04a
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0x6e
+	.long	.LASF2235
+	.value	0x10e
+	.byte	0x5
+	.long	0xf355
+	.long	0xf06c
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0xee
+	.long	.LASF2236
+	.byte	0x1
+	.byte	0xfd
+	.byte	0x4
+	.long	0xf30d
+	.byte	0x3
+	.long	0xf08b
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF2237
+	.byte	0x1
+	.value	0x170
+	.byte	0x5
+	.long	.LASF2238
+	.long	0xf355
+	.byte	0x3
+	.long	0xf0c5
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0xf0b5
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xad3c
+	.uleb128 0x1
+	.long	0xf3be
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF2240
+	.byte	0x1
+	.value	0x152
+	.byte	0x4
+	.long	.LASF2241
+	.long	0xf30d
+	.byte	0x3
+	.long	0xf0fa
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0xf0ef
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xad3c
+	.uleb128 0x1
+	.long	0xf3be
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF2242
+	.byte	0x1
+	.value	0x126
+	.byte	0x5
+	.long	.LASF2243
+	.long	0xf355
+	.byte	0x3
+	.long	0xf134
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0xf124
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF2244
+	.byte	0x1
+	.value	0x104
+	.byte	0x5
+	.long	.LASF2245
+	.long	0xf355
+	.byte	0x3
+	.long	0xf169
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0xf15e
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0xef
+	.long	.LASF2246
+	.byte	0x1
+	.byte	0xf4
+	.byte	0x4
+	.long	.LASF2247
+	.long	0xf30d
+	.byte	0x3
+	.long	0xf199
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0xf193
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0xf0
+	.long	.LASF2249
+	.byte	0x1
+	.byte	0x4b
+	.byte	0x3
+	.long	0xf1b1
+	.long	0xf1bc
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x2
+	.long	0x119b2
+	.uleb128 0x1
+	.long	0xa95f
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2250
+	.byte	0x1
+	.byte	0x3f
+	.byte	0x3
+	.long	.LASF2251
+	.long	0xf1e4
+	.long	0xf1f4
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0xf1e4
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x2
+	.long	0x119b2
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0xe
+	.string	"Tp"
+	.long	0xf30d
+	.uleb128 0x75
+	.long	.LASF2253
+	.long	0xacc0
+	.byte	0x28
+	.byte	0
+	.uleb128 0xa
+	.long	0xedfe
+	.uleb128 0x3a
+	.long	.LASF2254
+	.byte	0x10
+	.byte	0x1
+	.value	0x1e9
+	.byte	0x8
+	.long	0xf2c4
+	.uleb128 0x69
+	.long	.LASF2255
+	.byte	0x1
+	.value	0x1ed
+	.byte	0x16
+	.long	.LASF2256
+	.long	0xf22f
+	.long	0xf23f
+	.uleb128 0x2
+	.long	0xf49a
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3
+	.byte	0x1
+	.value	0x1f0
+	.byte	0x10
+	.long	.LASF2257
+	.long	0xf30d
+	.long	0xf258
+	.long	0xf25e
+	.uleb128 0x2
+	.long	0xf4a4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2258
+	.byte	0x1
+	.value	0x1f6
+	.byte	0xd
+	.long	.LASF2259
+	.long	0xf30d
+	.long	0xf277
+	.long	0xf27d
+	.uleb128 0x2
+	.long	0xf4a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2260
+	.byte	0x1
+	.value	0x1fc
+	.byte	0x1e
+	.long	.LASF2261
+	.long	0x9f2e
+	.byte	0x3
+	.long	0xf297
+	.long	0xf29d
+	.uleb128 0x2
+	.long	0xf4a4
+	.byte	0
+	.uleb128 0x57
+	.long	.LASF2262
+	.byte	0x1
+	.value	0x202
+	.byte	0x14
+	.long	0x9f2e
+	.byte	0x3
+	.uleb128 0xe
+	.string	"Tp"
+	.long	0xf30d
+	.uleb128 0x6a
+	.long	.LASF2239
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xf20c
+	.uleb128 0x9c
+	.long	.LASF2263
+	.byte	0x1
+	.value	0x207
+	.byte	0x26
+	.long	.LASF2264
+	.long	0xf20c
+	.uleb128 0xe
+	.string	"Tp"
+	.long	0xf30d
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0xf2f7
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.long	0xede4
+	.uleb128 0x31
+	.long	0xedf1
+	.uleb128 0x1d
+	.long	.LASF2265
+	.byte	0x10
+	.byte	0x4
+	.byte	0x10
+	.byte	0x8
+	.long	0xf355
+	.uleb128 0x59
+	.string	"m_x"
+	.byte	0x4
+	.byte	0x12
+	.byte	0x8
+	.long	0xacfe
+	.byte	0
+	.uleb128 0x59
+	.string	"m_y"
+	.byte	0x4
+	.byte	0x12
+	.byte	0xd
+	.long	0xacfe
+	.byte	0x8
+	.uleb128 0x61
+	.long	.LASF2265
+	.byte	0x4
+	.byte	0x13
+	.byte	0x3
+	.long	.LASF2266
+	.long	0xf344
+	.uleb128 0x2
+	.long	0xf355
+	.uleb128 0x1
+	.long	0xacfe
+	.uleb128 0x1
+	.long	0xacfe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0xf30d
+	.uleb128 0xa
+	.long	0xf355
+	.uleb128 0x5c
+	.long	0xf30d
+	.long	0xf36e
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0x7
+	.long	0xf35f
+	.uleb128 0x5c
+	.long	0xf355
+	.long	0xf387
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0x7
+	.long	0xf373
+	.uleb128 0x5c
+	.long	0xf355
+	.long	0xf3a5
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xb503
+	.uleb128 0x1
+	.long	0xad3c
+	.byte	0
+	.uleb128 0x7
+	.long	0xf38c
+	.uleb128 0x5c
+	.long	0xf30d
+	.long	0xf3be
+	.uleb128 0x1
+	.long	0xad3c
+	.uleb128 0x1
+	.long	0xf3be
+	.byte	0
+	.uleb128 0xb
+	.long	0xee6e
+	.uleb128 0x7
+	.long	0xf3aa
+	.uleb128 0x5c
+	.long	0xf355
+	.long	0xf3e1
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xad3c
+	.uleb128 0x1
+	.long	0xf3be
+	.byte	0
+	.uleb128 0x7
+	.long	0xf3c8
+	.uleb128 0x7
+	.long	0xee73
+	.uleb128 0xa
+	.long	0xf3e6
+	.uleb128 0x7
+	.long	0xf207
+	.uleb128 0xa
+	.long	0xf3f0
+	.uleb128 0xb
+	.long	0x5cff
+	.uleb128 0x7
+	.long	0xee5c
+	.uleb128 0xb
+	.long	0xacfe
+	.uleb128 0x7
+	.long	0x127f3
+	.uleb128 0x7
+	.long	0x12829
+	.uleb128 0x7
+	.long	0x9a87
+	.uleb128 0xa
+	.long	0xf413
+	.uleb128 0xb
+	.long	0x9b84
+	.uleb128 0x22
+	.long	0x9a87
+	.uleb128 0xb
+	.long	0x9a87
+	.uleb128 0xb
+	.long	0x9b89
+	.uleb128 0xb
+	.long	0x9caa
+	.uleb128 0x7
+	.long	0x9b89
+	.uleb128 0xa
+	.long	0xf436
+	.uleb128 0x22
+	.long	0x9b89
+	.uleb128 0x7
+	.long	0x9caf
+	.uleb128 0xa
+	.long	0xf445
+	.uleb128 0xb
+	.long	0x9dac
+	.uleb128 0x22
+	.long	0x9caf
+	.uleb128 0xb
+	.long	0x9caf
+	.uleb128 0xb
+	.long	0x9db1
+	.uleb128 0xb
+	.long	0x9f29
+	.uleb128 0xb
+	.long	0x9e01
+	.uleb128 0xb
+	.long	0x9e0e
+	.uleb128 0x7
+	.long	0x9db1
+	.uleb128 0xa
+	.long	0xf472
+	.uleb128 0x22
+	.long	0x9db1
+	.uleb128 0x7
+	.long	0x9f2e
+	.uleb128 0xa
+	.long	0xf481
+	.uleb128 0xb
+	.long	0xa032
+	.uleb128 0x22
+	.long	0x9f2e
+	.uleb128 0xb
+	.long	0x9f2e
+	.uleb128 0x7
+	.long	0xf20c
+	.uleb128 0xa
+	.long	0xf49a
+	.uleb128 0x7
+	.long	0xf2c4
+	.uleb128 0xa
+	.long	0xf4a4
+	.uleb128 0xb
+	.long	0xb5cd
+	.uleb128 0xb
+	.long	0xb6ff
+	.uleb128 0x7
+	.long	0xb137
+	.uleb128 0xb
+	.long	0xb5c8
+	.uleb128 0x7
+	.long	0xb36f
+	.uleb128 0xb
+	.long	0xb137
+	.uleb128 0x7
+	.long	0x1188a
+	.uleb128 0x7
+	.long	0xaefa
+	.uleb128 0x7
+	.long	0xb132
+	.uleb128 0xb
+	.long	0xaefa
+	.uleb128 0x7
+	.long	0x11763
+	.uleb128 0x7
+	.long	0x11602
+	.uleb128 0x7
+	.long	0x1106b
+	.uleb128 0x7
+	.long	0x110be
+	.uleb128 0x7
+	.long	0x10981
+	.uleb128 0x7
+	.long	0x5b7f
+	.uleb128 0xb
+	.long	0x5b7f
+	.uleb128 0x7
+	.long	0x3712
+	.uleb128 0x7
+	.long	0x5cff
+	.uleb128 0x7
+	.long	0x10202
+	.uleb128 0xb
+	.long	0x9a53
+	.uleb128 0x7
+	.long	0xfbc8
+	.uleb128 0xb
+	.long	0xf355
+	.uleb128 0x7
+	.long	0xd70d
+	.uleb128 0x7
+	.long	0xe852
+	.uleb128 0x7
+	.long	0xdac9
+	.uleb128 0x22
+	.long	0xdac9
+	.uleb128 0xb
+	.long	0xdc73
+	.uleb128 0x7
+	.long	0xdc73
+	.uleb128 0xb
+	.long	0x5b7a
+	.uleb128 0xb
+	.long	0xdd80
+	.uleb128 0x5c
+	.long	0xacf1
+	.long	0xf554
+	.uleb128 0x5d
+	.byte	0
+	.uleb128 0x7
+	.long	0xf559
+	.uleb128 0xf1
+	.byte	0x8
+	.long	.LASF2354
+	.long	0xf549
+	.uleb128 0xb
+	.long	0xd6d8
+	.uleb128 0x5a
+	.long	0xc966
+	.long	0xf579
+	.uleb128 0x5b
+	.long	0xacc0
+	.byte	0x5
+	.byte	0
+	.uleb128 0x31
+	.long	0xa115
+	.uleb128 0xf2
+	.long	.LASF2267
+	.byte	0x1
+	.byte	0xdd
+	.byte	0x1e
+	.long	.LASF2268
+	.long	0xee5c
+	.byte	0x3
+	.byte	0x1
+	.uleb128 0xf3
+	.long	.LASF2269
+	.byte	0x1
+	.byte	0xe3
+	.byte	0x1e
+	.long	0xee5c
+	.byte	0x3
+	.byte	0x1
+	.uleb128 0xf4
+	.long	.LASF2270
+	.byte	0x1
+	.byte	0x9d
+	.byte	0x19
+	.long	0xacb1
+	.byte	0x3
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x31
+	.long	0xa121
+	.uleb128 0x18
+	.long	0x9b2f
+	.byte	0x3
+	.long	0xf5cc
+	.uleb128 0x2b
+	.string	"__b"
+	.byte	0x2
+	.byte	0xe9
+	.byte	0x1b
+	.long	0xf427
+	.byte	0
+	.uleb128 0x18
+	.long	0x9d57
+	.byte	0x3
+	.long	0xf5e3
+	.uleb128 0x2b
+	.string	"__b"
+	.byte	0x2
+	.byte	0xe9
+	.byte	0x1b
+	.long	0xf459
+	.byte	0
+	.uleb128 0x18
+	.long	0x9b9e
+	.byte	0x3
+	.long	0xf5fb
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x1a8
+	.byte	0x1c
+	.long	0xf42c
+	.byte	0
+	.uleb128 0x18
+	.long	0x9dcb
+	.byte	0x3
+	.long	0xf613
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x10c
+	.byte	0x1c
+	.long	0xf45e
+	.byte	0
+	.uleb128 0x18
+	.long	0x9b49
+	.byte	0x3
+	.long	0xf62a
+	.uleb128 0x2b
+	.string	"__b"
+	.byte	0x2
+	.byte	0xec
+	.byte	0x21
+	.long	0xf41d
+	.byte	0
+	.uleb128 0x18
+	.long	0x9d71
+	.byte	0x3
+	.long	0xf641
+	.uleb128 0x2b
+	.string	"__b"
+	.byte	0x2
+	.byte	0xec
+	.byte	0x21
+	.long	0xf44f
+	.byte	0
+	.uleb128 0x18
+	.long	0xa12d
+	.byte	0x3
+	.long	0xf692
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf355
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0xfbc8
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xf671
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x2b
+	.string	"__f"
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x29
+	.long	0xa171
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x35
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa181
+	.byte	0x3
+	.long	0xf6c2
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xf404
+	.uleb128 0x76
+	.long	.LASF1345
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x554
+	.byte	0x35
+	.long	0xf42c
+	.byte	0
+	.uleb128 0x18
+	.long	0xa1b4
+	.byte	0x3
+	.long	0xf6fc
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xf404
+	.uleb128 0x12
+	.long	.LASF1345
+	.long	0xf6ee
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x554
+	.byte	0x35
+	.long	0xf45e
+	.byte	0
+	.uleb128 0x18
+	.long	0xa1f1
+	.byte	0x3
+	.long	0xf743
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0x9f2e
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x74e
+	.long	0xf730
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x750
+	.byte	0x25
+	.long	0xf490
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x18
+	.long	0x9bb9
+	.byte	0x3
+	.long	0xf75b
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x1ab
+	.byte	0x22
+	.long	0xf431
+	.byte	0
+	.uleb128 0x18
+	.long	0x9de6
+	.byte	0x3
+	.long	0xf773
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x10f
+	.byte	0x22
+	.long	0xf463
+	.byte	0
+	.uleb128 0x18
+	.long	0xa247
+	.byte	0x3
+	.long	0xf7c4
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf355
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10202
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xf7a3
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x2b
+	.string	"__f"
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x29
+	.long	0xa28b
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x35
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa29b
+	.byte	0x3
+	.long	0xf807
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0xfbc8
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xf7eb
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2271
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1a
+	.long	0xa171
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x27
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa2dc
+	.byte	0x3
+	.long	0xf83d
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0x12
+	.long	.LASF851
+	.long	0xf82f
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x570
+	.byte	0x1f
+	.long	0xf490
+	.byte	0
+	.uleb128 0x18
+	.long	0xa315
+	.byte	0x3
+	.long	0xf873
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF851
+	.long	0xf865
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x570
+	.byte	0x1f
+	.long	0xf490
+	.byte	0
+	.uleb128 0x18
+	.long	0xa34e
+	.byte	0x3
+	.long	0xf8b6
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xf89a
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2272
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x17
+	.long	0xf355
+	.uleb128 0x2c
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x2a
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa38f
+	.byte	0x3
+	.long	0xf907
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf30d
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10981
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xf8e6
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x2b
+	.string	"__f"
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x29
+	.long	0xa3d3
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x35
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa3e3
+	.byte	0x3
+	.long	0xf931
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0x9f2e
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x755
+	.byte	0x1e
+	.long	0xf490
+	.byte	0
+	.uleb128 0x18
+	.long	0xa410
+	.byte	0x3
+	.long	0xf982
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf355
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1106b
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xf961
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x2b
+	.string	"__f"
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x29
+	.long	0xa454
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x35
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa464
+	.byte	0x3
+	.long	0xf9d3
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf355
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11602
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xf9b2
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x2b
+	.string	"__f"
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x29
+	.long	0xa4a8
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x35
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa4b8
+	.byte	0x3
+	.long	0xfa24
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf30d
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11763
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xfa03
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x2b
+	.string	"__f"
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x29
+	.long	0xa4fc
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x35
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa50c
+	.byte	0x3
+	.long	0xfa75
+	.uleb128 0xf
+	.long	.LASF1339
+	.long	0xf30d
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1188a
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xfa54
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x1
+	.long	0x133
+	.uleb128 0x2b
+	.string	"__f"
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x29
+	.long	0xa550
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x35
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa560
+	.byte	0x3
+	.long	0xfaa5
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xf404
+	.uleb128 0x76
+	.long	.LASF1345
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x559
+	.byte	0x3b
+	.long	0xf431
+	.byte	0
+	.uleb128 0x18
+	.long	0xa593
+	.byte	0x3
+	.long	0xfadf
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF818
+	.long	0xf404
+	.uleb128 0x12
+	.long	.LASF1345
+	.long	0xfad1
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x559
+	.byte	0x3b
+	.long	0xf463
+	.byte	0
+	.uleb128 0x7
+	.long	0x10076
+	.uleb128 0x7
+	.long	0x100ad
+	.uleb128 0x18
+	.long	0xef82
+	.byte	0x1
+	.long	0xfb2a
+	.uleb128 0xf
+	.long	.LASF2228
+	.long	0x10076
+	.uleb128 0x32
+	.long	.LASF2273
+	.byte	0x1
+	.value	0x116
+	.byte	0x2c
+	.long	0xf355
+	.uleb128 0x19
+	.string	"n"
+	.byte	0x1
+	.value	0x116
+	.byte	0x3a
+	.long	0xb503
+	.uleb128 0x32
+	.long	.LASF2274
+	.byte	0x1
+	.value	0x116
+	.byte	0x42
+	.long	0x10076
+	.uleb128 0xac
+	.string	"i"
+	.long	0xb503
+	.byte	0
+	.uleb128 0x18
+	.long	0xa5d0
+	.byte	0x3
+	.long	0xfb6d
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x10202
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xfb51
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2271
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1a
+	.long	0xa28b
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x27
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa611
+	.byte	0x3
+	.long	0xfc62
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0xf
+	.long	.LASF469
+	.long	0x5b7f
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xfb9d
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x2b
+	.string	"__p"
+	.byte	0x5
+	.byte	0xc3
+	.byte	0x32
+	.long	0xf355
+	.uleb128 0x2b
+	.string	"__a"
+	.byte	0x5
+	.byte	0xc3
+	.byte	0x45
+	.long	0xf3fa
+	.uleb128 0xad
+	.byte	0xc4
+	.byte	0x11
+	.long	0xfbc8
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0xae
+	.byte	0x8
+	.byte	0x5
+	.byte	0xc6
+	.byte	0x19
+	.uleb128 0x53
+	.long	.LASF2275
+	.long	.LASF2278
+	.long	0xfbdf
+	.long	0xfbea
+	.uleb128 0x2
+	.long	0xf517
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2276
+	.byte	0x5
+	.byte	0xc7
+	.byte	0x1b
+	.long	0xf51c
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF2277
+	.long	.LASF2279
+	.long	0xf355
+	.long	0xfc35
+	.uleb128 0x12
+	.long	.LASF2280
+	.long	0xfc1c
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0xa
+	.long	0xfbc8
+	.uleb128 0x12
+	.long	.LASF2280
+	.long	0xfc35
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2284
+	.long	0xfc3e
+	.uleb128 0xa
+	.long	0xfced
+	.uleb128 0xad
+	.byte	0xc6
+	.byte	0x23
+	.long	0xfc56
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x7d
+	.string	"__p"
+	.long	0xf51c
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa660
+	.byte	0x3
+	.long	0xfc99
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0xfbc8
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0x9f2e
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x742
+	.byte	0x11
+	.long	0xa171
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x742
+	.byte	0x1f
+	.long	0xf490
+	.byte	0
+	.uleb128 0x18
+	.long	0xa692
+	.byte	0x3
+	.long	0xfced
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0xfbc8
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0x9f2e
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0xfccd
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x18
+	.long	0xa171
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x26
+	.long	0xf490
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x7
+	.long	0xfc1c
+	.uleb128 0x18
+	.long	0xa6e1
+	.byte	0x3
+	.long	0xfd35
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x10981
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xfd19
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2271
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1a
+	.long	0xa3d3
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x27
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa722
+	.byte	0x3
+	.long	0xfd81
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0xf
+	.long	.LASF469
+	.long	0x5b7f
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xfd65
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x2b
+	.string	"__a"
+	.byte	0x5
+	.byte	0xba
+	.byte	0x2c
+	.long	0xf3fa
+	.uleb128 0x2c
+	.byte	0x5
+	.byte	0xba
+	.byte	0x38
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa76c
+	.byte	0x3
+	.long	0xfdcd
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0xf30d
+	.uleb128 0xf
+	.long	.LASF469
+	.long	0x5b7f
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xfdb1
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x2b
+	.string	"__a"
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x34
+	.long	0xf3fa
+	.uleb128 0x2c
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x11
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa7b6
+	.byte	0x3
+	.long	0xfe10
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x1106b
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xfdf4
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2271
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1a
+	.long	0xa454
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x27
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x110fd
+	.uleb128 0x7
+	.long	0x11131
+	.uleb128 0x18
+	.long	0xefab
+	.byte	0x1
+	.long	0xfe5b
+	.uleb128 0xf
+	.long	.LASF2228
+	.long	0x110fd
+	.uleb128 0x32
+	.long	.LASF2273
+	.byte	0x1
+	.value	0x116
+	.byte	0x2c
+	.long	0xf355
+	.uleb128 0x19
+	.string	"n"
+	.byte	0x1
+	.value	0x116
+	.byte	0x3a
+	.long	0xb503
+	.uleb128 0x32
+	.long	.LASF2274
+	.byte	0x1
+	.value	0x116
+	.byte	0x42
+	.long	0x110fd
+	.uleb128 0xac
+	.string	"i"
+	.long	0xb503
+	.byte	0
+	.uleb128 0x18
+	.long	0xa7f7
+	.byte	0x3
+	.long	0xfe9e
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x11602
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xfe82
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2271
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1a
+	.long	0xa4a8
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x27
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa838
+	.byte	0x3
+	.long	0xfee1
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x11763
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xfec5
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2271
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1a
+	.long	0xa4fc
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x27
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa879
+	.byte	0x3
+	.long	0xff24
+	.uleb128 0xf
+	.long	.LASF1354
+	.long	0x1188a
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xff08
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2271
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1a
+	.long	0xa550
+	.uleb128 0x2c
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x27
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa8ba
+	.byte	0x3
+	.long	0xff5a
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0x1
+	.uleb128 0x12
+	.long	.LASF851
+	.long	0xff4c
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x56a
+	.byte	0x24
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x18
+	.long	0xa8f3
+	.byte	0x3
+	.long	0xff90
+	.uleb128 0x33
+	.string	"__i"
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF851
+	.long	0xff82
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x56a
+	.byte	0x24
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x18
+	.long	0xa92c
+	.byte	0x3
+	.long	0xffc9
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x127f3
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0xffb2
+	.uleb128 0x9
+	.long	0x127f3
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2272
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x17
+	.long	0xf409
+	.uleb128 0x2c
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x2a
+	.uleb128 0x1
+	.long	0xa95f
+	.byte	0
+	.byte	0
+	.uleb128 0x8c
+	.long	0xefda
+	.long	0x10000
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x32
+	.long	.LASF2281
+	.byte	0x1
+	.value	0x180
+	.byte	0x47
+	.long	0xb6e6
+	.uleb128 0x19
+	.string	"f"
+	.byte	0x1
+	.value	0x181
+	.byte	0x4d
+	.long	0xad3c
+	.uleb128 0x32
+	.long	.LASF2282
+	.byte	0x1
+	.value	0x182
+	.byte	0x50
+	.long	0xf3be
+	.byte	0
+	.uleb128 0x18
+	.long	0xf001
+	.byte	0x1
+	.long	0x10036
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x19
+	.string	"f"
+	.byte	0x1
+	.value	0x160
+	.byte	0x44
+	.long	0xad3c
+	.uleb128 0x32
+	.long	.LASF2282
+	.byte	0x1
+	.value	0x161
+	.byte	0x47
+	.long	0xf3be
+	.uleb128 0xaf
+	.long	.LASF2274
+	.value	0x163
+	.long	0xf512
+	.byte	0
+	.uleb128 0x8c
+	.long	0xf023
+	.long	0x100d7
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x32
+	.long	.LASF2281
+	.byte	0x1
+	.value	0x139
+	.byte	0x39
+	.long	0xb6e6
+	.uleb128 0x19
+	.string	"n"
+	.byte	0x1
+	.value	0x139
+	.byte	0x49
+	.long	0xb503
+	.uleb128 0x19
+	.string	"f"
+	.byte	0x1
+	.value	0x13a
+	.byte	0x3f
+	.long	0xad3c
+	.uleb128 0xaf
+	.long	.LASF2274
+	.value	0x13c
+	.long	0xf512
+	.uleb128 0x7e
+	.byte	0x8
+	.value	0x13e
+	.byte	0x14
+	.uleb128 0xb0
+	.long	.LASF2275
+	.long	0x10089
+	.long	0x10094
+	.uleb128 0x2
+	.long	0xfadf
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF2283
+	.byte	0x1
+	.value	0x13e
+	.byte	0x16
+	.long	0xf512
+	.byte	0
+	.uleb128 0xf5
+	.long	.LASF3
+	.long	0x100b2
+	.byte	0x3
+	.uleb128 0xa
+	.long	0x10076
+	.uleb128 0x27
+	.long	.LASF2284
+	.long	0x100bb
+	.uleb128 0xa
+	.long	0xfae4
+	.uleb128 0x19
+	.string	"p"
+	.byte	0x1
+	.value	0x13e
+	.byte	0x20
+	.long	0xf355
+	.uleb128 0x54
+	.long	.LASF2274
+	.long	0xf512
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xf04a
+	.byte	0x1
+	.long	0x10101
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x32
+	.long	.LASF2281
+	.byte	0x1
+	.value	0x10e
+	.byte	0x37
+	.long	0xb6e6
+	.uleb128 0x19
+	.string	"f"
+	.byte	0x1
+	.value	0x10e
+	.byte	0x4c
+	.long	0xad3c
+	.byte	0
+	.uleb128 0x8c
+	.long	0xf06c
+	.long	0x1011d
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x2b
+	.string	"f"
+	.byte	0x1
+	.byte	0xfd
+	.byte	0x34
+	.long	0xad3c
+	.byte	0
+	.uleb128 0x18
+	.long	0xa965
+	.byte	0x3
+	.long	0x10160
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x9f2e
+	.uleb128 0x12
+	.long	.LASF1344
+	.long	0x10144
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2272
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x17
+	.long	0xf481
+	.uleb128 0x2c
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x2a
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	0xee9a
+	.long	0x1016e
+	.byte	0x2
+	.long	0x10178
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf3eb
+	.byte	0
+	.uleb128 0x4c
+	.long	0x10160
+	.long	.LASF2315
+	.long	0x10189
+	.long	0x1018f
+	.uleb128 0x8
+	.long	0x1016e
+	.byte	0
+	.uleb128 0x8d
+	.long	0xf08b
+	.quad	.LFB14514
+	.quad	.LFE14514-.LFB14514
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x10886
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0x101bf
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x6f
+	.long	.LASF2281
+	.value	0x170
+	.byte	0x42
+	.long	0xb6e6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6f
+	.long	.LASF2286
+	.value	0x171
+	.byte	0x48
+	.long	0xad3c
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xb1
+	.long	.LASF2282
+	.value	0x172
+	.byte	0x4b
+	.long	0xf3be
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x21
+	.long	.LASF2287
+	.byte	0x1
+	.value	0x174
+	.byte	0x9
+	.long	0xa032
+	.uleb128 0x2d
+	.long	.LLRL85
+	.uleb128 0x8e
+	.byte	0x10
+	.value	0x176
+	.long	0x102b7
+	.uleb128 0x53
+	.long	.LASF2275
+	.long	.LASF2288
+	.long	0x1021c
+	.long	0x10227
+	.uleb128 0x2
+	.long	0xf50d
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF2289
+	.byte	0x1
+	.value	0x176
+	.byte	0x13
+	.long	0xb6e6
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF2290
+	.byte	0x1
+	.value	0x176
+	.byte	0x1d
+	.long	0xf3be
+	.byte	0x8
+	.uleb128 0x5e
+	.long	.LASF2277
+	.long	.LASF2291
+	.long	0xf355
+	.long	0x10281
+	.uleb128 0x12
+	.long	.LASF2292
+	.long	0x10268
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0xa
+	.long	0x10202
+	.uleb128 0x12
+	.long	.LASF2292
+	.long	0x10281
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2284
+	.long	0x1028a
+	.uleb128 0xa
+	.long	0x10911
+	.uleb128 0x8f
+	.value	0x176
+	.byte	0x2a
+	.long	0x102a3
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x54
+	.long	.LASF2282
+	.long	0xf3be
+	.uleb128 0x54
+	.long	.LASF2281
+	.long	0xb6e9
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	0x10886
+	.quad	.LBI1183
+	.byte	.LVU78
+	.long	.LLRL85
+	.byte	0x1
+	.value	0x176
+	.byte	0x11
+	.uleb128 0x6
+	.long	0x108af
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x8
+	.long	0x108a2
+	.uleb128 0x2d
+	.long	.LLRL85
+	.uleb128 0x2e
+	.long	0x108bd
+	.quad	.LBI1185
+	.byte	.LVU79
+	.long	.LLRL85
+	.byte	0x2
+	.value	0x747
+	.byte	0x1f
+	.uleb128 0x8
+	.long	0x1090b
+	.uleb128 0x6
+	.long	0x108fe
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x8
+	.long	0x108f1
+	.uleb128 0x37
+	.long	0xff24
+	.quad	.LBI1186
+	.byte	.LVU80
+	.quad	.LBB1186
+	.quad	.LBE1186-.LBB1186
+	.value	0x73c
+	.byte	0x1b
+	.long	0x103d4
+	.uleb128 0x6
+	.long	0xff4c
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x13
+	.long	0xfa75
+	.quad	.LBI1187
+	.byte	.LVU81
+	.quad	.LBB1187
+	.quad	.LBE1187-.LBB1187
+	.byte	0x2
+	.value	0x56b
+	.byte	0x24
+	.uleb128 0x6
+	.long	0xfa97
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x13
+	.long	0xf743
+	.quad	.LBI1188
+	.byte	.LVU82
+	.quad	.LBB1188
+	.quad	.LBE1188-.LBB1188
+	.byte	0x2
+	.value	0x55a
+	.byte	0x38
+	.uleb128 0x6
+	.long	0xf74d
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x13
+	.long	0xf613
+	.quad	.LBI1189
+	.byte	.LVU83
+	.quad	.LBB1189
+	.quad	.LBE1189-.LBB1189
+	.byte	0x2
+	.value	0x1ab
+	.byte	0x47
+	.uleb128 0x6
+	.long	0xf61d
+	.long	.LLST93
+	.long	.LVUS93
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	0xff5a
+	.quad	.LBI1190
+	.byte	.LVU85
+	.quad	.LBB1190
+	.quad	.LBE1190-.LBB1190
+	.value	0x73c
+	.byte	0x1b
+	.long	0x10497
+	.uleb128 0x6
+	.long	0xff82
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x13
+	.long	0xfaa5
+	.quad	.LBI1191
+	.byte	.LVU86
+	.quad	.LBB1191
+	.quad	.LBE1191-.LBB1191
+	.byte	0x2
+	.value	0x56b
+	.byte	0x24
+	.uleb128 0x6
+	.long	0xfad1
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x13
+	.long	0xf75b
+	.quad	.LBI1192
+	.byte	.LVU87
+	.quad	.LBB1192
+	.quad	.LBE1192-.LBB1192
+	.byte	0x2
+	.value	0x55a
+	.byte	0x38
+	.uleb128 0x6
+	.long	0xf765
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x13
+	.long	0xf62a
+	.quad	.LBI1193
+	.byte	.LVU88
+	.quad	.LBB1193
+	.quad	.LBE1193-.LBB1193
+	.byte	0x2
+	.value	0x10f
+	.byte	0x47
+	.uleb128 0x6
+	.long	0xf634
+	.long	.LLST97
+	.long	.LVUS97
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	0xfb2a
+	.quad	.LBI1194
+	.byte	.LVU90
+	.long	.LLRL98
+	.byte	0x2
+	.value	0x73c
+	.byte	0x1b
+	.uleb128 0x6
+	.long	0xfb66
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x6
+	.long	0xfb61
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x8
+	.long	0xfb51
+	.uleb128 0x2d
+	.long	.LLRL98
+	.uleb128 0x28
+	.long	0xf773
+	.quad	.LBI1196
+	.byte	.LVU91
+	.long	.LLRL98
+	.byte	0x3
+	.byte	0x60
+	.byte	0x28
+	.uleb128 0x6
+	.long	0xf7bd
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x6
+	.long	0xf7b8
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x8
+	.long	0xf7a8
+	.uleb128 0x8
+	.long	0xf7a3
+	.uleb128 0x28
+	.long	0x10243
+	.quad	.LBI1197
+	.byte	.LVU92
+	.long	.LLRL98
+	.byte	0x3
+	.byte	0x3d
+	.byte	0x24
+	.uleb128 0x6
+	.long	0x1029d
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x6
+	.long	0x10298
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x8
+	.long	0x10281
+	.uleb128 0x2d
+	.long	.LLRL98
+	.uleb128 0x44
+	.long	0x102a3
+	.uleb128 0x44
+	.long	0x102ac
+	.uleb128 0x2e
+	.long	0xfb6d
+	.quad	.LBI1199
+	.byte	.LVU93
+	.long	.LLRL98
+	.byte	0x1
+	.value	0x177
+	.byte	0x35
+	.uleb128 0x6
+	.long	0xfbc2
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x6
+	.long	0xfbbd
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x8
+	.long	0xfba9
+	.uleb128 0x6
+	.long	0xfb9d
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x2d
+	.long	.LLRL98
+	.uleb128 0x4a
+	.long	0xfd81
+	.quad	.LBI1201
+	.byte	.LVU94
+	.quad	.LBB1201
+	.quad	.LBE1201-.LBB1201
+	.byte	0x5
+	.byte	0xc6
+	.byte	0x18
+	.long	0x106fe
+	.uleb128 0x6
+	.long	0xfdc6
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x6
+	.long	0xfdc1
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x8
+	.long	0xfdb1
+	.uleb128 0x2f
+	.long	0x122c5
+	.quad	.LBI1202
+	.byte	.LVU95
+	.quad	.LBB1202
+	.quad	.LBE1202-.LBB1202
+	.byte	0x5
+	.byte	0x54
+	.byte	0x3b
+	.uleb128 0x6
+	.long	0x122f3
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x6
+	.long	0x122e6
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x8
+	.long	0x122dd
+	.uleb128 0x13
+	.long	0x12272
+	.quad	.LBI1203
+	.byte	.LVU96
+	.quad	.LBB1203
+	.quad	.LBE1203-.LBB1203
+	.byte	0x2
+	.value	0x429
+	.byte	0x19
+	.uleb128 0x6
+	.long	0x12296
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x6
+	.long	0x12289
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x8
+	.long	0x12280
+	.uleb128 0x37
+	.long	0x12231
+	.quad	.LBI1204
+	.byte	.LVU97
+	.quad	.LBB1204
+	.quad	.LBE1204-.LBB1204
+	.value	0x11c
+	.byte	0x2c
+	.long	0x106c6
+	.uleb128 0x6
+	.long	0x12248
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x8
+	.long	0x1223f
+	.uleb128 0x13
+	.long	0x121f1
+	.quad	.LBI1205
+	.byte	.LVU98
+	.quad	.LBB1205
+	.quad	.LBE1205-.LBB1205
+	.byte	0x2
+	.value	0x1b3
+	.byte	0x15
+	.uleb128 0x6
+	.long	0x12208
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x8
+	.long	0x121ff
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x121b1
+	.quad	.LBI1206
+	.byte	.LVU100
+	.quad	.LBB1206
+	.quad	.LBE1206-.LBB1206
+	.byte	0x2
+	.value	0x11c
+	.byte	0x2c
+	.uleb128 0x6
+	.long	0x121c8
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x8
+	.long	0x121bf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0xfc62
+	.quad	.LBI1207
+	.byte	.LVU102
+	.long	.LLRL120
+	.byte	0x5
+	.byte	0xc6
+	.byte	0x18
+	.uleb128 0x8
+	.long	0xfc8b
+	.uleb128 0x8
+	.long	0xfc7e
+	.uleb128 0x2d
+	.long	.LLRL120
+	.uleb128 0x2e
+	.long	0xfc99
+	.quad	.LBI1209
+	.byte	.LVU103
+	.long	.LLRL120
+	.byte	0x2
+	.value	0x747
+	.byte	0x1f
+	.uleb128 0x8
+	.long	0xfce7
+	.uleb128 0x8
+	.long	0xfcda
+	.uleb128 0x8
+	.long	0xfccd
+	.uleb128 0x2e
+	.long	0xf7c4
+	.quad	.LBI1210
+	.byte	.LVU104
+	.long	.LLRL120
+	.byte	0x2
+	.value	0x73c
+	.byte	0x1b
+	.uleb128 0x6
+	.long	0xf800
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x6
+	.long	0xf7fb
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x8
+	.long	0xf7eb
+	.uleb128 0x2d
+	.long	.LLRL120
+	.uleb128 0x28
+	.long	0xf641
+	.quad	.LBI1212
+	.byte	.LVU105
+	.long	.LLRL120
+	.byte	0x3
+	.byte	0x60
+	.byte	0x28
+	.uleb128 0x6
+	.long	0xf68b
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x6
+	.long	0xf686
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x8
+	.long	0xf676
+	.uleb128 0x8
+	.long	0xf671
+	.uleb128 0x28
+	.long	0xfbf7
+	.quad	.LBI1213
+	.byte	.LVU106
+	.long	.LLRL120
+	.byte	0x3
+	.byte	0x3d
+	.byte	0x24
+	.uleb128 0x6
+	.long	0xfc50
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x6
+	.long	0xfc4b
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x8
+	.long	0xfc35
+	.uleb128 0x2d
+	.long	.LLRL120
+	.uleb128 0x44
+	.long	0xfc56
+	.uleb128 0x28
+	.long	0xf873
+	.quad	.LBI1215
+	.byte	.LVU107
+	.long	.LLRL120
+	.byte	0x5
+	.byte	0xc7
+	.byte	0x1a
+	.uleb128 0x6
+	.long	0xf8af
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x6
+	.long	0xf8aa
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x6
+	.long	0xf89a
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x28
+	.long	0x12de1
+	.quad	.LBI1217
+	.byte	.LVU108
+	.long	.LLRL130
+	.byte	0x6
+	.byte	0x61
+	.byte	0xe
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x6
+	.long	0x12def
+	.long	.LLST133
+	.long	.LVUS133
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa9a6
+	.byte	0x3
+	.long	0x108bd
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10202
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x742
+	.byte	0x11
+	.long	0xa28b
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x742
+	.byte	0x1f
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x18
+	.long	0xa9d8
+	.byte	0x3
+	.long	0x10911
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10202
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0x108f1
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x18
+	.long	0xa28b
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x26
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x7
+	.long	0x10268
+	.uleb128 0x8d
+	.long	0xf0c5
+	.quad	.LFB14507
+	.quad	.LFE14507-.LFB14507
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x10f26
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0x10946
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x6f
+	.long	.LASF2286
+	.value	0x152
+	.byte	0x44
+	.long	0xad3c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6f
+	.long	.LASF2282
+	.value	0x153
+	.byte	0x47
+	.long	0xf3be
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x21
+	.long	.LASF2287
+	.byte	0x1
+	.value	0x155
+	.byte	0x9
+	.long	0xa032
+	.uleb128 0xb2
+	.quad	.LBB1154
+	.quad	.LBE1154-.LBB1154
+	.uleb128 0x8e
+	.byte	0x8
+	.value	0x157
+	.long	0x10a1f
+	.uleb128 0x53
+	.long	.LASF2275
+	.long	.LASF2293
+	.long	0x1099b
+	.long	0x109a6
+	.uleb128 0x2
+	.long	0xf4f4
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF2290
+	.byte	0x1
+	.value	0x157
+	.byte	0x14
+	.long	0xf3be
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF2277
+	.long	.LASF2294
+	.long	0xf30d
+	.long	0x109f2
+	.uleb128 0x12
+	.long	.LASF2295
+	.long	0x109d9
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0xa
+	.long	0x10981
+	.uleb128 0x12
+	.long	.LASF2295
+	.long	0x109f2
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2284
+	.long	0x109fb
+	.uleb128 0xa
+	.long	0x10fb1
+	.uleb128 0x8f
+	.value	0x157
+	.byte	0x21
+	.long	0x10a14
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x54
+	.long	.LASF2282
+	.long	0xf3be
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x10f26
+	.quad	.LBI1155
+	.byte	.LVU45
+	.quad	.LBB1155
+	.quad	.LBE1155-.LBB1155
+	.byte	0x1
+	.value	0x157
+	.byte	0x11
+	.uleb128 0x6
+	.long	0x10f4f
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x8
+	.long	0x10f42
+	.uleb128 0x13
+	.long	0x10f5d
+	.quad	.LBI1157
+	.byte	.LVU46
+	.quad	.LBB1157
+	.quad	.LBE1157-.LBB1157
+	.byte	0x2
+	.value	0x747
+	.byte	0x1f
+	.uleb128 0x8
+	.long	0x10fab
+	.uleb128 0x6
+	.long	0x10f9e
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x8
+	.long	0x10f91
+	.uleb128 0x37
+	.long	0xff24
+	.quad	.LBI1158
+	.byte	.LVU47
+	.quad	.LBB1158
+	.quad	.LBE1158-.LBB1158
+	.value	0x73c
+	.byte	0x1b
+	.long	0x10b4f
+	.uleb128 0x6
+	.long	0xff4c
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x13
+	.long	0xfa75
+	.quad	.LBI1159
+	.byte	.LVU48
+	.quad	.LBB1159
+	.quad	.LBE1159-.LBB1159
+	.byte	0x2
+	.value	0x56b
+	.byte	0x24
+	.uleb128 0x6
+	.long	0xfa97
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x13
+	.long	0xf743
+	.quad	.LBI1160
+	.byte	.LVU49
+	.quad	.LBB1160
+	.quad	.LBE1160-.LBB1160
+	.byte	0x2
+	.value	0x55a
+	.byte	0x38
+	.uleb128 0x6
+	.long	0xf74d
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x13
+	.long	0xf613
+	.quad	.LBI1161
+	.byte	.LVU50
+	.quad	.LBB1161
+	.quad	.LBE1161-.LBB1161
+	.byte	0x2
+	.value	0x1ab
+	.byte	0x47
+	.uleb128 0x6
+	.long	0xf61d
+	.long	.LLST57
+	.long	.LVUS57
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	0xff5a
+	.quad	.LBI1162
+	.byte	.LVU52
+	.quad	.LBB1162
+	.quad	.LBE1162-.LBB1162
+	.value	0x73c
+	.byte	0x1b
+	.long	0x10c12
+	.uleb128 0x6
+	.long	0xff82
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x13
+	.long	0xfaa5
+	.quad	.LBI1163
+	.byte	.LVU53
+	.quad	.LBB1163
+	.quad	.LBE1163-.LBB1163
+	.byte	0x2
+	.value	0x56b
+	.byte	0x24
+	.uleb128 0x6
+	.long	0xfad1
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x13
+	.long	0xf75b
+	.quad	.LBI1164
+	.byte	.LVU54
+	.quad	.LBB1164
+	.quad	.LBE1164-.LBB1164
+	.byte	0x2
+	.value	0x55a
+	.byte	0x38
+	.uleb128 0x6
+	.long	0xf765
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x13
+	.long	0xf62a
+	.quad	.LBI1165
+	.byte	.LVU55
+	.quad	.LBB1165
+	.quad	.LBE1165-.LBB1165
+	.byte	0x2
+	.value	0x10f
+	.byte	0x47
+	.uleb128 0x6
+	.long	0xf634
+	.long	.LLST61
+	.long	.LVUS61
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0xfcf2
+	.quad	.LBI1166
+	.byte	.LVU57
+	.quad	.LBB1166
+	.quad	.LBE1166-.LBB1166
+	.byte	0x2
+	.value	0x73c
+	.byte	0x1b
+	.uleb128 0x6
+	.long	0xfd2e
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x6
+	.long	0xfd29
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x8
+	.long	0xfd19
+	.uleb128 0x2f
+	.long	0xf8b6
+	.quad	.LBI1168
+	.byte	.LVU58
+	.quad	.LBB1168
+	.quad	.LBE1168-.LBB1168
+	.byte	0x3
+	.byte	0x60
+	.byte	0x28
+	.uleb128 0x6
+	.long	0xf900
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x6
+	.long	0xf8fb
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x8
+	.long	0xf8eb
+	.uleb128 0x8
+	.long	0xf8e6
+	.uleb128 0x2f
+	.long	0x109b4
+	.quad	.LBI1169
+	.byte	.LVU59
+	.quad	.LBB1169
+	.quad	.LBE1169-.LBB1169
+	.byte	0x3
+	.byte	0x3d
+	.byte	0x24
+	.uleb128 0x6
+	.long	0x10a0e
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x6
+	.long	0x10a09
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x8
+	.long	0x109f2
+	.uleb128 0x44
+	.long	0x10a14
+	.uleb128 0x13
+	.long	0xfd35
+	.quad	.LBI1171
+	.byte	.LVU60
+	.quad	.LBB1171
+	.quad	.LBE1171-.LBB1171
+	.byte	0x1
+	.value	0x158
+	.byte	0x2a
+	.uleb128 0x6
+	.long	0xfd7a
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x6
+	.long	0xfd75
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x8
+	.long	0xfd65
+	.uleb128 0x4a
+	.long	0xfd81
+	.quad	.LBI1172
+	.byte	.LVU61
+	.quad	.LBB1172
+	.quad	.LBE1172-.LBB1172
+	.byte	0x5
+	.byte	0xbc
+	.byte	0x27
+	.long	0x10e88
+	.uleb128 0x6
+	.long	0xfdc6
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x6
+	.long	0xfdc1
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x8
+	.long	0xfdb1
+	.uleb128 0x2f
+	.long	0x122c5
+	.quad	.LBI1173
+	.byte	.LVU62
+	.quad	.LBB1173
+	.quad	.LBE1173-.LBB1173
+	.byte	0x5
+	.byte	0x54
+	.byte	0x3b
+	.uleb128 0x6
+	.long	0x122f3
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x6
+	.long	0x122e6
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x8
+	.long	0x122dd
+	.uleb128 0x13
+	.long	0x12272
+	.quad	.LBI1174
+	.byte	.LVU63
+	.quad	.LBB1174
+	.quad	.LBE1174-.LBB1174
+	.byte	0x2
+	.value	0x429
+	.byte	0x19
+	.uleb128 0x6
+	.long	0x12296
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x6
+	.long	0x12289
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x8
+	.long	0x12280
+	.uleb128 0x37
+	.long	0x12231
+	.quad	.LBI1175
+	.byte	.LVU64
+	.quad	.LBB1175
+	.quad	.LBE1175-.LBB1175
+	.value	0x11c
+	.byte	0x2c
+	.long	0x10e50
+	.uleb128 0x6
+	.long	0x12248
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x8
+	.long	0x1223f
+	.uleb128 0x13
+	.long	0x121f1
+	.quad	.LBI1176
+	.byte	.LVU65
+	.quad	.LBB1176
+	.quad	.LBE1176-.LBB1176
+	.byte	0x2
+	.value	0x1b3
+	.byte	0x15
+	.uleb128 0x6
+	.long	0x12208
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x8
+	.long	0x121ff
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x121b1
+	.quad	.LBI1177
+	.byte	.LVU67
+	.quad	.LBB1177
+	.quad	.LBE1177-.LBB1177
+	.byte	0x2
+	.value	0x11c
+	.byte	0x2c
+	.uleb128 0x6
+	.long	0x121c8
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x8
+	.long	0x121bf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	0xf907
+	.quad	.LBI1178
+	.byte	.LVU69
+	.quad	.LBB1178
+	.quad	.LBE1178-.LBB1178
+	.byte	0x5
+	.byte	0xbc
+	.byte	0x27
+	.uleb128 0x8
+	.long	0xf923
+	.uleb128 0x13
+	.long	0xf6fc
+	.quad	.LBI1179
+	.byte	.LVU70
+	.quad	.LBB1179
+	.quad	.LBE1179-.LBB1179
+	.byte	0x2
+	.value	0x758
+	.byte	0x29
+	.uleb128 0x8
+	.long	0xf73d
+	.uleb128 0x8
+	.long	0xf730
+	.uleb128 0x13
+	.long	0x12de1
+	.quad	.LBI1181
+	.byte	.LVU72
+	.quad	.LBB1181
+	.quad	.LBE1181-.LBB1181
+	.byte	0x2
+	.value	0x751
+	.byte	0xe
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x8
+	.long	0x12def
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xaa27
+	.byte	0x3
+	.long	0x10f5d
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10981
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x742
+	.byte	0x11
+	.long	0xa3d3
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x742
+	.byte	0x1f
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x18
+	.long	0xaa59
+	.byte	0x3
+	.long	0x10fb1
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x10981
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0x10f91
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x18
+	.long	0xa3d3
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x26
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x7
+	.long	0x109d9
+	.uleb128 0x8d
+	.long	0xf0fa
+	.quad	.LFB14500
+	.quad	.LFE14500-.LFB14500
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11532
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0x10fe6
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x6f
+	.long	.LASF2281
+	.value	0x126
+	.byte	0x34
+	.long	0xb6e6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xf6
+	.string	"n"
+	.byte	0x1
+	.value	0x126
+	.byte	0x44
+	.long	0xb503
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0xb1
+	.long	.LASF2286
+	.value	0x127
+	.byte	0x3a
+	.long	0xad3c
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x21
+	.long	.LASF2287
+	.byte	0x1
+	.value	0x129
+	.byte	0x9
+	.long	0xa032
+	.uleb128 0xb3
+	.long	.LASF2296
+	.value	0x12a
+	.byte	0x10
+	.long	0x1103f
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0xb
+	.long	0x1101d
+	.uleb128 0xb3
+	.long	.LASF2273
+	.value	0x12b
+	.byte	0x7
+	.long	0xf355
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0xb2
+	.quad	.LBB1292
+	.quad	.LBE1292-.LBB1292
+	.uleb128 0x8e
+	.byte	0x10
+	.value	0x12e
+	.long	0x11182
+	.uleb128 0x53
+	.long	.LASF2275
+	.long	.LASF2297
+	.long	0x11085
+	.long	0x11090
+	.uleb128 0x2
+	.long	0xf4ea
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF2298
+	.byte	0x1
+	.value	0x12e
+	.byte	0x13
+	.long	0xf355
+	.byte	0
+	.uleb128 0xf7
+	.string	"__n"
+	.byte	0x1
+	.value	0x12e
+	.byte	0x1a
+	.long	0xb503
+	.byte	0x8
+	.uleb128 0x5e
+	.long	.LASF3
+	.long	.LASF2299
+	.long	0xf355
+	.long	0x110c3
+	.uleb128 0xa
+	.long	0x1106b
+	.uleb128 0x27
+	.long	.LASF2284
+	.long	0x110cc
+	.uleb128 0xa
+	.long	0xf4ef
+	.uleb128 0x32
+	.long	.LASF2300
+	.byte	0x1
+	.value	0x12e
+	.byte	0x22
+	.long	0xf404
+	.uleb128 0x32
+	.long	.LASF2301
+	.byte	0x1
+	.value	0x12e
+	.byte	0x22
+	.long	0xf404
+	.uleb128 0x7d
+	.string	"n"
+	.long	0xb50f
+	.uleb128 0x54
+	.long	.LASF2273
+	.long	0xf35a
+	.uleb128 0xf8
+	.uleb128 0x7e
+	.byte	0x10
+	.value	0x12f
+	.byte	0x22
+	.uleb128 0x53
+	.long	.LASF2275
+	.long	.LASF2302
+	.long	0x11113
+	.long	0x1111e
+	.uleb128 0x2
+	.long	0xfe10
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xf9
+	.long	.LASF3
+	.long	.LASF2303
+	.long	0x11136
+	.byte	0x3
+	.long	0x11162
+	.uleb128 0xa
+	.long	0x110fd
+	.uleb128 0x27
+	.long	.LASF2284
+	.long	0x1113f
+	.uleb128 0xa
+	.long	0xfe15
+	.uleb128 0x19
+	.string	"p"
+	.byte	0x1
+	.value	0x12f
+	.byte	0x2a
+	.long	0xf355
+	.uleb128 0x54
+	.long	.LASF2300
+	.long	0xf404
+	.uleb128 0x54
+	.long	.LASF2301
+	.long	0xf404
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF2304
+	.byte	0x1
+	.value	0x12f
+	.byte	0x3c
+	.long	0xf404
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF2305
+	.byte	0x1
+	.value	0x12f
+	.byte	0x3c
+	.long	0xf404
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x11532
+	.quad	.LBI1293
+	.byte	.LVU116
+	.quad	.LBB1293
+	.quad	.LBE1293-.LBB1293
+	.byte	0x1
+	.value	0x12e
+	.byte	0x11
+	.uleb128 0x6
+	.long	0x1155b
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x8
+	.long	0x1154e
+	.uleb128 0x13
+	.long	0x11569
+	.quad	.LBI1295
+	.byte	.LVU117
+	.quad	.LBB1295
+	.quad	.LBE1295-.LBB1295
+	.byte	0x2
+	.value	0x747
+	.byte	0x1f
+	.uleb128 0x8
+	.long	0x1159d
+	.uleb128 0x8
+	.long	0x115b7
+	.uleb128 0x6
+	.long	0x115aa
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x37
+	.long	0xff24
+	.quad	.LBI1296
+	.byte	.LVU118
+	.quad	.LBB1296
+	.quad	.LBE1296-.LBB1296
+	.value	0x73c
+	.byte	0x1b
+	.long	0x112b2
+	.uleb128 0x6
+	.long	0xff4c
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x13
+	.long	0xfa75
+	.quad	.LBI1297
+	.byte	.LVU119
+	.quad	.LBB1297
+	.quad	.LBE1297-.LBB1297
+	.byte	0x2
+	.value	0x56b
+	.byte	0x24
+	.uleb128 0x6
+	.long	0xfa97
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x13
+	.long	0xf743
+	.quad	.LBI1298
+	.byte	.LVU120
+	.quad	.LBB1298
+	.quad	.LBE1298-.LBB1298
+	.byte	0x2
+	.value	0x55a
+	.byte	0x38
+	.uleb128 0x6
+	.long	0xf74d
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x13
+	.long	0xf613
+	.quad	.LBI1299
+	.byte	.LVU121
+	.quad	.LBB1299
+	.quad	.LBE1299-.LBB1299
+	.byte	0x2
+	.value	0x1ab
+	.byte	0x47
+	.uleb128 0x6
+	.long	0xf61d
+	.long	.LLST145
+	.long	.LVUS145
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	0xff5a
+	.quad	.LBI1301
+	.byte	.LVU124
+	.quad	.LBB1301
+	.quad	.LBE1301-.LBB1301
+	.value	0x73c
+	.byte	0x1b
+	.long	0x11375
+	.uleb128 0x6
+	.long	0xff82
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x13
+	.long	0xfaa5
+	.quad	.LBI1302
+	.byte	.LVU125
+	.quad	.LBB1302
+	.quad	.LBE1302-.LBB1302
+	.byte	0x2
+	.value	0x56b
+	.byte	0x24
+	.uleb128 0x6
+	.long	0xfad1
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x13
+	.long	0xf75b
+	.quad	.LBI1303
+	.byte	.LVU126
+	.quad	.LBB1303
+	.quad	.LBE1303-.LBB1303
+	.byte	0x2
+	.value	0x55a
+	.byte	0x38
+	.uleb128 0x6
+	.long	0xf765
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x13
+	.long	0xf62a
+	.quad	.LBI1304
+	.byte	.LVU127
+	.quad	.LBB1304
+	.quad	.LBE1304-.LBB1304
+	.byte	0x2
+	.value	0x10f
+	.byte	0x47
+	.uleb128 0x6
+	.long	0xf634
+	.long	.LLST149
+	.long	.LVUS149
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0xfdcd
+	.quad	.LBI1306
+	.byte	.LVU130
+	.quad	.LBB1306
+	.quad	.LBE1306-.LBB1306
+	.byte	0x2
+	.value	0x73c
+	.byte	0x1b
+	.uleb128 0x6
+	.long	0xfe09
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0x6
+	.long	0xfe04
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0x8
+	.long	0xfdf4
+	.uleb128 0x2f
+	.long	0xf931
+	.quad	.LBI1308
+	.byte	.LVU131
+	.quad	.LBB1308
+	.quad	.LBE1308-.LBB1308
+	.byte	0x3
+	.byte	0x60
+	.byte	0x28
+	.uleb128 0x6
+	.long	0xf97b
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x6
+	.long	0xf976
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x8
+	.long	0xf966
+	.uleb128 0x8
+	.long	0xf961
+	.uleb128 0x2f
+	.long	0x110ad
+	.quad	.LBI1309
+	.byte	.LVU132
+	.quad	.LBB1309
+	.quad	.LBE1309-.LBB1309
+	.byte	0x3
+	.byte	0x3d
+	.byte	0x24
+	.uleb128 0x6
+	.long	0x110de
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x6
+	.long	0x110d1
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x8
+	.long	0x110c3
+	.uleb128 0x44
+	.long	0x110eb
+	.uleb128 0x44
+	.long	0x110f2
+	.uleb128 0xfa
+	.long	0x110fb
+	.quad	.LBB1311
+	.quad	.LBE1311-.LBB1311
+	.uleb128 0x13
+	.long	0xfe1a
+	.quad	.LBI1312
+	.byte	.LVU133
+	.quad	.LBB1312
+	.quad	.LBE1312-.LBB1312
+	.byte	0x1
+	.value	0x12f
+	.byte	0x17
+	.uleb128 0x8
+	.long	0xfe45
+	.uleb128 0x6
+	.long	0xfe3a
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x6
+	.long	0xfe2d
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0xfb
+	.long	0xfe52
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x2e
+	.long	0x1111e
+	.quad	.LBI1314
+	.byte	.LVU136
+	.long	.LLRL159
+	.byte	0x1
+	.value	0x11b
+	.byte	0xb
+	.uleb128 0x6
+	.long	0x11144
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x6
+	.long	0x11136
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x2d
+	.long	.LLRL159
+	.uleb128 0x44
+	.long	0x1114f
+	.uleb128 0x44
+	.long	0x11158
+	.uleb128 0x2e
+	.long	0x12de1
+	.quad	.LBI1316
+	.byte	.LVU137
+	.long	.LLRL159
+	.byte	0x1
+	.value	0x12f
+	.byte	0x2f
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x6
+	.long	0x12def
+	.long	.LLST164
+	.long	.LVUS164
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xaaa8
+	.byte	0x3
+	.long	0x11569
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1106b
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x742
+	.byte	0x11
+	.long	0xa454
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x742
+	.byte	0x1f
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x18
+	.long	0xaada
+	.byte	0x3
+	.long	0x115bd
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1106b
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0x1159d
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x18
+	.long	0xa454
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x26
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x18
+	.long	0xf134
+	.byte	0x1
+	.long	0x1169d
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0x115db
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF2281
+	.byte	0x1
+	.value	0x104
+	.byte	0x32
+	.long	0xb6e6
+	.uleb128 0x32
+	.long	.LASF2286
+	.byte	0x1
+	.value	0x104
+	.byte	0x47
+	.long	0xad3c
+	.uleb128 0x21
+	.long	.LASF2287
+	.byte	0x1
+	.value	0x106
+	.byte	0x9
+	.long	0xa032
+	.uleb128 0x7e
+	.byte	0x8
+	.value	0x107
+	.byte	0x10
+	.uleb128 0x53
+	.long	.LASF2275
+	.long	.LASF2306
+	.long	0x11618
+	.long	0x11623
+	.uleb128 0x2
+	.long	0xf4e5
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF2289
+	.byte	0x1
+	.value	0x107
+	.byte	0x11
+	.long	0xb6e6
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF2277
+	.long	.LASF2307
+	.long	0xf355
+	.long	0x1166f
+	.uleb128 0x12
+	.long	.LASF2308
+	.long	0x11656
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0xa
+	.long	0x11602
+	.uleb128 0x12
+	.long	.LASF2308
+	.long	0x1166f
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2284
+	.long	0x11678
+	.uleb128 0xa
+	.long	0x11728
+	.uleb128 0x8f
+	.value	0x107
+	.byte	0x20
+	.long	0x11691
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.uleb128 0x54
+	.long	.LASF2281
+	.long	0xb6e9
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xab29
+	.byte	0x3
+	.long	0x116d4
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11602
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x742
+	.byte	0x11
+	.long	0xa4a8
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x742
+	.byte	0x1f
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x18
+	.long	0xab5b
+	.byte	0x3
+	.long	0x11728
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11602
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0x11708
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x18
+	.long	0xa4a8
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x26
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x7
+	.long	0x11656
+	.uleb128 0x18
+	.long	0xf169
+	.byte	0x1
+	.long	0x117e3
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0x1174b
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2286
+	.byte	0x1
+	.byte	0xf4
+	.byte	0x34
+	.long	0xad3c
+	.uleb128 0xd
+	.long	.LASF2287
+	.byte	0x1
+	.byte	0xf6
+	.byte	0x9
+	.long	0xa032
+	.uleb128 0xae
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf7
+	.byte	0x10
+	.uleb128 0x53
+	.long	.LASF2275
+	.long	.LASF2309
+	.long	0x1177a
+	.long	0x11785
+	.uleb128 0x2
+	.long	0xf4e0
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF2277
+	.long	.LASF2310
+	.long	0xf30d
+	.long	0x117c3
+	.uleb128 0x12
+	.long	.LASF2311
+	.long	0x117aa
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0xa
+	.long	0x11763
+	.uleb128 0x12
+	.long	.LASF2311
+	.long	0x117c3
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2284
+	.long	0x117cc
+	.uleb128 0xa
+	.long	0x1186e
+	.uleb128 0x2c
+	.byte	0x1
+	.byte	0xf7
+	.byte	0x19
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xabaa
+	.byte	0x3
+	.long	0x1181a
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11763
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x742
+	.byte	0x11
+	.long	0xa4fc
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x742
+	.byte	0x1f
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x18
+	.long	0xabdc
+	.byte	0x3
+	.long	0x1186e
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x11763
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0x1184e
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x18
+	.long	0xa4fc
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x26
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x7
+	.long	0x117aa
+	.uleb128 0x3d
+	.long	0xf23f
+	.long	0x11881
+	.byte	0x3
+	.long	0x1190a
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf4a9
+	.uleb128 0x7e
+	.byte	0x1
+	.value	0x1f2
+	.byte	0x12
+	.uleb128 0x53
+	.long	.LASF2275
+	.long	.LASF2312
+	.long	0x118a0
+	.long	0x118ab
+	.uleb128 0x2
+	.long	0xf4cc
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF2277
+	.long	.LASF2313
+	.long	0xf30d
+	.long	0x118e9
+	.uleb128 0x12
+	.long	.LASF2314
+	.long	0x118d0
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0xa
+	.long	0x1188a
+	.uleb128 0x12
+	.long	.LASF2314
+	.long	0x118e9
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2284
+	.long	0x118f2
+	.uleb128 0xa
+	.long	0x11995
+	.uleb128 0xb4
+	.value	0x1f2
+	.byte	0x1b
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xac2b
+	.byte	0x3
+	.long	0x11941
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1188a
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x742
+	.byte	0x11
+	.long	0xa550
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x742
+	.byte	0x1f
+	.long	0xf48b
+	.byte	0
+	.uleb128 0x18
+	.long	0xac5d
+	.byte	0x3
+	.long	0x11995
+	.uleb128 0xe
+	.string	"_Fn"
+	.long	0x1188a
+	.uleb128 0xf
+	.long	.LASF1348
+	.long	0xf48b
+	.uleb128 0x36
+	.long	.LASF817
+	.value	0x738
+	.long	0x11975
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0
+	.uleb128 0x20
+	.long	0xacc0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x19
+	.string	"__f"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x18
+	.long	0xa550
+	.uleb128 0x19
+	.string	"__t"
+	.byte	0x2
+	.value	0x73a
+	.byte	0x26
+	.long	0xf48b
+	.uleb128 0x1
+	.long	0xa23b
+	.byte	0
+	.uleb128 0x7
+	.long	0x118d0
+	.uleb128 0x3d
+	.long	0xeeb2
+	.long	0x119a8
+	.byte	0x3
+	.long	0x119b2
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf3f5
+	.byte	0
+	.uleb128 0x7
+	.long	0xedfe
+	.uleb128 0xa
+	.long	0x119b2
+	.uleb128 0x3d
+	.long	0xf199
+	.long	0x119d1
+	.byte	0x2
+	.long	0x119e5
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0x119b7
+	.uleb128 0x2b
+	.string	"f"
+	.byte	0x1
+	.byte	0x4b
+	.byte	0x11
+	.long	0xa95f
+	.byte	0
+	.uleb128 0xfc
+	.long	0x119bc
+	.long	0x119fa
+	.long	0x11a05
+	.uleb128 0xe
+	.string	"F"
+	.long	0x127f3
+	.uleb128 0x8
+	.long	0x119d1
+	.uleb128 0x8
+	.long	0x119da
+	.byte	0
+	.uleb128 0x3d
+	.long	0xeed0
+	.long	0x11a13
+	.byte	0x3
+	.long	0x11a29
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf3f5
+	.uleb128 0x43
+	.long	.LASF2281
+	.byte	0x1
+	.byte	0x7d
+	.byte	0x1a
+	.long	0xb6e6
+	.byte	0
+	.uleb128 0x3d
+	.long	0xf1bc
+	.long	0x11a4b
+	.byte	0x2
+	.long	0x11a64
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0x11a4b
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0x119b7
+	.uleb128 0x2c
+	.byte	0x1
+	.byte	0x3f
+	.byte	0x13
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.long	0x11a29
+	.long	.LASF2316
+	.long	0x11a89
+	.long	0x11a9e
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0x11a89
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0x8
+	.long	0x11a4b
+	.uleb128 0x2c
+	.byte	0x1
+	.byte	0x3f
+	.byte	0x13
+	.uleb128 0x8
+	.long	0x11a58
+	.uleb128 0x8
+	.long	0x11a5d
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.long	.LASF2317
+	.byte	0x39
+	.byte	0x13
+	.long	0xf355
+	.quad	.LFB13656
+	.quad	.LFE13656-.LFB13656
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11e42
+	.uleb128 0x35
+	.string	"p"
+	.byte	0x39
+	.byte	0x27
+	.long	0xb6e6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x35
+	.string	"x"
+	.byte	0x39
+	.byte	0x2f
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x35
+	.string	"y"
+	.byte	0x39
+	.byte	0x37
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4a
+	.long	0x1237f
+	.quad	.LBI1519
+	.byte	.LVU256
+	.quad	.LBB1519
+	.quad	.LBE1519-.LBB1519
+	.byte	0x4
+	.byte	0x3b
+	.byte	0x35
+	.long	0x11c88
+	.uleb128 0x6
+	.long	0x123af
+	.long	.LLST282
+	.long	.LVUS282
+	.uleb128 0x6
+	.long	0x123aa
+	.long	.LLST283
+	.long	.LVUS283
+	.uleb128 0x13
+	.long	0x1232c
+	.quad	.LBI1520
+	.byte	.LVU257
+	.quad	.LBB1520
+	.quad	.LBE1520-.LBB1520
+	.byte	0x1
+	.value	0x209
+	.byte	0x40
+	.uleb128 0x6
+	.long	0x12350
+	.long	.LLST284
+	.long	.LVUS284
+	.uleb128 0x6
+	.long	0x12343
+	.long	.LLST285
+	.long	.LVUS285
+	.uleb128 0x8
+	.long	0x1233a
+	.uleb128 0x13
+	.long	0x122c5
+	.quad	.LBI1521
+	.byte	.LVU258
+	.quad	.LBB1521
+	.quad	.LBE1521-.LBB1521
+	.byte	0x1
+	.value	0x1ee
+	.byte	0x7
+	.uleb128 0x6
+	.long	0x122f3
+	.long	.LLST287
+	.long	.LVUS287
+	.uleb128 0x6
+	.long	0x122e6
+	.long	.LLST288
+	.long	.LVUS288
+	.uleb128 0x8
+	.long	0x122dd
+	.uleb128 0x13
+	.long	0x12272
+	.quad	.LBI1522
+	.byte	.LVU259
+	.quad	.LBB1522
+	.quad	.LBE1522-.LBB1522
+	.byte	0x2
+	.value	0x429
+	.byte	0x19
+	.uleb128 0x6
+	.long	0x12296
+	.long	.LLST290
+	.long	.LVUS290
+	.uleb128 0x6
+	.long	0x12289
+	.long	.LLST291
+	.long	.LVUS291
+	.uleb128 0x8
+	.long	0x12280
+	.uleb128 0x37
+	.long	0x12231
+	.quad	.LBI1523
+	.byte	.LVU260
+	.quad	.LBB1523
+	.quad	.LBE1523-.LBB1523
+	.value	0x11c
+	.byte	0x2c
+	.long	0x11c4f
+	.uleb128 0x6
+	.long	0x12248
+	.long	.LLST293
+	.long	.LVUS293
+	.uleb128 0x8
+	.long	0x1223f
+	.uleb128 0x13
+	.long	0x121f1
+	.quad	.LBI1524
+	.byte	.LVU261
+	.quad	.LBB1524
+	.quad	.LBE1524-.LBB1524
+	.byte	0x2
+	.value	0x1b3
+	.byte	0x15
+	.uleb128 0x6
+	.long	0x12208
+	.long	.LLST295
+	.long	.LVUS295
+	.uleb128 0x8
+	.long	0x121ff
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x121b1
+	.quad	.LBI1525
+	.byte	.LVU263
+	.quad	.LBB1525
+	.quad	.LBE1525-.LBB1525
+	.byte	0x2
+	.value	0x11c
+	.byte	0x2c
+	.uleb128 0x6
+	.long	0x121c8
+	.long	.LLST297
+	.long	.LVUS297
+	.uleb128 0x8
+	.long	0x121bf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	0x12199
+	.quad	.LBI1526
+	.byte	.LVU265
+	.quad	.LBB1526
+	.quad	.LBE1526-.LBB1526
+	.byte	0x4
+	.byte	0x3b
+	.byte	0x35
+	.uleb128 0x8
+	.long	0x121a7
+	.uleb128 0x13
+	.long	0x11873
+	.quad	.LBI1527
+	.byte	.LVU266
+	.quad	.LBB1527
+	.quad	.LBE1527-.LBB1527
+	.byte	0x1
+	.value	0x1f6
+	.byte	0x31
+	.uleb128 0x8
+	.long	0x11881
+	.uleb128 0x13
+	.long	0x1190a
+	.quad	.LBI1529
+	.byte	.LVU267
+	.quad	.LBB1529
+	.quad	.LBE1529-.LBB1529
+	.byte	0x1
+	.value	0x1f2
+	.byte	0x11
+	.uleb128 0x8
+	.long	0x11933
+	.uleb128 0x8
+	.long	0x11926
+	.uleb128 0x13
+	.long	0x11941
+	.quad	.LBI1531
+	.byte	.LVU268
+	.quad	.LBB1531
+	.quad	.LBE1531-.LBB1531
+	.byte	0x2
+	.value	0x747
+	.byte	0x1f
+	.uleb128 0x8
+	.long	0x1198f
+	.uleb128 0x8
+	.long	0x11982
+	.uleb128 0x8
+	.long	0x11975
+	.uleb128 0x13
+	.long	0xfee1
+	.quad	.LBI1532
+	.byte	.LVU269
+	.quad	.LBB1532
+	.quad	.LBE1532-.LBB1532
+	.byte	0x2
+	.value	0x73c
+	.byte	0x1b
+	.uleb128 0x6
+	.long	0xff1d
+	.long	.LLST303
+	.long	.LVUS303
+	.uleb128 0x6
+	.long	0xff18
+	.long	.LLST304
+	.long	.LVUS304
+	.uleb128 0x8
+	.long	0xff08
+	.uleb128 0x2f
+	.long	0xfa24
+	.quad	.LBI1534
+	.byte	.LVU270
+	.quad	.LBB1534
+	.quad	.LBE1534-.LBB1534
+	.byte	0x3
+	.byte	0x60
+	.byte	0x28
+	.uleb128 0x6
+	.long	0xfa6e
+	.long	.LLST305
+	.long	.LVUS305
+	.uleb128 0x6
+	.long	0xfa69
+	.long	.LLST306
+	.long	.LVUS306
+	.uleb128 0x8
+	.long	0xfa59
+	.uleb128 0x8
+	.long	0xfa54
+	.uleb128 0x2f
+	.long	0x118ab
+	.quad	.LBI1535
+	.byte	.LVU271
+	.quad	.LBB1535
+	.quad	.LBE1535-.LBB1535
+	.byte	0x3
+	.byte	0x3d
+	.byte	0x24
+	.uleb128 0x6
+	.long	0x11901
+	.long	.LLST307
+	.long	.LVUS307
+	.uleb128 0x6
+	.long	0x118fc
+	.long	.LLST308
+	.long	.LVUS308
+	.uleb128 0x8
+	.long	0x118e9
+	.uleb128 0x13
+	.long	0x12de1
+	.quad	.LBI1536
+	.byte	.LVU272
+	.quad	.LBB1536
+	.quad	.LBE1536-.LBB1536
+	.byte	0x1
+	.value	0x1f2
+	.byte	0x2e
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST309
+	.long	.LVUS309
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST310
+	.long	.LVUS310
+	.uleb128 0x8
+	.long	0x12def
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.long	.LASF2318
+	.byte	0x31
+	.byte	0x12
+	.long	0xf30d
+	.quad	.LFB13628
+	.quad	.LFE13628-.LFB13628
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12199
+	.uleb128 0x35
+	.string	"x"
+	.byte	0x31
+	.byte	0x23
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x35
+	.string	"y"
+	.byte	0x31
+	.byte	0x2b
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4a
+	.long	0x1237f
+	.quad	.LBI1491
+	.byte	.LVU233
+	.quad	.LBB1491
+	.quad	.LBE1491-.LBB1491
+	.byte	0x4
+	.byte	0x34
+	.byte	0x1
+	.long	0x12021
+	.uleb128 0x6
+	.long	0x123af
+	.long	.LLST252
+	.long	.LVUS252
+	.uleb128 0x6
+	.long	0x123aa
+	.long	.LLST253
+	.long	.LVUS253
+	.uleb128 0x13
+	.long	0x1232c
+	.quad	.LBI1492
+	.byte	.LVU234
+	.quad	.LBB1492
+	.quad	.LBE1492-.LBB1492
+	.byte	0x1
+	.value	0x209
+	.byte	0x40
+	.uleb128 0x6
+	.long	0x12350
+	.long	.LLST254
+	.long	.LVUS254
+	.uleb128 0x6
+	.long	0x12343
+	.long	.LLST255
+	.long	.LVUS255
+	.uleb128 0x8
+	.long	0x1233a
+	.uleb128 0x13
+	.long	0x122c5
+	.quad	.LBI1493
+	.byte	.LVU235
+	.quad	.LBB1493
+	.quad	.LBE1493-.LBB1493
+	.byte	0x1
+	.value	0x1ee
+	.byte	0x7
+	.uleb128 0x6
+	.long	0x122f3
+	.long	.LLST257
+	.long	.LVUS257
+	.uleb128 0x6
+	.long	0x122e6
+	.long	.LLST258
+	.long	.LVUS258
+	.uleb128 0x8
+	.long	0x122dd
+	.uleb128 0x13
+	.long	0x12272
+	.quad	.LBI1494
+	.byte	.LVU236
+	.quad	.LBB1494
+	.quad	.LBE1494-.LBB1494
+	.byte	0x2
+	.value	0x429
+	.byte	0x19
+	.uleb128 0x6
+	.long	0x12296
+	.long	.LLST260
+	.long	.LVUS260
+	.uleb128 0x6
+	.long	0x12289
+	.long	.LLST261
+	.long	.LVUS261
+	.uleb128 0x8
+	.long	0x12280
+	.uleb128 0x37
+	.long	0x12231
+	.quad	.LBI1495
+	.byte	.LVU237
+	.quad	.LBB1495
+	.quad	.LBE1495-.LBB1495
+	.value	0x11c
+	.byte	0x2c
+	.long	0x11fe8
+	.uleb128 0x6
+	.long	0x12248
+	.long	.LLST263
+	.long	.LVUS263
+	.uleb128 0x8
+	.long	0x1223f
+	.uleb128 0x13
+	.long	0x121f1
+	.quad	.LBI1496
+	.byte	.LVU238
+	.quad	.LBB1496
+	.quad	.LBE1496-.LBB1496
+	.byte	0x2
+	.value	0x1b3
+	.byte	0x15
+	.uleb128 0x6
+	.long	0x12208
+	.long	.LLST265
+	.long	.LVUS265
+	.uleb128 0x8
+	.long	0x121ff
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x121b1
+	.quad	.LBI1497
+	.byte	.LVU240
+	.quad	.LBB1497
+	.quad	.LBE1497-.LBB1497
+	.byte	0x2
+	.value	0x11c
+	.byte	0x2c
+	.uleb128 0x6
+	.long	0x121c8
+	.long	.LLST267
+	.long	.LVUS267
+	.uleb128 0x8
+	.long	0x121bf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x12199
+	.quad	.LBI1498
+	.byte	.LVU242
+	.long	.LLRL269
+	.byte	0x4
+	.byte	0x33
+	.byte	0x1f
+	.uleb128 0x8
+	.long	0x121a7
+	.uleb128 0x2e
+	.long	0x11873
+	.quad	.LBI1499
+	.byte	.LVU243
+	.long	.LLRL269
+	.byte	0x1
+	.value	0x1f6
+	.byte	0x31
+	.uleb128 0x8
+	.long	0x11881
+	.uleb128 0x2d
+	.long	.LLRL269
+	.uleb128 0x2e
+	.long	0x1190a
+	.quad	.LBI1501
+	.byte	.LVU244
+	.long	.LLRL269
+	.byte	0x1
+	.value	0x1f2
+	.byte	0x11
+	.uleb128 0x8
+	.long	0x11933
+	.uleb128 0x8
+	.long	0x11926
+	.uleb128 0x2d
+	.long	.LLRL269
+	.uleb128 0x2e
+	.long	0x11941
+	.quad	.LBI1503
+	.byte	.LVU245
+	.long	.LLRL269
+	.byte	0x2
+	.value	0x747
+	.byte	0x1f
+	.uleb128 0x8
+	.long	0x1198f
+	.uleb128 0x8
+	.long	0x11982
+	.uleb128 0x8
+	.long	0x11975
+	.uleb128 0x2e
+	.long	0xfee1
+	.quad	.LBI1504
+	.byte	.LVU246
+	.long	.LLRL269
+	.byte	0x2
+	.value	0x73c
+	.byte	0x1b
+	.uleb128 0x6
+	.long	0xff1d
+	.long	.LLST274
+	.long	.LVUS274
+	.uleb128 0x6
+	.long	0xff18
+	.long	.LLST275
+	.long	.LVUS275
+	.uleb128 0x8
+	.long	0xff08
+	.uleb128 0x2d
+	.long	.LLRL269
+	.uleb128 0x28
+	.long	0xfa24
+	.quad	.LBI1506
+	.byte	.LVU247
+	.long	.LLRL269
+	.byte	0x3
+	.byte	0x60
+	.byte	0x28
+	.uleb128 0x6
+	.long	0xfa6e
+	.long	.LLST276
+	.long	.LVUS276
+	.uleb128 0x6
+	.long	0xfa69
+	.long	.LLST277
+	.long	.LVUS277
+	.uleb128 0x8
+	.long	0xfa59
+	.uleb128 0x8
+	.long	0xfa54
+	.uleb128 0x28
+	.long	0x118ab
+	.quad	.LBI1507
+	.byte	.LVU248
+	.long	.LLRL269
+	.byte	0x3
+	.byte	0x3d
+	.byte	0x24
+	.uleb128 0x6
+	.long	0x11901
+	.long	.LLST278
+	.long	.LVUS278
+	.uleb128 0x6
+	.long	0x118fc
+	.long	.LLST279
+	.long	.LVUS279
+	.uleb128 0x8
+	.long	0x118e9
+	.uleb128 0x13
+	.long	0x12de1
+	.quad	.LBI1508
+	.byte	.LVU251
+	.quad	.LBB1508
+	.quad	.LBE1508-.LBB1508
+	.byte	0x1
+	.value	0x1f2
+	.byte	0x2e
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST280
+	.long	.LVUS280
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST281
+	.long	.LVUS281
+	.uleb128 0x8
+	.long	0x12def
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	0xf25e
+	.long	0x121a7
+	.byte	0x3
+	.long	0x121b1
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf4a9
+	.byte	0
+	.uleb128 0x3d
+	.long	0x9cd6
+	.long	0x121bf
+	.byte	0x2
+	.long	0x121d5
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf44a
+	.uleb128 0x2b
+	.string	"__h"
+	.byte	0x2
+	.byte	0xc0
+	.byte	0x29
+	.long	0xf404
+	.byte	0
+	.uleb128 0x4c
+	.long	0x121b1
+	.long	.LASF2319
+	.long	0x121e6
+	.long	0x121f1
+	.uleb128 0x8
+	.long	0x121bf
+	.uleb128 0x8
+	.long	0x121c8
+	.byte	0
+	.uleb128 0x3d
+	.long	0x9aae
+	.long	0x121ff
+	.byte	0x2
+	.long	0x12215
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf418
+	.uleb128 0x2b
+	.string	"__h"
+	.byte	0x2
+	.byte	0xc0
+	.byte	0x29
+	.long	0xf404
+	.byte	0
+	.uleb128 0x4c
+	.long	0x121f1
+	.long	.LASF2320
+	.long	0x12226
+	.long	0x12231
+	.uleb128 0x8
+	.long	0x121ff
+	.uleb128 0x8
+	.long	0x12208
+	.byte	0
+	.uleb128 0x3d
+	.long	0x9bef
+	.long	0x1223f
+	.byte	0x2
+	.long	0x12256
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf43b
+	.uleb128 0x32
+	.long	.LASF2321
+	.byte	0x2
+	.value	0x1b2
+	.byte	0x20
+	.long	0xf404
+	.byte	0
+	.uleb128 0x4c
+	.long	0x12231
+	.long	.LASF2322
+	.long	0x12267
+	.long	0x12272
+	.uleb128 0x8
+	.long	0x1223f
+	.uleb128 0x8
+	.long	0x12248
+	.byte	0
+	.uleb128 0x3d
+	.long	0x9e64
+	.long	0x12280
+	.byte	0x2
+	.long	0x122a4
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf477
+	.uleb128 0x32
+	.long	.LASF2321
+	.byte	0x2
+	.value	0x11b
+	.byte	0x20
+	.long	0xf404
+	.uleb128 0x32
+	.long	.LASF2323
+	.byte	0x2
+	.value	0x11b
+	.byte	0x34
+	.long	0xf404
+	.byte	0
+	.uleb128 0x4c
+	.long	0x12272
+	.long	.LASF2324
+	.long	0x122b5
+	.long	0x122c5
+	.uleb128 0x8
+	.long	0x12280
+	.uleb128 0x8
+	.long	0x12289
+	.uleb128 0x8
+	.long	0x12296
+	.byte	0
+	.uleb128 0x3d
+	.long	0x9fff
+	.long	0x122dd
+	.byte	0x2
+	.long	0x12301
+	.uleb128 0x75
+	.long	.LASF2252
+	.long	0xacaa
+	.byte	0x1
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf486
+	.uleb128 0x32
+	.long	.LASF2325
+	.byte	0x2
+	.value	0x427
+	.byte	0x13
+	.long	0xf404
+	.uleb128 0x32
+	.long	.LASF2326
+	.byte	0x2
+	.value	0x427
+	.byte	0x24
+	.long	0xf404
+	.byte	0
+	.uleb128 0x4c
+	.long	0x122c5
+	.long	.LASF2327
+	.long	0x1231c
+	.long	0x1232c
+	.uleb128 0x75
+	.long	.LASF2252
+	.long	0xacaa
+	.byte	0x1
+	.uleb128 0x8
+	.long	0x122dd
+	.uleb128 0x8
+	.long	0x122e6
+	.uleb128 0x8
+	.long	0x122f3
+	.byte	0
+	.uleb128 0x3d
+	.long	0xf21a
+	.long	0x1233a
+	.byte	0x2
+	.long	0x1235e
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf49f
+	.uleb128 0x32
+	.long	.LASF2300
+	.byte	0x1
+	.value	0x1ed
+	.byte	0x2a
+	.long	0xf404
+	.uleb128 0x32
+	.long	.LASF2301
+	.byte	0x1
+	.value	0x1ed
+	.byte	0x2a
+	.long	0xf404
+	.byte	0
+	.uleb128 0x4c
+	.long	0x1232c
+	.long	.LASF2328
+	.long	0x1236f
+	.long	0x1237f
+	.uleb128 0x8
+	.long	0x1233a
+	.uleb128 0x8
+	.long	0x12343
+	.uleb128 0x8
+	.long	0x12350
+	.byte	0
+	.uleb128 0x18
+	.long	0xf2c9
+	.byte	0x3
+	.long	0x123b6
+	.uleb128 0xe
+	.string	"Tp"
+	.long	0xf30d
+	.uleb128 0x12
+	.long	.LASF2239
+	.long	0x123a5
+	.uleb128 0x9
+	.long	0xf404
+	.uleb128 0x9
+	.long	0xf404
+	.byte	0
+	.uleb128 0xb4
+	.value	0x207
+	.byte	0x3b
+	.uleb128 0x1
+	.long	0xf404
+	.uleb128 0x1
+	.long	0xf404
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.long	.LASF2329
+	.byte	0x2d
+	.byte	0x12
+	.long	0xf30d
+	.quad	.LFB13627
+	.quad	.LFE13627-.LFB13627
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12738
+	.uleb128 0x35
+	.string	"x"
+	.byte	0x2d
+	.byte	0x24
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x35
+	.string	"y"
+	.byte	0x2d
+	.byte	0x2c
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4a
+	.long	0x11a29
+	.quad	.LBI1462
+	.byte	.LVU208
+	.quad	.LBB1462
+	.quad	.LBE1462-.LBB1462
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xa
+	.long	0x125c3
+	.uleb128 0x6
+	.long	0x11a5d
+	.long	.LLST220
+	.long	.LVUS220
+	.uleb128 0x6
+	.long	0x11a58
+	.long	.LLST221
+	.long	.LVUS221
+	.uleb128 0x8
+	.long	0x11a4b
+	.uleb128 0x4a
+	.long	0x10160
+	.quad	.LBI1463
+	.byte	.LVU209
+	.quad	.LBB1463
+	.quad	.LBE1463-.LBB1463
+	.byte	0x1
+	.byte	0x40
+	.byte	0x1f
+	.long	0x1245c
+	.uleb128 0x8
+	.long	0x1016e
+	.byte	0
+	.uleb128 0x2f
+	.long	0x1011d
+	.quad	.LBI1464
+	.byte	.LVU211
+	.quad	.LBB1464
+	.quad	.LBE1464-.LBB1464
+	.byte	0x1
+	.byte	0x44
+	.byte	0x16
+	.uleb128 0x6
+	.long	0x10159
+	.long	.LLST224
+	.long	.LVUS224
+	.uleb128 0x6
+	.long	0x10154
+	.long	.LLST225
+	.long	.LVUS225
+	.uleb128 0x8
+	.long	0x10144
+	.uleb128 0x2f
+	.long	0x122c5
+	.quad	.LBI1465
+	.byte	.LVU212
+	.quad	.LBB1465
+	.quad	.LBE1465-.LBB1465
+	.byte	0x6
+	.byte	0x61
+	.byte	0xe
+	.uleb128 0x6
+	.long	0x122f3
+	.long	.LLST227
+	.long	.LVUS227
+	.uleb128 0x6
+	.long	0x122e6
+	.long	.LLST228
+	.long	.LVUS228
+	.uleb128 0x8
+	.long	0x122dd
+	.uleb128 0x13
+	.long	0x12272
+	.quad	.LBI1466
+	.byte	.LVU213
+	.quad	.LBB1466
+	.quad	.LBE1466-.LBB1466
+	.byte	0x2
+	.value	0x429
+	.byte	0x19
+	.uleb128 0x6
+	.long	0x12296
+	.long	.LLST230
+	.long	.LVUS230
+	.uleb128 0x6
+	.long	0x12289
+	.long	.LLST231
+	.long	.LVUS231
+	.uleb128 0x8
+	.long	0x12280
+	.uleb128 0x37
+	.long	0x12231
+	.quad	.LBI1467
+	.byte	.LVU214
+	.quad	.LBB1467
+	.quad	.LBE1467-.LBB1467
+	.value	0x11c
+	.byte	0x2c
+	.long	0x1258a
+	.uleb128 0x6
+	.long	0x12248
+	.long	.LLST233
+	.long	.LVUS233
+	.uleb128 0x8
+	.long	0x1223f
+	.uleb128 0x13
+	.long	0x121f1
+	.quad	.LBI1468
+	.byte	.LVU215
+	.quad	.LBB1468
+	.quad	.LBE1468-.LBB1468
+	.byte	0x2
+	.value	0x1b3
+	.byte	0x15
+	.uleb128 0x6
+	.long	0x12208
+	.long	.LLST235
+	.long	.LVUS235
+	.uleb128 0x8
+	.long	0x121ff
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x121b1
+	.quad	.LBI1469
+	.byte	.LVU217
+	.quad	.LBB1469
+	.quad	.LBE1469-.LBB1469
+	.byte	0x2
+	.value	0x11c
+	.byte	0x2c
+	.uleb128 0x6
+	.long	0x121c8
+	.long	.LLST237
+	.long	.LVUS237
+	.uleb128 0x8
+	.long	0x121bf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x1199a
+	.quad	.LBI1470
+	.byte	.LVU219
+	.long	.LLRL239
+	.byte	0x4
+	.byte	0x2f
+	.byte	0x20
+	.uleb128 0x8
+	.long	0x119a8
+	.uleb128 0x28
+	.long	0x1172d
+	.quad	.LBI1471
+	.byte	.LVU220
+	.long	.LLRL239
+	.byte	0x1
+	.byte	0x78
+	.byte	0x33
+	.uleb128 0x8
+	.long	0x1174b
+	.uleb128 0x2d
+	.long	.LLRL239
+	.uleb128 0x28
+	.long	0x117e3
+	.quad	.LBI1473
+	.byte	.LVU221
+	.long	.LLRL239
+	.byte	0x1
+	.byte	0xf7
+	.byte	0xf
+	.uleb128 0x8
+	.long	0x1180c
+	.uleb128 0x8
+	.long	0x117ff
+	.uleb128 0x2d
+	.long	.LLRL239
+	.uleb128 0x2e
+	.long	0x1181a
+	.quad	.LBI1475
+	.byte	.LVU222
+	.long	.LLRL239
+	.byte	0x2
+	.value	0x747
+	.byte	0x1f
+	.uleb128 0x8
+	.long	0x11868
+	.uleb128 0x8
+	.long	0x1185b
+	.uleb128 0x8
+	.long	0x1184e
+	.uleb128 0x2e
+	.long	0xfe9e
+	.quad	.LBI1476
+	.byte	.LVU223
+	.long	.LLRL239
+	.byte	0x2
+	.value	0x73c
+	.byte	0x1b
+	.uleb128 0x6
+	.long	0xfeda
+	.long	.LLST244
+	.long	.LVUS244
+	.uleb128 0x6
+	.long	0xfed5
+	.long	.LLST245
+	.long	.LVUS245
+	.uleb128 0x8
+	.long	0xfec5
+	.uleb128 0x2d
+	.long	.LLRL239
+	.uleb128 0x28
+	.long	0xf9d3
+	.quad	.LBI1478
+	.byte	.LVU224
+	.long	.LLRL239
+	.byte	0x3
+	.byte	0x60
+	.byte	0x28
+	.uleb128 0x6
+	.long	0xfa1d
+	.long	.LLST246
+	.long	.LVUS246
+	.uleb128 0x6
+	.long	0xfa18
+	.long	.LLST247
+	.long	.LVUS247
+	.uleb128 0x8
+	.long	0xfa08
+	.uleb128 0x8
+	.long	0xfa03
+	.uleb128 0x28
+	.long	0x11785
+	.quad	.LBI1479
+	.byte	.LVU225
+	.long	.LLRL239
+	.byte	0x3
+	.byte	0x3d
+	.byte	0x24
+	.uleb128 0x6
+	.long	0x117da
+	.long	.LLST248
+	.long	.LVUS248
+	.uleb128 0x6
+	.long	0x117d5
+	.long	.LLST249
+	.long	.LVUS249
+	.uleb128 0x8
+	.long	0x117c3
+	.uleb128 0x2f
+	.long	0x12de1
+	.quad	.LBI1480
+	.byte	.LVU228
+	.quad	.LBB1480
+	.quad	.LBE1480-.LBB1480
+	.byte	0x1
+	.byte	0xf7
+	.byte	0x2c
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST250
+	.long	.LVUS250
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST251
+	.long	.LVUS251
+	.uleb128 0x8
+	.long	0x12def
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.long	.LASF2330
+	.byte	0x2c
+	.byte	0x12
+	.long	0xf30d
+	.quad	.LFB13626
+	.quad	.LFE13626-.LFB13626
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x127b1
+	.uleb128 0x35
+	.string	"x"
+	.byte	0x2c
+	.byte	0x24
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x35
+	.string	"y"
+	.byte	0x2c
+	.byte	0x2c
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2f
+	.long	0x12de1
+	.quad	.LBI1424
+	.byte	.LVU203
+	.quad	.LBB1424
+	.quad	.LBE1424-.LBB1424
+	.byte	0x4
+	.byte	0x2c
+	.byte	0x38
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST217
+	.long	.LVUS217
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST218
+	.long	.LVUS218
+	.uleb128 0x8
+	.long	0x12def
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.long	.LASF2331
+	.byte	0x24
+	.byte	0x13
+	.long	0xf355
+	.quad	.LFB13623
+	.quad	.LFE13623-.LFB13623
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x129b1
+	.uleb128 0x35
+	.string	"p"
+	.byte	0x24
+	.byte	0x26
+	.long	0xb6e6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x35
+	.string	"x"
+	.byte	0x24
+	.byte	0x2e
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x35
+	.string	"y"
+	.byte	0x24
+	.byte	0x36
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xfd
+	.byte	0x10
+	.byte	0x4
+	.byte	0x26
+	.byte	0x1d
+	.long	0x12866
+	.uleb128 0xb0
+	.long	.LASF2275
+	.long	0x1280b
+	.long	0x12816
+	.uleb128 0x2
+	.long	0xf409
+	.uleb128 0x2
+	.long	0xacf1
+	.byte	0
+	.uleb128 0xfe
+	.long	.LASF3
+	.long	0xf30d
+	.long	0x1282e
+	.byte	0x3
+	.long	0x1284b
+	.uleb128 0xa
+	.long	0x127f3
+	.uleb128 0x27
+	.long	.LASF2284
+	.long	0x12837
+	.uleb128 0xa
+	.long	0xf40e
+	.uleb128 0x7d
+	.string	"x"
+	.long	0xad05
+	.uleb128 0x7d
+	.string	"y"
+	.long	0xad05
+	.byte	0
+	.uleb128 0x59
+	.string	"__x"
+	.byte	0x4
+	.byte	0x26
+	.byte	0x2d
+	.long	0xacfe
+	.byte	0
+	.uleb128 0x59
+	.string	"__y"
+	.byte	0x4
+	.byte	0x26
+	.byte	0x30
+	.long	0xacfe
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4a
+	.long	0x119bc
+	.quad	.LBI1412
+	.byte	.LVU183
+	.quad	.LBB1412
+	.quad	.LBE1412-.LBB1412
+	.byte	0x4
+	.byte	0x26
+	.byte	0xa
+	.long	0x128ed
+	.uleb128 0x8
+	.long	0x119da
+	.uleb128 0x8
+	.long	0x119d1
+	.uleb128 0x4a
+	.long	0x10160
+	.quad	.LBI1413
+	.byte	.LVU184
+	.quad	.LBB1413
+	.quad	.LBE1413-.LBB1413
+	.byte	0x1
+	.byte	0x4c
+	.byte	0x29
+	.long	0x128c0
+	.uleb128 0x8
+	.long	0x1016e
+	.byte	0
+	.uleb128 0x2f
+	.long	0xff90
+	.quad	.LBI1414
+	.byte	.LVU186
+	.quad	.LBB1414
+	.quad	.LBE1414-.LBB1414
+	.byte	0x1
+	.byte	0x50
+	.byte	0x16
+	.uleb128 0x8
+	.long	0xffc2
+	.uleb128 0x8
+	.long	0xffb2
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x11a05
+	.quad	.LBI1415
+	.byte	.LVU188
+	.long	.LLRL209
+	.byte	0x4
+	.byte	0x26
+	.byte	0x43
+	.uleb128 0x6
+	.long	0x11a1c
+	.long	.LLST210
+	.long	.LVUS210
+	.uleb128 0x8
+	.long	0x11a13
+	.uleb128 0x28
+	.long	0x100d7
+	.quad	.LBI1416
+	.byte	.LVU189
+	.long	.LLRL209
+	.byte	0x1
+	.byte	0x7e
+	.byte	0x15
+	.uleb128 0x8
+	.long	0x100f5
+	.uleb128 0x6
+	.long	0x100e8
+	.long	.LLST213
+	.long	.LVUS213
+	.uleb128 0x13
+	.long	0x12816
+	.quad	.LBI1418
+	.byte	.LVU190
+	.quad	.LBB1418
+	.quad	.LBE1418-.LBB1418
+	.byte	0x1
+	.value	0x111
+	.byte	0x38
+	.uleb128 0x8
+	.long	0x1282e
+	.uleb128 0x44
+	.long	0x1283c
+	.uleb128 0x44
+	.long	0x12843
+	.uleb128 0x2f
+	.long	0x12de1
+	.quad	.LBI1420
+	.byte	.LVU192
+	.quad	.LBB1420
+	.quad	.LBE1420-.LBB1420
+	.byte	0x4
+	.byte	0x26
+	.byte	0x27
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST215
+	.long	.LVUS215
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST216
+	.long	.LVUS216
+	.uleb128 0x8
+	.long	0x12def
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.long	.LASF2332
+	.byte	0x20
+	.byte	0x13
+	.long	0xf355
+	.quad	.LFB13620
+	.quad	.LFE13620-.LFB13620
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12d61
+	.uleb128 0x35
+	.string	"p"
+	.byte	0x20
+	.byte	0x28
+	.long	0xb6e6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x35
+	.string	"x"
+	.byte	0x20
+	.byte	0x30
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x35
+	.string	"y"
+	.byte	0x20
+	.byte	0x38
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4a
+	.long	0x11a29
+	.quad	.LBI1365
+	.byte	.LVU157
+	.quad	.LBB1365
+	.quad	.LBE1365-.LBB1365
+	.byte	0x4
+	.byte	0x22
+	.byte	0xa
+	.long	0x12bc9
+	.uleb128 0x6
+	.long	0x11a5d
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x6
+	.long	0x11a58
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x8
+	.long	0x11a4b
+	.uleb128 0x4a
+	.long	0x10160
+	.quad	.LBI1366
+	.byte	.LVU158
+	.quad	.LBB1366
+	.quad	.LBE1366-.LBB1366
+	.byte	0x1
+	.byte	0x40
+	.byte	0x1f
+	.long	0x12a62
+	.uleb128 0x8
+	.long	0x1016e
+	.byte	0
+	.uleb128 0x2f
+	.long	0x1011d
+	.quad	.LBI1367
+	.byte	.LVU160
+	.quad	.LBB1367
+	.quad	.LBE1367-.LBB1367
+	.byte	0x1
+	.byte	0x44
+	.byte	0x16
+	.uleb128 0x6
+	.long	0x10159
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x6
+	.long	0x10154
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x8
+	.long	0x10144
+	.uleb128 0x2f
+	.long	0x122c5
+	.quad	.LBI1368
+	.byte	.LVU161
+	.quad	.LBB1368
+	.quad	.LBE1368-.LBB1368
+	.byte	0x6
+	.byte	0x61
+	.byte	0xe
+	.uleb128 0x6
+	.long	0x122f3
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x6
+	.long	0x122e6
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x8
+	.long	0x122dd
+	.uleb128 0x13
+	.long	0x12272
+	.quad	.LBI1369
+	.byte	.LVU162
+	.quad	.LBB1369
+	.quad	.LBE1369-.LBB1369
+	.byte	0x2
+	.value	0x429
+	.byte	0x19
+	.uleb128 0x6
+	.long	0x12296
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x6
+	.long	0x12289
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0x8
+	.long	0x12280
+	.uleb128 0x37
+	.long	0x12231
+	.quad	.LBI1370
+	.byte	.LVU163
+	.quad	.LBB1370
+	.quad	.LBE1370-.LBB1370
+	.value	0x11c
+	.byte	0x2c
+	.long	0x12b90
+	.uleb128 0x6
+	.long	0x12248
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x8
+	.long	0x1223f
+	.uleb128 0x13
+	.long	0x121f1
+	.quad	.LBI1371
+	.byte	.LVU164
+	.quad	.LBB1371
+	.quad	.LBE1371-.LBB1371
+	.byte	0x2
+	.value	0x1b3
+	.byte	0x15
+	.uleb128 0x6
+	.long	0x12208
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x8
+	.long	0x121ff
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x121b1
+	.quad	.LBI1372
+	.byte	.LVU166
+	.quad	.LBB1372
+	.quad	.LBE1372-.LBB1372
+	.byte	0x2
+	.value	0x11c
+	.byte	0x2c
+	.uleb128 0x6
+	.long	0x121c8
+	.long	.LLST186
+	.long	.LVUS186
+	.uleb128 0x8
+	.long	0x121bf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x11a05
+	.quad	.LBI1373
+	.byte	.LVU168
+	.long	.LLRL188
+	.byte	0x4
+	.byte	0x22
+	.byte	0x2d
+	.uleb128 0x6
+	.long	0x11a1c
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x8
+	.long	0x11a13
+	.uleb128 0x28
+	.long	0x115bd
+	.quad	.LBI1374
+	.byte	.LVU169
+	.long	.LLRL188
+	.byte	0x1
+	.byte	0x7e
+	.byte	0x15
+	.uleb128 0x8
+	.long	0x115e8
+	.uleb128 0x6
+	.long	0x115db
+	.long	.LLST192
+	.long	.LVUS192
+	.uleb128 0x2d
+	.long	.LLRL188
+	.uleb128 0x2e
+	.long	0x1169d
+	.quad	.LBI1376
+	.byte	.LVU170
+	.long	.LLRL188
+	.byte	0x1
+	.value	0x107
+	.byte	0xf
+	.uleb128 0x8
+	.long	0x116c6
+	.uleb128 0x8
+	.long	0x116b9
+	.uleb128 0x2d
+	.long	.LLRL188
+	.uleb128 0x2e
+	.long	0x116d4
+	.quad	.LBI1378
+	.byte	.LVU171
+	.long	.LLRL188
+	.byte	0x2
+	.value	0x747
+	.byte	0x1f
+	.uleb128 0x8
+	.long	0x11722
+	.uleb128 0x8
+	.long	0x11715
+	.uleb128 0x8
+	.long	0x11708
+	.uleb128 0x2e
+	.long	0xfe5b
+	.quad	.LBI1379
+	.byte	.LVU172
+	.long	.LLRL188
+	.byte	0x2
+	.value	0x73c
+	.byte	0x1b
+	.uleb128 0x6
+	.long	0xfe97
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0x6
+	.long	0xfe92
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0x8
+	.long	0xfe82
+	.uleb128 0x2d
+	.long	.LLRL188
+	.uleb128 0x28
+	.long	0xf982
+	.quad	.LBI1381
+	.byte	.LVU173
+	.long	.LLRL188
+	.byte	0x3
+	.byte	0x60
+	.byte	0x28
+	.uleb128 0x6
+	.long	0xf9cc
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0x6
+	.long	0xf9c7
+	.long	.LLST198
+	.long	.LVUS198
+	.uleb128 0x8
+	.long	0xf9b7
+	.uleb128 0x8
+	.long	0xf9b2
+	.uleb128 0x28
+	.long	0x11631
+	.quad	.LBI1382
+	.byte	.LVU174
+	.long	.LLRL188
+	.byte	0x3
+	.byte	0x3d
+	.byte	0x24
+	.uleb128 0x6
+	.long	0x1168b
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x6
+	.long	0x11686
+	.long	.LLST200
+	.long	.LVUS200
+	.uleb128 0x8
+	.long	0x1166f
+	.uleb128 0x2d
+	.long	.LLRL188
+	.uleb128 0x44
+	.long	0x11691
+	.uleb128 0x2e
+	.long	0x12de1
+	.quad	.LBI1384
+	.byte	.LVU175
+	.long	.LLRL188
+	.byte	0x1
+	.value	0x108
+	.byte	0xc
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST202
+	.long	.LVUS202
+	.uleb128 0x6
+	.long	0x12def
+	.long	.LLST203
+	.long	.LVUS203
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.long	.LASF2333
+	.byte	0x1c
+	.byte	0x13
+	.long	0xf355
+	.quad	.LFB13619
+	.quad	.LFE13619-.LFB13619
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12de1
+	.uleb128 0x35
+	.string	"p"
+	.byte	0x1c
+	.byte	0x28
+	.long	0xb6e6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x35
+	.string	"x"
+	.byte	0x1c
+	.byte	0x30
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x35
+	.string	"y"
+	.byte	0x1c
+	.byte	0x38
+	.long	0xacfe
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x28
+	.long	0x12de1
+	.quad	.LBI1322
+	.byte	.LVU149
+	.long	.LLRL165
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x1e
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0x6
+	.long	0x12def
+	.long	.LLST168
+	.long	.LVUS168
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	0xf334
+	.long	0x12def
+	.byte	0x2
+	.long	0x12e0d
+	.uleb128 0x27
+	.long	.LASF2285
+	.long	0xf35a
+	.uleb128 0x2b
+	.string	"x"
+	.byte	0x4
+	.byte	0x13
+	.byte	0xe
+	.long	0xacfe
+	.uleb128 0x2b
+	.string	"y"
+	.byte	0x4
+	.byte	0x13
+	.byte	0x16
+	.long	0xacfe
+	.byte	0
+	.uleb128 0x4c
+	.long	0x12de1
+	.long	.LASF2334
+	.long	0x12e1e
+	.long	0x12e2e
+	.uleb128 0x8
+	.long	0x12def
+	.uleb128 0x8
+	.long	0x12df8
+	.uleb128 0x8
+	.long	0x12e02
+	.byte	0
+	.uleb128 0xff
+	.long	.LASF2335
+	.byte	0x70
+	.byte	0xb4
+	.byte	0xd
+	.long	.LASF2336
+	.long	0x12e4a
+	.uleb128 0x1
+	.long	0xb6e6
+	.uleb128 0x1
+	.long	0xb6e6
+	.byte	0
+	.uleb128 0x100
+	.long	.LASF2337
+	.byte	0x70
+	.byte	0xae
+	.byte	0x21
+	.long	.LASF2338
+	.long	0xb6e6
+	.byte	0x3
+	.long	0x12e72
+	.uleb128 0x1
+	.long	0x121
+	.uleb128 0x2b
+	.string	"__p"
+	.byte	0x70
+	.byte	0xae
+	.byte	0x41
+	.long	0xb6e6
+	.byte	0
+	.uleb128 0x101
+	.long	0x1172d
+	.long	.LASF2247
+	.quad	.LFB14484
+	.quad	.LFE14484-.LFB14484
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13199
+	.uleb128 0x90
+	.long	0x1174b
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2f
+	.long	0x117e3
+	.quad	.LBI1089
+	.byte	.LVU1
+	.quad	.LBB1089
+	.quad	.LBE1089-.LBB1089
+	.byte	0x1
+	.byte	0xf7
+	.byte	0xf
+	.uleb128 0x6
+	.long	0x1180c
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x8
+	.long	0x117ff
+	.uleb128 0x13
+	.long	0x1181a
+	.quad	.LBI1091
+	.byte	.LVU2
+	.quad	.LBB1091
+	.quad	.LBE1091-.LBB1091
+	.byte	0x2
+	.value	0x747
+	.byte	0x1f
+	.uleb128 0x8
+	.long	0x11868
+	.uleb128 0x6
+	.long	0x1185b
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x8
+	.long	0x1184e
+	.uleb128 0x37
+	.long	0xff24
+	.quad	.LBI1092
+	.byte	.LVU3
+	.quad	.LBB1092
+	.quad	.LBE1092-.LBB1092
+	.value	0x73c
+	.byte	0x1b
+	.long	0x12fc9
+	.uleb128 0x6
+	.long	0xff4c
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x13
+	.long	0xfa75
+	.quad	.LBI1093
+	.byte	.LVU4
+	.quad	.LBB1093
+	.quad	.LBE1093-.LBB1093
+	.byte	0x2
+	.value	0x56b
+	.byte	0x24
+	.uleb128 0x6
+	.long	0xfa97
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x13
+	.long	0xf743
+	.quad	.LBI1094
+	.byte	.LVU5
+	.quad	.LBB1094
+	.quad	.LBE1094-.LBB1094
+	.byte	0x2
+	.value	0x55a
+	.byte	0x38
+	.uleb128 0x6
+	.long	0xf74d
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x13
+	.long	0xf613
+	.quad	.LBI1095
+	.byte	.LVU6
+	.quad	.LBB1095
+	.quad	.LBE1095-.LBB1095
+	.byte	0x2
+	.value	0x1ab
+	.byte	0x47
+	.uleb128 0x6
+	.long	0xf61d
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	0xff5a
+	.quad	.LBI1096
+	.byte	.LVU8
+	.quad	.LBB1096
+	.quad	.LBE1096-.LBB1096
+	.value	0x73c
+	.byte	0x1b
+	.long	0x1308c
+	.uleb128 0x6
+	.long	0xff82
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x13
+	.long	0xfaa5
+	.quad	.LBI1097
+	.byte	.LVU9
+	.quad	.LBB1097
+	.quad	.LBE1097-.LBB1097
+	.byte	0x2
+	.value	0x56b
+	.byte	0x24
+	.uleb128 0x6
+	.long	0xfad1
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x13
+	.long	0xf75b
+	.quad	.LBI1098
+	.byte	.LVU10
+	.quad	.LBB1098
+	.quad	.LBE1098-.LBB1098
+	.byte	0x2
+	.value	0x55a
+	.byte	0x38
+	.uleb128 0x6
+	.long	0xf765
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x13
+	.long	0xf62a
+	.quad	.LBI1099
+	.byte	.LVU11
+	.quad	.LBB1099
+	.quad	.LBE1099-.LBB1099
+	.byte	0x2
+	.value	0x10f
+	.byte	0x47
+	.uleb128 0x6
+	.long	0xf634
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0xfe9e
+	.quad	.LBI1100
+	.byte	.LVU13
+	.quad	.LBB1100
+	.quad	.LBE1100-.LBB1100
+	.byte	0x2
+	.value	0x73c
+	.byte	0x1b
+	.uleb128 0x6
+	.long	0xfeda
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x6
+	.long	0xfed5
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x8
+	.long	0xfec5
+	.uleb128 0x2f
+	.long	0xf9d3
+	.quad	.LBI1102
+	.byte	.LVU14
+	.quad	.LBB1102
+	.quad	.LBE1102-.LBB1102
+	.byte	0x3
+	.byte	0x60
+	.byte	0x28
+	.uleb128 0x6
+	.long	0xfa1d
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x6
+	.long	0xfa18
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x8
+	.long	0xfa08
+	.uleb128 0x8
+	.long	0xfa03
+	.uleb128 0x2f
+	.long	0x11785
+	.quad	.LBI1103
+	.byte	.LVU15
+	.quad	.LBB1103
+	.quad	.LBE1103-.LBB1103
+	.byte	0x3
+	.byte	0x3d
+	.byte	0x24
+	.uleb128 0x6
+	.long	0x117da
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x6
+	.long	0x117d5
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x8
+	.long	0x117c3
+	.uleb128 0x2f
+	.long	0x12de1
+	.quad	.LBI1105
+	.byte	.LVU17
+	.quad	.LBB1105
+	.quad	.LBE1105-.LBB1105
+	.byte	0x1
+	.byte	0xf7
+	.byte	0x2c
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x8
+	.long	0x12def
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x102
+	.long	0x115bd
+	.long	.LASF2245
+	.quad	.LFB14493
+	.quad	.LFE14493-.LFB14493
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x90
+	.long	0x115db
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x90
+	.long	0x115e8
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2e
+	.long	0x1169d
+	.quad	.LBI1127
+	.byte	.LVU23
+	.long	.LLRL23
+	.byte	0x1
+	.value	0x107
+	.byte	0xf
+	.uleb128 0x6
+	.long	0x116c6
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x8
+	.long	0x116b9
+	.uleb128 0x2d
+	.long	.LLRL23
+	.uleb128 0x2e
+	.long	0x116d4
+	.quad	.LBI1129
+	.byte	.LVU24
+	.long	.LLRL23
+	.byte	0x2
+	.value	0x747
+	.byte	0x1f
+	.uleb128 0x8
+	.long	0x11722
+	.uleb128 0x6
+	.long	0x11715
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x8
+	.long	0x11708
+	.uleb128 0x37
+	.long	0xff24
+	.quad	.LBI1130
+	.byte	.LVU25
+	.quad	.LBB1130
+	.quad	.LBE1130-.LBB1130
+	.value	0x73c
+	.byte	0x1b
+	.long	0x132e2
+	.uleb128 0x6
+	.long	0xff4c
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x13
+	.long	0xfa75
+	.quad	.LBI1131
+	.byte	.LVU26
+	.quad	.LBB1131
+	.quad	.LBE1131-.LBB1131
+	.byte	0x2
+	.value	0x56b
+	.byte	0x24
+	.uleb128 0x6
+	.long	0xfa97
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x13
+	.long	0xf743
+	.quad	.LBI1132
+	.byte	.LVU27
+	.quad	.LBB1132
+	.quad	.LBE1132-.LBB1132
+	.byte	0x2
+	.value	0x55a
+	.byte	0x38
+	.uleb128 0x6
+	.long	0xf74d
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x13
+	.long	0xf613
+	.quad	.LBI1133
+	.byte	.LVU28
+	.quad	.LBB1133
+	.quad	.LBE1133-.LBB1133
+	.byte	0x2
+	.value	0x1ab
+	.byte	0x47
+	.uleb128 0x6
+	.long	0xf61d
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	0xff5a
+	.quad	.LBI1134
+	.byte	.LVU30
+	.quad	.LBB1134
+	.quad	.LBE1134-.LBB1134
+	.value	0x73c
+	.byte	0x1b
+	.long	0x133a5
+	.uleb128 0x6
+	.long	0xff82
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x13
+	.long	0xfaa5
+	.quad	.LBI1135
+	.byte	.LVU31
+	.quad	.LBB1135
+	.quad	.LBE1135-.LBB1135
+	.byte	0x2
+	.value	0x56b
+	.byte	0x24
+	.uleb128 0x6
+	.long	0xfad1
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x13
+	.long	0xf75b
+	.quad	.LBI1136
+	.byte	.LVU32
+	.quad	.LBB1136
+	.quad	.LBE1136-.LBB1136
+	.byte	0x2
+	.value	0x55a
+	.byte	0x38
+	.uleb128 0x6
+	.long	0xf765
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x13
+	.long	0xf62a
+	.quad	.LBI1137
+	.byte	.LVU33
+	.quad	.LBB1137
+	.quad	.LBE1137-.LBB1137
+	.byte	0x2
+	.value	0x10f
+	.byte	0x47
+	.uleb128 0x6
+	.long	0xf634
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	0xfe5b
+	.quad	.LBI1138
+	.byte	.LVU35
+	.long	.LLRL36
+	.byte	0x2
+	.value	0x73c
+	.byte	0x1b
+	.uleb128 0x6
+	.long	0xfe97
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x6
+	.long	0xfe92
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x8
+	.long	0xfe82
+	.uleb128 0x2d
+	.long	.LLRL36
+	.uleb128 0x28
+	.long	0xf982
+	.quad	.LBI1140
+	.byte	.LVU36
+	.long	.LLRL36
+	.byte	0x3
+	.byte	0x60
+	.byte	0x28
+	.uleb128 0x6
+	.long	0xf9cc
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x6
+	.long	0xf9c7
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x8
+	.long	0xf9b7
+	.uleb128 0x8
+	.long	0xf9b2
+	.uleb128 0x28
+	.long	0x11631
+	.quad	.LBI1141
+	.byte	.LVU37
+	.long	.LLRL36
+	.byte	0x3
+	.byte	0x3d
+	.byte	0x24
+	.uleb128 0x6
+	.long	0x1168b
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x6
+	.long	0x11686
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x8
+	.long	0x1166f
+	.uleb128 0x2d
+	.long	.LLRL36
+	.uleb128 0x44
+	.long	0x11691
+	.uleb128 0x2e
+	.long	0x12de1
+	.quad	.LBI1143
+	.byte	.LVU38
+	.long	.LLRL46
+	.byte	0x1
+	.value	0x108
+	.byte	0xc
+	.uleb128 0x6
+	.long	0x12e02
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x6
+	.long	0x12df8
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x6
+	.long	0x12def
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x4107
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x42
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x4108
+	.byte	0x1
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x4107
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 54
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 111
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 64
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 98
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0xd
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x6b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x60
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x62
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x63
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x64
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x65
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x66
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x67
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6d
+	.uleb128 0x19
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x68
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x69
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6a
+	.uleb128 0x4107
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6b
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x70
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x71
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x72
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1e
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x73
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x74
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x75
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1e
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x76
+	.uleb128 0x4107
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x77
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x78
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x79
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 71
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7b
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x80
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x81
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x82
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x83
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 34
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 332
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x84
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 35
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x85
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x86
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x87
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x88
+	.uleb128 0x3a
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x89
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8f
+	.uleb128 0x4108
+	.byte	0x1
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x90
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x91
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x92
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x93
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x94
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x95
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x21
+	.sleb128 16
+	.byte	0
+	.byte	0
+	.uleb128 0x96
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x97
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 35
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x98
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x38
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x99
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 35
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9a
+	.uleb128 0x4107
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x9c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 64
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xa
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa0
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 64
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xa
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 55
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa2
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x89
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa3
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 97
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0x5
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 99
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x4c
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x4d
+	.uleb128 0x18
+	.uleb128 0x1d
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa6
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1d
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 97
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x4c
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x4d
+	.uleb128 0x18
+	.uleb128 0x1d
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa8
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 98
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xaa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 103
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0xab
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.byte	0
+	.byte	0
+	.uleb128 0xac
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 280
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xad
+	.uleb128 0x4108
+	.byte	0x1
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xae
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xaf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb0
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb2
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xb3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb4
+	.uleb128 0x4108
+	.byte	0x1
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb5
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb6
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb7
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb8
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0xb
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xba
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xbb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xbc
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xbd
+	.uleb128 0x4
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6d
+	.uleb128 0x19
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xbe
+	.uleb128 0x3a
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xbf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc0
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc1
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc2
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1e
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc3
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0xb
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc4
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0xb
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc6
+	.uleb128 0x4107
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xc9
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xca
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xcb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xcc
+	.uleb128 0x15
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xcd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xce
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xcf
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd0
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0x5
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd1
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd2
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd4
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd5
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd6
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd8
+	.uleb128 0x2
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xda
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0x7
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xdb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xdc
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1d
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xdd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xde
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x4c
+	.uleb128 0xb
+	.uleb128 0x4d
+	.uleb128 0x18
+	.uleb128 0x1d
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xdf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x4c
+	.uleb128 0xb
+	.uleb128 0x1d
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe0
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe1
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x4c
+	.uleb128 0xb
+	.uleb128 0x1d
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0xb
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe2
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe3
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0x6
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe5
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6d
+	.uleb128 0x19
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xe7
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe8
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x4c
+	.uleb128 0xb
+	.uleb128 0x1d
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xea
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xeb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xec
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xed
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xee
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xef
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf0
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf1
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xf9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xfa
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xfb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xfc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xfd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xfe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xff
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x100
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x101
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x102
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS84:
+	.uleb128 0
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 0
+.LLST84:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL9-.LVL8
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL9-.LVL8
+	.uleb128 .LFE14514-.LVL8
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU78
+	.uleb128 .LVU113
+.LLST86:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU79
+	.uleb128 .LVU113
+.LLST88:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU80
+	.uleb128 .LVU84
+.LLST90:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU81
+	.uleb128 .LVU84
+.LLST91:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+.LLST92:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU83
+	.uleb128 .LVU84
+.LLST93:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU84
+	.uleb128 .LVU89
+.LLST94:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU86
+	.uleb128 .LVU89
+.LLST95:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU87
+	.uleb128 .LVU89
+.LLST96:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU88
+	.uleb128 .LVU89
+.LLST97:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU89
+	.uleb128 .LVU113
+.LLST99:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU89
+	.uleb128 .LVU113
+.LLST100:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU91
+	.uleb128 .LVU113
+.LLST102:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU91
+	.uleb128 .LVU113
+.LLST103:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU92
+	.uleb128 .LVU113
+.LLST105:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU92
+	.uleb128 .LVU113
+.LLST106:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU93
+	.uleb128 .LVU113
+.LLST108:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU93
+	.uleb128 .LVU113
+.LLST109:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU93
+	.uleb128 .LVU113
+.LLST110:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU94
+	.uleb128 .LVU101
+.LLST111:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU94
+	.uleb128 .LVU101
+.LLST112:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU95
+	.uleb128 .LVU101
+.LLST113:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU95
+	.uleb128 .LVU101
+.LLST114:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU96
+	.uleb128 .LVU101
+.LLST115:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU96
+	.uleb128 .LVU101
+.LLST116:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU97
+	.uleb128 .LVU99
+.LLST117:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+.LLST118:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU99
+	.uleb128 .LVU101
+.LLST119:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU104
+	.uleb128 .LVU113
+.LLST121:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU104
+	.uleb128 .LVU113
+.LLST122:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU105
+	.uleb128 .LVU113
+.LLST123:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU105
+	.uleb128 .LVU113
+.LLST124:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU106
+	.uleb128 .LVU113
+.LLST125:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU106
+	.uleb128 .LVU113
+.LLST126:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU107
+	.uleb128 .LVU113
+.LLST127:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU107
+	.uleb128 .LVU113
+.LLST128:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU107
+	.uleb128 .LVU113
+.LLST129:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU108
+	.uleb128 .LVU113
+.LLST131:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 0
+	.byte	0x6
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU108
+	.uleb128 .LVU113
+.LLST132:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 8
+	.byte	0x6
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU108
+	.uleb128 .LVU113
+.LLST133:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU45
+	.uleb128 .LVU75
+.LLST50:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL7-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU46
+	.uleb128 .LVU73
+.LLST52:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU47
+	.uleb128 .LVU51
+.LLST54:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU48
+	.uleb128 .LVU51
+.LLST55:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU49
+	.uleb128 .LVU51
+.LLST56:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU50
+	.uleb128 .LVU51
+.LLST57:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU51
+	.uleb128 .LVU56
+.LLST58:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU53
+	.uleb128 .LVU56
+.LLST59:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU54
+	.uleb128 .LVU56
+.LLST60:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU55
+	.uleb128 .LVU56
+.LLST61:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU56
+	.uleb128 .LVU73
+.LLST62:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU56
+	.uleb128 .LVU73
+.LLST63:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU58
+	.uleb128 .LVU73
+.LLST65:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU58
+	.uleb128 .LVU73
+.LLST66:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU59
+	.uleb128 .LVU73
+.LLST68:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU59
+	.uleb128 .LVU73
+.LLST69:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU60
+	.uleb128 .LVU73
+.LLST71:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU60
+	.uleb128 .LVU73
+.LLST72:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU61
+	.uleb128 .LVU68
+.LLST73:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU61
+	.uleb128 .LVU68
+.LLST74:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU62
+	.uleb128 .LVU68
+.LLST75:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU62
+	.uleb128 .LVU68
+.LLST76:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU63
+	.uleb128 .LVU68
+.LLST77:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU63
+	.uleb128 .LVU68
+.LLST78:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU64
+	.uleb128 .LVU66
+.LLST79:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU65
+	.uleb128 .LVU66
+.LLST80:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU66
+	.uleb128 .LVU68
+.LLST81:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+.LLST82:
+	.byte	0x8
+	.quad	.LVL6
+	.uleb128 .LVL6-.LVL6
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+.LLST83:
+	.byte	0x8
+	.quad	.LVL6
+	.uleb128 .LVL6-.LVL6
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0
+.LVUS134:
+	.uleb128 0
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 0
+.LLST134:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL19-.LVL11
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL19-.LVL11
+	.uleb128 .LFE14500-.LVL11
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS135:
+	.uleb128 0
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST135:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL14-.LVL11
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL14-.LVL11
+	.uleb128 .LFE14500-.LVL11
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU116
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST136:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL14-.LVL11
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL14-.LVL11
+	.uleb128 .LFE14500-.LVL11
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU116
+	.uleb128 0
+.LLST137:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LFE14500-.LVL11
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU116
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU144
+.LLST138:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL14-.LVL11
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL14-.LVL11
+	.uleb128 .LVL18-.LVL11
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU117
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU144
+.LLST141:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL14-.LVL11
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL14-.LVL11
+	.uleb128 .LVL18-.LVL11
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU118
+	.uleb128 .LVU123
+.LLST142:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU119
+	.uleb128 .LVU123
+.LLST143:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU120
+	.uleb128 .LVU123
+.LLST144:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU121
+	.uleb128 .LVU123
+.LLST145:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU123
+	.uleb128 .LVU129
+.LLST146:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU125
+	.uleb128 .LVU129
+.LLST147:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU126
+	.uleb128 .LVU129
+.LLST148:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU127
+	.uleb128 .LVU129
+.LLST149:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU129
+	.uleb128 .LVU144
+.LLST150:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL18-.LVL13
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU129
+	.uleb128 .LVU144
+.LLST151:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL18-.LVL13
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU131
+	.uleb128 .LVU144
+.LLST152:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL18-.LVL13
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS153:
+	.uleb128 .LVU131
+	.uleb128 .LVU144
+.LLST153:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL18-.LVL13
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU132
+	.uleb128 .LVU144
+.LLST154:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL18-.LVL13
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU132
+	.uleb128 .LVU144
+.LLST155:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL18-.LVL13
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU133
+	.uleb128 .LVU144
+.LLST156:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL18-.LVL13
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU133
+	.uleb128 .LVU144
+.LLST157:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL18-.LVL13
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU134
+	.uleb128 .LVU136
+.LLST158:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL15-.LVL13
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU136
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+.LLST160:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL16-.LVL15
+	.uleb128 .LVL17-.LVL15
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0
+.LVUS161:
+	.uleb128 .LVU136
+	.uleb128 .LVU141
+.LLST161:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL17-.LVL15
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+70781
+	.sleb128 0
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU137
+	.uleb128 .LVU141
+.LLST162:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL17-.LVL15
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU137
+	.uleb128 .LVU141
+.LLST163:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL17-.LVL15
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 0
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU137
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+.LLST164:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL16-.LVL15
+	.uleb128 .LVL17-.LVL15
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0
+.LVUS282:
+	.uleb128 .LVU256
+	.uleb128 .LVU264
+.LLST282:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72405
+	.sleb128 0
+	.byte	0
+.LVUS283:
+	.uleb128 .LVU256
+	.uleb128 .LVU264
+.LLST283:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72394
+	.sleb128 0
+	.byte	0
+.LVUS284:
+	.uleb128 .LVU257
+	.uleb128 .LVU264
+.LLST284:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72405
+	.sleb128 0
+	.byte	0
+.LVUS285:
+	.uleb128 .LVU257
+	.uleb128 .LVU264
+.LLST285:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72394
+	.sleb128 0
+	.byte	0
+.LVUS287:
+	.uleb128 .LVU258
+	.uleb128 .LVU264
+.LLST287:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72405
+	.sleb128 0
+	.byte	0
+.LVUS288:
+	.uleb128 .LVU258
+	.uleb128 .LVU264
+.LLST288:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72394
+	.sleb128 0
+	.byte	0
+.LVUS290:
+	.uleb128 .LVU259
+	.uleb128 .LVU264
+.LLST290:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72405
+	.sleb128 0
+	.byte	0
+.LVUS291:
+	.uleb128 .LVU259
+	.uleb128 .LVU264
+.LLST291:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72394
+	.sleb128 0
+	.byte	0
+.LVUS293:
+	.uleb128 .LVU260
+	.uleb128 .LVU262
+.LLST293:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72405
+	.sleb128 0
+	.byte	0
+.LVUS295:
+	.uleb128 .LVU261
+	.uleb128 .LVU262
+.LLST295:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72405
+	.sleb128 0
+	.byte	0
+.LVUS297:
+	.uleb128 .LVU262
+	.uleb128 .LVU264
+.LLST297:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72394
+	.sleb128 0
+	.byte	0
+.LVUS303:
+	.uleb128 .LVU269
+	.uleb128 .LVU273
+.LLST303:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72405
+	.sleb128 0
+	.byte	0
+.LVUS304:
+	.uleb128 .LVU269
+	.uleb128 .LVU273
+.LLST304:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72394
+	.sleb128 0
+	.byte	0
+.LVUS305:
+	.uleb128 .LVU270
+	.uleb128 .LVU273
+.LLST305:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72405
+	.sleb128 0
+	.byte	0
+.LVUS306:
+	.uleb128 .LVU270
+	.uleb128 .LVU273
+.LLST306:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72394
+	.sleb128 0
+	.byte	0
+.LVUS307:
+	.uleb128 .LVU271
+	.uleb128 .LVU273
+.LLST307:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72405
+	.sleb128 0
+	.byte	0
+.LVUS308:
+	.uleb128 .LVU271
+	.uleb128 .LVU273
+.LLST308:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+72394
+	.sleb128 0
+	.byte	0
+.LVUS309:
+	.uleb128 .LVU272
+	.uleb128 .LVU273
+.LLST309:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS310:
+	.uleb128 .LVU272
+	.uleb128 .LVU273
+.LLST310:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS252:
+	.uleb128 .LVU233
+	.uleb128 .LVU241
+.LLST252:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73326
+	.sleb128 0
+	.byte	0
+.LVUS253:
+	.uleb128 .LVU233
+	.uleb128 .LVU241
+.LLST253:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73315
+	.sleb128 0
+	.byte	0
+.LVUS254:
+	.uleb128 .LVU234
+	.uleb128 .LVU241
+.LLST254:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73326
+	.sleb128 0
+	.byte	0
+.LVUS255:
+	.uleb128 .LVU234
+	.uleb128 .LVU241
+.LLST255:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73315
+	.sleb128 0
+	.byte	0
+.LVUS257:
+	.uleb128 .LVU235
+	.uleb128 .LVU241
+.LLST257:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73326
+	.sleb128 0
+	.byte	0
+.LVUS258:
+	.uleb128 .LVU235
+	.uleb128 .LVU241
+.LLST258:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73315
+	.sleb128 0
+	.byte	0
+.LVUS260:
+	.uleb128 .LVU236
+	.uleb128 .LVU241
+.LLST260:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73326
+	.sleb128 0
+	.byte	0
+.LVUS261:
+	.uleb128 .LVU236
+	.uleb128 .LVU241
+.LLST261:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73315
+	.sleb128 0
+	.byte	0
+.LVUS263:
+	.uleb128 .LVU237
+	.uleb128 .LVU239
+.LLST263:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73326
+	.sleb128 0
+	.byte	0
+.LVUS265:
+	.uleb128 .LVU238
+	.uleb128 .LVU239
+.LLST265:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73326
+	.sleb128 0
+	.byte	0
+.LVUS267:
+	.uleb128 .LVU239
+	.uleb128 .LVU241
+.LLST267:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73315
+	.sleb128 0
+	.byte	0
+.LVUS274:
+	.uleb128 .LVU246
+	.uleb128 .LVU252
+.LLST274:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL34-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73326
+	.sleb128 0
+	.byte	0
+.LVUS275:
+	.uleb128 .LVU246
+	.uleb128 .LVU252
+.LLST275:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL34-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73315
+	.sleb128 0
+	.byte	0
+.LVUS276:
+	.uleb128 .LVU247
+	.uleb128 .LVU252
+.LLST276:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL34-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73326
+	.sleb128 0
+	.byte	0
+.LVUS277:
+	.uleb128 .LVU247
+	.uleb128 .LVU252
+.LLST277:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL34-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73315
+	.sleb128 0
+	.byte	0
+.LVUS278:
+	.uleb128 .LVU248
+	.uleb128 .LVU252
+.LLST278:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL34-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73326
+	.sleb128 0
+	.byte	0
+.LVUS279:
+	.uleb128 .LVU248
+	.uleb128 .LVU252
+.LLST279:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL34-.LVL32
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+73315
+	.sleb128 0
+	.byte	0
+.LVUS280:
+	.uleb128 .LVU251
+	.uleb128 .LVU252
+.LLST280:
+	.byte	0x8
+	.quad	.LVL34
+	.uleb128 .LVL34-.LVL34
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS281:
+	.uleb128 .LVU250
+	.uleb128 .LVU252
+.LLST281:
+	.byte	0x8
+	.quad	.LVL33
+	.uleb128 .LVL34-.LVL33
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS220:
+	.uleb128 .LVU208
+	.uleb128 .LVU218
+.LLST220:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74722
+	.sleb128 0
+	.byte	0
+.LVUS221:
+	.uleb128 .LVU208
+	.uleb128 .LVU218
+.LLST221:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74711
+	.sleb128 0
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU210
+	.uleb128 .LVU218
+.LLST224:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74722
+	.sleb128 0
+	.byte	0
+.LVUS225:
+	.uleb128 .LVU210
+	.uleb128 .LVU218
+.LLST225:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74711
+	.sleb128 0
+	.byte	0
+.LVUS227:
+	.uleb128 .LVU212
+	.uleb128 .LVU218
+.LLST227:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74722
+	.sleb128 0
+	.byte	0
+.LVUS228:
+	.uleb128 .LVU212
+	.uleb128 .LVU218
+.LLST228:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74711
+	.sleb128 0
+	.byte	0
+.LVUS230:
+	.uleb128 .LVU213
+	.uleb128 .LVU218
+.LLST230:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74722
+	.sleb128 0
+	.byte	0
+.LVUS231:
+	.uleb128 .LVU213
+	.uleb128 .LVU218
+.LLST231:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74711
+	.sleb128 0
+	.byte	0
+.LVUS233:
+	.uleb128 .LVU214
+	.uleb128 .LVU216
+.LLST233:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74722
+	.sleb128 0
+	.byte	0
+.LVUS235:
+	.uleb128 .LVU215
+	.uleb128 .LVU216
+.LLST235:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74722
+	.sleb128 0
+	.byte	0
+.LVUS237:
+	.uleb128 .LVU216
+	.uleb128 .LVU218
+.LLST237:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74711
+	.sleb128 0
+	.byte	0
+.LVUS244:
+	.uleb128 .LVU223
+	.uleb128 .LVU229
+.LLST244:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL31-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74722
+	.sleb128 0
+	.byte	0
+.LVUS245:
+	.uleb128 .LVU223
+	.uleb128 .LVU229
+.LLST245:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL31-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74711
+	.sleb128 0
+	.byte	0
+.LVUS246:
+	.uleb128 .LVU224
+	.uleb128 .LVU229
+.LLST246:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL31-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74722
+	.sleb128 0
+	.byte	0
+.LVUS247:
+	.uleb128 .LVU224
+	.uleb128 .LVU229
+.LLST247:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL31-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74711
+	.sleb128 0
+	.byte	0
+.LVUS248:
+	.uleb128 .LVU225
+	.uleb128 .LVU229
+.LLST248:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL31-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74722
+	.sleb128 0
+	.byte	0
+.LVUS249:
+	.uleb128 .LVU225
+	.uleb128 .LVU229
+.LLST249:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL31-.LVL29
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+74711
+	.sleb128 0
+	.byte	0
+.LVUS250:
+	.uleb128 .LVU228
+	.uleb128 .LVU229
+.LLST250:
+	.byte	0x8
+	.quad	.LVL31
+	.uleb128 .LVL31-.LVL31
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS251:
+	.uleb128 .LVU227
+	.uleb128 .LVU229
+.LLST251:
+	.byte	0x8
+	.quad	.LVL30
+	.uleb128 .LVL31-.LVL30
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS217:
+	.uleb128 .LVU203
+	.uleb128 .LVU204
+.LLST217:
+	.byte	0x8
+	.quad	.LVL28
+	.uleb128 .LVL28-.LVL28
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU202
+	.uleb128 .LVU204
+.LLST218:
+	.byte	0x8
+	.quad	.LVL27
+	.uleb128 .LVL28-.LVL27
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU187
+	.uleb128 .LVU197
+.LLST210:
+	.byte	0x8
+	.quad	.LVL24
+	.uleb128 .LVL25-.LVL24
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS213:
+	.uleb128 .LVU189
+	.uleb128 .LVU197
+.LLST213:
+	.byte	0x8
+	.quad	.LVL24
+	.uleb128 .LVL25-.LVL24
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS215:
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+.LLST215:
+	.byte	0x8
+	.quad	.LVL24
+	.uleb128 .LVL24-.LVL24
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+.LLST216:
+	.byte	0x8
+	.quad	.LVL24
+	.uleb128 .LVL24-.LVL24
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU157
+	.uleb128 .LVU167
+.LLST169:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76264
+	.sleb128 0
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU157
+	.uleb128 .LVU167
+.LLST170:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76253
+	.sleb128 0
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU159
+	.uleb128 .LVU167
+.LLST173:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76264
+	.sleb128 0
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU159
+	.uleb128 .LVU167
+.LLST174:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76253
+	.sleb128 0
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU161
+	.uleb128 .LVU167
+.LLST176:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76264
+	.sleb128 0
+	.byte	0
+.LVUS177:
+	.uleb128 .LVU161
+	.uleb128 .LVU167
+.LLST177:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76253
+	.sleb128 0
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU162
+	.uleb128 .LVU167
+.LLST179:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76264
+	.sleb128 0
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU162
+	.uleb128 .LVU167
+.LLST180:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76253
+	.sleb128 0
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU163
+	.uleb128 .LVU165
+.LLST182:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76264
+	.sleb128 0
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU164
+	.uleb128 .LVU165
+.LLST184:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76264
+	.sleb128 0
+	.byte	0
+.LVUS186:
+	.uleb128 .LVU165
+	.uleb128 .LVU167
+.LLST186:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76253
+	.sleb128 0
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU167
+	.uleb128 .LVU179
+.LLST189:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU169
+	.uleb128 .LVU179
+.LLST192:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU172
+	.uleb128 .LVU179
+.LLST195:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76264
+	.sleb128 0
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU172
+	.uleb128 .LVU179
+.LLST196:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76253
+	.sleb128 0
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU173
+	.uleb128 .LVU179
+.LLST197:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76264
+	.sleb128 0
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU173
+	.uleb128 .LVU179
+.LLST198:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76253
+	.sleb128 0
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU174
+	.uleb128 .LVU179
+.LLST199:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76264
+	.sleb128 0
+	.byte	0
+.LVUS200:
+	.uleb128 .LVU174
+	.uleb128 .LVU179
+.LLST200:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+76253
+	.sleb128 0
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU175
+	.uleb128 .LVU179
+.LLST201:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU175
+	.uleb128 .LVU179
+.LLST202:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS203:
+	.uleb128 .LVU175
+	.uleb128 .LVU179
+.LLST203:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU149
+	.uleb128 .LVU153
+.LLST166:
+	.byte	0x8
+	.quad	.LVL20
+	.uleb128 .LVL21-.LVL20
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU149
+	.uleb128 .LVU153
+.LLST167:
+	.byte	0x8
+	.quad	.LVL20
+	.uleb128 .LVL21-.LVL20
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU149
+	.uleb128 .LVU153
+.LLST168:
+	.byte	0x8
+	.quad	.LVL20
+	.uleb128 .LVL21-.LVL20
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU1
+	.uleb128 .LVU20
+.LLST0:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU2
+	.uleb128 .LVU18
+.LLST2:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU3
+	.uleb128 .LVU7
+.LLST4:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU4
+	.uleb128 .LVU7
+.LLST5:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU5
+	.uleb128 .LVU7
+.LLST6:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU6
+	.uleb128 .LVU7
+.LLST7:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU7
+	.uleb128 .LVU12
+.LLST8:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU9
+	.uleb128 .LVU12
+.LLST9:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU10
+	.uleb128 .LVU12
+.LLST10:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU11
+	.uleb128 .LVU12
+.LLST11:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU12
+	.uleb128 .LVU18
+.LLST12:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU12
+	.uleb128 .LVU18
+.LLST13:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU14
+	.uleb128 .LVU18
+.LLST15:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU14
+	.uleb128 .LVU18
+.LLST16:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU15
+	.uleb128 .LVU18
+.LLST18:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU15
+	.uleb128 .LVU18
+.LLST19:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU17
+	.uleb128 .LVU18
+.LLST21:
+	.byte	0x8
+	.quad	.LVL1
+	.uleb128 .LVL1-.LVL1
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU17
+	.uleb128 .LVU18
+.LLST22:
+	.byte	0x8
+	.quad	.LVL1
+	.uleb128 .LVL1-.LVL1
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU23
+	.uleb128 .LVU42
+.LLST24:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU24
+	.uleb128 .LVU42
+.LLST26:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU25
+	.uleb128 .LVU29
+.LLST28:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL3-.LVL3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU26
+	.uleb128 .LVU29
+.LLST29:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL3-.LVL3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU27
+	.uleb128 .LVU29
+.LLST30:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL3-.LVL3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU28
+	.uleb128 .LVU29
+.LLST31:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL3-.LVL3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU29
+	.uleb128 .LVU34
+.LLST32:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL3-.LVL3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU31
+	.uleb128 .LVU34
+.LLST33:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL3-.LVL3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU32
+	.uleb128 .LVU34
+.LLST34:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL3-.LVL3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU33
+	.uleb128 .LVU34
+.LLST35:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL3-.LVL3
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU34
+	.uleb128 .LVU42
+.LLST37:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU34
+	.uleb128 .LVU42
+.LLST38:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU36
+	.uleb128 .LVU42
+.LLST40:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU36
+	.uleb128 .LVU42
+.LLST41:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU37
+	.uleb128 .LVU42
+.LLST43:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU37
+	.uleb128 .LVU42
+.LLST44:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU38
+	.uleb128 .LVU42
+.LLST47:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 0
+	.byte	0x6
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU38
+	.uleb128 .LVU42
+.LLST48:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 8
+	.byte	0x6
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU38
+	.uleb128 .LVU42
+.LLST49:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x7c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	.LFB14484
+	.quad	.LFE14484-.LFB14484
+	.quad	.LFB14493
+	.quad	.LFE14493-.LFB14493
+	.quad	.LFB14507
+	.quad	.LFE14507-.LFB14507
+	.quad	.LFB14514
+	.quad	.LFE14514-.LFB14514
+	.quad	.LFB14500
+	.quad	.LFE14500-.LFB14500
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL23:
+	.byte	0x5
+	.quad	.LBB1127
+	.byte	0x4
+	.uleb128 .LBB1127-.LBB1127
+	.uleb128 .LBE1127-.LBB1127
+	.byte	0x4
+	.uleb128 .LBB1153-.LBB1127
+	.uleb128 .LBE1153-.LBB1127
+	.byte	0
+.LLRL36:
+	.byte	0x5
+	.quad	.LBB1138
+	.byte	0x4
+	.uleb128 .LBB1138-.LBB1138
+	.uleb128 .LBE1138-.LBB1138
+	.byte	0x4
+	.uleb128 .LBB1150-.LBB1138
+	.uleb128 .LBE1150-.LBB1138
+	.byte	0
+.LLRL46:
+	.byte	0x5
+	.quad	.LBB1143
+	.byte	0x4
+	.uleb128 .LBB1143-.LBB1143
+	.uleb128 .LBE1143-.LBB1143
+	.byte	0x4
+	.uleb128 .LBB1145-.LBB1143
+	.uleb128 .LBE1145-.LBB1143
+	.byte	0
+.LLRL85:
+	.byte	0x5
+	.quad	.LBB1182
+	.byte	0x4
+	.uleb128 .LBB1182-.LBB1182
+	.uleb128 .LBE1182-.LBB1182
+	.byte	0x4
+	.uleb128 .LBB1240-.LBB1182
+	.uleb128 .LBE1240-.LBB1182
+	.byte	0
+.LLRL98:
+	.byte	0x5
+	.quad	.LBB1194
+	.byte	0x4
+	.uleb128 .LBB1194-.LBB1194
+	.uleb128 .LBE1194-.LBB1194
+	.byte	0x4
+	.uleb128 .LBB1236-.LBB1194
+	.uleb128 .LBE1236-.LBB1194
+	.byte	0
+.LLRL120:
+	.byte	0x5
+	.quad	.LBB1207
+	.byte	0x4
+	.uleb128 .LBB1207-.LBB1207
+	.uleb128 .LBE1207-.LBB1207
+	.byte	0x4
+	.uleb128 .LBB1229-.LBB1207
+	.uleb128 .LBE1229-.LBB1207
+	.byte	0
+.LLRL130:
+	.byte	0x5
+	.quad	.LBB1217
+	.byte	0x4
+	.uleb128 .LBB1217-.LBB1217
+	.uleb128 .LBE1217-.LBB1217
+	.byte	0x4
+	.uleb128 .LBB1219-.LBB1217
+	.uleb128 .LBE1219-.LBB1217
+	.byte	0
+.LLRL159:
+	.byte	0x5
+	.quad	.LBB1314
+	.byte	0x4
+	.uleb128 .LBB1314-.LBB1314
+	.uleb128 .LBE1314-.LBB1314
+	.byte	0x4
+	.uleb128 .LBB1321-.LBB1314
+	.uleb128 .LBE1321-.LBB1314
+	.byte	0
+.LLRL165:
+	.byte	0x5
+	.quad	.LBB1322
+	.byte	0x4
+	.uleb128 .LBB1322-.LBB1322
+	.uleb128 .LBE1322-.LBB1322
+	.byte	0x4
+	.uleb128 .LBB1325-.LBB1322
+	.uleb128 .LBE1325-.LBB1322
+	.byte	0
+.LLRL188:
+	.byte	0x5
+	.quad	.LBB1373
+	.byte	0x4
+	.uleb128 .LBB1373-.LBB1373
+	.uleb128 .LBE1373-.LBB1373
+	.byte	0x4
+	.uleb128 .LBB1398-.LBB1373
+	.uleb128 .LBE1398-.LBB1373
+	.byte	0
+.LLRL209:
+	.byte	0x5
+	.quad	.LBB1415
+	.byte	0x4
+	.uleb128 .LBB1415-.LBB1415
+	.uleb128 .LBE1415-.LBB1415
+	.byte	0x4
+	.uleb128 .LBB1423-.LBB1415
+	.uleb128 .LBE1423-.LBB1415
+	.byte	0
+.LLRL239:
+	.byte	0x5
+	.quad	.LBB1470
+	.byte	0x4
+	.uleb128 .LBB1470-.LBB1470
+	.uleb128 .LBE1470-.LBB1470
+	.byte	0x4
+	.uleb128 .LBB1490-.LBB1470
+	.uleb128 .LBE1490-.LBB1470
+	.byte	0
+.LLRL269:
+	.byte	0x5
+	.quad	.LBB1498
+	.byte	0x4
+	.uleb128 .LBB1498-.LBB1498
+	.uleb128 .LBE1498-.LBB1498
+	.byte	0x4
+	.uleb128 .LBB1518-.LBB1498
+	.uleb128 .LBE1518-.LBB1498
+	.byte	0
+.LLRL311:
+	.byte	0x7
+	.quad	.Ltext0
+	.uleb128 .Letext0-.Ltext0
+	.byte	0x7
+	.quad	.LFB14484
+	.uleb128 .LFE14484-.LFB14484
+	.byte	0x7
+	.quad	.LFB14493
+	.uleb128 .LFE14493-.LFB14493
+	.byte	0x7
+	.quad	.LFB14507
+	.uleb128 .LFE14507-.LFB14507
+	.byte	0x7
+	.quad	.LFB14514
+	.uleb128 .LFE14514-.LFB14514
+	.byte	0x7
+	.quad	.LFB14500
+	.uleb128 .LFE14500-.LFB14500
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF2259:
+	.string	"_ZNK4xstd13ctor_args_forI5PointJRlS2_EEcvS1_Ev"
+.LASF317:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSERKS4_"
+.LASF145:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5emptyEv"
+.LASF693:
+	.string	"_ZNSt13__atomic_baseImE8exchangeEmSt12memory_order"
+.LASF706:
+	.string	"_ZNSt13__atomic_baseImE9fetch_addEmSt12memory_order"
+.LASF1434:
+	.string	"long long int"
+.LASF1491:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEixEl"
+.LASF1896:
+	.string	"FLOW_LIMITER_NODE"
+.LASF1962:
+	.string	"_ZN3tbb6detail2d112wait_context7reserveEj"
+.LASF184:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findES2_m"
+.LASF1749:
+	.string	"positive_sign"
+.LASF1976:
+	.string	"concurrent_wait"
+.LASF1189:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<int*, std::vector<int, std::allocator<int> > > >"
+.LASF2332:
+	.string	"erased_emplace"
+.LASF2015:
+	.string	"_ZN3tbb6detail2d118task_group_contextD4Ev"
+.LASF421:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4swapERS4_"
+.LASF1837:
+	.string	"gmtime"
+.LASF1568:
+	.string	"mbstowcs"
+.LASF423:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5c_strEv"
+.LASF2255:
+	.string	"ctor_args_for"
+.LASF550:
+	.string	"wait"
+.LASF1426:
+	.string	"long unsigned int"
+.LASF698:
+	.string	"_ZNVSt13__atomic_baseImE21compare_exchange_weakERmmSt12memory_order"
+.LASF2204:
+	.string	"this_task_arena"
+.LASF1131:
+	.string	"_ZNKSt6vectorIiSaIiEEixEm"
+.LASF1126:
+	.string	"_ZNSt6vectorIiSaIiEE13shrink_to_fitEv"
+.LASF697:
+	.string	"_ZNSt13__atomic_baseImE21compare_exchange_weakERmmSt12memory_order"
+.LASF132:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6rbeginEv"
+.LASF1577:
+	.string	"strtoul"
+.LASF228:
+	.string	"select_on_container_copy_construction"
+.LASF609:
+	.string	"_ZNSt13__atomic_baseIjEmIEj"
+.LASF1674:
+	.string	"getwchar"
+.LASF1325:
+	.string	"_ZNSt5tupleIJRlS0_EEaSERKS1_"
+.LASF1588:
+	.string	"__pstl"
+.LASF2041:
+	.string	"_ZN3tbb6detail2d122cache_aligned_resource17correct_alignmentEm"
+.LASF1549:
+	.string	"clock_t"
+.LASF205:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofEcm"
+.LASF485:
+	.string	"consume"
+.LASF919:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEE10notify_oneEv"
+.LASF285:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_S_copyEPcPKcm"
+.LASF2027:
+	.string	"cache_aligned_resource"
+.LASF1821:
+	.string	"tmpfile"
+.LASF1601:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy19__allow_unsequencedEv"
+.LASF899:
+	.string	"_ZNVKSt6atomicIN3tbb6detail2d118task_group_context5stateEEcvS4_Ev"
+.LASF472:
+	.string	"initializer_list"
+.LASF1659:
+	.string	"_freeres_buf"
+.LASF259:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_M_set_lengthEm"
+.LASF2164:
+	.string	"is_final_scan"
+.LASF343:
+	.string	"shrink_to_fit"
+.LASF1936:
+	.string	"NUM_STRINGS"
+.LASF1062:
+	.string	"_ZNSt12_Vector_baseIiSaIiEEC4Em"
+.LASF721:
+	.string	"_ZNVSt6atomicImEaSERKS0_"
+.LASF475:
+	.string	"_ZNKSt16initializer_listIcE4sizeEv"
+.LASF1388:
+	.string	"_ZSt32uses_allocator_construction_argsI5PointNSt3pmr21polymorphic_allocatorISt4byteEEJRlS5_EEDaRKT0_DpOT1_"
+.LASF2304:
+	.string	"__args#0"
+.LASF2305:
+	.string	"__args#1"
+.LASF1060:
+	.string	"_ZNSt12_Vector_baseIiSaIiEEC4Ev"
+.LASF441:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofEPKcmm"
+.LASF2334:
+	.string	"_ZN5PointC2Ell"
+.LASF339:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8max_sizeEv"
+.LASF1145:
+	.string	"_ZNSt6vectorIiSaIiEE6insertEN9__gnu_cxx17__normal_iteratorIPKiS1_EERS4_"
+.LASF487:
+	.string	"release"
+.LASF2033:
+	.string	"_ZNK3tbb6detail2d122cache_aligned_resource17upstream_resourceEv"
+.LASF2113:
+	.string	"_ZNK3tbb6detail2d115task_arena_base20max_threads_per_coreEv"
+.LASF2260:
+	.string	"forward_args"
+.LASF1865:
+	.string	"my_right"
+.LASF90:
+	.string	"_ZNSt11char_traitsIcE7not_eofERKi"
+.LASF630:
+	.string	"_ZNVSt13__atomic_baseIjE23compare_exchange_strongERjjSt12memory_orderS2_"
+.LASF216:
+	.string	"_M_str"
+.LASF335:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7crbeginEv"
+.LASF254:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_M_local_dataEv"
+.LASF2315:
+	.string	"_ZN4xstd9ctor_argsI5PointLm40EE3bufC2Ev"
+.LASF446:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofEPKcm"
+.LASF265:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_disposeEv"
+.LASF435:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindEcm"
+.LASF1023:
+	.string	"allocator<int>"
+.LASF835:
+	.string	"_ZNSt10_Head_baseILm0EPN3tbb6detail2d216task_handle_taskELb0EEC4ESt15allocator_arg_tSt13__uses_alloc0"
+.LASF2296:
+	.string	"arg_pack"
+.LASF528:
+	.string	"is_lock_free"
+.LASF1036:
+	.string	"_Vector_base<int, std::allocator<int> >"
+.LASF135:
+	.string	"crbegin"
+.LASF1612:
+	.string	"__unseq_backend"
+.LASF590:
+	.string	"_ZNSt13__atomic_baseIjEC4ERKS0_"
+.LASF1941:
+	.string	"small_object_pool"
+.LASF1788:
+	.string	"uintptr_t"
+.LASF1009:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE23compare_exchange_strongERS4_S4_St12memory_order"
+.LASF846:
+	.string	"_ZNSt11_Tuple_implILm0EJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEEC4ERKS4_RKS6_"
+.LASF252:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_M_dataEv"
+.LASF1278:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEE10notify_allEv"
+.LASF303:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4Ev"
+.LASF1604:
+	.string	"unsequenced_policy"
+.LASF147:
+	.string	"operator[]"
+.LASF1322:
+	.string	"_ZNSt5tupleIJRlS0_EE31__nothrow_default_constructibleEv"
+.LASF422:
+	.string	"c_str"
+.LASF1358:
+	.string	"_ZSt3getILm0EJRlS0_EEONSt13tuple_elementIXT_ESt5tupleIJDpT0_EEE4typeEOS5_"
+.LASF662:
+	.string	"_ZNVSt13__atomic_baseImEaSERKS0_"
+.LASF589:
+	.string	"_ZNSt13__atomic_baseIjED4Ev"
+.LASF287:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_S_moveEPcPKcm"
+.LASF1509:
+	.string	"__normal_iterator<int*, std::vector<int, std::allocator<int> > >"
+.LASF564:
+	.string	"_ZNVSt13__atomic_baseIhE9fetch_andEhSt12memory_order"
+.LASF208:
+	.string	"find_last_not_of"
+.LASF150:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE2atEm"
+.LASF670:
+	.string	"_ZNVSt13__atomic_baseImEppEi"
+.LASF26:
+	.string	"__cmp_cust"
+.LASF2340:
+	.string	"_ZNSt11char_traitsIcE3eofEv"
+.LASF817:
+	.string	"_Idx"
+.LASF315:
+	.string	"~basic_string"
+.LASF1304:
+	.string	"_ZNSt10_Head_baseILm0ERlLb0EEC4ES0_"
+.LASF674:
+	.string	"_ZNVSt13__atomic_baseImEppEv"
+.LASF1740:
+	.string	"lconv"
+.LASF1160:
+	.string	"_ZNSt6vectorIiSaIiEE14_M_fill_insertEN9__gnu_cxx17__normal_iteratorIPiS1_EEmRKi"
+.LASF1279:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEE9fetch_addElSt12memory_order"
+.LASF436:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofERKS4_m"
+.LASF295:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcPKcS7_"
+.LASF1899:
+	.string	"FLOW_PRIORITY_QUEUE_NODE"
+.LASF1231:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r15arenaEE10notify_allEv"
+.LASF1142:
+	.string	"_ZNSt6vectorIiSaIiEE9push_backERKi"
+.LASF1831:
+	.string	"clock"
+.LASF1823:
+	.string	"ungetc"
+.LASF1850:
+	.string	"memory_order"
+.LASF1485:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEdeEv"
+.LASF1115:
+	.string	"_ZNKSt6vectorIiSaIiEE6rbeginEv"
+.LASF1375:
+	.string	"__invoke<xstd::ctor_args<Point>::emplace_value_using_allocator<long int&, long int&>(void*, void const*, const alloc_t&)::<lambda(auto:23&& ...)>, long int&, long int&>"
+.LASF913:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d118task_group_context5stateEE21compare_exchange_weakERS4_S4_St12memory_order"
+.LASF2057:
+	.string	"_ZN3tbb6detail2d14task7executeERNS1_14execution_dataE"
+.LASF19:
+	.string	"__cust_iswap"
+.LASF623:
+	.string	"_ZNSt13__atomic_baseIjE8exchangeEjSt12memory_order"
+.LASF686:
+	.string	"_ZNVSt13__atomic_baseImEeOEm"
+.LASF237:
+	.string	"_M_allocated_capacity"
+.LASF1411:
+	.string	"__apply_impl<xstd::ctor_args<Point>::emplace_n_value<long int&, long int&>(void*, size_t, void const*)::<lambda(long int&, long int&)>, const std::tuple<long int&, long int&>&, 0, 1>"
+.LASF23:
+	.string	"__platform_wait_alignment"
+.LASF243:
+	.string	"__sv_wrapper"
+.LASF2068:
+	.string	"internal_run_and_wait"
+.LASF1542:
+	.string	"__intmax_t"
+.LASF812:
+	.string	"_ZNSt10_Head_baseILm1EN3tbb6detail2d211task_handle28task_handle_task_finalizer_tELb1EEC4ESt15allocator_arg_tSt13__uses_alloc0"
+.LASF273:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16_M_get_allocatorEv"
+.LASF1033:
+	.string	"_ZNSt16allocator_traitsISaIiEE10deallocateERS0_Pim"
+.LASF2289:
+	.string	"__storage"
+.LASF1843:
+	.string	"no_assign"
+.LASF525:
+	.string	"operator^="
+.LASF1743:
+	.string	"grouping"
+.LASF1063:
+	.string	"_ZNSt12_Vector_baseIiSaIiEEC4EmRKS0_"
+.LASF1690:
+	.string	"__isoc99_vswscanf"
+.LASF781:
+	.string	"_ZNSt3pmr21polymorphic_allocatorISt4byteE14allocate_bytesEmm"
+.LASF863:
+	.string	"_ZNSt15__uniq_ptr_dataIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tELb1ELb1EEC4EOS6_"
+.LASF2069:
+	.string	"_ZN3tbb6detail2d115task_group_base21internal_run_and_waitEONS0_2d211task_handleE"
+.LASF2331:
+	.string	"lazy_emplace"
+.LASF1016:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE9fetch_subElSt12memory_order"
+.LASF1021:
+	.string	"_ZNSt15__new_allocatorIiE10deallocateEPim"
+.LASF1467:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEv"
+.LASF818:
+	.string	"_Head"
+.LASF1683:
+	.string	"__isoc99_swscanf"
+.LASF786:
+	.string	"_ZNKSt3pmr21polymorphic_allocatorISt4byteE8resourceEv"
+.LASF2171:
+	.string	"resume"
+.LASF971:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEC4Ev"
+.LASF521:
+	.string	"_ZNVSt13__atomic_baseIhEaNEh"
+.LASF734:
+	.string	"filesystem"
+.LASF447:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofEcm"
+.LASF733:
+	.string	"chrono_literals"
+.LASF560:
+	.string	"_ZNSt13__atomic_baseIhE9fetch_subEhSt12memory_order"
+.LASF581:
+	.string	"_ZNSt6atomicIhEC4Eh"
+.LASF215:
+	.string	"_M_len"
+.LASF575:
+	.string	"_ZNSt6atomicIhEC4Ev"
+.LASF65:
+	.string	"execution"
+.LASF2325:
+	.string	"__a1"
+.LASF2326:
+	.string	"__a2"
+.LASF1002:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE21compare_exchange_weakERS4_S4_St12memory_orderS7_"
+.LASF1232:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEE9fetch_addElSt12memory_order"
+.LASF444:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofERKS4_m"
+.LASF1777:
+	.string	"uint_least32_t"
+.LASF91:
+	.string	"_CharT"
+.LASF1614:
+	.string	"__lane_size"
+.LASF2100:
+	.string	"high"
+.LASF48:
+	.string	"_ZNKSt15__exception_ptr13exception_ptr6_M_getEv"
+.LASF681:
+	.string	"_ZNSt13__atomic_baseImEaNEm"
+.LASF67:
+	.string	"assign"
+.LASF302:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8_M_eraseEmm"
+.LASF1048:
+	.string	"_Vector_impl"
+.LASF1121:
+	.string	"_ZNKSt6vectorIiSaIiEE5crendEv"
+.LASF1769:
+	.string	"uint32_t"
+.LASF751:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d013do_once_stateEEaSES3_"
+.LASF2207:
+	.string	"__par_backend"
+.LASF2035:
+	.string	"_ZN3tbb6detail2d122cache_aligned_resource13do_deallocateEPvmm"
+.LASF836:
+	.string	"_ZNSt10_Head_baseILm0EPN3tbb6detail2d216task_handle_taskELb0EE7_M_headERS5_"
+.LASF1413:
+	.string	"apply<xstd::ctor_args<Point>::emplace_value<long int&, long int&>(void*, void const*)::<lambda(auto:21&& ...)>, const std::tuple<long int&, long int&>&>"
+.LASF907:
+	.string	"_ZNVKSt6atomicIN3tbb6detail2d118task_group_context5stateEE4loadESt12memory_order"
+.LASF10:
+	.string	"_ZNKSt17integral_constantIbLb1EEcvbEv"
+.LASF77:
+	.string	"move"
+.LASF1810:
+	.string	"fseek"
+.LASF357:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE2atEm"
+.LASF1943:
+	.string	"small_object_allocator"
+.LASF1099:
+	.string	"_ZNSt6vectorIiSaIiEEC4EOS1_RKS0_St17integral_constantIbLb1EE"
+.LASF2189:
+	.string	"_ZN3tbb6detail2d211task_handleC4Ev"
+.LASF1711:
+	.string	"tm_zone"
+.LASF1385:
+	.string	"make_obj_using_allocator<Point, std::pmr::polymorphic_allocator<>, long int&, long int&>"
+.LASF939:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEmmEi"
+.LASF2043:
+	.string	"_ZN3tbb6detail2d122cache_aligned_resource12correct_sizeEm"
+.LASF853:
+	.string	"__nothrow_default_constructible"
+.LASF954:
+	.string	"_ZNVKSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE4loadESt12memory_order"
+.LASF943:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEmmEv"
+.LASF754:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEE5storeES3_St12memory_order"
+.LASF2265:
+	.string	"Point"
+.LASF1882:
+	.string	"PARALLEL_INVOKE"
+.LASF1713:
+	.string	"wcsncat"
+.LASF1061:
+	.string	"_ZNSt12_Vector_baseIiSaIiEEC4ERKS0_"
+.LASF179:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE9ends_withEPKc"
+.LASF1934:
+	.string	"FLOW_TASKS"
+.LASF256:
+	.string	"_M_capacity"
+.LASF292:
+	.string	"iterator"
+.LASF21:
+	.string	"__detail"
+.LASF1074:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE13_M_deallocateEPim"
+.LASF1511:
+	.string	"long double"
+.LASF1487:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEv"
+.LASF2111:
+	.string	"_ZNK3tbb6detail2d115task_arena_base9core_typeEv"
+.LASF950:
+	.string	"_ZNVKSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE12is_lock_freeEv"
+.LASF175:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE11starts_withEPKc"
+.LASF197:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofEPKcm"
+.LASF1371:
+	.string	"__invoke_impl<Point, xstd::ctor_args_for<Point, long int&, long int&>::operator()() const::<lambda(auto:24&& ...)>, long int&, long int&>"
+.LASF500:
+	.string	"_ZNKSt13__atomic_baseIhEcvhEv"
+.LASF1957:
+	.string	"_ZNK3tbb6detail2d112wait_context18continue_executionEv"
+.LASF1900:
+	.string	"FLOW_QUEUE_NODE"
+.LASF325:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5beginEv"
+.LASF783:
+	.string	"_ZNSt3pmr21polymorphic_allocatorISt4byteE16deallocate_bytesEPvmm"
+.LASF918:
+	.string	"_ZNKSt6atomicIN3tbb6detail2d118task_group_context5stateEE4waitES4_St12memory_order"
+.LASF1815:
+	.string	"perror"
+.LASF1797:
+	.string	"_IO_wide_data"
+.LASF568:
+	.string	"fetch_xor"
+.LASF299:
+	.string	"_M_mutate"
+.LASF873:
+	.string	"_ZNSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEaSEDn"
+.LASF1418:
+	.string	"_ZSt5applyIZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS5_EEES2_PKvEUlDpOT_E_RKSt5tupleIJS5_S5_EEEDcOT_OT0_"
+.LASF1665:
+	.string	"fgetwc"
+.LASF1867:
+	.string	"bad_alloc"
+.LASF1064:
+	.string	"_ZNSt12_Vector_baseIiSaIiEEC4EOS1_"
+.LASF1218:
+	.string	"_ZNVKSt13__atomic_baseIPN3tbb6detail2r15arenaEE12is_lock_freeEv"
+.LASF2126:
+	.string	"_ZN3tbb6detail2d110task_arenaC4ERKS2_"
+.LASF1666:
+	.string	"fgetws"
+.LASF1775:
+	.string	"uint_least8_t"
+.LASF428:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findEPKcmm"
+.LASF2076:
+	.string	"_ZN3tbb6detail2d115task_group_base6cancelEv"
+.LASF338:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6lengthEv"
+.LASF209:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofES2_m"
+.LASF731:
+	.string	"__cxx11"
+.LASF856:
+	.string	"_ZNSt5tupleIJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEEC4EOS7_"
+.LASF1066:
+	.string	"_ZNSt12_Vector_baseIiSaIiEEC4EOS1_RKS0_"
+.LASF1324:
+	.string	"_ZNSt5tupleIJRlS0_EEC4EOS1_"
+.LASF300:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_mutateEmmPKcm"
+.LASF1779:
+	.string	"int_fast8_t"
+.LASF1848:
+	.string	"_ZN3tbb6detail2d07no_copyC4ERKS2_"
+.LASF318:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSEPKc"
+.LASF777:
+	.string	"_ZNSt3pmr21polymorphic_allocatorISt4byteEaSERKS2_"
+.LASF35:
+	.string	"__debug"
+.LASF600:
+	.string	"_ZNVSt13__atomic_baseIjEppEi"
+.LASF116:
+	.string	"basic_string_view"
+.LASF2252:
+	.string	"_Dummy"
+.LASF146:
+	.string	"const_reference"
+.LASF2309:
+	.string	"_ZZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS4_EEES1_PKvENUlDpOT_E_D4Ev"
+.LASF604:
+	.string	"_ZNVSt13__atomic_baseIjEppEv"
+.LASF2026:
+	.string	"task_alignment"
+.LASF2241:
+	.string	"_ZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS4_EEES1_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEE"
+.LASF898:
+	.string	"_ZNKSt6atomicIN3tbb6detail2d118task_group_context5stateEEcvS4_Ev"
+.LASF585:
+	.string	"_ZNSt13__atomic_baseIhE12_S_alignmentE"
+.LASF1359:
+	.string	"construct_at<Point, long int&, long int&>"
+.LASF51:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EDn"
+.LASF2001:
+	.string	"my_name"
+.LASF924:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE12_M_type_sizeEl"
+.LASF2247:
+	.string	"_ZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS4_EEES1_PKv"
+.LASF2004:
+	.string	"_ZN3tbb6detail2d118task_group_contextC4EPS2_"
+.LASF341:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6resizeEmc"
+.LASF756:
+	.string	"_ZNKSt6atomicIN3tbb6detail2d013do_once_stateEE4loadESt12memory_order"
+.LASF1794:
+	.string	"__fpos_t"
+.LASF1520:
+	.string	"5div_t"
+.LASF1425:
+	.string	"bool"
+.LASF2248:
+	.string	"construct_at<lazy_emplace(void*, long int, long int)::<lambda()>, lazy_emplace(void*, long int, long int)::<lambda()> >"
+.LASF814:
+	.string	"_ZNSt10_Head_baseILm1EN3tbb6detail2d211task_handle28task_handle_task_finalizer_tELb1EE7_M_headERS5_"
+.LASF1089:
+	.string	"_S_relocate"
+.LASF1967:
+	.string	"affinity_slot"
+.LASF2271:
+	.string	"__fn"
+.LASF133:
+	.string	"rend"
+.LASF607:
+	.string	"_ZNSt13__atomic_baseIjEpLEj"
+.LASF1042:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE17_Vector_impl_dataC4EOS2_"
+.LASF16:
+	.string	"ranges"
+.LASF1071:
+	.string	"_M_allocate"
+.LASF2179:
+	.string	"context_list"
+.LASF1680:
+	.string	"putwchar"
+.LASF1423:
+	.string	"__apply_impl<xstd::ctor_args_for<Point, long int&, long int&>::operator()() const::<lambda(auto:24&& ...)>, const std::tuple<long int&, long int&>&, 0, 1>"
+.LASF508:
+	.string	"_ZNSt13__atomic_baseIhEmmEi"
+.LASF1135:
+	.string	"_ZNKSt6vectorIiSaIiEE2atEm"
+.LASF411:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_NS6_IPcS4_EESB_"
+.LASF512:
+	.string	"_ZNSt13__atomic_baseIhEmmEv"
+.LASF1539:
+	.string	"__uint_least32_t"
+.LASF480:
+	.string	"string"
+.LASF1935:
+	.string	"USER_EVENT"
+.LASF2353:
+	.string	"_ZN4xstd9ctor_argsI5PointLm40EE3bufC4Ev"
+.LASF616:
+	.string	"_ZNVSt13__atomic_baseIjEeOEj"
+.LASF632:
+	.string	"_ZNVSt13__atomic_baseIjE23compare_exchange_strongERjjSt12memory_order"
+.LASF278:
+	.string	"_M_check_length"
+.LASF843:
+	.string	"_ZNSt11_Tuple_implILm0EJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEE7_M_tailERS7_"
+.LASF1959:
+	.string	"_ZN3tbb6detail2d112wait_contextC4ERKS2_"
+.LASF139:
+	.string	"size"
+.LASF393:
+	.string	"erase"
+.LASF134:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4rendEv"
+.LASF1939:
+	.string	"emit"
+.LASF625:
+	.string	"_ZNSt13__atomic_baseIjE21compare_exchange_weakERjjSt12memory_orderS2_"
+.LASF537:
+	.string	"exchange"
+.LASF1039:
+	.string	"_M_finish"
+.LASF848:
+	.string	"_ZNSt11_Tuple_implILm0EJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEEaSERKS7_"
+.LASF558:
+	.string	"_ZNVSt13__atomic_baseIhE9fetch_addEhSt12memory_order"
+.LASF2102:
+	.string	"my_initialization_state"
+.LASF1598:
+	.string	"_ZN6__pstl9execution2v115parallel_policy14__allow_vectorEv"
+.LASF828:
+	.string	"_M_swap"
+.LASF611:
+	.string	"_ZNSt13__atomic_baseIjEaNEj"
+.LASF1483:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4Ev"
+.LASF366:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLESt16initializer_listIcE"
+.LASF2273:
+	.string	"first"
+.LASF1070:
+	.string	"_M_impl"
+.LASF187:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findEPKcm"
+.LASF219:
+	.string	"allocator_traits<std::allocator<char> >"
+.LASF2153:
+	.string	"_ZN3tbb6detail2d125affinity_partitioner_baseD4Ev"
+.LASF213:
+	.string	"_S_compare"
+.LASF439:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofEcm"
+.LASF1880:
+	.string	"PARALLEL_FOR"
+.LASF1570:
+	.string	"quick_exit"
+.LASF1702:
+	.string	"tm_min"
+.LASF1907:
+	.string	"FLOW_ASYNC_NODE"
+.LASF1745:
+	.string	"currency_symbol"
+.LASF1669:
+	.string	"fwide"
+.LASF1561:
+	.string	"atof"
+.LASF353:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEixEm"
+.LASF1562:
+	.string	"atoi"
+.LASF1563:
+	.string	"atol"
+.LASF283:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11_M_disjunctEPKc"
+.LASF1014:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE9fetch_addElSt12memory_order"
+.LASF382:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignESt16initializer_listIcE"
+.LASF1147:
+	.string	"_ZNSt6vectorIiSaIiEE6insertEN9__gnu_cxx17__normal_iteratorIPKiS1_EESt16initializer_listIiE"
+.LASF437:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofEPKcmm"
+.LASF1446:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE10_S_on_swapERS1_S3_"
+.LASF2155:
+	.string	"auto_partitioner"
+.LASF1242:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEEC4ES4_"
+.LASF1662:
+	.string	"_unused2"
+.LASF1138:
+	.string	"_ZNSt6vectorIiSaIiEE4backEv"
+.LASF1124:
+	.string	"_ZNSt6vectorIiSaIiEE6resizeEm"
+.LASF465:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8containsESt17basic_string_viewIcS2_E"
+.LASF2293:
+	.string	"_ZZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS4_EEES1_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEEENUlDpOT_E_D4Ev"
+.LASF13:
+	.string	"size_t"
+.LASF1152:
+	.string	"_ZNSt6vectorIiSaIiEE5clearEv"
+.LASF983:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEppEi"
+.LASF1992:
+	.string	"my_traits"
+.LASF331:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4rendEv"
+.LASF107:
+	.string	"operator bool"
+.LASF2047:
+	.string	"my_prev_node"
+.LASF987:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEppEv"
+.LASF1143:
+	.string	"_ZNSt6vectorIiSaIiEE9push_backEOi"
+.LASF945:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEpLEl"
+.LASF1731:
+	.string	"__isoc99_wscanf"
+.LASF1901:
+	.string	"FLOW_SEQUENCER_NODE"
+.LASF2208:
+	.string	"xstd"
+.LASF1409:
+	.string	"apply<xstd::ctor_args<Point>::emplace_n_value<long int&, long int&>(void*, size_t, void const*)::<lambda(long int&, long int&)>, const std::tuple<long int&, long int&>&>"
+.LASF1401:
+	.string	"apply<xstd::ctor_args<Point>::emplace_value_using_allocator<long int&, long int&>(void*, void const*, const alloc_t&)::<lambda(auto:23&& ...)>, const std::tuple<long int&, long int&>&>"
+.LASF2099:
+	.string	"normal"
+.LASF240:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17_S_to_string_viewESt17basic_string_viewIcS2_E"
+.LASF64:
+	.string	"nullptr_t"
+.LASF397:
+	.string	"pop_back"
+.LASF1937:
+	.string	"event"
+.LASF1550:
+	.string	"time_t"
+.LASF1940:
+	.string	"_ZN3tbb6detail2d15event4emitEv"
+.LASF1944:
+	.string	"m_pool"
+.LASF126:
+	.string	"cbegin"
+.LASF1782:
+	.string	"int_fast64_t"
+.LASF424:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4dataEv"
+.LASF2129:
+	.string	"initialize"
+.LASF203:
+	.string	"find_first_not_of"
+.LASF272:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16_M_get_allocatorEv"
+.LASF651:
+	.string	"_ZNVSt6atomicIjEaSERKS0_"
+.LASF1661:
+	.string	"_mode"
+.LASF1556:
+	.string	"tv_sec"
+.LASF2285:
+	.string	"this"
+.LASF1341:
+	.string	"_ZSt12__get_helperILm1ERlJEERT0_RSt11_Tuple_implIXT_EJS1_DpT1_EE"
+.LASF963:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE10notify_allEv"
+.LASF1243:
+	.string	"operator std::atomic<tbb::detail::r1::arena*>::__pointer_type"
+.LASF548:
+	.string	"_ZNSt13__atomic_baseIhE23compare_exchange_strongERhhSt12memory_order"
+.LASF687:
+	.string	"_ZNKSt13__atomic_baseImE12is_lock_freeEv"
+.LASF2148:
+	.string	"affinity_partitioner_base"
+.LASF2080:
+	.string	"run_and_wait"
+.LASF1073:
+	.string	"_M_deallocate"
+.LASF1579:
+	.string	"wcstombs"
+.LASF108:
+	.string	"_ZNKSt15__exception_ptr13exception_ptrcvbEv"
+.LASF1215:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEEmIEl"
+.LASF493:
+	.string	"~__atomic_base"
+.LASF2116:
+	.string	"automatic"
+.LASF464:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9ends_withEPKc"
+.LASF912:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEE21compare_exchange_weakERS4_S4_St12memory_order"
+.LASF4:
+	.string	"_ZNKSt17integral_constantIbLb0EEcvbEv"
+.LASF1151:
+	.string	"_ZNSt6vectorIiSaIiEE4swapERS1_"
+.LASF605:
+	.string	"_ZNSt13__atomic_baseIjEmmEv"
+.LASF592:
+	.string	"_ZNVSt13__atomic_baseIjEaSERKS0_"
+.LASF1616:
+	.string	"__tbb_backend"
+.LASF1543:
+	.string	"__uintmax_t"
+.LASF2178:
+	.string	"tbb_exception_ptr"
+.LASF2312:
+	.string	"_ZZNK4xstd13ctor_args_forI5PointJRlS2_EEclEvENUlDpOT_E_D4Ev"
+.LASF2135:
+	.string	"terminate"
+.LASF888:
+	.string	"_ZNSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEaSERKS6_"
+.LASF167:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmS2_"
+.LASF2061:
+	.string	"task_group_status"
+.LASF1392:
+	.string	"_ZSt8__invokeIZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS5_EEEPS2_PvPKvEUlDpOT_E_JS5_S5_EENSt15__invoke_resultIT_JDpT0_EE4typeEOSF_DpOSG_"
+.LASF1102:
+	.string	"_ZNSt6vectorIiSaIiEEC4ESt16initializer_listIiERKS0_"
+.LASF1103:
+	.string	"~vector"
+.LASF737:
+	.string	"atomic<tbb::detail::d0::do_once_state>"
+.LASF40:
+	.string	"_M_exception_object"
+.LASF1220:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEE5storeES4_St12memory_order"
+.LASF1887:
+	.string	"CUSTOM_CTX"
+.LASF917:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d118task_group_context5stateEE23compare_exchange_strongERS4_S4_St12memory_order"
+.LASF1672:
+	.string	"__isoc99_fwscanf"
+.LASF37:
+	.string	"true_type"
+.LASF1684:
+	.string	"ungetwc"
+.LASF413:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_St16initializer_listIcE"
+.LASF1763:
+	.string	"int_p_sign_posn"
+.LASF2067:
+	.string	"m_context"
+.LASF1518:
+	.string	"quot"
+.LASF136:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7crbeginEv"
+.LASF1337:
+	.string	"__invoke_impl<Point*, std::uninitialized_construct_using_allocator<Point, pmr::polymorphic_allocator<>, long int&, long int&>(Point*, const pmr::polymorphic_allocator<>&, long int&, long int&)::<lambda(auto:18&& ...)>, long int&, long int&>"
+.LASF1627:
+	.string	"__wchb"
+.LASF50:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4ERKS0_"
+.LASF1399:
+	.string	"construct_at<std::tuple<long int&, long int&>, long int&, long int&>"
+.LASF1240:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEEaSERKS5_"
+.LASF555:
+	.string	"_ZNSt13__atomic_baseIhE10notify_allEv"
+.LASF1908:
+	.string	"FLOW_INPUT_PORT"
+.LASF80:
+	.string	"_ZNSt11char_traitsIcE4copyEPcPKcm"
+.LASF1040:
+	.string	"_M_end_of_storage"
+.LASF1933:
+	.string	"FLOW_NODE"
+.LASF746:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEEC4ES3_"
+.LASF1705:
+	.string	"tm_mon"
+.LASF1503:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIiEiE27_S_propagate_on_copy_assignEv"
+.LASF1994:
+	.string	"_ZN3tbb6detail2d118task_group_context17may_have_childrenE"
+.LASF1828:
+	.string	"towctrans"
+.LASF1991:
+	.string	"my_version"
+.LASF2181:
+	.string	"submit"
+.LASF1001:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE8exchangeES4_St12memory_order"
+.LASF2060:
+	.string	"_Lock_policy"
+.LASF620:
+	.string	"_ZNVSt13__atomic_baseIjE5storeEjSt12memory_order"
+.LASF793:
+	.string	"_ZNSt15__uniq_ptr_implIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEC4EOS6_"
+.LASF1282:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEE9fetch_subElSt12memory_order"
+.LASF117:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4Ev"
+.LASF738:
+	.string	"_S_min_alignment"
+.LASF635:
+	.string	"_ZNSt13__atomic_baseIjE10notify_allEv"
+.LASF1007:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE23compare_exchange_strongERS4_S4_St12memory_orderS7_"
+.LASF1195:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEED4Ev"
+.LASF536:
+	.string	"_ZNVKSt13__atomic_baseIhE4loadESt12memory_order"
+.LASF633:
+	.string	"_ZNKSt13__atomic_baseIjE4waitEjSt12memory_order"
+.LASF1945:
+	.string	"slot_id"
+.LASF1462:
+	.string	"__normal_iterator"
+.LASF1950:
+	.string	"overflow_mask"
+.LASF2034:
+	.string	"do_deallocate"
+.LASF763:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d013do_once_stateEE21compare_exchange_weakERS3_S3_St12memory_order"
+.LASF344:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13shrink_to_fitEv"
+.LASF514:
+	.string	"_ZNSt13__atomic_baseIhEpLEh"
+.LASF1027:
+	.string	"_ZNSaIiED4Ev"
+.LASF118:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4ERKS2_"
+.LASF39:
+	.string	"_M_a"
+.LASF970:
+	.string	"_M_b"
+.LASF2282:
+	.string	"alloc"
+.LASF587:
+	.string	"_M_i"
+.LASF471:
+	.string	"_M_array"
+.LASF2194:
+	.string	"_ZN3tbb6detail2d211task_handle7releaseEv"
+.LASF235:
+	.string	"_M_p"
+.LASF759:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d013do_once_stateEE8exchangeES3_St12memory_order"
+.LASF1514:
+	.string	"__int128"
+.LASF2150:
+	.string	"my_size"
+.LASF1474:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEplEl"
+.LASF1440:
+	.string	"__ops"
+.LASF1955:
+	.string	"_ZN3tbb6detail2d112wait_context13add_referenceEl"
+.LASF1784:
+	.string	"uint_fast16_t"
+.LASF2221:
+	.string	"_ZNK4xstd9ctor_argsI5PointLm40EEclEv"
+.LASF1288:
+	.string	"_ZNSt10_Head_baseILm1ERlLb0EEC4ERKS1_"
+.LASF2351:
+	.string	"priority"
+.LASF230:
+	.string	"rebind_alloc"
+.LASF1527:
+	.string	"__uint8_t"
+.LASF1703:
+	.string	"tm_hour"
+.LASF770:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEE10notify_allEv"
+.LASF1404:
+	.string	"_ZSt12__apply_implIZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS5_EEEPS2_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEEEUlDpOT_E_RKSt5tupleIJS5_S5_EEJLm0ELm1EEEDcOT_OT0_St16integer_sequenceImJXspT1_EEE"
+.LASF2128:
+	.string	"_ZN3tbb6detail2d110task_arenaC4ENS1_6attachE"
+.LASF1974:
+	.string	"context_traits"
+.LASF1338:
+	.string	"_ZSt13__invoke_implIP5PointZSt39uninitialized_construct_using_allocatorIS0_NSt3pmr21polymorphic_allocatorISt4byteEEJRlS7_EEPT_S9_RKT0_DpOT1_EUlDpOT_E_JS7_S7_EES8_St14__invoke_otherOSA_SF_"
+.LASF2152:
+	.string	"~affinity_partitioner_base"
+.LASF1172:
+	.string	"_ZNSt6vectorIiSaIiEE17_S_check_init_lenEmRKS0_"
+.LASF1421:
+	.string	"apply<xstd::ctor_args_for<Point, long int&, long int&>::operator()() const::<lambda(auto:24&& ...)>, const std::tuple<long int&, long int&>&>"
+.LASF892:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEED4Ev"
+.LASF78:
+	.string	"_ZNSt11char_traitsIcE4moveEPcPKcm"
+.LASF1348:
+	.string	"_Tuple"
+.LASF2272:
+	.string	"__location"
+.LASF276:
+	.string	"_M_check"
+.LASF1790:
+	.string	"uintmax_t"
+.LASF395:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5eraseEN9__gnu_cxx17__normal_iteratorIPKcS4_EE"
+.LASF1652:
+	.string	"_vtable_offset"
+.LASF1344:
+	.string	"_Args"
+.LASF1555:
+	.string	"timespec"
+.LASF1357:
+	.string	"get<0, long int&, long int&>"
+.LASF806:
+	.string	"_Head_base<1, tbb::detail::d2::task_handle::task_handle_task_finalizer_t, true>"
+.LASF1025:
+	.string	"_ZNSaIiEC4ERKS_"
+.LASF2091:
+	.string	"max_concurrency"
+.LASF176:
+	.string	"ends_with"
+.LASF982:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEppEi"
+.LASF664:
+	.string	"operator std::__atomic_base<long unsigned int>::__int_type"
+.LASF999:
+	.string	"_ZNVKSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE4loadESt12memory_order"
+.LASF277:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8_M_checkEmPKc"
+.LASF986:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEppEv"
+.LASF42:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EPv"
+.LASF1559:
+	.string	"atexit"
+.LASF1455:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE15_S_always_equalEv"
+.LASF1196:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEEC4ERKS5_"
+.LASF1326:
+	.string	"_ZNSt5tupleIJRlS0_EEaSEOS1_"
+.LASF1501:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIiEiE17_S_select_on_copyERKS1_"
+.LASF1221:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r15arenaEE4loadESt12memory_order"
+.LASF965:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE9fetch_addElSt12memory_order"
+.LASF1334:
+	.string	"__success_type<Point*>"
+.LASF1508:
+	.string	"rebind<int>"
+.LASF533:
+	.string	"_ZNVSt13__atomic_baseIhE5storeEhSt12memory_order"
+.LASF709:
+	.string	"_ZNVSt13__atomic_baseImE9fetch_subEmSt12memory_order"
+.LASF710:
+	.string	"_ZNSt13__atomic_baseImE9fetch_andEmSt12memory_order"
+.LASF622:
+	.string	"_ZNVKSt13__atomic_baseIjE4loadESt12memory_order"
+.LASF2045:
+	.string	"~cache_aligned_resource"
+.LASF495:
+	.string	"_ZNSt13__atomic_baseIhEC4ERKS0_"
+.LASF1876:
+	.string	"bad_tagged_msg_cast"
+.LASF326:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE3endEv"
+.LASF852:
+	.string	"tuple<tbb::detail::d2::task_handle_task*, tbb::detail::d2::task_handle::task_handle_task_finalizer_t>"
+.LASF1080:
+	.string	"_S_nothrow_relocate"
+.LASF193:
+	.string	"find_first_of"
+.LASF858:
+	.string	"_ZNSt5tupleIJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEEaSEOS7_"
+.LASF2051:
+	.string	"_ZN3tbb6detail2d14taskC4Ev"
+.LASF567:
+	.string	"_ZNVSt13__atomic_baseIhE8fetch_orEhSt12memory_order"
+.LASF138:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5crendEv"
+.LASF356:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE2atEm"
+.LASF401:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmRKS4_mm"
+.LASF1162:
+	.string	"_ZNSt6vectorIiSaIiEE17_M_default_appendEm"
+.LASF1238:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEED4Ev"
+.LASF1569:
+	.string	"mbtowc"
+.LASF1038:
+	.string	"_M_start"
+.LASF274:
+	.string	"_M_use_local_data"
+.LASF2095:
+	.string	"default_concurrency"
+.LASF1566:
+	.string	"ldiv"
+.LASF2182:
+	.string	"_ZN3tbb6detail2r16submitERNS0_2d14taskERNS2_18task_group_contextEPNS1_5arenaEm"
+.LASF8:
+	.string	"value_type"
+.LASF1708:
+	.string	"tm_yday"
+.LASF140:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4sizeEv"
+.LASF1860:
+	.string	"right"
+.LASF1948:
+	.string	"atomic<tbb::detail::d1::task_group_context::state>"
+.LASF2159:
+	.string	"static_partitioner"
+.LASF1807:
+	.string	"fopen"
+.LASF2335:
+	.string	"operator delete"
+.LASF44:
+	.string	"_M_release"
+.LASF1897:
+	.string	"FLOW_MULTIFUNCTION_NODE"
+.LASF1554:
+	.string	"int64_t"
+.LASF1328:
+	.string	"tuple<>"
+.LASF368:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendERKS4_"
+.LASF1697:
+	.string	"wcscoll"
+.LASF1312:
+	.string	"_ZNSt11_Tuple_implILm0EJRlS0_EE7_M_headERKS1_"
+.LASF2147:
+	.string	"_ZN3tbb6detail2d17enqueueEONS0_2d211task_handleE"
+.LASF1193:
+	.string	"_ZNVKSt13__atomic_baseIPN3tbb6detail2r15arenaEE12_M_type_sizeEl"
+.LASF1082:
+	.string	"_ZNSt6vectorIiSaIiEE19_S_nothrow_relocateESt17integral_constantIbLb0EE"
+.LASF1438:
+	.string	"char32_t"
+.LASF2190:
+	.string	"_ZN3tbb6detail2d211task_handleC4EOS2_"
+.LASF972:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEED4Ev"
+.LASF1535:
+	.string	"__uint_least8_t"
+.LASF2023:
+	.string	"traits"
+.LASF490:
+	.string	"__int_type"
+.LASF673:
+	.string	"_ZNSt13__atomic_baseImEppEv"
+.LASF214:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE10_S_compareEmm"
+.LASF284:
+	.string	"_S_copy"
+.LASF1871:
+	.string	"out_of_range"
+.LASF25:
+	.string	"__atomic_spin_count"
+.LASF459:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11starts_withESt17basic_string_viewIcS2_E"
+.LASF672:
+	.string	"_ZNVSt13__atomic_baseImEmmEi"
+.LASF1104:
+	.string	"_ZNSt6vectorIiSaIiEED4Ev"
+.LASF569:
+	.string	"_ZNSt13__atomic_baseIhE9fetch_xorEhSt12memory_order"
+.LASF1011:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE10notify_oneEv"
+.LASF2056:
+	.string	"cancel"
+.LASF676:
+	.string	"_ZNVSt13__atomic_baseImEmmEv"
+.LASF975:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEaSERKS5_"
+.LASF788:
+	.string	"__uniq_ptr_impl<tbb::detail::d2::task_handle_task, tbb::detail::d2::task_handle::task_handle_task_finalizer_t>"
+.LASF758:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEE8exchangeES3_St12memory_order"
+.LASF1634:
+	.string	"_flags"
+.LASF1855:
+	.string	"initialized"
+.LASF502:
+	.string	"_ZNSt13__atomic_baseIhEaSEh"
+.LASF1752:
+	.string	"frac_digits"
+.LASF1013:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE9fetch_addElSt12memory_order"
+.LASF717:
+	.string	"_ZNSt6atomicImEC4Ev"
+.LASF352:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5emptyEv"
+.LASF1350:
+	.string	"__invoke_impl<Point*, xstd::ctor_args<Point>::emplace_value_using_allocator<long int&, long int&>(void*, void const*, const alloc_t&)::<lambda(auto:23&& ...)>, long int&, long int&>"
+.LASF1717:
+	.string	"wcsspn"
+.LASF2025:
+	.string	"task_traits"
+.LASF661:
+	.string	"_ZNSt13__atomic_baseImEaSERKS0_"
+.LASF288:
+	.string	"_S_assign"
+.LASF1960:
+	.string	"~wait_context"
+.LASF1512:
+	.string	"double"
+.LASF895:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d118task_group_context5stateEEaSERKS5_"
+.LASF1479:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEE4baseEv"
+.LASF1416:
+	.string	"_ZSt12__apply_implIZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS5_EEEPS2_PvPKvEUlDpOT_E_RKSt5tupleIJS5_S5_EEJLm0ELm1EEEDcOT_OT0_St16integer_sequenceImJXspT1_EEE"
+.LASF2256:
+	.string	"_ZN4xstd13ctor_args_forI5PointJRlS2_EEC4ES2_S2_"
+.LASF869:
+	.string	"~unique_ptr"
+.LASF1068:
+	.string	"~_Vector_base"
+.LASF1830:
+	.string	"wctype"
+.LASF1376:
+	.string	"_ZSt8__invokeIZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS5_EEEPS2_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEEEUlDpOT_E_JS5_S5_EENSt15__invoke_resultIT_JDpT0_EE4typeEOSL_DpOSM_"
+.LASF2277:
+	.string	"operator()<long int&, long int&>"
+.LASF2119:
+	.string	"_ZN3tbb6detail2d115task_arena_base15not_initializedE"
+.LASF2313:
+	.string	"_ZZNK4xstd13ctor_args_forI5PointJRlS2_EEclEvENKUlDpOT_E_clIJS2_S2_EEEDaS6_"
+.LASF1644:
+	.string	"_IO_backup_base"
+.LASF1977:
+	.string	"reserved1"
+.LASF1978:
+	.string	"reserved2"
+.LASF1979:
+	.string	"reserved3"
+.LASF1980:
+	.string	"reserved4"
+.LASF1981:
+	.string	"reserved5"
+.LASF1470:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEi"
+.LASF811:
+	.string	"_ZNSt10_Head_baseILm1EN3tbb6detail2d211task_handle28task_handle_task_finalizer_tELb1EEC4EOS5_"
+.LASF920:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEE10notify_allEv"
+.LASF1436:
+	.string	"char8_t"
+.LASF880:
+	.string	"get_deleter"
+.LASF1400:
+	.string	"_ZSt12construct_atISt5tupleIJRlS1_EEJS1_S1_EEDTgsnwcvPvLi0E_T_pispcl7declvalIT0_EEEEPS4_DpOS5_"
+.LASF1560:
+	.string	"at_quick_exit"
+.LASF1903:
+	.string	"FLOW_SPLIT_NODE"
+.LASF211:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofEPKcmm"
+.LASF1630:
+	.string	"__mbstate_t"
+.LASF1046:
+	.string	"_ZNSt13__uses_alloc05_SinkaSEPKv"
+.LASF663:
+	.string	"_ZNSt13__atomic_baseImEC4Em"
+.LASF1302:
+	.string	"_Head_base<0, long int&, false>"
+.LASF224:
+	.string	"const_void_pointer"
+.LASF768:
+	.string	"_ZNKSt6atomicIN3tbb6detail2d013do_once_stateEE4waitES3_St12memory_order"
+.LASF1625:
+	.string	"11__mbstate_t"
+.LASF2264:
+	.string	"_ZN4xstd14make_ctor_argsI5PointJRlS2_EEENS_13ctor_args_forIT_JDpT0_EEEDpOS5_"
+.LASF1237:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEEC4Ev"
+.LASF1834:
+	.string	"time"
+.LASF578:
+	.string	"_ZNSt6atomicIhEC4ERKS0_"
+.LASF17:
+	.string	"__cust_swap"
+.LASF34:
+	.string	"_Sink"
+.LASF330:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6rbeginEv"
+.LASF68:
+	.string	"char_type"
+.LASF1813:
+	.string	"getc"
+.LASF1321:
+	.string	"tuple<long int&, long int&>"
+.LASF1615:
+	.string	"__utils"
+.LASF129:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4cendEv"
+.LASF626:
+	.string	"_ZNVSt13__atomic_baseIjE21compare_exchange_weakERjjSt12memory_orderS2_"
+.LASF584:
+	.string	"_S_alignment"
+.LASF1997:
+	.string	"my_context_list"
+.LASF1762:
+	.string	"int_n_sep_by_space"
+.LASF11:
+	.string	"_ZNKSt17integral_constantIbLb1EEclEv"
+.LASF1313:
+	.string	"_ZNSt11_Tuple_implILm0EJRlS0_EE7_M_tailERS1_"
+.LASF741:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEEC4Ev"
+.LASF279:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE15_M_check_lengthEmmPKc"
+.LASF152:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5frontEv"
+.LASF1444:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE17_S_select_on_copyERKS1_"
+.LASF2149:
+	.string	"my_array"
+.LASF2278:
+	.string	"_ZZSt39uninitialized_construct_using_allocatorI5PointNSt3pmr21polymorphic_allocatorISt4byteEEJRlS5_EEPT_S7_RKT0_DpOT1_ENUlDpOT_E_D4Ev"
+.LASF2145:
+	.string	"_ZN3tbb6detail2d120current_thread_indexEv"
+.LASF241:
+	.string	"basic_string"
+.LASF1297:
+	.string	"_ZNSt11_Tuple_implILm1EJRlEEC4ES0_"
+.LASF966:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE9fetch_subElSt12memory_order"
+.LASF1636:
+	.string	"_IO_read_end"
+.LASF374:
+	.string	"push_back"
+.LASF890:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEE12_S_alignmentE"
+.LASF1245:
+	.string	"_ZNVKSt6atomicIPN3tbb6detail2r15arenaEEcvS4_Ev"
+.LASF1091:
+	.string	"vector"
+.LASF740:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEE12_S_alignmentE"
+.LASF1522:
+	.string	"ldiv_t"
+.LASF2310:
+	.string	"_ZZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS4_EEES1_PKvENKUlDpOT_E_clIJS4_S4_EEEDaS9_"
+.LASF805:
+	.string	"_M_t"
+.LASF18:
+	.string	"__cust_imove"
+.LASF1970:
+	.string	"isolated"
+.LASF1398:
+	.string	"_ZSt3getILm0EJRlS0_EERKNSt13tuple_elementIXT_ESt5tupleIJDpT0_EEE4typeERKS5_"
+.LASF168:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmS2_mm"
+.LASF2158:
+	.string	"_ZN3tbb6detail2d118simple_partitionerC4Ev"
+.LASF1643:
+	.string	"_IO_save_base"
+.LASF529:
+	.string	"_ZNKSt13__atomic_baseIhE12is_lock_freeEv"
+.LASF2276:
+	.string	"____p"
+.LASF2215:
+	.string	"emplace_n_into"
+.LASF1448:
+	.string	"_ZNSt16integer_sequenceImJLm0ELm1EEE4sizeEv"
+.LASF257:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11_M_capacityEm"
+.LASF582:
+	.string	"__integral_type"
+.LASF2093:
+	.string	"numa_nodes"
+.LASF1613:
+	.string	"__default_lock_policy"
+.LASF827:
+	.string	"_ZNSt11_Tuple_implILm1EJN3tbb6detail2d211task_handle28task_handle_task_finalizer_tEEEC4EOS5_"
+.LASF1265:
+	.string	"_ZNVKSt6atomicIPN3tbb6detail2r15arenaEE4loadESt12memory_order"
+.LASF928:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEC4ERKS5_"
+.LASF1424:
+	.string	"_ZSt12__apply_implIZNK4xstd13ctor_args_forI5PointJRlS3_EEclEvEUlDpOT_E_RKSt5tupleIJS3_S3_EEJLm0ELm1EEEDcOT_OT0_St16integer_sequenceImJXspT1_EEE"
+.LASF1111:
+	.string	"_ZNKSt6vectorIiSaIiEE5beginEv"
+.LASF1378:
+	.string	"_ZSt39uninitialized_construct_using_allocatorI5PointNSt3pmr21polymorphic_allocatorISt4byteEEJRlS5_EEPT_S7_RKT0_DpOT1_"
+.LASF794:
+	.string	"_ZNSt15__uniq_ptr_implIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEaSEOS6_"
+.LASF74:
+	.string	"_ZNSt11char_traitsIcE6lengthEPKc"
+.LASF802:
+	.string	"_ZNSt15__uniq_ptr_implIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE5resetEPS3_"
+.LASF535:
+	.string	"_ZNKSt13__atomic_baseIhE4loadESt12memory_order"
+.LASF618:
+	.string	"_ZNVKSt13__atomic_baseIjE12is_lock_freeEv"
+.LASF1747:
+	.string	"mon_thousands_sep"
+.LASF323:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEcvSt17basic_string_viewIcS2_EEv"
+.LASF148:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEEixEm"
+.LASF1365:
+	.string	"__invoke_impl<Point*, xstd::ctor_args<Point>::emplace_n_value<long int&, long int&>(void*, size_t, void const*)::<lambda(long int&, long int&)>, long int&, long int&>"
+.LASF720:
+	.string	"_ZNSt6atomicImEaSERKS0_"
+.LASF2154:
+	.string	"_ZN3tbb6detail2d125affinity_partitioner_base6resizeEj"
+.LASF93:
+	.string	"__new_allocator<char>"
+.LASF1331:
+	.string	"difference_type"
+.LASF1379:
+	.string	"apply<std::uninitialized_construct_using_allocator<Point, pmr::polymorphic_allocator<>, long int&, long int&>(Point*, const pmr::polymorphic_allocator<>&, long int&, long int&)::<lambda(auto:18&& ...)>, std::tuple<long int&, long int&> >"
+.LASF522:
+	.string	"operator|="
+.LASF1395:
+	.string	"__invoke<xstd::ctor_args_for<Point, long int&, long int&>::operator()() const::<lambda(auto:24&& ...)>, long int&, long int&>"
+.LASF1113:
+	.string	"_ZNKSt6vectorIiSaIiEE3endEv"
+.LASF2082:
+	.string	"is_current_task_group_canceling"
+.LASF250:
+	.string	"_M_length"
+.LASF1694:
+	.string	"wcrtomb"
+.LASF547:
+	.string	"_ZNVSt13__atomic_baseIhE23compare_exchange_strongERhhSt12memory_orderS2_"
+.LASF307:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_mm"
+.LASF602:
+	.string	"_ZNVSt13__atomic_baseIjEmmEi"
+.LASF202:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofEPKcm"
+.LASF2074:
+	.string	"_ZN3tbb6detail2d115task_group_baseD4Ev"
+.LASF2225:
+	.string	"_ZNK4xstd9ctor_argsI5PointLm40EE12emplace_intoEPvRKNSt3pmr21polymorphic_allocatorISt4byteEE"
+.LASF2238:
+	.string	"_ZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS4_EEEPS1_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEE"
+.LASF606:
+	.string	"_ZNVSt13__atomic_baseIjEmmEv"
+.LASF223:
+	.string	"_ZNSt16allocator_traitsISaIcEE8allocateERS0_mPKv"
+.LASF82:
+	.string	"to_char_type"
+.LASF69:
+	.string	"_ZNSt11char_traitsIcE2eqERKcS2_"
+.LASF641:
+	.string	"_ZNVSt13__atomic_baseIjE9fetch_andEjSt12memory_order"
+.LASF2198:
+	.string	"finalize"
+.LASF2131:
+	.string	"_ZN3tbb6detail2d110task_arena10initializeEijNS1_15task_arena_base8priorityE"
+.LASF743:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEEC4ERKS4_"
+.LASF1641:
+	.string	"_IO_buf_base"
+.LASF1076:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE17_M_create_storageEm"
+.LASF1354:
+	.string	"_Callable"
+.LASF2274:
+	.string	"make"
+.LASF1204:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEEaSES4_"
+.LASF1891:
+	.string	"FLOW_CONTINUE_NODE"
+.LASF816:
+	.string	"_M_head_impl"
+.LASF1655:
+	.string	"_offset"
+.LASF732:
+	.string	"literals"
+.LASF1529:
+	.string	"__uint16_t"
+.LASF1811:
+	.string	"fsetpos"
+.LASF1026:
+	.string	"_ZNSaIiEaSERKS_"
+.LASF524:
+	.string	"_ZNVSt13__atomic_baseIhEoREh"
+.LASF233:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_Alloc_hiderC4EPcRKS3_"
+.LASF1125:
+	.string	"_ZNSt6vectorIiSaIiEE6resizeEmRKi"
+.LASF593:
+	.string	"_ZNSt13__atomic_baseIjEC4Ej"
+.LASF2079:
+	.string	"_ZN3tbb6detail2d110task_groupC4ERNS1_18task_group_contextE"
+.LASF588:
+	.string	"_ZNSt13__atomic_baseIjEC4Ev"
+.LASF1996:
+	.string	"my_state"
+.LASF1117:
+	.string	"_ZNKSt6vectorIiSaIiEE4rendEv"
+.LASF2201:
+	.string	"~task_handle_task"
+.LASF1271:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEE21compare_exchange_weakERS4_S4_St12memory_order"
+.LASF1969:
+	.string	"kind_type"
+.LASF1298:
+	.string	"_ZNSt11_Tuple_implILm1EJRlEEC4ERKS1_"
+.LASF2040:
+	.string	"correct_alignment"
+.LASF2037:
+	.string	"do_is_equal"
+.LASF1808:
+	.string	"fread"
+.LASF1352:
+	.string	"__invoke<std::uninitialized_construct_using_allocator<Point, pmr::polymorphic_allocator<>, long int&, long int&>(Point*, const pmr::polymorphic_allocator<>&, long int&, long int&)::<lambda(auto:18&& ...)>, long int&, long int&>"
+.LASF621:
+	.string	"_ZNKSt13__atomic_baseIjE4loadESt12memory_order"
+.LASF2281:
+	.string	"storage"
+.LASF678:
+	.string	"_ZNVSt13__atomic_baseImEpLEm"
+.LASF222:
+	.string	"allocator_type"
+.LASF1809:
+	.string	"freopen"
+.LASF2236:
+	.string	"lazy_value<lazy_emplace(void*, long int, long int)::<lambda()> >"
+.LASF2268:
+	.string	"_ZN4xstd9ctor_argsI5PointLm40EE8pack_opsIJRlS4_EEE"
+.LASF47:
+	.string	"_M_get"
+.LASF1770:
+	.string	"uint64_t"
+.LASF683:
+	.string	"_ZNSt13__atomic_baseImEoREm"
+.LASF264:
+	.string	"_M_dispose"
+.LASF1675:
+	.string	"mbrlen"
+.LASF1368:
+	.string	"_ZSt13__invoke_implIP5PointZN4xstd9ctor_argsIS0_Lm40EE13emplace_valueIJRlS6_EEES1_PvPKvEUlDpOT_E_JS6_S6_EET_St14__invoke_otherOT0_DpOT1_"
+.LASF1635:
+	.string	"_IO_read_ptr"
+.LASF1521:
+	.string	"6ldiv_t"
+.LASF1472:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEpLEl"
+.LASF354:
+	.string	"reference"
+.LASF2013:
+	.string	"_ZN3tbb6detail2d118task_group_contextC4ENS0_2d021string_resource_indexE"
+.LASF1730:
+	.string	"wscanf"
+.LASF345:
+	.string	"capacity"
+.LASF1149:
+	.string	"_ZNSt6vectorIiSaIiEE5eraseEN9__gnu_cxx17__normal_iteratorIPKiS1_EE"
+.LASF910:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEE21compare_exchange_weakERS4_S4_St12memory_orderS7_"
+.LASF2223:
+	.string	"_ZNK4xstd9ctor_argsI5PointLm40EE14emplace_n_intoEPvm"
+.LASF1316:
+	.string	"_ZNSt11_Tuple_implILm0EJRlS0_EEC4ES0_S0_"
+.LASF1290:
+	.string	"_ZNSt10_Head_baseILm1ERlLb0EEC4ESt15allocator_arg_tSt13__uses_alloc0"
+.LASF638:
+	.string	"_ZNSt13__atomic_baseIjE9fetch_subEjSt12memory_order"
+.LASF2287:
+	.string	"tp_arg_pack"
+.LASF2217:
+	.string	"emplace_using_allocator"
+.LASF2087:
+	.string	"_ZN3tbb6detail2d111constraints11set_numa_idEi"
+.LASF185:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findEcm"
+.LASF1342:
+	.string	"__get_helper<0, long int&, long int&>"
+.LASF1691:
+	.string	"vwprintf"
+.LASF1679:
+	.string	"putwc"
+.LASF62:
+	.string	"rethrow_exception"
+.LASF2240:
+	.string	"make_value_using_allocator<long int&, long int&>"
+.LASF1396:
+	.string	"_ZSt8__invokeIZNK4xstd13ctor_args_forI5PointJRlS3_EEclEvEUlDpOT_E_JS3_S3_EENSt15__invoke_resultIT_JDpT0_EE4typeEOSA_DpOSB_"
+.LASF2337:
+	.string	"operator new"
+.LASF1200:
+	.string	"operator std::__atomic_base<tbb::detail::r1::arena*>::__pointer_type"
+.LASF1795:
+	.string	"_IO_marker"
+.LASF1893:
+	.string	"FLOW_JOIN_NODE_QUEUEING"
+.LASF1180:
+	.string	"_ZNSt6vectorIiSaIiEE14_M_move_assignEOS1_St17integral_constantIbLb1EE"
+.LASF156:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4backEv"
+.LASF904:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEE5storeES4_St12memory_order"
+.LASF153:
+	.string	"back"
+.LASF2002:
+	.string	"padding"
+.LASF1055:
+	.string	"_M_get_Tp_allocator"
+.LASF844:
+	.string	"_ZNSt11_Tuple_implILm0EJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEE7_M_tailERKS7_"
+.LASF2258:
+	.string	"operator Point"
+.LASF1246:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEEaSES4_"
+.LASF1429:
+	.string	"unsigned int"
+.LASF1591:
+	.string	"__allow_vector"
+.LASF1159:
+	.string	"_M_fill_insert"
+.LASF985:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEmmEi"
+.LASF1019:
+	.string	"_ZNSt15__new_allocatorIiEC4ERKS0_"
+.LASF773:
+	.string	"polymorphic_allocator"
+.LASF989:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEmmEv"
+.LASF348:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7reserveEm"
+.LASF1366:
+	.string	"_ZSt13__invoke_implIP5PointZN4xstd9ctor_argsIS0_Lm40EE15emplace_n_valueIJRlS6_EEES1_PvmPKvEUlS6_S6_E_JS6_S6_EET_St14__invoke_otherOT0_DpOT1_"
+.LASF130:
+	.string	"const_reverse_iterator"
+.LASF349:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7reserveEv"
+.LASF947:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEmIEl"
+.LASF1573:
+	.string	"qsort"
+.LASF952:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE5storeES4_St12memory_order"
+.LASF956:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE8exchangeES4_St12memory_order"
+.LASF821:
+	.string	"_ZNSt11_Tuple_implILm1EJN3tbb6detail2d211task_handle28task_handle_task_finalizer_tEEE7_M_headERKS5_"
+.LASF1032:
+	.string	"_ZNSt16allocator_traitsISaIiEE8allocateERS0_mPKv"
+.LASF718:
+	.string	"_ZNSt6atomicImED4Ev"
+.LASF1174:
+	.string	"_ZNSt6vectorIiSaIiEE11_S_max_sizeERKS0_"
+.LASF1173:
+	.string	"_S_max_size"
+.LASF1488:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEi"
+.LASF373:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendESt16initializer_listIcE"
+.LASF894:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEEaSERKS5_"
+.LASF7:
+	.string	"integral_constant<bool, true>"
+.LASF296:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_S_compareEmm"
+.LASF1594:
+	.string	"__allow_parallel"
+.LASF1463:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4Ev"
+.LASF5:
+	.string	"_ZNKSt17integral_constantIbLb0EEclEv"
+.LASF813:
+	.string	"_M_head"
+.LASF97:
+	.string	"allocate"
+.LASF824:
+	.string	"_ZNSt11_Tuple_implILm1EJN3tbb6detail2d211task_handle28task_handle_task_finalizer_tEEEC4ERKS4_"
+.LASF2021:
+	.string	"capture_fp_settings"
+.LASF1695:
+	.string	"wcscat"
+.LASF2346:
+	.string	"_IO_lock_t"
+.LASF831:
+	.string	"_ZNSt10_Head_baseILm0EPN3tbb6detail2d216task_handle_taskELb0EEC4Ev"
+.LASF99:
+	.string	"deallocate"
+.LASF629:
+	.string	"_ZNSt13__atomic_baseIjE23compare_exchange_strongERjjSt12memory_orderS2_"
+.LASF1225:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEE21compare_exchange_weakERS4_S4_St12memory_orderS7_"
+.LASF239:
+	.string	"_S_to_string_view"
+.LASF2231:
+	.string	"emplace_n<xstd::ctor_args<Point>::emplace_n_lazy_value<lazy_emplace(void*, long int, long int)::<lambda()> >(void*, size_t, void const*)::<lambda(Point*)> >"
+.LASF1600:
+	.string	"parallel_unsequenced_policy"
+.LASF1289:
+	.string	"_ZNSt10_Head_baseILm1ERlLb0EEC4EOS1_"
+.LASF916:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEE23compare_exchange_strongERS4_S4_St12memory_order"
+.LASF825:
+	.string	"_ZNSt11_Tuple_implILm1EJN3tbb6detail2d211task_handle28task_handle_task_finalizer_tEEEC4ERKS5_"
+.LASF429:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findERKS4_m"
+.LASF915:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d118task_group_context5stateEE23compare_exchange_strongERS4_S4_St12memory_orderS7_"
+.LASF2134:
+	.string	"_ZN3tbb6detail2d110task_arena10initializeENS1_6attachE"
+.LASF1649:
+	.string	"_flags2"
+.LASF2228:
+	.string	"Make"
+.LASF2327:
+	.string	"_ZNSt5tupleIJRlS0_EEC1ILb1ELb1EEES0_S0_"
+.LASF1878:
+	.string	"last_entry"
+.LASF2010:
+	.string	"_ZN3tbb6detail2d118task_group_context14actual_contextEv"
+.LASF1412:
+	.string	"_ZSt12__apply_implIZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS5_EEEPS2_PvmPKvEUlS5_S5_E_RKSt5tupleIJS5_S5_EEJLm0ELm1EEEDcOT_OT0_St16integer_sequenceImJXspT1_EEE"
+.LASF668:
+	.string	"_ZNVSt13__atomic_baseImEaSEm"
+.LASF158:
+	.string	"remove_prefix"
+.LASF1161:
+	.string	"_M_default_append"
+.LASF2232:
+	.string	"emplace_lazy_value_using_allocator<lazy_emplace(void*, long int, long int)::<lambda()> >"
+.LASF1755:
+	.string	"n_cs_precedes"
+.LASF1656:
+	.string	"_codecvt"
+.LASF1874:
+	.string	"invalid_load_factor"
+.LASF2291:
+	.string	"_ZZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS4_EEEPS1_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEEENKUlDpOT_E_clIJS4_S4_EEEDaSH_"
+.LASF2205:
+	.string	"profiling"
+.LASF927:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEED4Ev"
+.LASF531:
+	.string	"store"
+.LASF1541:
+	.string	"__uint_least64_t"
+.LASF2038:
+	.string	"_ZN3tbb6detail2d122cache_aligned_resource11do_allocateEmm"
+.LASF1268:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEE21compare_exchange_weakERS4_S4_St12memory_orderS7_"
+.LASF60:
+	.string	"__cxa_exception_type"
+.LASF1408:
+	.string	"_ZSt12__apply_implIZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS5_EEES2_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEEEUlDpOT_E_RKSt5tupleIJS5_S5_EEJLm0ELm1EEEDcOT_OT0_St16integer_sequenceImJXspT1_EEE"
+.LASF232:
+	.string	"_Alloc_hider"
+.LASF2185:
+	.string	"task_handle_task_finalizer_t"
+.LASF608:
+	.string	"_ZNVSt13__atomic_baseIjEpLEj"
+.LASF1639:
+	.string	"_IO_write_ptr"
+.LASF445:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofEPKcmm"
+.LASF410:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S8_S8_"
+.LASF1123:
+	.string	"_ZNKSt6vectorIiSaIiEE8max_sizeEv"
+.LASF749:
+	.string	"_ZNVKSt6atomicIN3tbb6detail2d013do_once_stateEEcvS3_Ev"
+.LASF2200:
+	.string	"_ZN3tbb6detail2d216task_handle_taskC4ERNS0_2d112wait_contextERNS3_18task_group_contextERNS3_22small_object_allocatorE"
+.LASF386:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmRKS4_"
+.LASF54:
+	.string	"_ZNSt15__exception_ptr13exception_ptraSERKS0_"
+.LASF658:
+	.string	"_ZNSt13__atomic_baseImEC4Ev"
+.LASF1041:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE17_Vector_impl_dataC4Ev"
+.LASF2177:
+	.string	"_ZN3tbb6detail2r115current_contextEv"
+.LASF795:
+	.string	"_M_ptr"
+.LASF2117:
+	.string	"not_initialized"
+.LASF613:
+	.string	"_ZNSt13__atomic_baseIjEoREj"
+.LASF1186:
+	.string	"_ZNKSt16initializer_listIiE4sizeEv"
+.LASF1387:
+	.string	"uses_allocator_construction_args<Point, std::pmr::polymorphic_allocator<>, long int&, long int&>"
+.LASF797:
+	.string	"_ZNKSt15__uniq_ptr_implIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE6_M_ptrEv"
+.LASF358:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5frontEv"
+.LASF1384:
+	.string	"_ZSt8__invokeIZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS5_EEES2_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEEEUlDpOT_E_JS5_S5_EENSt15__invoke_resultIT_JDpT0_EE4typeEOSJ_DpOSK_"
+.LASF1284:
+	.string	"__success_type<Point>"
+.LASF1054:
+	.string	"_Tp_alloc_type"
+.LASF2222:
+	.string	"_ZNK4xstd9ctor_argsI5PointLm40EE12emplace_intoEPv"
+.LASF2349:
+	.string	"_ZN3tbb6detail2d122cache_aligned_resourceD4Ev"
+.LASF789:
+	.string	"_Ptr<tbb::detail::d2::task_handle_task, tbb::detail::d2::task_handle::task_handle_task_finalizer_t, void>"
+.LASF1206:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEEppEi"
+.LASF1154:
+	.string	"_ZNSt6vectorIiSaIiEE18_M_fill_initializeEmRKi"
+.LASF1293:
+	.string	"_Tuple_impl<1, long int&>"
+.LASF1701:
+	.string	"tm_sec"
+.LASF204:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofES2_m"
+.LASF1210:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEEppEv"
+.LASF328:
+	.string	"reverse_iterator"
+.LASF534:
+	.string	"load"
+.LASF591:
+	.string	"_ZNSt13__atomic_baseIjEaSERKS0_"
+.LASF405:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_RKS4_"
+.LASF637:
+	.string	"_ZNVSt13__atomic_baseIjE9fetch_addEjSt12memory_order"
+.LASF1095:
+	.string	"_ZNSt6vectorIiSaIiEEC4EmRKiRKS0_"
+.LASF2195:
+	.string	"task_handle_task"
+.LASF2299:
+	.string	"_ZZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKvENKUlS4_S4_E_clES4_S4_"
+.LASF715:
+	.string	"_ZNVSt13__atomic_baseImE9fetch_xorEmSt12memory_order"
+.LASF855:
+	.string	"_ZNSt5tupleIJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEEC4ERKS7_"
+.LASF1008:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE23compare_exchange_strongERS4_S4_St12memory_order"
+.LASF1005:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE21compare_exchange_weakERS4_S4_St12memory_order"
+.LASF2250:
+	.string	"ctor_args<long int&, long int&>"
+.LASF70:
+	.string	"_ZNSt11char_traitsIcE2ltERKcS2_"
+.LASF1477:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmiEl"
+.LASF1451:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE27_S_propagate_on_move_assignEv"
+.LASF566:
+	.string	"_ZNSt13__atomic_baseIhE8fetch_orEhSt12memory_order"
+.LASF540:
+	.string	"compare_exchange_weak"
+.LASF1602:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy14__allow_vectorEv"
+.LASF1281:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEE9fetch_subElSt12memory_order"
+.LASF499:
+	.string	"operator std::__atomic_base<unsigned char>::__int_type"
+.LASF2138:
+	.string	"_ZN3tbb6detail2d110task_arenaD4Ev"
+.LASF556:
+	.string	"fetch_add"
+.LASF2209:
+	.string	"max_ctor_args"
+.LASF2049:
+	.string	"task"
+.LASF2320:
+	.string	"_ZNSt10_Head_baseILm1ERlLb0EEC2ES0_"
+.LASF461:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11starts_withEPKc"
+.LASF559:
+	.string	"fetch_sub"
+.LASF2053:
+	.string	"~task"
+.LASF1787:
+	.string	"intptr_t"
+.LASF2344:
+	.string	"decltype(nullptr)"
+.LASF2286:
+	.string	"p_arg_pack"
+.LASF1734:
+	.string	"wcsrchr"
+.LASF665:
+	.string	"_ZNKSt13__atomic_baseImEcvmEv"
+.LASF473:
+	.string	"_ZNSt16initializer_listIcEC4EPKcm"
+.LASF1961:
+	.string	"_ZN3tbb6detail2d112wait_contextD4Ev"
+.LASF1526:
+	.string	"__int8_t"
+.LASF1778:
+	.string	"uint_least64_t"
+.LASF648:
+	.string	"_ZNSt6atomicIjED4Ev"
+.LASF851:
+	.string	"_Elements"
+.LASF984:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEmmEi"
+.LASF1000:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE8exchangeES4_St12memory_order"
+.LASF1841:
+	.string	"max_nfs_size"
+.LASF1872:
+	.string	"reservation_length_error"
+.LASF988:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEmmEv"
+.LASF748:
+	.string	"_ZNKSt6atomicIN3tbb6detail2d013do_once_stateEEcvS3_Ev"
+.LASF476:
+	.string	"_ZNKSt16initializer_listIcE5beginEv"
+.LASF2142:
+	.string	"_ZN3tbb6detail2d110task_arena7enqueueEONS0_2d211task_handleE"
+.LASF2097:
+	.string	"priority_stride"
+.LASF959:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE23compare_exchange_strongERS4_S4_St12memory_orderS7_"
+.LASF931:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEC4ES4_"
+.LASF1742:
+	.string	"thousands_sep"
+.LASF832:
+	.string	"_ZNSt10_Head_baseILm0EPN3tbb6detail2d216task_handle_taskELb0EEC4ERKS4_"
+.LASF236:
+	.string	"_M_local_buf"
+.LASF1035:
+	.string	"_ZNSt16allocator_traitsISaIiEE37select_on_container_copy_constructionERKS0_"
+.LASF2151:
+	.string	"_ZN3tbb6detail2d125affinity_partitioner_baseC4Ev"
+.LASF964:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE9fetch_addElSt12memory_order"
+.LASF1300:
+	.string	"_ZNSt11_Tuple_implILm1EJRlEEC4EOS1_"
+.LASF1227:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEE23compare_exchange_strongERS4_S4_St12memory_orderS7_"
+.LASF1732:
+	.string	"wcschr"
+.LASF1122:
+	.string	"_ZNKSt6vectorIiSaIiEE4sizeEv"
+.LASF1323:
+	.string	"_ZNSt5tupleIJRlS0_EEC4ERKS1_"
+.LASF991:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEpLEl"
+.LASF494:
+	.string	"_ZNSt13__atomic_baseIhED4Ev"
+.LASF2017:
+	.string	"cancel_group_execution"
+.LASF833:
+	.string	"_ZNSt10_Head_baseILm0EPN3tbb6detail2d216task_handle_taskELb0EEC4ERKS5_"
+.LASF154:
+	.string	"const_pointer"
+.LASF2141:
+	.string	"enqueue"
+.LASF1402:
+	.string	"_ZSt5applyIZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS5_EEEPS2_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEEEUlDpOT_E_RKSt5tupleIJS5_S5_EEEDcOT_OT0_"
+.LASF1840:
+	.string	"detail"
+.LASF2121:
+	.string	"task_arena"
+.LASF822:
+	.string	"_Tuple_impl"
+.LASF122:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEaSERKS2_"
+.LASF346:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8capacityEv"
+.LASF2184:
+	.string	"task_handle"
+.LASF207:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofEPKcm"
+.LASF1971:
+	.string	"bound"
+.LASF1188:
+	.string	"_ZNKSt16initializer_listIiE3endEv"
+.LASF949:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE12is_lock_freeEv"
+.LASF1233:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEE9fetch_addElSt12memory_order"
+.LASF689:
+	.string	"_ZNSt13__atomic_baseImE5storeEmSt12memory_order"
+.LASF1885:
+	.string	"PARALLEL_SORT"
+.LASF596:
+	.string	"_ZNVKSt13__atomic_baseIjEcvjEv"
+.LASF1305:
+	.string	"_ZNSt10_Head_baseILm0ERlLb0EEC4ERKS1_"
+.LASF2300:
+	.string	"args#0"
+.LASF2301:
+	.string	"args#1"
+.LASF2202:
+	.string	"_ZN3tbb6detail2d216task_handle_taskD4Ev"
+.LASF43:
+	.string	"_M_addref"
+.LASF541:
+	.string	"_ZNSt13__atomic_baseIhE21compare_exchange_weakERhhSt12memory_orderS2_"
+.LASF594:
+	.string	"operator std::__atomic_base<unsigned int>::__int_type"
+.LASF1783:
+	.string	"uint_fast8_t"
+.LASF1654:
+	.string	"_lock"
+.LASF2242:
+	.string	"emplace_n_value<long int&, long int&>"
+.LASF1192:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r15arenaEE12_M_type_sizeEl"
+.LASF2101:
+	.string	"my_version_and_traits"
+.LASF2210:
+	.string	"default_ctor_args_capacity"
+.LASF1596:
+	.string	"parallel_policy"
+.LASF1022:
+	.string	"_ZNKSt15__new_allocatorIiE11_M_max_sizeEv"
+.LASF2229:
+	.string	"emplace_n<xstd::ctor_args<Point>::emplace_n_value<long int&, long int&>(void*, size_t, void const*)::<lambda(long int&, long int&)>::<lambda(Point*)> >"
+.LASF2321:
+	.string	"__head"
+.LASF1771:
+	.string	"int_least8_t"
+.LASF342:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6resizeEm"
+.LASF1575:
+	.string	"strtod"
+.LASF1585:
+	.string	"strtof"
+.LASF378:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignERKS4_mm"
+.LASF650:
+	.string	"_ZNSt6atomicIjEaSERKS0_"
+.LASF1067:
+	.string	"_ZNSt12_Vector_baseIiSaIiEEC4ERKS0_OS1_"
+.LASF1576:
+	.string	"strtol"
+.LASF1536:
+	.string	"__int_least16_t"
+.LASF73:
+	.string	"_ZNSt11char_traitsIcE7compareEPKcS2_m"
+.LASF902:
+	.string	"_ZNKSt6atomicIN3tbb6detail2d118task_group_context5stateEE12is_lock_freeEv"
+.LASF333:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6cbeginEv"
+.LASF2003:
+	.string	"_ZN3tbb6detail2d118task_group_contextC4ENS2_14context_traitsENS0_2d021string_resource_indexE"
+.LASF430:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findEPKcm"
+.LASF619:
+	.string	"_ZNSt13__atomic_baseIjE5storeEjSt12memory_order"
+.LASF460:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11starts_withEc"
+.LASF454:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmRKS4_"
+.LASF702:
+	.string	"_ZNVSt13__atomic_baseImE23compare_exchange_strongERmmSt12memory_order"
+.LASF875:
+	.string	"_ZNKSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEdeEv"
+.LASF347:
+	.string	"reserve"
+.LASF1785:
+	.string	"uint_fast32_t"
+.LASF565:
+	.string	"fetch_or"
+.LASF125:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5beginEv"
+.LASF885:
+	.string	"_ZNSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE5resetEPS3_"
+.LASF38:
+	.string	"__exception_ptr"
+.LASF1723:
+	.string	"wcsxfrm"
+.LASF1866:
+	.string	"exception_id"
+.LASF845:
+	.string	"_ZNSt11_Tuple_implILm0EJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEEC4Ev"
+.LASF723:
+	.string	"_ZNSt6atomicImE19is_always_lock_freeE"
+.LASF248:
+	.string	"_M_data"
+.LASF1072:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE11_M_allocateEm"
+.LASF974:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEaSERKS5_"
+.LASF1405:
+	.string	"apply<xstd::ctor_args<Point>::make_value_using_allocator<long int&, long int&>(void const*, const alloc_t&)::<lambda(auto:22&& ...)>, const std::tuple<long int&, long int&>&>"
+.LASF1642:
+	.string	"_IO_buf_end"
+.LASF183:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE8containsEPKc"
+.LASF1428:
+	.string	"short unsigned int"
+.LASF886:
+	.string	"_ZNSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE4swapERS6_"
+.LASF1737:
+	.string	"wcstold"
+.LASF1772:
+	.string	"int_least16_t"
+.LASF15:
+	.string	"__swappable_with_details"
+.LASF2036:
+	.string	"do_allocate"
+.LASF1738:
+	.string	"wcstoll"
+.LASF2137:
+	.string	"~task_arena"
+.LASF1107:
+	.string	"_ZNSt6vectorIiSaIiEEaSESt16initializer_listIiE"
+.LASF936:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEaSES4_"
+.LASF1800:
+	.string	"fclose"
+.LASF206:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofEPKcmm"
+.LASF1987:
+	.string	"my_parent"
+.LASF1372:
+	.string	"_ZSt13__invoke_implI5PointZNK4xstd13ctor_args_forIS0_JRlS3_EEclEvEUlDpOT_E_JS3_S3_EET_St14__invoke_otherOT0_DpOT1_"
+.LASF1168:
+	.string	"_ZNSt6vectorIiSaIiEE14_M_emplace_auxEN9__gnu_cxx17__normal_iteratorIPKiS1_EEOi"
+.LASF182:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE8containsEc"
+.LASF1490:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEi"
+.LASF1968:
+	.string	"task_group_context"
+.LASF1528:
+	.string	"__int16_t"
+.LASF704:
+	.string	"_ZNSt13__atomic_baseImE10notify_oneEv"
+.LASF1609:
+	.string	"unseq"
+.LASF1699:
+	.string	"wcscspn"
+.LASF1796:
+	.string	"_IO_codecvt"
+.LASF2090:
+	.string	"numa_id"
+.LASF2317:
+	.string	"typed_emplace"
+.LASF1083:
+	.string	"_S_use_relocate"
+.LASF932:
+	.string	"operator std::__atomic_base<tbb::detail::r1::tbb_exception_ptr*>::__pointer_type"
+.LASF2266:
+	.string	"_ZN5PointC4Ell"
+.LASF690:
+	.string	"_ZNVSt13__atomic_baseImE5storeEmSt12memory_order"
+.LASF1964:
+	.string	"execution_data"
+.LASF1637:
+	.string	"_IO_read_base"
+.LASF716:
+	.string	"atomic<long unsigned int>"
+.LASF336:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5crendEv"
+.LASF624:
+	.string	"_ZNVSt13__atomic_baseIjE8exchangeEjSt12memory_order"
+.LASF977:
+	.string	"operator std::atomic<tbb::detail::r1::tbb_exception_ptr*>::__pointer_type"
+.LASF780:
+	.string	"allocate_bytes"
+.LASF57:
+	.string	"_ZNSt15__exception_ptr13exception_ptrD4Ev"
+.LASF1700:
+	.string	"wcsftime"
+.LASF2230:
+	.string	"_ZN4xstd9ctor_argsI5PointLm40EE9emplace_nIZZNS2_15emplace_n_valueIJRlS5_EEEPS1_PvmPKvENKUlS5_S5_E_clES5_S5_EUlS6_E_EES6_S6_mT_"
+.LASF2075:
+	.string	"_ZN3tbb6detail2d115task_group_base4waitEv"
+.LASF124:
+	.string	"begin"
+.LASF1047:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE17_Vector_impl_data12_M_swap_dataERS2_"
+.LASF477:
+	.string	"_ZNKSt16initializer_listIcE3endEv"
+.LASF360:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4backEv"
+.LASF298:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_assignERKS4_"
+.LASF2218:
+	.string	"alloc_t"
+.LASF1194:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEEC4Ev"
+.LASF713:
+	.string	"_ZNVSt13__atomic_baseImE8fetch_orEmSt12memory_order"
+.LASF532:
+	.string	"_ZNSt13__atomic_baseIhE5storeEhSt12memory_order"
+.LASF1842:
+	.string	"max_nfs_size_exp"
+.LASF2316:
+	.string	"_ZN4xstd9ctor_argsI5PointLm40EEC2IJRlS4_EEEDpOT_"
+.LASF764:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEE23compare_exchange_strongERS3_S3_St12memory_orderS6_"
+.LASF1671:
+	.string	"fwscanf"
+.LASF2156:
+	.string	"_ZN3tbb6detail2d116auto_partitionerC4Ev"
+.LASF1626:
+	.string	"__wch"
+.LASF1169:
+	.string	"_M_check_len"
+.LASF1024:
+	.string	"_ZNSaIiEC4Ev"
+.LASF1291:
+	.string	"_ZNSt10_Head_baseILm1ERlLb0EE7_M_headERS1_"
+.LASF1478:
+	.string	"base"
+.LASF1894:
+	.string	"FLOW_JOIN_NODE_RESERVING"
+.LASF2197:
+	.string	"m_allocator"
+.LASF286:
+	.string	"_S_move"
+.LASF701:
+	.string	"_ZNSt13__atomic_baseImE23compare_exchange_strongERmmSt12memory_order"
+.LASF1757:
+	.string	"p_sign_posn"
+.LASF332:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4rendEv"
+.LASF1249:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEEppEi"
+.LASF871:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSEDn"
+.LASF571:
+	.string	"_IntTp"
+.LASF1932:
+	.string	"FLOW_GRAPH"
+.LASF1148:
+	.string	"_ZNSt6vectorIiSaIiEE6insertEN9__gnu_cxx17__normal_iteratorIPKiS1_EEmRS4_"
+.LASF1253:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEEppEv"
+.LASF506:
+	.string	"_ZNVSt13__atomic_baseIhEppEi"
+.LASF1166:
+	.string	"_ZNSt6vectorIiSaIiEE14_M_insert_rvalEN9__gnu_cxx17__normal_iteratorIPKiS1_EEOi"
+.LASF2118:
+	.string	"_ZN3tbb6detail2d115task_arena_base9automaticE"
+.LASF2199:
+	.string	"_ZN3tbb6detail2d216task_handle_task8finalizeEPKNS0_2d114execution_dataE"
+.LASF990:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEpLEl"
+.LASF409:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_PcSA_"
+.LASF511:
+	.string	"_ZNVSt13__atomic_baseIhEppEv"
+.LASF1824:
+	.string	"_Float16"
+.LASF71:
+	.string	"compare"
+.LASF371:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendEPKc"
+.LASF420:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4copyEPcmm"
+.LASF1224:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEE8exchangeES4_St12memory_order"
+.LASF2029:
+	.string	"_ZN3tbb6detail2d122cache_aligned_resourceC4ERKS2_"
+.LASF562:
+	.string	"fetch_and"
+.LASF1698:
+	.string	"wcscpy"
+.LASF1507:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIiEiE15_S_nothrow_moveEv"
+.LASF1629:
+	.string	"__value"
+.LASF408:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_mc"
+.LASF891:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEEC4Ev"
+.LASF1653:
+	.string	"_shortbuf"
+.LASF820:
+	.string	"_ZNSt11_Tuple_implILm1EJN3tbb6detail2d211task_handle28task_handle_task_finalizer_tEEE7_M_headERS5_"
+.LASF1369:
+	.string	"__invoke_impl<Point, xstd::ctor_args<Point>::make_value<long int&, long int&>(void const*)::<lambda(auto:20&& ...)>, long int&, long int&>"
+.LASF1274:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEE23compare_exchange_strongERS4_S4_St12memory_order"
+.LASF527:
+	.string	"_ZNVSt13__atomic_baseIhEeOEh"
+.LASF1183:
+	.string	"initializer_list<int>"
+.LASF1949:
+	.string	"wait_context"
+.LASF669:
+	.string	"_ZNSt13__atomic_baseImEppEi"
+.LASF159:
+	.string	"remove_suffix"
+.LASF1184:
+	.string	"_ZNSt16initializer_listIiEC4EPKim"
+.LASF1012:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE10notify_allEv"
+.LASF1248:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEEppEi"
+.LASF1724:
+	.string	"wctob"
+.LASF2127:
+	.string	"_ZN3tbb6detail2d110task_arenaC4ENS2_6attachE"
+.LASF753:
+	.string	"_ZNVKSt6atomicIN3tbb6detail2d013do_once_stateEE12is_lock_freeEv"
+.LASF1252:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEEppEv"
+.LASF1059:
+	.string	"_Vector_base"
+.LASF1803:
+	.string	"fflush"
+.LASF2139:
+	.string	"is_active"
+.LASF63:
+	.string	"_ZSt17rethrow_exceptionNSt15__exception_ptr13exception_ptrE"
+.LASF192:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindEPKcm"
+.LASF1361:
+	.string	"__invoke_impl<Point, xstd::ctor_args<Point>::make_value_using_allocator<long int&, long int&>(void const*, const alloc_t&)::<lambda(auto:22&& ...)>, long int&, long int&>"
+.LASF489:
+	.string	"seq_cst"
+.LASF1952:
+	.string	"m_version_and_traits"
+.LASF778:
+	.string	"_ZNSt3pmr21polymorphic_allocatorISt4byteE8allocateEm"
+.LASF1513:
+	.string	"float"
+.LASF86:
+	.string	"_ZNSt11char_traitsIcE11to_int_typeERKc"
+.LASF1868:
+	.string	"bad_last_alloc"
+.LASF2103:
+	.string	"my_arena"
+.LASF1640:
+	.string	"_IO_write_end"
+.LASF1975:
+	.string	"fp_settings"
+.LASF309:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4EPKcmRKS3_"
+.LASF1191:
+	.string	"__atomic_base<tbb::detail::r1::arena*>"
+.LASF685:
+	.string	"_ZNSt13__atomic_baseImEeOEm"
+.LASF392:
+	.string	"__const_iterator"
+.LASF1628:
+	.string	"__count"
+.LASF1427:
+	.string	"unsigned char"
+.LASF911:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d118task_group_context5stateEE21compare_exchange_weakERS4_S4_St12memory_orderS7_"
+.LASF1420:
+	.string	"_ZSt12__apply_implIZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS5_EEES2_PKvEUlDpOT_E_RKSt5tupleIJS5_S5_EEJLm0ELm1EEEDcOT_OT0_St16integer_sequenceImJXspT1_EEE"
+.LASF2009:
+	.string	"actual_context"
+.LASF2298:
+	.string	"__first"
+.LASF1349:
+	.string	"index_sequence"
+.LASF1895:
+	.string	"FLOW_JOIN_NODE_TAG_MATCHING"
+.LASF1097:
+	.string	"_ZNSt6vectorIiSaIiEEC4EOS1_"
+.LASF161:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE13remove_suffixEm"
+.LASF1140:
+	.string	"_ZNSt6vectorIiSaIiEE4dataEv"
+.LASF961:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE4waitES4_St12memory_order"
+.LASF1234:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEE9fetch_subElSt12memory_order"
+.LASF1733:
+	.string	"wcspbrk"
+.LASF1989:
+	.string	"my_cpu_ctl_env"
+.LASF178:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE9ends_withEc"
+.LASF2108:
+	.string	"my_core_type"
+.LASF501:
+	.string	"_ZNVKSt13__atomic_baseIhEcvhEv"
+.LASF1904:
+	.string	"FLOW_WRITE_ONCE_NODE"
+.LASF1422:
+	.string	"_ZSt5applyIZNK4xstd13ctor_args_forI5PointJRlS3_EEclEvEUlDpOT_E_RKSt5tupleIJS3_S3_EEEDcOT_OT0_"
+.LASF1995:
+	.string	"my_may_have_children"
+.LASF1760:
+	.string	"int_p_sep_by_space"
+.LASF217:
+	.string	"type_info"
+.LASF2294:
+	.string	"_ZZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS4_EEES1_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEEENKUlDpOT_E_clIJS4_S4_EEEDaSF_"
+.LASF2024:
+	.string	"_ZNK3tbb6detail2d118task_group_context6traitsEv"
+.LASF1846:
+	.string	"_ZN3tbb6detail2d09no_assignC4Ev"
+.LASF520:
+	.string	"_ZNSt13__atomic_baseIhEaNEh"
+.LASF1801:
+	.string	"feof"
+.LASF201:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofEPKcmm"
+.LASF776:
+	.string	"_ZNSt3pmr21polymorphic_allocatorISt4byteEC4ERKS2_"
+.LASF1397:
+	.string	"_ZSt3getILm1EJRlS0_EERKNSt13tuple_elementIXT_ESt5tupleIJDpT0_EEE4typeERKS5_"
+.LASF1493:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEplEl"
+.LASF1744:
+	.string	"int_curr_symbol"
+.LASF1677:
+	.string	"mbsinit"
+.LASF306:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_mRKS3_"
+.LASF628:
+	.string	"_ZNVSt13__atomic_baseIjE21compare_exchange_weakERjjSt12memory_order"
+.LASF2008:
+	.string	"_ZNK3tbb6detail2d118task_group_context8is_proxyEv"
+.LASF1879:
+	.string	"ALGORITHM"
+.LASF1681:
+	.string	"swprintf"
+.LASF1182:
+	.string	"__type_identity_t"
+.LASF2275:
+	.string	"~<lambda>"
+.LASF194:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofES2_m"
+.LASF627:
+	.string	"_ZNSt13__atomic_baseIjE21compare_exchange_weakERjjSt12memory_order"
+.LASF229:
+	.string	"_ZNSt16allocator_traitsISaIcEE37select_on_container_copy_constructionERKS0_"
+.LASF2032:
+	.string	"upstream_resource"
+.LASF113:
+	.string	"_ZNSaIcE10deallocateEPcm"
+.LASF1500:
+	.string	"__alloc_traits<std::allocator<int>, int>"
+.LASF1829:
+	.string	"wctrans"
+.LASF2048:
+	.string	"my_next_node"
+.LASF644:
+	.string	"_ZNSt13__atomic_baseIjE9fetch_xorEjSt12memory_order"
+.LASF680:
+	.string	"_ZNVSt13__atomic_baseImEmIEm"
+.LASF488:
+	.string	"acq_rel"
+.LASF2206:
+	.string	"oneapi"
+.LASF359:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5frontEv"
+.LASF245:
+	.string	"_M_sv"
+.LASF1728:
+	.string	"wmemset"
+.LASF1988:
+	.string	"my_actual_context"
+.LASF31:
+	.string	"__invoke_other"
+.LASF544:
+	.string	"_ZNVSt13__atomic_baseIhE21compare_exchange_weakERhhSt12memory_order"
+.LASF1973:
+	.string	"unused"
+.LASF1336:
+	.string	"is_invocable_r_v"
+.LASF1307:
+	.string	"_ZNSt10_Head_baseILm0ERlLb0EEC4ESt15allocator_arg_tSt13__uses_alloc0"
+.LASF839:
+	.string	"_ZNSt11_Tuple_implILm0EJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEE7_M_headERS7_"
+.LASF543:
+	.string	"_ZNSt13__atomic_baseIhE21compare_exchange_weakERhhSt12memory_order"
+.LASF2005:
+	.string	"make_traits"
+.LASF1403:
+	.string	"__apply_impl<xstd::ctor_args<Point>::emplace_value_using_allocator<long int&, long int&>(void*, void const*, const alloc_t&)::<lambda(auto:23&& ...)>, const std::tuple<long int&, long int&>&, 0, 1>"
+.LASF2055:
+	.string	"execute"
+.LASF123:
+	.string	"const_iterator"
+.LASF877:
+	.string	"_ZNKSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEptEv"
+.LASF1765:
+	.string	"setlocale"
+.LASF774:
+	.string	"_ZNSt3pmr21polymorphic_allocatorISt4byteEC4Ev"
+.LASF1468:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEi"
+.LASF177:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE9ends_withES2_"
+.LASF2203:
+	.string	"info"
+.LASF872:
+	.string	"_ZNSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEaSEOS6_"
+.LASF2124:
+	.string	"_ZN3tbb6detail2d110task_arenaC4EijNS1_15task_arena_base8priorityE"
+.LASF1863:
+	.string	"_ZNK3tbb6detail2d018proportional_splitcvNS1_5splitEEv"
+.LASF1799:
+	.string	"clearerr"
+.LASF823:
+	.string	"_ZNSt11_Tuple_implILm1EJN3tbb6detail2d211task_handle28task_handle_task_finalizer_tEEEC4Ev"
+.LASF1722:
+	.string	"wcstoul"
+.LASF1155:
+	.string	"_M_default_initialize"
+.LASF2186:
+	.string	"_ZN3tbb6detail2d211task_handle28task_handle_task_finalizer_tclEPNS1_16task_handle_taskE"
+.LASF643:
+	.string	"_ZNVSt13__atomic_baseIjE8fetch_orEjSt12memory_order"
+.LASF908:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEE8exchangeES4_St12memory_order"
+.LASF173:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE11starts_withES2_"
+.LASF1118:
+	.string	"_ZNKSt6vectorIiSaIiEE6cbeginEv"
+.LASF365:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLEc"
+.LASF801:
+	.string	"reset"
+.LASF226:
+	.string	"_ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm"
+.LASF1456:
+	.string	"_S_nothrow_move"
+.LASF933:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEcvS4_Ev"
+.LASF1100:
+	.string	"_ZNSt6vectorIiSaIiEEC4EOS1_RKS0_St17integral_constantIbLb0EE"
+.LASF1475:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmIEl"
+.LASF2058:
+	.string	"_ZN3tbb6detail2d14task6cancelERNS1_14execution_dataE"
+.LASF1086:
+	.string	"_S_do_relocate"
+.LASF482:
+	.string	"type"
+.LASF906:
+	.string	"_ZNKSt6atomicIN3tbb6detail2d118task_group_context5stateEE4loadESt12memory_order"
+.LASF1696:
+	.string	"wcscmp"
+.LASF1689:
+	.string	"vswscanf"
+.LASF1544:
+	.string	"__off_t"
+.LASF1129:
+	.string	"_ZNSt6vectorIiSaIiEE7reserveEm"
+.LASF861:
+	.string	"__uniq_ptr_data<tbb::detail::d2::task_handle_task, tbb::detail::d2::task_handle::task_handle_task_finalizer_t, true, true>"
+.LASF282:
+	.string	"_M_disjunct"
+.LASF1223:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEE8exchangeES4_St12memory_order"
+.LASF1741:
+	.string	"decimal_point"
+.LASF380:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEPKc"
+.LASF1419:
+	.string	"__apply_impl<xstd::ctor_args<Point>::make_value<long int&, long int&>(void const*)::<lambda(auto:20&& ...)>, const std::tuple<long int&, long int&>&, 0, 1>"
+.LASF1986:
+	.string	"proxy"
+.LASF2253:
+	.string	"Capacity"
+.LASF1673:
+	.string	"getwc"
+.LASF1816:
+	.string	"remove"
+.LASF901:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d118task_group_context5stateEEaSES4_"
+.LASF141:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6lengthEv"
+.LASF1211:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEEmmEv"
+.LASF367:
+	.string	"append"
+.LASF847:
+	.string	"_ZNSt11_Tuple_implILm0EJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEEC4ERKS7_"
+.LASF399:
+	.string	"replace"
+.LASF784:
+	.string	"_ZNKSt3pmr21polymorphic_allocatorISt4byteE37select_on_container_copy_constructionEv"
+.LASF1050:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE12_Vector_implC4ERKS0_"
+.LASF412:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S9_S9_"
+.LASF1391:
+	.string	"__invoke<xstd::ctor_args<Point>::emplace_value<long int&, long int&>(void*, void const*)::<lambda(auto:21&& ...)>, long int&, long int&>"
+.LASF36:
+	.string	"numbers"
+.LASF491:
+	.string	"__atomic_base"
+.LASF1682:
+	.string	"swscanf"
+.LASF599:
+	.string	"_ZNSt13__atomic_baseIjEppEi"
+.LASF1599:
+	.string	"_ZN6__pstl9execution2v115parallel_policy16__allow_parallelEv"
+.LASF2007:
+	.string	"is_proxy"
+.LASF1946:
+	.string	"no_slot"
+.LASF2235:
+	.string	"emplace_lazy_value<lazy_emplace(void*, long int, long int)::<lambda()> >"
+.LASF935:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEaSES4_"
+.LASF2104:
+	.string	"my_max_concurrency"
+.LASF603:
+	.string	"_ZNSt13__atomic_baseIjEppEv"
+.LASF955:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE8exchangeES4_St12memory_order"
+.LASF2328:
+	.string	"_ZN4xstd13ctor_args_forI5PointJRlS2_EEC1ES2_S2_"
+.LASF414:
+	.string	"_M_replace_aux"
+.LASF729:
+	.string	"_ZSt3divll"
+.LASF1688:
+	.string	"vswprintf"
+.LASF2193:
+	.string	"_ZN3tbb6detail2d211task_handleC4EPNS1_16task_handle_taskE"
+.LASF2083:
+	.string	"_ZN3tbb6detail2d131is_current_task_group_cancelingEv"
+.LASF1101:
+	.string	"_ZNSt6vectorIiSaIiEEC4EOS1_RKS0_"
+.LASF1079:
+	.string	"vector<int, std::allocator<int> >"
+.LASF615:
+	.string	"_ZNSt13__atomic_baseIjEeOEj"
+.LASF561:
+	.string	"_ZNVSt13__atomic_baseIhE9fetch_subEhSt12memory_order"
+.LASF2016:
+	.string	"_ZN3tbb6detail2d118task_group_context5resetEv"
+.LASF563:
+	.string	"_ZNSt13__atomic_baseIhE9fetch_andEhSt12memory_order"
+.LASF1489:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEv"
+.LASF2011:
+	.string	"_ZNK3tbb6detail2d118task_group_context14actual_contextEv"
+.LASF458:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmPKcm"
+.LASF1443:
+	.string	"_S_select_on_copy"
+.LASF1764:
+	.string	"int_n_sign_posn"
+.LASF2257:
+	.string	"_ZNK4xstd13ctor_args_forI5PointJRlS2_EEclEv"
+.LASF169:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEPKc"
+.LASF1108:
+	.string	"_ZNSt6vectorIiSaIiEE6assignEmRKi"
+.LASF1546:
+	.string	"__clock_t"
+.LASF1947:
+	.string	"any_slot"
+.LASF406:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S8_m"
+.LASF2022:
+	.string	"_ZN3tbb6detail2d118task_group_context19capture_fp_settingsEv"
+.LASF1931:
+	.string	"FLOW_BODY"
+.LASF1052:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE12_Vector_implC4EOS0_"
+.LASF1621:
+	.string	"fp_offset"
+.LASF1345:
+	.string	"_Tail"
+.LASF1817:
+	.string	"rename"
+.LASF2050:
+	.string	"_ZN3tbb6detail2d14taskC4ERKS2_"
+.LASF324:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5beginEv"
+.LASF308:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_mmRKS3_"
+.LASF2339:
+	.string	"GNU C++23 12.2.0 -mtune=generic -march=x86-64 -g -O2 -std=c++23 -fasynchronous-unwind-tables"
+.LASF1531:
+	.string	"__uint32_t"
+.LASF646:
+	.string	"atomic<unsigned int>"
+.LASF1441:
+	.string	"_ZN9__gnu_cxx3divExx"
+.LASF1130:
+	.string	"_ZNSt6vectorIiSaIiEEixEm"
+.LASF1582:
+	.string	"atoll"
+.LASF1839:
+	.string	"timespec_get"
+.LASF1805:
+	.string	"fgetpos"
+.LASF909:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d118task_group_context5stateEE8exchangeES4_St12memory_order"
+.LASF101:
+	.string	"_M_max_size"
+.LASF251:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_lengthEm"
+.LASF841:
+	.string	"_Inherited"
+.LASF28:
+	.string	"__cmp_alg"
+.LASF2114:
+	.string	"_ZN3tbb6detail2d115task_arena_baseC4EijNS2_8priorityE"
+.LASF1632:
+	.string	"__FILE"
+.LASF2279:
+	.string	"_ZZSt39uninitialized_construct_using_allocatorI5PointNSt3pmr21polymorphic_allocatorISt4byteEEJRlS5_EEPT_S7_RKT0_DpOT1_ENKUlDpOT_E_clIJS5_S5_EEEDaSG_"
+.LASF1905:
+	.string	"FLOW_INDEXER_NODE"
+.LASF337:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4sizeEv"
+.LASF1657:
+	.string	"_wide_data"
+.LASF1833:
+	.string	"mktime"
+.LASF1603:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy16__allow_parallelEv"
+.LASF29:
+	.string	"allocator_arg_t"
+.LASF552:
+	.string	"notify_one"
+.LASF1202:
+	.string	"_ZNVKSt13__atomic_baseIPN3tbb6detail2r15arenaEEcvS4_Ev"
+.LASF1320:
+	.string	"_ZNSt11_Tuple_implILm0EJRlS0_EE7_M_swapERS1_"
+.LASF1804:
+	.string	"fgetc"
+.LASF200:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofEcm"
+.LASF542:
+	.string	"_ZNVSt13__atomic_baseIhE21compare_exchange_weakERhhSt12memory_orderS2_"
+.LASF322:
+	.string	"operator std::__cxx11::basic_string<char>::__sv_type"
+.LASF467:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8containsEPKc"
+.LASF1296:
+	.string	"_ZNSt11_Tuple_implILm1EJRlEEC4Ev"
+.LASF268:
+	.string	"_M_construct"
+.LASF1045:
+	.string	"_M_swap_data"
+.LASF1610:
+	.string	"__internal"
+.LASF1051:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE12_Vector_implC4EOS2_"
+.LASF1789:
+	.string	"intmax_t"
+.LASF1806:
+	.string	"fgets"
+.LASF1390:
+	.string	"_ZSt8__invokeIZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS5_EEEPS2_PvmPKvEUlS5_S5_E_JS5_S5_EENSt15__invoke_resultIT_JDpT0_EE4typeEOSC_DpOSD_"
+.LASF1890:
+	.string	"FLOW_BUFFER_NODE"
+.LASF1085:
+	.string	"_ZNSt6vectorIiSaIiEE15_S_use_relocateEv"
+.LASF431:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findEcm"
+.LASF2297:
+	.string	"_ZZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKvENUlS4_S4_E_D4Ev"
+.LASF381:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEmc"
+.LASF1825:
+	.string	"wctype_t"
+.LASF610:
+	.string	"_ZNVSt13__atomic_baseIjEmIEj"
+.LASF314:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4EDn"
+.LASF1835:
+	.string	"asctime"
+.LASF59:
+	.string	"_ZNSt15__exception_ptr13exception_ptr4swapERS0_"
+.LASF1881:
+	.string	"PARALLEL_FOR_EACH"
+.LASF1314:
+	.string	"_ZNSt11_Tuple_implILm0EJRlS0_EE7_M_tailERKS1_"
+.LASF2318:
+	.string	"typed_value"
+.LASF865:
+	.string	"__add_lvalue_reference_helper<tbb::detail::d2::task_handle_task, true>"
+.LASF271:
+	.string	"_M_get_allocator"
+.LASF1466:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEptEv"
+.LASF1484:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4ERKS2_"
+.LASF1356:
+	.string	"_ZSt3getILm1EJRlS0_EEONSt13tuple_elementIXT_ESt5tupleIJDpT0_EEE4typeEOS5_"
+.LASF1389:
+	.string	"__invoke<xstd::ctor_args<Point>::emplace_n_value<long int&, long int&>(void*, size_t, void const*)::<lambda(long int&, long int&)>, long int&, long int&>"
+.LASF443:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofEcm"
+.LASF580:
+	.string	"_ZNVSt6atomicIhEaSERKS0_"
+.LASF319:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSEc"
+.LASF2160:
+	.string	"_ZN3tbb6detail2d118static_partitionerC4Ev"
+.LASF1318:
+	.string	"_ZNSt11_Tuple_implILm0EJRlS0_EEaSERKS1_"
+.LASF1363:
+	.string	"make_from_tuple<Point, std::tuple<long int&, long int&> >"
+.LASF539:
+	.string	"_ZNVSt13__atomic_baseIhE8exchangeEhSt12memory_order"
+.LASF164:
+	.string	"substr"
+.LASF1187:
+	.string	"_ZNKSt16initializer_listIiE5beginEv"
+.LASF1208:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEEmmEi"
+.LASF549:
+	.string	"_ZNVSt13__atomic_baseIhE23compare_exchange_strongERhhSt12memory_order"
+.LASF703:
+	.string	"_ZNKSt13__atomic_baseImE4waitEmSt12memory_order"
+.LASF868:
+	.string	"_ZNSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEC4EOS6_"
+.LASF2071:
+	.string	"_ZN3tbb6detail2d115task_group_baseC4Em"
+.LASF1212:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEEmmEv"
+.LASF750:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEEaSES3_"
+.LASF887:
+	.string	"_ZNSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEC4ERKS6_"
+.LASF652:
+	.string	"_ZNSt6atomicIjEC4Ej"
+.LASF1469:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEv"
+.LASF2089:
+	.string	"_ZN3tbb6detail2d111constraints19set_max_concurrencyEi"
+.LASF1750:
+	.string	"negative_sign"
+.LASF2028:
+	.string	"_ZN3tbb6detail2d122cache_aligned_resourceC4EOS2_"
+.LASF815:
+	.string	"_ZNSt10_Head_baseILm1EN3tbb6detail2d211task_handle28task_handle_task_finalizer_tELb1EE7_M_headERKS5_"
+.LASF1239:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEEC4ERKS5_"
+.LASF2020:
+	.string	"_ZN3tbb6detail2d118task_group_context28is_group_execution_cancelledEv"
+.LASF1838:
+	.string	"localtime"
+.LASF2251:
+	.string	"_ZN4xstd9ctor_argsI5PointLm40EEC4IJRlS4_EEEDpOT_"
+.LASF2342:
+	.string	"_ZNSt11this_thread5yieldEv"
+.LASF497:
+	.string	"_ZNVSt13__atomic_baseIhEaSERKS0_"
+.LASF340:
+	.string	"resize"
+.LASF1353:
+	.string	"_ZSt8__invokeIZSt39uninitialized_construct_using_allocatorI5PointNSt3pmr21polymorphic_allocatorISt4byteEEJRlS6_EEPT_S8_RKT0_DpOT1_EUlDpOT_E_JS6_S6_EENSt15__invoke_resultIS7_JDpT0_EE4typeEOS7_DpOSK_"
+.LASF1650:
+	.string	"_old_offset"
+.LASF1953:
+	.string	"m_ref_count"
+.LASF1565:
+	.string	"getenv"
+.LASF1678:
+	.string	"mbsrtowcs"
+.LASF58:
+	.string	"swap"
+.LASF137:
+	.string	"crend"
+.LASF1791:
+	.string	"_G_fpos_t"
+.LASF1715:
+	.string	"wcsncpy"
+.LASF921:
+	.string	"__atomic_base<tbb::detail::r1::tbb_exception_ptr*>"
+.LASF1417:
+	.string	"apply<xstd::ctor_args<Point>::make_value<long int&, long int&>(void const*)::<lambda(auto:20&& ...)>, const std::tuple<long int&, long int&>&>"
+.LASF1165:
+	.string	"_M_insert_rval"
+.LASF1793:
+	.string	"__state"
+.LASF775:
+	.string	"_ZNSt3pmr21polymorphic_allocatorISt4byteEC4EPNS_15memory_resourceE"
+.LASF767:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d013do_once_stateEE23compare_exchange_strongERS3_S3_St12memory_order"
+.LASF291:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcN9__gnu_cxx17__normal_iteratorIS5_S4_EES8_"
+.LASF1993:
+	.string	"may_have_children"
+.LASF1547:
+	.string	"__time_t"
+.LASF1590:
+	.string	"__allow_unsequenced"
+.LASF105:
+	.string	"_ZNSaIcEC4Ev"
+.LASF896:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEEC4ES4_"
+.LASF1057:
+	.string	"_ZNKSt12_Vector_baseIiSaIiEE19_M_get_Tp_allocatorEv"
+.LASF1704:
+	.string	"tm_mday"
+.LASF1053:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE12_Vector_implC4EOS0_OS2_"
+.LASF234:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_Alloc_hiderC4EPcOS3_"
+.LASF1241:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEEaSERKS5_"
+.LASF726:
+	.string	"_ZSt3absd"
+.LASF724:
+	.string	"_ZSt3abse"
+.LASF725:
+	.string	"_ZSt3absf"
+.LASF1515:
+	.string	"__gnu_debug"
+.LASF728:
+	.string	"_ZSt3absl"
+.LASF1201:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r15arenaEEcvS4_Ev"
+.LASF1029:
+	.string	"_ZNSaIiE10deallocateEPim"
+.LASF304:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS3_"
+.LASF32:
+	.string	"__uses_alloc_base"
+.LASF884:
+	.string	"_ZNSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE7releaseEv"
+.LASF432:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindERKS4_m"
+.LASF727:
+	.string	"_ZSt3absx"
+.LASF297:
+	.string	"_M_assign"
+.LASF700:
+	.string	"_ZNVSt13__atomic_baseImE23compare_exchange_strongERmmSt12memory_orderS2_"
+.LASF407:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S8_"
+.LASF246:
+	.string	"_M_dataplus"
+.LASF1856:
+	.string	"proportional_split"
+.LASF1437:
+	.string	"char16_t"
+.LASF1106:
+	.string	"_ZNSt6vectorIiSaIiEEaSEOS1_"
+.LASF402:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmPKcm"
+.LASF1645:
+	.string	"_IO_save_end"
+.LASF355:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEixEm"
+.LASF3:
+	.string	"operator()"
+.LASF160:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE13remove_prefixEm"
+.LASF305:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_"
+.LASF760:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEE21compare_exchange_weakERS3_S3_St12memory_orderS6_"
+.LASF1482:
+	.string	"__normal_iterator<char const*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >"
+.LASF1226:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEE21compare_exchange_weakERS4_S4_St12memory_orderS7_"
+.LASF969:
+	.string	"__base_type"
+.LASF2012:
+	.string	"_ZN3tbb6detail2d118task_group_contextC4ENS2_9kind_typeEm"
+.LASF772:
+	.string	"polymorphic_allocator<std::byte>"
+.LASF993:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEmIEl"
+.LASF796:
+	.string	"_ZNSt15__uniq_ptr_implIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE6_M_ptrEv"
+.LASF2350:
+	.string	"_ZN3tbb6detail2d110task_group3runEONS0_2d211task_handleE"
+.LASF1276:
+	.string	"_ZNKSt6atomicIPN3tbb6detail2r15arenaEE4waitES4_St12memory_order"
+.LASF2107:
+	.string	"my_numa_id"
+.LASF2174:
+	.string	"throw_exception"
+.LASF96:
+	.string	"_ZNSt15__new_allocatorIcEC4ERKS0_"
+.LASF1386:
+	.string	"_ZSt24make_obj_using_allocatorI5PointNSt3pmr21polymorphic_allocatorISt4byteEEJRlS5_EET_RKT0_DpOT1_"
+.LASF128:
+	.string	"cend"
+.LASF220:
+	.string	"pointer"
+.LASF1693:
+	.string	"__isoc99_vwscanf"
+.LASF1862:
+	.string	"operator tbb::detail::d0::split"
+.LASF1492:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEpLEl"
+.LASF1854:
+	.string	"executed"
+.LASF1589:
+	.string	"sequenced_policy"
+.LASF1844:
+	.string	"_ZN3tbb6detail2d09no_assignaSERKS2_"
+.LASF1340:
+	.string	"__get_helper<1, long int&>"
+.LASF1504:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIiEiE27_S_propagate_on_move_assignEv"
+.LASF2345:
+	.string	"typedef __va_list_tag __va_list_tag"
+.LASF450:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofEPKcm"
+.LASF103:
+	.string	"allocator<char>"
+.LASF247:
+	.string	"_M_string_length"
+.LASF398:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8pop_backEv"
+.LASF682:
+	.string	"_ZNVSt13__atomic_baseImEaNEm"
+.LASF1853:
+	.string	"pending"
+.LASF2166:
+	.string	"_ZN3tbb6detail2d112pre_scan_tagcvbEv"
+.LASF163:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4copyEPcmm"
+.LASF722:
+	.string	"_ZNSt6atomicImEC4Em"
+.LASF1222:
+	.string	"_ZNVKSt13__atomic_baseIPN3tbb6detail2r15arenaEE4loadESt12memory_order"
+.LASF1119:
+	.string	"_ZNKSt6vectorIiSaIiEE4cendEv"
+.LASF1295:
+	.string	"_ZNSt11_Tuple_implILm1EJRlEE7_M_headERKS1_"
+.LASF1137:
+	.string	"_ZNKSt6vectorIiSaIiEE5frontEv"
+.LASF2341:
+	.string	"byte"
+.LASF1272:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEE23compare_exchange_strongERS4_S4_St12memory_orderS7_"
+.LASF110:
+	.string	"~allocator"
+.LASF14:
+	.string	"__swappable_details"
+.LASF504:
+	.string	"operator++"
+.LASF519:
+	.string	"operator&="
+.LASF1966:
+	.string	"original_slot"
+.LASF301:
+	.string	"_M_erase"
+.LASF914:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEE23compare_exchange_strongERS4_S4_St12memory_orderS7_"
+.LASF617:
+	.string	"_ZNKSt13__atomic_baseIjE12is_lock_freeEv"
+.LASF484:
+	.string	"relaxed"
+.LASF882:
+	.string	"_ZNKSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE11get_deleterEv"
+.LASF1902:
+	.string	"FLOW_INPUT_NODE"
+.LASF362:
+	.string	"operator+="
+.LASF2246:
+	.string	"make_value<long int&, long int&>"
+.LASF1869:
+	.string	"user_abort"
+.LASF375:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9push_backEc"
+.LASF2192:
+	.string	"_ZNK3tbb6detail2d211task_handlecvbEv"
+.LASF1139:
+	.string	"_ZNKSt6vectorIiSaIiEE4backEv"
+.LASF1435:
+	.string	"wchar_t"
+.LASF557:
+	.string	"_ZNSt13__atomic_baseIhE9fetch_addEhSt12memory_order"
+.LASF1754:
+	.string	"p_sep_by_space"
+.LASF469:
+	.string	"_Alloc"
+.LASF1454:
+	.string	"_S_always_equal"
+.LASF960:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE23compare_exchange_strongERS4_S4_St12memory_orderS7_"
+.LASF275:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17_M_use_local_dataEv"
+.LASF191:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindEPKcmm"
+.LASF1638:
+	.string	"_IO_write_base"
+.LASF1686:
+	.string	"vfwscanf"
+.LASF712:
+	.string	"_ZNSt13__atomic_baseImE8fetch_orEmSt12memory_order"
+.LASF967:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE9fetch_subElSt12memory_order"
+.LASF1098:
+	.string	"_ZNSt6vectorIiSaIiEEC4ERKS1_RKS0_"
+.LASF2290:
+	.string	"__alloc"
+.LASF1190:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<int const*, std::vector<int, std::allocator<int> > > >"
+.LASF1739:
+	.string	"wcstoull"
+.LASF546:
+	.string	"_ZNSt13__atomic_baseIhE23compare_exchange_strongERhhSt12memory_orderS2_"
+.LASF1735:
+	.string	"wcsstr"
+.LASF1709:
+	.string	"tm_isdst"
+.LASF2219:
+	.string	"aligner"
+.LASF1753:
+	.string	"p_cs_precedes"
+.LASF327:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE3endEv"
+.LASF479:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<char const*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >"
+.LASF1930:
+	.string	"FLOW_OBJECT_NAME"
+.LASF804:
+	.string	"_ZNSt15__uniq_ptr_implIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE4swapERS6_"
+.LASF372:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendEmc"
+.LASF52:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EOS0_"
+.LASF2140:
+	.string	"_ZNK3tbb6detail2d110task_arena9is_activeEv"
+.LASF507:
+	.string	"operator--"
+.LASF253:
+	.string	"_M_local_data"
+.LASF2133:
+	.string	"_ZN3tbb6detail2d110task_arena10initializeENS2_6attachE"
+.LASF829:
+	.string	"_ZNSt11_Tuple_implILm1EJN3tbb6detail2d211task_handle28task_handle_task_finalizer_tEEE7_M_swapERS5_"
+.LASF516:
+	.string	"operator-="
+.LASF926:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEC4Ev"
+.LASF1780:
+	.string	"int_fast16_t"
+.LASF1214:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEEpLEl"
+.LASF396:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5eraseEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_"
+.LASF1587:
+	.string	"__int128 unsigned"
+.LASF415:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE14_M_replace_auxEmmmc"
+.LASF883:
+	.string	"_ZNKSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEcvbEv"
+.LASF1003:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE21compare_exchange_weakERS4_S4_St12memory_orderS7_"
+.LASF2180:
+	.string	"arena"
+.LASF922:
+	.string	"__pointer_type"
+.LASF2136:
+	.string	"_ZN3tbb6detail2d110task_arena9terminateEv"
+.LASF1720:
+	.string	"wcstok"
+.LASF2112:
+	.string	"max_threads_per_core"
+.LASF660:
+	.string	"_ZNSt13__atomic_baseImEC4ERKS0_"
+.LASF456:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEPKc"
+.LASF1432:
+	.string	"short int"
+.LASF2270:
+	.string	"fits_inline"
+.LASF1619:
+	.string	"max_align_t"
+.LASF976:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEC4ES4_"
+.LASF2354:
+	.string	"__vtbl_ptr_type"
+.LASF576:
+	.string	"~atomic"
+.LASF2343:
+	.string	"11max_align_t"
+.LASF656:
+	.string	"__atomic_base<long unsigned int>"
+.LASF1510:
+	.string	"__normal_iterator<int const*, std::vector<int, std::allocator<int> > >"
+.LASF2030:
+	.string	"_ZN3tbb6detail2d122cache_aligned_resourceC4Ev"
+.LASF1380:
+	.string	"_ZSt5applyIZSt39uninitialized_construct_using_allocatorI5PointNSt3pmr21polymorphic_allocatorISt4byteEEJRlS6_EEPT_S8_RKT0_DpOT1_EUlDpOT_E_St5tupleIJS6_S6_EEEDcOS7_OS9_"
+.LASF261:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11_M_is_localEv"
+.LASF800:
+	.string	"_ZNKSt15__uniq_ptr_implIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE10_M_deleterEv"
+.LASF695:
+	.string	"_ZNSt13__atomic_baseImE21compare_exchange_weakERmmSt12memory_orderS2_"
+.LASF2085:
+	.string	"constraints"
+.LASF1015:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE9fetch_subElSt12memory_order"
+.LASF849:
+	.string	"_ZNSt11_Tuple_implILm0EJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEEC4EOS7_"
+.LASF1574:
+	.string	"srand"
+.LASF2098:
+	.string	"task_arena_base"
+.LASF2175:
+	.string	"_ZN3tbb6detail2r115throw_exceptionENS0_2d012exception_idE"
+.LASF1311:
+	.string	"_ZNSt11_Tuple_implILm0EJRlS0_EE7_M_headERS1_"
+.LASF2352:
+	.string	"_ZNK3tbb6detail2d216task_handle_task3ctxEv"
+.LASF2165:
+	.string	"_ZN3tbb6detail2d112pre_scan_tag13is_final_scanEv"
+.LASF1251:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEEmmEi"
+.LASF2233:
+	.string	"lazy_value_using_allocator<lazy_emplace(void*, long int, long int)::<lambda()> >"
+.LASF2183:
+	.string	"suspend_point_type"
+.LASF1766:
+	.string	"localeconv"
+.LASF1255:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEEmmEv"
+.LASF509:
+	.string	"_ZNVSt13__atomic_baseIhEmmEi"
+.LASF390:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmmc"
+.LASF1873:
+	.string	"missing_wait"
+.LASF2306:
+	.string	"_ZZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS4_EEEPS1_PvPKvENUlDpOT_E_D4Ev"
+.LASF992:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEmIEl"
+.LASF513:
+	.string	"_ZNVSt13__atomic_baseIhEmmEv"
+.LASF212:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofEPKcm"
+.LASF1308:
+	.string	"_ZNSt10_Head_baseILm0ERlLb0EE7_M_headERS1_"
+.LASF1646:
+	.string	"_markers"
+.LASF2130:
+	.string	"_ZN3tbb6detail2d110task_arena10initializeEv"
+.LASF2042:
+	.string	"correct_size"
+.LASF938:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEppEi"
+.LASF1648:
+	.string	"_fileno"
+.LASF867:
+	.string	"unique_ptr"
+.LASF2:
+	.string	"operator std::integral_constant<bool, false>::value_type"
+.LASF1538:
+	.string	"__int_least32_t"
+.LASF1185:
+	.string	"_ZNSt16initializer_listIiEC4Ev"
+.LASF942:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEppEv"
+.LASF1163:
+	.string	"_M_shrink_to_fit"
+.LASF545:
+	.string	"compare_exchange_strong"
+.LASF1505:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIiEiE20_S_propagate_on_swapEv"
+.LASF263:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm"
+.LASF787:
+	.string	"_M_resource"
+.LASF2348:
+	.string	"string_resource_index"
+.LASF1984:
+	.string	"locked"
+.LASF905:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d118task_group_context5stateEE5storeES4_St12memory_order"
+.LASF2110:
+	.string	"core_type"
+.LASF1037:
+	.string	"_Vector_impl_data"
+.LASF752:
+	.string	"_ZNKSt6atomicIN3tbb6detail2d013do_once_stateEE12is_lock_freeEv"
+.LASF1958:
+	.string	"_ZN3tbb6detail2d112wait_contextC4Ej"
+.LASF671:
+	.string	"_ZNSt13__atomic_baseImEmmEi"
+.LASF1199:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEEC4ES4_"
+.LASF1250:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEEmmEi"
+.LASF870:
+	.string	"_ZNSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEED4Ev"
+.LASF1877:
+	.string	"unsafe_wait"
+.LASF1761:
+	.string	"int_n_cs_precedes"
+.LASF675:
+	.string	"_ZNSt13__atomic_baseImEmmEv"
+.LASF647:
+	.string	"_ZNSt6atomicIjEC4Ev"
+.LASF1254:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEEmmEv"
+.LASF400:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmRKS4_"
+.LASF1077:
+	.string	"__type_identity<std::allocator<int> >"
+.LASF1309:
+	.string	"_ZNSt10_Head_baseILm0ERlLb0EE7_M_headERKS1_"
+.LASF379:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEPKcm"
+.LASF2284:
+	.string	"__closure"
+.LASF75:
+	.string	"find"
+.LASF1205:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEEppEi"
+.LASF583:
+	.string	"__atomic_base<unsigned int>"
+.LASF1516:
+	.string	"__unknown__"
+.LASF612:
+	.string	"_ZNVSt13__atomic_baseIjEaNEj"
+.LASF1209:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEEppEv"
+.LASF2303:
+	.string	"_ZZZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKvENKUlS4_S4_E_clES4_S4_ENKUlS5_E_clES5_"
+.LASF1786:
+	.string	"uint_fast64_t"
+.LASF642:
+	.string	"_ZNSt13__atomic_baseIjE8fetch_orEjSt12memory_order"
+.LASF1244:
+	.string	"_ZNKSt6atomicIPN3tbb6detail2r15arenaEEcvS4_Ev"
+.LASF666:
+	.string	"_ZNVKSt13__atomic_baseImEcvmEv"
+.LASF1773:
+	.string	"int_least32_t"
+.LASF121:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4EDn"
+.LASF1814:
+	.string	"getchar"
+.LASF498:
+	.string	"_ZNSt13__atomic_baseIhEC4Eh"
+.LASF850:
+	.string	"_ZNSt11_Tuple_implILm0EJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEE7_M_swapERS7_"
+.LASF1847:
+	.string	"no_copy"
+.LASF1315:
+	.string	"_ZNSt11_Tuple_implILm0EJRlS0_EEC4Ev"
+.LASF1203:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEEaSES4_"
+.LASF492:
+	.string	"_ZNSt13__atomic_baseIhEC4Ev"
+.LASF979:
+	.string	"_ZNVKSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEcvS4_Ev"
+.LASF198:
+	.string	"find_last_of"
+.LASF1213:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEEpLEl"
+.LASF1889:
+	.string	"FLOW_BROADCAST_NODE"
+.LASF312:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_RKS3_"
+.LASF2078:
+	.string	"_ZN3tbb6detail2d110task_groupC4Ev"
+.LASF1030:
+	.string	"allocator_traits<std::allocator<int> >"
+.LASF705:
+	.string	"_ZNSt13__atomic_baseImE10notify_allEv"
+.LASF1449:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE27_S_propagate_on_copy_assignEv"
+.LASF1530:
+	.string	"__int32_t"
+.LASF1727:
+	.string	"wmemmove"
+.LASF711:
+	.string	"_ZNVSt13__atomic_baseImE9fetch_andEmSt12memory_order"
+.LASF294:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcS5_S5_"
+.LASF225:
+	.string	"_ZNSt11char_traitsIcE6assignERcRKc"
+.LASF958:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE21compare_exchange_weakERS4_S4_St12memory_orderS7_"
+.LASF631:
+	.string	"_ZNSt13__atomic_baseIjE23compare_exchange_strongERjjSt12memory_order"
+.LASF483:
+	.string	"placeholders"
+.LASF2094:
+	.string	"_ZN3tbb6detail2d110numa_nodesEv"
+.LASF364:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLEPKc"
+.LASF834:
+	.string	"_ZNSt10_Head_baseILm0EPN3tbb6detail2d216task_handle_taskELb0EEC4EOS5_"
+.LASF195:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofEcm"
+.LASF350:
+	.string	"clear"
+.LASF771:
+	.string	"memory_resource"
+.LASF1495:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmiEl"
+.LASF1439:
+	.string	"__gnu_cxx"
+.LASF1983:
+	.string	"created"
+.LASF1524:
+	.string	"lldiv_t"
+.LASF1445:
+	.string	"_S_on_swap"
+.LASF1364:
+	.string	"_ZSt15make_from_tupleI5PointSt5tupleIJRlS2_EEET_OT0_"
+.LASF1998:
+	.string	"my_node"
+.LASF2070:
+	.string	"_ZN3tbb6detail2d115task_group_base7contextEv"
+.LASF2143:
+	.string	"_ZNK3tbb6detail2d110task_arena15max_concurrencyEv"
+.LASF196:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofEPKcmm"
+.LASF1287:
+	.string	"_ZNSt10_Head_baseILm1ERlLb0EEC4ES0_"
+.LASF1247:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEEaSES4_"
+.LASF1884:
+	.string	"PARALLEL_SCAN"
+.LASF2031:
+	.string	"_ZN3tbb6detail2d122cache_aligned_resourceC4EPNSt3pmr15memory_resourceE"
+.LASF266:
+	.string	"_M_destroy"
+.LASF837:
+	.string	"_ZNSt10_Head_baseILm0EPN3tbb6detail2d216task_handle_taskELb0EE7_M_headERKS5_"
+.LASF1043:
+	.string	"_M_copy_data"
+.LASF41:
+	.string	"exception_ptr"
+.LASF1176:
+	.string	"_ZNSt6vectorIiSaIiEE15_M_erase_at_endEPi"
+.LASF242:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ENS4_12__sv_wrapperERKS3_"
+.LASF30:
+	.string	"_ZNSt15allocator_arg_tC4Ev"
+.LASF1157:
+	.string	"_M_fill_assign"
+.LASF2065:
+	.string	"task_group_base"
+.LASF1133:
+	.string	"_ZNKSt6vectorIiSaIiEE14_M_range_checkEm"
+.LASF762:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEE21compare_exchange_weakERS3_S3_St12memory_order"
+.LASF403:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmPKc"
+.LASF1990:
+	.string	"my_cancellation_requested"
+.LASF1982:
+	.string	"state"
+.LASF1886:
+	.string	"PARALLEL_PIPELINE"
+.LASF595:
+	.string	"_ZNKSt13__atomic_baseIjEcvjEv"
+.LASF1355:
+	.string	"get<1, long int&, long int&>"
+.LASF293:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcN9__gnu_cxx17__normal_iteratorIPKcS4_EESA_"
+.LASF1332:
+	.string	"iterator_traits<char const*>"
+.LASF2115:
+	.string	"_ZN3tbb6detail2d115task_arena_baseC4ERKNS1_11constraintsEjNS2_8priorityE"
+.LASF267:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_destroyEm"
+.LASF598:
+	.string	"_ZNVSt13__atomic_baseIjEaSEj"
+.LASF76:
+	.string	"_ZNSt11char_traitsIcE4findEPKcmRS1_"
+.LASF1383:
+	.string	"__invoke<xstd::ctor_args<Point>::make_value_using_allocator<long int&, long int&>(void const*, const alloc_t&)::<lambda(auto:22&& ...)>, long int&, long int&>"
+.LASF736:
+	.string	"this_thread"
+.LASF2052:
+	.string	"_vptr.task"
+.LASF1832:
+	.string	"difftime"
+.LASF708:
+	.string	"_ZNSt13__atomic_baseImE9fetch_subEmSt12memory_order"
+.LASF1018:
+	.string	"_ZNSt15__new_allocatorIiEC4Ev"
+.LASF1712:
+	.string	"wcslen"
+.LASF798:
+	.string	"_M_deleter"
+.LASF199:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofES2_m"
+.LASF1607:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy16__allow_parallelEv"
+.LASF466:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8containsEc"
+.LASF6:
+	.string	"integral_constant<bool, false>"
+.LASF385:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS4_EESt16initializer_listIcE"
+.LASF1146:
+	.string	"_ZNSt6vectorIiSaIiEE6insertEN9__gnu_cxx17__normal_iteratorIPKiS1_EEOi"
+.LASF1506:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIiEiE15_S_always_equalEv"
+.LASF1031:
+	.string	"_ZNSt16allocator_traitsISaIiEE8allocateERS0_m"
+.LASF170:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmPKc"
+.LASF262:
+	.string	"_M_create"
+.LASF2132:
+	.string	"_ZN3tbb6detail2d110task_arena10initializeENS1_11constraintsEjNS1_15task_arena_base8priorityE"
+.LASF87:
+	.string	"eq_int_type"
+.LASF329:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6rbeginEv"
+.LASF1346:
+	.string	"__make_from_tuple_impl<Point, std::tuple<long int&, long int&>, 0, 1>"
+.LASF1954:
+	.string	"add_reference"
+.LASF119:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4EPKc"
+.LASF614:
+	.string	"_ZNVSt13__atomic_baseIjEoREj"
+.LASF1552:
+	.string	"int16_t"
+.LASF1028:
+	.string	"_ZNSaIiE8allocateEm"
+.LASF1792:
+	.string	"__pos"
+.LASF1465:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEdeEv"
+.LASF2319:
+	.string	"_ZNSt10_Head_baseILm0ERlLb0EEC2ES0_"
+.LASF1236:
+	.string	"atomic<tbb::detail::r1::arena*>"
+.LASF1618:
+	.string	"__max_align_ld"
+.LASF570:
+	.string	"_ZNVSt13__atomic_baseIhE9fetch_xorEhSt12memory_order"
+.LASF1499:
+	.string	"_S_atomic"
+.LASF1374:
+	.string	"_ZSt12__get_helperILm0ERlJS0_EERKT0_RKSt11_Tuple_implIXT_EJS1_DpT1_EE"
+.LASF1617:
+	.string	"__max_align_ll"
+.LASF1972:
+	.string	"task_group_context_version"
+.LASF1458:
+	.string	"rebind<char>"
+.LASF1069:
+	.string	"_ZNSt12_Vector_baseIiSaIiEED4Ev"
+.LASF2169:
+	.string	"_ZN3tbb6detail2d114final_scan_tagcvbEv"
+.LASF2333:
+	.string	"direct_emplace"
+.LASF1136:
+	.string	"_ZNSt6vectorIiSaIiEE5frontEv"
+.LASF1156:
+	.string	"_ZNSt6vectorIiSaIiEE21_M_default_initializeEm"
+.LASF900:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEEaSES4_"
+.LASF601:
+	.string	"_ZNSt13__atomic_baseIjEmmEi"
+.LASF384:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS4_EEmc"
+.LASF280:
+	.string	"_M_limit"
+.LASF231:
+	.string	"basic_string<char, std::char_traits<char>, std::allocator<char> >"
+.LASF1112:
+	.string	"_ZNSt6vectorIiSaIiEE3endEv"
+.LASF779:
+	.string	"_ZNSt3pmr21polymorphic_allocatorISt4byteE10deallocateEPS1_m"
+.LASF755:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d013do_once_stateEE5storeES3_St12memory_order"
+.LASF1593:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy14__allow_vectorEv"
+.LASF448:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofERKS4_m"
+.LASF854:
+	.string	"tuple"
+.LASF1257:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEEpLEl"
+.LASF2084:
+	.string	"attach"
+.LASF1105:
+	.string	"_ZNSt6vectorIiSaIiEEaSERKS1_"
+.LASF1056:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE19_M_get_Tp_allocatorEv"
+.LASF416:
+	.string	"_M_replace"
+.LASF1452:
+	.string	"_S_propagate_on_swap"
+.LASF1333:
+	.string	"integer_sequence<long unsigned int, 0, 1>"
+.LASF515:
+	.string	"_ZNVSt13__atomic_baseIhEpLEh"
+.LASF1845:
+	.string	"_ZN3tbb6detail2d09no_assignC4ERKS2_"
+.LASF1858:
+	.string	"left"
+.LASF1819:
+	.string	"setbuf"
+.LASF897:
+	.string	"operator tbb::detail::d1::task_group_context::state"
+.LASF1580:
+	.string	"wctomb"
+.LASF433:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindEPKcmm"
+.LASF692:
+	.string	"_ZNVKSt13__atomic_baseImE4loadESt12memory_order"
+.LASF2172:
+	.string	"_ZN3tbb6detail2d15event4emitERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE"
+.LASF1965:
+	.string	"context"
+.LASF876:
+	.string	"operator->"
+.LASF2338:
+	.string	"_ZnwmPv"
+.LASF538:
+	.string	"_ZNSt13__atomic_baseIhE8exchangeEhSt12memory_order"
+.LASF316:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEED4Ev"
+.LASF1351:
+	.string	"_ZSt13__invoke_implIP5PointZN4xstd9ctor_argsIS0_Lm40EE29emplace_value_using_allocatorIJRlS6_EEES1_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEEEUlDpOT_E_JS6_S6_EET_St14__invoke_otherOT0_DpOT1_"
+.LASF1179:
+	.string	"_M_move_assign"
+.LASF143:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE8max_sizeEv"
+.LASF893:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEEC4ERKS5_"
+.LASF2261:
+	.string	"_ZNK4xstd13ctor_args_forI5PointJRlS2_EE12forward_argsEv"
+.LASF20:
+	.string	"__cust_access"
+.LASF1075:
+	.string	"_M_create_storage"
+.LASF677:
+	.string	"_ZNSt13__atomic_baseImEpLEm"
+.LASF94:
+	.string	"__new_allocator"
+.LASF1557:
+	.string	"tv_nsec"
+.LASF1256:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEEpLEl"
+.LASF2125:
+	.string	"_ZN3tbb6detail2d110task_arenaC4ERKNS1_11constraintsEjNS1_15task_arena_base8priorityE"
+.LASF1651:
+	.string	"_cur_column"
+.LASF1269:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEE21compare_exchange_weakERS4_S4_St12memory_orderS7_"
+.LASF434:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindEPKcm"
+.LASF2211:
+	.string	"ctor_args<Point, 40>"
+.LASF27:
+	.string	"__cust"
+.LASF84:
+	.string	"int_type"
+.LASF523:
+	.string	"_ZNSt13__atomic_baseIhEoREh"
+.LASF1280:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEE9fetch_addElSt12memory_order"
+.LASF2267:
+	.string	"pack_ops"
+.LASF55:
+	.string	"_ZNSt15__exception_ptr13exception_ptraSEOS0_"
+.LASF144:
+	.string	"empty"
+.LASF442:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofEPKcm"
+.LASF857:
+	.string	"_ZNSt5tupleIJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEEaSERKS7_"
+.LASF106:
+	.string	"_ZNSaIcEC4ERKS_"
+.LASF260:
+	.string	"_M_is_local"
+.LASF2254:
+	.string	"ctor_args_for<Point, long int&, long int&>"
+.LASF1481:
+	.string	"_Container"
+.LASF227:
+	.string	"_ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_"
+.LASF653:
+	.string	"is_always_lock_free"
+.LASF1748:
+	.string	"mon_grouping"
+.LASF1078:
+	.string	"_Type"
+.LASF1090:
+	.string	"_ZNSt6vectorIiSaIiEE11_S_relocateEPiS2_S2_RS0_"
+.LASF1198:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEEaSERKS5_"
+.LASF2187:
+	.string	"handle_impl_t"
+.LASF1736:
+	.string	"wmemchr"
+.LASF453:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareERKS4_"
+.LASF1567:
+	.string	"mblen"
+.LASF995:
+	.string	"_ZNVKSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE12is_lock_freeEv"
+.LASF427:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13get_allocatorEv"
+.LASF478:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<char*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >"
+.LASF1706:
+	.string	"tm_year"
+.LASF452:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6substrEmm"
+.LASF190:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindEcm"
+.LASF1263:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEE5storeES4_St12memory_order"
+.LASF1523:
+	.string	"7lldiv_t"
+.LASF2307:
+	.string	"_ZZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS4_EEEPS1_PvPKvENKUlDpOT_E_clIJS4_S4_EEEDaSB_"
+.LASF2163:
+	.string	"pre_scan_tag"
+.LASF85:
+	.string	"to_int_type"
+.LASF289:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_S_assignEPcmc"
+.LASF574:
+	.string	"atomic"
+.LASF586:
+	.string	"_ZNSt13__atomic_baseIjE12_S_alignmentE"
+.LASF370:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendEPKcm"
+.LASF1283:
+	.string	"remove_reference<const lazy_emplace(void*, long int, long int)::<lambda()> >"
+.LASF2120:
+	.string	"core_type_id"
+.LASF1127:
+	.string	"_ZNKSt6vectorIiSaIiEE8capacityEv"
+.LASF2063:
+	.string	"complete"
+.LASF1178:
+	.string	"_ZNSt6vectorIiSaIiEE8_M_eraseEN9__gnu_cxx17__normal_iteratorIPiS1_EES5_"
+.LASF2073:
+	.string	"~task_group_base"
+.LASF2324:
+	.string	"_ZNSt11_Tuple_implILm0EJRlS0_EEC2ES0_S0_"
+.LASF2088:
+	.string	"set_max_concurrency"
+.LASF22:
+	.string	"__cmp_cat"
+.LASF1081:
+	.string	"_ZNSt6vectorIiSaIiEE19_S_nothrow_relocateESt17integral_constantIbLb1EE"
+.LASF2347:
+	.string	"split"
+.LASF98:
+	.string	"_ZNSt15__new_allocatorIcE8allocateEmPKv"
+.LASF2096:
+	.string	"_ZN3tbb6detail2d119default_concurrencyEi"
+.LASF1229:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r15arenaEE4waitES4_St12memory_order"
+.LASF577:
+	.string	"_ZNSt6atomicIhED4Ev"
+.LASF24:
+	.string	"__atomic_spin_count_relax"
+.LASF1584:
+	.string	"strtoull"
+.LASF468:
+	.string	"_Traits"
+.LASF270:
+	.string	"_Char_alloc_type"
+.LASF334:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4cendEv"
+.LASF1849:
+	.string	"_ZN3tbb6detail2d07no_copyC4Ev"
+.LASF1545:
+	.string	"__off64_t"
+.LASF1718:
+	.string	"wcstod"
+.LASF12:
+	.string	"false_type"
+.LASF1719:
+	.string	"wcstof"
+.LASF172:
+	.string	"starts_with"
+.LASF808:
+	.string	"_ZNSt10_Head_baseILm1EN3tbb6detail2d211task_handle28task_handle_task_finalizer_tELb1EEC4Ev"
+.LASF1707:
+	.string	"tm_wday"
+.LASF1721:
+	.string	"wcstol"
+.LASF1175:
+	.string	"_M_erase_at_end"
+.LASF747:
+	.string	"operator tbb::detail::d0::do_once_state"
+.LASF1277:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEE10notify_oneEv"
+.LASF707:
+	.string	"_ZNVSt13__atomic_baseImE9fetch_addEmSt12memory_order"
+.LASF1883:
+	.string	"PARALLEL_REDUCE"
+.LASF290:
+	.string	"_S_copy_chars"
+.LASF2191:
+	.string	"_ZN3tbb6detail2d211task_handleaSEOS2_"
+.LASF1181:
+	.string	"_ZNSt6vectorIiSaIiEE14_M_move_assignEOS1_St17integral_constantIbLb0EE"
+.LASF46:
+	.string	"_ZNSt15__exception_ptr13exception_ptr10_M_releaseEv"
+.LASF1431:
+	.string	"signed char"
+.LASF517:
+	.string	"_ZNSt13__atomic_baseIhEmIEh"
+.LASF1942:
+	.string	"_ZN3tbb6detail2d117small_object_poolC4Ev"
+.LASF1605:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy19__allow_unsequencedEv"
+.LASF361:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4backEv"
+.LASF351:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5clearEv"
+.LASF1092:
+	.string	"_ZNSt6vectorIiSaIiEEC4Ev"
+.LASF903:
+	.string	"_ZNVKSt6atomicIN3tbb6detail2d118task_group_context5stateEE12is_lock_freeEv"
+.LASF980:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEaSES4_"
+.LASF1767:
+	.string	"uint8_t"
+.LASF997:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE5storeES4_St12memory_order"
+.LASF923:
+	.string	"_M_type_size"
+.LASF1888:
+	.string	"FLOW_NULL"
+.LASF387:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmRKS4_mm"
+.LASF2044:
+	.string	"m_upstream"
+.LASF1951:
+	.string	"_ZN3tbb6detail2d112wait_context13overflow_maskE"
+.LASF1857:
+	.string	"_ZN3tbb6detail2d018proportional_splitC4Emm"
+.LASF1087:
+	.string	"_ZNSt6vectorIiSaIiEE14_S_do_relocateEPiS2_S2_RS0_St17integral_constantIbLb1EE"
+.LASF2146:
+	.string	"_ZN3tbb6detail2d115max_concurrencyEv"
+.LASF1230:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r15arenaEE10notify_oneEv"
+.LASF503:
+	.string	"_ZNVSt13__atomic_baseIhEaSEh"
+.LASF1517:
+	.string	"__float128"
+.LASF1065:
+	.string	"_ZNSt12_Vector_baseIiSaIiEEC4EOS0_"
+.LASF2330:
+	.string	"direct_value"
+.LASF1273:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEE23compare_exchange_strongERS4_S4_St12memory_orderS7_"
+.LASF1597:
+	.string	"_ZN6__pstl9execution2v115parallel_policy19__allow_unsequencedEv"
+.LASF2288:
+	.string	"_ZZN4xstd9ctor_argsI5PointLm40EE29emplace_value_using_allocatorIJRlS4_EEEPS1_PvPKvRKNSt3pmr21polymorphic_allocatorISt4byteEEENUlDpOT_E_D4Ev"
+.LASF1664:
+	.string	"btowc"
+.LASF1020:
+	.string	"_ZNSt15__new_allocatorIiE8allocateEmPKv"
+.LASF1716:
+	.string	"wcsrtombs"
+.LASF649:
+	.string	"_ZNSt6atomicIjEC4ERKS0_"
+.LASF2196:
+	.string	"m_ctx"
+.LASF1498:
+	.string	"_S_mutex"
+.LASF1920:
+	.string	"FLOW_OUTPUT_PORT_0"
+.LASF1921:
+	.string	"FLOW_OUTPUT_PORT_1"
+.LASF1922:
+	.string	"FLOW_OUTPUT_PORT_2"
+.LASF1360:
+	.string	"_ZSt12construct_atI5PointJRlS1_EEDTgsnwcvPvLi0E_T_pispcl7declvalIT0_EEEEPS3_DpOS4_"
+.LASF1924:
+	.string	"FLOW_OUTPUT_PORT_4"
+.LASF1925:
+	.string	"FLOW_OUTPUT_PORT_5"
+.LASF1926:
+	.string	"FLOW_OUTPUT_PORT_6"
+.LASF1927:
+	.string	"FLOW_OUTPUT_PORT_7"
+.LASF1928:
+	.string	"FLOW_OUTPUT_PORT_8"
+.LASF1929:
+	.string	"FLOW_OUTPUT_PORT_9"
+.LASF1864:
+	.string	"my_left"
+.LASF838:
+	.string	"_Tuple_impl<0, tbb::detail::d2::task_handle_task*, tbb::detail::d2::task_handle::task_handle_task_finalizer_t>"
+.LASF45:
+	.string	"_ZNSt15__exception_ptr13exception_ptr9_M_addrefEv"
+.LASF1725:
+	.string	"wmemcmp"
+.LASF1447:
+	.string	"_S_propagate_on_copy_assign"
+.LASF157:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4dataEv"
+.LASF1533:
+	.string	"__uint64_t"
+.LASF2226:
+	.string	"p_ops"
+.LASF667:
+	.string	"_ZNSt13__atomic_baseImEaSEm"
+.LASF142:
+	.string	"max_size"
+.LASF1611:
+	.string	"__set_algo_cut_off"
+.LASF1177:
+	.string	"_ZNSt6vectorIiSaIiEE8_M_eraseEN9__gnu_cxx17__normal_iteratorIPiS1_EE"
+.LASF496:
+	.string	"_ZNSt13__atomic_baseIhEaSERKS0_"
+.LASF696:
+	.string	"_ZNVSt13__atomic_baseImE21compare_exchange_weakERmmSt12memory_orderS2_"
+.LASF803:
+	.string	"_ZNSt15__uniq_ptr_implIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE7releaseEv"
+.LASF66:
+	.string	"char_traits<char>"
+.LASF1132:
+	.string	"_M_range_check"
+.LASF757:
+	.string	"_ZNVKSt6atomicIN3tbb6detail2d013do_once_stateEE4loadESt12memory_order"
+.LASF925:
+	.string	"_ZNVKSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE12_M_type_sizeEl"
+.LASF862:
+	.string	"__uniq_ptr_data"
+.LASF162:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE4swapERS2_"
+.LASF688:
+	.string	"_ZNVKSt13__atomic_baseImE12is_lock_freeEv"
+.LASF1034:
+	.string	"_ZNSt16allocator_traitsISaIiEE8max_sizeERKS0_"
+.LASF1414:
+	.string	"_ZSt5applyIZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS5_EEEPS2_PvPKvEUlDpOT_E_RKSt5tupleIJS5_S5_EEEDcOT_OT0_"
+.LASF1116:
+	.string	"_ZNSt6vectorIiSaIiEE4rendEv"
+.LASF639:
+	.string	"_ZNVSt13__atomic_baseIjE9fetch_subEjSt12memory_order"
+.LASF657:
+	.string	"_ZNSt13__atomic_baseImE12_S_alignmentE"
+.LASF1956:
+	.string	"continue_execution"
+.LASF640:
+	.string	"_ZNSt13__atomic_baseIjE9fetch_andEjSt12memory_order"
+.LASF2212:
+	.string	"ops_table"
+.LASF735:
+	.string	"__parse_int"
+.LASF1963:
+	.string	"_ZN3tbb6detail2d112wait_context7releaseEj"
+.LASF425:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4dataEv"
+.LASF1459:
+	.string	"other"
+.LASF2162:
+	.string	"_ZN3tbb6detail2d120affinity_partitionerC4Ev"
+.LASF968:
+	.string	"atomic<tbb::detail::r1::tbb_exception_ptr*>"
+.LASF2157:
+	.string	"simple_partitioner"
+.LASF1294:
+	.string	"_ZNSt11_Tuple_implILm1EJRlEE7_M_headERS1_"
+.LASF2176:
+	.string	"current_context"
+.LASF1433:
+	.string	"long int"
+.LASF1870:
+	.string	"nonpositive_step"
+.LASF2072:
+	.string	"_ZN3tbb6detail2d115task_group_baseC4ERNS1_18task_group_contextE"
+.LASF89:
+	.string	"not_eof"
+.LASF1768:
+	.string	"uint16_t"
+.LASF807:
+	.string	"_Head_base"
+.LASF1362:
+	.string	"_ZSt13__invoke_implI5PointZN4xstd9ctor_argsIS0_Lm40EE26make_value_using_allocatorIJRlS5_EEES0_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEEEUlDpOT_E_JS5_S5_EET_St14__invoke_otherOT0_DpOT1_"
+.LASF1393:
+	.string	"__invoke<xstd::ctor_args<Point>::make_value<long int&, long int&>(void const*)::<lambda(auto:20&& ...)>, long int&, long int&>"
+.LASF419:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm"
+.LASF2237:
+	.string	"emplace_value_using_allocator<long int&, long int&>"
+.LASF2105:
+	.string	"my_num_reserved_slots"
+.LASF694:
+	.string	"_ZNVSt13__atomic_baseImE8exchangeEmSt12memory_order"
+.LASF186:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findEPKcmm"
+.LASF1822:
+	.string	"tmpnam"
+.LASF1453:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE20_S_propagate_on_swapEv"
+.LASF951:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE5storeES4_St12memory_order"
+.LASF1919:
+	.string	"FLOW_OUTPUT_PORT"
+.LASF131:
+	.string	"rbegin"
+.LASF1267:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEE8exchangeES4_St12memory_order"
+.LASF1430:
+	.string	"long long unsigned int"
+.LASF1407:
+	.string	"__apply_impl<xstd::ctor_args<Point>::make_value_using_allocator<long int&, long int&>(void const*, const alloc_t&)::<lambda(auto:22&& ...)>, const std::tuple<long int&, long int&>&, 0, 1>"
+.LASF1450:
+	.string	"_S_propagate_on_move_assign"
+.LASF1266:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEE8exchangeES4_St12memory_order"
+.LASF1818:
+	.string	"rewind"
+.LASF1726:
+	.string	"wmemcpy"
+.LASF188:
+	.string	"rfind"
+.LASF481:
+	.string	"__conditional<true>"
+.LASF1262:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEE5storeES4_St12memory_order"
+.LASF1088:
+	.string	"_ZNSt6vectorIiSaIiEE14_S_do_relocateEPiS2_S2_RS0_St17integral_constantIbLb0EE"
+.LASF1044:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE17_Vector_impl_data12_M_copy_dataERKS2_"
+.LASF310:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4EOS4_"
+.LASF2170:
+	.string	"suspend_point"
+.LASF1898:
+	.string	"FLOW_OVERWRITE_NODE"
+.LASF79:
+	.string	"copy"
+.LASF809:
+	.string	"_ZNSt10_Head_baseILm1EN3tbb6detail2d211task_handle28task_handle_task_finalizer_tELb1EEC4ERKS4_"
+.LASF1158:
+	.string	"_ZNSt6vectorIiSaIiEE14_M_fill_assignEmRKi"
+.LASF1578:
+	.string	"system"
+.LASF864:
+	.string	"_ZNSt15__uniq_ptr_dataIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tELb1ELb1EEaSEOS6_"
+.LASF1442:
+	.string	"__alloc_traits<std::allocator<char>, char>"
+.LASF1167:
+	.string	"_M_emplace_aux"
+.LASF730:
+	.string	"chrono"
+.LASF81:
+	.string	"_ZNSt11char_traitsIcE6assignEPcmc"
+.LASF1343:
+	.string	"_ZSt12__get_helperILm0ERlJS0_EERT0_RSt11_Tuple_implIXT_EJS1_DpT1_EE"
+.LASF2188:
+	.string	"m_handle"
+.LASF874:
+	.string	"operator*"
+.LASF1473:
+	.string	"operator+"
+.LASF281:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8_M_limitEmm"
+.LASF1476:
+	.string	"operator-"
+.LASF799:
+	.string	"_ZNSt15__uniq_ptr_implIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE10_M_deleterEv"
+.LASF998:
+	.string	"_ZNKSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE4loadESt12memory_order"
+.LASF2046:
+	.string	"intrusive_list_node"
+.LASF2122:
+	.string	"mark_initialized"
+.LASF1595:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy16__allow_parallelEv"
+.LASF1519:
+	.string	"div_t"
+.LASF53:
+	.string	"operator="
+.LASF2092:
+	.string	"numa_node_id"
+.LASF1219:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEE5storeES4_St12memory_order"
+.LASF810:
+	.string	"_ZNSt10_Head_baseILm1EN3tbb6detail2d211task_handle28task_handle_task_finalizer_tELb1EEC4ERKS5_"
+.LASF418:
+	.string	"_M_append"
+.LASF1235:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEE9fetch_subElSt12memory_order"
+.LASF1812:
+	.string	"ftell"
+.LASF486:
+	.string	"acquire"
+.LASF9:
+	.string	"operator std::integral_constant<bool, true>::value_type"
+.LASF1128:
+	.string	"_ZNKSt6vectorIiSaIiEE5emptyEv"
+.LASF1150:
+	.string	"_ZNSt6vectorIiSaIiEE5eraseEN9__gnu_cxx17__normal_iteratorIPKiS1_EES6_"
+.LASF1347:
+	.string	"_ZSt22__make_from_tuple_implI5PointSt5tupleIJRlS2_EEJLm0ELm1EEET_OT0_St16integer_sequenceImJXspT1_EEE"
+.LASF102:
+	.string	"_ZNKSt15__new_allocatorIcE11_M_max_sizeEv"
+.LASF449:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofEPKcmm"
+.LASF996:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE5storeES4_St12memory_order"
+.LASF842:
+	.string	"_M_tail"
+.LASF95:
+	.string	"_ZNSt15__new_allocatorIcEC4Ev"
+.LASF973:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEC4ERKS5_"
+.LASF2062:
+	.string	"not_complete"
+.LASF1836:
+	.string	"ctime"
+.LASF1216:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEEmIEl"
+.LASF174:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE11starts_withEc"
+.LASF691:
+	.string	"_ZNKSt13__atomic_baseImE4loadESt12memory_order"
+.LASF1460:
+	.string	"__normal_iterator<char*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >"
+.LASF1471:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEixEl"
+.LASF761:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d013do_once_stateEE21compare_exchange_weakERS3_S3_St12memory_orderS6_"
+.LASF2039:
+	.string	"_ZNK3tbb6detail2d122cache_aligned_resource11do_is_equalERKNSt3pmr15memory_resourceE"
+.LASF1058:
+	.string	"_ZNKSt12_Vector_baseIiSaIiEE13get_allocatorEv"
+.LASF579:
+	.string	"_ZNSt6atomicIhEaSERKS0_"
+.LASF1228:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r15arenaEE23compare_exchange_strongERS4_S4_St12memory_orderS7_"
+.LASF1571:
+	.string	"yield"
+.LASF1758:
+	.string	"n_sign_posn"
+.LASF1286:
+	.string	"_ZNSt10_Head_baseILm1ERlLb0EEC4Ev"
+.LASF1381:
+	.string	"__apply_impl<std::uninitialized_construct_using_allocator<Point, pmr::polymorphic_allocator<>, long int&, long int&>(Point*, const pmr::polymorphic_allocator<>&, long int&, long int&)::<lambda(auto:18&& ...)>, std::tuple<long int&, long int&>, 0, 1>"
+.LASF1170:
+	.string	"_ZNKSt6vectorIiSaIiEE12_M_check_lenEmPKc"
+.LASF1606:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy14__allow_vectorEv"
+.LASF1306:
+	.string	"_ZNSt10_Head_baseILm0ERlLb0EEC4EOS1_"
+.LASF2213:
+	.string	"make_value"
+.LASF1171:
+	.string	"_S_check_init_len"
+.LASF376:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignERKS4_"
+.LASF115:
+	.string	"size_type"
+.LASF2168:
+	.string	"_ZN3tbb6detail2d114final_scan_tag13is_final_scanEv"
+.LASF597:
+	.string	"_ZNSt13__atomic_baseIjEaSEj"
+.LASF745:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d013do_once_stateEEaSERKS4_"
+.LASF1464:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4ERKS1_"
+.LASF2244:
+	.string	"emplace_value<long int&, long int&>"
+.LASF1114:
+	.string	"_ZNSt6vectorIiSaIiEE6rbeginEv"
+.LASF1261:
+	.string	"_ZNVKSt6atomicIPN3tbb6detail2r15arenaEE12is_lock_freeEv"
+.LASF1938:
+	.string	"_ZN3tbb6detail2d15eventC4ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE"
+.LASF321:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSESt16initializer_listIcE"
+.LASF1663:
+	.string	"FILE"
+.LASF109:
+	.string	"_ZNSaIcEaSERKS_"
+.LASF1410:
+	.string	"_ZSt5applyIZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS5_EEEPS2_PvmPKvEUlS5_S5_E_RKSt5tupleIJS5_S5_EEEDcOT_OT0_"
+.LASF934:
+	.string	"_ZNVKSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEcvS4_Ev"
+.LASF1017:
+	.string	"__new_allocator<int>"
+.LASF1370:
+	.string	"_ZSt13__invoke_implI5PointZN4xstd9ctor_argsIS0_Lm40EE10make_valueIJRlS5_EEES0_PKvEUlDpOT_E_JS5_S5_EET_St14__invoke_otherOT0_DpOT1_"
+.LASF1134:
+	.string	"_ZNSt6vectorIiSaIiEE2atEm"
+.LASF981:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEaSES4_"
+.LASF388:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmPKcm"
+.LASF1537:
+	.string	"__uint_least16_t"
+.LASF255:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_M_local_dataEv"
+.LASF238:
+	.string	"__sv_type"
+.LASF221:
+	.string	"_ZNSt16allocator_traitsISaIcEE8allocateERS0_m"
+.LASF792:
+	.string	"_ZNSt15__uniq_ptr_implIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEC4EPS3_"
+.LASF994:
+	.string	"_ZNKSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE12is_lock_freeEv"
+.LASF941:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEppEv"
+.LASF940:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEmmEi"
+.LASF1310:
+	.string	"_Tuple_impl<0, long int&, long int&>"
+.LASF244:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12__sv_wrapperC4ESt17basic_string_viewIcS2_E"
+.LASF930:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEaSERKS5_"
+.LASF1084:
+	.string	"_ZNSt5tupleIJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEE31__nothrow_default_constructibleEv"
+.LASF654:
+	.string	"_ZNSt6atomicIhE19is_always_lock_freeE"
+.LASF944:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEmmEv"
+.LASF1525:
+	.string	"char"
+.LASF684:
+	.string	"_ZNVSt13__atomic_baseImEoREm"
+.LASF929:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEaSERKS5_"
+.LASF2245:
+	.string	"_ZN4xstd9ctor_argsI5PointLm40EE13emplace_valueIJRlS4_EEEPS1_PvPKv"
+.LASF1049:
+	.string	"_ZNSt12_Vector_baseIiSaIiEE12_Vector_implC4Ev"
+.LASF554:
+	.string	"notify_all"
+.LASF1270:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEE21compare_exchange_weakERS4_S4_St12memory_order"
+.LASF881:
+	.string	"_ZNSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE11get_deleterEv"
+.LASF2263:
+	.string	"make_ctor_args<Point, long int&, long int&>"
+.LASF2234:
+	.string	"emplace_n_lazy_value<lazy_emplace(void*, long int, long int)::<lambda()> >"
+.LASF181:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE8containsES2_"
+.LASF2224:
+	.string	"_ZNK4xstd9ctor_argsI5PointLm40EE20make_using_allocatorERKNSt3pmr21polymorphic_allocatorISt4byteEE"
+.LASF1827:
+	.string	"iswctype"
+.LASF2006:
+	.string	"_ZN3tbb6detail2d118task_group_context11make_traitsENS2_9kind_typeEm"
+.LASF2243:
+	.string	"_ZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKv"
+.LASF1329:
+	.string	"_ZNSt5tupleIJRlS0_EEC4ILb1ELb1EEES0_S0_"
+.LASF104:
+	.string	"allocator"
+.LASF1207:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEEmmEi"
+.LASF127:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6cbeginEv"
+.LASF404:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmmc"
+.LASF866:
+	.string	"unique_ptr<tbb::detail::d2::task_handle_task, tbb::detail::d2::task_handle::task_handle_task_finalizer_t>"
+.LASF474:
+	.string	"_ZNSt16initializer_listIcEC4Ev"
+.LASF1486:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEptEv"
+.LASF1710:
+	.string	"tm_gmtoff"
+.LASF2086:
+	.string	"set_numa_id"
+.LASF2000:
+	.string	"my_itt_caller"
+.LASF2216:
+	.string	"make_using_allocator"
+.LASF369:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendERKS4_mm"
+.LASF1692:
+	.string	"vwscanf"
+.LASF1497:
+	.string	"_S_single"
+.LASF978:
+	.string	"_ZNKSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEEcvS4_Ev"
+.LASF88:
+	.string	"_ZNSt11char_traitsIcE11eq_int_typeERKiS2_"
+.LASF83:
+	.string	"_ZNSt11char_traitsIcE12to_char_typeERKi"
+.LASF744:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEEaSERKS4_"
+.LASF426:
+	.string	"get_allocator"
+.LASF2329:
+	.string	"erased_value"
+.LASF1781:
+	.string	"int_fast32_t"
+.LASF455:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmRKS4_mm"
+.LASF636:
+	.string	"_ZNSt13__atomic_baseIjE9fetch_addEjSt12memory_order"
+.LASF2227:
+	.string	"buffer"
+.LASF1394:
+	.string	"_ZSt8__invokeIZN4xstd9ctor_argsI5PointLm40EE10make_valueIJRlS5_EEES2_PKvEUlDpOT_E_JS5_S5_EENSt15__invoke_resultIT_JDpT0_EE4typeEOSD_DpOSE_"
+.LASF1382:
+	.string	"_ZSt12__apply_implIZSt39uninitialized_construct_using_allocatorI5PointNSt3pmr21polymorphic_allocatorISt4byteEEJRlS6_EEPT_S8_RKT0_DpOT1_EUlDpOT_E_St5tupleIJS6_S6_EEJLm0ELm1EEEDcOS7_OS9_St16integer_sequenceImJXspT1_EEE"
+.LASF2014:
+	.string	"~task_group_context"
+.LASF1999:
+	.string	"my_exception"
+.LASF714:
+	.string	"_ZNSt13__atomic_baseImE9fetch_xorEmSt12memory_order"
+.LASF249:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_M_dataEPc"
+.LASF1010:
+	.string	"_ZNKSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE4waitES4_St12memory_order"
+.LASF1110:
+	.string	"_ZNSt6vectorIiSaIiEE5beginEv"
+.LASF457:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmPKc"
+.LASF1776:
+	.string	"uint_least16_t"
+.LASF655:
+	.string	"_ZNSt6atomicIjE19is_always_lock_freeE"
+.LASF462:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9ends_withESt17basic_string_viewIcS2_E"
+.LASF451:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofEcm"
+.LASF1906:
+	.string	"FLOW_COMPOSITE_NODE"
+.LASF1094:
+	.string	"_ZNSt6vectorIiSaIiEEC4EmRKS0_"
+.LASF1548:
+	.string	"__syscall_slong_t"
+.LASF2249:
+	.string	"ctor_args<lazy_emplace(void*, long int, long int)::<lambda()> >"
+.LASF151:
+	.string	"front"
+.LASF2109:
+	.string	"my_max_threads_per_core"
+.LASF2081:
+	.string	"_ZN3tbb6detail2d110task_group12run_and_waitEONS0_2d211task_handleE"
+.LASF383:
+	.string	"insert"
+.LASF189:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindES2_m"
+.LASF2077:
+	.string	"task_group"
+.LASF962:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE10notify_oneEv"
+.LASF1377:
+	.string	"uninitialized_construct_using_allocator<Point, std::pmr::polymorphic_allocator<>, long int&, long int&>"
+.LASF2066:
+	.string	"m_wait_ctx"
+.LASF953:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE4loadESt12memory_order"
+.LASF2123:
+	.string	"_ZN3tbb6detail2d110task_arena16mark_initializedEv"
+.LASF551:
+	.string	"_ZNKSt13__atomic_baseIhE4waitEhSt12memory_order"
+.LASF155:
+	.string	"data"
+.LASF2283:
+	.string	"__make"
+.LASF1299:
+	.string	"_ZNSt11_Tuple_implILm1EJRlEEaSERKS1_"
+.LASF61:
+	.string	"_ZNKSt15__exception_ptr13exception_ptr20__cxa_exception_typeEv"
+.LASF948:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEmIEl"
+.LASF49:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4Ev"
+.LASF1676:
+	.string	"mbrtowc"
+.LASF505:
+	.string	"_ZNSt13__atomic_baseIhEppEi"
+.LASF391:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS4_EEc"
+.LASF879:
+	.string	"deleter_type"
+.LASF1581:
+	.string	"lldiv"
+.LASF1746:
+	.string	"mon_decimal_point"
+.LASF510:
+	.string	"_ZNSt13__atomic_baseIhEppEv"
+.LASF785:
+	.string	"resource"
+.LASF363:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLERKS4_"
+.LASF1572:
+	.string	"rand"
+.LASF165:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6substrEmm"
+.LASF2173:
+	.string	"_ZN3tbb6detail2d16resumeEPNS0_2r118suspend_point_typeE"
+.LASF1647:
+	.string	"_chain"
+.LASF112:
+	.string	"_ZNSaIcE8allocateEm"
+.LASF1153:
+	.string	"_M_fill_initialize"
+.LASF1558:
+	.string	"__compar_fn_t"
+.LASF765:
+	.string	"_ZNVSt6atomicIN3tbb6detail2d013do_once_stateEE23compare_exchange_strongERS3_S3_St12memory_orderS6_"
+.LASF819:
+	.string	"_Tuple_impl<1, tbb::detail::d2::task_handle::task_handle_task_finalizer_t>"
+.LASF766:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEE23compare_exchange_strongERS3_S3_St12memory_order"
+.LASF1798:
+	.string	"fpos_t"
+.LASF1461:
+	.string	"_M_current"
+.LASF645:
+	.string	"_ZNVSt13__atomic_baseIjE9fetch_xorEjSt12memory_order"
+.LASF1875:
+	.string	"invalid_key"
+.LASF2019:
+	.string	"is_group_execution_cancelled"
+.LASF1534:
+	.string	"__int_least8_t"
+.LASF526:
+	.string	"_ZNSt13__atomic_baseIhEeOEh"
+.LASF389:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmPKc"
+.LASF1144:
+	.string	"_ZNSt6vectorIiSaIiEE8pop_backEv"
+.LASF1622:
+	.string	"overflow_arg_area"
+.LASF1623:
+	.string	"reg_save_area"
+.LASF33:
+	.string	"__uses_alloc0"
+.LASF719:
+	.string	"_ZNSt6atomicImEC4ERKS0_"
+.LASF1540:
+	.string	"__int_least64_t"
+.LASF553:
+	.string	"_ZNSt13__atomic_baseIhE10notify_oneEv"
+.LASF2323:
+	.string	"__tail#0"
+.LASF1367:
+	.string	"__invoke_impl<Point*, xstd::ctor_args<Point>::emplace_value<long int&, long int&>(void*, void const*)::<lambda(auto:21&& ...)>, long int&, long int&>"
+.LASF1292:
+	.string	"_ZNSt10_Head_baseILm1ERlLb0EE7_M_headERKS1_"
+.LASF1093:
+	.string	"_ZNSt6vectorIiSaIiEEC4ERKS0_"
+.LASF1892:
+	.string	"FLOW_FUNCTION_NODE"
+.LASF313:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4EOS4_RKS3_"
+.LASF1586:
+	.string	"strtold"
+.LASF2302:
+	.string	"_ZZZN4xstd9ctor_argsI5PointLm40EE15emplace_n_valueIJRlS4_EEEPS1_PvmPKvENKUlS4_S4_E_clES4_S4_ENUlS5_E_D4Ev"
+.LASF463:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9ends_withEc"
+.LASF1583:
+	.string	"strtoll"
+.LASF1006:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE23compare_exchange_strongERS4_S4_St12memory_orderS7_"
+.LASF2054:
+	.string	"_ZN3tbb6detail2d14taskD4Ev"
+.LASF1260:
+	.string	"_ZNKSt6atomicIPN3tbb6detail2r15arenaEE12is_lock_freeEv"
+.LASF1756:
+	.string	"n_sep_by_space"
+.LASF311:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ESt16initializer_listIcERKS3_"
+.LASF699:
+	.string	"_ZNSt13__atomic_baseImE23compare_exchange_strongERmmSt12memory_orderS2_"
+.LASF1670:
+	.string	"fwprintf"
+.LASF2106:
+	.string	"my_priority"
+.LASF634:
+	.string	"_ZNSt13__atomic_baseIjE10notify_oneEv"
+.LASF180:
+	.string	"contains"
+.LASF1096:
+	.string	"_ZNSt6vectorIiSaIiEEC4ERKS1_"
+.LASF56:
+	.string	"~exception_ptr"
+.LASF530:
+	.string	"_ZNVKSt13__atomic_baseIhE12is_lock_freeEv"
+.LASF1259:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEEmIEl"
+.LASF1859:
+	.string	"_ZNK3tbb6detail2d018proportional_split4leftEv"
+.LASF258:
+	.string	"_M_set_length"
+.LASF1004:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r117tbb_exception_ptrEE21compare_exchange_weakERS4_S4_St12memory_order"
+.LASF518:
+	.string	"_ZNVSt13__atomic_baseIhEmIEh"
+.LASF1774:
+	.string	"int_least64_t"
+.LASF1751:
+	.string	"int_frac_digits"
+.LASF1851:
+	.string	"do_once_state"
+.LASF1852:
+	.string	"uninitialized"
+.LASF782:
+	.string	"deallocate_bytes"
+.LASF440:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofERKS4_m"
+.LASF1285:
+	.string	"_Head_base<1, long int&, false>"
+.LASF470:
+	.string	"initializer_list<char>"
+.LASF149:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE3endEv"
+.LASF946:
+	.string	"_ZNVSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEpLEl"
+.LASF1820:
+	.string	"setvbuf"
+.LASF2262:
+	.string	"m_args"
+.LASF111:
+	.string	"_ZNSaIcED4Ei"
+.LASF1658:
+	.string	"_freeres_list"
+.LASF1608:
+	.string	"par_unseq"
+.LASF1532:
+	.string	"__int64_t"
+.LASF1660:
+	.string	"__pad5"
+.LASF2059:
+	.string	"m_reserved"
+.LASF790:
+	.string	"__uniq_ptr_impl"
+.LASF1985:
+	.string	"dead"
+.LASF769:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEE10notify_oneEv"
+.LASF1109:
+	.string	"_ZNSt6vectorIiSaIiEE6assignESt16initializer_listIiE"
+.LASF679:
+	.string	"_ZNSt13__atomic_baseImEmIEm"
+.LASF1759:
+	.string	"int_p_cs_precedes"
+.LASF1258:
+	.string	"_ZNSt6atomicIPN3tbb6detail2r15arenaEEmIEl"
+.LASF1729:
+	.string	"wprintf"
+.LASF320:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSEOS4_"
+.LASF1633:
+	.string	"_IO_FILE"
+.LASF100:
+	.string	"_ZNSt15__new_allocatorIcE10deallocateEPcm"
+.LASF1301:
+	.string	"_ZNSt11_Tuple_implILm1EJRlEE7_M_swapERS1_"
+.LASF860:
+	.string	"__conditional_t"
+.LASF830:
+	.string	"_Head_base<0, tbb::detail::d2::task_handle_task*, false>"
+.LASF1327:
+	.string	"_ZNSt5tupleIJRlS0_EE4swapERS1_"
+.LASF1457:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE15_S_nothrow_moveEv"
+.LASF826:
+	.string	"_ZNSt11_Tuple_implILm1EJN3tbb6detail2d211task_handle28task_handle_task_finalizer_tEEEaSERKS5_"
+.LASF791:
+	.string	"_ZNSt15__uniq_ptr_implIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEC4Ev"
+.LASF1373:
+	.string	"_ZSt12__get_helperILm1ERlJEERKT0_RKSt11_Tuple_implIXT_EJS1_DpT1_EE"
+.LASF92:
+	.string	"ptrdiff_t"
+.LASF573:
+	.string	"atomic<unsigned char>"
+.LASF1480:
+	.string	"_Iterator"
+.LASF218:
+	.string	"reverse_iterator<char const*>"
+.LASF114:
+	.string	"basic_string_view<char, std::char_traits<char> >"
+.LASF210:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofEcm"
+.LASF937:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEEppEi"
+.LASF1620:
+	.string	"gp_offset"
+.LASF1264:
+	.string	"_ZNKSt6atomicIPN3tbb6detail2r15arenaEE4loadESt12memory_order"
+.LASF2064:
+	.string	"canceled"
+.LASF394:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5eraseEmm"
+.LASF1496:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEE4baseEv"
+.LASF1406:
+	.string	"_ZSt5applyIZN4xstd9ctor_argsI5PointLm40EE26make_value_using_allocatorIJRlS5_EEES2_PKvRKNSt3pmr21polymorphic_allocatorISt4byteEEEUlDpOT_E_RKSt5tupleIJS5_S5_EEEDcOT_OT0_"
+.LASF1335:
+	.string	"is_constructible_v"
+.LASF2280:
+	.string	"auto:18"
+.LASF1164:
+	.string	"_ZNSt6vectorIiSaIiEE16_M_shrink_to_fitEv"
+.LASF2336:
+	.string	"_ZdlPvS_"
+.LASF377:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEOS4_"
+.LASF2322:
+	.string	"_ZNSt11_Tuple_implILm1EJRlEEC2ES0_"
+.LASF120:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4EPKcm"
+.LASF438:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofEPKcm"
+.LASF171:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmPKcm"
+.LASF1319:
+	.string	"_ZNSt11_Tuple_implILm0EJRlS0_EEC4EOS1_"
+.LASF1802:
+	.string	"ferror"
+.LASF1909:
+	.string	"FLOW_INPUT_PORT_0"
+.LASF1910:
+	.string	"FLOW_INPUT_PORT_1"
+.LASF1911:
+	.string	"FLOW_INPUT_PORT_2"
+.LASF1912:
+	.string	"FLOW_INPUT_PORT_3"
+.LASF1913:
+	.string	"FLOW_INPUT_PORT_4"
+.LASF1914:
+	.string	"FLOW_INPUT_PORT_5"
+.LASF1915:
+	.string	"FLOW_INPUT_PORT_6"
+.LASF1916:
+	.string	"FLOW_INPUT_PORT_7"
+.LASF1917:
+	.string	"FLOW_INPUT_PORT_8"
+.LASF1918:
+	.string	"FLOW_INPUT_PORT_9"
+.LASF1592:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy19__allow_unsequencedEv"
+.LASF2239:
+	.string	"Args"
+.LASF417:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_replaceEmmPKcm"
+.LASF957:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r117tbb_exception_ptrEE21compare_exchange_weakERS4_S4_St12memory_orderS7_"
+.LASF2311:
+	.string	"auto:20"
+.LASF2308:
+	.string	"auto:21"
+.LASF2295:
+	.string	"auto:22"
+.LASF2292:
+	.string	"auto:23"
+.LASF2314:
+	.string	"auto:24"
+.LASF1685:
+	.string	"vfwprintf"
+.LASF1197:
+	.string	"_ZNSt13__atomic_baseIPN3tbb6detail2r15arenaEEaSERKS5_"
+.LASF889:
+	.string	"_ZNSt6atomicIN3tbb6detail2d118task_group_context5stateEE16_S_min_alignmentE"
+.LASF1553:
+	.string	"int32_t"
+.LASF1923:
+	.string	"FLOW_OUTPUT_PORT_3"
+.LASF2018:
+	.string	"_ZN3tbb6detail2d118task_group_context22cancel_group_executionEv"
+.LASF72:
+	.string	"length"
+.LASF659:
+	.string	"_ZNSt13__atomic_baseImED4Ev"
+.LASF1275:
+	.string	"_ZNVSt6atomicIPN3tbb6detail2r15arenaEE23compare_exchange_strongERS4_S4_St12memory_order"
+.LASF1667:
+	.string	"fputwc"
+.LASF2144:
+	.string	"current_thread_index"
+.LASF1551:
+	.string	"int8_t"
+.LASF1339:
+	.string	"_Res"
+.LASF2161:
+	.string	"affinity_partitioner"
+.LASF1502:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIiEiE10_S_on_swapERS1_S3_"
+.LASF1668:
+	.string	"fputws"
+.LASF1687:
+	.string	"__isoc99_vfwscanf"
+.LASF1415:
+	.string	"__apply_impl<xstd::ctor_args<Point>::emplace_value<long int&, long int&>(void*, void const*)::<lambda(auto:21&& ...)>, const std::tuple<long int&, long int&>&, 0, 1>"
+.LASF1714:
+	.string	"wcsncmp"
+.LASF1330:
+	.string	"iterator_traits<char*>"
+.LASF1120:
+	.string	"_ZNKSt6vectorIiSaIiEE7crbeginEv"
+.LASF1303:
+	.string	"_ZNSt10_Head_baseILm0ERlLb0EEC4Ev"
+.LASF1631:
+	.string	"mbstate_t"
+.LASF2167:
+	.string	"final_scan_tag"
+.LASF269:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc"
+.LASF1624:
+	.string	"wint_t"
+.LASF1826:
+	.string	"wctrans_t"
+.LASF742:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEED4Ev"
+.LASF572:
+	.string	"__atomic_base<unsigned char>"
+.LASF1494:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmIEl"
+.LASF1861:
+	.string	"_ZNK3tbb6detail2d018proportional_split5rightEv"
+.LASF2220:
+	.string	"bytes"
+.LASF1317:
+	.string	"_ZNSt11_Tuple_implILm0EJRlS0_EEC4ERKS1_"
+.LASF166:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareES2_"
+.LASF2269:
+	.string	"lazy_ops"
+.LASF1217:
+	.string	"_ZNKSt13__atomic_baseIPN3tbb6detail2r15arenaEE12is_lock_freeEv"
+.LASF859:
+	.string	"_ZNSt5tupleIJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEE4swapERS7_"
+.LASF2214:
+	.string	"emplace_into"
+.LASF840:
+	.string	"_ZNSt11_Tuple_implILm0EJPN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEEE7_M_headERKS7_"
+.LASF1564:
+	.string	"bsearch"
+.LASF878:
+	.string	"_ZNKSt10unique_ptrIN3tbb6detail2d216task_handle_taskENS2_11task_handle28task_handle_task_finalizer_tEE3getEv"
+.LASF739:
+	.string	"_ZNSt6atomicIN3tbb6detail2d013do_once_stateEE16_S_min_alignmentE"
+.LASF1141:
+	.string	"_ZNKSt6vectorIiSaIiEE4dataEv"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/ctor_args"
+.LASF0:
+	.string	"ctor_args.codegen.cpp"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,293 @@
+/* sample_vector.h                                                    -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// A minimal vector whose `emplace_back` takes a single `ctor_args<T>`
+/// rather than a variadic pack, showing how a non-template interface can
+/// still construct elements in place. Because elements are constructed
+/// directly in their slots via `ctor_args<T>::emplace_into`, `T` need not be
+/// movable, provided the capacity is reserved up front; growing the buffer
+/// requires `T` to be move constructible.
+///
+/// Storage comes from `malloc`, so that `resize` and `assign` of a
+/// trivially zero constructible `T` into fresh storage can get it already
+/// zeroed from `calloc` (which, for large sizes, maps zero pages lazily) and
+/// otherwise `memset` it, rather than constructing elements one at a time.
+
+#ifndef INCLUDED_SAMPLE_VECTOR
+#define INCLUDED_SAMPLE_VECTOR
+
+#include <ctor_args.h>
+#include <trivially_zero_constructible.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <execution>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace xstd
+{
+
+template <class T>
+class sample_vector
+{
+  T           *m_data     = nullptr;
+  std::size_t  m_size     = 0;
+  std::size_t  m_capacity = 0;
+
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "sample_vector does not support over-aligned types");
+
+  // Return storage for `n` objects, with all bytes zero if `zeroed`.
+  static T* allocate(std::size_t n, bool zeroed = false)
+  {
+    if (n > std::size_t(-1) / sizeof(T))
+      throw std::bad_array_new_length();
+    void *p = zeroed ? std::calloc(n, sizeof(T)) : std::malloc(n * sizeof(T));
+    if (! p)
+      throw std::bad_alloc();
+    return static_cast<T*>(p);
+  }
+  static void deallocate(T *p, std::size_t) { std::free(p); }
+
+  // True if `value` is a copy of `T{}` that can be made by zeroing bytes.
+  static bool is_zero_value(const T& value)
+  {
+    if constexpr (is_trivially_zero_constructible_v<T> &&
+                  std::is_trivially_copyable_v<T>) {
+      const unsigned char *p = reinterpret_cast<const unsigned char*>(&value);
+      return std::all_of(p, p + sizeof(T), [](unsigned char c){ return !c; });
+    }
+    else
+      return false;
+  }
+
+  // Destroy all elements and, if the capacity is less than `n`, replace the
+  // storage with zero-filled storage for `n` elements. Return true if the
+  // (new) storage is already zero-filled.
+  bool clear_for_zeroed(std::size_t n)
+  {
+    clear();
+    if (n <= m_capacity)
+      return false;
+    T *new_data = allocate(n, true);
+    deallocate(m_data, m_capacity);
+    m_data     = new_data;
+    m_capacity = n;
+    return true;
+  }
+
+  void grow_for(std::size_t n)
+  {
+    if (n > m_capacity - m_size)
+      reserve(std::max(m_size + n, 2 * m_capacity));
+  }
+
+  // Append `n` elements constructed by `construct(p)`, which constructs all
+  // of them in the array at `p` (or none, if it throws), and return a
+  // pointer to the first. If the buffer must grow, the new elements are
+  // constructed in the new buffer before the existing ones are moved out of
+  // the old one, so that `construct` may refer to existing elements.
+  template <class Construct>
+  T* append_with(std::size_t n, Construct construct)
+  {
+    if constexpr (std::is_move_constructible_v<T>) {
+      if (n > m_capacity - m_size) {
+        std::size_t new_capacity =
+          std::max(m_size + n, m_capacity ? 2 * m_capacity : 4);
+        T *new_data = allocate(new_capacity);
+        try {
+          construct(new_data + m_size);
+          try {
+            std::uninitialized_move_n(m_data, m_size, new_data);
+          }
+          catch (...) {
+            std::destroy_n(new_data + m_size, n);
+            throw;
+          }
+        }
+        catch (...) {
+          deallocate(new_data, new_capacity);
+          throw;
+        }
+        std::destroy_n(m_data, m_size);
+        deallocate(m_data, m_capacity);
+        m_data     = new_data;
+        m_capacity = new_capacity;
+        m_size    += n;
+        return m_data + m_size - n;
+      }
+    }
+
+    grow_for(n);  // Throws if immovable elements would have to move
+    construct(m_data + m_size);
+    m_size += n;
+    return m_data + m_size - n;
+  }
+
+public:
+  using value_type     = T;
+  using size_type      = std::size_t;
+  using iterator       = T*;
+  using const_iterator = const T*;
+
+  sample_vector() = default;
+  sample_vector(const sample_vector&) = delete;
+  sample_vector& operator=(const sample_vector&) = delete;
+
+  ~sample_vector()
+  {
+    std::destroy_n(m_data, m_size);
+    deallocate(m_data, m_capacity);
+  }
+
+  void clear()
+  {
+    std::destroy_n(m_data, m_size);
+    m_size = 0;
+  }
+
+  /// Change the size to `n`, value-initializing any new elements.
+  void resize(size_type n)
+  {
+    if (n <= m_size) {
+      std::destroy(m_data + n, m_data + m_size);
+      m_size = n;
+      return;
+    }
+
+    if constexpr (is_trivially_zero_constructible_v<T>) {
+      if (0 == m_size && clear_for_zeroed(n)) {
+        m_size = n;
+        return;
+      }
+    }
+    grow_for(n - m_size);
+    xstd::uninitialized_value_construct_n(m_data + m_size, n - m_size);
+    m_size = n;
+  }
+
+  /// Replace the contents with `n` copies of `value`.
+  void assign(size_type n, const T& value)
+  {
+    if (is_zero_value(value)) {
+      if (! clear_for_zeroed(n))
+        xstd::uninitialized_value_construct_n(m_data, n);
+      m_size = n;
+      return;
+    }
+
+    T copy(value);  // `value` might be an element
+    clear();
+    reserve(n);
+    std::uninitialized_fill_n(m_data, n, copy);
+    m_size = n;
+  }
+
+  void reserve(size_type n)
+  {
+    if (n <= m_capacity)
+      return;
+
+    if constexpr (std::is_move_constructible_v<T>) {
+      T *new_data = allocate(n);
+      try {
+        std::uninitialized_move_n(m_data, m_size, new_data);
+      }
+      catch (...) {
+        deallocate(new_data, n);
+        throw;
+      }
+      std::destroy_n(m_data, m_size);
+      deallocate(m_data, m_capacity);
+      m_data     = new_data;
+      m_capacity = n;
+    }
+    else if (m_data)
+      throw std::length_error("sample_vector: cannot grow immovable elements");
+    else {
+      m_data     = allocate(n);
+      m_capacity = n;
+    }
+  }
+
+  /// Construct a new element at the end directly from `args`.
+  /// `args` may refer to elements of this vector.
+  T& emplace_back(ctor_args<T> args)
+  {
+    return emplace_back<default_ctor_args_capacity>(args);
+  }
+
+  /// Same, for `ctor_args` of any capacity.
+  template <std::size_t Capacity>
+  T& emplace_back(const ctor_args<T, Capacity>& args)
+  {
+    T *p = nullptr;
+    append_with(1, [&](T *to) { p = args.emplace_into(to); });
+    return *p;
+  }
+
+  /// Append `n` elements, each constructed from `args`, which are decoded
+  /// only once and may refer to elements of this vector.
+  void append_n(size_type n, const ctor_args<T>& args)
+  {
+    append_n<default_ctor_args_capacity>(n, args);
+  }
+
+  /// Same, for `ctor_args` of any capacity.
+  template <std::size_t Capacity>
+  void append_n(size_type n, const ctor_args<T, Capacity>& args)
+  {
+    append_with(n, [&](T *to) { uninitialized_construct_n(to, n, args); });
+  }
+
+  /// Append `n` elements, each constructed from `args`, constructing
+  /// chunks concurrently as permitted by `policy`.
+  template <class ExecutionPolicy>
+    requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+  void append_n(ExecutionPolicy&& policy, size_type n,
+                const ctor_args<T>& args)
+  {
+    append_n<ExecutionPolicy, default_ctor_args_capacity>(
+      std::forward<ExecutionPolicy>(policy), n, args);
+  }
+
+  /// Same, for `ctor_args` of any capacity.
+  template <class ExecutionPolicy, std::size_t Capacity>
+    requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+  void append_n(ExecutionPolicy&& policy, size_type n,
+                const ctor_args<T, Capacity>& args)
+  {
+    append_with(n, [&](T *to) {
+      uninitialized_construct_n(std::forward<ExecutionPolicy>(policy), to, n,
+                                args);
+    });
+  }
+
+  size_type size() const     { return m_size; }
+  size_type capacity() const { return m_capacity; }
+  bool      empty() const    { return 0 == m_size; }
+
+  T&       operator[](size_type i)       { return m_data[i]; }
+  const T& operator[](size_type i) const { return m_data[i]; }
+
+  iterator       begin()       { return m_data; }
+  iterator       end()         { return m_data + m_size; }
+  const_iterator begin() const { return m_data; }
+  const_iterator end() const   { return m_data + m_size; }
+};
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_SAMPLE_VECTOR)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
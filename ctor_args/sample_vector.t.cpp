@@ -0,0 +1,231 @@
+/* sample_vector.t.cpp                                                -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+#include <sample_vector.h>
+#include <atomic>
+#include <chrono>
+#include <execution>
+#include <iostream>
+#include <string>
+#include <cassert>
+
+// Neither copyable nor movable.
+struct Pinned
+{
+  std::atomic<int> m_count;
+  std::string      m_name;
+  Pinned          *m_self;
+
+  Pinned(int c, std::string name)
+    : m_count(c), m_name(std::move(name)), m_self(this) { }
+  Pinned(const Pinned&) = delete;
+};
+
+struct Counted
+{
+  static int s_copies;
+  int m_v;
+
+  explicit Counted(int v) : m_v(v) { }
+  Counted(const Counted& other) : m_v(other.m_v) { ++s_copies; }
+  Counted(Counted&& other) noexcept : m_v(other.m_v) { }
+};
+
+int Counted::s_copies = 0;
+
+// Zero-initialized by its default constructor; opted in to being zeroed.
+struct Cell
+{
+  int  m_a = 0;
+  long m_b = 0;
+};
+
+template <>
+struct xstd::is_trivially_zero_constructible<Cell> : std::true_type { };
+
+// Compare appending elements one at a time, each through an indirect call,
+// with appending them all at once, serially and in parallel. Run with
+// `make sample_vector.test TEST_ARGS=bench CXXOPT=-O2`.
+void bench()
+{
+  constexpr std::size_t n = 10'000'000;
+  using clock = std::chrono::steady_clock;
+  auto ns_per_elem = [](clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(clock::now() - start)
+      .count() / n;
+  };
+  auto run = [&](auto append) {
+    xstd::sample_vector<std::pair<int, double>> v;
+    v.reserve(n);
+    append(v);  // Fault in the pages
+    xstd::sample_vector<std::pair<int, double>> w;
+    w.reserve(n);
+    auto start = clock::now();
+    append(w);
+    double result = ns_per_elem(start);
+    assert(n == w.size() && 7 == w[n - 1].first);
+    return result;
+  };
+
+  double one_at_a_time = run([](auto& v) {
+    for (std::size_t i = 0; i < n; ++i)
+      v.emplace_back({ 7, 1.5 });
+  });
+  double append_n = run([](auto& v) { v.append_n(n, { 7, 1.5 }); });
+  double append_n_par = run([](auto& v) {
+    v.append_n(std::execution::par, n, { 7, 1.5 });
+  });
+
+  std::cout << "ns/element: emplace_back " << one_at_a_time
+            << ", append_n " << append_n
+            << ", append_n(par) " << append_n_par
+            << " (" << std::thread::hardware_concurrency() << " threads)\n";
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1 && std::string(argv[1]) == "bench") {
+    bench();
+    return 0;
+  }
+
+  // `emplace_into` constructs in caller-provided storage.
+  {
+    alignas(Pinned) unsigned char raw[sizeof(Pinned)];
+    // `args` refers to its arguments, so they must outlive it.
+    int         count = 3;
+    std::string name  = "raw";
+    xstd::ctor_args<Pinned> args(count, name);
+    Pinned *p = args.emplace_into(raw);
+    assert(static_cast<void*>(p) == raw);
+    assert(3 == p->m_count && "raw" == p->m_name && p == p->m_self);
+    p->~Pinned();
+  }
+
+  // Lazy form constructs the callable's prvalue result in place.
+  {
+    alignas(Counted) unsigned char raw[sizeof(Counted)];
+    xstd::ctor_args<Counted> args([]{ return Counted(8); });
+    Counted *p = args.emplace_into(raw);
+    assert(8 == p->m_v);
+  }
+
+  // Immovable elements, constructed in place within reserved capacity.
+  {
+    xstd::sample_vector<Pinned> v;
+    v.reserve(3);
+    v.emplace_back({ 1, "one" });
+    v.emplace_back({ 2, std::string("two") });
+    Pinned& last = v.emplace_back(xstd::make_ctor_args<Pinned>(3, "three"));
+    assert(3 == v.size());
+    assert(&last == &v[2] && last.m_self == &last);
+    for (Pinned& p : v)
+      assert(p.m_self == &p);
+    assert("two" == v[1].m_name);
+
+    bool threw = false;
+    try {
+      v.emplace_back({ 4, "four" });
+    }
+    catch (const std::length_error&) {
+      threw = true;
+    }
+    assert(threw && 3 == v.size());
+  }
+
+  // Movable elements grow without copying.
+  {
+    xstd::sample_vector<Counted> v;
+    for (int i = 0; i < 100; ++i)
+      v.emplace_back({ i });
+    assert(100 == v.size() && 99 == v[99].m_v);
+    assert(0 == Counted::s_copies);
+  }
+
+  // Arguments may refer to elements of the vector, even when it grows.
+  {
+    xstd::sample_vector<std::string> v;
+    v.emplace_back({ 20, 'a' });
+    while (v.size() < v.capacity())
+      v.emplace_back({ v[0] });
+    std::size_t n = v.size();
+    v.emplace_back({ v[0] });
+    assert(n + 1 == v.size() && n < v.capacity());
+    assert(v[0] == v[n] && 20 == v[n].size());
+
+    v.append_n(2 * v.capacity(), { v[1] });
+    assert(v[0] == v.end()[-1]);
+    v.append_n(std::execution::par, 2 * v.capacity(), { v.end()[-1] });
+    assert(v[0] == v.end()[-1]);
+  }
+
+  // Bulk append, serially and in parallel.
+  {
+    xstd::sample_vector<Counted> v;
+    v.emplace_back({ -1 });
+    v.append_n(1000, { 5 });
+    assert(1001 == v.size() && -1 == v[0].m_v && 5 == v[1000].m_v);
+    v.append_n(std::execution::par, 50'000, { 6 });
+    assert(51'001 == v.size() && 5 == v[1000].m_v && 6 == v[51'000].m_v);
+    v.append_n(std::execution::seq, 0, { 7 });
+    assert(51'001 == v.size());
+
+    // Any capacity will do.
+    int eight = 8;
+    xstd::ctor_args<Counted, 64> wide(eight);
+    v.emplace_back(wide);
+    v.append_n(10, wide);
+    v.append_n(std::execution::par, 10, wide);
+    assert(51'022 == v.size() && 8 == v[51'001].m_v && 8 == v.end()[-1].m_v);
+
+    xstd::sample_vector<Pinned> pv;
+    pv.append_n(std::execution::par, 10'000, { 2, "pinned" });
+    for (Pinned& p : pv)
+      assert(p.m_self == &p && "pinned" == p.m_name);
+  }
+
+  // `resize` and `assign`, into fresh and into reused storage, with zeroing
+  // (`int`, `Cell`) and with constructors (`std::string`).
+  {
+    xstd::sample_vector<int> v;
+    v.resize(1000);
+    assert(1000 == v.size() && 0 == v[0] && 0 == v[999]);
+    v[10] = 5;
+    v.resize(10);
+    v.resize(20);
+    assert(20 == v.size() && 0 == v[10]);
+    v.assign(500, 0);
+    assert(500 == v.size() && 1000 <= v.capacity() && 0 == v[10]);
+    v.assign(3, 4);
+    assert(3 == v.size() && 4 == v[0] && 4 == v[2]);
+    v.assign(2000, 0);
+    assert(2000 == v.size() && 0 == v[1] && 0 == v[1999]);
+    v.assign(2, v[0] + 9);
+    assert(2 == v.size() && 9 == v[0] && 9 == v[1]);
+
+    xstd::sample_vector<Cell> cv;
+    cv.emplace_back({ 1, 2L });
+    cv.resize(100);
+    assert(1 == cv[0].m_a && 0 == cv[1].m_a && 0 == cv[99].m_b);
+    cv.assign(10, Cell{});
+    assert(10 == cv.size() && 0 == cv[0].m_a);
+    cv.assign(10, Cell{ 3, 4 });
+    assert(3 == cv[9].m_a && 4 == cv[9].m_b);
+
+    xstd::sample_vector<std::string> sv;
+    sv.assign(3, "abc");
+    sv.resize(5);
+    assert(5 == sv.size() && "abc" == sv[2] && sv[4].empty());
+    sv.assign(4, sv[0]);
+    assert(4 == sv.size() && "abc" == sv[3]);
+    sv.resize(1);
+    assert(1 == sv.size() && "abc" == sv[0]);
+  }
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
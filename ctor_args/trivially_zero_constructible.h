@@ -0,0 +1,121 @@
+/* trivially_zero_constructible.h                                     -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// A type is trivially zero constructible if a value-initialized object of
+/// that type has all-zero bytes, so that an array of them can be created with
+/// `memset` or obtained already zeroed from `calloc` (or fresh pages from the
+/// OS) instead of running a constructor per element.
+///
+/// Integral, floating-point, enumeration, and object-pointer types qualify
+/// by default. A class qualifies publicly by specializing
+/// `is_trivially_zero_constructible`. Alternatively, a class that does not
+/// want to advertise the property can still zero construct arrays of itself
+/// in its own member functions: `trivial_zero_construct<T>` is usable by
+/// anyone if `T` is publicly trivially zero constructible, and otherwise
+/// only by `T`, which is its friend.
+///
+/// `xstd::uninitialized_value_construct_n` uses `memset` for contiguous
+/// ranges of trivially zero constructible types.
+
+#ifndef INCLUDED_TRIVIALLY_ZERO_CONSTRUCTIBLE
+#define INCLUDED_TRIVIALLY_ZERO_CONSTRUCTIBLE
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace xstd
+{
+
+using namespace std;
+
+template <class Tp>
+struct is_trivially_zero_constructible
+  : bool_constant<is_integral_v<Tp> || is_enum_v<Tp> ||
+                  (is_pointer_v<Tp> && ! is_function_v<remove_pointer_t<Tp>>) ||
+                  (is_floating_point_v<Tp> && numeric_limits<Tp>::is_iec559)>
+{
+  // Specialize for class types whose value-initialized state is all-zero
+  // bytes. Pointers to data members are excluded because a null one is not
+  // all-zero bytes in common ABIs. Function pointers are excluded because
+  // the standard does not promise that a null one is all-zero bytes, even
+  // where a null object pointer is.
+};
+
+template <class Tp, size_t N>
+struct is_trivially_zero_constructible<Tp[N]>
+  : is_trivially_zero_constructible<remove_cv_t<Tp>> { };
+
+template <class Tp>
+inline constexpr bool is_trivially_zero_constructible_v =
+  is_trivially_zero_constructible<remove_cv_t<Tp>>::value;
+
+// True if storage filled by `memset` implicitly contains objects of type `Tp`
+// (C++20 implicit-lifetime types, approximated).
+template <class Tp>
+inline constexpr bool __is_implicit_lifetime_v =
+  is_scalar_v<Tp> || is_array_v<Tp> || is_aggregate_v<Tp> ||
+  (is_trivially_destructible_v<Tp> &&
+   (is_trivially_default_constructible_v<Tp> ||
+    is_trivially_copy_constructible_v<Tp> ||
+    is_trivially_move_constructible_v<Tp>));
+
+/// Constructing a `trivial_zero_construct<Tp>(p, n)` value-initializes the
+/// `n` objects in the uninitialized storage at `p` by zeroing their bytes.
+/// The constructor is public if `Tp` is trivially zero constructible;
+/// otherwise it is private, and only `Tp` itself may use it.
+template <class Tp>
+class trivial_zero_construct
+{
+  static_assert(__is_implicit_lifetime_v<Tp>,
+                "Zeroing bytes cannot create objects of this type");
+
+  friend Tp;
+
+  static void zero(Tp *p, size_t n)
+    { std::memset((void*) p, 0, n * sizeof(Tp)); }
+
+  trivial_zero_construct(Tp *p, size_t n)
+    requires (! is_trivially_zero_constructible_v<Tp>)
+    { zero(p, n); }
+
+public:
+  trivial_zero_construct(Tp *p, size_t n)
+    requires (is_trivially_zero_constructible_v<Tp>)
+    { zero(p, n); }
+};
+
+template <class Tp>
+trivial_zero_construct(Tp *p, size_t n) -> trivial_zero_construct<Tp>;
+
+/// Value-initialize `n` objects in the uninitialized storage at `first`,
+/// like `std::uninitialized_value_construct_n`, but with a single `memset`
+/// if the storage is contiguous and its elements are trivially zero
+/// constructible. Return the end of the constructed range.
+template <class ForwardIt, class Size>
+ForwardIt uninitialized_value_construct_n(ForwardIt first, Size n)
+{
+  using Tp = iter_value_t<ForwardIt>;
+  if constexpr (contiguous_iterator<ForwardIt> &&
+                is_trivially_zero_constructible_v<Tp>) {
+    if (n > 0)
+      trivial_zero_construct(std::to_address(first), size_t(n));
+    return first + (n > 0 ? n : 0);
+  }
+  else
+    return std::uninitialized_value_construct_n(first, n);
+}
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_TRIVIALLY_ZERO_CONSTRUCTIBLE)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
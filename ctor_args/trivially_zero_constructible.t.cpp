@@ -0,0 +1,183 @@
+/* trivially_zero_constructible.t.cpp                                 -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+#include <trivially_zero_constructible.h>
+#include <sample_vector.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cassert>
+
+using xstd::is_trivially_zero_constructible_v;
+
+// Publicly trivially zero constructible.
+struct Vec3
+{
+  double m_x, m_y, m_z;
+};
+
+template <>
+struct xstd::is_trivially_zero_constructible<Vec3> : std::true_type { };
+
+// Value-initialized state is all-zero bytes, but the class does not
+// advertise it. Only its own members may zero construct arrays of it.
+class Secret
+{
+  int  m_id;
+  long m_total;
+
+public:
+  Secret() : m_id(0), m_total(0) { }
+
+  static Secret *make_table(std::size_t n)
+  {
+    Secret *p = static_cast<Secret*>(std::malloc(n * sizeof(Secret)));
+    xstd::trivial_zero_construct(p, n);
+    return p;
+  }
+
+  bool is_zero() const { return 0 == m_id && 0 == m_total; }
+};
+
+// Counts default constructions, so must never be zeroed.
+struct Counted
+{
+  static int s_count;
+  int m_v;
+
+  Counted() : m_v(7) { ++s_count; }
+};
+
+int Counted::s_count = 0;
+
+enum class Color { red, green };
+
+static_assert(  is_trivially_zero_constructible_v<int>);
+static_assert(  is_trivially_zero_constructible_v<const unsigned char>);
+static_assert(  is_trivially_zero_constructible_v<double>);
+static_assert(  is_trivially_zero_constructible_v<Color>);
+static_assert(  is_trivially_zero_constructible_v<Vec3*>);
+static_assert(  is_trivially_zero_constructible_v<const void*>);
+static_assert(! is_trivially_zero_constructible_v<void (*)()>);
+static_assert(! is_trivially_zero_constructible_v<int (*)(int)>);
+static_assert(  is_trivially_zero_constructible_v<int[3][4]>);
+static_assert(  is_trivially_zero_constructible_v<const Vec3>);
+static_assert(  is_trivially_zero_constructible_v<Vec3[2]>);
+static_assert(! is_trivially_zero_constructible_v<int Vec3::*>);
+static_assert(! is_trivially_zero_constructible_v<Secret>);
+static_assert(! is_trivially_zero_constructible_v<Counted>);
+static_assert(! is_trivially_zero_constructible_v<std::string>);
+
+// Anyone may zero construct a publicly opted-in type; only `Secret` may zero
+// construct a `Secret`.
+static_assert(  std::is_constructible_v<xstd::trivial_zero_construct<Vec3>,
+                                        Vec3*, std::size_t>);
+static_assert(! std::is_constructible_v<xstd::trivial_zero_construct<Secret>,
+                                        Secret*, std::size_t>);
+
+// Compare value-initializing a large table element by element with getting
+// it from `calloc`, for `resize` and for `assign(n, T{})`. Run with
+// `make trivially_zero_constructible.test TEST_ARGS=bench CXXOPT=-O2`.
+void bench()
+{
+  constexpr std::size_t n = 1 << 24;  // 384MiB of `Vec3`
+  constexpr int reps = 10;
+  using clock = std::chrono::steady_clock;
+
+  // Print the time per element of `f`, which builds a table and returns a
+  // pointer to it.
+  auto time = [&](const char *name, auto f) {
+    double total = 0;
+    for (int r = 0; r < reps; ++r) {
+      auto start = clock::now();
+      auto table = f();
+      total += std::chrono::duration<double, std::nano>(clock::now() - start)
+        .count();
+      assert(n == table->size() && 0 == (*table)[n / 2].m_y);
+    }
+    std::cout << name << " (ns/element): " << total / (double(reps) * n)
+              << '\n';
+  };
+
+  time("std::vector resize", []{
+    auto v = std::make_unique<std::vector<Vec3>>();
+    v->resize(n);
+    return v;
+  });
+  time("sample_vector resize", []{
+    auto v = std::make_unique<xstd::sample_vector<Vec3>>();
+    v->resize(n);
+    return v;
+  });
+  time("std::vector assign", []{
+    auto v = std::make_unique<std::vector<Vec3>>();
+    v->assign(n, Vec3{});
+    return v;
+  });
+  time("sample_vector assign", []{
+    auto v = std::make_unique<xstd::sample_vector<Vec3>>();
+    v->assign(n, Vec3{});
+    return v;
+  });
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1 && std::string(argv[1]) == "bench") {
+    bench();
+    return 0;
+  }
+
+  // Contiguous storage of an opted-in type is zeroed.
+  {
+    std::vector<unsigned char> raw(100 * sizeof(Vec3), 0xff);
+    Vec3 *p = reinterpret_cast<Vec3*>(raw.data());
+    Vec3 *e = xstd::uninitialized_value_construct_n(p, 100);
+    assert(p + 100 == e);
+    for (Vec3 *q = p; q != e; ++q)
+      assert(0 == q->m_x && 0 == q->m_y && 0 == q->m_z);
+    assert(p == xstd::uninitialized_value_construct_n(p, 0));
+    assert(p == xstd::uninitialized_value_construct_n(p, -1));
+  }
+
+  // A class can zero construct its own arrays without opting in publicly.
+  {
+    Secret *table = Secret::make_table(1000);
+    for (std::size_t i = 0; i < 1000; ++i)
+      assert(table[i].is_zero());
+    std::free(table);
+  }
+
+  // Other types run their constructors.
+  {
+    alignas(Counted) unsigned char raw[10 * sizeof(Counted)];
+    Counted *p = reinterpret_cast<Counted*>(raw);
+    assert(p + 10 == xstd::uninitialized_value_construct_n(p, 10));
+    assert(10 == Counted::s_count && 7 == p[9].m_v);
+    std::destroy_n(p, 10);
+
+    std::vector<std::string> sv(3, "x");
+    std::destroy_n(sv.data(), 3);
+    xstd::uninitialized_value_construct_n(sv.begin(), 3);
+    assert(sv[0].empty() && sv[2].empty());
+  }
+
+  // Non-contiguous iterators use `std::uninitialized_value_construct_n`.
+  {
+    std::list<int> l{ 1, 2, 3 };
+    auto e = xstd::uninitialized_value_construct_n(l.begin(), 2);
+    assert(3 == *e && 0 == l.front());
+  }
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -0,0 +1,322 @@
+/* bitwise_comparable.h                                               -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// `is_bitwise_comparable<T>` is true if two objects of type `T` compare
+/// equal (with `==`) exactly when their object representations are
+/// identical. Integral and pointer types are bitwise comparable;
+/// floating-point types are not (`0.0 == -0.0`, `NaN != NaN`). A class opts
+/// in by declaring
+///
+///     operator xstd::opt_in<xstd::is_bitwise_comparable>();
+///
+/// which warrants that it has no padding and that its `operator==` compares
+/// all of its bytes. Like other opt-in declarations, it is not inherited by
+/// derived classes unless it is declared heritable.
+///
+/// `xstd::equal`, `find`, `count`, `mismatch`, and `lexicographical_compare`
+/// behave like their `std` counterparts, but on contiguous ranges of a
+/// bitwise-comparable type they compare bytes with `memcmp`, `memchr`, or,
+/// when compiled with `-mavx2`, AVX2 vector compares, instead of calling
+/// `operator==` once per element. `lexicographical_compare` still uses
+/// `operator<`, but only at the positions where the elements differ.
+
+#ifndef INCLUDED_BITWISE_COMPARABLE
+#define INCLUDED_BITWISE_COMPARABLE
+
+#include <opt_in_traits.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#ifdef __AVX2__
+# include <immintrin.h>
+#endif
+
+namespace xstd {
+
+template <class T>
+struct is_bitwise_comparable
+  : bool_constant<is_integral_v<remove_cv_t<T>> ||
+                  is_pointer_v<remove_cv_t<T>> ||
+                  (is_class_v<T> &&
+                   detect_opt_in<remove_cv_t<T>,
+                                 is_bitwise_comparable>::value)>
+{
+};
+
+template <class T>
+inline constexpr bool is_bitwise_comparable_v =
+  is_bitwise_comparable<T>::value;
+
+// True if `[I1, ...)` and `[I2, ...)` are contiguous ranges of the same
+// bitwise-comparable type, which can be compared as bytes.
+template <class I1, class I2>
+concept __bitwise_comparable_iterators =
+  contiguous_iterator<I1> && contiguous_iterator<I2> &&
+  is_same_v<iter_value_t<I1>, iter_value_t<I2>> &&
+  is_bitwise_comparable_v<iter_value_t<I1>>;
+
+// True if elements of the contiguous range `[I, ...)` can be compared with a
+// `V` as bytes.
+template <class I, class V>
+concept __bitwise_searchable =
+  contiguous_iterator<I> && is_same_v<iter_value_t<I>, remove_cvref_t<V>> &&
+  is_bitwise_comparable_v<iter_value_t<I>>;
+
+// Unsigned integer type of `N` bytes, or `void` if there is none.
+template <size_t N>
+using __bitwise_lane_t =
+  conditional_t<N == 1, uint8_t,
+  conditional_t<N == 2, uint16_t,
+  conditional_t<N == 4, uint32_t,
+  conditional_t<N == 8, uint64_t, void>>>>;
+
+template <class Lane>
+inline Lane __load_lane(const unsigned char *p)
+{
+  Lane ret;
+  std::memcpy(&ret, p, sizeof(Lane));
+  return ret;
+}
+
+#ifdef __AVX2__
+// Bit `i` of the result is set if byte `i` of the 32-byte blocks at `p` and
+// at `needle` belong to equal `Lane`s.
+template <class Lane>
+inline uint32_t __avx2_equal_mask(const unsigned char *p, __m256i needle)
+{
+  __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  __m256i eq;
+  if constexpr (sizeof(Lane) == 1)
+    eq = _mm256_cmpeq_epi8(block, needle);
+  else if constexpr (sizeof(Lane) == 2)
+    eq = _mm256_cmpeq_epi16(block, needle);
+  else if constexpr (sizeof(Lane) == 4)
+    eq = _mm256_cmpeq_epi32(block, needle);
+  else
+    eq = _mm256_cmpeq_epi64(block, needle);
+  return uint32_t(_mm256_movemask_epi8(eq));
+}
+
+template <class Lane>
+inline __m256i __avx2_broadcast(Lane v)
+{
+  if constexpr (sizeof(Lane) == 1)
+    return _mm256_set1_epi8(char(v));
+  else if constexpr (sizeof(Lane) == 2)
+    return _mm256_set1_epi16(short(v));
+  else if constexpr (sizeof(Lane) == 4)
+    return _mm256_set1_epi32(int(v));
+  else
+    return _mm256_set1_epi64x((long long)(v));
+}
+#endif
+
+// Return the index of the first of the `n` lanes starting at `p` that equals
+// `v`, or `n` if there is none.
+template <class Lane>
+size_t __find_lane(const unsigned char *p, size_t n, Lane v)
+{
+  size_t i = 0;
+  if constexpr (sizeof(Lane) == 1) {
+    const void *found = n ? std::memchr(p, v, n) : nullptr;
+    return found ? static_cast<const unsigned char*>(found) - p : n;
+  }
+#ifdef __AVX2__
+  constexpr size_t per_block = 32 / sizeof(Lane);
+  __m256i needle = __avx2_broadcast(v);
+  for (; n - i >= per_block; i += per_block) {
+    if (uint32_t mask = __avx2_equal_mask<Lane>(p + i * sizeof(Lane), needle))
+      return i + std::countr_zero(mask) / sizeof(Lane);
+  }
+#endif
+  for (; n - i >= 4; i += 4) {
+    // Test four lanes with one branch.
+    const unsigned char *q = p + i * sizeof(Lane);
+    if ((__load_lane<Lane>(q) == v) |
+        (__load_lane<Lane>(q + sizeof(Lane)) == v) |
+        (__load_lane<Lane>(q + 2 * sizeof(Lane)) == v) |
+        (__load_lane<Lane>(q + 3 * sizeof(Lane)) == v))
+      break;
+  }
+  for (; i < n; ++i)
+    if (__load_lane<Lane>(p + i * sizeof(Lane)) == v)
+      break;
+  return i;
+}
+
+// Return the number of the `n` lanes starting at `p` that equal `v`.
+template <class Lane>
+size_t __count_lane(const unsigned char *p, size_t n, Lane v)
+{
+  size_t i = 0, ret = 0;
+#ifdef __AVX2__
+  constexpr size_t per_block = 32 / sizeof(Lane);
+  __m256i needle = __avx2_broadcast(v);
+  for (; n - i >= per_block; i += per_block)
+    ret += std::popcount(__avx2_equal_mask<Lane>(p + i * sizeof(Lane),
+                                                 needle)) / sizeof(Lane);
+#endif
+  for (; i < n; ++i)
+    ret += __load_lane<Lane>(p + i * sizeof(Lane)) == v;
+  return ret;
+}
+
+// Return the index of the first byte that differs between the `n`-byte
+// arrays at `a` and `b`, or `n` if they are identical.
+inline size_t __mismatch_bytes(const unsigned char *a, const unsigned char *b,
+                               size_t n)
+{
+  size_t i = 0;
+#ifdef __AVX2__
+  for (; n - i >= 32; i += 32) {
+    __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+    uint32_t ne = ~uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+    if (ne)
+      return i + std::countr_zero(ne);
+  }
+#endif
+  // Let the C library's (vectorized) `memcmp` skip identical blocks.
+  constexpr size_t block = 256;
+  for (; n - i >= block && 0 == std::memcmp(a + i, b + i, block); i += block)
+    ;
+  for (; i < n && a[i] == b[i]; ++i)
+    ;
+  return i;
+}
+
+// Return the index of the first element that differs between the `n`-element
+// arrays at `a` and `b`, or `n` if they are equal.
+template <class T>
+inline size_t __mismatch_index(const T *a, const T *b, size_t n)
+{
+  return __mismatch_bytes(reinterpret_cast<const unsigned char*>(a),
+                          reinterpret_cast<const unsigned char*>(b),
+                          n * sizeof(T)) / sizeof(T);
+}
+
+template <class InputIt1, class InputIt2>
+constexpr bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2)
+{
+  if constexpr (__bitwise_comparable_iterators<InputIt1, InputIt2>) {
+    if !consteval {
+      size_t n = last1 - first1;
+      return 0 == n || 0 == std::memcmp(std::to_address(first1),
+                                        std::to_address(first2),
+                                        n * sizeof(iter_value_t<InputIt1>));
+    }
+  }
+  return std::equal(first1, last1, first2);
+}
+
+template <class InputIt1, class InputIt2>
+constexpr bool equal(InputIt1 first1, InputIt1 last1,
+                     InputIt2 first2, InputIt2 last2)
+{
+  if constexpr (__bitwise_comparable_iterators<InputIt1, InputIt2>) {
+    if (last1 - first1 != last2 - first2)
+      return false;
+    return xstd::equal(first1, last1, first2);
+  }
+  return std::equal(first1, last1, first2, last2);
+}
+
+template <class InputIt, class T>
+constexpr InputIt find(InputIt first, InputIt last, const T& value)
+{
+  using Lane = __bitwise_lane_t<sizeof(T)>;
+  if constexpr (__bitwise_searchable<InputIt, T> && ! is_void_v<Lane>) {
+    if !consteval {
+      Lane v;
+      std::memcpy(&v, std::addressof(value), sizeof(T));
+      return first + __find_lane(reinterpret_cast<const unsigned char*>(
+                                   std::to_address(first)),
+                                 last - first, v);
+    }
+  }
+  return std::find(first, last, value);
+}
+
+template <class InputIt, class T>
+constexpr iter_difference_t<InputIt>
+count(InputIt first, InputIt last, const T& value)
+{
+  using Lane = __bitwise_lane_t<sizeof(T)>;
+  if constexpr (__bitwise_searchable<InputIt, T> && ! is_void_v<Lane>) {
+    if !consteval {
+      Lane v;
+      std::memcpy(&v, std::addressof(value), sizeof(T));
+      return __count_lane(reinterpret_cast<const unsigned char*>(
+                            std::to_address(first)),
+                          last - first, v);
+    }
+  }
+  return std::count(first, last, value);
+}
+
+template <class InputIt1, class InputIt2>
+constexpr pair<InputIt1, InputIt2>
+mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2)
+{
+  if constexpr (__bitwise_comparable_iterators<InputIt1, InputIt2>) {
+    if !consteval {
+      auto i = __mismatch_index(std::to_address(first1),
+                                std::to_address(first2), last1 - first1);
+      return { first1 + i, first2 + i };
+    }
+  }
+  return std::mismatch(first1, last1, first2);
+}
+
+template <class InputIt1, class InputIt2>
+constexpr pair<InputIt1, InputIt2>
+mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2)
+{
+  if constexpr (__bitwise_comparable_iterators<InputIt1, InputIt2>) {
+    if (last2 - first2 < last1 - first1)
+      last1 = first1 + (last2 - first2);
+    return xstd::mismatch(first1, last1, first2);
+  }
+  return std::mismatch(first1, last1, first2, last2);
+}
+
+template <class InputIt1, class InputIt2>
+constexpr bool lexicographical_compare(InputIt1 first1, InputIt1 last1,
+                                       InputIt2 first2, InputIt2 last2)
+{
+  if constexpr (__bitwise_comparable_iterators<InputIt1, InputIt2>) {
+    if !consteval {
+      // Skip runs of identical elements. Elements that differ but are
+      // equivalent under `<` are skipped one at a time, as `std` would.
+      for (;;) {
+        auto [mid1, mid2] = xstd::mismatch(first1, last1, first2, last2);
+        if (mid1 == last1 || mid2 == last2)
+          return mid1 == last1 && mid2 != last2;
+        if (*mid1 < *mid2)
+          return true;
+        if (*mid2 < *mid1)
+          return false;
+        first1 = ++mid1;
+        first2 = ++mid2;
+      }
+    }
+  }
+  return std::lexicographical_compare(first1, last1, first2, last2);
+}
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_BITWISE_COMPARABLE)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
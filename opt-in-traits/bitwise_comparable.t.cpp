@@ -0,0 +1,253 @@
+/* bitwise_comparable.t.cpp                                           -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+#include <bitwise_comparable.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+#include <cassert>
+
+using xstd::opt_in;
+using xstd::is_bitwise_comparable_v;
+
+// Padding-free and compared member-wise, so equality is its bytes.
+struct Pixel
+{
+  std::uint8_t m_r, m_g, m_b, m_a;
+
+  operator opt_in<xstd::is_bitwise_comparable>();
+
+  friend bool operator==(const Pixel&, const Pixel&) = default;
+  friend auto operator<=>(const Pixel&, const Pixel&) = default;
+};
+
+// An odd-sized record, which has no integer lane of its own size.
+struct Record
+{
+  std::int32_t m_id, m_x, m_y;
+
+  operator opt_in<xstd::is_bitwise_comparable>();
+
+  friend bool operator==(const Record&, const Record&) = default;
+  friend auto operator<=>(const Record&, const Record&) = default;
+};
+
+// Same layout as `Record`, but has not opted in.
+struct PlainRecord
+{
+  std::int32_t m_id, m_x, m_y;
+
+  friend bool operator==(const PlainRecord&, const PlainRecord&) = default;
+};
+
+// Orders by key only, so elements can differ yet be equivalent under `<`.
+struct Keyed
+{
+  std::int32_t m_key, m_payload;
+
+  operator opt_in<xstd::is_bitwise_comparable>();
+
+  friend bool operator==(const Keyed&, const Keyed&) = default;
+  friend bool operator<(const Keyed& a, const Keyed& b)
+    { return a.m_key < b.m_key; }
+};
+
+struct DerivedRecord : Record { };
+
+static_assert(  is_bitwise_comparable_v<int>);
+static_assert(  is_bitwise_comparable_v<const unsigned char>);
+static_assert(  is_bitwise_comparable_v<Pixel*>);
+static_assert(! is_bitwise_comparable_v<double>);
+static_assert(  is_bitwise_comparable_v<Pixel>);
+static_assert(  is_bitwise_comparable_v<const Record>);
+static_assert(! is_bitwise_comparable_v<PlainRecord>);
+static_assert(! is_bitwise_comparable_v<DerivedRecord>);
+static_assert(! is_bitwise_comparable_v<std::string>);
+
+// The algorithms remain usable in constant expressions.
+constexpr bool constexpr_algorithms()
+{
+  std::array<int, 5> a{ 1, 2, 3, 2, 1 }, b{ 1, 2, 4, 2, 1 };
+  return (! xstd::equal(a.begin(), a.end(), b.begin()) &&
+          2 == *xstd::find(a.begin(), a.end(), 2) &&
+          2 == xstd::count(a.begin(), a.end(), 1) &&
+          3 == *xstd::mismatch(a.begin(), a.end(), b.begin()).first &&
+          xstd::lexicographical_compare(a.begin(), a.end(),
+                                        b.begin(), b.end()));
+}
+
+static_assert(constexpr_algorithms());
+
+template <class T>
+T make(int i);
+
+template <> std::uint8_t make(int i)  { return std::uint8_t(i * 7); }
+template <> std::int16_t make(int i)  { return std::int16_t(i * 7 - 300); }
+template <> int          make(int i)  { return i * 7 - 300; }
+template <> long         make(int i)  { return long(i) * 7 - 300; }
+template <> Pixel        make(int i)
+  { return Pixel{ std::uint8_t(i), std::uint8_t(i * 3), 7, 255 }; }
+template <> Record       make(int i)  { return Record{ i, -i, i * 3 }; }
+template <> PlainRecord  make(int i)  { return PlainRecord{ i, -i, i * 3 }; }
+
+/// Compare each `xstd` algorithm against its `std` counterpart on
+/// `std::vector<T>`s of every length up to 100, with a difference at or
+/// beyond every position.
+template <class T>
+void test_against_std()
+{
+  for (int n = 0; n <= 100; ++n) {
+    std::vector<T> a;
+    for (int i = 0; i < n; ++i)
+      a.push_back(make<T>(i % 37));
+
+    for (int d = 0; d <= n; ++d) {
+      std::vector<T> b = a;
+      if (d < n)
+        b[d] = make<T>(200);
+
+      assert(std::equal(a.begin(), a.end(), b.begin()) ==
+             xstd::equal(a.begin(), a.end(), b.begin()));
+      assert(std::equal(a.begin(), a.end(), b.begin(), b.end() - (d & 1)) ==
+             xstd::equal(a.begin(), a.end(), b.begin(), b.end() - (d & 1)));
+      assert(std::mismatch(a.begin(), a.end(), b.begin()) ==
+             xstd::mismatch(a.begin(), a.end(), b.begin()));
+      assert(std::mismatch(a.begin(), a.end(), b.begin(), b.begin() + d) ==
+             xstd::mismatch(a.begin(), a.end(), b.begin(), b.begin() + d));
+
+      T needle = d < n ? a[d] : make<T>(200);
+      assert(std::find(a.begin(), a.end(), needle) ==
+             xstd::find(a.begin(), a.end(), needle));
+      assert(std::count(a.begin(), a.end(), needle) ==
+             xstd::count(a.begin(), a.end(), needle));
+
+      if constexpr (requires(T x) { x < x; }) {
+        assert(std::lexicographical_compare(a.begin(), a.end(),
+                                            b.begin(), b.end()) ==
+               xstd::lexicographical_compare(a.begin(), a.end(),
+                                             b.begin(), b.end()));
+        assert(std::lexicographical_compare(b.begin(), b.end(),
+                                            a.begin(), a.begin() + d) ==
+               xstd::lexicographical_compare(b.begin(), b.end(),
+                                             a.begin(), a.begin() + d));
+      }
+    }
+  }
+}
+
+// Compare the element-wise `std` algorithms with their `xstd` counterparts,
+// each over 64K elements that differ only at the end. Run with
+// `make bitwise_comparable.test TEST_ARGS=bench CXXOPT=-O2` and, for the
+// AVX2 paths, with `make bitwise_comparable_avx2.test TEST_ARGS=bench ...`.
+void bench()
+{
+  constexpr std::size_t n = 1 << 16;  // Fits in L2 cache
+  constexpr int reps = 5000;
+  using clock = std::chrono::steady_clock;
+
+  std::vector<Pixel>  pixels(n, Pixel{ 1, 2, 3, 4 });
+  std::vector<Record> records(n, Record{ 1, 2, 3 }), records2 = records;
+  std::vector<int>    ints(n, 5), ints2 = ints;
+  Pixel  needle{ 9, 9, 9, 9 };
+  pixels.back() = needle;
+  records2.back().m_y = 4;
+  ints2.back() = 6;
+
+  // Print the time per element of `f` from `std` and `g` from `xstd`.
+  auto time = [&](const char *name, auto f, auto g) {
+    auto ns_per_elem = [&](auto h) {
+      long sink = 0;
+      auto start = clock::now();
+      for (int r = 0; r < reps; ++r) {
+        sink += h();
+        asm volatile("" : : : "memory");
+      }
+      assert(sink);
+      return std::chrono::duration<double, std::nano>(clock::now() - start)
+        .count() / (double(reps) * n);
+    };
+    double std_ns = ns_per_elem(f), xstd_ns = ns_per_elem(g);
+    std::cout << name << " (ns/element): std " << std_ns << ", xstd "
+              << xstd_ns << '\n';
+  };
+
+  auto pb = pixels.begin(), pe = pixels.end();
+  auto rb = records.begin(), re = records.end(), rb2 = records2.begin();
+  auto ib = ints.begin(), ie = ints.end();
+  auto ib2 = ints2.begin(), ie2 = ints2.end();
+
+  time("find Pixel",
+       [&]{ return std::find(pb, pe, needle) - pb; },
+       [&]{ return xstd::find(pb, pe, needle) - pb; });
+  time("count Pixel",
+       [&]{ return std::count(pb, pe, needle); },
+       [&]{ return xstd::count(pb, pe, needle); });
+  time("equal Record",
+       [&]{ return long(! std::equal(rb, re, rb2)); },
+       [&]{ return long(! xstd::equal(rb, re, rb2)); });
+  time("mismatch Record",
+       [&]{ return std::mismatch(rb, re, rb2).first - rb; },
+       [&]{ return xstd::mismatch(rb, re, rb2).first - rb; });
+  time("lexicographical_compare int",
+       [&]{ return long(std::lexicographical_compare(ib, ie, ib2, ie2)); },
+       [&]{ return long(xstd::lexicographical_compare(ib, ie, ib2, ie2)); });
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1 && std::string(argv[1]) == "bench") {
+    bench();
+    return 0;
+  }
+
+  test_against_std<std::uint8_t>();
+  test_against_std<std::int16_t>();
+  test_against_std<int>();
+  test_against_std<long>();
+  test_against_std<Pixel>();
+  test_against_std<Record>();
+  test_against_std<PlainRecord>();
+
+  // Signed elements are ordered by value, not by bytes.
+  {
+    std::vector<int> a{ 1, -1 }, b{ 1, 1 };
+    assert(xstd::lexicographical_compare(a.begin(), a.end(),
+                                         b.begin(), b.end()));
+    assert(! xstd::lexicographical_compare(b.begin(), b.end(),
+                                           a.begin(), a.end()));
+  }
+
+  // Differing elements that are equivalent under `<` do not decide the
+  // comparison.
+  {
+    std::vector<Keyed> a{ { 1, 0 }, { 2, 0 }, { 3, 0 } };
+    std::vector<Keyed> b{ { 1, 9 }, { 2, 9 }, { 4, 0 } };
+    assert(xstd::lexicographical_compare(a.begin(), a.end(),
+                                         b.begin(), b.end()));
+    assert(! xstd::lexicographical_compare(b.begin(), b.end(),
+                                           a.begin(), a.end()));
+    assert(! xstd::equal(a.begin(), a.end(), b.begin()));
+  }
+
+  // Non-contiguous ranges and mixed types use the `std` algorithms.
+  {
+    std::list<int> l{ 3, 1, 4, 1, 5 };
+    std::vector<long> v{ 3, 1, 4, 1, 5 };
+    assert(2 == xstd::count(l.begin(), l.end(), 1));
+    assert(xstd::equal(l.begin(), l.end(), v.begin()));
+    assert(4 == *xstd::find(v.begin(), v.end(), 4));
+  }
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -0,0 +1,82 @@
+// nested_trait.bench.cpp                                             -*-C++-*-
+
+// Compile-time benchmark for `DetectNestedTrait`: 4,000 class types, a
+// quarter of which declare the trait directly, a quarter through a CRTP
+// base, a quarter by inheriting a declaration that does not apply to them,
+// and a quarter not at all. `CBENCH_MODE` selects what is compiled:
+//
+//  0  the same types, with no trait queries (baseline)
+//  1  one query per type, using the pre-C++20 `sizeof` implementation
+//  2  one query per type, using the C++20 `requires` implementation
+//
+// Run with `make nested_trait.cbench`.
+
+#ifndef CBENCH_MODE
+# define CBENCH_MODE 2
+#endif
+
+#if CBENCH_MODE == 1
+# define BSLMF_NESTED_TRAIT_USE_SIZEOF
+#endif
+
+#include <nested_trait.h>
+
+static const int num_types = 4000;
+
+template <class T>
+struct BenchTrait : bslmf::DetectNestedTrait<BenchTrait, T> { };
+
+template <class T>
+struct CrtpBase
+{
+    BSLMF_DECLARE_NESTED_TRAIT2(BenchTrait, T);
+};
+
+template <int Id, int Kind = Id % 4>
+struct Type;
+
+template <int Id>
+struct Type<Id, 0>
+{
+    BSLMF_DECLARE_NESTED_TRAIT(BenchTrait);
+};
+
+template <int Id>
+struct Type<Id, 1> : CrtpBase<Type<Id> >
+{
+};
+
+template <int Id>
+struct Type<Id, 2> : Type<Id - 2>
+{
+};
+
+template <int Id>
+struct Type<Id, 3>
+{
+    int d_value;
+};
+
+// Number of types in `[First, Last)` that have the trait, split in halves so
+// that the recursion depth does not grow with the number of types.
+template <int First, int Last>
+constexpr int countTraits()
+{
+    if constexpr (Last - First == 1) {
+#if CBENCH_MODE == 0
+        return sizeof(Type<First>) ? First % 4 < 2 : 0;
+#else
+        return BenchTrait<Type<First> >::value;
+#endif
+    }
+    else {
+        return (countTraits<First, (First + Last) / 2>() +
+                countTraits<(First + Last) / 2, Last>());
+    }
+}
+
+static_assert(countTraits<0, num_types>() == num_types / 2);
+
+int main()
+{
+}
@@ -0,0 +1,149 @@
+// nested_trait.h                                                     -*-C++-*-
+
+// A class declares a nested trait with `BSLMF_DECLARE_NESTED_TRAIT(Trait)`
+// (or, in a CRTP base, `BSLMF_DECLARE_NESTED_TRAIT2(Trait, Derived)`), and
+// `bslmf::DetectNestedTrait<Trait, T>` detects it. A plain declaration is
+// not inherited by derived classes; a CRTP declaration applies only to the
+// class named as its second argument.
+//
+// Before C++20, detection uses overload resolution on a conversion to
+// `TraitWrapper`, measured with `sizeof`, followed by matching the
+// conversion operator's member-pointer type. In C++20 and later, it uses
+// `requires` expressions on the member pointer directly, which is much
+// cheaper to compile; define `BSLMF_NESTED_TRAIT_USE_SIZEOF` to use the
+// older implementation anyway.
+
+#ifndef INCLUDED_NESTED_TRAIT
+#define INCLUDED_NESTED_TRAIT
+
+#if __cplusplus >= 202002L && ! defined(BSLMF_NESTED_TRAIT_USE_SIZEOF)
+# define BSLMF_NESTED_TRAIT_USE_REQUIRES 1
+# include <type_traits>
+#else
+# define BSLMF_NESTED_TRAIT_USE_REQUIRES 0
+# include <cstddef>
+#endif
+
+namespace bsl {
+
+template <class T, T Val>
+struct integral_constant
+{
+    typedef integral_constant type;
+    static const T value = Val;
+
+    operator T() const { return value; }
+};
+
+typedef integral_constant<bool, true>  true_type;
+typedef integral_constant<bool, false> false_type;
+
+} // end namespace bsl
+
+namespace bslmf {
+
+template <template <class> class Trait, class T = void>
+struct TraitWrapper;
+
+template <template <class> class Trait>
+struct TraitWrapper<Trait, void>
+{
+};
+
+template <template <class> class Trait>
+struct TraitWrapperBase : TraitWrapper<Trait, void>
+{
+};
+
+template <template <class> class Trait, class T>
+struct TraitWrapper : TraitWrapperBase<Trait>
+{
+};
+
+#if BSLMF_NESTED_TRAIT_USE_REQUIRES
+
+// A plain declaration counts only if `T` itself declares it; an inherited
+// one names a member of the base class. A CRTP declaration counts if it
+// names `T`, wherever it is declared.
+template <template <class> class Trait, class T>
+struct DetectNestedTrait_Imp
+{
+    enum {
+        value = requires {
+            requires std::is_same_v<decltype(&T::operator TraitWrapper<Trait>),
+                                    TraitWrapper<Trait> (T::*)()>;
+        } || requires { &T::operator TraitWrapper<Trait, T>; }
+    };
+};
+
+#else // ! BSLMF_NESTED_TRAIT_USE_REQUIRES
+
+struct MatchAnyType
+{
+    template <class T>
+    MatchAnyType(const T&);  // IMPLICIT
+};
+
+template <class T, template <class> class Trait, TraitWrapper<Trait> (T::*)()>
+class OpMatch
+{
+};
+
+template <std::size_t SZ, template <class> class Trait, class T>
+struct DetectNestedTrait_Imp2 : bsl::false_type
+{
+    // A conversion to another class's `TraitWrapper<Trait, U>` (e.g., from a
+    // cut-and-paste error), or none at all, does not match.
+};
+
+template <template <class> class Trait, class T>
+struct DetectNestedTrait_Imp2<sizeof(char), Trait, T>
+{
+    template <class U>
+    static char check(OpMatch<U, Trait, &U::operator TraitWrapper<Trait> > *x);
+    template <class U>
+    static int  check(MatchAnyType);
+
+    enum { value = sizeof(check<T>(0)) == 1 };
+};
+
+template <template <class> class Trait, class T>
+struct DetectNestedTrait_Imp2<sizeof(short), Trait, T> : bsl::true_type
+{
+};
+
+template <template <class> class Trait, class T>
+struct DetectNestedTrait_Imp
+{
+    static T& tref();
+
+    template <class U>
+    static char check(TraitWrapper<Trait> x, int);
+    template <class U>
+    static short check(TraitWrapper<Trait, U> x, int);
+    template <class U>
+    static int check(TraitWrapperBase<Trait> x, int);
+    template <class U>
+    static long long check(MatchAnyType, ...);
+
+    enum { value = DetectNestedTrait_Imp2<sizeof(check<T>(tref(), 0)),
+                                          Trait, T>::value };
+};
+
+#endif // ! BSLMF_NESTED_TRAIT_USE_REQUIRES
+
+template <template <class> class Trait, class T>
+struct DetectNestedTrait :
+    bsl::integral_constant<bool, DetectNestedTrait_Imp<Trait, T>::value>
+{
+};
+
+# define BSLMF_DECLARE_NESTED_TRAIT(TRAIT) \
+    operator bslmf::TraitWrapper<TRAIT>()
+
+# define BSLMF_DECLARE_NESTED_TRAIT2(TRAIT, T)    \
+    operator bslmf::TraitWrapper<TRAIT, T>()
+
+}  // close package namespace
+
+#endif // ! defined(INCLUDED_NESTED_TRAIT)
@@ -1,6 +1,6 @@
 // nested_trait.t.cpp                                                 -*-C++-*-
 
-#include <iostream>
+#include <nested_trait.h>
 
 #if __cplusplus > 201101
 # define test_assert(c) static_assert(c, "")
@@ -9,112 +9,6 @@
 # define test_assert(c) assert(c)
 #endif
 
-namespace bsl {
-
-template <class T, T Val>
-struct integral_constant
-{
-    typedef integral_constant type;
-    static const T value = Val;
-
-    operator T() const { return value; }
-};
-
-typedef integral_constant<bool, true>  true_type;
-typedef integral_constant<bool, false> false_type;
-
-} // end namespace bsl
-
-namespace bslmf {
-
-
-struct MatchAnyType
-{
-    template <class T>
-    MatchAnyType(const T&);  // IMPLICIT
-};
-
-template <template <class> class Trait, class T = void>
-struct TraitWrapper;
-
-template <template <class> class Trait>
-struct TraitWrapper<Trait, void>
-{
-};
-
-template <template <class> class Trait>
-struct TraitWrapperBase : TraitWrapper<Trait, void>
-{
-};
-
-template <template <class> class Trait, class T>
-struct TraitWrapper : TraitWrapperBase<Trait>
-{
-};
-
-template <class T, template <class> class Trait, TraitWrapper<Trait> (T::*)()>
-class OpMatch
-{
-};
-
-template <std::size_t SZ, template <class> class Trait, class T>
-struct DetectNestedTrait_Imp2 : bsl::false_type
-{
-};
-
-template <template <class> class Trait, class T>
-struct DetectNestedTrait_Imp2<sizeof(char), Trait, T>
-{
-    template <class U>
-    static char check(OpMatch<U, Trait, &U::operator TraitWrapper<Trait> > *x);
-    template <class U>
-    static int  check(MatchAnyType);
-
-    enum { value = sizeof(check<T>(0)) == 1 };
-};
-
-template <template <class> class Trait, class T>
-struct DetectNestedTrait_Imp2<sizeof(short), Trait, T> : bsl::true_type
-{
-};
-
-template <template <class> class Trait, class T>
-struct DetectNestedTrait_Imp
-{
-    static T& tref();
-
-    // template <class U>
-    // static char check(OpMatch<U, Trait, &U::operator TraitWrapper<Trait> > *x);
-    template <class U>
-    static char check(TraitWrapper<Trait> x, int);
-    template <class U>
-    static short check(TraitWrapper<Trait, U> x, int);
-    template <class U>
-    static int check(TraitWrapperBase<Trait> x, int);
-    template <class U>
-    static long long check(MatchAnyType, ...);
-
-    static_assert(sizeof(check<T>(tref(), 0)) != sizeof(int),
-                  "Nested-trait `TYPE` argument must match class name");
-
-    enum { value = DetectNestedTrait_Imp2<sizeof(check<T>(tref(), 0)),
-                                          Trait, T>::value };
-};
-
-template <template <class> class Trait, class T>
-struct DetectNestedTrait :
-    bsl::integral_constant<bool, DetectNestedTrait_Imp<Trait, T>::value>
-{
-};
-
-# define BSLMF_DECLARE_NESTED_TRAIT(TRAIT) \
-    operator bslmf::TraitWrapper<TRAIT>()
-
-# define BSLMF_DECLARE_NESTED_TRAIT2(TRAIT, T)    \
-    operator bslmf::TraitWrapper<TRAIT, T>()
-
-}  // close package namespace
-
 template <class T>
 struct MyTrait : bslmf::DetectNestedTrait<MyTrait, T> { };
 
@@ -0,0 +1,72 @@
+/* opt_in_traits.bench.cpp                                            -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// Compile-time benchmark for `detect_opt_in`: 1,000 class hierarchies, each
+// 10 levels deep, in which the root of every other hierarchy opts into a
+// heritable trait and the trait is queried at every level. Compiling with
+// `CBENCH_MODE=0` builds the same hierarchies without querying the trait,
+// as a baseline. Run with `make opt_in_traits.cbench`.
+
+#include <opt_in_traits.h>
+
+#ifndef CBENCH_MODE
+# define CBENCH_MODE 1
+#endif
+
+constexpr int num_hierarchies = 1000;
+constexpr int depth           = 10;
+
+template <class T>
+struct bench_trait : xstd::detect_opt_in<T, bench_trait> { };
+
+template <int Id, int Level>
+struct Node : Node<Id, Level - 1> { int m_level[Level]; };
+
+template <int Id>
+struct Node<Id, 0>
+{
+  operator xstd::opt_in<bench_trait, xstd::trait_heritability::heritable,
+                        Id % 2 == 0>();
+};
+
+// Number of levels in hierarchy `Id` for which the trait holds.
+template <int Id, int Level = depth - 1>
+constexpr int count_hierarchy()
+{
+#if CBENCH_MODE
+  constexpr int here = bench_trait<Node<Id, Level>>::value;
+#else
+  constexpr int here = sizeof(Node<Id, Level>) ? Id % 2 == 0 : 0;
+#endif
+  if constexpr (Level == 0)
+    return here;
+  else
+    return here + count_hierarchy<Id, Level - 1>();
+}
+
+// Total over hierarchies `[First, Last)`, split in halves so that neither
+// the recursion depth nor the size of any pack grows with the number of
+// hierarchies; a single huge pack expansion would itself compile in
+// quadratic time and swamp the measurement.
+template <int First, int Last>
+constexpr int count_all()
+{
+  if constexpr (Last - First == 1)
+    return count_hierarchy<First>();
+  else
+    return (count_all<First, (First + Last) / 2>() +
+            count_all<(First + Last) / 2, Last>());
+}
+
+static_assert(count_all<0, num_hierarchies>() == num_hierarchies / 2 * depth);
+
+int main()
+{
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
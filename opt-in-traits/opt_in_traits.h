@@ -0,0 +1,188 @@
+/* opt_in_traits.h                                                    -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// A class opts into (or out of) a trait by declaring a conversion operator to
+/// `opt_in<Trait>` (or `opt_out<Trait>`); the operator is never defined. A
+/// trait is implemented in terms of `detect_opt_in`:
+///
+///     template <class T>
+///     struct mytrait : xstd::detect_opt_in<T, mytrait> { };
+///
+///     struct X { operator xstd::opt_in<mytrait>(); };
+///     static_assert(mytrait<X>::value);
+///
+/// The declaration in the most-derived class that has one wins. A declaration
+/// applies to derived classes only if it is heritable, either explicitly or
+/// because `opt_in_defaults<Trait>::default_heritability` says so; otherwise,
+/// derived classes get the trait's default value, `false`.
+///
+/// Each (type, trait) query instantiates one `__opt_in_lookup` class and six
+/// specializations of a probe function, one per possible operator, each of
+/// which looks the operator up through all of the type's bases. A derived
+/// class that inherits its declaration also instantiates the lookup for the
+/// base class that made the declaration, which is then shared by every class
+/// derived from it. The cost of a query thus grows with the depth of the
+/// hierarchy, and detection costs several times as much as building the
+/// types. Run `make opt_in_traits.cbench` to measure it.
+
+#ifndef INCLUDED_OPT_IN_TRAITS
+#define INCLUDED_OPT_IN_TRAITS
+
+#include <type_traits>
+
+namespace xstd {
+
+using namespace std;
+
+enum class trait_heritability {
+  default_heritability, not_heritable, heritable
+};
+
+template <template <class> class Trait,
+          trait_heritability Heritability =
+              trait_heritability::default_heritability,
+          bool Condition = true>
+struct opt_in { };
+
+template <template <class> class Trait,
+          trait_heritability Heritability =
+              trait_heritability::default_heritability,
+          bool Condition = true>
+using opt_out = opt_in<Trait, Heritability, !Condition>;
+
+/// Per-trait policy for opt-in declarations. Specialize this template to
+/// change the defaults for a specific trait.
+template <template <class> class Trait>
+struct opt_in_defaults
+{
+  // Heritability of a declaration that does not specify one.
+  constexpr static trait_heritability default_heritability =
+    trait_heritability::not_heritable;
+
+  // Most permissive heritability that a declaration may specify.
+  constexpr static trait_heritability max_heritability =
+    trait_heritability::heritable;
+};
+
+template <class Sp, trait_heritability Hy, bool Cond>
+struct __opt_in_tuple
+{
+  // Bundle of opt_in properties for a specific type. `Sp` is the class that
+  // declares the operator, or `void` if there is no declaration.
+  using scope                                       = Sp;
+  constexpr static trait_heritability heritability  = Hy;
+  constexpr static bool               condition     = Cond;
+};
+
+// Scope of the conversion operator that `&Tp::operator opt_in<...>` names,
+// deduced from the type of the member pointer. Declarations only; these are
+// used only in unevaluated operands.
+template <class Sp, template <class> class Trait,
+          trait_heritability Hy, bool Cond>
+Sp __opt_in_scope(opt_in<Trait, Hy, Cond> (Sp::*)());
+
+template <class Sp, template <class> class Trait,
+          trait_heritability Hy, bool Cond>
+Sp __opt_in_scope(opt_in<Trait, Hy, Cond> (Sp::*)() const);
+
+// Stand-in scope for an operator that is not declared. Each probe gets a
+// distinct, unrelated type, so `Tp*` never converts to it.
+template <int Probe> struct __no_opt_in { };
+
+template <class Tp, template <class> class Trait,
+          trait_heritability Hy, bool Cond, int Probe>
+auto __opt_in_probe(int)
+  -> decltype(__opt_in_scope(&Tp::operator opt_in<Trait, Hy, Cond>));
+
+template <class Tp, template <class> class Trait,
+          trait_heritability Hy, bool Cond, int Probe>
+__no_opt_in<Probe> __opt_in_probe(...);
+
+// Shorthand used in `__opt_in_lookup`. It is deliberately not a member: with
+// GCC 12, naming enumerators through a member alias in the template
+// arguments of the probes makes each instantiation cost time proportional to
+// the number of earlier ones.
+using __th = trait_heritability;
+
+template <class Tp, template <class> class Trait>
+struct __opt_in_lookup
+{
+  // Find the most-derived opt-in or opt-out declaration for `Trait` in `Tp`
+  // and compute whether `Trait` holds for `Tp`.
+
+  // The declaring class of each of the six possible operators.
+  using dt_scope =
+    decltype(__opt_in_probe<Tp, Trait, __th::default_heritability, true,
+                            0>(0));
+  using nt_scope =
+    decltype(__opt_in_probe<Tp, Trait, __th::not_heritable, true, 1>(0));
+  using ht_scope =
+    decltype(__opt_in_probe<Tp, Trait, __th::heritable, true, 2>(0));
+  using df_scope =
+    decltype(__opt_in_probe<Tp, Trait, __th::default_heritability, false,
+                            3>(0));
+  using nf_scope =
+    decltype(__opt_in_probe<Tp, Trait, __th::not_heritable, false, 4>(0));
+  using hf_scope =
+    decltype(__opt_in_probe<Tp, Trait, __th::heritable, false, 5>(0));
+
+  static_assert(
+    (is_same_v<dt_scope, nt_scope> + is_same_v<dt_scope, ht_scope> +
+     is_same_v<dt_scope, df_scope> + is_same_v<dt_scope, nf_scope> +
+     is_same_v<dt_scope, hf_scope> + is_same_v<nt_scope, ht_scope> +
+     is_same_v<nt_scope, df_scope> + is_same_v<nt_scope, nf_scope> +
+     is_same_v<nt_scope, hf_scope> + is_same_v<ht_scope, df_scope> +
+     is_same_v<ht_scope, nf_scope> + is_same_v<ht_scope, hf_scope> +
+     is_same_v<df_scope, nf_scope> + is_same_v<df_scope, hf_scope> +
+     is_same_v<nf_scope, hf_scope>) == 0,
+    "Cannot opt in/out of same trait twice in same scope");
+
+  // Overload resolution on a `Tp*` argument selects the most-derived
+  // declaring class. Candidates for undeclared operators are not viable.
+  static __opt_in_tuple<dt_scope, __th::default_heritability, true>
+    pick(dt_scope*);
+  static __opt_in_tuple<nt_scope, __th::not_heritable, true> pick(nt_scope*);
+  static __opt_in_tuple<ht_scope, __th::heritable, true> pick(ht_scope*);
+  static __opt_in_tuple<df_scope, __th::default_heritability, false>
+    pick(df_scope*);
+  static __opt_in_tuple<nf_scope, __th::not_heritable, false> pick(nf_scope*);
+  static __opt_in_tuple<hf_scope, __th::heritable, false> pick(hf_scope*);
+  static __opt_in_tuple<void, __th::default_heritability, false> pick(...);
+
+  using deepest = decltype(pick(static_cast<Tp*>(nullptr)));
+  using scope   = typename deepest::scope;
+
+  // Heritability of the declaration, if `Tp` is its scope. A derived class
+  // uses the value memoized in its declaring base's instantiation instead.
+  constexpr static __th heritability =
+    (deepest::heritability == __th::default_heritability ?
+     opt_in_defaults<Trait>::default_heritability : deepest::heritability);
+
+  constexpr static bool value = [] {
+    if constexpr (is_void_v<scope>)
+      return false;
+    else if constexpr (is_same_v<scope, Tp>) {
+      static_assert(heritability <= opt_in_defaults<Trait>::max_heritability,
+                    "Cannot declare this trait as heritable");
+      return deepest::condition;
+    }
+    else
+      return (__opt_in_lookup<scope, Trait>::heritability == __th::heritable &&
+              __opt_in_lookup<scope, Trait>::value);
+  }();
+};
+
+/// `true_type` if `Tp` has opted into `Trait`, otherwise `false_type`.
+template <class Tp, template <class> class Trait>
+using detect_opt_in = bool_constant<__opt_in_lookup<Tp, Trait>::value>;
+
+}  // close namespace xstd
+
+#endif // ! defined(INCLUDED_OPT_IN_TRAITS)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
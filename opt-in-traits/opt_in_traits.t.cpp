@@ -0,0 +1,124 @@
+/* opt_in_traits.t.cpp                                                -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+#include <opt_in_traits.h>
+
+namespace proj {
+
+template <class T> struct mytrait : xstd::detect_opt_in<T, mytrait> { };
+
+// Uses the default policy: declarations are not heritable unless they say so.
+template <class T> struct othertrait : xstd::detect_opt_in<T, othertrait> { };
+
+}  // close namespace proj
+
+namespace xstd {
+template <>
+struct opt_in_defaults<proj::mytrait>
+{
+  constexpr static trait_heritability default_heritability = trait_heritability::not_heritable;
+  constexpr static trait_heritability max_heritability     = trait_heritability::heritable;
+};
+
+}
+
+namespace testproj {
+
+using xstd::opt_in;
+using xstd::opt_out;
+using xstd::trait_heritability;
+
+struct W1 { };
+
+struct X1 {
+  operator xstd::opt_in<proj::mytrait>();
+};
+
+struct Y1 : X1 { };
+
+struct Z1 : Y1 { };
+
+static_assert(! proj::mytrait<W1>::value);
+static_assert(! proj::mytrait<int>::value);
+static_assert(  proj::mytrait<X1>::value);
+static_assert(! proj::mytrait<Y1>::value);
+static_assert(! proj::mytrait<Z1>::value);
+
+struct X2 {
+  operator xstd::opt_in<proj::mytrait, xstd::trait_heritability::heritable>();
+};
+
+struct Y2 : X2 { };
+
+struct Z2 : Y2 { };
+
+static_assert(  proj::mytrait<X2>::value);
+static_assert(  proj::mytrait<Y2>::value);
+static_assert(  proj::mytrait<Z2>::value);
+
+struct X3 {
+  operator xstd::opt_in<proj::mytrait, xstd::trait_heritability::heritable>();
+};
+
+struct Y3 : X3 {
+  operator xstd::opt_out<proj::mytrait>();
+};
+
+struct Z3 : Y3 { };
+
+static_assert(  proj::mytrait<X3>::value);
+static_assert(! proj::mytrait<Y3>::value);
+static_assert(! proj::mytrait<Z3>::value);
+
+// A heritable opt-out beneath a heritable opt-in, and an opt-in again below
+// that.
+struct X4 {
+  operator opt_in<proj::mytrait, trait_heritability::heritable>();
+};
+
+struct Y4 : X4 {
+  operator opt_out<proj::mytrait, trait_heritability::heritable>();
+};
+
+struct Z4 : Y4 { };
+
+struct V4 : Z4 {
+  operator opt_in<proj::mytrait>() const;
+};
+
+struct U4 : V4 { };
+
+static_assert(  proj::mytrait<X4>::value);
+static_assert(! proj::mytrait<Y4>::value);
+static_assert(! proj::mytrait<Z4>::value);
+static_assert(  proj::mytrait<V4>::value);
+static_assert(! proj::mytrait<U4>::value);
+
+// Conditional opt-in, and traits are independent of one another.
+template <class T>
+struct Box {
+  operator opt_in<proj::othertrait, trait_heritability::default_heritability,
+                  std::is_integral_v<T>>();
+};
+
+static_assert(  proj::othertrait<Box<int>>::value);
+static_assert(! proj::othertrait<Box<double>>::value);
+static_assert(! proj::mytrait<Box<int>>::value);
+static_assert(! proj::othertrait<X2>::value);
+
+// `detect_opt_in` is a `bool_constant`.
+static_assert(std::is_base_of_v<std::true_type, proj::mytrait<X1>>);
+static_assert(std::is_base_of_v<std::false_type, proj::mytrait<W1>>);
+
+} // end namespace testproj
+
+int main()
+{
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
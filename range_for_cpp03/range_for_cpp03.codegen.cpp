@@ -0,0 +1,55 @@
+/* range_for_cpp03.codegen.cpp                                        -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// Codegen test: `RANGE_FOR` over an array compiles to the same code as the
+// equivalent hand-written loop, and no `RANGE_FOR` loop makes calls through
+// a pointer. Run with
+// `make range_for_cpp03.codegen`.
+
+#include <range_for_cpp03.h>
+#include <vector>
+
+// CHECK-SAME: hand_array range_for_array
+// CHECK-NO-INDIRECT-CALL: range_for_array
+extern "C" int hand_array(int (&a)[16])
+{
+  int sum = 0;
+  for (int *p = a; p != a + 16; ++p)
+    sum += *p;
+  return sum;
+}
+extern "C" int range_for_array(int (&a)[16])
+{
+  int sum = 0;
+  RANGE_FOR(int x, a)
+    sum += x;
+  return sum;
+}
+
+// `break` and class-type ranges add no calls of any kind. (The exact
+// instructions differ from a hand-written loop only in block order and
+// comparison operand order, so they are not compared.)
+// CHECK-NO-CALL: range_for_array_break range_for_vector
+extern "C" int range_for_array_break(int (&a)[16])
+{
+  int sum = 0;
+  RANGE_FOR(int x, a) {
+    if (x < 0)
+      break;
+    sum += x;
+  }
+  return sum;
+}
+
+extern "C" void range_for_vector(std::vector<int>& v)
+{
+  RANGE_FOR(int& x, v)
+    x *= 2;
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -7,26 +7,49 @@
 #ifndef INCLUDED_RANGE_FOR_CPP03
 #define INCLUDED_RANGE_FOR_CPP03
 
+#include <cstddef>
 #include <cstdlib>
+#include <iterator>
 #include <unparen.h>
 
+#ifdef _OPENMP
+# include <omp.h>
+#endif
+
 // Implement range-based for loop that works with C++03
 //
 // Supports:
 //  standard containers
 //  C-style arrays
 //  const ranges
-//  proxy iterators
+//  proxy iterators and sentinels (`end()` returning a different type)
+//  `break` and `continue`
 //
 // Limitations:
-//  The range's `end()` function is called each time through the loop instead
-//    of once at the start.
-//  Range must be an lvalue (but can be const), unless the `copyable_range`
-//    trait is true.
+//  In C++03, a temporary range must have a member `swap` (it is swapped
+//    into a default-constructed range rather than copied) or opt in via the
+//    `copyable_range` trait (it is copied). In C++11 and later, a temporary
+//    range is bound to a reference, extending its lifetime, and iterated in
+//    place.
+//  In C++03, a `const` temporary range (e.g., returned by a function with a
+//    `const` return type) is rejected at compile time.
 //  No support for `auto` variables in C++03 (of course)
 //  No support for structured binding loop variables in C++03 (of course)
 //  No support for C++20 lifetime extension of subparts of range expression
 //  No support for C++23 initialization clause
+//
+// Implementation:
+//  C++03 has no `auto` or `decltype`, so the state of the loop cannot be
+//  declared with its own type. Instead, it is held in a temporary derived
+//  from `_RangeForAnyBase`, bound to a reference to that base class, and
+//  recovered by a `static_cast` to the derived type. The derived type is
+//  named by passing a null `_RangeForTag<T>*` computed by the expression
+//  `true ? 0 : _rangeForTagOf(expr)`, in which `expr` is never evaluated, so
+//  the range expression is evaluated exactly once. There are no virtual
+//  calls and `begin()` and `end()` are each called once, so the loop
+//  compiles to the same code as a hand-written iterator loop. The end of an
+//  array is computed from its size, `SZ`, so that the compiler can fully
+//  unroll loops over small arrays.
 
 struct false_type { enum { value = false }; };
 struct true_type  { enum { value = true }; };
@@ -36,116 +59,419 @@ template <class T> struct enable_if<true, T> { typedef T type; };
 template <class>
 struct copyable_range : false_type { };
 
-template <class T> struct Decl;
+template <bool B> struct _RangeForBool       : false_type { };
+template <>       struct _RangeForBool<true> : true_type  { };
+
+template <class T> struct _RangeForTag { };
+
+// Converts to `false` so that it can be declared within an `if` condition.
+struct _RangeForAnyBase
+{
+  operator bool() const { return false; }
+};
 
 template <class T>
-struct Decl<void (&)(T)> { typedef const T type; };
+struct _RangeForAny : _RangeForAnyBase
+{
+  mutable T m_item;
+
+  _RangeForAny() : m_item() { }
+  _RangeForAny(const T& item) : m_item(item) { }
+};
 
 template <class T>
-struct Decl<void (&)(T&)> { typedef T& type; };
+inline _RangeForTag<T> *_rangeForTagOf(const _RangeForAny<T>&) { return 0; }
 
 template <class T>
-struct Decl<void (&)(const T&)> { typedef const T& type; };
+inline T& _rangeForGet(const _RangeForAnyBase& a, _RangeForTag<T> *)
+{
+  return static_cast<const _RangeForAny<T>&>(a).m_item;
+}
 
-template <class T> struct __rm_const          { typedef T type; };
-template <class T> struct __rm_const<const T> { typedef T type; };
+// Range interface to an array, whose size is part of its type.
+template <class A, std::size_t SZ>
+struct _RangeForArray
+{
+  A *m_data;
 
-template <class T> T& __unconst(T& v)       { return v; }
-template <class T> T& __unconst(const T& v) { return const_cast<T&>(v); }
+  _RangeForArray(A *data) : m_data(data) { }
 
-template <class T>
-class _VirtIterBase
+  A *begin() const { return m_data; }
+  A *end()   const { return m_data + SZ; }
+};
+
+template <class Iter, class End>
+struct _RangeForIters
 {
-public:
-  virtual T operator*() const = 0;
-  virtual void operator++() const = 0;
-  virtual bool notAtEnd() const = 0;
+  Iter m_current;
+  End  m_end;
+
+  _RangeForIters(const Iter& b, const End& e) : m_current(b), m_end(e) { }
+
+  bool notAtEnd() const { return m_current != m_end; }
 };
 
-template <class T, class Range>
-class _VirtIter : public _VirtIterBase<T>
+// `sizeof(_rangeForLvalueProbe(expr))` is 1 if `expr` is an lvalue and 2 if
+// it is a non-`const` rvalue. A `const` rvalue binds to `T&` with a `const`
+// `T`, so it, too, yields 1: in C++03, it cannot be told apart from a
+// `const` lvalue by overload resolution.
+template <class T> char (&_rangeForLvalueProbe(T&))[1];
+char (&_rangeForLvalueProbe(...))[2];
+
+// A `const` rvalue range can, however, be told apart by the conditional
+// operator: in `true ? _RangeForProbe<T>(r) : (expr)`, the probe is
+// converted by `operator T&` if `expr` is an lvalue, yielding `r`, but by
+// `operator T` if `expr` is an rvalue. A `const` rvalue cannot be iterated
+// safely: it would be destroyed at the end of the full-expression that binds
+// it, and being `const` it cannot be swapped from. So `operator T` is
+// defined to fail to compile, rejecting such a range.
+template <class T> struct _RangeForConstRvalueIsNotSupported;
+
+template <class T>
+class _RangeForProbe
 {
-  Range&                           m_range;
-  mutable typename Range::iterator m_current;
+  T& m_range;
 
 public:
-  _VirtIter(Range& r) : m_range(r), m_current(__unconst(m_range).begin()) { }
+  explicit _RangeForProbe(T& r) : m_range(r) { }
 
-  T operator*() const { return *m_current; }
-  void operator++() const { ++m_current; }
-  bool notAtEnd() const { return m_current != m_range.end(); }
+  operator T&() const { return m_range; }
+  operator T() { return _RangeForConstRvalueIsNotSupported<T>::value; }
 };
 
-template <class T, class Range>
-class _VirtIter<T, const Range> :
-  public _VirtIter<T, typename __rm_const<Range>::type>
+// Refers to a non-`const` rvalue range. Converting the rvalue `expr` in
+// `true ? _RangeForRvalue<T>(r) : (expr)` yields this probe itself, not a
+// copy of the range.
+template <class T>
+struct _RangeForRvalue
 {
-  typedef typename __rm_const<Range>::type  NonconstRange;
-  typedef _VirtIter<T, NonconstRange> Base;
+  T *m_range;
 
-public:
-  _VirtIter(Range& r) : Base(__unconst(r)) { }
+  _RangeForRvalue(const T& r) : m_range(const_cast<T *>(&r)) { }
 };
 
-template <class T, class A, std::size_t SZ >
-class _VirtIter<T, A[SZ]> : public _VirtIterBase<T>
+// Return the probe for the range `r`, an rvalue if the second argument has
+// type `true_type *`, to be used as described above.
+template <class T>
+inline _RangeForProbe<T> _rangeForProbe(T& r, false_type *)
 {
-  mutable A *m_current;
-  A         *m_end;
+  return _RangeForProbe<T>(r);
+}
 
-public:
-  _VirtIter(A (&r)[SZ]) : m_current(r), m_end(&r[SZ]) { }
+template <class A, std::size_t SZ>
+inline A (&_rangeForProbe(A (&a)[SZ], false_type *))[SZ]
+{
+  return a;
+}
 
-  T operator*() const { return *m_current; }
-  void operator++() const { ++m_current; }
-  bool notAtEnd() const { return m_current != m_end; }
-};
+template <class T>
+inline _RangeForRvalue<T> _rangeForProbe(const T& r, true_type *)
+{
+  return _RangeForRvalue<T>(r);
+}
 
-template <class T, class A, std::size_t SZ >
-class _VirtIter<T, const A[SZ]> :
-  public _VirtIter<T, typename __rm_const<A>::type[SZ]>
+// True if `T` has a member `void swap(T&)`.
+template <class T>
+struct _RangeForHasSwap
 {
-  typedef typename __rm_const<A>::type NonconstA;
-  typedef _VirtIter<T, NonconstA[SZ]>  Base;
+  template <class U, void (U::*)(U&)> struct sig { };
+  template <class U> static char test(sig<U, &U::swap> *);
+  template <class U> static char (&test(...))[2];
 
-public:
-  _VirtIter(A (&a)[SZ]) : Base(__unconst(a)) { }
+  enum { value = 1 == sizeof(test<T>(0)) };
 };
 
-template <class T, class Range>
-class _VirtIterCp : public _VirtIterBase<T>
+// Hold an lvalue range by pointer and an array as a `_RangeForArray`. An
+// rvalue range is held by value: if it has a member `swap`, its contents are
+// swapped into a default-constructed range, so that even a large temporary
+// container is iterated without being copied; otherwise it is copied, which
+// requires it to opt in via `copyable_range`.
+template <class Range>
+inline _RangeForAny<Range *> _rangeForBind(Range& r, false_type *)
 {
-  Range                            m_range;
-  mutable typename Range::iterator m_current;
+  return _RangeForAny<Range *>(&r);
+}
 
-public:
-  _VirtIterCp(const Range& r)
-    : m_range(r), m_current(__unconst(m_range).begin()) { }
+template <class A, std::size_t SZ>
+inline _RangeForAny<_RangeForArray<A, SZ> >
+_rangeForBind(A (&a)[SZ], false_type *)
+{
+  return _RangeForAny<_RangeForArray<A, SZ> >(a);
+}
+
+template <class Range>
+inline _RangeForAny<Range> _rangeForBindRvalue(const Range& r, true_type *)
+{
+  _RangeForAny<Range> ret;
+  ret.m_item.swap(const_cast<Range&>(r));  // `r` is a non-`const` temporary
+  return ret;
+}
+
+template <class Range>
+inline typename enable_if<copyable_range<Range>::value,
+                          _RangeForAny<Range> >::type
+_rangeForBindRvalue(const Range& r, false_type *)
+{
+  return _RangeForAny<Range>(r);
+}
+
+template <class Range>
+inline _RangeForAny<Range> _rangeForBind(const _RangeForRvalue<Range>& r,
+                                         true_type *)
+{
+  return _rangeForBindRvalue(*r.m_range,
+                             (_RangeForBool<_RangeForHasSwap<Range>::value> *)
+                             0);
+}
+
+// Return the range held by the result of `_rangeForBind`.
+template <class Range>
+inline Range& _rangeForRange(const _RangeForAnyBase& a,
+                             _RangeForTag<Range *> *)
+{
+  return *static_cast<const _RangeForAny<Range *>&>(a).m_item;
+}
+
+template <class Range>
+inline Range& _rangeForRange(const _RangeForAnyBase& a, _RangeForTag<Range> *)
+{
+  return static_cast<const _RangeForAny<Range>&>(a).m_item;
+}
+
+template <class Iter, class End>
+inline _RangeForAny<_RangeForIters<Iter, End> >
+_rangeForIters(const Iter& b, const End& e)
+{
+  return _RangeForAny<_RangeForIters<Iter, End> >(
+    _RangeForIters<Iter, End>(b, e));
+}
+
+inline bool _rangeForSetFalse(bool& b) { b = false; return false; }
+
+#if __cplusplus >= 201103L
+
+// Bind the range expression to a forwarding reference, extending the
+// lifetime of a temporary range, which is then iterated in place like an
+// lvalue.
+#define _RANGE_FOR_BIND_TEMP(...)                                           \
+  if (bool _RangeDone = false) { } else                                     \
+  for (auto&& _RangeTemp = (__VA_ARGS__); ! _RangeDone; _RangeDone = true)
+
+#define _RANGE_FOR_BIND_RANGE(...)                                          \
+  _rangeForBind(_RangeTemp, (false_type *) 0)
+
+#else // C++03
+
+#define _RANGE_FOR_BIND_TEMP(...)
+
+#define _RANGE_FOR_IS_RVALUE(...)                                           \
+  (_RangeForBool<2 == sizeof(_rangeForLvalueProbe(__VA_ARGS__))> *) 0
+
+#define _RANGE_FOR_BIND_RANGE(...)                                          \
+  _rangeForBind(true ? _rangeForProbe((__VA_ARGS__),                        \
+                                      _RANGE_FOR_IS_RVALUE(__VA_ARGS__))    \
+                     : (__VA_ARGS__),                                       \
+                _RANGE_FOR_IS_RVALUE(__VA_ARGS__))
+
+#endif
+
+#define _RANGE_FOR_RANGE(...)                                               \
+  _rangeForRange(_RangeBound, true ? 0 : _rangeForTagOf(                    \
+                   _RANGE_FOR_BIND_RANGE(__VA_ARGS__)))
+
+#define _RANGE_FOR_MAKE_ITERS(...)                                          \
+  _rangeForIters(_RANGE_FOR_RANGE(__VA_ARGS__).begin(),                     \
+                 _RANGE_FOR_RANGE(__VA_ARGS__).end())
+
+#define _RANGE_FOR_ITERS_TAG(...)                                           \
+  (true ? 0 : _rangeForTagOf(_RANGE_FOR_MAKE_ITERS(__VA_ARGS__)))
+
+#define _RANGE_FOR_ITERS(...)                                               \
+  _rangeForGet(_RangeIters, _RANGE_FOR_ITERS_TAG(__VA_ARGS__))
+
+// Bind the range (after, in C++11 and later, binding a temporary range to a
+// reference), then its iterators, in `if` conditions whose `else` branches
+// are the loop.
+#define _RANGE_FOR_BIND(...)                                                \
+  _RANGE_FOR_BIND_TEMP(__VA_ARGS__)                                         \
+  if (const _RangeForAnyBase& _RangeBound =                                 \
+        _RANGE_FOR_BIND_RANGE(__VA_ARGS__)) { }                             \
+  else if (const _RangeForAnyBase& _RangeIters =                            \
+             _RANGE_FOR_MAKE_ITERS(__VA_ARGS__)) { }                        \
+  else
 
-  T operator*() const { return *m_current; }
-  void operator++() const { ++m_current; }
-  bool notAtEnd() const { return m_current != m_range.end(); }
+// Loop over the `_RangeForIters` object `Iters`. `_Continue` is false only
+// while the loop body is executing, so that a `break` from the body also
+// ends the outer loop.
+#define _RANGE_FOR_LOOP(RangeDecl, Iters)                                   \
+  for (bool _Continue = true; _Continue && (Iters).notAtEnd();              \
+       _Continue ? (void) ++(Iters).m_current : (void) 0)                   \
+    if (_rangeForSetFalse(_Continue)) { } else                              \
+    for (UNPAREN(RangeDecl) = *(Iters).m_current; ! _Continue;              \
+         _Continue = true)
+
+#define RANGE_FOR(RangeDecl, ...)                                           \
+  _RANGE_FOR_BIND(__VA_ARGS__)                                              \
+    _RANGE_FOR_LOOP(RangeDecl, _RANGE_FOR_ITERS(__VA_ARGS__))
+
+// Parallel range-based for loop: `RANGE_FOR_PAR(decl, range) statement`
+//
+// Like `RANGE_FOR`, but if the range's iterators are random access (as for
+// `std::vector` and arrays), `begin()` and `end()` have the same type, and
+// the range has at least `2 * RANGE_FOR_PAR_MIN_CHUNK` elements, the range
+// is split into one contiguous chunk per OpenMP thread and the chunks are
+// executed in parallel. Otherwise, and whenever OpenMP is not enabled (e.g.,
+// by `-fopenmp`), the loop runs serially. Iterations must therefore be
+// independent of each other. A `break` ends only the current chunk.
+//
+// When OpenMP is enabled, the statement is always compiled as the body of an
+// OpenMP parallel loop, even if the loop turns out to run serially: the
+// statement follows the macro, so it cannot be emitted once inside the
+// parallel loop and once outside it. Hence, as for any OpenMP structured
+// block, an exception must not propagate out of the statement (the program
+// would call `std::terminate`), and neither `return` nor `goto` can leave it
+// (the program is ill formed). Use `RANGE_FOR` for loops that need either.
+
+#ifndef RANGE_FOR_PAR_MIN_CHUNK
+# define RANGE_FOR_PAR_MIN_CHUNK 1024
+#endif
+
+template <class Iter>
+struct _RangeForHasCategory
+{
+  template <class T> static char test(typename T::iterator_category *);
+  template <class T> static char (&test(...))[2];
+
+  enum { value = 1 == sizeof(test<Iter>(0)) };
 };
 
-template <class T, class Range>
-_VirtIter<T, Range> mkVirt(Range& r)
+struct _RangeForCategory
 {
-  return _VirtIter<T, Range>(__unconst(r));
+  static char test(std::random_access_iterator_tag);
+  static char (&test(...))[2];
+};
+
+// Derived from `true_type` if `Iter` is a random-access iterator, else from
+// `false_type`. Does not require `std::iterator_traits<Iter>` to be valid.
+template <class Iter, bool = _RangeForHasCategory<Iter>::value>
+struct _RangeForIsRandomAccess : false_type { };
+
+template <class Iter>
+struct _RangeForIsRandomAccess<Iter, true> :
+  _RangeForBool<1 == sizeof(_RangeForCategory::test(
+                                typename Iter::iterator_category()))>
+{ };
+
+template <class T>
+struct _RangeForIsRandomAccess<T *, false> : true_type { };
+
+inline std::ptrdiff_t _rangeForMaxThreads()
+{
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+template <class Iter>
+inline std::ptrdiff_t _rangeForSize(const _RangeForIters<Iter, Iter>& it,
+                                    true_type *)
+{
+  return it.m_end - it.m_current;
+}
+
+template <class Iter>
+inline std::ptrdiff_t _rangeForSize(const _RangeForIters<Iter, Iter>&,
+                                    false_type *)
+{
+  return 0;
+}
+
+// Return the number of chunks into which to split `it`: 1 unless it is a
+// large random-access range.
+template <class Iter, class End>
+inline std::ptrdiff_t _rangeForNumChunks(const _RangeForIters<Iter, End>&)
+{
+  return 1;
+}
+
+template <class Iter>
+inline std::ptrdiff_t _rangeForNumChunks(const _RangeForIters<Iter, Iter>& it)
+{
+  std::ptrdiff_t n = _rangeForSize(it, (_RangeForIsRandomAccess<Iter> *) 0);
+  std::ptrdiff_t chunks = n / RANGE_FOR_PAR_MIN_CHUNK;
+  std::ptrdiff_t threads = _rangeForMaxThreads();
+  return chunks < 1 ? 1 : chunks < threads ? chunks : threads;
+}
+
+template <class Iter>
+inline _RangeForIters<Iter, Iter>
+_rangeForSlice(const _RangeForIters<Iter, Iter>& it, std::ptrdiff_t i,
+               std::ptrdiff_t count, true_type *)
+{
+  std::ptrdiff_t n = it.m_end - it.m_current;
+  return _RangeForIters<Iter, Iter>(it.m_current + n * i / count,
+                                    it.m_current + n * (i + 1) / count);
+}
+
+template <class Iter>
+inline _RangeForIters<Iter, Iter>
+_rangeForSlice(const _RangeForIters<Iter, Iter>& it, std::ptrdiff_t,
+               std::ptrdiff_t, false_type *)
+{
+  return it;
+}
+
+// Return chunk `i` of `count` chunks of `it`, where `count` was returned by
+// `_rangeForNumChunks(it)`.
+template <class Iter, class End>
+inline _RangeForAny<_RangeForIters<Iter, End> >
+_rangeForChunk(const _RangeForIters<Iter, End>& it, std::ptrdiff_t,
+               std::ptrdiff_t)
+{
+  return it;
 }
 
-template <class T, class Range>
-typename enable_if<copyable_range<Range>::value, _VirtIterCp<T, Range> >::type
-mkVirt(const Range& r)
+template <class Iter>
+inline _RangeForAny<_RangeForIters<Iter, Iter> >
+_rangeForChunk(const _RangeForIters<Iter, Iter>& it, std::ptrdiff_t i,
+               std::ptrdiff_t count)
 {
-  return _VirtIterCp<T, Range>(r);
+  return _rangeForSlice(it, i, count, (_RangeForIsRandomAccess<Iter> *) 0);
 }
 
-#define RANGE_FOR(RangeDecl, ...)                                            \
-  for (const _VirtIterBase<Decl<void(&)(UNPAREN(RangeDecl))>::type>& _Iter = \
-         mkVirt<Decl<void(&)(UNPAREN(RangeDecl))>::type>(__VA_ARGS__);  \
-       _Iter.notAtEnd(); )                                              \
-    for (bool _Top = true; _Iter.notAtEnd(); ++_Iter, _Top = true)      \
-      for (UNPAREN(RangeDecl) = *_Iter; _Top; _Top = false)
+// Holds the number of chunks; converts to `false` so that it can be declared
+// within an `if` condition.
+struct _RangeForPlan
+{
+  std::ptrdiff_t m_chunks;
+
+  _RangeForPlan(std::ptrdiff_t chunks) : m_chunks(chunks) { }
+
+  operator bool() const { return false; }
+};
+
+#ifdef _OPENMP
+# define _RANGE_FOR_PAR_PRAGMA                                              \
+  _Pragma("omp parallel for if(_RangePlan.m_chunks > 1) schedule(static, 1)")
+#else
+# define _RANGE_FOR_PAR_PRAGMA
+#endif
+
+#define RANGE_FOR_PAR(RangeDecl, ...)                                       \
+  _RANGE_FOR_BIND(__VA_ARGS__)                                              \
+  if (const _RangeForPlan _RangePlan =                                      \
+        _rangeForNumChunks(_RANGE_FOR_ITERS(__VA_ARGS__))) { }              \
+  else _RANGE_FOR_PAR_PRAGMA                                                \
+    for (std::ptrdiff_t _Chunk = 0; _Chunk < _RangePlan.m_chunks; ++_Chunk) \
+      if (const _RangeForAnyBase& _RangeChunk =                             \
+            _rangeForChunk(_RANGE_FOR_ITERS(__VA_ARGS__), _Chunk,           \
+                           _RangePlan.m_chunks)) { }                        \
+      else                                                                  \
+        _RANGE_FOR_LOOP(RangeDecl,                                          \
+                        _rangeForGet(_RangeChunk,                           \
+                                     _RANGE_FOR_ITERS_TAG(__VA_ARGS__)))
 
 #endif // ! defined(INCLUDED_RANGE_FOR_CPP03)
 
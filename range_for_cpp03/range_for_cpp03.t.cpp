@@ -5,9 +5,13 @@
  */
 
 #include <range_for_cpp03.h>
+#include <list>
 #include <vector>
 #include <iostream>
 #include <utility>
+#include <cassert>
+#include <cstring>
+#include <ctime>
 
 class iota
 {
@@ -37,8 +41,354 @@ public:
 template <>
 struct copyable_range<iota> : true_type { };
 
-int main()
+// Counts calls to `begin()` and `end()`.
+class counted_range
 {
+  std::vector<int> m_v;
+
+public:
+  static int s_begins, s_ends;
+
+  typedef std::vector<int>::const_iterator iterator;
+
+  explicit counted_range(int n) : m_v(n, 1) { }
+
+  iterator begin() const { ++s_begins; return m_v.begin(); }
+  iterator end()   const { ++s_ends;   return m_v.end(); }
+};
+
+int counted_range::s_begins = 0;
+int counted_range::s_ends   = 0;
+
+int g_numRangeEvals = 0;
+
+std::vector<int>& evalOnce(std::vector<int>& v)
+{
+  ++g_numRangeEvals;
+  return v;
+}
+
+void testControlFlow()
+{
+  counted_range cr(10);
+  int n = 0;
+  RANGE_FOR(int x, cr)
+    n += x;
+  assert(10 == n);
+  assert(1 == counted_range::s_begins && 1 == counted_range::s_ends);
+
+  std::vector<int> v;
+  for (int i = 0; i < 10; ++i)
+    v.push_back(i);
+
+  // The range expression is evaluated once.
+  int sum = 0;
+  RANGE_FOR(int x, evalOnce(v))
+    sum += x;
+  assert(45 == sum && 1 == g_numRangeEvals);
+
+  // `break` and `continue`
+  sum = 0;
+  RANGE_FOR(int x, v) {
+    if (x % 2)
+      continue;
+    if (x > 6)
+      break;
+    sum += x;
+  }
+  assert(0 + 2 + 4 + 6 == sum);
+
+  // Nested loops, and use within an unbraced `if`-`else`
+  int a[] = { 1, 2, 3 };
+  sum = 0;
+  RANGE_FOR(int x, a)
+    RANGE_FOR(int y, a) {
+      if (y > x)
+        break;
+      sum += x * y;
+    }
+  assert(1 + 2 + 4 + 3 + 6 + 9 == sum);
+
+  bool ran = false;
+  if (sum < 0)
+    RANGE_FOR(int x, a)
+      sum += x;
+  else
+    ran = true;
+  assert(ran && 25 == sum);
+}
+
+static int threadNum()
+{
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+void testParallel()
+{
+#ifdef _OPENMP
+  omp_set_num_threads(4);  // Even on a machine with fewer cores
+  const int numThreads = 4;
+#else
+  const int numThreads = 1;
+#endif
+
+  // Each element is visited exactly once, by chunk in order.
+  const int n = 4 * RANGE_FOR_PAR_MIN_CHUNK + 3;
+  std::vector<int> idx(n), visits(n, 0), thread(n, -1);
+  for (int i = 0; i < n; ++i)
+    idx[i] = i;
+  RANGE_FOR_PAR(int i, idx) {
+    ++visits[i];
+    thread[i] = threadNum();
+  }
+  for (int i = 0; i < n; ++i) {
+    assert(1 == visits[i]);
+    assert(0 == i || thread[i - 1] <= thread[i]);
+  }
+  assert(0 == thread[0] && numThreads - 1 == thread[n - 1]);
+
+  // Arrays; `continue`
+  static int a[3 * RANGE_FOR_PAR_MIN_CHUNK];
+  RANGE_FOR_PAR(int& x, a) {
+    if (&x - a < 10)
+      continue;
+    x = 1 + threadNum();
+  }
+  assert(0 == a[0] && 1 == a[10] && 1 == a[RANGE_FOR_PAR_MIN_CHUNK - 1]);
+  assert((numThreads > 1 ? 3 : 1) == a[3 * RANGE_FOR_PAR_MIN_CHUNK - 1]);
+
+  // Small ranges, non-random-access ranges, and ranges with sentinels run
+  // serially.
+  std::vector<int> small(RANGE_FOR_PAR_MIN_CHUNK, 0);
+  RANGE_FOR_PAR(int& x, small)
+    x = threadNum();
+  RANGE_FOR_PAR(int x, small)
+    assert(0 == x);
+
+  std::list<int> lst(n, 0);
+  RANGE_FOR_PAR(int& x, lst)
+    x = 1 + threadNum();
+  RANGE_FOR(int x, lst)
+    assert(1 == x);
+
+  int sum = 0;
+  RANGE_FOR_PAR(int x, iota(n)) {
+    assert(0 == threadNum());
+    sum += x % 3;
+  }
+  assert(n - 1 == sum);
+}
+
+// Vector that counts copies of itself
+class counted_vector
+{
+  std::vector<int> m_v;
+
+public:
+  static int s_copies;
+
+  typedef std::vector<int>::iterator       iterator;
+  typedef std::vector<int>::const_iterator const_iterator;
+
+  counted_vector() { }
+  explicit counted_vector(int n) : m_v(n) {
+    for (int i = 0; i < n; ++i)
+      m_v[i] = i;
+  }
+  counted_vector(const counted_vector& other) : m_v(other.m_v) { ++s_copies; }
+
+  void swap(counted_vector& other) { m_v.swap(other.m_v); }
+
+  iterator       begin()       { return m_v.begin(); }
+  iterator       end()         { return m_v.end(); }
+  const_iterator begin() const { return m_v.begin(); }
+  const_iterator end()   const { return m_v.end(); }
+};
+
+int counted_vector::s_copies = 0;
+
+counted_vector makeCounted(int n)
+{
+  return counted_vector(n);
+}
+
+std::vector<int> makeVector(int n)
+{
+  return std::vector<int>(n, 2);
+}
+
+const std::vector<int> makeConstVector(int n)
+{
+  return std::vector<int>(n, 3);
+}
+
+void testTemporaries()
+{
+  // A temporary range is iterated without being copied.
+  counted_vector::s_copies = 0;
+  int sum = 0;
+  RANGE_FOR(int& x, makeCounted(100)) {
+    x *= 2;  // The temporary is modifiable
+    sum += x;
+  }
+  assert(2 * 4950 == sum && 0 == counted_vector::s_copies);
+
+  RANGE_FOR_PAR(int x, makeCounted(10))
+    sum += x;
+  assert(2 * 4950 + 45 == sum && 0 == counted_vector::s_copies);
+
+  // Lvalues, including `const` ones, are not copied either.
+  counted_vector cv(10);
+  const counted_vector& ccv = cv;
+  RANGE_FOR(int& x, cv)
+    ++x;
+  RANGE_FOR(int x, ccv)
+    sum += x;
+  assert(2 * 4950 + 45 + 55 == sum && 0 == counted_vector::s_copies);
+
+  // Standard containers need not opt in via `copyable_range`.
+  sum = 0;
+  RANGE_FOR(int x, makeVector(5))
+    sum += x;
+  assert(10 == sum);
+
+  // Copyable ranges without `swap` can be iterated as temporaries or as
+  // lvalues.
+  const iota ten(10);
+  sum = 0;
+  RANGE_FOR(int x, ten)
+    sum += x;
+  assert(45 == sum);
+
+#if __cplusplus >= 201103L
+  // A `const` temporary is bound to a reference and iterated in place.
+  sum = 0;
+  RANGE_FOR(int x, makeConstVector(4))
+    sum += x;
+  assert(12 == sum);
+#elif defined(RANGE_FOR_TEST_CONST_RVALUE)
+  // In C++03, a `const` temporary can be neither swapped from nor kept
+  // alive, so it is rejected. `make range_for_const_rvalue.fail` checks that
+  // this does not compile.
+  RANGE_FOR(int x, makeConstVector(4))
+    sum += x;
+#endif
+}
+
+/// Return the number of seconds taken by `f(iterations)`.
+template <class F>
+double timeIt(F f, int iterations)
+{
+  std::clock_t start = std::clock();
+  f(iterations);
+  return double(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+std::vector<int> g_benchVec(1000000, 3);
+int              g_benchArr[4] = { 1, 2, 3, 4 };
+volatile long    g_sink;
+
+struct HandVec {
+  void operator()(int iterations) const {
+    long sum = 0;
+    for (int i = 0; i < iterations; ++i)
+      for (std::vector<int>::const_iterator it = g_benchVec.begin(),
+             end = g_benchVec.end(); it != end; ++it)
+        sum += *it;
+    g_sink = sum;
+  }
+};
+
+struct RangeForVec {
+  void operator()(int iterations) const {
+    long sum = 0;
+    for (int i = 0; i < iterations; ++i)
+      RANGE_FOR(int x, g_benchVec)
+        sum += x;
+    g_sink = sum;
+  }
+};
+
+struct HandArr {
+  void operator()(int iterations) const {
+    long sum = 0;
+    for (int i = 0; i < iterations; ++i) {
+      for (const int *p = g_benchArr; p != g_benchArr + 4; ++p)
+        sum += *p * i;
+    }
+    g_sink = sum;
+  }
+};
+
+struct RangeForArr {
+  void operator()(int iterations) const {
+    long sum = 0;
+    for (int i = 0; i < iterations; ++i)
+      RANGE_FOR(int x, g_benchArr)
+        sum += x * i;
+    g_sink = sum;
+  }
+};
+
+std::vector<double> g_parVec(4000000, 1.0);
+
+struct RangeForUpdate {
+  void operator()(int iterations) const {
+    for (int i = 0; i < iterations; ++i)
+      RANGE_FOR(double& x, g_parVec)
+        x = x * 0.5 + 1.0 / (x + 1.0);
+  }
+};
+
+struct RangeForParUpdate {
+  void operator()(int iterations) const {
+    for (int i = 0; i < iterations; ++i)
+      RANGE_FOR_PAR(double& x, g_parVec)
+        x = x * 0.5 + 1.0 / (x + 1.0);
+  }
+};
+
+/// Return the wall-clock time, in seconds, taken by `f(iterations)`.
+template <class F>
+double wallTimeIt(F f, int iterations)
+{
+#ifdef _OPENMP
+  double start = omp_get_wtime();
+  f(iterations);
+  return omp_get_wtime() - start;
+#else
+  return timeIt(f, iterations);
+#endif
+}
+
+// Compare `RANGE_FOR` with hand-written iterator loops, and with
+// `RANGE_FOR_PAR` on a large vector. Run with
+// `make TEST_ARGS=bench CXXOPT=-O2`.
+void bench()
+{
+  std::cout << "vector of 1M ints x 200:   hand "
+            << timeIt(HandVec(), 200) << "s, RANGE_FOR "
+            << timeIt(RangeForVec(), 200) << "s\n";
+  std::cout << "array of 4 ints x 100M:    hand "
+            << timeIt(HandArr(), 100000000) << "s, RANGE_FOR "
+            << timeIt(RangeForArr(), 100000000) << "s\n";
+  std::cout << "vector of 4M doubles x 20: RANGE_FOR "
+            << wallTimeIt(RangeForUpdate(), 20) << "s, RANGE_FOR_PAR "
+            << wallTimeIt(RangeForParUpdate(), 20) << "s ("
+            << _rangeForMaxThreads() << " threads)\n";
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1 && 0 == std::strcmp(argv[1], "bench")) {
+    bench();
+    return 0;
+  }
+
   std::vector<int> v;
   for (int i = 1; i < 128; i <<= 1)
     v.push_back(i);
@@ -100,6 +450,10 @@ int main()
   RANGE_FOR(int x, iota(9, 5, 0))
     std::cout << x << ' ';
   std::cout << std::endl;
+
+  testControlFlow();
+  testParallel();
+  testTemporaries();
 }
 
 // Local Variables:
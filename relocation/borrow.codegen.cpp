@@ -0,0 +1,66 @@
+/* borrow.codegen.cpp                                                 -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// Codegen test: with the `borrow_unchecked` policy, access through `RustObj`
+// and `RustRef` compiles to exactly the same code as access through plain
+// references and pointers. Run with `make borrow.codegen`.
+
+#include <borrow.h>
+
+using Obj     = xstd::RustObj<int, xstd::borrow_unchecked>;
+using ConstObj = xstd::RustObj<const int, xstd::borrow_unchecked>;
+using Ref     = xstd::RustRef<int, xstd::borrow_unchecked>;
+using CRef    = xstd::RustRef<const int, xstd::borrow_unchecked>;
+
+// CHECK-SAME: direct_read rust_read
+// CHECK-NO-CALL: rust_read
+extern "C" int direct_read(int& v) { return v * 3 + 1; }
+extern "C" int rust_read(Obj& o)
+{
+  return o.apply([](const int& v){ return v * 3 + 1; });
+}
+
+// CHECK-SAME: direct_read rust_const_read
+extern "C" int rust_const_read(ConstObj& o)
+{
+  return o.apply([](const int& v){ return v * 3 + 1; });
+}
+
+// CHECK-SAME: direct_write rust_write
+// CHECK-NO-CALL: rust_write
+extern "C" void direct_write(int& v, int x) { v += x; }
+extern "C" void rust_write(Obj& o, int x)
+{
+  o.mapply([](int& v, int x){ v += x; }, x);
+}
+
+// Borrows are passed in registers, like pointers.
+// CHECK-SAME: direct_ptr_read rust_ref_read
+// CHECK-SAME: direct_ptr_write rust_ref_write
+extern "C" int direct_ptr_read(const int* p) { return *p + 1; }
+extern "C" int rust_ref_read(CRef r)
+{
+  return r.apply([](const int& v){ return v + 1; });
+}
+
+extern "C" void direct_ptr_write(int* p) { *p *= 2; }
+extern "C" void rust_ref_write(Ref r)
+{
+  r.mapply([](int& v){ v *= 2; });
+}
+
+// Taking and releasing a borrow is free.
+// CHECK-SAME: direct_read rust_borrow_read
+extern "C" int rust_borrow_read(Obj& o)
+{
+  CRef r = +o;
+  CRef r2 = r;
+  return r2.apply([](const int& v){ return v * 3 + 1; });
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -0,0 +1,512 @@
+/* borrow.h                                                           -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// Experimental Rust-style borrow checking. A `RustObj<T>` owns a `T` that
+/// can be accessed only through borrows: any number of shared borrows,
+/// `RustRef<const T>`, or exactly one mutable borrow, `RustRef<T>`.
+///
+/// The `Policy` parameter selects whether borrows are tracked and checked.
+/// With `borrow_checked`, each object records whether it is live, whether it
+/// is mutably borrowed, and how many borrows are outstanding, and every
+/// operation checks those with `RustAssert`. With `borrow_unchecked`, there
+/// is no tracking state and no checking: `sizeof(RustObj<T>) == sizeof(T)`,
+/// a `RustRef` is a trivially copyable pointer, `apply`/`mapply` are direct
+/// calls, and `RustObj::drop` is not provided. The default policy is
+/// `borrow_checked` unless `NDEBUG` is defined; define `XSTD_BORROW_CHECKING`
+/// to 0 or 1 to override it.
+///
+/// A mutable borrow of a contiguous container can be further divided into
+/// non-overlapping mutable slices, `RustSliceMut<E>`, with `slice_mut`,
+/// `split_at_mut`, and `chunks_mut`. Slices may be handed to different
+/// threads; the originating `RustRef` cannot be used or ended until every
+/// slice has been destroyed.
+
+#ifndef INCLUDED_BORROW
+#define INCLUDED_BORROW
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+
+/// Check a borrow rule. A violation during constant evaluation makes the
+/// enclosing expression non-constant, so that, e.g., a `static_assert` or
+/// `constexpr` variable initialization that breaks a borrow rule is rejected
+/// at compile time. At run time, a violation prints a message and aborts.
+/// Unlike `assert`, `RustAssert` is not disabled by `NDEBUG`; use the
+/// `borrow_unchecked` policy to remove the checks from release builds.
+#define RustAssert(...) \
+  ::xstd::rust_assert(static_cast<bool>(__VA_ARGS__), #__VA_ARGS__, \
+                      __FILE__, __LINE__)
+
+#ifndef XSTD_BORROW_CHECKING
+# ifdef NDEBUG
+#   define XSTD_BORROW_CHECKING 0
+# else
+#   define XSTD_BORROW_CHECKING 1
+# endif
+#endif
+
+namespace xstd {
+
+/// Not `constexpr`, so calling it ends constant evaluation with a diagnostic
+/// that names this function and, in the call stack, the violated check.
+[[noreturn]] inline void borrow_violation(const char* expr, const char* file,
+                                          int line)
+{
+  std::fprintf(stderr, "%s:%d: borrow violation: %s\n", file, line, expr);
+  std::abort();
+}
+
+constexpr void rust_assert(bool ok, const char* expr, const char* file,
+                           int line)
+{
+  if (! ok)
+    borrow_violation(expr, file, line);
+}
+
+/// Borrow-checking policies
+struct borrow_checked   { static constexpr bool checked = true;  };
+struct borrow_unchecked { static constexpr bool checked = false; };
+
+using default_borrow_policy = std::conditional_t<XSTD_BORROW_CHECKING,
+                                                 borrow_checked,
+                                                 borrow_unchecked>;
+
+/// Borrow-tracking state of a `RustObj`. The unchecked specialization is
+/// empty and all of its operations are no-ops.
+template <class Policy>
+struct borrow_state
+{
+  unsigned m_live:1      = true;
+  unsigned m_mutating:1  = false;
+  unsigned m_usecount:14 = 0;
+
+  // Outstanding mutable slices of a mutable borrow; these can be created and
+  // destroyed concurrently on different threads.
+  std::atomic<unsigned> m_slices = 0;
+
+  constexpr void begin_shared()
+  {
+    RustAssert(m_live && ! m_mutating);
+    ++m_usecount;
+  }
+
+  constexpr void end_shared() { --m_usecount; }
+
+  constexpr void begin_mutable()
+  {
+    RustAssert(m_live && 0 == m_usecount);
+    ++m_usecount;
+    m_mutating = true;
+  }
+
+  constexpr void end_mutable()
+  {
+    check_no_slices();
+    m_mutating = false;
+    --m_usecount;
+  }
+
+  void begin_slice() { m_slices.fetch_add(1, std::memory_order_relaxed); }
+  void end_slice()   { m_slices.fetch_sub(1, std::memory_order_release); }
+
+  constexpr void check_no_slices() const
+  {
+    if !consteval {
+      RustAssert(0 == m_slices.load(std::memory_order_acquire));
+    }
+  }
+
+  constexpr void check_live() const { RustAssert(m_live); }
+  constexpr void check_unborrowed() const { RustAssert(0 == m_usecount); }
+  constexpr void check_not_mutating() const { RustAssert(! m_mutating); }
+
+  constexpr void kill()
+  {
+    RustAssert(m_live && 0 == m_usecount);
+    m_live = false;
+  }
+
+  constexpr bool live() const { return m_live; }
+};
+
+template <>
+struct borrow_state<borrow_unchecked>
+{
+  constexpr void begin_shared() { }
+  constexpr void end_shared() { }
+  constexpr void begin_mutable() { }
+  constexpr void end_mutable() { }
+  void begin_slice() { }
+  void end_slice() { }
+  constexpr void check_no_slices() const { }
+  constexpr void check_live() const { }
+  constexpr void check_unborrowed() const { }
+  constexpr void check_not_mutating() const { }
+  constexpr void kill() { }
+  constexpr bool live() const { return true; }
+};
+
+template <class T, class Policy = default_borrow_policy>
+class RustObj;
+
+template <class T, class Policy = default_borrow_policy>
+class RustRef;
+
+template <class T, class Policy = default_borrow_policy>
+class RustSliceMut;
+
+/// One outstanding mutable slice, counted in the borrow state of the sliced
+/// object. The unchecked specialization is empty.
+template <class Policy>
+class slice_lease
+{
+  borrow_state<Policy>* m_state_p;
+
+public:
+  explicit slice_lease(borrow_state<Policy>* state_p) : m_state_p(state_p)
+    { state_p->begin_slice(); }
+
+  slice_lease(slice_lease&& rhs)
+    : m_state_p(std::exchange(rhs.m_state_p, nullptr)) { }
+
+  slice_lease& operator=(slice_lease&& rhs)
+  {
+    if (this != &rhs) {
+      if (m_state_p)
+        m_state_p->end_slice();
+      m_state_p = std::exchange(rhs.m_state_p, nullptr);
+    }
+    return *this;
+  }
+
+  ~slice_lease() { if (m_state_p) m_state_p->end_slice(); }
+
+  /// Return a new lease on the same object.
+  slice_lease another() const { return slice_lease(m_state_p); }
+
+  void check() const { RustAssert(m_state_p); }
+};
+
+template <>
+class slice_lease<borrow_unchecked>
+{
+public:
+  explicit slice_lease(borrow_state<borrow_unchecked>*) { }
+  slice_lease another() const { return *this; }
+  void check() const { }
+};
+
+/// Object that can only be borrowed immutably.
+template <class T, class Policy>
+class RustObj<const T, Policy>
+{
+  friend class RustRef<T, Policy>;
+  friend class RustRef<const T, Policy>;
+
+protected:
+  [[no_unique_address]] borrow_state<Policy> m_state;
+  union
+  {
+    T m_value;
+  };
+
+public:
+  template <class... Args>
+    requires std::is_constructible_v<T, Args...>
+  constexpr RustObj(Args&&... args)
+  {
+    std::construct_at(std::addressof(m_value), std::forward<Args>(args)...);
+  }
+
+  constexpr RustObj(const RustObj& rhs)
+  {
+    rhs.m_state.check_live();
+    rhs.m_state.check_not_mutating();
+    std::construct_at(std::addressof(m_value), rhs.m_value);
+  }
+
+  constexpr RustObj(RustObj&& rhs)
+  {
+    rhs.m_state.check_live();
+    rhs.m_state.check_unborrowed();
+    std::construct_at(std::addressof(m_value), std::move(rhs.m_value));
+  }
+
+  constexpr ~RustObj()
+  {
+    m_state.check_unborrowed();
+    if (m_state.live()) m_value.~T();
+  }
+
+  /// End the lifetime of the owned object. Without tracking state, the
+  /// unchecked policy cannot record that the object is dead (so that
+  /// `~RustObj` does not destroy it again), so `drop` is available only with
+  /// the checked policy. Code built with either policy can end the lifetime
+  /// early by ending the scope of the `RustObj` instead.
+  constexpr void drop() requires (Policy::checked)
+  {
+    m_state.kill();
+    m_value.~T();
+  }
+
+  constexpr operator RustRef<const T, Policy>()  { return { this }; }
+  constexpr RustRef<const T, Policy> operator+() { return { this }; }
+
+  template <class F, class... Args>
+  constexpr decltype(auto) apply(F&& f, Args&&... args)
+  {
+    return (+*this).apply(std::forward<F>(f), std::forward<Args>(args)...);
+  }
+};
+
+/// Mutable object
+template <class T, class Policy>
+class RustObj : RustObj<const T, Policy>
+{
+  using Base = RustObj<const T, Policy>;
+
+  friend class RustRef<T, Policy>;
+  friend class RustRef<const T, Policy>;
+
+public:
+  using Base::Base;
+  using Base::drop;
+  using Base::operator RustRef<const T, Policy>;
+  using Base::operator+;
+  using Base::apply;
+
+  constexpr RustRef<T, Policy> operator&() { return { this }; }
+
+  template <class F, class... Args>
+  constexpr decltype(auto) mapply(F&& f, Args&&... args)
+  {
+    return (&*this).mapply(std::forward<F>(f), std::forward<Args>(args)...);
+  }
+};
+
+/// Mutating reference
+template <class T, class Policy>
+class RustRef
+{
+  friend class RustObj<T, Policy>;
+
+  RustObj<const T, Policy>* m_obj_p;
+
+  // Private creators
+  constexpr RustRef(RustObj<const T, Policy> *obj_p) : m_obj_p(obj_p)
+  {
+    obj_p->m_state.begin_mutable();
+  }
+
+  constexpr void check_usable() const
+  {
+    if constexpr (Policy::checked) {
+      RustAssert(m_obj_p && m_obj_p->m_state.live());
+      m_obj_p->m_state.check_no_slices();
+    }
+  }
+
+public:
+  RustRef(const RustRef&) = delete;
+
+  constexpr RustRef(RustRef&& rhs) requires (! Policy::checked) = default;
+  constexpr RustRef(RustRef&& rhs) requires (Policy::checked)
+    : m_obj_p(rhs.m_obj_p)
+  {
+    RustAssert(m_obj_p && m_obj_p->m_state.live());
+    rhs.m_obj_p = nullptr;
+  }
+
+  constexpr ~RustRef() requires (! Policy::checked) = default;
+  constexpr ~RustRef() requires (Policy::checked)
+  {
+    if (m_obj_p)
+      m_obj_p->m_state.end_mutable();
+  }
+
+  constexpr void drop()
+  {
+    if constexpr (Policy::checked)
+      RustAssert(m_obj_p);
+    m_obj_p->m_state.end_mutable();
+    m_obj_p = nullptr;
+  }
+
+  template <class F, class... Args>
+  constexpr decltype(auto) apply(F&& f, Args&&... args)
+  {
+    check_usable();
+    return std::forward<F>(f)(const_cast<const T&>(m_obj_p->m_value),
+                              std::forward<Args>(args)...);
+  }
+
+  template <class F, class... Args>
+  constexpr decltype(auto) mapply(F&& f, Args&&... args)
+  {
+    check_usable();
+    return std::forward<F>(f)(m_obj_p->m_value, std::forward<Args>(args)...);
+  }
+
+  /// Return a mutable slice covering every element of the borrowed
+  /// contiguous container. This borrow cannot be used or ended until the
+  /// slice, and every slice split from it, has been destroyed.
+  auto slice_mut() requires std::ranges::contiguous_range<T>
+  {
+    check_usable();
+    using E = std::remove_reference_t<std::ranges::range_reference_t<T>>;
+    T& c = m_obj_p->m_value;
+    return RustSliceMut<E, Policy>(std::ranges::data(c), std::ranges::size(c),
+                                   slice_lease<Policy>(&m_obj_p->m_state));
+  }
+};
+
+/// Mutable borrow of a contiguous range of `T` that does not overlap any
+/// other live `RustSliceMut`. Splitting a slice
+/// consumes it and yields smaller slices.
+template <class T, class Policy>
+class RustSliceMut
+{
+  template <class, class> friend class RustRef;
+
+  T*                  m_first;
+  std::size_t         m_size;
+  [[no_unique_address]] slice_lease<Policy> m_lease;
+
+  RustSliceMut(T* first, std::size_t size, slice_lease<Policy>&& lease)
+    : m_first(first), m_size(size), m_lease(std::move(lease)) { }
+
+public:
+  RustSliceMut(RustSliceMut&&) = default;
+  RustSliceMut& operator=(RustSliceMut&&) = default;
+
+  std::size_t size() const { return m_size; }
+  bool empty() const { return 0 == m_size; }
+
+  template <class F, class... Args>
+  decltype(auto) apply(F&& f, Args&&... args)
+  {
+    m_lease.check();
+    return std::forward<F>(f)(std::span<const T>(m_first, m_size),
+                              std::forward<Args>(args)...);
+  }
+
+  template <class F, class... Args>
+  decltype(auto) mapply(F&& f, Args&&... args)
+  {
+    m_lease.check();
+    return std::forward<F>(f)(std::span<T>(m_first, m_size),
+                              std::forward<Args>(args)...);
+  }
+
+  /// Consume this slice and return slices covering `[0, mid)` and
+  /// `[mid, size())`.
+  std::pair<RustSliceMut, RustSliceMut> split_at_mut(std::size_t mid) &&
+  {
+    m_lease.check();
+    if constexpr (Policy::checked)
+      RustAssert(mid <= m_size);
+    slice_lease<Policy> second = m_lease.another();
+    return { RustSliceMut(m_first, mid, std::move(m_lease)),
+             RustSliceMut(m_first + mid, m_size - mid, std::move(second)) };
+  }
+
+  /// Consume this slice and return consecutive slices of `n` elements each,
+  /// except that the last may be shorter.
+  std::vector<RustSliceMut> chunks_mut(std::size_t n) &&
+  {
+    m_lease.check();
+    if constexpr (Policy::checked)
+      RustAssert(n > 0);
+    std::vector<RustSliceMut> ret;
+    ret.reserve((m_size + n - 1) / n);
+    for (std::size_t i = 0; i < m_size; i += n)
+      ret.push_back(RustSliceMut(m_first + i, std::min(n, m_size - i),
+                                 m_lease.another()));
+    // The chunks hold their own leases; release the one held by this slice.
+    [[maybe_unused]] slice_lease<Policy> released(std::move(m_lease));
+    return ret;
+  }
+};
+
+/// Shared (immutable) reference
+template <class T, class Policy>
+class RustRef<const T, Policy>
+{
+  friend class RustObj<const T, Policy>;
+  friend class RustObj<T, Policy>;
+
+  RustObj<const T, Policy>* m_obj_p;
+
+  // Private creators
+  constexpr RustRef(RustObj<const T, Policy> *obj_p) : m_obj_p(obj_p)
+  {
+    obj_p->m_state.begin_shared();
+  }
+
+  constexpr void check_usable() const
+  {
+    if constexpr (Policy::checked)
+      RustAssert(m_obj_p && m_obj_p->m_state.live());
+  }
+
+public:
+  constexpr RustRef(const RustRef& rhs) requires (! Policy::checked) = default;
+  constexpr RustRef(const RustRef& rhs) requires (Policy::checked)
+    : m_obj_p(rhs.m_obj_p)
+  {
+    RustAssert(m_obj_p);
+    m_obj_p->m_state.begin_shared();
+  }
+
+  constexpr RustRef(RustRef&& rhs) requires (! Policy::checked) = default;
+  constexpr RustRef(RustRef&& rhs) requires (Policy::checked)
+    : m_obj_p(rhs.m_obj_p)
+  {
+    RustAssert(m_obj_p && m_obj_p->m_state.live());
+    rhs.m_obj_p = nullptr;
+  }
+
+  constexpr ~RustRef() requires (! Policy::checked) = default;
+  constexpr ~RustRef() requires (Policy::checked)
+  {
+    if (m_obj_p)
+      m_obj_p->m_state.end_shared();
+  }
+
+  constexpr void drop()
+  {
+    if constexpr (Policy::checked)
+      RustAssert(m_obj_p);
+    m_obj_p->m_state.end_shared();
+    m_obj_p = nullptr;
+  }
+
+  template <class F, class... Args>
+  constexpr decltype(auto) apply(F&& f, Args&&... args)
+  {
+    check_usable();
+    return std::forward<F>(f)(const_cast<const T&>(m_obj_p->m_value),
+                              std::forward<Args>(args)...);
+  }
+};
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_BORROW)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -0,0 +1,282 @@
+/* borrow.t.cpp                                                       -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+#include <borrow.h>
+
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <utility>
+#include <cassert>
+
+using xstd::RustObj;
+using xstd::RustRef;
+using xstd::RustSliceMut;
+using xstd::borrow_checked;
+using xstd::borrow_unchecked;
+
+// Release mode has no tracking state and trivially copyable borrows.
+static_assert(sizeof(RustObj<int, borrow_unchecked>) == sizeof(int));
+static_assert(sizeof(RustObj<std::string, borrow_unchecked>) ==
+              sizeof(std::string));
+static_assert(sizeof(RustObj<const double, borrow_unchecked>) ==
+              sizeof(double));
+static_assert(sizeof(RustRef<int, borrow_unchecked>) == sizeof(void*));
+static_assert(std::is_trivially_copyable_v<RustRef<int, borrow_unchecked>>);
+static_assert(std::is_trivially_copyable_v<
+                RustRef<const int, borrow_unchecked>>);
+static_assert(sizeof(RustSliceMut<int, borrow_unchecked>) ==
+              sizeof(std::span<int>));
+
+// Debug mode tracks borrows.
+static_assert(sizeof(RustObj<int, borrow_checked>) > sizeof(int));
+static_assert(! std::is_trivially_destructible_v<
+                RustRef<const int, borrow_checked>>);
+
+#ifdef NDEBUG
+static_assert(std::is_same_v<xstd::default_borrow_policy, borrow_unchecked>);
+#else
+static_assert(std::is_same_v<xstd::default_borrow_policy, borrow_checked>);
+#endif
+
+struct Counted
+{
+  static int s_live;
+  std::string m_str;
+
+  Counted(const char* s) : m_str(s) { ++s_live; }
+  Counted(const Counted& other) : m_str(other.m_str) { ++s_live; }
+  ~Counted() { --s_live; }
+};
+
+int Counted::s_live = 0;
+
+/// Exercise legal borrow patterns, which behave identically under both
+/// policies.
+template <class Policy>
+void test_borrows()
+{
+  {
+    RustObj<Counted, Policy> obj("hello");
+    assert(1 == Counted::s_live);
+
+    // Several shared borrows at once
+    {
+      RustRef<const Counted, Policy> r1 = +obj;
+      RustRef<const Counted, Policy> r2 = r1;
+      assert(5 == r1.apply([](const Counted& c){ return c.m_str.size(); }));
+      assert('h' == r2.apply([](const Counted& c){ return c.m_str[0]; }));
+      assert(5 == obj.apply([](const Counted& c){ return c.m_str.size(); }));
+    }
+
+    // One mutable borrow, then shared borrows again
+    {
+      RustRef<Counted, Policy> m = &obj;
+      m.mapply([](Counted& c, const char* s){ c.m_str += s; }, " world");
+      RustRef<Counted, Policy> m2 = std::move(m);
+      assert(11 == m2.apply([](const Counted& c){ return c.m_str.size(); }));
+      m2.drop();
+      RustRef<const Counted, Policy> r = obj;
+      assert(11 == r.apply([](const Counted& c){ return c.m_str.size(); }));
+    }
+
+    obj.mapply([](Counted& c){ c.m_str = "bye"; });
+    assert(3 == obj.apply([](const Counted& c){ return c.m_str.size(); }));
+
+    // Copies are independent objects
+    RustObj<Counted, Policy> copy(obj);
+    copy.mapply([](Counted& c){ c.m_str += "!"; });
+    assert(3 == obj.apply([](const Counted& c){ return c.m_str.size(); }));
+    assert(2 == Counted::s_live);
+
+    // `drop` ends the lifetime at once; it is not available unchecked.
+    if constexpr (Policy::checked) {
+      copy.drop();
+      assert(1 == Counted::s_live);
+    }
+    else
+      static_assert(! requires { copy.drop(); });
+  }
+  assert(0 == Counted::s_live);
+
+  RustObj<const int, Policy> ci(42);
+  assert(43 == ci.apply([](const int& v, int d){ return v + d; }, 1));
+}
+
+/// Divide a mutable borrow of a vector into disjoint slices.
+template <class Policy>
+void test_slices()
+{
+  RustObj<std::vector<int>, Policy> obj(10, 0);
+
+  {
+    RustRef<std::vector<int>, Policy> r = &obj;
+    auto [lo, hi] = r.slice_mut().split_at_mut(4);
+    assert(4 == lo.size() && 6 == hi.size());
+    lo.mapply([](std::span<int> s){ for (int& e : s) e = 1; });
+    hi.mapply([](std::span<int> s){ for (int& e : s) e = 2; });
+
+    std::vector<RustSliceMut<int, Policy>> chunks =
+      std::move(hi).chunks_mut(4);
+    assert(2 == chunks.size());
+    assert(4 == chunks[0].size() && 2 == chunks[1].size());
+    chunks[1].mapply([](std::span<int> s){ s[1] = 3; });
+    assert(7 == chunks[0].apply([](std::span<const int> s){
+      return s.size() + s.front() + 1; }));
+
+    // Splitting at either end yields an empty slice.
+    auto [none, all] = std::move(lo).split_at_mut(0);
+    assert(none.empty() && 4 == all.size());
+  }  // Slices are destroyed before `r`.
+
+  {
+    RustRef<std::vector<int>, Policy> r = &obj;
+    {
+      RustSliceMut<int, Policy> whole = r.slice_mut();
+      assert(10 == whole.size());
+    }
+    // With the slice gone, the borrow is usable again.
+    r.mapply([](std::vector<int>& v){ v.push_back(4); });
+  }
+
+  assert(1 + 2 + 3 + 4 == obj.apply([](const std::vector<int>& v){
+    return v[0] + v[4] + v[9] + v[10]; }));
+}
+
+// Compile-time borrow checking: every scenario below is run through constant
+// evaluation with `borrow_checked`. Legal scenarios are constant expressions;
+// in the others, the violated `RustAssert` makes evaluation non-constant, so
+// the violation is rejected at compile time. The same scenarios are run at
+// run time with `borrow_unchecked`, which has no checks to pay for.
+
+/// True if `Scenario()` is a constant expression.
+template <bool (*Scenario)()>
+concept constant_evaluable =
+  requires { typename std::bool_constant<Scenario()>; };
+
+template <class Policy>
+constexpr bool shared_then_mutable()
+{
+  RustObj<int, Policy> o(1);
+  {
+    RustRef<const int, Policy> r1 = +o;
+    RustRef<const int, Policy> r2 = r1;
+    if (2 != r1.apply([](const int& v){ return v; }) +
+             r2.apply([](const int& v){ return v; }))
+      return false;
+  }
+  RustRef<int, Policy> m = &o;
+  m.mapply([](int& v){ v = 5; });
+  m.drop();
+  if constexpr (Policy::checked)
+    o.drop();
+  return true;
+}
+
+template <class Policy>
+constexpr bool mutate_container()
+{
+  RustObj<std::vector<int>, Policy> o(4, 1);
+  RustRef<std::vector<int>, Policy> r = &o;
+  r.mapply([](std::vector<int>& v){ v.push_back(2); });
+  return 6 == r.apply([](const std::vector<int>& v){
+    return v[0] + v[1] + v[2] + v[3] + v[4]; });
+}
+
+// Each violation below is the only thing that keeps its function from being
+// a constant expression: without the borrow checks, each would evaluate to
+// `true` without touching a null pointer or a dead object.
+
+template <class Policy>
+constexpr bool mutable_while_shared()
+{
+  RustObj<int, Policy> o(1);
+  RustRef<const int, Policy> r = +o;
+  RustRef<int, Policy> m = &o;               // Violation
+  return true;
+}
+
+template <class Policy>
+constexpr bool shared_while_mutable()
+{
+  RustObj<int, Policy> o(1);
+  RustRef<int, Policy> m = &o;
+  return 1 == o.apply([](const int& v){ return v; });  // Violation
+}
+
+template <class Policy>
+constexpr bool two_mutable()
+{
+  RustObj<int, Policy> o(1);
+  RustRef<int, Policy> m1 = &o;
+  RustRef<int, Policy> m2 = &o;              // Violation
+  return true;
+}
+
+template <class Policy>
+constexpr bool use_after_drop()
+{
+  RustObj<int, Policy> o(1);
+  o.drop();
+  o.apply([](const int&){ });                // Violation
+  return true;
+}
+
+template <class Policy>
+constexpr bool use_after_move()
+{
+  RustObj<int, Policy> o(1);
+  RustRef<int, Policy> m1 = &o;
+  RustRef<int, Policy> m2 = std::move(m1);
+  RustRef<int, Policy> m3 = std::move(m1);   // Violation
+  return true;
+}
+
+template <class Policy>
+constexpr bool destroy_while_borrowed()
+{
+  using Obj = RustObj<int, Policy>;
+  using Ref = RustRef<const int, Policy>;
+
+  // `*r` is never destroyed, so that ending its borrow does not touch the
+  // destroyed `*p`.
+  std::allocator<Obj> obj_alloc;
+  std::allocator<Ref> ref_alloc;
+  Obj *p = std::construct_at(obj_alloc.allocate(1), 1);
+  Ref *r = std::construct_at(ref_alloc.allocate(1), +*p);
+  std::destroy_at(p);                        // Violation
+  obj_alloc.deallocate(p, 1);
+  ref_alloc.deallocate(r, 1);
+  return true;
+}
+
+static_assert(  constant_evaluable<shared_then_mutable<borrow_checked>>);
+static_assert(  constant_evaluable<mutate_container<borrow_checked>>);
+static_assert(! constant_evaluable<mutable_while_shared<borrow_checked>>);
+static_assert(! constant_evaluable<shared_while_mutable<borrow_checked>>);
+static_assert(! constant_evaluable<two_mutable<borrow_checked>>);
+static_assert(! constant_evaluable<use_after_drop<borrow_checked>>);
+static_assert(! constant_evaluable<use_after_move<borrow_checked>>);
+static_assert(! constant_evaluable<destroy_while_borrowed<borrow_checked>>);
+
+static_assert(shared_then_mutable<borrow_checked>());
+static_assert(mutate_container<borrow_checked>());
+
+int main()
+{
+  assert(shared_then_mutable<borrow_unchecked>());
+  assert(mutate_container<borrow_unchecked>());
+
+  test_borrows<borrow_checked>();
+  test_borrows<borrow_unchecked>();
+  test_slices<borrow_checked>();
+  test_slices<borrow_unchecked>();
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
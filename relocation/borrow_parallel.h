@@ -0,0 +1,56 @@
+/* borrow_parallel.h                                                  -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// Parallel algorithms over borrow-checked mutable slices (see `borrow.h`),
+/// scheduled on a `work_stealing_pool` (see `work_stealing.h`).
+
+#ifndef INCLUDED_BORROW_PARALLEL
+#define INCLUDED_BORROW_PARALLEL
+
+#include <borrow.h>
+#include <work_stealing.h>
+
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace xstd {
+
+/// Invoke `f(e)` for every element `e` of `slice`, in parallel on `pool`.
+/// The slice is recursively split in half with `split_at_mut` until pieces
+/// are no larger than `grain`, and each right half is forked as a task, so
+/// each task owns a disjoint mutable borrow. Return after every invocation
+/// has completed and every piece has been released.
+template <class T, class Policy, class F>
+void par_for_each_mut(work_stealing_pool& pool, RustSliceMut<T, Policy> slice,
+                      const F& f, std::size_t grain = 1)
+{
+  if (0 == grain)
+    grain = 1;
+
+  task_group group(pool);
+  while (slice.size() > grain) {
+    std::size_t mid = slice.size() / 2;
+    auto [left, right] = std::move(slice).split_at_mut(mid);
+    group.spawn([&pool, right = std::move(right), &f, grain]() mutable {
+      par_for_each_mut(pool, std::move(right), f, grain);
+    });
+    slice = std::move(left);
+  }
+  slice.mapply([&f](std::span<T> s) {
+    for (T& e : s)
+      f(e);
+  });
+  group.sync();
+}
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_BORROW_PARALLEL)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -0,0 +1,116 @@
+/* borrow_parallel.t.cpp                                              -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// Run the benchmarks with
+// `make borrow_parallel.test TEST_ARGS=bench CXXOPT=-O2`.
+
+#include <borrow_parallel.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <cassert>
+
+using xstd::RustObj;
+using xstd::RustRef;
+using xstd::RustSliceMut;
+using xstd::borrow_checked;
+using xstd::borrow_unchecked;
+
+template <class Policy>
+void test_par_for_each_mut()
+{
+  xstd::work_stealing_pool pool(4);
+
+  RustObj<std::vector<long>, Policy> obj(100000, 1L);
+  {
+    RustRef<std::vector<long>, Policy> r = &obj;
+    xstd::par_for_each_mut(pool, r.slice_mut(), [](long& e){ e *= 3; }, 1000);
+    xstd::par_for_each_mut(pool, r.slice_mut(), [](long& e){ e += 1; });
+    r.mapply([](std::vector<long>& v){ v.push_back(4); });
+  }
+  assert(100000 * 4 + 4 == obj.apply([](const std::vector<long>& v){
+    long sum = 0;
+    for (long e : v)
+      sum += e;
+    return sum;
+  }));
+
+  // Chunks can be handed to separate threads.
+  {
+    RustRef<std::vector<long>, Policy> r = &obj;
+    std::vector<RustSliceMut<long, Policy>> chunks =
+      r.slice_mut().chunks_mut(25000);
+    std::size_t chunks_size = chunks.size();
+    std::vector<std::thread> threads;
+    for (RustSliceMut<long, Policy>& c : chunks)
+      threads.emplace_back([c = std::move(c)]() mutable {
+        c.mapply([](std::span<long> s){ for (long& e : s) e = 0; });
+      });
+    for (std::thread& t : threads)
+      t.join();
+    chunks.clear();
+    assert(5 == chunks_size);
+    assert(0 == r.apply([](const std::vector<long>& v){ return v.back(); }));
+  }
+  assert(0 == obj.apply([](const std::vector<long>& v){ return v[77777]; }));
+}
+
+/// Time an element-wise update of a large vector using `par_for_each_mut`
+/// with policy `Policy`, or using raw `parallel_for` if `Policy` is `void`.
+template <class Policy>
+double bench_update(std::size_t threads)
+{
+  constexpr std::size_t count = 1 << 21;
+  constexpr std::size_t grain = 4096;
+
+  xstd::work_stealing_pool pool(threads);
+  auto update = [](double& e){ e = std::sqrt(e + 1.0) * 1.5; };
+
+  auto start = std::chrono::steady_clock::now();
+  if constexpr (std::is_void_v<Policy>) {
+    std::vector<double> v(count, 1.0);
+    for (int rep = 0; rep < 4; ++rep)
+      xstd::parallel_for(pool, 0, count,
+                         [&](std::size_t i){ update(v[i]); }, grain);
+  }
+  else {
+    RustObj<std::vector<double>, Policy> obj(count, 1.0);
+    RustRef<std::vector<double>, Policy> r = &obj;
+    for (int rep = 0; rep < 4; ++rep)
+      xstd::par_for_each_mut(pool, r.slice_mut(), update, grain);
+  }
+  std::chrono::duration<double, std::milli> elapsed =
+    std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+void bench_scaling()
+{
+  std::cout << "threads  parallel_for  unchecked  checked (ms)\n";
+  for (std::size_t threads = 1; threads <= 8; threads *= 2)
+    std::cout << threads << "\t " << bench_update<void>(threads)
+              << "\t\t" << bench_update<borrow_unchecked>(threads)
+              << "\t   " << bench_update<borrow_checked>(threads) << '\n';
+}
+
+int main(int argc, char *argv[])
+{
+  test_par_for_each_mut<borrow_checked>();
+  test_par_for_each_mut<borrow_unchecked>();
+
+  if (argc > 1 && std::string(argv[1]) == "bench")
+    bench_scaling();
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -7,6 +7,8 @@
 #ifndef INCLUDED_RELOCATATABLE
 #define INCLUDED_RELOCATATABLE
 
+#include <relocation_builtins.h>
+
 #include <type_traits>
 #include <concepts>
 
@@ -28,10 +30,12 @@ struct defaulted_relocation_ref
 
 /// Trait to determine eligibility for trivial relocation.
 /// TBD: the correct way to implement this trait is using reflection, but
-/// for the moment, is is true for trivially move-constructible types and for
-/// types having a function declaration, `static T& is_eligible_for_TR();`.
+/// for the moment, is is true for types the compiler reports as trivially
+/// relocatable, for trivially move-constructible types, and for types having a
+/// function declaration, `static T& is_eligible_for_TR();`.
 template <class T>
 inline constexpr bool is_eligible_for_TR_v =
+  builtin_is_trivially_relocatable_v<T> ||
   (is_trivially_move_constructible_v<T> && is_trivially_destructible_v<T>) ||
   requires { { T::is_eligible_for_TR() } -> same_as<T>; };
 
@@ -40,9 +44,10 @@ struct is_eligible_for_TR : bool_constant<is_eligible_for_TR_v<T>> { };
 
 template <class T>
 inline constexpr bool is_trivially_relocatable_v =
-  is_eligible_for_TR_v<T> &&
-  ((is_trivially_move_constructible_v<T> && is_trivially_destructible_v<T>) ||
-   requires (defaulted_relocation_ref<T> rr) { T(rr); });
+  builtin_is_trivially_relocatable_v<T> ||
+  (is_eligible_for_TR_v<T> &&
+   ((is_trivially_move_constructible_v<T> && is_trivially_destructible_v<T>) ||
+    requires (defaulted_relocation_ref<T> rr) { T(rr); }));
 
 template <class T>
 struct is_trivially_relocatable : bool_constant<is_trivially_relocatable_v<T>>
@@ -21,7 +21,14 @@
 #ifndef INCLUDED_MEMBER_RELOCATE_AT
 #define INCLUDED_MEMBER_RELOCATE_AT
 
+#include <relocate_elementwise.h>
+#include <relocation_builtins.h>
+#include <relocation_telemetry.h>
+
+#include <concepts>
 #include <memory>
+#include <type_traits>
+#include <cstring>
 
 namespace xstd {
 
@@ -30,15 +37,17 @@ using namespace std;
 /// Trait to determine eligibility for trivial relocation.  TBD: In the absence
 /// of compiler support, this trait is mostly user-warranted. The correct
 /// way to implement this trait is using reflection or a builtin, but for the
-/// moment, is is true for trivially move-constructible types and for types
-/// having a function declaration, `static T& is_eligible_for_TR();`.
+/// moment, is is true for types the compiler reports as trivially relocatable
+/// (see `relocation_builtins.h`), for trivially move-constructible types, and
+/// for types having a function declaration, `static T& is_eligible_for_TR();`.
 template <class T>
-inline constexpr bool __is_eligible_for_TR_v =
+inline constexpr bool is_eligible_for_TR_v =
+  builtin_is_trivially_relocatable_v<T> ||
   (is_trivially_move_constructible_v<T> && is_trivially_destructible_v<T>) ||
   requires { { T::is_eligible_for_TR() } -> same_as<T>; };
 
 template <class T>
-struct __is_eligible_for_TR : bool_constant<__is_eligible_for_TR_v<T>> { };
+struct is_eligible_for_TR : bool_constant<is_eligible_for_TR_v<T>> { };
 
 /// A trivially relocatable type is either implicitly trivially relocatable or
 /// is eligible for TR _and_ has a `default_relocate_at` member function (no
@@ -48,15 +57,21 @@ struct __is_eligible_for_TR : bool_constant<__is_eligible_for_TR_v<T>> { };
 /// relocatable.
 template <class T>
 inline constexpr bool is_trivially_relocatable_v =
-  is_eligible_for_TR_v<T> &&
-  ((is_trivially_move_constructible_v<T> && is_trivially_destructible_v<T>) ||
-   requires requires (T& from, T* to) { from.default_relocate_at(to); })
+  builtin_is_trivially_relocatable_v<T> ||
+  (is_eligible_for_TR_v<T> &&
+   ((is_trivially_move_constructible_v<T> && is_trivially_destructible_v<T>) ||
+    requires (T& from, T* to) { from.default_relocate_at(to); }));
 
 template <class T>
 struct is_trivially_relocatable : bool_constant<is_trivially_relocatable_v<T>>
 {
 };
 
+/// True if `T` has a user-defined `relocate_at` member function.
+template <class T>
+concept __has_member_relocate_at =
+  requires (T& from, T* to) { from.relocate_at(to); };
+
 /// Relocate an object whose of type having a `relocate_at` member function.
 /// We mandate that member `relocate_at` be `noexcept`.
 /// A member `relocate_at` can use any allowed mechanism, including private
@@ -66,11 +81,12 @@ struct is_trivially_relocatable : bool_constant<is_trivially_relocatable_v<T>>
 /// mechanism, perhaps with some variation of `relocate_from` that delays
 /// calling the destructor/vacuous destructor.
 template <class T>
-requires requires (T& from, T* to) { from.relocate_at(to); }
-constexpr T& relocate_at(T* to, T& from) noexcept
+requires __has_member_relocate_at<T>
+constexpr T* relocate_at(T* to, T& from) noexcept
 {
-  static_assert(noexcept(noexcept(from.relocate_at(to))),
+  static_assert(noexcept(from.relocate_at(to)),
                 "Member `relocate_at` must be `noexcept`");
+  record_relocation<T>(relocation_path::member_hook);
   from.relocate_at(to);
   return to;
 }
@@ -79,12 +95,21 @@ constexpr T& relocate_at(T* to, T& from) noexcept
 /// relocatable and trivially relocatable, this will deliberately result in an
 /// overload ambiguity. Perhaps TR should take precidence, so that a class that
 /// might not be TR can supply both a defaulted and not-defaulted
-/// `relocate_at`.
+/// `relocate_at`. `memmove` cannot be used in constant evaluation, so there
+/// the object is relocated by move+destroy instead.
 template <class T>
 requires (is_trivially_relocatable_v<T>)
-/* constexpr? */ T& relocate_at(T* to, T& from) noexcept
+constexpr T* relocate_at(T* to, T& from) noexcept
 {
-  trivially_relocate(addressof(from), addressof(from) + 1, to);
+  record_relocation<T>(relocation_path::trivial);
+  if constexpr (is_move_constructible_v<T>) {
+    if consteval {
+      to = construct_at(to, std::move(from));
+      from.~T();
+      return to;
+    }
+  }
+  std::memmove((void*) to, (void*) addressof(from), sizeof(T));
   return to;
 }
 
@@ -92,9 +117,11 @@ requires (is_trivially_relocatable_v<T>)
 /// followed by destruction of the old. This overload is called for types that
 /// are neither trivially relocatable nor have a `relocate_at` member function.
 template <class T>
-requires (is_nothrow_move_constructible_v<T> && is_nothrow_destructible_v<T>)
-constexpr T& relocate_at(T* to, T& from) noexcept
+requires (is_nothrow_move_constructible_v<T> && is_nothrow_destructible_v<T> &&
+          ! is_trivially_relocatable_v<T> && ! __has_member_relocate_at<T>)
+constexpr T* relocate_at(T* to, T& from) noexcept
 {
+  record_relocation<T>(relocation_path::move_destroy);
   to = construct_at(to, std::move(from));
   from.~T();
   return to;
@@ -106,30 +133,44 @@ constexpr T& relocate_at(T* to, T& from) noexcept
 /// think it is possible to generate a member-initialization list, but possibly
 /// using `make_uninitialized` (with some UB thrown in).
 
+/// Relocate the objects in `[start, finish)` to the uninitialized storage
+/// starting at `dest`, one at a time, using each object's `relocate_at`
+/// member if it has one and move+destroy otherwise.
 template <class T>
-requires (is_trivially_relocatable<T>)
-T* relocate(T* start, T* finish, T* dest)
+constexpr T* __relocate_members(T* start, T* finish, T* dest) noexcept
 {
-  trivially_relocate(start, finish, dest);
+  if constexpr (__has_member_relocate_at<T>) {
+    auto relocate_one = [](T* to, T& from) { from.relocate_at(to); };
+    return __relocate_elementwise(start, finish, dest, relocate_one);
+  }
+  else
+    return __relocate_elementwise(start, finish, dest);
 }
 
 template <class T>
-requires (! is_trivially_relocatable<T>)
+requires (is_trivially_relocatable_v<T>)
 constexpr T* relocate(T* start, T* finish, T* dest)
 {
-  if (dest == start)
-    return finish;
-  else if (start <= dest && dest < finish) {
-    dest += (finish - start);
-    for (T* cursor = dest; finish != start; )
-      relocate_at(--cursor--, *--finish);
-  }
-  else {
-    while (start != finish)
-      relocate_at(dest++, *start++);
+  record_relocation<T>(relocation_path::trivial, finish - start);
+  if constexpr (is_move_constructible_v<T>) {
+    if consteval {
+      return __relocate_members(start, finish, dest);
+    }
   }
+  std::memmove((void*) dest, (void*) start, (finish - start) * sizeof(T));
+  return dest + (finish - start);
+}
 
-  return dest;
+template <class T>
+requires (! is_trivially_relocatable_v<T>)
+constexpr T* relocate(T* start, T* finish, T* dest)
+{
+  // Record the whole range as one call, then relocate each element without
+  // recording it again.
+  record_relocation<T>(__has_member_relocate_at<T> ?
+                       relocation_path::member_hook :
+                       relocation_path::move_destroy, finish - start);
+  return __relocate_members(start, finish, dest);
 }
 
 } // close namespace xstd
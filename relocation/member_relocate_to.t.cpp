@@ -0,0 +1,139 @@
+/* member_relocate_to.t.cpp                                           -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+#define XSTD_RELOCATION_TELEMETRY 1
+
+#include <member_relocate_to.h>
+
+#include <new>
+#include <iostream>
+#include <cassert>
+
+// Trivially copyable, hence TR
+struct W
+{
+  int v;
+};
+
+// Not trivially destructible and not warranted eligible, hence not TR.
+struct X
+{
+  int v;
+
+  constexpr explicit X(int i = 0) : v(i) { }
+  constexpr X(X&& other) noexcept : v(other.v) { other.v = -1; }
+  constexpr ~X() { }
+};
+
+// Declared eligible for TR and has a defaulted relocation member, hence TR.
+struct Y
+{
+  int v;
+
+  static Y is_eligible_for_TR();
+  void default_relocate_at(Y*);
+
+  constexpr explicit Y(int i = 0) : v(i) { }
+  constexpr Y(Y&& other) noexcept : v(other.v) { other.v = -1; }
+  constexpr ~Y() { }
+};
+
+// Has a user-defined relocation hook.
+struct Z
+{
+  int v;
+  static int s_hook_calls;
+
+  explicit Z(int i = 0) : v(i) { }
+  Z(Z&& other) noexcept : v(other.v) { other.v = -1; }
+  ~Z() { }
+
+  void relocate_at(Z* to) noexcept
+  {
+    ++s_hook_calls;
+    ::new (to) Z(v);
+    v = -2;
+  }
+};
+
+int Z::s_hook_calls = 0;
+
+static_assert(  xstd::is_trivially_relocatable_v<W>);
+static_assert(! xstd::is_trivially_relocatable_v<X>);
+static_assert(  xstd::is_trivially_relocatable_v<Y>);
+static_assert(! xstd::is_trivially_relocatable_v<Z>);
+
+template <class T>
+union Buf
+{
+  T objs[6];
+  Buf() { }
+  ~Buf() { }
+};
+
+using xstd::relocation_path;
+
+template <class T>
+void test_paths(relocation_path expected)
+{
+  Buf<T> b;
+  for (int i = 0; i < 4; ++i)
+    ::new (&b.objs[i]) T(i + 1);
+
+  // Relocate one element, then shift the range right by one, overlapping.
+  T *p = xstd::relocate_at(&b.objs[4], b.objs[3]);
+  assert(4 == p->v);
+  T *e = xstd::relocate(b.objs, b.objs + 3, b.objs + 1);
+  assert(b.objs + 4 == e);
+  for (int i = 1; i <= 4; ++i) {
+    assert(i == b.objs[i].v);
+    b.objs[i].~T();
+  }
+
+  const xstd::relocation_stats& s = xstd::relocation_stats_for<T>();
+  assert(2 == s[expected].m_calls);
+  assert(4 * sizeof(T) == s[expected].m_bytes);
+}
+
+/// Relocate within compile-time allocated storage and return the sum of the
+/// values that end up in positions 1 through 4.
+template <class T>
+constexpr int constexpr_relocate()
+{
+  std::allocator<T> a;
+  T *buf = a.allocate(6);
+  for (int i = 0; i < 4; ++i)
+    std::construct_at(buf + i, i + 1);
+
+  xstd::relocate_at(buf + 4, buf[3]);
+  xstd::relocate(buf, buf + 3, buf + 1);
+  int ret = 0;
+  for (int i = 1; i <= 4; ++i) {
+    ret = ret * 10 + buf[i].v;
+    buf[i].~T();
+  }
+  a.deallocate(buf, 6);
+  return ret;
+}
+
+static_assert(1234 == constexpr_relocate<W>());
+static_assert(1234 == constexpr_relocate<X>());
+static_assert(1234 == constexpr_relocate<Y>());
+
+int main()
+{
+  test_paths<W>(relocation_path::trivial);
+  test_paths<X>(relocation_path::move_destroy);
+  test_paths<Y>(relocation_path::trivial);
+  test_paths<Z>(relocation_path::member_hook);
+  assert(4 == Z::s_hook_calls);
+
+  xstd::dump_relocation_telemetry(std::cout);
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -0,0 +1,221 @@
+/* mpmc_queue.h                                                       -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// This header implements `mpmc_queue<T>`, a bounded, lock-free,
+/// multi-producer/multi-consumer queue based on Dmitry Vyukov's design, in
+/// which every slot carries a sequence number that tells producers and
+/// consumers whether it is theirs to fill or drain.
+///
+/// Objects are handed off by relocation: `try_push` relocates the caller's
+/// object into a slot and `try_pop(to)` or `pop` relocates it out again, via
+/// `relocate_from`, directly into the destination. For a trivially
+/// relocatable `T`, each hop is thus a single byte copy; no move constructor
+/// is invoked and no moved-from object is left behind to be destroyed.
+///
+/// `try_pop()` relocates into the returned `optional` through a conversion
+/// function. Whether that avoids a move depends on the compiler eliding the
+/// temporary (CWG2327), which GCC does but the standard does not require.
+
+#ifndef INCLUDED_MPMC_QUEUE
+#define INCLUDED_MPMC_QUEUE
+
+#include <relocate_from.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <new>
+#include <cstddef>
+
+namespace xstd {
+
+using namespace std;
+
+template <class T>
+class mpmc_queue
+{
+  static constexpr size_t s_cache_line = 64;
+
+  struct slot
+  {
+    atomic<size_t>           m_seq;
+    alignas(T) unsigned char m_bytes[sizeof(T)];
+  };
+
+  alignas(s_cache_line) atomic<size_t> m_tail;  // Next position to push
+  alignas(s_cache_line) atomic<size_t> m_head;  // Next position to pop
+  alignas(s_cache_line) unique_ptr<slot[]> m_slots;
+  size_t                                   m_mask;
+
+  static T *object_in(slot *s)
+    { return std::launder(reinterpret_cast<T*>(s->m_bytes)); }
+
+  /// The destructor of this `struct` releases a slot for reuse by producers
+  /// after a consumer has relocated the object out of it.
+  struct releaser
+  {
+    slot   *m_slot;
+    size_t  m_seq;
+    ~releaser() { m_slot->m_seq.store(m_seq, memory_order_release); }
+  };
+
+public:
+  using value_type = T;
+
+  /// Create a queue with room for at least `min_capacity` objects.
+  explicit mpmc_queue(size_t min_capacity)
+    : m_tail(0), m_head(0)
+  {
+    size_t capacity = 2;
+    while (capacity < min_capacity)
+      capacity <<= 1;
+
+    m_slots.reset(new slot[capacity]);
+    m_mask = capacity - 1;
+    for (size_t i = 0; i < capacity; ++i)
+      m_slots[i].m_seq.store(i, memory_order_relaxed);
+  }
+
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+  ~mpmc_queue()
+  {
+    while (slot *s = claim_ready())
+      object_in(s)->~T();
+  }
+
+  size_t capacity() const { return m_mask + 1; }
+
+  /// If there is room in the queue, relocate `*from` into it and return
+  /// `true`; the lifetime of `*from` has then ended. Otherwise, return `false`
+  /// and leave `*from` untouched.
+  bool try_push(T *from)
+  {
+    slot *s = claim_empty();
+    if (! s)
+      return false;
+
+    ::new (s->m_bytes) T(relocate_from(from));
+    publish(s);
+    return true;
+  }
+
+  /// Relocate `*from` into the queue, waiting for room if necessary.
+  void push(T *from)
+  {
+    while (! try_push(from))
+      this_thread::yield();
+  }
+
+  /// If there is room in the queue, construct a `T` in it from `args` and
+  /// return `true`; otherwise, return `false`.
+  template <class... Args>
+  bool try_emplace(Args&&... args)
+  {
+    slot *s = claim_empty();
+    if (! s)
+      return false;
+
+    ::new (s->m_bytes) T(std::forward<Args>(args)...);
+    publish(s);
+    return true;
+  }
+
+  /// If the queue is not empty, relocate the oldest object out of it into
+  /// the uninitialized storage at `to` and return `true`; otherwise, return
+  /// `false`.
+  bool try_pop(T *to)
+  {
+    slot *s = claim_ready();
+    if (! s)
+      return false;
+
+    releaser r{ s, s->m_seq.load(memory_order_relaxed) + m_mask };
+    ::new (to) T(relocate_from(object_in(s)));
+    return true;
+  }
+
+  /// Relocate the oldest object out of the queue and return it, or return
+  /// `nullopt` if the queue is empty. See the note on CWG2327 above.
+  optional<T> try_pop()
+  {
+    optional<T> ret;
+    if (slot *s = claim_ready()) {
+      releaser r{ s, s->m_seq.load(memory_order_relaxed) + m_mask };
+      ret.emplace(relocation_source<T>{ object_in(s) });
+    }
+    return ret;
+  }
+
+  /// Relocate the oldest object out of the queue and return it, waiting for
+  /// one to arrive if necessary.
+  T pop()
+  {
+    slot *s;
+    while (! (s = claim_ready()))
+      this_thread::yield();
+
+    releaser r{ s, s->m_seq.load(memory_order_relaxed) + m_mask };
+    return relocate_from(object_in(s));
+  }
+
+private:
+  /// Claim the slot at the tail of the ring for writing, or return null if
+  /// the ring is full.
+  slot *claim_empty()
+  {
+    size_t pos = m_tail.load(memory_order_relaxed);
+    for (;;) {
+      slot *s = &m_slots[pos & m_mask];
+      ptrdiff_t dif = ptrdiff_t(s->m_seq.load(memory_order_acquire) - pos);
+      if (dif < 0)
+        return nullptr;  // Full
+      else if (dif > 0)
+        pos = m_tail.load(memory_order_relaxed);  // Another producer won
+      else if (m_tail.compare_exchange_weak(pos, pos + 1,
+                                            memory_order_relaxed))
+        return s;
+    }
+  }
+
+  /// Make the object in the claimed slot `s` visible to consumers.
+  void publish(slot *s)
+  {
+    size_t seq = s->m_seq.load(memory_order_relaxed);
+    s->m_seq.store(seq + 1, memory_order_release);
+  }
+
+  /// Claim the slot at the head of the ring for reading, or return null if
+  /// the ring is empty. The sequence number of the returned slot is one past
+  /// its position; releasing it (with sequence number `position + capacity`)
+  /// makes it available for the next lap of the producers.
+  slot *claim_ready()
+  {
+    size_t pos = m_head.load(memory_order_relaxed);
+    for (;;) {
+      slot *s = &m_slots[pos & m_mask];
+      ptrdiff_t dif = ptrdiff_t(s->m_seq.load(memory_order_acquire) -
+                                (pos + 1));
+      if (dif < 0)
+        return nullptr;  // Empty
+      else if (dif > 0)
+        pos = m_head.load(memory_order_relaxed);  // Another consumer won
+      else if (m_head.compare_exchange_weak(pos, pos + 1,
+                                            memory_order_relaxed))
+        return s;
+    }
+  }
+};
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_MPMC_QUEUE)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
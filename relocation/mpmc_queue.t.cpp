@@ -0,0 +1,266 @@
+/* mpmc_queue.t.cpp                                                   -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// Run the benchmarks with `make mpmc_queue.test TEST_ARGS=bench`.
+
+#include <mpmc_queue.h>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <cassert>
+
+/// A task-like object with non-trivial move constructor and destructor that
+/// count their invocations.
+class Task
+{
+  static std::atomic<int> s_moves;  // Number of move-ctor calls
+  static std::atomic<int> s_dtors;  // Number of dtor calls
+
+  int                          m_id;
+  std::unique_ptr<std::string> m_name;
+
+public:
+  explicit Task(int id)
+    : m_id(id)
+    , m_name(std::make_unique<std::string>("task " + std::to_string(id))) { }
+  Task(Task&& other) noexcept
+    : m_id(other.m_id), m_name(std::move(other.m_name)) { ++s_moves; }
+  ~Task() { ++s_dtors; }
+
+  int id() const { return m_id; }
+  const std::string& name() const { return *m_name; }
+
+  static int moves() { return s_moves; }
+  static int dtors() { return s_dtors; }
+  static void reset_counters() { s_moves = 0; s_dtors = 0; }
+};
+
+std::atomic<int> Task::s_moves = 0;
+std::atomic<int> Task::s_dtors = 0;
+
+/// The same as `Task`, but trivially relocatable. (`Task` would be, too, but
+/// it has not opted in.)
+class TRTask : public Task
+{
+public:
+  using Task::Task;
+};
+
+namespace xstd {
+template <> struct is_trivially_relocatable<TRTask> : true_type { };
+} // close namespace xstd
+
+template <class T>
+union Buf
+{
+  T obj;
+  Buf() { }
+  ~Buf() { }
+};
+
+void test_single_thread()
+{
+  xstd::mpmc_queue<int> q(3);
+  assert(4 == q.capacity());
+  assert(! q.try_pop());
+
+  for (int i = 0; i < 4; ++i)
+    assert(q.try_emplace(i));
+  assert(! q.try_emplace(4));
+  for (int i = 0; i < 4; ++i)
+    assert(i == *q.try_pop());
+  assert(! q.try_pop());
+
+  // Several laps around the ring.
+  for (int i = 0; i < 20; ++i) {
+    assert(q.try_emplace(i));
+    assert(q.try_emplace(-i));
+    assert(i == q.pop());
+    assert(-i == q.pop());
+  }
+}
+
+/// Verify that `T` objects are handed off without moves if (and only if) `T`
+/// is trivially relocatable, i.e., that each hop into or out of the queue
+/// moves `hop_moves` times.
+template <class T>
+void test_handoff(int hop_moves)
+{
+  int expected_moves = 4 * hop_moves;
+
+  Task::reset_counters();
+  {
+    xstd::mpmc_queue<T> q(4);
+    Buf<T> b;
+
+    ::new (&b.obj) T(1);
+    assert(q.try_push(&b.obj));     // Lifetime of `b.obj` has ended
+    ::new (&b.obj) T(2);
+    q.push(&b.obj);
+    assert(q.try_emplace(3));
+    assert(q.try_emplace(4));
+
+    Buf<T> t1;
+    assert(q.try_pop(&t1.obj));
+    assert(1 == t1.obj.id() && "task 1" == t1.obj.name());
+    t1.obj.~T();
+    T t2 = q.pop();
+    assert(2 == t2.id() && "task 2" == t2.name());
+    assert(expected_moves == Task::moves());
+    assert(expected_moves + 1 == Task::dtors());  // Moved-from objects + t1
+
+    // Moving into the `optional` is elided only under CWG2327.
+    std::optional<T> t3 = q.try_pop();
+    assert(t3 && 3 == t3->id() && "task 3" == t3->name());
+    int optional_moves = Task::moves() - expected_moves;
+#if defined(__GNUC__) && ! defined(__clang__)
+    assert(hop_moves == optional_moves);
+#else
+    assert(hop_moves <= optional_moves && optional_moves <= hop_moves + 1);
+#endif
+    expected_moves += optional_moves;
+
+    // `T(4)` is still in the queue and is destroyed with it.
+  }
+  assert(4 + expected_moves == Task::dtors());
+}
+
+void test_multiple_threads()
+{
+  constexpr int producers = 4, consumers = 4, count = 20000;
+
+  xstd::mpmc_queue<TRTask> q(64);
+  std::atomic<long> sum = 0;
+  std::atomic<int>  popped = 0;
+  std::vector<std::thread> threads;
+
+  for (int p = 0; p < producers; ++p)
+    threads.emplace_back([&, p]{
+      Buf<TRTask> b;
+      for (int i = 0; i < count; ++i) {
+        ::new (&b.obj) TRTask(p * count + i);
+        q.push(&b.obj);
+      }
+    });
+
+  for (int c = 0; c < consumers; ++c)
+    threads.emplace_back([&]{
+      while (popped < producers * count) {
+        if (std::optional<TRTask> t = q.try_pop()) {
+          assert("task " + std::to_string(t->id()) == t->name());
+          sum += t->id();
+          ++popped;
+        }
+        else
+          std::this_thread::yield();
+      }
+    });
+
+  for (std::thread& t : threads)
+    t.join();
+
+  constexpr long n = producers * count;
+  assert(n * (n - 1) / 2 == sum);
+  assert(! q.try_pop());
+}
+
+/// Baseline for comparison: a mutex-protected `std::deque`.
+template <class T>
+class locked_deque
+{
+  std::mutex    m_mutex;
+  std::deque<T> m_deque;
+
+public:
+  explicit locked_deque(std::size_t) { }
+
+  bool try_push(T *from)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_deque.push_back(std::move(*from));
+    from->~T();
+    return true;
+  }
+
+  std::optional<T> try_pop()
+  {
+    std::optional<T> ret;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (! m_deque.empty()) {
+      ret.emplace(std::move(m_deque.front()));
+      m_deque.pop_front();
+    }
+    return ret;
+  }
+};
+
+/// Run `threads` threads, each pushing and popping `ops / threads` objects,
+/// and return the elapsed time in nanoseconds per push/pop pair.
+template <class Queue>
+double bench_queue(int threads, int ops)
+{
+  using T = TRTask;
+  Queue q(1024);
+  std::atomic<bool> go = false;
+  std::vector<std::thread> pool;
+
+  for (int t = 0; t < threads; ++t)
+    pool.emplace_back([&]{
+      while (! go)
+        std::this_thread::yield();
+      Buf<T> b;
+      for (int i = 0; i < ops / threads; ++i) {
+        ::new (&b.obj) T(i);
+        while (! q.try_push(&b.obj))
+          std::this_thread::yield();
+        while (! q.try_pop())
+          std::this_thread::yield();
+      }
+    });
+
+  auto start = std::chrono::steady_clock::now();
+  go = true;
+  for (std::thread& t : pool)
+    t.join();
+  std::chrono::duration<double, std::nano> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  return elapsed.count() / (ops / threads * threads);
+}
+
+void bench_scaling()
+{
+  constexpr int ops = 400000;
+
+  std::cout << "threads  mpmc_queue (ns/op)  mutex+deque (ns/op)\n";
+  for (int threads = 1; threads <= 64; threads *= 2)
+    std::cout << threads << "\t " << bench_queue<xstd::mpmc_queue<TRTask>>(
+                                       threads, ops)
+              << "\t\t     " << bench_queue<locked_deque<TRTask>>(threads, ops)
+              << '\n';
+}
+
+int main(int argc, char *argv[])
+{
+  test_single_thread();
+  test_handoff<TRTask>(0);
+  test_handoff<Task>(1);
+  test_multiple_threads();
+
+  if (argc > 1 && std::string(argv[1]) == "bench")
+    bench_scaling();
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
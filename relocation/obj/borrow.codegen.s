@@ -0,0 +1,9444 @@
+	.file	"borrow.codegen.cpp"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/relocation" "borrow.codegen.cpp"
+	.p2align 4
+	.globl	direct_read
+	.type	direct_read, @function
+direct_read:
+.LVL0:
+.LFB4860:
+	.file 1 "borrow.codegen.cpp"
+	.loc 1 20 36 view -0
+	.cfi_startproc
+	.loc 1 20 38 view .LVU1
+	.loc 1 20 47 is_stmt 0 view .LVU2
+	movl	(%rdi), %eax
+	.loc 1 20 53 view .LVU3
+	leal	1(%rax,%rax,2), %eax
+	.loc 1 20 56 view .LVU4
+	ret
+	.cfi_endproc
+.LFE4860:
+	.size	direct_read, .-direct_read
+	.p2align 4
+	.globl	rust_read
+	.type	rust_read, @function
+rust_read:
+.LFB5711:
+	.cfi_startproc
+	.loc 1 21 16 is_stmt 1 view .LVU5
+	movl	(%rdi), %eax
+	leal	1(%rax,%rax,2), %eax
+	ret
+	.cfi_endproc
+.LFE5711:
+	.size	rust_read, .-rust_read
+	.p2align 4
+	.globl	rust_const_read
+	.type	rust_const_read, @function
+rust_const_read:
+.LFB5713:
+	.cfi_startproc
+	.loc 1 27 16 view .LVU6
+	movl	(%rdi), %eax
+	leal	1(%rax,%rax,2), %eax
+	ret
+	.cfi_endproc
+.LFE5713:
+	.size	rust_const_read, .-rust_const_read
+	.p2align 4
+	.globl	direct_write
+	.type	direct_write, @function
+direct_write:
+.LVL1:
+.LFB4873:
+	.loc 1 34 45 view -0
+	.cfi_startproc
+	.loc 1 34 47 view .LVU8
+	.loc 1 34 49 is_stmt 0 view .LVU9
+	addl	%esi, (%rdi)
+	.loc 1 34 55 view .LVU10
+	ret
+	.cfi_endproc
+.LFE4873:
+	.size	direct_write, .-direct_write
+	.p2align 4
+	.globl	rust_write
+	.type	rust_write, @function
+rust_write:
+.LFB5715:
+	.cfi_startproc
+	.loc 1 35 17 is_stmt 1 view .LVU11
+	addl	%esi, (%rdi)
+	ret
+	.cfi_endproc
+.LFE5715:
+	.size	rust_write, .-rust_write
+	.p2align 4
+	.globl	direct_ptr_read
+	.type	direct_ptr_read, @function
+direct_ptr_read:
+.LVL2:
+.LFB4880:
+	.loc 1 43 46 view -0
+	.cfi_startproc
+	.loc 1 43 48 view .LVU13
+	.loc 1 43 60 is_stmt 0 view .LVU14
+	movl	(%rdi), %eax
+	addl	$1, %eax
+	.loc 1 43 63 view .LVU15
+	ret
+	.cfi_endproc
+.LFE4880:
+	.size	direct_ptr_read, .-direct_ptr_read
+	.p2align 4
+	.globl	rust_ref_read
+	.type	rust_ref_read, @function
+rust_ref_read:
+.LVL3:
+.LFB4881:
+	.loc 1 45 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 46 3 view .LVU17
+.LBB106:
+.LBI106:
+	.file 2 "./borrow.h"
+	.loc 2 498 28 view .LVU18
+.LBB107:
+.LBB108:
+.LBI108:
+	.loc 1 46 18 view .LVU19
+.LBB109:
+	.loc 1 46 36 view .LVU20
+	.loc 1 46 47 is_stmt 0 view .LVU21
+	movl	(%rdi), %eax
+.LVL4:
+	.loc 1 46 47 view .LVU22
+	addl	$1, %eax
+.LBE109:
+.LBE108:
+.LBE107:
+.LBE106:
+	.loc 1 47 1 view .LVU23
+	ret
+	.cfi_endproc
+.LFE4881:
+	.size	rust_ref_read, .-rust_ref_read
+	.p2align 4
+	.globl	direct_ptr_write
+	.type	direct_ptr_write, @function
+direct_ptr_write:
+.LVL5:
+.LFB4888:
+	.loc 1 49 42 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 49 44 view .LVU25
+	.loc 1 49 47 is_stmt 0 view .LVU26
+	sall	(%rdi)
+	.loc 1 49 53 view .LVU27
+	ret
+	.cfi_endproc
+.LFE4888:
+	.size	direct_ptr_write, .-direct_ptr_write
+	.p2align 4
+	.globl	rust_ref_write
+	.type	rust_ref_write, @function
+rust_ref_write:
+.LVL6:
+.LFB4889:
+	.loc 1 51 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 52 3 view .LVU29
+.LBB110:
+.LBI110:
+	.loc 2 357 28 view .LVU30
+.LBB111:
+.LBB112:
+.LBI112:
+	.loc 1 52 12 view .LVU31
+.LBB113:
+	.loc 1 52 24 view .LVU32
+	.loc 1 52 26 is_stmt 0 view .LVU33
+	sall	(%rdi)
+.LVL7:
+	.loc 1 52 26 view .LVU34
+.LBE113:
+.LBE112:
+.LBE111:
+.LBE110:
+	.loc 1 53 1 view .LVU35
+	ret
+	.cfi_endproc
+.LFE4889:
+	.size	rust_ref_write, .-rust_ref_write
+	.p2align 4
+	.globl	rust_borrow_read
+	.type	rust_borrow_read, @function
+rust_borrow_read:
+.LVL8:
+.LFB4894:
+	.loc 1 58 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 59 3 view .LVU37
+.LBB114:
+.LBI114:
+	.loc 2 266 38 view .LVU38
+.LBB115:
+.LBI115:
+	.loc 2 454 13 view .LVU39
+.LBB116:
+.LBI116:
+	.loc 2 148 18 view .LVU40
+	.loc 2 148 18 is_stmt 0 view .LVU41
+.LBE116:
+.LBE115:
+.LBE114:
+	.loc 1 60 3 is_stmt 1 view .LVU42
+	.loc 1 61 3 view .LVU43
+.LBB117:
+.LBI117:
+	.loc 2 498 28 view .LVU44
+.LBB118:
+.LBI118:
+	.loc 1 61 19 view .LVU45
+.LBB119:
+	.loc 1 61 37 view .LVU46
+	.loc 1 61 46 is_stmt 0 view .LVU47
+	movl	(%rdi), %eax
+	.loc 1 61 52 view .LVU48
+	leal	1(%rax,%rax,2), %eax
+.LBE119:
+.LBE118:
+.LBE117:
+	.loc 1 62 1 view .LVU49
+	ret
+	.cfi_endproc
+.LFE4894:
+	.size	rust_borrow_read, .-rust_borrow_read
+.Letext0:
+	.file 3 "/usr/include/c++/12/type_traits"
+	.file 4 "/usr/include/x86_64-linux-gnu/c++/12/bits/c++config.h"
+	.file 5 "/usr/include/c++/12/concepts"
+	.file 6 "/usr/include/c++/12/bits/iterator_concepts.h"
+	.file 7 "/usr/include/c++/12/bits/ranges_cmp.h"
+	.file 8 "/usr/include/c++/12/ranges"
+	.file 9 "/usr/include/c++/12/compare"
+	.file 10 "/usr/include/c++/12/bits/atomic_wait.h"
+	.file 11 "/usr/include/c++/12/debug/debug.h"
+	.file 12 "/usr/include/c++/12/cstdlib"
+	.file 13 "/usr/include/c++/12/numbers"
+	.file 14 "/usr/include/c++/12/cwchar"
+	.file 15 "/usr/include/c++/12/bits/exception_ptr.h"
+	.file 16 "/usr/include/c++/12/cstdint"
+	.file 17 "/usr/include/c++/12/clocale"
+	.file 18 "/usr/include/c++/12/cstdio"
+	.file 19 "/usr/include/c++/12/cstddef"
+	.file 20 "/usr/include/c++/12/cwctype"
+	.file 21 "/usr/include/c++/12/bits/shared_ptr_base.h"
+	.file 22 "/usr/include/c++/12/bits/predefined_ops.h"
+	.file 23 "/usr/include/c++/12/bits/ptr_traits.h"
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 25 "/usr/include/stdlib.h"
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.file 30 "/usr/include/c++/12/pstl/execution_defs.h"
+	.file 31 "/usr/include/c++/12/bits/ranges_util.h"
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 33 "/usr/include/stdint.h"
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.file 35 "<built-in>"
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/wint_t.h"
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 42 "/usr/include/wchar.h"
+	.file 43 "/usr/include/locale.h"
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.file 45 "/usr/include/stdio.h"
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/wctype-wchar.h"
+	.file 48 "/usr/include/wctype.h"
+	.file 49 "/usr/include/c++/12/bits/algorithmfwd.h"
+	.file 50 "/usr/include/c++/12/ext/concurrence.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x3270
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x56
+	.long	.LASF475
+	.byte	0x21
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x57
+	.string	"std"
+	.byte	0x4
+	.value	0x128
+	.byte	0xb
+	.long	0x9b5
+	.uleb128 0x1b
+	.long	.LASF6
+	.byte	0x1
+	.byte	0x3
+	.byte	0x3e
+	.byte	0xc
+	.long	0xa4
+	.uleb128 0x5
+	.long	.LASF8
+	.byte	0x3
+	.byte	0x41
+	.byte	0x2d
+	.long	0x9bc
+	.uleb128 0x1f
+	.long	.LASF2
+	.byte	0x3
+	.byte	0x43
+	.byte	0x11
+	.long	.LASF4
+	.long	0x48
+	.long	0x6c
+	.long	0x72
+	.uleb128 0x3
+	.long	0xadf
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF3
+	.byte	0x3
+	.byte	0x48
+	.byte	0x1c
+	.long	.LASF5
+	.long	0x48
+	.long	0x8a
+	.long	0x90
+	.uleb128 0x3
+	.long	0xadf
+	.byte	0
+	.uleb128 0xa
+	.string	"_Tp"
+	.long	0x9bc
+	.uleb128 0x43
+	.string	"__v"
+	.long	0x9bc
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x3b
+	.uleb128 0x1b
+	.long	.LASF7
+	.byte	0x1
+	.byte	0x3
+	.byte	0x3e
+	.byte	0xc
+	.long	0x112
+	.uleb128 0x5
+	.long	.LASF8
+	.byte	0x3
+	.byte	0x41
+	.byte	0x2d
+	.long	0x9bc
+	.uleb128 0x1f
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x43
+	.byte	0x11
+	.long	.LASF10
+	.long	0xb6
+	.long	0xda
+	.long	0xe0
+	.uleb128 0x3
+	.long	0xae4
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF3
+	.byte	0x3
+	.byte	0x48
+	.byte	0x1c
+	.long	.LASF11
+	.long	0xb6
+	.long	0xf8
+	.long	0xfe
+	.uleb128 0x3
+	.long	0xae4
+	.byte	0
+	.uleb128 0xa
+	.string	"_Tp"
+	.long	0x9bc
+	.uleb128 0x43
+	.string	"__v"
+	.long	0x9bc
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x55
+	.byte	0x9
+	.long	0x3b
+	.uleb128 0x31
+	.long	.LASF13
+	.byte	0x4
+	.value	0x12a
+	.byte	0x1a
+	.long	0xa94
+	.uleb128 0x8
+	.long	0x123
+	.uleb128 0x20
+	.long	.LASF14
+	.byte	0x3
+	.value	0xa9f
+	.byte	0xd
+	.uleb128 0x20
+	.long	.LASF15
+	.byte	0x3
+	.value	0xaf5
+	.byte	0xd
+	.uleb128 0x21
+	.long	.LASF16
+	.byte	0x5
+	.byte	0xa3
+	.byte	0xd
+	.long	0x198
+	.uleb128 0x1c
+	.long	.LASF17
+	.byte	0x5
+	.byte	0xa5
+	.byte	0xf
+	.uleb128 0x58
+	.long	.LASF28
+	.byte	0x5
+	.byte	0xe1
+	.byte	0x16
+	.uleb128 0x1c
+	.long	.LASF18
+	.byte	0x6
+	.byte	0x50
+	.byte	0xf
+	.uleb128 0x20
+	.long	.LASF19
+	.byte	0x6
+	.value	0x320
+	.byte	0xd
+	.uleb128 0x20
+	.long	.LASF20
+	.byte	0x6
+	.value	0x3a3
+	.byte	0x15
+	.uleb128 0x1c
+	.long	.LASF21
+	.byte	0x7
+	.byte	0x40
+	.byte	0xd
+	.uleb128 0x44
+	.long	.LASF147
+	.byte	0x1f
+	.byte	0xdb
+	.byte	0xd
+	.uleb128 0x20
+	.long	.LASF22
+	.byte	0x8
+	.value	0x33b
+	.byte	0x12
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF23
+	.byte	0x9
+	.byte	0x31
+	.byte	0xd
+	.uleb128 0x21
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x36
+	.byte	0xd
+	.long	0x1d1
+	.uleb128 0x32
+	.long	.LASF24
+	.byte	0x3d
+	.byte	0x1d
+	.long	0x130
+	.byte	0x4
+	.uleb128 0x32
+	.long	.LASF25
+	.byte	0x91
+	.byte	0x14
+	.long	0xab7
+	.byte	0xc
+	.uleb128 0x32
+	.long	.LASF26
+	.byte	0x92
+	.byte	0x14
+	.long	0xab7
+	.byte	0x10
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF27
+	.byte	0x9
+	.value	0x23b
+	.byte	0xd
+	.uleb128 0x45
+	.long	.LASF29
+	.byte	0x9
+	.value	0x497
+	.byte	0x14
+	.uleb128 0x1c
+	.long	.LASF30
+	.byte	0xb
+	.byte	0x32
+	.byte	0xd
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x7f
+	.byte	0xb
+	.long	0xb67
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x80
+	.byte	0xb
+	.long	0xb9a
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x86
+	.byte	0xb
+	.long	0xd57
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x89
+	.byte	0xb
+	.long	0xd74
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x8c
+	.byte	0xb
+	.long	0xd8f
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x8d
+	.byte	0xb
+	.long	0xda5
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x8e
+	.byte	0xb
+	.long	0xdbc
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x8f
+	.byte	0xb
+	.long	0xdd3
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x91
+	.byte	0xb
+	.long	0xdfd
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x94
+	.byte	0xb
+	.long	0xe19
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x96
+	.byte	0xb
+	.long	0xe30
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x99
+	.byte	0xb
+	.long	0xe4c
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x9a
+	.byte	0xb
+	.long	0xe68
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x9b
+	.byte	0xb
+	.long	0xe8e
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x9d
+	.byte	0xb
+	.long	0xeaf
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa0
+	.byte	0xb
+	.long	0xed0
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa3
+	.byte	0xb
+	.long	0xee3
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa5
+	.byte	0xb
+	.long	0xef0
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa6
+	.byte	0xb
+	.long	0xf02
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa7
+	.byte	0xb
+	.long	0xf22
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa8
+	.byte	0xb
+	.long	0xf42
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa9
+	.byte	0xb
+	.long	0xf62
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xab
+	.byte	0xb
+	.long	0xf79
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xac
+	.byte	0xb
+	.long	0xf9f
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xf0
+	.byte	0x16
+	.long	0xbcd
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xf5
+	.byte	0x16
+	.long	0xa15
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xf6
+	.byte	0x16
+	.long	0xfbb
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xf8
+	.byte	0x16
+	.long	0xfd7
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xf9
+	.byte	0x16
+	.long	0x102e
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xfa
+	.byte	0x16
+	.long	0xfee
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xfb
+	.byte	0x16
+	.long	0x100e
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xfc
+	.byte	0x16
+	.long	0x1049
+	.uleb128 0x1c
+	.long	.LASF31
+	.byte	0xd
+	.byte	0x30
+	.byte	0xb
+	.uleb128 0x5
+	.long	.LASF32
+	.byte	0x3
+	.byte	0x52
+	.byte	0x9
+	.long	0xa9
+	.uleb128 0x31
+	.long	.LASF33
+	.byte	0x4
+	.value	0x12e
+	.byte	0x1d
+	.long	0x12e5
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x40
+	.byte	0xb
+	.long	0x1422
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x8d
+	.byte	0xb
+	.long	0x13c0
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x8f
+	.byte	0xb
+	.long	0x15d2
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x90
+	.byte	0xb
+	.long	0x15e9
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x91
+	.byte	0xb
+	.long	0x1605
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x92
+	.byte	0xb
+	.long	0x1626
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x93
+	.byte	0xb
+	.long	0x1642
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x94
+	.byte	0xb
+	.long	0x165e
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x95
+	.byte	0xb
+	.long	0x167a
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x96
+	.byte	0xb
+	.long	0x1697
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x97
+	.byte	0xb
+	.long	0x16b8
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x98
+	.byte	0xb
+	.long	0x16cf
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x99
+	.byte	0xb
+	.long	0x16dc
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x9a
+	.byte	0xb
+	.long	0x1702
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x9b
+	.byte	0xb
+	.long	0x1728
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x9c
+	.byte	0xb
+	.long	0x1744
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x9d
+	.byte	0xb
+	.long	0x176f
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x9e
+	.byte	0xb
+	.long	0x178b
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xa0
+	.byte	0xb
+	.long	0x17a2
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xa2
+	.byte	0xb
+	.long	0x17c4
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xa3
+	.byte	0xb
+	.long	0x17e5
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xa4
+	.byte	0xb
+	.long	0x1801
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xa6
+	.byte	0xb
+	.long	0x1827
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xa9
+	.byte	0xb
+	.long	0x184c
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xac
+	.byte	0xb
+	.long	0x1872
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xae
+	.byte	0xb
+	.long	0x1897
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xb0
+	.byte	0xb
+	.long	0x18b3
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xb2
+	.byte	0xb
+	.long	0x18d3
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xb3
+	.byte	0xb
+	.long	0x18f4
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xb4
+	.byte	0xb
+	.long	0x190f
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xb5
+	.byte	0xb
+	.long	0x192a
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xb6
+	.byte	0xb
+	.long	0x1945
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xb7
+	.byte	0xb
+	.long	0x1960
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xb8
+	.byte	0xb
+	.long	0x197b
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xb9
+	.byte	0xb
+	.long	0x19a6
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xba
+	.byte	0xb
+	.long	0x19bc
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xbb
+	.byte	0xb
+	.long	0x19dc
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xbc
+	.byte	0xb
+	.long	0x19fc
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xbd
+	.byte	0xb
+	.long	0x1a1c
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xbe
+	.byte	0xb
+	.long	0x1a47
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xbf
+	.byte	0xb
+	.long	0x1a62
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xc1
+	.byte	0xb
+	.long	0x1a83
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xc3
+	.byte	0xb
+	.long	0x1a9f
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xc4
+	.byte	0xb
+	.long	0x1abf
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xc5
+	.byte	0xb
+	.long	0x1ae0
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xc6
+	.byte	0xb
+	.long	0x1b01
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xc7
+	.byte	0xb
+	.long	0x1b21
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xc8
+	.byte	0xb
+	.long	0x1b38
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xc9
+	.byte	0xb
+	.long	0x1b59
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xca
+	.byte	0xb
+	.long	0x1b7a
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xcb
+	.byte	0xb
+	.long	0x1b9b
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xcc
+	.byte	0xb
+	.long	0x1bbc
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xcd
+	.byte	0xb
+	.long	0x1bd4
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xce
+	.byte	0xb
+	.long	0x1bf0
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xce
+	.byte	0xb
+	.long	0x1c0e
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xcf
+	.byte	0xb
+	.long	0x1c2c
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xcf
+	.byte	0xb
+	.long	0x1c4a
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xd0
+	.byte	0xb
+	.long	0x1c68
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xd0
+	.byte	0xb
+	.long	0x1c86
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xd1
+	.byte	0xb
+	.long	0x1ca4
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xd1
+	.byte	0xb
+	.long	0x1cc2
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xd2
+	.byte	0xb
+	.long	0x1ce0
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xd2
+	.byte	0xb
+	.long	0x1d03
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x10b
+	.byte	0x16
+	.long	0x1d26
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x10c
+	.byte	0x16
+	.long	0x1d42
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x10d
+	.byte	0x16
+	.long	0x1d63
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x11b
+	.byte	0xe
+	.long	0x1a83
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x11e
+	.byte	0xe
+	.long	0x1827
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x121
+	.byte	0xe
+	.long	0x1872
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x124
+	.byte	0xe
+	.long	0x18b3
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x128
+	.byte	0xe
+	.long	0x1d26
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x129
+	.byte	0xe
+	.long	0x1d42
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x12a
+	.byte	0xe
+	.long	0x1d63
+	.uleb128 0x21
+	.long	.LASF34
+	.byte	0xf
+	.byte	0x3f
+	.byte	0xd
+	.long	0x735
+	.uleb128 0x22
+	.long	.LASF35
+	.byte	0x8
+	.byte	0xf
+	.byte	0x5a
+	.byte	0xb
+	.long	0x727
+	.uleb128 0x4
+	.long	.LASF85
+	.byte	0xf
+	.byte	0x5c
+	.byte	0xd
+	.long	0xce4
+	.byte	0
+	.uleb128 0x59
+	.long	.LASF35
+	.byte	0xf
+	.byte	0x5e
+	.byte	0x10
+	.long	.LASF36
+	.long	0x598
+	.long	0x5a3
+	.uleb128 0x3
+	.long	0x1dbe
+	.uleb128 0x1
+	.long	0xce4
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF37
+	.byte	0xf
+	.byte	0x60
+	.byte	0xc
+	.long	.LASF39
+	.long	0x5b7
+	.long	0x5bd
+	.uleb128 0x3
+	.long	0x1dbe
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF38
+	.byte	0xf
+	.byte	0x61
+	.byte	0xc
+	.long	.LASF40
+	.long	0x5d1
+	.long	0x5d7
+	.uleb128 0x3
+	.long	0x1dbe
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF41
+	.byte	0xf
+	.byte	0x63
+	.byte	0xd
+	.long	.LASF42
+	.long	0xce4
+	.long	0x5ef
+	.long	0x5f5
+	.uleb128 0x3
+	.long	0x1dc3
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF35
+	.byte	0xf
+	.byte	0x6b
+	.byte	0x7
+	.long	.LASF43
+	.long	0x609
+	.long	0x60f
+	.uleb128 0x3
+	.long	0x1dbe
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF35
+	.byte	0xf
+	.byte	0x6d
+	.byte	0x7
+	.long	.LASF44
+	.long	0x623
+	.long	0x62e
+	.uleb128 0x3
+	.long	0x1dbe
+	.uleb128 0x1
+	.long	0x1dc8
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF35
+	.byte	0xf
+	.byte	0x70
+	.byte	0x7
+	.long	.LASF45
+	.long	0x642
+	.long	0x64d
+	.uleb128 0x3
+	.long	0x1dbe
+	.uleb128 0x1
+	.long	0x2ff
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF35
+	.byte	0xf
+	.byte	0x74
+	.byte	0x7
+	.long	.LASF46
+	.long	0x661
+	.long	0x66c
+	.uleb128 0x3
+	.long	0x1dbe
+	.uleb128 0x1
+	.long	0x1dcd
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF47
+	.byte	0x81
+	.long	.LASF48
+	.long	0x1dd2
+	.long	0x682
+	.long	0x68d
+	.uleb128 0x3
+	.long	0x1dbe
+	.uleb128 0x1
+	.long	0x1dc8
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF47
+	.byte	0x85
+	.long	.LASF49
+	.long	0x1dd2
+	.long	0x6a3
+	.long	0x6ae
+	.uleb128 0x3
+	.long	0x1dbe
+	.uleb128 0x1
+	.long	0x1dcd
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF50
+	.byte	0xf
+	.byte	0x8c
+	.byte	0x7
+	.long	.LASF51
+	.long	0x6c2
+	.long	0x6cd
+	.uleb128 0x3
+	.long	0x1dbe
+	.uleb128 0x3
+	.long	0xab0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF52
+	.byte	0xf
+	.byte	0x8f
+	.byte	0x7
+	.long	.LASF53
+	.long	0x6e1
+	.long	0x6ec
+	.uleb128 0x3
+	.long	0x1dbe
+	.uleb128 0x1
+	.long	0x1dd2
+	.byte	0
+	.uleb128 0x5a
+	.long	.LASF476
+	.byte	0xf
+	.byte	0x9b
+	.byte	0x10
+	.long	.LASF477
+	.long	0x9bc
+	.byte	0x1
+	.long	0x705
+	.long	0x70b
+	.uleb128 0x3
+	.long	0x1dc3
+	.byte	0
+	.uleb128 0x5b
+	.long	.LASF54
+	.byte	0xf
+	.byte	0xb0
+	.byte	0x7
+	.long	.LASF55
+	.long	0x1dd7
+	.byte	0x1
+	.long	0x720
+	.uleb128 0x3
+	.long	0x1dc3
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x56a
+	.uleb128 0x2
+	.byte	0xf
+	.byte	0x54
+	.byte	0x10
+	.long	0x73d
+	.byte	0
+	.uleb128 0x2
+	.byte	0xf
+	.byte	0x44
+	.byte	0x1a
+	.long	0x56a
+	.uleb128 0x5c
+	.long	.LASF56
+	.byte	0xf
+	.byte	0x50
+	.byte	0x8
+	.long	.LASF57
+	.long	0x753
+	.uleb128 0x1
+	.long	0x56a
+	.byte	0
+	.uleb128 0x5d
+	.long	.LASF478
+	.uleb128 0x8
+	.long	0x753
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x2f
+	.byte	0xb
+	.long	0xceb
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x30
+	.byte	0xb
+	.long	0xcf7
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x31
+	.byte	0xb
+	.long	0xd03
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x32
+	.byte	0xb
+	.long	0xd0f
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x34
+	.byte	0xb
+	.long	0x1255
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x35
+	.byte	0xb
+	.long	0x1261
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x36
+	.byte	0xb
+	.long	0x126d
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x37
+	.byte	0xb
+	.long	0x1279
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x39
+	.byte	0xb
+	.long	0x11f5
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x3a
+	.byte	0xb
+	.long	0x1201
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x3b
+	.byte	0xb
+	.long	0x120d
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x3c
+	.byte	0xb
+	.long	0x1219
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x3e
+	.byte	0xb
+	.long	0x12cd
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x3f
+	.byte	0xb
+	.long	0x12b5
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x41
+	.byte	0xb
+	.long	0x11c5
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x42
+	.byte	0xb
+	.long	0x11d1
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x43
+	.byte	0xb
+	.long	0x11dd
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x44
+	.byte	0xb
+	.long	0x11e9
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x46
+	.byte	0xb
+	.long	0x1285
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x47
+	.byte	0xb
+	.long	0x1291
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x48
+	.byte	0xb
+	.long	0x129d
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x49
+	.byte	0xb
+	.long	0x12a9
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4b
+	.byte	0xb
+	.long	0x1225
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4c
+	.byte	0xb
+	.long	0x1231
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4d
+	.byte	0xb
+	.long	0x123d
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4e
+	.byte	0xb
+	.long	0x1249
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x50
+	.byte	0xb
+	.long	0x12d9
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x51
+	.byte	0xb
+	.long	0x12c1
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x35
+	.byte	0xb
+	.long	0x1ddc
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x36
+	.byte	0xb
+	.long	0x1f22
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x37
+	.byte	0xb
+	.long	0x1f3d
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x62
+	.byte	0xb
+	.long	0x15c6
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x63
+	.byte	0xb
+	.long	0x1fd2
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x65
+	.byte	0xb
+	.long	0x1fe8
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x66
+	.byte	0xb
+	.long	0x1ffa
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x67
+	.byte	0xb
+	.long	0x2010
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x68
+	.byte	0xb
+	.long	0x2027
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x69
+	.byte	0xb
+	.long	0x203e
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x6a
+	.byte	0xb
+	.long	0x2054
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x6b
+	.byte	0xb
+	.long	0x206b
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x6c
+	.byte	0xb
+	.long	0x208c
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x6d
+	.byte	0xb
+	.long	0x20ad
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x71
+	.byte	0xb
+	.long	0x20c9
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x72
+	.byte	0xb
+	.long	0x20ef
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x74
+	.byte	0xb
+	.long	0x2110
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x75
+	.byte	0xb
+	.long	0x2131
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x76
+	.byte	0xb
+	.long	0x2152
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x78
+	.byte	0xb
+	.long	0x2169
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x79
+	.byte	0xb
+	.long	0x2180
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x7e
+	.byte	0xb
+	.long	0x218c
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x83
+	.byte	0xb
+	.long	0x219e
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x84
+	.byte	0xb
+	.long	0x21b4
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x85
+	.byte	0xb
+	.long	0x21cf
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x87
+	.byte	0xb
+	.long	0x21e1
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x88
+	.byte	0xb
+	.long	0x21f8
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x8b
+	.byte	0xb
+	.long	0x221e
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x8d
+	.byte	0xb
+	.long	0x222a
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x8f
+	.byte	0xb
+	.long	0x2240
+	.uleb128 0x45
+	.long	.LASF58
+	.byte	0x4
+	.value	0x14b
+	.byte	0x41
+	.uleb128 0x5e
+	.string	"_V2"
+	.byte	0x31
+	.value	0x25c
+	.byte	0x14
+	.uleb128 0x2
+	.byte	0x13
+	.byte	0x3a
+	.byte	0xb
+	.long	0x1db0
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x52
+	.byte	0xb
+	.long	0x2277
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x53
+	.byte	0xb
+	.long	0x226b
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x54
+	.byte	0xb
+	.long	0x13c0
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x5c
+	.byte	0xb
+	.long	0x2288
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x65
+	.byte	0xb
+	.long	0x22a3
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x68
+	.byte	0xb
+	.long	0x22be
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x69
+	.byte	0xb
+	.long	0x22d4
+	.uleb128 0x2
+	.byte	0x15
+	.byte	0x62
+	.byte	0x14
+	.long	0xa4e
+	.uleb128 0x2
+	.byte	0x15
+	.byte	0x63
+	.byte	0x14
+	.long	0x22ef
+	.uleb128 0x2
+	.byte	0x15
+	.byte	0x64
+	.byte	0x14
+	.long	0xa60
+	.uleb128 0x2
+	.byte	0x15
+	.byte	0x65
+	.byte	0x14
+	.long	0xa66
+	.uleb128 0x2
+	.byte	0x15
+	.byte	0x66
+	.byte	0x14
+	.long	0xa6c
+	.uleb128 0x5f
+	.long	.LASF147
+	.byte	0x8
+	.value	0x1105
+	.byte	0x22
+	.long	0x185
+	.byte	0
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF59
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF60
+	.uleb128 0x8
+	.long	0x9bc
+	.uleb128 0x60
+	.long	.LASF61
+	.byte	0x4
+	.value	0x14d
+	.byte	0xb
+	.long	0xa86
+	.uleb128 0x1c
+	.long	.LASF62
+	.byte	0x16
+	.byte	0x25
+	.byte	0xb
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xc8
+	.byte	0xb
+	.long	0xbcd
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xd8
+	.byte	0xb
+	.long	0xfbb
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xe3
+	.byte	0xb
+	.long	0xfd7
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xe4
+	.byte	0xb
+	.long	0xfee
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xe5
+	.byte	0xb
+	.long	0x100e
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xe7
+	.byte	0xb
+	.long	0x102e
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xe8
+	.byte	0xb
+	.long	0x1049
+	.uleb128 0x61
+	.string	"div"
+	.byte	0xc
+	.byte	0xd5
+	.byte	0x3
+	.long	.LASF479
+	.long	0xbcd
+	.long	0xa34
+	.uleb128 0x1
+	.long	0xac3
+	.uleb128 0x1
+	.long	0xac3
+	.byte	0
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0xfb
+	.byte	0xb
+	.long	0x1d26
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x104
+	.byte	0xb
+	.long	0x1d42
+	.uleb128 0xe
+	.byte	0xe
+	.value	0x105
+	.byte	0xb
+	.long	0x1d63
+	.uleb128 0x62
+	.long	.LASF480
+	.byte	0x7
+	.byte	0x4
+	.long	0x9b5
+	.byte	0x32
+	.byte	0x31
+	.byte	0x8
+	.long	0xa73
+	.uleb128 0x33
+	.long	.LASF63
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF64
+	.byte	0x1
+	.uleb128 0x33
+	.long	.LASF65
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	0xa4e
+	.uleb128 0x63
+	.long	.LASF464
+	.byte	0x32
+	.byte	0x35
+	.byte	0x1d
+	.long	0xa73
+	.byte	0x2
+	.byte	0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF66
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF67
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF68
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF69
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF70
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF71
+	.uleb128 0x64
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0xab0
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF72
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF73
+	.uleb128 0xc
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF74
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF75
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF76
+	.uleb128 0x7
+	.long	0xa4
+	.uleb128 0x7
+	.long	0x112
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x5
+	.long	.LASF77
+	.uleb128 0x8
+	.long	0xae9
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x7
+	.long	.LASF78
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x10
+	.long	.LASF79
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x10
+	.long	.LASF80
+	.uleb128 0xc
+	.byte	0x10
+	.byte	0x5
+	.long	.LASF81
+	.uleb128 0x21
+	.long	.LASF82
+	.byte	0x17
+	.byte	0x2b
+	.byte	0xb
+	.long	0xb26
+	.uleb128 0x65
+	.byte	0xb
+	.byte	0x3a
+	.byte	0x18
+	.long	0x1e3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF13
+	.byte	0x18
+	.byte	0xd6
+	.byte	0x17
+	.long	0xa94
+	.uleb128 0xc
+	.byte	0x20
+	.byte	0x3
+	.long	.LASF83
+	.uleb128 0xc
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF84
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x19
+	.byte	0x3c
+	.byte	0x3
+	.long	.LASF88
+	.long	0xb67
+	.uleb128 0x4
+	.long	.LASF86
+	.byte	0x19
+	.byte	0x3d
+	.byte	0x9
+	.long	0xab0
+	.byte	0
+	.uleb128 0x34
+	.string	"rem"
+	.byte	0x3e
+	.byte	0x9
+	.long	0xab0
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF87
+	.byte	0x19
+	.byte	0x3f
+	.byte	0x5
+	.long	0xb40
+	.uleb128 0x2a
+	.byte	0x10
+	.byte	0x19
+	.byte	0x44
+	.byte	0x3
+	.long	.LASF89
+	.long	0xb9a
+	.uleb128 0x4
+	.long	.LASF86
+	.byte	0x19
+	.byte	0x45
+	.byte	0xe
+	.long	0xabc
+	.byte	0
+	.uleb128 0x34
+	.string	"rem"
+	.byte	0x46
+	.byte	0xe
+	.long	0xabc
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF90
+	.byte	0x19
+	.byte	0x47
+	.byte	0x5
+	.long	0xb73
+	.uleb128 0x2a
+	.byte	0x10
+	.byte	0x19
+	.byte	0x4e
+	.byte	0x3
+	.long	.LASF91
+	.long	0xbcd
+	.uleb128 0x4
+	.long	.LASF86
+	.byte	0x19
+	.byte	0x4f
+	.byte	0x13
+	.long	0xac3
+	.byte	0
+	.uleb128 0x34
+	.string	"rem"
+	.byte	0x50
+	.byte	0x13
+	.long	0xac3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF92
+	.byte	0x19
+	.byte	0x51
+	.byte	0x5
+	.long	0xba6
+	.uleb128 0x7
+	.long	0xab7
+	.uleb128 0x7
+	.long	0xbea
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF93
+	.uleb128 0x8
+	.long	0xbe3
+	.uleb128 0x5
+	.long	.LASF94
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x15
+	.long	0xaa2
+	.uleb128 0x5
+	.long	.LASF95
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x17
+	.long	0xa86
+	.uleb128 0x5
+	.long	.LASF96
+	.byte	0x1a
+	.byte	0x27
+	.byte	0x1a
+	.long	0xaa9
+	.uleb128 0x5
+	.long	.LASF97
+	.byte	0x1a
+	.byte	0x28
+	.byte	0x1c
+	.long	0xa8d
+	.uleb128 0x5
+	.long	.LASF98
+	.byte	0x1a
+	.byte	0x29
+	.byte	0x14
+	.long	0xab0
+	.uleb128 0x8
+	.long	0xc1f
+	.uleb128 0x5
+	.long	.LASF99
+	.byte	0x1a
+	.byte	0x2a
+	.byte	0x16
+	.long	0x9b5
+	.uleb128 0x5
+	.long	.LASF100
+	.byte	0x1a
+	.byte	0x2c
+	.byte	0x19
+	.long	0xabc
+	.uleb128 0x5
+	.long	.LASF101
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0x1b
+	.long	0xa94
+	.uleb128 0x5
+	.long	.LASF102
+	.byte	0x1a
+	.byte	0x34
+	.byte	0x12
+	.long	0xbef
+	.uleb128 0x5
+	.long	.LASF103
+	.byte	0x1a
+	.byte	0x35
+	.byte	0x13
+	.long	0xbfb
+	.uleb128 0x5
+	.long	.LASF104
+	.byte	0x1a
+	.byte	0x36
+	.byte	0x13
+	.long	0xc07
+	.uleb128 0x5
+	.long	.LASF105
+	.byte	0x1a
+	.byte	0x37
+	.byte	0x14
+	.long	0xc13
+	.uleb128 0x5
+	.long	.LASF106
+	.byte	0x1a
+	.byte	0x38
+	.byte	0x13
+	.long	0xc1f
+	.uleb128 0x5
+	.long	.LASF107
+	.byte	0x1a
+	.byte	0x39
+	.byte	0x14
+	.long	0xc30
+	.uleb128 0x5
+	.long	.LASF108
+	.byte	0x1a
+	.byte	0x3a
+	.byte	0x13
+	.long	0xc3c
+	.uleb128 0x5
+	.long	.LASF109
+	.byte	0x1a
+	.byte	0x3b
+	.byte	0x14
+	.long	0xc48
+	.uleb128 0x5
+	.long	.LASF110
+	.byte	0x1a
+	.byte	0x48
+	.byte	0x12
+	.long	0xabc
+	.uleb128 0x5
+	.long	.LASF111
+	.byte	0x1a
+	.byte	0x49
+	.byte	0x1b
+	.long	0xa94
+	.uleb128 0x5
+	.long	.LASF112
+	.byte	0x1a
+	.byte	0x98
+	.byte	0x19
+	.long	0xabc
+	.uleb128 0x5
+	.long	.LASF113
+	.byte	0x1a
+	.byte	0x99
+	.byte	0x1b
+	.long	0xabc
+	.uleb128 0x66
+	.byte	0x8
+	.uleb128 0x7
+	.long	0xbe3
+	.uleb128 0x5
+	.long	.LASF114
+	.byte	0x1b
+	.byte	0x18
+	.byte	0x12
+	.long	0xbef
+	.uleb128 0x5
+	.long	.LASF115
+	.byte	0x1b
+	.byte	0x19
+	.byte	0x13
+	.long	0xc07
+	.uleb128 0x5
+	.long	.LASF116
+	.byte	0x1b
+	.byte	0x1a
+	.byte	0x13
+	.long	0xc1f
+	.uleb128 0x5
+	.long	.LASF117
+	.byte	0x1b
+	.byte	0x1b
+	.byte	0x13
+	.long	0xc3c
+	.uleb128 0x35
+	.long	0xbe3
+	.long	0xd2b
+	.uleb128 0x36
+	.long	0xa94
+	.byte	0x3
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF118
+	.byte	0x19
+	.value	0x33d
+	.byte	0xf
+	.long	0xd38
+	.uleb128 0x7
+	.long	0xd3d
+	.uleb128 0x67
+	.long	0xab0
+	.long	0xd51
+	.uleb128 0x1
+	.long	0xd51
+	.uleb128 0x1
+	.long	0xd51
+	.byte	0
+	.uleb128 0x7
+	.long	0xd56
+	.uleb128 0x68
+	.uleb128 0x6
+	.long	.LASF120
+	.byte	0x19
+	.value	0x267
+	.byte	0xc
+	.long	0xab0
+	.long	0xd6e
+	.uleb128 0x1
+	.long	0xd6e
+	.byte	0
+	.uleb128 0x7
+	.long	0xd73
+	.uleb128 0x69
+	.uleb128 0x1d
+	.long	.LASF119
+	.byte	0x19
+	.value	0x26c
+	.byte	0x12
+	.long	.LASF119
+	.long	0xab0
+	.long	0xd8f
+	.uleb128 0x1
+	.long	0xd6e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF121
+	.byte	0x1c
+	.byte	0x19
+	.byte	0x1
+	.long	0xad1
+	.long	0xda5
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF122
+	.byte	0x19
+	.value	0x16a
+	.byte	0x1
+	.long	0xab0
+	.long	0xdbc
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF123
+	.byte	0x19
+	.value	0x16f
+	.byte	0x1
+	.long	0xabc
+	.long	0xdd3
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF124
+	.byte	0x1d
+	.byte	0x14
+	.byte	0x1
+	.long	0xce4
+	.long	0xdfd
+	.uleb128 0x1
+	.long	0xd51
+	.uleb128 0x1
+	.long	0xd51
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0xd2b
+	.byte	0
+	.uleb128 0x6a
+	.string	"div"
+	.byte	0x19
+	.value	0x369
+	.byte	0xe
+	.long	0xb67
+	.long	0xe19
+	.uleb128 0x1
+	.long	0xab0
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF125
+	.byte	0x19
+	.value	0x28e
+	.byte	0xe
+	.long	0xce6
+	.long	0xe30
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF126
+	.byte	0x19
+	.value	0x36b
+	.byte	0xf
+	.long	0xb9a
+	.long	0xe4c
+	.uleb128 0x1
+	.long	0xabc
+	.uleb128 0x1
+	.long	0xabc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF127
+	.byte	0x19
+	.value	0x3af
+	.byte	0xc
+	.long	0xab0
+	.long	0xe68
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF128
+	.byte	0x19
+	.value	0x3ba
+	.byte	0xf
+	.long	0xb26
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x7
+	.long	0xae9
+	.uleb128 0x6
+	.long	.LASF129
+	.byte	0x19
+	.value	0x3b2
+	.byte	0xc
+	.long	0xab0
+	.long	0xeaf
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF131
+	.byte	0x19
+	.value	0x353
+	.long	0xed0
+	.uleb128 0x1
+	.long	0xce4
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0xd2b
+	.byte	0
+	.uleb128 0x6b
+	.long	.LASF130
+	.byte	0x19
+	.value	0x283
+	.byte	0xd
+	.long	0xee3
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF259
+	.byte	0x19
+	.value	0x1c6
+	.byte	0xc
+	.long	0xab0
+	.uleb128 0x23
+	.long	.LASF132
+	.byte	0x19
+	.value	0x1c8
+	.long	0xf02
+	.uleb128 0x1
+	.long	0x9b5
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF133
+	.byte	0x19
+	.byte	0x76
+	.byte	0xf
+	.long	0xad1
+	.long	0xf1d
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xf1d
+	.byte	0
+	.uleb128 0x7
+	.long	0xce6
+	.uleb128 0x9
+	.long	.LASF134
+	.byte	0x19
+	.byte	0xb1
+	.byte	0x11
+	.long	0xabc
+	.long	0xf42
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xf1d
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF135
+	.byte	0x19
+	.byte	0xb5
+	.byte	0x1a
+	.long	0xa94
+	.long	0xf62
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xf1d
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF136
+	.byte	0x19
+	.value	0x324
+	.byte	0xc
+	.long	0xab0
+	.long	0xf79
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF137
+	.byte	0x19
+	.value	0x3be
+	.byte	0xf
+	.long	0xb26
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xce6
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x7
+	.long	0xaf0
+	.uleb128 0x6
+	.long	.LASF138
+	.byte	0x19
+	.value	0x3b6
+	.byte	0xc
+	.long	0xab0
+	.long	0xfbb
+	.uleb128 0x1
+	.long	0xce6
+	.uleb128 0x1
+	.long	0xae9
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF139
+	.byte	0x19
+	.value	0x36f
+	.byte	0x1e
+	.long	0xbcd
+	.long	0xfd7
+	.uleb128 0x1
+	.long	0xac3
+	.uleb128 0x1
+	.long	0xac3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF140
+	.byte	0x19
+	.value	0x176
+	.byte	0x1
+	.long	0xac3
+	.long	0xfee
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF141
+	.byte	0x19
+	.byte	0xc9
+	.byte	0x16
+	.long	0xac3
+	.long	0x100e
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xf1d
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF142
+	.byte	0x19
+	.byte	0xce
+	.byte	0x1f
+	.long	0xa9b
+	.long	0x102e
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xf1d
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF143
+	.byte	0x19
+	.byte	0x7c
+	.byte	0xe
+	.long	0xad8
+	.long	0x1049
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xf1d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF144
+	.byte	0x19
+	.byte	0x7f
+	.byte	0x14
+	.long	0xaca
+	.long	0x1064
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xf1d
+	.byte	0
+	.uleb128 0xc
+	.byte	0x10
+	.byte	0x7
+	.long	.LASF145
+	.uleb128 0x21
+	.long	.LASF146
+	.byte	0x1e
+	.byte	0xf
+	.byte	0xb
+	.long	0x11b1
+	.uleb128 0x44
+	.long	.LASF148
+	.byte	0x1e
+	.byte	0x11
+	.byte	0xb
+	.uleb128 0x6c
+	.string	"v1"
+	.byte	0x1e
+	.byte	0x13
+	.byte	0x12
+	.uleb128 0x22
+	.long	.LASF149
+	.byte	0x1
+	.byte	0x1e
+	.byte	0x17
+	.byte	0x7
+	.long	0x10be
+	.uleb128 0x12
+	.long	.LASF150
+	.byte	0x1c
+	.long	.LASF152
+	.long	0x117
+	.uleb128 0x12
+	.long	.LASF151
+	.byte	0x21
+	.long	.LASF153
+	.long	0x117
+	.uleb128 0x12
+	.long	.LASF154
+	.byte	0x26
+	.long	.LASF155
+	.long	0x117
+	.byte	0
+	.uleb128 0x8
+	.long	0x1086
+	.uleb128 0x22
+	.long	.LASF156
+	.byte	0x1
+	.byte	0x1e
+	.byte	0x2d
+	.byte	0x7
+	.long	0x10fb
+	.uleb128 0x12
+	.long	.LASF150
+	.byte	0x32
+	.long	.LASF157
+	.long	0x117
+	.uleb128 0x12
+	.long	.LASF151
+	.byte	0x37
+	.long	.LASF158
+	.long	0x117
+	.uleb128 0x12
+	.long	.LASF154
+	.byte	0x3c
+	.long	.LASF159
+	.long	0x2f3
+	.byte	0
+	.uleb128 0x8
+	.long	0x10c3
+	.uleb128 0x22
+	.long	.LASF160
+	.byte	0x1
+	.byte	0x1e
+	.byte	0x43
+	.byte	0x7
+	.long	0x1138
+	.uleb128 0x12
+	.long	.LASF150
+	.byte	0x48
+	.long	.LASF161
+	.long	0x2f3
+	.uleb128 0x12
+	.long	.LASF151
+	.byte	0x4d
+	.long	.LASF162
+	.long	0x2f3
+	.uleb128 0x12
+	.long	.LASF154
+	.byte	0x52
+	.long	.LASF163
+	.long	0x2f3
+	.byte	0
+	.uleb128 0x8
+	.long	0x1100
+	.uleb128 0x22
+	.long	.LASF164
+	.byte	0x1
+	.byte	0x1e
+	.byte	0x58
+	.byte	0x7
+	.long	0x1175
+	.uleb128 0x12
+	.long	.LASF150
+	.byte	0x5d
+	.long	.LASF165
+	.long	0x2f3
+	.uleb128 0x12
+	.long	.LASF151
+	.byte	0x62
+	.long	.LASF166
+	.long	0x2f3
+	.uleb128 0x12
+	.long	.LASF154
+	.byte	0x67
+	.long	.LASF167
+	.long	0x117
+	.byte	0
+	.uleb128 0x8
+	.long	0x113d
+	.uleb128 0x48
+	.string	"seq"
+	.byte	0x6e
+	.byte	0x1c
+	.long	0x10be
+	.byte	0x1
+	.byte	0
+	.uleb128 0x48
+	.string	"par"
+	.byte	0x6f
+	.byte	0x1b
+	.long	0x10fb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF168
+	.byte	0x70
+	.byte	0x27
+	.long	0x1138
+	.byte	0x1
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF169
+	.byte	0x71
+	.byte	0x1e
+	.long	0x1175
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x117a
+	.uleb128 0x19
+	.long	0x1187
+	.uleb128 0x19
+	.long	0x1194
+	.uleb128 0x19
+	.long	0x11a1
+	.uleb128 0x5
+	.long	.LASF170
+	.byte	0x20
+	.byte	0x18
+	.byte	0x13
+	.long	0xbfb
+	.uleb128 0x5
+	.long	.LASF171
+	.byte	0x20
+	.byte	0x19
+	.byte	0x14
+	.long	0xc13
+	.uleb128 0x5
+	.long	.LASF172
+	.byte	0x20
+	.byte	0x1a
+	.byte	0x14
+	.long	0xc30
+	.uleb128 0x5
+	.long	.LASF173
+	.byte	0x20
+	.byte	0x1b
+	.byte	0x14
+	.long	0xc48
+	.uleb128 0x5
+	.long	.LASF174
+	.byte	0x21
+	.byte	0x2b
+	.byte	0x18
+	.long	0xc54
+	.uleb128 0x5
+	.long	.LASF175
+	.byte	0x21
+	.byte	0x2c
+	.byte	0x19
+	.long	0xc6c
+	.uleb128 0x5
+	.long	.LASF176
+	.byte	0x21
+	.byte	0x2d
+	.byte	0x19
+	.long	0xc84
+	.uleb128 0x5
+	.long	.LASF177
+	.byte	0x21
+	.byte	0x2e
+	.byte	0x19
+	.long	0xc9c
+	.uleb128 0x5
+	.long	.LASF178
+	.byte	0x21
+	.byte	0x31
+	.byte	0x19
+	.long	0xc60
+	.uleb128 0x5
+	.long	.LASF179
+	.byte	0x21
+	.byte	0x32
+	.byte	0x1a
+	.long	0xc78
+	.uleb128 0x5
+	.long	.LASF180
+	.byte	0x21
+	.byte	0x33
+	.byte	0x1a
+	.long	0xc90
+	.uleb128 0x5
+	.long	.LASF181
+	.byte	0x21
+	.byte	0x34
+	.byte	0x1a
+	.long	0xca8
+	.uleb128 0x5
+	.long	.LASF182
+	.byte	0x21
+	.byte	0x3a
+	.byte	0x16
+	.long	0xaa2
+	.uleb128 0x5
+	.long	.LASF183
+	.byte	0x21
+	.byte	0x3c
+	.byte	0x13
+	.long	0xabc
+	.uleb128 0x5
+	.long	.LASF184
+	.byte	0x21
+	.byte	0x3d
+	.byte	0x13
+	.long	0xabc
+	.uleb128 0x5
+	.long	.LASF185
+	.byte	0x21
+	.byte	0x3e
+	.byte	0x13
+	.long	0xabc
+	.uleb128 0x5
+	.long	.LASF186
+	.byte	0x21
+	.byte	0x47
+	.byte	0x18
+	.long	0xa86
+	.uleb128 0x5
+	.long	.LASF187
+	.byte	0x21
+	.byte	0x49
+	.byte	0x1b
+	.long	0xa94
+	.uleb128 0x5
+	.long	.LASF188
+	.byte	0x21
+	.byte	0x4a
+	.byte	0x1b
+	.long	0xa94
+	.uleb128 0x5
+	.long	.LASF189
+	.byte	0x21
+	.byte	0x4b
+	.byte	0x1b
+	.long	0xa94
+	.uleb128 0x5
+	.long	.LASF190
+	.byte	0x21
+	.byte	0x57
+	.byte	0x13
+	.long	0xabc
+	.uleb128 0x5
+	.long	.LASF191
+	.byte	0x21
+	.byte	0x5a
+	.byte	0x1b
+	.long	0xa94
+	.uleb128 0x5
+	.long	.LASF192
+	.byte	0x21
+	.byte	0x65
+	.byte	0x15
+	.long	0xcb4
+	.uleb128 0x5
+	.long	.LASF193
+	.byte	0x21
+	.byte	0x66
+	.byte	0x16
+	.long	0xcc0
+	.uleb128 0x4a
+	.long	.LASF457
+	.uleb128 0x6d
+	.string	"tm"
+	.byte	0x38
+	.byte	0x22
+	.byte	0x7
+	.byte	0x8
+	.long	0x1386
+	.uleb128 0x4
+	.long	.LASF194
+	.byte	0x22
+	.byte	0x9
+	.byte	0x7
+	.long	0xab0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF195
+	.byte	0x22
+	.byte	0xa
+	.byte	0x7
+	.long	0xab0
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF196
+	.byte	0x22
+	.byte	0xb
+	.byte	0x7
+	.long	0xab0
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF197
+	.byte	0x22
+	.byte	0xc
+	.byte	0x7
+	.long	0xab0
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF198
+	.byte	0x22
+	.byte	0xd
+	.byte	0x7
+	.long	0xab0
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF199
+	.byte	0x22
+	.byte	0xe
+	.byte	0x7
+	.long	0xab0
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF200
+	.byte	0x22
+	.byte	0xf
+	.byte	0x7
+	.long	0xab0
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF201
+	.byte	0x22
+	.byte	0x10
+	.byte	0x7
+	.long	0xab0
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF202
+	.byte	0x22
+	.byte	0x11
+	.byte	0x7
+	.long	0xab0
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF203
+	.byte	0x22
+	.byte	0x14
+	.byte	0xc
+	.long	0xabc
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF204
+	.byte	0x22
+	.byte	0x15
+	.byte	0xf
+	.long	0xbde
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.long	0x12ea
+	.uleb128 0x6e
+	.long	.LASF481
+	.byte	0x18
+	.byte	0x23
+	.byte	0
+	.long	0x13c0
+	.uleb128 0x2b
+	.long	.LASF205
+	.long	0x9b5
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF206
+	.long	0x9b5
+	.byte	0x4
+	.uleb128 0x2b
+	.long	.LASF207
+	.long	0xce4
+	.byte	0x8
+	.uleb128 0x2b
+	.long	.LASF208
+	.long	0xce4
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF209
+	.byte	0x24
+	.byte	0x14
+	.byte	0x17
+	.long	0x9b5
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x25
+	.byte	0xe
+	.byte	0x1
+	.long	.LASF210
+	.long	0x1416
+	.uleb128 0x6f
+	.byte	0x4
+	.byte	0x25
+	.byte	0x11
+	.byte	0x3
+	.long	0x13fb
+	.uleb128 0x37
+	.long	.LASF211
+	.byte	0x25
+	.byte	0x12
+	.byte	0x13
+	.long	0x9b5
+	.uleb128 0x37
+	.long	.LASF212
+	.byte	0x25
+	.byte	0x13
+	.byte	0xa
+	.long	0xd1b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF213
+	.byte	0x25
+	.byte	0xf
+	.byte	0x7
+	.long	0xab0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF214
+	.byte	0x25
+	.byte	0x14
+	.byte	0x5
+	.long	0x13d9
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF215
+	.byte	0x25
+	.byte	0x15
+	.byte	0x3
+	.long	0x13cc
+	.uleb128 0x5
+	.long	.LASF216
+	.byte	0x26
+	.byte	0x6
+	.byte	0x15
+	.long	0x1416
+	.uleb128 0x8
+	.long	0x1422
+	.uleb128 0x5
+	.long	.LASF217
+	.byte	0x27
+	.byte	0x5
+	.byte	0x19
+	.long	0x143f
+	.uleb128 0x1b
+	.long	.LASF218
+	.byte	0xd8
+	.byte	0x28
+	.byte	0x31
+	.byte	0x8
+	.long	0x15c6
+	.uleb128 0x4
+	.long	.LASF219
+	.byte	0x28
+	.byte	0x33
+	.byte	0x7
+	.long	0xab0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF220
+	.byte	0x28
+	.byte	0x36
+	.byte	0x9
+	.long	0xce6
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF221
+	.byte	0x28
+	.byte	0x37
+	.byte	0x9
+	.long	0xce6
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF222
+	.byte	0x28
+	.byte	0x38
+	.byte	0x9
+	.long	0xce6
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF223
+	.byte	0x28
+	.byte	0x39
+	.byte	0x9
+	.long	0xce6
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF224
+	.byte	0x28
+	.byte	0x3a
+	.byte	0x9
+	.long	0xce6
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF225
+	.byte	0x28
+	.byte	0x3b
+	.byte	0x9
+	.long	0xce6
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF226
+	.byte	0x28
+	.byte	0x3c
+	.byte	0x9
+	.long	0xce6
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF227
+	.byte	0x28
+	.byte	0x3d
+	.byte	0x9
+	.long	0xce6
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF228
+	.byte	0x28
+	.byte	0x40
+	.byte	0x9
+	.long	0xce6
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF229
+	.byte	0x28
+	.byte	0x41
+	.byte	0x9
+	.long	0xce6
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF230
+	.byte	0x28
+	.byte	0x42
+	.byte	0x9
+	.long	0xce6
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF231
+	.byte	0x28
+	.byte	0x44
+	.byte	0x16
+	.long	0x1f8f
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF232
+	.byte	0x28
+	.byte	0x46
+	.byte	0x14
+	.long	0x1f94
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF233
+	.byte	0x28
+	.byte	0x48
+	.byte	0x7
+	.long	0xab0
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF234
+	.byte	0x28
+	.byte	0x49
+	.byte	0x7
+	.long	0xab0
+	.byte	0x74
+	.uleb128 0x4
+	.long	.LASF235
+	.byte	0x28
+	.byte	0x4a
+	.byte	0xb
+	.long	0xccc
+	.byte	0x78
+	.uleb128 0x4
+	.long	.LASF236
+	.byte	0x28
+	.byte	0x4d
+	.byte	0x12
+	.long	0xa8d
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF237
+	.byte	0x28
+	.byte	0x4e
+	.byte	0xf
+	.long	0xaa2
+	.byte	0x82
+	.uleb128 0x4
+	.long	.LASF238
+	.byte	0x28
+	.byte	0x4f
+	.byte	0x8
+	.long	0x1f99
+	.byte	0x83
+	.uleb128 0x4
+	.long	.LASF239
+	.byte	0x28
+	.byte	0x51
+	.byte	0xf
+	.long	0x1fa9
+	.byte	0x88
+	.uleb128 0x4
+	.long	.LASF240
+	.byte	0x28
+	.byte	0x59
+	.byte	0xd
+	.long	0xcd8
+	.byte	0x90
+	.uleb128 0x4
+	.long	.LASF241
+	.byte	0x28
+	.byte	0x5b
+	.byte	0x17
+	.long	0x1fb3
+	.byte	0x98
+	.uleb128 0x4
+	.long	.LASF242
+	.byte	0x28
+	.byte	0x5c
+	.byte	0x19
+	.long	0x1fbd
+	.byte	0xa0
+	.uleb128 0x4
+	.long	.LASF243
+	.byte	0x28
+	.byte	0x5d
+	.byte	0x14
+	.long	0x1f94
+	.byte	0xa8
+	.uleb128 0x4
+	.long	.LASF244
+	.byte	0x28
+	.byte	0x5e
+	.byte	0x9
+	.long	0xce4
+	.byte	0xb0
+	.uleb128 0x4
+	.long	.LASF245
+	.byte	0x28
+	.byte	0x5f
+	.byte	0xa
+	.long	0xb26
+	.byte	0xb8
+	.uleb128 0x4
+	.long	.LASF246
+	.byte	0x28
+	.byte	0x60
+	.byte	0x7
+	.long	0xab0
+	.byte	0xc0
+	.uleb128 0x4
+	.long	.LASF247
+	.byte	0x28
+	.byte	0x62
+	.byte	0x8
+	.long	0x1fc2
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF248
+	.byte	0x29
+	.byte	0x7
+	.byte	0x19
+	.long	0x143f
+	.uleb128 0x6
+	.long	.LASF249
+	.byte	0x2a
+	.value	0x13f
+	.byte	0x1
+	.long	0x13c0
+	.long	0x15e9
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF250
+	.byte	0x2a
+	.value	0x2e8
+	.byte	0xf
+	.long	0x13c0
+	.long	0x1600
+	.uleb128 0x1
+	.long	0x1600
+	.byte	0
+	.uleb128 0x7
+	.long	0x1433
+	.uleb128 0x6
+	.long	.LASF251
+	.byte	0x2a
+	.value	0x305
+	.byte	0x11
+	.long	0xe89
+	.long	0x1626
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xab0
+	.uleb128 0x1
+	.long	0x1600
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF252
+	.byte	0x2a
+	.value	0x2f6
+	.byte	0xf
+	.long	0x13c0
+	.long	0x1642
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0x1600
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF253
+	.byte	0x2a
+	.value	0x30c
+	.byte	0xc
+	.long	0xab0
+	.long	0x165e
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1600
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF254
+	.byte	0x2a
+	.value	0x24c
+	.byte	0xc
+	.long	0xab0
+	.long	0x167a
+	.uleb128 0x1
+	.long	0x1600
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF255
+	.byte	0x2a
+	.value	0x253
+	.byte	0xc
+	.long	0xab0
+	.long	0x1697
+	.uleb128 0x1
+	.long	0x1600
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF256
+	.byte	0x2a
+	.value	0x291
+	.byte	0xc
+	.long	.LASF257
+	.long	0xab0
+	.long	0x16b8
+	.uleb128 0x1
+	.long	0x1600
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF258
+	.byte	0x2a
+	.value	0x2e9
+	.byte	0xf
+	.long	0x13c0
+	.long	0x16cf
+	.uleb128 0x1
+	.long	0x1600
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF260
+	.byte	0x2a
+	.value	0x2ef
+	.byte	0xf
+	.long	0x13c0
+	.uleb128 0x6
+	.long	.LASF261
+	.byte	0x2a
+	.value	0x14a
+	.byte	0x1
+	.long	0xb26
+	.long	0x16fd
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0x16fd
+	.byte	0
+	.uleb128 0x7
+	.long	0x1422
+	.uleb128 0x6
+	.long	.LASF262
+	.byte	0x2a
+	.value	0x129
+	.byte	0xf
+	.long	0xb26
+	.long	0x1728
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0x16fd
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF263
+	.byte	0x2a
+	.value	0x125
+	.byte	0xc
+	.long	0xab0
+	.long	0x173f
+	.uleb128 0x1
+	.long	0x173f
+	.byte	0
+	.uleb128 0x7
+	.long	0x142e
+	.uleb128 0x6
+	.long	.LASF264
+	.byte	0x2a
+	.value	0x152
+	.byte	0xf
+	.long	0xb26
+	.long	0x176a
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0x176a
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0x16fd
+	.byte	0
+	.uleb128 0x7
+	.long	0xbde
+	.uleb128 0x6
+	.long	.LASF265
+	.byte	0x2a
+	.value	0x2f7
+	.byte	0xf
+	.long	0x13c0
+	.long	0x178b
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0x1600
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF266
+	.byte	0x2a
+	.value	0x2fd
+	.byte	0xf
+	.long	0x13c0
+	.long	0x17a2
+	.uleb128 0x1
+	.long	0xae9
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF267
+	.byte	0x2a
+	.value	0x25d
+	.byte	0xc
+	.long	0xab0
+	.long	0x17c4
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF268
+	.byte	0x2a
+	.value	0x298
+	.byte	0xc
+	.long	.LASF269
+	.long	0xab0
+	.long	0x17e5
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF270
+	.byte	0x2a
+	.value	0x314
+	.byte	0xf
+	.long	0x13c0
+	.long	0x1801
+	.uleb128 0x1
+	.long	0x13c0
+	.uleb128 0x1
+	.long	0x1600
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF271
+	.byte	0x2a
+	.value	0x265
+	.byte	0xc
+	.long	0xab0
+	.long	0x1822
+	.uleb128 0x1
+	.long	0x1600
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1822
+	.byte	0
+	.uleb128 0x7
+	.long	0x138b
+	.uleb128 0x1d
+	.long	.LASF272
+	.byte	0x2a
+	.value	0x2c7
+	.byte	0xc
+	.long	.LASF273
+	.long	0xab0
+	.long	0x184c
+	.uleb128 0x1
+	.long	0x1600
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1822
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF274
+	.byte	0x2a
+	.value	0x272
+	.byte	0xc
+	.long	0xab0
+	.long	0x1872
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1822
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF275
+	.byte	0x2a
+	.value	0x2ce
+	.byte	0xc
+	.long	.LASF276
+	.long	0xab0
+	.long	0x1897
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1822
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF277
+	.byte	0x2a
+	.value	0x26d
+	.byte	0xc
+	.long	0xab0
+	.long	0x18b3
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1822
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF278
+	.byte	0x2a
+	.value	0x2cb
+	.byte	0xc
+	.long	.LASF279
+	.long	0xab0
+	.long	0x18d3
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1822
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF280
+	.byte	0x2a
+	.value	0x12e
+	.byte	0xf
+	.long	0xb26
+	.long	0x18f4
+	.uleb128 0x1
+	.long	0xce6
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0x16fd
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF281
+	.byte	0x2a
+	.byte	0x61
+	.byte	0x11
+	.long	0xe89
+	.long	0x190f
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xf9a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF282
+	.byte	0x2a
+	.byte	0x6a
+	.byte	0xc
+	.long	0xab0
+	.long	0x192a
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xf9a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF283
+	.byte	0x2a
+	.byte	0x83
+	.byte	0xc
+	.long	0xab0
+	.long	0x1945
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xf9a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF284
+	.byte	0x2a
+	.byte	0x57
+	.byte	0x11
+	.long	0xe89
+	.long	0x1960
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xf9a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF285
+	.byte	0x2a
+	.byte	0xbc
+	.byte	0xf
+	.long	0xb26
+	.long	0x197b
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xf9a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF286
+	.byte	0x2a
+	.value	0x354
+	.byte	0xf
+	.long	0xb26
+	.long	0x19a1
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x19a1
+	.byte	0
+	.uleb128 0x7
+	.long	0x1386
+	.uleb128 0x9
+	.long	.LASF287
+	.byte	0x2a
+	.byte	0xdf
+	.byte	0xf
+	.long	0xb26
+	.long	0x19bc
+	.uleb128 0x1
+	.long	0xf9a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF288
+	.byte	0x2a
+	.byte	0x65
+	.byte	0x11
+	.long	0xe89
+	.long	0x19dc
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF289
+	.byte	0x2a
+	.byte	0x6d
+	.byte	0xc
+	.long	0xab0
+	.long	0x19fc
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF290
+	.byte	0x2a
+	.byte	0x5c
+	.byte	0x11
+	.long	0xe89
+	.long	0x1a1c
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF291
+	.byte	0x2a
+	.value	0x158
+	.byte	0xf
+	.long	0xb26
+	.long	0x1a42
+	.uleb128 0x1
+	.long	0xce6
+	.uleb128 0x1
+	.long	0x1a42
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0x16fd
+	.byte	0
+	.uleb128 0x7
+	.long	0xf9a
+	.uleb128 0x9
+	.long	.LASF292
+	.byte	0x2a
+	.byte	0xc0
+	.byte	0xf
+	.long	0xb26
+	.long	0x1a62
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xf9a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF293
+	.byte	0x2a
+	.value	0x17a
+	.byte	0xf
+	.long	0xad1
+	.long	0x1a7e
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1a7e
+	.byte	0
+	.uleb128 0x7
+	.long	0xe89
+	.uleb128 0x6
+	.long	.LASF294
+	.byte	0x2a
+	.value	0x17f
+	.byte	0xe
+	.long	0xad8
+	.long	0x1a9f
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1a7e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF295
+	.byte	0x2a
+	.byte	0xda
+	.byte	0x11
+	.long	0xe89
+	.long	0x1abf
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1a7e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF296
+	.byte	0x2a
+	.value	0x1ad
+	.byte	0x11
+	.long	0xabc
+	.long	0x1ae0
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1a7e
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF297
+	.byte	0x2a
+	.value	0x1b2
+	.byte	0x1a
+	.long	0xa94
+	.long	0x1b01
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1a7e
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF298
+	.byte	0x2a
+	.byte	0x87
+	.byte	0xf
+	.long	0xb26
+	.long	0x1b21
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF299
+	.byte	0x2a
+	.value	0x145
+	.byte	0x1
+	.long	0xab0
+	.long	0x1b38
+	.uleb128 0x1
+	.long	0x13c0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF300
+	.byte	0x2a
+	.value	0x103
+	.byte	0xc
+	.long	0xab0
+	.long	0x1b59
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF301
+	.byte	0x2a
+	.value	0x107
+	.byte	0x11
+	.long	0xe89
+	.long	0x1b7a
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF302
+	.byte	0x2a
+	.value	0x10c
+	.byte	0x11
+	.long	0xe89
+	.long	0x1b9b
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF303
+	.byte	0x2a
+	.value	0x110
+	.byte	0x11
+	.long	0xe89
+	.long	0x1bbc
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF304
+	.byte	0x2a
+	.value	0x25a
+	.byte	0xc
+	.long	0xab0
+	.long	0x1bd4
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF305
+	.byte	0x2a
+	.value	0x295
+	.byte	0xc
+	.long	.LASF306
+	.long	0xab0
+	.long	0x1bf0
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF307
+	.byte	0xa2
+	.byte	0x1d
+	.long	.LASF307
+	.long	0xf9a
+	.long	0x1c0e
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xae9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF307
+	.byte	0xa0
+	.byte	0x17
+	.long	.LASF307
+	.long	0xe89
+	.long	0x1c2c
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xae9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF308
+	.byte	0xc6
+	.byte	0x1d
+	.long	.LASF308
+	.long	0xf9a
+	.long	0x1c4a
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xf9a
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF308
+	.byte	0xc4
+	.byte	0x17
+	.long	.LASF308
+	.long	0xe89
+	.long	0x1c68
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xf9a
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF309
+	.byte	0xac
+	.byte	0x1d
+	.long	.LASF309
+	.long	0xf9a
+	.long	0x1c86
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xae9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF309
+	.byte	0xaa
+	.byte	0x17
+	.long	.LASF309
+	.long	0xe89
+	.long	0x1ca4
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xae9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF310
+	.byte	0xd1
+	.byte	0x1d
+	.long	.LASF310
+	.long	0xf9a
+	.long	0x1cc2
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xf9a
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF310
+	.byte	0xcf
+	.byte	0x17
+	.long	.LASF310
+	.long	0xe89
+	.long	0x1ce0
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xf9a
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF311
+	.byte	0xfa
+	.byte	0x1d
+	.long	.LASF311
+	.long	0xf9a
+	.long	0x1d03
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF311
+	.byte	0xf8
+	.byte	0x17
+	.long	.LASF311
+	.long	0xe89
+	.long	0x1d26
+	.uleb128 0x1
+	.long	0xe89
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF312
+	.byte	0x2a
+	.value	0x181
+	.byte	0x14
+	.long	0xaca
+	.long	0x1d42
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1a7e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF313
+	.byte	0x2a
+	.value	0x1ba
+	.byte	0x16
+	.long	0xac3
+	.long	0x1d63
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1a7e
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF314
+	.byte	0x2a
+	.value	0x1c1
+	.byte	0x1f
+	.long	0xa9b
+	.long	0x1d84
+	.uleb128 0x1
+	.long	0xf9a
+	.uleb128 0x1
+	.long	0x1a7e
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x70
+	.byte	0x20
+	.byte	0x10
+	.byte	0x18
+	.value	0x1a8
+	.byte	0x10
+	.long	.LASF482
+	.long	0x1db0
+	.uleb128 0x4b
+	.long	.LASF315
+	.value	0x1a9
+	.byte	0xd
+	.long	0xac3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF316
+	.value	0x1aa
+	.byte	0xf
+	.long	0xaca
+	.byte	0x10
+	.byte	0x10
+	.byte	0
+	.uleb128 0x71
+	.long	.LASF483
+	.byte	0x18
+	.value	0x1b3
+	.byte	0x3
+	.long	0x1d84
+	.byte	0x10
+	.uleb128 0x7
+	.long	0x56a
+	.uleb128 0x7
+	.long	0x727
+	.uleb128 0x17
+	.long	0x727
+	.uleb128 0x15
+	.long	0x56a
+	.uleb128 0x17
+	.long	0x56a
+	.uleb128 0x7
+	.long	0x758
+	.uleb128 0x1b
+	.long	.LASF317
+	.byte	0x60
+	.byte	0x2b
+	.byte	0x33
+	.byte	0x8
+	.long	0x1f22
+	.uleb128 0x4
+	.long	.LASF318
+	.byte	0x2b
+	.byte	0x37
+	.byte	0x9
+	.long	0xce6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF319
+	.byte	0x2b
+	.byte	0x38
+	.byte	0x9
+	.long	0xce6
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF320
+	.byte	0x2b
+	.byte	0x3e
+	.byte	0x9
+	.long	0xce6
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF321
+	.byte	0x2b
+	.byte	0x44
+	.byte	0x9
+	.long	0xce6
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF322
+	.byte	0x2b
+	.byte	0x45
+	.byte	0x9
+	.long	0xce6
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF323
+	.byte	0x2b
+	.byte	0x46
+	.byte	0x9
+	.long	0xce6
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF324
+	.byte	0x2b
+	.byte	0x47
+	.byte	0x9
+	.long	0xce6
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF325
+	.byte	0x2b
+	.byte	0x48
+	.byte	0x9
+	.long	0xce6
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF326
+	.byte	0x2b
+	.byte	0x49
+	.byte	0x9
+	.long	0xce6
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF327
+	.byte	0x2b
+	.byte	0x4a
+	.byte	0x9
+	.long	0xce6
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF328
+	.byte	0x2b
+	.byte	0x4b
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF329
+	.byte	0x2b
+	.byte	0x4c
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x51
+	.uleb128 0x4
+	.long	.LASF330
+	.byte	0x2b
+	.byte	0x4e
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x52
+	.uleb128 0x4
+	.long	.LASF331
+	.byte	0x2b
+	.byte	0x50
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x53
+	.uleb128 0x4
+	.long	.LASF332
+	.byte	0x2b
+	.byte	0x52
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x54
+	.uleb128 0x4
+	.long	.LASF333
+	.byte	0x2b
+	.byte	0x54
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x55
+	.uleb128 0x4
+	.long	.LASF334
+	.byte	0x2b
+	.byte	0x5b
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x56
+	.uleb128 0x4
+	.long	.LASF335
+	.byte	0x2b
+	.byte	0x5c
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x57
+	.uleb128 0x4
+	.long	.LASF336
+	.byte	0x2b
+	.byte	0x5f
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF337
+	.byte	0x2b
+	.byte	0x61
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x59
+	.uleb128 0x4
+	.long	.LASF338
+	.byte	0x2b
+	.byte	0x63
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x5a
+	.uleb128 0x4
+	.long	.LASF339
+	.byte	0x2b
+	.byte	0x65
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x5b
+	.uleb128 0x4
+	.long	.LASF340
+	.byte	0x2b
+	.byte	0x6c
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x5c
+	.uleb128 0x4
+	.long	.LASF341
+	.byte	0x2b
+	.byte	0x6d
+	.byte	0x8
+	.long	0xbe3
+	.byte	0x5d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF342
+	.byte	0x2b
+	.byte	0x7a
+	.byte	0xe
+	.long	0xce6
+	.long	0x1f3d
+	.uleb128 0x1
+	.long	0xab0
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF343
+	.byte	0x2b
+	.byte	0x7d
+	.byte	0x16
+	.long	0x1f49
+	.uleb128 0x7
+	.long	0x1ddc
+	.uleb128 0x1b
+	.long	.LASF344
+	.byte	0x10
+	.byte	0x2c
+	.byte	0xa
+	.byte	0x10
+	.long	0x1f76
+	.uleb128 0x4
+	.long	.LASF345
+	.byte	0x2c
+	.byte	0xc
+	.byte	0xb
+	.long	0xccc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF346
+	.byte	0x2c
+	.byte	0xd
+	.byte	0xf
+	.long	0x1416
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF347
+	.byte	0x2c
+	.byte	0xe
+	.byte	0x3
+	.long	0x1f4e
+	.uleb128 0x72
+	.long	.LASF484
+	.byte	0x28
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x39
+	.long	.LASF348
+	.uleb128 0x7
+	.long	0x1f8a
+	.uleb128 0x7
+	.long	0x143f
+	.uleb128 0x35
+	.long	0xbe3
+	.long	0x1fa9
+	.uleb128 0x36
+	.long	0xa94
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x1f82
+	.uleb128 0x39
+	.long	.LASF349
+	.uleb128 0x7
+	.long	0x1fae
+	.uleb128 0x39
+	.long	.LASF350
+	.uleb128 0x7
+	.long	0x1fb8
+	.uleb128 0x35
+	.long	0xbe3
+	.long	0x1fd2
+	.uleb128 0x36
+	.long	0xa94
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF351
+	.byte	0x2d
+	.byte	0x54
+	.byte	0x12
+	.long	0x1f76
+	.uleb128 0x8
+	.long	0x1fd2
+	.uleb128 0x7
+	.long	0x15c6
+	.uleb128 0x23
+	.long	.LASF352
+	.byte	0x2d
+	.value	0x312
+	.long	0x1ffa
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF353
+	.byte	0x2d
+	.byte	0xb2
+	.byte	0xc
+	.long	0xab0
+	.long	0x2010
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF354
+	.byte	0x2d
+	.value	0x314
+	.byte	0xc
+	.long	0xab0
+	.long	0x2027
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF355
+	.byte	0x2d
+	.value	0x316
+	.byte	0xc
+	.long	0xab0
+	.long	0x203e
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF356
+	.byte	0x2d
+	.byte	0xe6
+	.byte	0xc
+	.long	0xab0
+	.long	0x2054
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF357
+	.byte	0x2d
+	.value	0x201
+	.byte	0xc
+	.long	0xab0
+	.long	0x206b
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF358
+	.byte	0x2d
+	.value	0x2f8
+	.byte	0xc
+	.long	0xab0
+	.long	0x2087
+	.uleb128 0x1
+	.long	0x1fe3
+	.uleb128 0x1
+	.long	0x2087
+	.byte	0
+	.uleb128 0x7
+	.long	0x1fd2
+	.uleb128 0x6
+	.long	.LASF359
+	.byte	0x2d
+	.value	0x250
+	.byte	0xe
+	.long	0xce6
+	.long	0x20ad
+	.uleb128 0x1
+	.long	0xce6
+	.uleb128 0x1
+	.long	0xab0
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF360
+	.byte	0x2d
+	.value	0x102
+	.byte	0xe
+	.long	0x1fe3
+	.long	0x20c9
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF361
+	.byte	0x2d
+	.value	0x2a3
+	.byte	0xf
+	.long	0xb26
+	.long	0x20ef
+	.uleb128 0x1
+	.long	0xce4
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0xb26
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF362
+	.byte	0x2d
+	.value	0x109
+	.byte	0xe
+	.long	0x1fe3
+	.long	0x2110
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF363
+	.byte	0x2d
+	.value	0x2c9
+	.byte	0xc
+	.long	0xab0
+	.long	0x2131
+	.uleb128 0x1
+	.long	0x1fe3
+	.uleb128 0x1
+	.long	0xabc
+	.uleb128 0x1
+	.long	0xab0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF364
+	.byte	0x2d
+	.value	0x2fd
+	.byte	0xc
+	.long	0xab0
+	.long	0x214d
+	.uleb128 0x1
+	.long	0x1fe3
+	.uleb128 0x1
+	.long	0x214d
+	.byte	0
+	.uleb128 0x7
+	.long	0x1fde
+	.uleb128 0x6
+	.long	.LASF365
+	.byte	0x2d
+	.value	0x2ce
+	.byte	0x11
+	.long	0xabc
+	.long	0x2169
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF366
+	.byte	0x2d
+	.value	0x202
+	.byte	0xc
+	.long	0xab0
+	.long	0x2180
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF367
+	.byte	0x2e
+	.byte	0x2f
+	.byte	0x1
+	.long	0xab0
+	.uleb128 0x23
+	.long	.LASF368
+	.byte	0x2d
+	.value	0x324
+	.long	0x219e
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF369
+	.byte	0x2d
+	.byte	0x98
+	.byte	0xc
+	.long	0xab0
+	.long	0x21b4
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF370
+	.byte	0x2d
+	.byte	0x9a
+	.byte	0xc
+	.long	0xab0
+	.long	0x21cf
+	.uleb128 0x1
+	.long	0xbde
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF371
+	.byte	0x2d
+	.value	0x2d3
+	.long	0x21e1
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF372
+	.byte	0x2d
+	.value	0x148
+	.long	0x21f8
+	.uleb128 0x1
+	.long	0x1fe3
+	.uleb128 0x1
+	.long	0xce6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF373
+	.byte	0x2d
+	.value	0x14c
+	.byte	0xc
+	.long	0xab0
+	.long	0x221e
+	.uleb128 0x1
+	.long	0x1fe3
+	.uleb128 0x1
+	.long	0xce6
+	.uleb128 0x1
+	.long	0xab0
+	.uleb128 0x1
+	.long	0xb26
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF374
+	.byte	0x2d
+	.byte	0xbc
+	.byte	0xe
+	.long	0x1fe3
+	.uleb128 0x9
+	.long	.LASF375
+	.byte	0x2d
+	.byte	0xcd
+	.byte	0xe
+	.long	0xce6
+	.long	0x2240
+	.uleb128 0x1
+	.long	0xce6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF376
+	.byte	0x2d
+	.value	0x29c
+	.byte	0xc
+	.long	0xab0
+	.long	0x225c
+	.uleb128 0x1
+	.long	0xab0
+	.uleb128 0x1
+	.long	0x1fe3
+	.byte	0
+	.uleb128 0x19
+	.long	0x1ac
+	.uleb128 0x19
+	.long	0x1b8
+	.uleb128 0x19
+	.long	0x1c4
+	.uleb128 0x5
+	.long	.LASF377
+	.byte	0x2f
+	.byte	0x26
+	.byte	0x1b
+	.long	0xa94
+	.uleb128 0x5
+	.long	.LASF378
+	.byte	0x30
+	.byte	0x30
+	.byte	0x1a
+	.long	0x2283
+	.uleb128 0x7
+	.long	0xc2b
+	.uleb128 0x9
+	.long	.LASF379
+	.byte	0x2f
+	.byte	0x9f
+	.byte	0xc
+	.long	0xab0
+	.long	0x22a3
+	.uleb128 0x1
+	.long	0x13c0
+	.uleb128 0x1
+	.long	0x226b
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF380
+	.byte	0x30
+	.byte	0x37
+	.byte	0xf
+	.long	0x13c0
+	.long	0x22be
+	.uleb128 0x1
+	.long	0x13c0
+	.uleb128 0x1
+	.long	0x2277
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF381
+	.byte	0x30
+	.byte	0x34
+	.byte	0x12
+	.long	0x2277
+	.long	0x22d4
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF382
+	.byte	0x2f
+	.byte	0x9b
+	.byte	0x11
+	.long	0x226b
+	.long	0x22ea
+	.uleb128 0x1
+	.long	0xbde
+	.byte	0
+	.uleb128 0x17
+	.long	0xab7
+	.uleb128 0x19
+	.long	0xa78
+	.uleb128 0x21
+	.long	.LASF383
+	.byte	0x2
+	.byte	0x3d
+	.byte	0xb
+	.long	0x2935
+	.uleb128 0x1b
+	.long	.LASF384
+	.byte	0x1
+	.byte	0x2
+	.byte	0x51
+	.byte	0x8
+	.long	0x2320
+	.uleb128 0x73
+	.long	.LASF485
+	.byte	0x2
+	.byte	0x51
+	.byte	0x31
+	.long	.LASF486
+	.long	0x9c3
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF385
+	.byte	0x1
+	.byte	0x2
+	.byte	0x92
+	.byte	0x8
+	.long	0x2473
+	.uleb128 0x11
+	.long	.LASF386
+	.byte	0x2
+	.byte	0x94
+	.byte	0x12
+	.long	.LASF387
+	.long	0x2341
+	.long	0x2347
+	.uleb128 0x3
+	.long	0x2935
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF388
+	.byte	0x2
+	.byte	0x95
+	.byte	0x12
+	.long	.LASF389
+	.long	0x235b
+	.long	0x2361
+	.uleb128 0x3
+	.long	0x2935
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF390
+	.byte	0x2
+	.byte	0x96
+	.byte	0x12
+	.long	.LASF391
+	.long	0x2375
+	.long	0x237b
+	.uleb128 0x3
+	.long	0x2935
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF392
+	.byte	0x2
+	.byte	0x97
+	.byte	0x12
+	.long	.LASF393
+	.long	0x238f
+	.long	0x2395
+	.uleb128 0x3
+	.long	0x2935
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF394
+	.byte	0x2
+	.byte	0x98
+	.byte	0x8
+	.long	.LASF395
+	.long	0x23a9
+	.long	0x23af
+	.uleb128 0x3
+	.long	0x2935
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF396
+	.byte	0x2
+	.byte	0x99
+	.byte	0x8
+	.long	.LASF397
+	.long	0x23c3
+	.long	0x23c9
+	.uleb128 0x3
+	.long	0x2935
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF398
+	.byte	0x2
+	.byte	0x9a
+	.byte	0x12
+	.long	.LASF399
+	.long	0x23dd
+	.long	0x23e3
+	.uleb128 0x3
+	.long	0x293f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF400
+	.byte	0x2
+	.byte	0x9b
+	.byte	0x12
+	.long	.LASF401
+	.long	0x23f7
+	.long	0x23fd
+	.uleb128 0x3
+	.long	0x293f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF402
+	.byte	0x2
+	.byte	0x9c
+	.byte	0x12
+	.long	.LASF403
+	.long	0x2411
+	.long	0x2417
+	.uleb128 0x3
+	.long	0x293f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF404
+	.byte	0x2
+	.byte	0x9d
+	.byte	0x12
+	.long	.LASF405
+	.long	0x242b
+	.long	0x2431
+	.uleb128 0x3
+	.long	0x293f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF406
+	.byte	0x2
+	.byte	0x9e
+	.byte	0x12
+	.long	.LASF407
+	.long	0x2445
+	.long	0x244b
+	.uleb128 0x3
+	.long	0x2935
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF408
+	.byte	0x2
+	.byte	0x9f
+	.byte	0x12
+	.long	.LASF409
+	.long	0x9bc
+	.long	0x2463
+	.long	0x2469
+	.uleb128 0x3
+	.long	0x293f
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF410
+	.long	0x2300
+	.byte	0
+	.uleb128 0x8
+	.long	0x2320
+	.uleb128 0x3a
+	.long	.LASF411
+	.byte	0x4
+	.value	0x115
+	.long	0x2509
+	.uleb128 0xe
+	.byte	0x2
+	.value	0x115
+	.byte	0x7
+	.long	0x259f
+	.uleb128 0xe
+	.byte	0x2
+	.value	0x115
+	.byte	0x7
+	.long	0x25b8
+	.uleb128 0xe
+	.byte	0x2
+	.value	0x115
+	.byte	0x7
+	.long	0x25d6
+	.uleb128 0x74
+	.long	0x2509
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF412
+	.value	0x123
+	.byte	0x20
+	.long	.LASF423
+	.long	0x265e
+	.long	0x24bd
+	.long	0x24c3
+	.uleb128 0x3
+	.long	0x2984
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF444
+	.value	0x126
+	.long	0x24e8
+	.long	0x24f8
+	.uleb128 0xa
+	.string	"F"
+	.long	0x2f59
+	.uleb128 0x2d
+	.long	.LASF429
+	.long	0x24e8
+	.uleb128 0x2e
+	.long	0x29ed
+	.byte	0
+	.uleb128 0x3
+	.long	0x2984
+	.uleb128 0x1
+	.long	0x2fa5
+	.uleb128 0x1
+	.long	0x29ed
+	.byte	0
+	.uleb128 0xa
+	.string	"T"
+	.long	0xab0
+	.uleb128 0x27
+	.long	.LASF410
+	.long	0x2300
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF413
+	.byte	0x4
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x7
+	.long	0x2659
+	.uleb128 0x75
+	.byte	0x4
+	.byte	0x2
+	.byte	0xde
+	.byte	0x3
+	.byte	0x2
+	.long	0x252d
+	.uleb128 0x37
+	.long	.LASF414
+	.byte	0x2
+	.byte	0xdf
+	.byte	0x7
+	.long	0xab0
+	.byte	0
+	.uleb128 0x76
+	.long	.LASF415
+	.byte	0x2
+	.byte	0xdc
+	.byte	0x2e
+	.long	0x2320
+	.byte	0
+	.byte	0x2
+	.uleb128 0x77
+	.long	0x2516
+	.byte	0
+	.byte	0x2
+	.uleb128 0x16
+	.long	.LASF416
+	.byte	0x2
+	.byte	0xea
+	.byte	0xd
+	.long	.LASF417
+	.long	0x2556
+	.long	0x2561
+	.uleb128 0x3
+	.long	0x2970
+	.uleb128 0x1
+	.long	0x297a
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF416
+	.byte	0x2
+	.byte	0xf1
+	.byte	0xd
+	.long	.LASF418
+	.long	0x2575
+	.long	0x2580
+	.uleb128 0x3
+	.long	0x2970
+	.uleb128 0x1
+	.long	0x297f
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF419
+	.byte	0x2
+	.byte	0xf8
+	.byte	0xd
+	.long	.LASF420
+	.long	0x2594
+	.long	0x259f
+	.uleb128 0x3
+	.long	0x2970
+	.uleb128 0x3
+	.long	0xab0
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF421
+	.value	0x103
+	.long	.LASF440
+	.long	0x25b2
+	.long	0x25b8
+	.uleb128 0x3
+	.long	0x2970
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF422
+	.value	0x109
+	.byte	0xd
+	.long	.LASF424
+	.long	0x27b3
+	.long	0x25d0
+	.long	0x25d6
+	.uleb128 0x3
+	.long	0x2970
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF425
+	.value	0x10a
+	.byte	0x26
+	.long	.LASF426
+	.long	0x27b3
+	.long	0x25ee
+	.long	0x25f4
+	.uleb128 0x3
+	.long	0x2970
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF427
+	.value	0x10d
+	.long	0xab0
+	.long	0x2613
+	.long	0x261e
+	.uleb128 0xa
+	.string	"F"
+	.long	0x3063
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0x3
+	.long	0x2970
+	.uleb128 0x1
+	.long	0x30af
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF428
+	.value	0x10d
+	.long	0xab0
+	.long	0x263d
+	.long	0x2648
+	.uleb128 0xa
+	.string	"F"
+	.long	0x312f
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0x3
+	.long	0x2970
+	.uleb128 0x1
+	.long	0x3176
+	.byte	0
+	.uleb128 0xa
+	.string	"T"
+	.long	0xab7
+	.uleb128 0x27
+	.long	.LASF410
+	.long	0x2300
+	.byte	0
+	.uleb128 0x8
+	.long	0x2509
+	.uleb128 0x3a
+	.long	.LASF430
+	.byte	0x8
+	.value	0x12e
+	.long	0x27ae
+	.uleb128 0x4c
+	.long	.LASF431
+	.value	0x132
+	.long	0x2970
+	.uleb128 0x2f
+	.long	.LASF432
+	.value	0x135
+	.byte	0xd
+	.long	.LASF433
+	.long	0x2689
+	.long	0x2694
+	.uleb128 0x3
+	.long	0x29c0
+	.uleb128 0x1
+	.long	0x2970
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF434
+	.value	0x13a
+	.byte	0x12
+	.long	.LASF435
+	.long	0x26a8
+	.long	0x26ae
+	.uleb128 0x3
+	.long	0x29ca
+	.byte	0
+	.uleb128 0x78
+	.long	.LASF432
+	.byte	0x2
+	.value	0x143
+	.byte	0x3
+	.long	.LASF436
+	.byte	0x1
+	.long	0x26c4
+	.long	0x26cf
+	.uleb128 0x3
+	.long	0x29c0
+	.uleb128 0x1
+	.long	0x29d4
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF432
+	.value	0x145
+	.long	.LASF437
+	.long	0x26e2
+	.long	0x26ed
+	.uleb128 0x3
+	.long	0x29c0
+	.uleb128 0x1
+	.long	0x29d9
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF438
+	.value	0x14d
+	.long	.LASF439
+	.long	0x2700
+	.long	0x270b
+	.uleb128 0x3
+	.long	0x29c0
+	.uleb128 0x3
+	.long	0xab0
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF421
+	.value	0x154
+	.long	.LASF441
+	.long	0x271e
+	.long	0x2724
+	.uleb128 0x3
+	.long	0x29c0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF442
+	.value	0x16e
+	.byte	0x8
+	.long	.LASF443
+	.long	0x29de
+	.long	0x273c
+	.long	0x2742
+	.uleb128 0x3
+	.long	0x29c0
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF445
+	.value	0x165
+	.long	0x275d
+	.long	0x2768
+	.uleb128 0xa
+	.string	"F"
+	.long	0x2ccb
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0x3
+	.long	0x29c0
+	.uleb128 0x1
+	.long	0x2d79
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF444
+	.value	0x165
+	.long	0x278d
+	.long	0x279d
+	.uleb128 0xa
+	.string	"F"
+	.long	0x2f59
+	.uleb128 0x2d
+	.long	.LASF429
+	.long	0x278d
+	.uleb128 0x2e
+	.long	0x29ed
+	.byte	0
+	.uleb128 0x3
+	.long	0x29c0
+	.uleb128 0x1
+	.long	0x2fa5
+	.uleb128 0x1
+	.long	0x29ed
+	.byte	0
+	.uleb128 0xa
+	.string	"T"
+	.long	0xab0
+	.uleb128 0x27
+	.long	.LASF410
+	.long	0x2300
+	.byte	0
+	.uleb128 0x8
+	.long	0x265e
+	.uleb128 0x3a
+	.long	.LASF446
+	.byte	0x8
+	.value	0x1be
+	.long	0x292f
+	.uleb128 0x4c
+	.long	.LASF431
+	.value	0x1c3
+	.long	0x2970
+	.uleb128 0x2f
+	.long	.LASF432
+	.value	0x1c6
+	.byte	0xd
+	.long	.LASF447
+	.long	0x27de
+	.long	0x27e9
+	.uleb128 0x3
+	.long	0x298e
+	.uleb128 0x1
+	.long	0x2970
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF434
+	.value	0x1cb
+	.byte	0x12
+	.long	.LASF448
+	.long	0x27fd
+	.long	0x2803
+	.uleb128 0x3
+	.long	0x2998
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF432
+	.value	0x1d2
+	.long	.LASF449
+	.long	0x2816
+	.long	0x2821
+	.uleb128 0x3
+	.long	0x298e
+	.uleb128 0x1
+	.long	0x29a2
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF432
+	.value	0x1da
+	.long	.LASF450
+	.long	0x2834
+	.long	0x283f
+	.uleb128 0x3
+	.long	0x298e
+	.uleb128 0x1
+	.long	0x29a7
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF438
+	.value	0x1e2
+	.long	.LASF451
+	.long	0x2852
+	.long	0x285d
+	.uleb128 0x3
+	.long	0x298e
+	.uleb128 0x3
+	.long	0xab0
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF421
+	.value	0x1e9
+	.long	.LASF452
+	.long	0x2870
+	.long	0x2876
+	.uleb128 0x3
+	.long	0x298e
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF453
+	.value	0x1f2
+	.long	0xab0
+	.long	0x2895
+	.long	0x28a0
+	.uleb128 0xa
+	.string	"F"
+	.long	0x2b22
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0x3
+	.long	0x298e
+	.uleb128 0x1
+	.long	0x2c67
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF454
+	.value	0x1f2
+	.long	0xab0
+	.long	0x28bf
+	.long	0x28ca
+	.uleb128 0xa
+	.string	"F"
+	.long	0x2e0e
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0x3
+	.long	0x298e
+	.uleb128 0x1
+	.long	0x2ed8
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF427
+	.value	0x1f2
+	.long	0xab0
+	.long	0x28e9
+	.long	0x28f4
+	.uleb128 0xa
+	.string	"F"
+	.long	0x3063
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0x3
+	.long	0x298e
+	.uleb128 0x1
+	.long	0x30af
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF428
+	.value	0x1f2
+	.long	0xab0
+	.long	0x2913
+	.long	0x291e
+	.uleb128 0xa
+	.string	"F"
+	.long	0x312f
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0x3
+	.long	0x298e
+	.uleb128 0x1
+	.long	0x3176
+	.byte	0
+	.uleb128 0xa
+	.string	"T"
+	.long	0xab7
+	.uleb128 0x27
+	.long	.LASF410
+	.long	0x2300
+	.byte	0
+	.uleb128 0x8
+	.long	0x27b3
+	.byte	0
+	.uleb128 0x7
+	.long	0x2320
+	.uleb128 0x8
+	.long	0x2935
+	.uleb128 0x7
+	.long	0x2473
+	.uleb128 0x4d
+	.string	"Obj"
+	.byte	0xd
+	.long	0x2478
+	.uleb128 0x5
+	.long	.LASF455
+	.byte	0x1
+	.byte	0xe
+	.byte	0x7
+	.long	0x2509
+	.uleb128 0x4d
+	.string	"Ref"
+	.byte	0xf
+	.long	0x265e
+	.uleb128 0x5
+	.long	.LASF456
+	.byte	0x1
+	.byte	0x10
+	.byte	0x7
+	.long	0x27b3
+	.uleb128 0x7
+	.long	0x2509
+	.uleb128 0x8
+	.long	0x2970
+	.uleb128 0x17
+	.long	0x2659
+	.uleb128 0x15
+	.long	0x2509
+	.uleb128 0x7
+	.long	0x2478
+	.uleb128 0x8
+	.long	0x2984
+	.uleb128 0x7
+	.long	0x27b3
+	.uleb128 0x8
+	.long	0x298e
+	.uleb128 0x7
+	.long	0x292f
+	.uleb128 0x8
+	.long	0x2998
+	.uleb128 0x17
+	.long	0x292f
+	.uleb128 0x15
+	.long	0x27b3
+	.uleb128 0x7
+	.long	0x312f
+	.uleb128 0x7
+	.long	0x3157
+	.uleb128 0x7
+	.long	0x3063
+	.uleb128 0x7
+	.long	0x308b
+	.uleb128 0x7
+	.long	0x265e
+	.uleb128 0x8
+	.long	0x29c0
+	.uleb128 0x7
+	.long	0x27ae
+	.uleb128 0x8
+	.long	0x29ca
+	.uleb128 0x17
+	.long	0x27ae
+	.uleb128 0x15
+	.long	0x265e
+	.uleb128 0x4a
+	.long	.LASF458
+	.uleb128 0x7
+	.long	0x2f59
+	.uleb128 0x7
+	.long	0x2f7d
+	.uleb128 0x17
+	.long	0xab0
+	.uleb128 0x7
+	.long	0x2e0e
+	.uleb128 0x7
+	.long	0x2e3a
+	.uleb128 0x7
+	.long	0x2ccb
+	.uleb128 0x7
+	.long	0x2cf3
+	.uleb128 0x7
+	.long	0x2b22
+	.uleb128 0x7
+	.long	0x2b4e
+	.uleb128 0xd
+	.long	0x2675
+	.long	0x2a1e
+	.byte	0x2
+	.long	0x2a33
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x29c5
+	.uleb128 0x4e
+	.long	.LASF460
+	.value	0x135
+	.long	0x2970
+	.byte	0
+	.uleb128 0x4f
+	.long	0x2a10
+	.long	.LASF461
+	.long	0x2a44
+	.long	0x2a4f
+	.uleb128 0x13
+	.long	0x2a1e
+	.uleb128 0x13
+	.long	0x2a27
+	.byte	0
+	.uleb128 0xd
+	.long	0x27ca
+	.long	0x2a5d
+	.byte	0x2
+	.long	0x2a72
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x2993
+	.uleb128 0x4e
+	.long	.LASF460
+	.value	0x1c6
+	.long	0x2970
+	.byte	0
+	.uleb128 0x4f
+	.long	0x2a4f
+	.long	.LASF462
+	.long	0x2a83
+	.long	0x2a8e
+	.uleb128 0x13
+	.long	0x2a5d
+	.uleb128 0x13
+	.long	0x2a66
+	.byte	0
+	.uleb128 0xd
+	.long	0x2694
+	.long	0x2a9c
+	.byte	0x3
+	.long	0x2aa6
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x29cf
+	.byte	0
+	.uleb128 0xd
+	.long	0x24a5
+	.long	0x2ab4
+	.byte	0x3
+	.long	0x2abe
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x2989
+	.byte	0
+	.uleb128 0xd
+	.long	0x25d6
+	.long	0x2acc
+	.byte	0x3
+	.long	0x2ad6
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x2975
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF463
+	.byte	0x39
+	.long	0xab0
+	.quad	.LFB4894
+	.quad	.LFE4894-.LFB4894
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2c62
+	.uleb128 0x3e
+	.string	"o"
+	.byte	0x39
+	.byte	0x26
+	.long	0x2c62
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x50
+	.string	"r"
+	.byte	0x3b
+	.long	0x2964
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x50
+	.string	"r2"
+	.byte	0x3c
+	.long	0x2964
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x3f
+	.byte	0x3d
+	.byte	0x14
+	.long	0x2b6c
+	.uleb128 0x26
+	.long	.LASF465
+	.long	0x2b36
+	.long	0x2b41
+	.uleb128 0x3
+	.long	0x2a06
+	.uleb128 0x3
+	.long	0xab0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF3
+	.long	0xab0
+	.long	0x2b53
+	.uleb128 0x8
+	.long	0x2b22
+	.uleb128 0xb
+	.long	.LASF466
+	.long	0x2b5c
+	.uleb128 0x8
+	.long	0x2a0b
+	.uleb128 0x10
+	.string	"v"
+	.byte	0x3d
+	.byte	0x21
+	.long	0x22ea
+	.byte	0
+	.byte	0
+	.uleb128 0x79
+	.long	0x2abe
+	.quad	.LBI114
+	.byte	.LVU38
+	.quad	.LBB114
+	.quad	.LBE114-.LBB114
+	.byte	0x1
+	.byte	0x3b
+	.byte	0xd
+	.long	0x2bfa
+	.uleb128 0x1a
+	.long	0x2acc
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x29
+	.long	0x2a4f
+	.quad	.LBI115
+	.byte	.LVU39
+	.quad	.LBB115
+	.quad	.LBE115-.LBB115
+	.value	0x10a
+	.byte	0x42
+	.uleb128 0x1a
+	.long	0x2a66
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x13
+	.long	0x2a5d
+	.uleb128 0x29
+	.long	0x3212
+	.quad	.LBI116
+	.byte	.LVU40
+	.quad	.LBB116
+	.quad	.LBE116-.LBB116
+	.value	0x1c8
+	.byte	0x20
+	.uleb128 0x13
+	.long	0x3220
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.long	0x2c6c
+	.quad	.LBI117
+	.byte	.LVU44
+	.quad	.LBB117
+	.quad	.LBE117-.LBB117
+	.byte	0x3d
+	.byte	0x12
+	.uleb128 0x13
+	.long	0x2c8f
+	.uleb128 0x1a
+	.long	0x2c86
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x29
+	.long	0x2b41
+	.quad	.LBI118
+	.byte	.LVU45
+	.quad	.LBB118
+	.quad	.LBE118-.LBB118
+	.value	0x1f5
+	.byte	0x1e
+	.uleb128 0x1a
+	.long	0x2b61
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x13
+	.long	0x2b53
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x2944
+	.uleb128 0x15
+	.long	0x2b22
+	.uleb128 0xd
+	.long	0x2876
+	.long	0x2c86
+	.byte	0x3
+	.long	0x2c9e
+	.uleb128 0xa
+	.string	"F"
+	.long	0x2b22
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x2993
+	.uleb128 0x18
+	.string	"f"
+	.value	0x1f2
+	.byte	0x26
+	.long	0x2c67
+	.uleb128 0x1e
+	.value	0x1f2
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF467
+	.byte	0x32
+	.quad	.LFB4889
+	.quad	.LFE4889-.LFB4889
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d79
+	.uleb128 0x52
+	.string	"r"
+	.byte	0x32
+	.byte	0x24
+	.long	0x295a
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x3f
+	.byte	0x34
+	.byte	0xd
+	.long	0x2d11
+	.uleb128 0x26
+	.long	.LASF465
+	.long	0x2cdf
+	.long	0x2cea
+	.uleb128 0x3
+	.long	0x29fc
+	.uleb128 0x3
+	.long	0xab0
+	.byte	0
+	.uleb128 0x53
+	.long	.LASF3
+	.long	0x2cf8
+	.uleb128 0x8
+	.long	0x2ccb
+	.uleb128 0xb
+	.long	.LASF466
+	.long	0x2d01
+	.uleb128 0x8
+	.long	0x2a01
+	.uleb128 0x10
+	.string	"v"
+	.byte	0x34
+	.byte	0x14
+	.long	0x29ed
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.long	0x2d7e
+	.quad	.LBI110
+	.byte	.LVU30
+	.quad	.LBB110
+	.quad	.LBE110-.LBB110
+	.byte	0x34
+	.byte	0xb
+	.uleb128 0x13
+	.long	0x2da1
+	.uleb128 0x1a
+	.long	0x2d98
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x29
+	.long	0x2cea
+	.quad	.LBI112
+	.byte	.LVU31
+	.quad	.LBB112
+	.quad	.LBE112-.LBB112
+	.value	0x168
+	.byte	0x1e
+	.uleb128 0x1a
+	.long	0x2d06
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x13
+	.long	0x2cf8
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x2ccb
+	.uleb128 0xd
+	.long	0x2742
+	.long	0x2d98
+	.byte	0x3
+	.long	0x2db0
+	.uleb128 0xa
+	.string	"F"
+	.long	0x2ccb
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x29c5
+	.uleb128 0x18
+	.string	"f"
+	.value	0x165
+	.byte	0x27
+	.long	0x2d79
+	.uleb128 0x1e
+	.value	0x165
+	.byte	0x30
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF468
+	.byte	0x31
+	.quad	.LFB4888
+	.quad	.LFE4888-.LFB4888
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2dd8
+	.uleb128 0x3e
+	.string	"p"
+	.byte	0x31
+	.byte	0x27
+	.long	0x2dd8
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x7
+	.long	0xab0
+	.uleb128 0x3d
+	.long	.LASF469
+	.byte	0x2c
+	.long	0xab0
+	.quad	.LFB4881
+	.quad	.LFE4881-.LFB4881
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ec0
+	.uleb128 0x52
+	.string	"r"
+	.byte	0x2c
+	.byte	0x23
+	.long	0x2964
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x3f
+	.byte	0x2e
+	.byte	0x13
+	.long	0x2e58
+	.uleb128 0x26
+	.long	.LASF465
+	.long	0x2e22
+	.long	0x2e2d
+	.uleb128 0x3
+	.long	0x29f2
+	.uleb128 0x3
+	.long	0xab0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF3
+	.long	0xab0
+	.long	0x2e3f
+	.uleb128 0x8
+	.long	0x2e0e
+	.uleb128 0xb
+	.long	.LASF466
+	.long	0x2e48
+	.uleb128 0x8
+	.long	0x29f7
+	.uleb128 0x10
+	.string	"v"
+	.byte	0x2e
+	.byte	0x20
+	.long	0x22ea
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.long	0x2edd
+	.quad	.LBI106
+	.byte	.LVU18
+	.quad	.LBB106
+	.quad	.LBE106-.LBB106
+	.byte	0x2e
+	.byte	0x11
+	.uleb128 0x13
+	.long	0x2f00
+	.uleb128 0x1a
+	.long	0x2ef7
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x29
+	.long	0x2e2d
+	.quad	.LBI108
+	.byte	.LVU19
+	.quad	.LBB108
+	.quad	.LBE108-.LBB108
+	.value	0x1f5
+	.byte	0x1e
+	.uleb128 0x1a
+	.long	0x2e4d
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x13
+	.long	0x2e3f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x27e9
+	.long	0x2ece
+	.byte	0x3
+	.long	0x2ed8
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x299d
+	.byte	0
+	.uleb128 0x15
+	.long	0x2e0e
+	.uleb128 0xd
+	.long	0x28a0
+	.long	0x2ef7
+	.byte	0x3
+	.long	0x2f0f
+	.uleb128 0xa
+	.string	"F"
+	.long	0x2e0e
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x2993
+	.uleb128 0x18
+	.string	"f"
+	.value	0x1f2
+	.byte	0x26
+	.long	0x2ed8
+	.uleb128 0x1e
+	.value	0x1f2
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF470
+	.byte	0x2b
+	.long	0xab0
+	.quad	.LFB4880
+	.quad	.LFE4880-.LFB4880
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2f3b
+	.uleb128 0x3e
+	.string	"p"
+	.byte	0x2b
+	.byte	0x2b
+	.long	0xbd9
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x7a
+	.long	.LASF487
+	.byte	0x1
+	.byte	0x23
+	.byte	0x11
+	.long	0x2fa5
+	.uleb128 0x10
+	.string	"o"
+	.byte	0x23
+	.byte	0x21
+	.long	0x2c62
+	.uleb128 0x10
+	.string	"x"
+	.byte	0x23
+	.byte	0x28
+	.long	0xab0
+	.uleb128 0x41
+	.byte	0x25
+	.byte	0xd
+	.uleb128 0x26
+	.long	.LASF465
+	.long	0x2f69
+	.long	0x2f74
+	.uleb128 0x3
+	.long	0x29e3
+	.uleb128 0x3
+	.long	0xab0
+	.byte	0
+	.uleb128 0x53
+	.long	.LASF3
+	.long	0x2f82
+	.uleb128 0x8
+	.long	0x2f59
+	.uleb128 0xb
+	.long	.LASF466
+	.long	0x2f8b
+	.uleb128 0x8
+	.long	0x29e8
+	.uleb128 0x10
+	.string	"v"
+	.byte	0x25
+	.byte	0x14
+	.long	0x29ed
+	.uleb128 0x10
+	.string	"x"
+	.byte	0x25
+	.byte	0x1b
+	.long	0xab0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x2f59
+	.uleb128 0xd
+	.long	0x24c3
+	.long	0x2fce
+	.byte	0x3
+	.long	0x2feb
+	.uleb128 0xa
+	.string	"F"
+	.long	0x2f59
+	.uleb128 0x2d
+	.long	.LASF429
+	.long	0x2fce
+	.uleb128 0x2e
+	.long	0x29ed
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x2989
+	.uleb128 0x18
+	.string	"f"
+	.value	0x126
+	.byte	0x27
+	.long	0x2fa5
+	.uleb128 0x54
+	.value	0x126
+	.uleb128 0x1
+	.long	0x29ed
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x2768
+	.long	0x300f
+	.byte	0x3
+	.long	0x302c
+	.uleb128 0xa
+	.string	"F"
+	.long	0x2f59
+	.uleb128 0x2d
+	.long	.LASF429
+	.long	0x300f
+	.uleb128 0x2e
+	.long	0x29ed
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x29c5
+	.uleb128 0x18
+	.string	"f"
+	.value	0x165
+	.byte	0x27
+	.long	0x2fa5
+	.uleb128 0x54
+	.value	0x165
+	.uleb128 0x1
+	.long	0x29ed
+	.byte	0
+	.byte	0
+	.uleb128 0x7b
+	.long	.LASF471
+	.byte	0x1
+	.byte	0x22
+	.byte	0x11
+	.byte	0x1
+	.long	0x304c
+	.uleb128 0x10
+	.string	"v"
+	.byte	0x22
+	.byte	0x23
+	.long	0x29ed
+	.uleb128 0x10
+	.string	"x"
+	.byte	0x22
+	.byte	0x2a
+	.long	0xab0
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF472
+	.byte	0x1b
+	.long	0xab0
+	.long	0x30aa
+	.uleb128 0x10
+	.string	"o"
+	.byte	0x1b
+	.byte	0x2a
+	.long	0x30aa
+	.uleb128 0x41
+	.byte	0x1d
+	.byte	0x13
+	.uleb128 0x26
+	.long	.LASF465
+	.long	0x3073
+	.long	0x307e
+	.uleb128 0x3
+	.long	0x29b6
+	.uleb128 0x3
+	.long	0xab0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF3
+	.long	0xab0
+	.long	0x3090
+	.uleb128 0x8
+	.long	0x3063
+	.uleb128 0xb
+	.long	.LASF466
+	.long	0x3099
+	.uleb128 0x8
+	.long	0x29bb
+	.uleb128 0x10
+	.string	"v"
+	.byte	0x1d
+	.byte	0x20
+	.long	0x22ea
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x294e
+	.uleb128 0x15
+	.long	0x3063
+	.uleb128 0xd
+	.long	0x25f4
+	.long	0x30ce
+	.byte	0x3
+	.long	0x30e6
+	.uleb128 0xa
+	.string	"F"
+	.long	0x3063
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x2975
+	.uleb128 0x18
+	.string	"f"
+	.value	0x10d
+	.byte	0x26
+	.long	0x30af
+	.uleb128 0x1e
+	.value	0x10d
+	.byte	0x2f
+	.byte	0
+	.uleb128 0xd
+	.long	0x28ca
+	.long	0x3100
+	.byte	0x3
+	.long	0x3118
+	.uleb128 0xa
+	.string	"F"
+	.long	0x3063
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x2993
+	.uleb128 0x18
+	.string	"f"
+	.value	0x1f2
+	.byte	0x26
+	.long	0x30af
+	.uleb128 0x1e
+	.value	0x1f2
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF473
+	.byte	0x15
+	.long	0xab0
+	.long	0x3176
+	.uleb128 0x10
+	.string	"o"
+	.byte	0x15
+	.byte	0x1f
+	.long	0x2c62
+	.uleb128 0x41
+	.byte	0x17
+	.byte	0x13
+	.uleb128 0x26
+	.long	.LASF465
+	.long	0x313f
+	.long	0x314a
+	.uleb128 0x3
+	.long	0x29ac
+	.uleb128 0x3
+	.long	0xab0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF3
+	.long	0xab0
+	.long	0x315c
+	.uleb128 0x8
+	.long	0x312f
+	.uleb128 0xb
+	.long	.LASF466
+	.long	0x3165
+	.uleb128 0x8
+	.long	0x29b1
+	.uleb128 0x10
+	.string	"v"
+	.byte	0x17
+	.byte	0x20
+	.long	0x22ea
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x312f
+	.uleb128 0xd
+	.long	0x261e
+	.long	0x3195
+	.byte	0x3
+	.long	0x31ad
+	.uleb128 0xa
+	.string	"F"
+	.long	0x312f
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x2975
+	.uleb128 0x18
+	.string	"f"
+	.value	0x10d
+	.byte	0x26
+	.long	0x3176
+	.uleb128 0x1e
+	.value	0x10d
+	.byte	0x2f
+	.byte	0
+	.uleb128 0xd
+	.long	0x28f4
+	.long	0x31c7
+	.byte	0x3
+	.long	0x31df
+	.uleb128 0xa
+	.string	"F"
+	.long	0x312f
+	.uleb128 0xf
+	.long	.LASF429
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x2993
+	.uleb128 0x18
+	.string	"f"
+	.value	0x1f2
+	.byte	0x26
+	.long	0x3176
+	.uleb128 0x1e
+	.value	0x1f2
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x1
+	.byte	0x14
+	.byte	0x10
+	.long	0xab0
+	.byte	0x1
+	.long	0x31fa
+	.uleb128 0x10
+	.string	"v"
+	.byte	0x14
+	.byte	0x21
+	.long	0x29ed
+	.byte	0
+	.uleb128 0xd
+	.long	0x2361
+	.long	0x3208
+	.byte	0x3
+	.long	0x3212
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x293a
+	.byte	0
+	.uleb128 0xd
+	.long	0x232d
+	.long	0x3220
+	.byte	0x3
+	.long	0x322a
+	.uleb128 0xb
+	.long	.LASF459
+	.long	0x293a
+	.byte	0
+	.uleb128 0x7d
+	.long	0x31df
+	.quad	.LFB4860
+	.quad	.LFE4860-.LFB4860
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x324d
+	.uleb128 0x42
+	.long	0x31f0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x7e
+	.long	0x302c
+	.quad	.LFB4873
+	.quad	.LFE4873-.LFB4873
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x42
+	.long	0x3039
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x42
+	.long	0x3042
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4107
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 42
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x42
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x4108
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 35
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x4107
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xa
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xa
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 47
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x4108
+	.byte	0x1
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 48
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x2
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x60
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x62
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x63
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x64
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x65
+	.uleb128 0x3a
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x66
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x67
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x68
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x69
+	.uleb128 0x15
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6c
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x6d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x70
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x71
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x72
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x73
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x74
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x75
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x76
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x77
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x78
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x79
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS10:
+	.uleb128 .LVU41
+	.uleb128 .LVU47
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x3
+	.byte	0x55
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU43
+	.uleb128 .LVU47
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x3
+	.byte	0x55
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU38
+	.uleb128 .LVU41
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU39
+	.uleb128 .LVU41
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU44
+	.uleb128 .LVU47
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+11025
+	.sleb128 0
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU45
+	.uleb128 .LVU47
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU34
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU30
+	.uleb128 .LVU34
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+11450
+	.sleb128 0
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU31
+	.uleb128 .LVU34
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU22
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU18
+	.uleb128 .LVU21
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+11773
+	.sleb128 0
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU19
+	.uleb128 .LVU21
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF125:
+	.string	"getenv"
+.LASF187:
+	.string	"uint_fast16_t"
+.LASF72:
+	.string	"long int"
+.LASF437:
+	.string	"_ZN4xstd7RustRefIiNS_16borrow_uncheckedEEC4EOS2_"
+.LASF142:
+	.string	"strtoull"
+.LASF152:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy19__allow_unsequencedEv"
+.LASF298:
+	.string	"wcsxfrm"
+.LASF383:
+	.string	"xstd"
+.LASF50:
+	.string	"~exception_ptr"
+.LASF238:
+	.string	"_shortbuf"
+.LASF259:
+	.string	"rand"
+.LASF12:
+	.string	"false_type"
+.LASF304:
+	.string	"wprintf"
+.LASF373:
+	.string	"setvbuf"
+.LASF148:
+	.string	"execution"
+.LASF205:
+	.string	"gp_offset"
+.LASF391:
+	.string	"_ZN4xstd12borrow_stateINS_16borrow_uncheckedEE13begin_mutableEv"
+.LASF53:
+	.string	"_ZNSt15__exception_ptr13exception_ptr4swapERS0_"
+.LASF136:
+	.string	"system"
+.LASF201:
+	.string	"tm_yday"
+.LASF227:
+	.string	"_IO_buf_end"
+.LASF473:
+	.string	"rust_read"
+.LASF453:
+	.string	"apply<rust_borrow_read(Obj&)::<lambda(int const&)> >"
+.LASF112:
+	.string	"__off_t"
+.LASF447:
+	.string	"_ZN4xstd7RustRefIKiNS_16borrow_uncheckedEEC4EPNS_7RustObjIS1_S2_EE"
+.LASF17:
+	.string	"__cust_swap"
+.LASF19:
+	.string	"__cust_iswap"
+.LASF356:
+	.string	"fflush"
+.LASF49:
+	.string	"_ZNSt15__exception_ptr13exception_ptraSEOS0_"
+.LASF312:
+	.string	"wcstold"
+.LASF306:
+	.string	"__isoc99_wscanf"
+.LASF272:
+	.string	"vfwscanf"
+.LASF330:
+	.string	"p_cs_precedes"
+.LASF430:
+	.string	"RustRef<int, xstd::borrow_unchecked>"
+.LASF411:
+	.string	"RustObj<int, xstd::borrow_unchecked>"
+.LASF225:
+	.string	"_IO_write_end"
+.LASF59:
+	.string	"unsigned int"
+.LASF313:
+	.string	"wcstoll"
+.LASF149:
+	.string	"sequenced_policy"
+.LASF61:
+	.string	"__gnu_cxx"
+.LASF428:
+	.string	"apply<rust_read(Obj&)::<lambda(int const&)> >"
+.LASF34:
+	.string	"__exception_ptr"
+.LASF130:
+	.string	"quick_exit"
+.LASF477:
+	.string	"_ZNKSt15__exception_ptr13exception_ptrcvbEv"
+.LASF192:
+	.string	"intmax_t"
+.LASF189:
+	.string	"uint_fast64_t"
+.LASF183:
+	.string	"int_fast16_t"
+.LASF206:
+	.string	"fp_offset"
+.LASF163:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy16__allow_parallelEv"
+.LASF77:
+	.string	"wchar_t"
+.LASF432:
+	.string	"RustRef"
+.LASF40:
+	.string	"_ZNSt15__exception_ptr13exception_ptr10_M_releaseEv"
+.LASF278:
+	.string	"vwscanf"
+.LASF322:
+	.string	"currency_symbol"
+.LASF14:
+	.string	"__swappable_details"
+.LASF231:
+	.string	"_markers"
+.LASF197:
+	.string	"tm_mday"
+.LASF81:
+	.string	"__int128"
+.LASF479:
+	.string	"_ZN9__gnu_cxx3divExx"
+.LASF269:
+	.string	"__isoc99_swscanf"
+.LASF106:
+	.string	"__int_least32_t"
+.LASF457:
+	.string	"decltype(nullptr)"
+.LASF103:
+	.string	"__uint_least8_t"
+.LASF33:
+	.string	"nullptr_t"
+.LASF406:
+	.string	"kill"
+.LASF62:
+	.string	"__ops"
+.LASF78:
+	.string	"char8_t"
+.LASF394:
+	.string	"begin_slice"
+.LASF483:
+	.string	"max_align_t"
+.LASF376:
+	.string	"ungetc"
+.LASF284:
+	.string	"wcscpy"
+.LASF20:
+	.string	"__cust_access"
+.LASF413:
+	.string	"RustObj<int const, xstd::borrow_unchecked>"
+.LASF157:
+	.string	"_ZN6__pstl9execution2v115parallel_policy19__allow_unsequencedEv"
+.LASF441:
+	.string	"_ZN4xstd7RustRefIiNS_16borrow_uncheckedEE4dropEv"
+.LASF470:
+	.string	"direct_ptr_read"
+.LASF109:
+	.string	"__uint_least64_t"
+.LASF316:
+	.string	"__max_align_ld"
+.LASF281:
+	.string	"wcscat"
+.LASF317:
+	.string	"lconv"
+.LASF318:
+	.string	"decimal_point"
+.LASF158:
+	.string	"_ZN6__pstl9execution2v115parallel_policy14__allow_vectorEv"
+.LASF424:
+	.string	"_ZN4xstd7RustObjIKiNS_16borrow_uncheckedEEcvNS_7RustRefIS1_S2_EEEv"
+.LASF380:
+	.string	"towctrans"
+.LASF333:
+	.string	"n_sep_by_space"
+.LASF52:
+	.string	"swap"
+.LASF346:
+	.string	"__state"
+.LASF436:
+	.string	"_ZN4xstd7RustRefIiNS_16borrow_uncheckedEEC4ERKS2_"
+.LASF292:
+	.string	"wcsspn"
+.LASF414:
+	.string	"m_value"
+.LASF3:
+	.string	"operator()"
+.LASF9:
+	.string	"operator std::integral_constant<bool, true>::value_type"
+.LASF185:
+	.string	"int_fast64_t"
+.LASF144:
+	.string	"strtold"
+.LASF460:
+	.string	"obj_p"
+.LASF256:
+	.string	"fwscanf"
+.LASF141:
+	.string	"strtoll"
+.LASF179:
+	.string	"uint_least16_t"
+.LASF172:
+	.string	"uint32_t"
+.LASF114:
+	.string	"int8_t"
+.LASF331:
+	.string	"p_sep_by_space"
+.LASF262:
+	.string	"mbrtowc"
+.LASF417:
+	.string	"_ZN4xstd7RustObjIKiNS_16borrow_uncheckedEEC4ERKS3_"
+.LASF129:
+	.string	"mbtowc"
+.LASF198:
+	.string	"tm_mon"
+.LASF180:
+	.string	"uint_least32_t"
+.LASF351:
+	.string	"fpos_t"
+.LASF29:
+	.string	"__cmp_alg"
+.LASF45:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EDn"
+.LASF150:
+	.string	"__allow_unsequenced"
+.LASF236:
+	.string	"_cur_column"
+.LASF358:
+	.string	"fgetpos"
+.LASF349:
+	.string	"_IO_codecvt"
+.LASF26:
+	.string	"__atomic_spin_count"
+.LASF443:
+	.string	"_ZN4xstd7RustRefIiNS_16borrow_uncheckedEE9slice_mutEv"
+.LASF276:
+	.string	"__isoc99_vswscanf"
+.LASF15:
+	.string	"__swappable_with_details"
+.LASF482:
+	.string	"11max_align_t"
+.LASF115:
+	.string	"int16_t"
+.LASF175:
+	.string	"int_least16_t"
+.LASF193:
+	.string	"uintmax_t"
+.LASF258:
+	.string	"getwc"
+.LASF69:
+	.string	"long long unsigned int"
+.LASF111:
+	.string	"__uintmax_t"
+.LASF57:
+	.string	"_ZSt17rethrow_exceptionNSt15__exception_ptr13exception_ptrE"
+.LASF110:
+	.string	"__intmax_t"
+.LASF46:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EOS0_"
+.LASF4:
+	.string	"_ZNKSt17integral_constantIbLb0EEcvbEv"
+.LASF219:
+	.string	"_flags"
+.LASF297:
+	.string	"wcstoul"
+.LASF364:
+	.string	"fsetpos"
+.LASF341:
+	.string	"int_n_sign_posn"
+.LASF24:
+	.string	"__platform_wait_alignment"
+.LASF222:
+	.string	"_IO_read_base"
+.LASF138:
+	.string	"wctomb"
+.LASF343:
+	.string	"localeconv"
+.LASF423:
+	.string	"_ZN4xstd7RustObjIiNS_16borrow_uncheckedEEadEv"
+.LASF217:
+	.string	"__FILE"
+.LASF229:
+	.string	"_IO_backup_base"
+.LASF18:
+	.string	"__cust_imove"
+.LASF147:
+	.string	"views"
+.LASF410:
+	.string	"Policy"
+.LASF300:
+	.string	"wmemcmp"
+.LASF280:
+	.string	"wcrtomb"
+.LASF181:
+	.string	"uint_least64_t"
+.LASF403:
+	.string	"_ZNK4xstd12borrow_stateINS_16borrow_uncheckedEE16check_unborrowedEv"
+.LASF139:
+	.string	"lldiv"
+.LASF140:
+	.string	"atoll"
+.LASF307:
+	.string	"wcschr"
+.LASF275:
+	.string	"vswscanf"
+.LASF271:
+	.string	"vfwprintf"
+.LASF451:
+	.string	"_ZN4xstd7RustRefIKiNS_16borrow_uncheckedEED4Ev"
+.LASF124:
+	.string	"bsearch"
+.LASF458:
+	.string	"auto"
+.LASF334:
+	.string	"p_sign_posn"
+.LASF389:
+	.string	"_ZN4xstd12borrow_stateINS_16borrow_uncheckedEE10end_sharedEv"
+.LASF151:
+	.string	"__allow_vector"
+.LASF13:
+	.string	"size_t"
+.LASF336:
+	.string	"int_p_cs_precedes"
+.LASF132:
+	.string	"srand"
+.LASF117:
+	.string	"int64_t"
+.LASF177:
+	.string	"int_least64_t"
+.LASF11:
+	.string	"_ZNKSt17integral_constantIbLb1EEclEv"
+.LASF265:
+	.string	"putwc"
+.LASF433:
+	.string	"_ZN4xstd7RustRefIiNS_16borrow_uncheckedEEC4EPNS_7RustObjIKiS1_EE"
+.LASF203:
+	.string	"tm_gmtoff"
+.LASF178:
+	.string	"uint_least8_t"
+.LASF467:
+	.string	"rust_ref_write"
+.LASF107:
+	.string	"__uint_least32_t"
+.LASF2:
+	.string	"operator std::integral_constant<bool, false>::value_type"
+.LASF398:
+	.string	"check_no_slices"
+.LASF184:
+	.string	"int_fast32_t"
+.LASF230:
+	.string	"_IO_save_end"
+.LASF273:
+	.string	"__isoc99_vfwscanf"
+.LASF32:
+	.string	"true_type"
+.LASF328:
+	.string	"int_frac_digits"
+.LASF101:
+	.string	"__uint64_t"
+.LASF352:
+	.string	"clearerr"
+.LASF310:
+	.string	"wcsstr"
+.LASF408:
+	.string	"live"
+.LASF338:
+	.string	"int_n_cs_precedes"
+.LASF285:
+	.string	"wcscspn"
+.LASF463:
+	.string	"rust_borrow_read"
+.LASF119:
+	.string	"at_quick_exit"
+.LASF388:
+	.string	"end_shared"
+.LASF474:
+	.string	"direct_read"
+.LASF327:
+	.string	"negative_sign"
+.LASF362:
+	.string	"freopen"
+.LASF214:
+	.string	"__value"
+.LASF97:
+	.string	"__uint16_t"
+.LASF420:
+	.string	"_ZN4xstd7RustObjIKiNS_16borrow_uncheckedEED4Ev"
+.LASF23:
+	.string	"__cmp_cat"
+.LASF320:
+	.string	"grouping"
+.LASF427:
+	.string	"apply<rust_const_read(ConstObj&)::<lambda(int const&)> >"
+.LASF254:
+	.string	"fwide"
+.LASF36:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EPv"
+.LASF39:
+	.string	"_ZNSt15__exception_ptr13exception_ptr9_M_addrefEv"
+.LASF93:
+	.string	"char"
+.LASF246:
+	.string	"_mode"
+.LASF88:
+	.string	"5div_t"
+.LASF98:
+	.string	"__int32_t"
+.LASF462:
+	.string	"_ZN4xstd7RustRefIKiNS_16borrow_uncheckedEEC2EPNS_7RustObjIS1_S2_EE"
+.LASF355:
+	.string	"ferror"
+.LASF348:
+	.string	"_IO_marker"
+.LASF131:
+	.string	"qsort"
+.LASF199:
+	.string	"tm_year"
+.LASF382:
+	.string	"wctype"
+.LASF274:
+	.string	"vswprintf"
+.LASF381:
+	.string	"wctrans"
+.LASF435:
+	.string	"_ZNK4xstd7RustRefIiNS_16borrow_uncheckedEE12check_usableEv"
+.LASF73:
+	.string	"long long int"
+.LASF407:
+	.string	"_ZN4xstd12borrow_stateINS_16borrow_uncheckedEE4killEv"
+.LASF385:
+	.string	"borrow_state<xstd::borrow_unchecked>"
+.LASF79:
+	.string	"char16_t"
+.LASF211:
+	.string	"__wch"
+.LASF170:
+	.string	"uint8_t"
+.LASF487:
+	.string	"rust_write"
+.LASF51:
+	.string	"_ZNSt15__exception_ptr13exception_ptrD4Ev"
+.LASF86:
+	.string	"quot"
+.LASF469:
+	.string	"rust_ref_read"
+.LASF145:
+	.string	"__int128 unsigned"
+.LASF264:
+	.string	"mbsrtowcs"
+.LASF91:
+	.string	"7lldiv_t"
+.LASF345:
+	.string	"__pos"
+.LASF456:
+	.string	"CRef"
+.LASF418:
+	.string	"_ZN4xstd7RustObjIKiNS_16borrow_uncheckedEEC4EOS3_"
+.LASF378:
+	.string	"wctrans_t"
+.LASF128:
+	.string	"mbstowcs"
+.LASF367:
+	.string	"getchar"
+.LASF35:
+	.string	"exception_ptr"
+.LASF223:
+	.string	"_IO_write_base"
+.LASF55:
+	.string	"_ZNKSt15__exception_ptr13exception_ptr20__cxa_exception_typeEv"
+.LASF475:
+	.string	"GNU C++23 12.2.0 -mtune=generic -march=x86-64 -g -O2 -std=c++23 -fasynchronous-unwind-tables"
+.LASF233:
+	.string	"_fileno"
+.LASF372:
+	.string	"setbuf"
+.LASF368:
+	.string	"perror"
+.LASF419:
+	.string	"~RustObj"
+.LASF118:
+	.string	"__compar_fn_t"
+.LASF162:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy14__allow_vectorEv"
+.LASF228:
+	.string	"_IO_save_base"
+.LASF168:
+	.string	"par_unseq"
+.LASF308:
+	.string	"wcspbrk"
+.LASF452:
+	.string	"_ZN4xstd7RustRefIKiNS_16borrow_uncheckedEE4dropEv"
+.LASF325:
+	.string	"mon_grouping"
+.LASF347:
+	.string	"__fpos_t"
+.LASF60:
+	.string	"bool"
+.LASF58:
+	.string	"__cxx11"
+.LASF395:
+	.string	"_ZN4xstd12borrow_stateINS_16borrow_uncheckedEE11begin_sliceEv"
+.LASF96:
+	.string	"__int16_t"
+.LASF267:
+	.string	"swprintf"
+.LASF10:
+	.string	"_ZNKSt17integral_constantIbLb1EEcvbEv"
+.LASF30:
+	.string	"__debug"
+.LASF250:
+	.string	"fgetwc"
+.LASF412:
+	.string	"operator&"
+.LASF425:
+	.string	"operator+"
+.LASF182:
+	.string	"int_fast8_t"
+.LASF363:
+	.string	"fseek"
+.LASF409:
+	.string	"_ZNK4xstd12borrow_stateINS_16borrow_uncheckedEE4liveEv"
+.LASF126:
+	.string	"ldiv"
+.LASF386:
+	.string	"begin_shared"
+.LASF251:
+	.string	"fgetws"
+.LASF429:
+	.string	"Args"
+.LASF390:
+	.string	"begin_mutable"
+.LASF47:
+	.string	"operator="
+.LASF41:
+	.string	"_M_get"
+.LASF369:
+	.string	"remove"
+.LASF244:
+	.string	"_freeres_buf"
+.LASF74:
+	.string	"long double"
+.LASF465:
+	.string	"~<lambda>"
+.LASF444:
+	.string	"mapply<rust_write(Obj&, int)::<lambda(int&, int)>, int&>"
+.LASF188:
+	.string	"uint_fast32_t"
+.LASF85:
+	.string	"_M_exception_object"
+.LASF439:
+	.string	"_ZN4xstd7RustRefIiNS_16borrow_uncheckedEED4Ev"
+.LASF159:
+	.string	"_ZN6__pstl9execution2v115parallel_policy16__allow_parallelEv"
+.LASF83:
+	.string	"__unknown__"
+.LASF393:
+	.string	"_ZN4xstd12borrow_stateINS_16borrow_uncheckedEE11end_mutableEv"
+.LASF365:
+	.string	"ftell"
+.LASF245:
+	.string	"__pad5"
+.LASF399:
+	.string	"_ZNK4xstd12borrow_stateINS_16borrow_uncheckedEE15check_no_slicesEv"
+.LASF270:
+	.string	"ungetwc"
+.LASF25:
+	.string	"__atomic_spin_count_relax"
+.LASF357:
+	.string	"fgetc"
+.LASF360:
+	.string	"fopen"
+.LASF237:
+	.string	"_vtable_offset"
+.LASF486:
+	.string	"_ZN4xstd16borrow_unchecked7checkedE"
+.LASF94:
+	.string	"__int8_t"
+.LASF438:
+	.string	"~RustRef"
+.LASF359:
+	.string	"fgets"
+.LASF384:
+	.string	"borrow_unchecked"
+.LASF215:
+	.string	"__mbstate_t"
+.LASF100:
+	.string	"__int64_t"
+.LASF104:
+	.string	"__int_least16_t"
+.LASF375:
+	.string	"tmpnam"
+.LASF154:
+	.string	"__allow_parallel"
+.LASF446:
+	.string	"RustRef<int const, xstd::borrow_unchecked>"
+.LASF27:
+	.string	"__cmp_cust"
+.LASF252:
+	.string	"fputwc"
+.LASF190:
+	.string	"intptr_t"
+.LASF171:
+	.string	"uint16_t"
+.LASF166:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy14__allow_vectorEv"
+.LASF459:
+	.string	"this"
+.LASF253:
+	.string	"fputws"
+.LASF242:
+	.string	"_wide_data"
+.LASF99:
+	.string	"__uint32_t"
+.LASF480:
+	.string	"_Lock_policy"
+.LASF28:
+	.string	"__cust"
+.LASF108:
+	.string	"__int_least64_t"
+.LASF249:
+	.string	"btowc"
+.LASF277:
+	.string	"vwprintf"
+.LASF396:
+	.string	"end_slice"
+.LASF202:
+	.string	"tm_isdst"
+.LASF440:
+	.string	"_ZN4xstd7RustObjIKiNS_16borrow_uncheckedEE4dropEv"
+.LASF56:
+	.string	"rethrow_exception"
+.LASF153:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy14__allow_vectorEv"
+.LASF379:
+	.string	"iswctype"
+.LASF263:
+	.string	"mbsinit"
+.LASF311:
+	.string	"wmemchr"
+.LASF71:
+	.string	"short int"
+.LASF405:
+	.string	"_ZNK4xstd12borrow_stateINS_16borrow_uncheckedEE18check_not_mutatingEv"
+.LASF21:
+	.string	"__detail"
+.LASF301:
+	.string	"wmemcpy"
+.LASF291:
+	.string	"wcsrtombs"
+.LASF321:
+	.string	"int_curr_symbol"
+.LASF314:
+	.string	"wcstoull"
+.LASF54:
+	.string	"__cxa_exception_type"
+.LASF323:
+	.string	"mon_decimal_point"
+.LASF329:
+	.string	"frac_digits"
+.LASF468:
+	.string	"direct_ptr_write"
+.LASF261:
+	.string	"mbrlen"
+.LASF174:
+	.string	"int_least8_t"
+.LASF361:
+	.string	"fread"
+.LASF478:
+	.string	"type_info"
+.LASF335:
+	.string	"n_sign_posn"
+.LASF160:
+	.string	"parallel_unsequenced_policy"
+.LASF210:
+	.string	"11__mbstate_t"
+.LASF120:
+	.string	"atexit"
+.LASF485:
+	.string	"checked"
+.LASF266:
+	.string	"putwchar"
+.LASF434:
+	.string	"check_usable"
+.LASF309:
+	.string	"wcsrchr"
+.LASF84:
+	.string	"__float128"
+.LASF260:
+	.string	"getwchar"
+.LASF350:
+	.string	"_IO_wide_data"
+.LASF387:
+	.string	"_ZN4xstd12borrow_stateINS_16borrow_uncheckedEE12begin_sharedEv"
+.LASF212:
+	.string	"__wchb"
+.LASF173:
+	.string	"uint64_t"
+.LASF339:
+	.string	"int_n_sep_by_space"
+.LASF353:
+	.string	"fclose"
+.LASF89:
+	.string	"6ldiv_t"
+.LASF416:
+	.string	"RustObj"
+.LASF289:
+	.string	"wcsncmp"
+.LASF80:
+	.string	"char32_t"
+.LASF155:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy16__allow_parallelEv"
+.LASF240:
+	.string	"_offset"
+.LASF16:
+	.string	"ranges"
+.LASF449:
+	.string	"_ZN4xstd7RustRefIKiNS_16borrow_uncheckedEEC4ERKS3_"
+.LASF90:
+	.string	"ldiv_t"
+.LASF484:
+	.string	"_IO_lock_t"
+.LASF239:
+	.string	"_lock"
+.LASF216:
+	.string	"mbstate_t"
+.LASF95:
+	.string	"__uint8_t"
+.LASF286:
+	.string	"wcsftime"
+.LASF326:
+	.string	"positive_sign"
+.LASF283:
+	.string	"wcscoll"
+.LASF337:
+	.string	"int_p_sep_by_space"
+.LASF44:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4ERKS0_"
+.LASF415:
+	.string	"m_state"
+.LASF82:
+	.string	"__gnu_debug"
+.LASF366:
+	.string	"getc"
+.LASF426:
+	.string	"_ZN4xstd7RustObjIKiNS_16borrow_uncheckedEEpsEv"
+.LASF476:
+	.string	"operator bool"
+.LASF176:
+	.string	"int_least32_t"
+.LASF5:
+	.string	"_ZNKSt17integral_constantIbLb0EEclEv"
+.LASF344:
+	.string	"_G_fpos_t"
+.LASF302:
+	.string	"wmemmove"
+.LASF370:
+	.string	"rename"
+.LASF102:
+	.string	"__int_least8_t"
+.LASF191:
+	.string	"uintptr_t"
+.LASF105:
+	.string	"__uint_least16_t"
+.LASF6:
+	.string	"integral_constant<bool, false>"
+.LASF37:
+	.string	"_M_addref"
+.LASF402:
+	.string	"check_unborrowed"
+.LASF442:
+	.string	"slice_mut"
+.LASF135:
+	.string	"strtoul"
+.LASF68:
+	.string	"long unsigned int"
+.LASF392:
+	.string	"end_mutable"
+.LASF235:
+	.string	"_old_offset"
+.LASF218:
+	.string	"_IO_FILE"
+.LASF422:
+	.string	"operator xstd::RustRef<int const, xstd::borrow_unchecked>"
+.LASF209:
+	.string	"wint_t"
+.LASF76:
+	.string	"float"
+.LASF208:
+	.string	"reg_save_area"
+.LASF404:
+	.string	"check_not_mutating"
+.LASF116:
+	.string	"int32_t"
+.LASF31:
+	.string	"numbers"
+.LASF293:
+	.string	"wcstod"
+.LASF294:
+	.string	"wcstof"
+.LASF195:
+	.string	"tm_min"
+.LASF295:
+	.string	"wcstok"
+.LASF296:
+	.string	"wcstol"
+.LASF204:
+	.string	"tm_zone"
+.LASF279:
+	.string	"__isoc99_vwscanf"
+.LASF303:
+	.string	"wmemset"
+.LASF342:
+	.string	"setlocale"
+.LASF146:
+	.string	"__pstl"
+.LASF87:
+	.string	"div_t"
+.LASF450:
+	.string	"_ZN4xstd7RustRefIKiNS_16borrow_uncheckedEEC4EOS3_"
+.LASF66:
+	.string	"unsigned char"
+.LASF42:
+	.string	"_ZNKSt15__exception_ptr13exception_ptr6_M_getEv"
+.LASF374:
+	.string	"tmpfile"
+.LASF472:
+	.string	"rust_const_read"
+.LASF224:
+	.string	"_IO_write_ptr"
+.LASF319:
+	.string	"thousands_sep"
+.LASF38:
+	.string	"_M_release"
+.LASF133:
+	.string	"strtod"
+.LASF143:
+	.string	"strtof"
+.LASF186:
+	.string	"uint_fast8_t"
+.LASF354:
+	.string	"feof"
+.LASF137:
+	.string	"wcstombs"
+.LASF134:
+	.string	"strtol"
+.LASF255:
+	.string	"fwprintf"
+.LASF127:
+	.string	"mblen"
+.LASF207:
+	.string	"overflow_arg_area"
+.LASF243:
+	.string	"_freeres_list"
+.LASF421:
+	.string	"drop"
+.LASF397:
+	.string	"_ZN4xstd12borrow_stateINS_16borrow_uncheckedEE9end_sliceEv"
+.LASF464:
+	.string	"__default_lock_policy"
+.LASF299:
+	.string	"wctob"
+.LASF43:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4Ev"
+.LASF169:
+	.string	"unseq"
+.LASF241:
+	.string	"_codecvt"
+.LASF200:
+	.string	"tm_wday"
+.LASF164:
+	.string	"unsequenced_policy"
+.LASF8:
+	.string	"value_type"
+.LASF156:
+	.string	"parallel_policy"
+.LASF22:
+	.string	"__adaptor"
+.LASF257:
+	.string	"__isoc99_fwscanf"
+.LASF371:
+	.string	"rewind"
+.LASF196:
+	.string	"tm_hour"
+.LASF70:
+	.string	"signed char"
+.LASF324:
+	.string	"mon_thousands_sep"
+.LASF67:
+	.string	"short unsigned int"
+.LASF194:
+	.string	"tm_sec"
+.LASF92:
+	.string	"lldiv_t"
+.LASF471:
+	.string	"direct_write"
+.LASF121:
+	.string	"atof"
+.LASF7:
+	.string	"integral_constant<bool, true>"
+.LASF165:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy19__allow_unsequencedEv"
+.LASF122:
+	.string	"atoi"
+.LASF332:
+	.string	"n_cs_precedes"
+.LASF221:
+	.string	"_IO_read_end"
+.LASF123:
+	.string	"atol"
+.LASF315:
+	.string	"__max_align_ll"
+.LASF48:
+	.string	"_ZNSt15__exception_ptr13exception_ptraSERKS0_"
+.LASF220:
+	.string	"_IO_read_ptr"
+.LASF290:
+	.string	"wcsncpy"
+.LASF401:
+	.string	"_ZNK4xstd12borrow_stateINS_16borrow_uncheckedEE10check_liveEv"
+.LASF454:
+	.string	"apply<rust_ref_read(CRef)::<lambda(int const&)> >"
+.LASF65:
+	.string	"_S_atomic"
+.LASF75:
+	.string	"double"
+.LASF282:
+	.string	"wcscmp"
+.LASF288:
+	.string	"wcsncat"
+.LASF461:
+	.string	"_ZN4xstd7RustRefIiNS_16borrow_uncheckedEEC2EPNS_7RustObjIKiS1_EE"
+.LASF232:
+	.string	"_chain"
+.LASF466:
+	.string	"__closure"
+.LASF167:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy16__allow_parallelEv"
+.LASF248:
+	.string	"FILE"
+.LASF400:
+	.string	"check_live"
+.LASF377:
+	.string	"wctype_t"
+.LASF268:
+	.string	"swscanf"
+.LASF234:
+	.string	"_flags2"
+.LASF431:
+	.string	"m_obj_p"
+.LASF161:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy19__allow_unsequencedEv"
+.LASF213:
+	.string	"__count"
+.LASF448:
+	.string	"_ZNK4xstd7RustRefIKiNS_16borrow_uncheckedEE12check_usableEv"
+.LASF340:
+	.string	"int_p_sign_posn"
+.LASF481:
+	.string	"typedef __va_list_tag __va_list_tag"
+.LASF305:
+	.string	"wscanf"
+.LASF63:
+	.string	"_S_single"
+.LASF287:
+	.string	"wcslen"
+.LASF113:
+	.string	"__off64_t"
+.LASF247:
+	.string	"_unused2"
+.LASF226:
+	.string	"_IO_buf_base"
+.LASF445:
+	.string	"mapply<rust_ref_write(Ref)::<lambda(int&)> >"
+.LASF455:
+	.string	"ConstObj"
+.LASF64:
+	.string	"_S_mutex"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/relocation"
+.LASF0:
+	.string	"borrow.codegen.cpp"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
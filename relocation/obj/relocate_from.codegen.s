@@ -0,0 +1,9269 @@
+	.file	"relocate_from.codegen.cpp"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/relocation" "relocate_from.codegen.cpp"
+	.p2align 4
+	.globl	memcpy_handle
+	.type	memcpy_handle, @function
+memcpy_handle:
+.LVL0:
+.LFB3263:
+	.file 1 "relocate_from.codegen.cpp"
+	.loc 1 53 1 view -0
+	.cfi_startproc
+	.loc 1 54 3 view .LVU1
+	.loc 1 54 21 is_stmt 0 view .LVU2
+	movdqu	(%rsi), %xmm0
+	.loc 1 53 1 view .LVU3
+	movq	%rdi, %rax
+	.loc 1 54 21 view .LVU4
+	movups	%xmm0, (%rdi)
+	movq	16(%rsi), %rdx
+	movq	%rdx, 16(%rdi)
+	.loc 1 55 1 view .LVU5
+	ret
+	.cfi_endproc
+.LFE3263:
+	.size	memcpy_handle, .-memcpy_handle
+	.p2align 4
+	.globl	relocate_handle
+	.type	relocate_handle, @function
+relocate_handle:
+.LVL1:
+.LFB3264:
+	.loc 1 57 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 58 3 view .LVU7
+.LBB61:
+.LBI61:
+	.file 2 "./relocate_from.h"
+	.loc 2 64 13 view .LVU8
+.LBB62:
+.LBB63:
+.LBI63:
+	.file 3 "./make_uninitialized.h"
+	.loc 3 77 10 view .LVU9
+.LBB64:
+.LBB65:
+.LBI65:
+	.loc 3 38 40 view .LVU10
+.LBB66:
+.LBI66:
+	.loc 3 31 13 view .LVU11
+.LBB67:
+.LBI67:
+	.loc 2 69 10 view .LVU12
+.LBB68:
+	.loc 2 69 44 is_stmt 0 view .LVU13
+	movdqu	(%rsi), %xmm0
+.LBE68:
+.LBE67:
+.LBE66:
+.LBE65:
+.LBE64:
+.LBE63:
+.LBE62:
+.LBE61:
+	.loc 1 57 1 view .LVU14
+	movq	%rdi, %rax
+.LBB76:
+.LBB75:
+.LBB74:
+.LBB73:
+.LBB72:
+.LBB71:
+.LBB70:
+.LBB69:
+	.loc 2 69 44 view .LVU15
+	movups	%xmm0, (%rdi)
+	movq	16(%rsi), %rdx
+	movq	%rdx, 16(%rdi)
+.LVL2:
+	.loc 2 69 44 view .LVU16
+.LBE69:
+.LBE70:
+.LBE71:
+.LBE72:
+.LBE73:
+.LBE74:
+.LBE75:
+.LBE76:
+	.loc 1 59 1 view .LVU17
+	ret
+	.cfi_endproc
+.LFE3264:
+	.size	relocate_handle, .-relocate_handle
+	.p2align 4
+	.globl	memmove_handles
+	.type	memmove_handles, @function
+memmove_handles:
+.LVL3:
+.LFB3266:
+	.loc 1 64 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 65 3 view .LVU19
+	.loc 1 64 1 is_stmt 0 view .LVU20
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 65 51 view .LVU21
+	movq	%rsi, %rbx
+	.loc 1 64 1 view .LVU22
+	movq	%rdx, %rcx
+	.loc 1 65 15 view .LVU23
+	movq	%rdi, %rsi
+.LVL4:
+	.loc 1 65 51 view .LVU24
+	subq	%rdi, %rbx
+.LVL5:
+	.loc 1 65 15 view .LVU25
+	movq	%rcx, %rdi
+.LVL6:
+	.loc 1 65 15 view .LVU26
+	movq	%rbx, %rdx
+.LVL7:
+	.loc 1 65 15 view .LVU27
+	call	memmove@PLT
+.LVL8:
+	.loc 1 66 3 is_stmt 1 view .LVU28
+	.loc 1 66 30 is_stmt 0 view .LVU29
+	leaq	(%rax,%rbx), %rax
+	.loc 1 67 1 view .LVU30
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE3266:
+	.size	memmove_handles, .-memmove_handles
+	.p2align 4
+	.globl	relocate_handles
+	.type	relocate_handles, @function
+relocate_handles:
+.LFB4021:
+	.cfi_startproc
+	.loc 1 68 20 is_stmt 1 view .LVU31
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rsi, %rbx
+	movq	%rdx, %rcx
+	movq	%rdi, %rsi
+	subq	%rdi, %rbx
+	movq	%rcx, %rdi
+	movq	%rbx, %rdx
+	call	memmove@PLT
+	leaq	(%rax,%rbx), %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE4021:
+	.size	relocate_handles, .-relocate_handles
+	.p2align 4
+	.globl	uninit_zeroed
+	.type	uninit_zeroed, @function
+uninit_zeroed:
+.LVL9:
+.LFB3268:
+	.loc 1 75 1 view -0
+	.cfi_startproc
+	.loc 1 76 3 view .LVU33
+.LBB77:
+.LBI77:
+	.loc 3 68 10 view .LVU34
+.LBE77:
+	.loc 1 75 1 is_stmt 0 view .LVU35
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 48
+.LVL10:
+.LBB84:
+.LBB78:
+.LBB79:
+.LBI79:
+	.loc 3 70 31 is_stmt 1 view .LVU36
+	.loc 3 70 31 is_stmt 0 view .LVU37
+.LBE79:
+.LBB80:
+.LBI80:
+	.loc 1 76 43 is_stmt 1 view .LVU38
+.LBB81:
+	.loc 1 76 58 view .LVU39
+	.loc 1 76 62 is_stmt 0 view .LVU40
+	movq	%rsp, %rdi
+.LVL11:
+	.loc 1 76 62 view .LVU41
+	call	fill@PLT
+.LVL12:
+	.loc 1 76 62 view .LVU42
+.LBE81:
+.LBE80:
+	.loc 3 73 16 view .LVU43
+	movdqa	(%rsp), %xmm0
+	movdqa	16(%rsp), %xmm1
+.LBE78:
+.LBE84:
+	.loc 1 77 1 view .LVU44
+	movq	%rbx, %rax
+.LBB85:
+.LBB83:
+	.loc 3 73 16 view .LVU45
+	movups	%xmm0, (%rbx)
+	movups	%xmm1, 16(%rbx)
+.LVL13:
+.LBB82:
+.LBI82:
+	.loc 3 70 41 is_stmt 1 view .LVU46
+	.loc 3 70 41 is_stmt 0 view .LVU47
+.LBE82:
+.LBE83:
+.LBE85:
+	.loc 1 77 1 view .LVU48
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL14:
+	.loc 1 77 1 view .LVU49
+	ret
+	.cfi_endproc
+.LFE3268:
+	.size	uninit_zeroed, .-uninit_zeroed
+	.p2align 4
+	.globl	uninit_filled
+	.type	uninit_filled, @function
+uninit_filled:
+.LVL15:
+.LFB3273:
+	.loc 1 79 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 80 3 view .LVU51
+.LBB96:
+.LBI96:
+	.loc 3 77 10 view .LVU52
+.LBB97:
+.LBB98:
+.LBI98:
+	.loc 3 38 40 view .LVU53
+.LBB99:
+.LBI99:
+	.loc 3 31 13 view .LVU54
+.LBB100:
+.LBI100:
+	.loc 1 80 43 view .LVU55
+.LBB101:
+	.loc 1 80 56 view .LVU56
+.LBE101:
+.LBE100:
+.LBE99:
+.LBE98:
+.LBE97:
+.LBE96:
+	.loc 1 79 1 is_stmt 0 view .LVU57
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 79 1 view .LVU58
+	movq	%rdi, %rbx
+.LBB107:
+.LBB106:
+.LBB105:
+.LBB104:
+.LBB103:
+.LBB102:
+	.loc 1 80 60 view .LVU59
+	call	fill@PLT
+.LVL16:
+	.loc 1 80 60 view .LVU60
+.LBE102:
+.LBE103:
+.LBE104:
+.LBE105:
+.LBE106:
+.LBE107:
+	.loc 1 81 1 view .LVU61
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL17:
+	.loc 1 81 1 view .LVU62
+	ret
+	.cfi_endproc
+.LFE3273:
+	.size	uninit_filled, .-uninit_filled
+.Letext0:
+	.file 4 "/usr/include/c++/12/type_traits"
+	.file 5 "/usr/include/x86_64-linux-gnu/c++/12/bits/c++config.h"
+	.file 6 "/usr/include/c++/12/concepts"
+	.file 7 "/usr/include/c++/12/bits/iterator_concepts.h"
+	.file 8 "/usr/include/c++/12/bits/ranges_cmp.h"
+	.file 9 "/usr/include/c++/12/compare"
+	.file 10 "/usr/include/c++/12/bits/atomic_wait.h"
+	.file 11 "/usr/include/c++/12/debug/debug.h"
+	.file 12 "/usr/include/c++/12/cwchar"
+	.file 13 "/usr/include/c++/12/bits/exception_ptr.h"
+	.file 14 "/usr/include/c++/12/cstdint"
+	.file 15 "/usr/include/c++/12/clocale"
+	.file 16 "/usr/include/c++/12/numbers"
+	.file 17 "/usr/include/c++/12/cstdlib"
+	.file 18 "/usr/include/c++/12/cstdio"
+	.file 19 "/usr/include/c++/12/cwctype"
+	.file 20 "/usr/include/c++/12/bits/shared_ptr_base.h"
+	.file 21 "/usr/include/c++/12/cstddef"
+	.file 22 "/usr/include/c++/12/cstring"
+	.file 23 "/usr/include/c++/12/bits/predefined_ops.h"
+	.file 24 "./relocation_telemetry.h"
+	.file 25 "/usr/include/c++/12/bits/ptr_traits.h"
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 29 "/usr/include/stdint.h"
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 31 "<built-in>"
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/wint_t.h"
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 38 "/usr/include/wchar.h"
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.file 40 "/usr/include/locale.h"
+	.file 41 "/usr/include/stdlib.h"
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.file 45 "/usr/include/stdio.h"
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/wctype-wchar.h"
+	.file 48 "/usr/include/wctype.h"
+	.file 49 "/usr/include/c++/12/pstl/execution_defs.h"
+	.file 50 "/usr/include/string.h"
+	.file 51 "/usr/include/c++/12/system_error"
+	.file 52 "/usr/include/c++/12/ext/concurrence.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2ff2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x49
+	.long	.LASF450
+	.byte	0x21
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x4a
+	.string	"std"
+	.byte	0x5
+	.value	0x128
+	.byte	0xb
+	.long	0x9ef
+	.uleb128 0x14
+	.long	.LASF6
+	.byte	0x1
+	.byte	0x4
+	.byte	0x3e
+	.byte	0xc
+	.long	0xa4
+	.uleb128 0x4
+	.long	.LASF8
+	.byte	0x4
+	.byte	0x41
+	.byte	0x2d
+	.long	0x9ef
+	.uleb128 0x20
+	.long	.LASF2
+	.byte	0x4
+	.byte	0x43
+	.byte	0x11
+	.long	.LASF4
+	.long	0x48
+	.long	0x6c
+	.long	0x72
+	.uleb128 0x7
+	.long	0x9f6
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3
+	.byte	0x4
+	.byte	0x48
+	.byte	0x1c
+	.long	.LASF5
+	.long	0x48
+	.long	0x8a
+	.long	0x90
+	.uleb128 0x7
+	.long	0x9f6
+	.byte	0
+	.uleb128 0x9
+	.string	"_Tp"
+	.long	0x9ef
+	.uleb128 0x35
+	.string	"__v"
+	.long	0x9ef
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x3b
+	.uleb128 0x14
+	.long	.LASF7
+	.byte	0x1
+	.byte	0x4
+	.byte	0x3e
+	.byte	0xc
+	.long	0x112
+	.uleb128 0x4
+	.long	.LASF8
+	.byte	0x4
+	.byte	0x41
+	.byte	0x2d
+	.long	0x9ef
+	.uleb128 0x20
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x43
+	.byte	0x11
+	.long	.LASF10
+	.long	0xb6
+	.long	0xda
+	.long	0xe0
+	.uleb128 0x7
+	.long	0x9fb
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3
+	.byte	0x4
+	.byte	0x48
+	.byte	0x1c
+	.long	.LASF11
+	.long	0xb6
+	.long	0xf8
+	.long	0xfe
+	.uleb128 0x7
+	.long	0x9fb
+	.byte	0
+	.uleb128 0x9
+	.string	"_Tp"
+	.long	0x9ef
+	.uleb128 0x35
+	.string	"__v"
+	.long	0x9ef
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	0xa9
+	.uleb128 0x4
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x55
+	.byte	0x9
+	.long	0x3b
+	.uleb128 0x2f
+	.long	.LASF13
+	.byte	0x5
+	.value	0x12a
+	.byte	0x1a
+	.long	0xa00
+	.uleb128 0xa
+	.long	0x123
+	.uleb128 0x21
+	.long	.LASF14
+	.byte	0x4
+	.value	0xa9f
+	.byte	0xd
+	.uleb128 0x21
+	.long	.LASF15
+	.byte	0x4
+	.value	0xaf5
+	.byte	0xd
+	.uleb128 0x1b
+	.long	.LASF16
+	.byte	0x6
+	.byte	0xa3
+	.byte	0xd
+	.long	0x186
+	.uleb128 0x1a
+	.long	.LASF17
+	.byte	0x6
+	.byte	0xa5
+	.byte	0xf
+	.uleb128 0x4b
+	.long	.LASF27
+	.byte	0x6
+	.byte	0xe1
+	.byte	0x16
+	.uleb128 0x1a
+	.long	.LASF18
+	.byte	0x7
+	.byte	0x50
+	.byte	0xf
+	.uleb128 0x21
+	.long	.LASF19
+	.byte	0x7
+	.value	0x320
+	.byte	0xd
+	.uleb128 0x21
+	.long	.LASF20
+	.byte	0x7
+	.value	0x3a3
+	.byte	0x15
+	.uleb128 0x1a
+	.long	.LASF21
+	.byte	0x8
+	.byte	0x40
+	.byte	0xd
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF22
+	.byte	0x9
+	.byte	0x31
+	.byte	0xd
+	.uleb128 0x1b
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x36
+	.byte	0xd
+	.long	0x1bf
+	.uleb128 0x30
+	.long	.LASF23
+	.byte	0x3d
+	.byte	0x1d
+	.long	0x130
+	.byte	0x4
+	.uleb128 0x30
+	.long	.LASF24
+	.byte	0x91
+	.byte	0x14
+	.long	0xa38
+	.byte	0xc
+	.uleb128 0x30
+	.long	.LASF25
+	.byte	0x92
+	.byte	0x14
+	.long	0xa38
+	.byte	0x10
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF26
+	.byte	0x9
+	.value	0x23b
+	.byte	0xd
+	.uleb128 0x36
+	.long	.LASF28
+	.byte	0x9
+	.value	0x497
+	.byte	0x14
+	.uleb128 0x1a
+	.long	.LASF29
+	.byte	0xb
+	.byte	0x32
+	.byte	0xd
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x52
+	.byte	0x9
+	.long	0xa9
+	.uleb128 0x2f
+	.long	.LASF31
+	.byte	0x5
+	.value	0x12e
+	.byte	0x1d
+	.long	0xfc5
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x40
+	.byte	0xb
+	.long	0x1089
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x8d
+	.byte	0xb
+	.long	0x1019
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x8f
+	.byte	0xb
+	.long	0x123e
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x90
+	.byte	0xb
+	.long	0x1255
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x91
+	.byte	0xb
+	.long	0x1271
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x92
+	.byte	0xb
+	.long	0x1292
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x93
+	.byte	0xb
+	.long	0x12ae
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x94
+	.byte	0xb
+	.long	0x12cf
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x95
+	.byte	0xb
+	.long	0x12eb
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x96
+	.byte	0xb
+	.long	0x1308
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x97
+	.byte	0xb
+	.long	0x1329
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x98
+	.byte	0xb
+	.long	0x1340
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x99
+	.byte	0xb
+	.long	0x134d
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x9a
+	.byte	0xb
+	.long	0x1373
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x9b
+	.byte	0xb
+	.long	0x1399
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x9c
+	.byte	0xb
+	.long	0x13b5
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x9d
+	.byte	0xb
+	.long	0x13e0
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0x9e
+	.byte	0xb
+	.long	0x13fc
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa0
+	.byte	0xb
+	.long	0x1413
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa2
+	.byte	0xb
+	.long	0x1435
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa3
+	.byte	0xb
+	.long	0x1456
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa4
+	.byte	0xb
+	.long	0x1472
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa6
+	.byte	0xb
+	.long	0x1498
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xa9
+	.byte	0xb
+	.long	0x14bd
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xac
+	.byte	0xb
+	.long	0x14e3
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xae
+	.byte	0xb
+	.long	0x1508
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xb0
+	.byte	0xb
+	.long	0x1524
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xb2
+	.byte	0xb
+	.long	0x1544
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xb3
+	.byte	0xb
+	.long	0x1565
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xb4
+	.byte	0xb
+	.long	0x1580
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xb5
+	.byte	0xb
+	.long	0x159b
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xb6
+	.byte	0xb
+	.long	0x15b6
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xb7
+	.byte	0xb
+	.long	0x15d1
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xb8
+	.byte	0xb
+	.long	0x15ec
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xb9
+	.byte	0xb
+	.long	0x16b8
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xba
+	.byte	0xb
+	.long	0x16ce
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xbb
+	.byte	0xb
+	.long	0x16ee
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xbc
+	.byte	0xb
+	.long	0x170e
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xbd
+	.byte	0xb
+	.long	0x172e
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xbe
+	.byte	0xb
+	.long	0x1759
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xbf
+	.byte	0xb
+	.long	0x1774
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xc1
+	.byte	0xb
+	.long	0x1795
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xc3
+	.byte	0xb
+	.long	0x17b1
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xc4
+	.byte	0xb
+	.long	0x17d1
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xc5
+	.byte	0xb
+	.long	0x17f2
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xc6
+	.byte	0xb
+	.long	0x1813
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xc7
+	.byte	0xb
+	.long	0x1833
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xc8
+	.byte	0xb
+	.long	0x184a
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xc9
+	.byte	0xb
+	.long	0x186b
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xca
+	.byte	0xb
+	.long	0x188c
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xcb
+	.byte	0xb
+	.long	0x18ad
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xcc
+	.byte	0xb
+	.long	0x18ce
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xcd
+	.byte	0xb
+	.long	0x18e6
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xce
+	.byte	0xb
+	.long	0x1902
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xce
+	.byte	0xb
+	.long	0x1921
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xcf
+	.byte	0xb
+	.long	0x1940
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xcf
+	.byte	0xb
+	.long	0x195f
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xd0
+	.byte	0xb
+	.long	0x197e
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xd0
+	.byte	0xb
+	.long	0x199d
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xd1
+	.byte	0xb
+	.long	0x19bc
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xd1
+	.byte	0xb
+	.long	0x19db
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xd2
+	.byte	0xb
+	.long	0x19fa
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xd2
+	.byte	0xb
+	.long	0x1a1e
+	.uleb128 0x10
+	.value	0x10b
+	.byte	0x16
+	.long	0x1a42
+	.uleb128 0x10
+	.value	0x10c
+	.byte	0x16
+	.long	0x1a5e
+	.uleb128 0x10
+	.value	0x10d
+	.byte	0x16
+	.long	0x1a7f
+	.uleb128 0x10
+	.value	0x11b
+	.byte	0xe
+	.long	0x1795
+	.uleb128 0x10
+	.value	0x11e
+	.byte	0xe
+	.long	0x1498
+	.uleb128 0x10
+	.value	0x121
+	.byte	0xe
+	.long	0x14e3
+	.uleb128 0x10
+	.value	0x124
+	.byte	0xe
+	.long	0x1524
+	.uleb128 0x10
+	.value	0x128
+	.byte	0xe
+	.long	0x1a42
+	.uleb128 0x10
+	.value	0x129
+	.byte	0xe
+	.long	0x1a5e
+	.uleb128 0x10
+	.value	0x12a
+	.byte	0xe
+	.long	0x1a7f
+	.uleb128 0x1b
+	.long	.LASF32
+	.byte	0xd
+	.byte	0x3f
+	.byte	0xd
+	.long	0x605
+	.uleb128 0x22
+	.long	.LASF33
+	.byte	0x8
+	.byte	0xd
+	.byte	0x5a
+	.byte	0xb
+	.long	0x5f7
+	.uleb128 0x3
+	.long	.LASF161
+	.byte	0xd
+	.byte	0x5c
+	.byte	0xd
+	.long	0xd7e
+	.byte	0
+	.uleb128 0x4c
+	.long	.LASF33
+	.byte	0xd
+	.byte	0x5e
+	.byte	0x10
+	.long	.LASF34
+	.long	0x474
+	.long	0x47f
+	.uleb128 0x7
+	.long	0x1ada
+	.uleb128 0x1
+	.long	0xd7e
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF35
+	.byte	0xd
+	.byte	0x60
+	.byte	0xc
+	.long	.LASF37
+	.long	0x493
+	.long	0x499
+	.uleb128 0x7
+	.long	0x1ada
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF36
+	.byte	0xd
+	.byte	0x61
+	.byte	0xc
+	.long	.LASF38
+	.long	0x4ad
+	.long	0x4b3
+	.uleb128 0x7
+	.long	0x1ada
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF39
+	.byte	0xd
+	.byte	0x63
+	.byte	0xd
+	.long	.LASF40
+	.long	0xd7e
+	.long	0x4cb
+	.long	0x4d1
+	.uleb128 0x7
+	.long	0x1adf
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF33
+	.byte	0x6b
+	.long	.LASF41
+	.long	0x4e3
+	.long	0x4e9
+	.uleb128 0x7
+	.long	0x1ada
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF33
+	.byte	0x6d
+	.long	.LASF42
+	.long	0x4fb
+	.long	0x506
+	.uleb128 0x7
+	.long	0x1ada
+	.uleb128 0x1
+	.long	0x1ae4
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF33
+	.byte	0x70
+	.long	.LASF43
+	.long	0x518
+	.long	0x523
+	.uleb128 0x7
+	.long	0x1ada
+	.uleb128 0x1
+	.long	0x1e5
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF33
+	.byte	0x74
+	.long	.LASF44
+	.long	0x535
+	.long	0x540
+	.uleb128 0x7
+	.long	0x1ada
+	.uleb128 0x1
+	.long	0x1ae9
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF45
+	.byte	0x81
+	.long	.LASF46
+	.long	0x1aee
+	.long	0x556
+	.long	0x561
+	.uleb128 0x7
+	.long	0x1ada
+	.uleb128 0x1
+	.long	0x1ae4
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF45
+	.byte	0x85
+	.long	.LASF47
+	.long	0x1aee
+	.long	0x577
+	.long	0x582
+	.uleb128 0x7
+	.long	0x1ada
+	.uleb128 0x1
+	.long	0x1ae9
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF48
+	.byte	0x8c
+	.long	.LASF49
+	.long	0x594
+	.long	0x59f
+	.uleb128 0x7
+	.long	0x1ada
+	.uleb128 0x7
+	.long	0xa31
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF50
+	.byte	0x8f
+	.long	.LASF51
+	.long	0x5b1
+	.long	0x5bc
+	.uleb128 0x7
+	.long	0x1ada
+	.uleb128 0x1
+	.long	0x1aee
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF451
+	.byte	0xd
+	.byte	0x9b
+	.byte	0x10
+	.long	.LASF452
+	.long	0x9ef
+	.byte	0x1
+	.long	0x5d5
+	.long	0x5db
+	.uleb128 0x7
+	.long	0x1adf
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF52
+	.byte	0xd
+	.byte	0xb0
+	.byte	0x7
+	.long	.LASF53
+	.long	0x1af3
+	.byte	0x1
+	.long	0x5f0
+	.uleb128 0x7
+	.long	0x1adf
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x446
+	.uleb128 0x2
+	.byte	0xd
+	.byte	0x54
+	.byte	0x10
+	.long	0x60d
+	.byte	0
+	.uleb128 0x2
+	.byte	0xd
+	.byte	0x44
+	.byte	0x1a
+	.long	0x446
+	.uleb128 0x4f
+	.long	.LASF54
+	.byte	0xd
+	.byte	0x50
+	.byte	0x8
+	.long	.LASF55
+	.long	0x623
+	.uleb128 0x1
+	.long	0x446
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF453
+	.uleb128 0xa
+	.long	0x623
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x2f
+	.byte	0xb
+	.long	0xe75
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x30
+	.byte	0xb
+	.long	0xe81
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x31
+	.byte	0xb
+	.long	0xe8d
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x32
+	.byte	0xb
+	.long	0xe99
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x34
+	.byte	0xb
+	.long	0xf35
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x35
+	.byte	0xb
+	.long	0xf41
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x36
+	.byte	0xb
+	.long	0xf4d
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x37
+	.byte	0xb
+	.long	0xf59
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x39
+	.byte	0xb
+	.long	0xed5
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x3a
+	.byte	0xb
+	.long	0xee1
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x3b
+	.byte	0xb
+	.long	0xeed
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x3c
+	.byte	0xb
+	.long	0xef9
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x3e
+	.byte	0xb
+	.long	0xfad
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x3f
+	.byte	0xb
+	.long	0xf95
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x41
+	.byte	0xb
+	.long	0xea5
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x42
+	.byte	0xb
+	.long	0xeb1
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x43
+	.byte	0xb
+	.long	0xebd
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x44
+	.byte	0xb
+	.long	0xec9
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x46
+	.byte	0xb
+	.long	0xf65
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x47
+	.byte	0xb
+	.long	0xf71
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x48
+	.byte	0xb
+	.long	0xf7d
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x49
+	.byte	0xb
+	.long	0xf89
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x4b
+	.byte	0xb
+	.long	0xf05
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x4c
+	.byte	0xb
+	.long	0xf11
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x4d
+	.byte	0xb
+	.long	0xf1d
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x4e
+	.byte	0xb
+	.long	0xf29
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x50
+	.byte	0xb
+	.long	0xfb9
+	.uleb128 0x2
+	.byte	0xe
+	.byte	0x51
+	.byte	0xb
+	.long	0xfa1
+	.uleb128 0x2
+	.byte	0xf
+	.byte	0x35
+	.byte	0xb
+	.long	0x1af8
+	.uleb128 0x2
+	.byte	0xf
+	.byte	0x36
+	.byte	0xb
+	.long	0x1c3e
+	.uleb128 0x2
+	.byte	0xf
+	.byte	0x37
+	.byte	0xb
+	.long	0x1c59
+	.uleb128 0x1a
+	.long	.LASF56
+	.byte	0x10
+	.byte	0x30
+	.byte	0xb
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x7f
+	.byte	0xb
+	.long	0x1c99
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x80
+	.byte	0xb
+	.long	0x1ccd
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x86
+	.byte	0xb
+	.long	0x1d33
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x89
+	.byte	0xb
+	.long	0x1d50
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x8c
+	.byte	0xb
+	.long	0x1d6b
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x8d
+	.byte	0xb
+	.long	0x1d81
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x8e
+	.byte	0xb
+	.long	0x1d98
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x8f
+	.byte	0xb
+	.long	0x1daf
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x91
+	.byte	0xb
+	.long	0x1dd9
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x94
+	.byte	0xb
+	.long	0x1df5
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x96
+	.byte	0xb
+	.long	0x1e0c
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x99
+	.byte	0xb
+	.long	0x1e28
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x9a
+	.byte	0xb
+	.long	0x1e44
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x9b
+	.byte	0xb
+	.long	0x1e65
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0x9d
+	.byte	0xb
+	.long	0x1e86
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xa0
+	.byte	0xb
+	.long	0x1ea7
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xa3
+	.byte	0xb
+	.long	0x1eba
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xa5
+	.byte	0xb
+	.long	0x1ec7
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xa6
+	.byte	0xb
+	.long	0x1ed9
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xa7
+	.byte	0xb
+	.long	0x1ef9
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xa8
+	.byte	0xb
+	.long	0x1f19
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xa9
+	.byte	0xb
+	.long	0x1f39
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xab
+	.byte	0xb
+	.long	0x1f50
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xac
+	.byte	0xb
+	.long	0x1f71
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xf0
+	.byte	0x16
+	.long	0x1d01
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xf5
+	.byte	0x16
+	.long	0xad1
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xf6
+	.byte	0x16
+	.long	0x1f8d
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xf8
+	.byte	0x16
+	.long	0x1fa9
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xf9
+	.byte	0x16
+	.long	0x2000
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xfa
+	.byte	0x16
+	.long	0x1fc0
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xfb
+	.byte	0x16
+	.long	0x1fe0
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xfc
+	.byte	0x16
+	.long	0x201b
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x62
+	.byte	0xb
+	.long	0x122d
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x63
+	.byte	0xb
+	.long	0x20ba
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x65
+	.byte	0xb
+	.long	0x20d0
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x66
+	.byte	0xb
+	.long	0x20e2
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x67
+	.byte	0xb
+	.long	0x20f8
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x68
+	.byte	0xb
+	.long	0x210f
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x69
+	.byte	0xb
+	.long	0x2126
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x6a
+	.byte	0xb
+	.long	0x213c
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x6b
+	.byte	0xb
+	.long	0x2153
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x6c
+	.byte	0xb
+	.long	0x2174
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x6d
+	.byte	0xb
+	.long	0x2195
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x71
+	.byte	0xb
+	.long	0x21b1
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x72
+	.byte	0xb
+	.long	0x21d7
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x74
+	.byte	0xb
+	.long	0x21f8
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x75
+	.byte	0xb
+	.long	0x2219
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x76
+	.byte	0xb
+	.long	0x223a
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x78
+	.byte	0xb
+	.long	0x2251
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x79
+	.byte	0xb
+	.long	0x2268
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x7e
+	.byte	0xb
+	.long	0x2274
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x83
+	.byte	0xb
+	.long	0x2286
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x84
+	.byte	0xb
+	.long	0x229c
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x85
+	.byte	0xb
+	.long	0x22b7
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x87
+	.byte	0xb
+	.long	0x22c9
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x88
+	.byte	0xb
+	.long	0x22e0
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x8b
+	.byte	0xb
+	.long	0x2306
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x8d
+	.byte	0xb
+	.long	0x2312
+	.uleb128 0x2
+	.byte	0x12
+	.byte	0x8f
+	.byte	0xb
+	.long	0x2328
+	.uleb128 0x36
+	.long	.LASF57
+	.byte	0x5
+	.value	0x14b
+	.byte	0x41
+	.uleb128 0x51
+	.string	"_V2"
+	.byte	0x33
+	.byte	0x50
+	.byte	0x14
+	.uleb128 0x2
+	.byte	0x13
+	.byte	0x52
+	.byte	0xb
+	.long	0x2350
+	.uleb128 0x2
+	.byte	0x13
+	.byte	0x53
+	.byte	0xb
+	.long	0x2344
+	.uleb128 0x2
+	.byte	0x13
+	.byte	0x54
+	.byte	0xb
+	.long	0x1019
+	.uleb128 0x2
+	.byte	0x13
+	.byte	0x5c
+	.byte	0xb
+	.long	0x2361
+	.uleb128 0x2
+	.byte	0x13
+	.byte	0x65
+	.byte	0xb
+	.long	0x237c
+	.uleb128 0x2
+	.byte	0x13
+	.byte	0x68
+	.byte	0xb
+	.long	0x2397
+	.uleb128 0x2
+	.byte	0x13
+	.byte	0x69
+	.byte	0xb
+	.long	0x23ad
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x62
+	.byte	0x14
+	.long	0xaf0
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x63
+	.byte	0x14
+	.long	0x23c3
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x64
+	.byte	0x14
+	.long	0xb02
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x65
+	.byte	0x14
+	.long	0xb08
+	.uleb128 0x2
+	.byte	0x14
+	.byte	0x66
+	.byte	0x14
+	.long	0xb0e
+	.uleb128 0x2
+	.byte	0x15
+	.byte	0x3a
+	.byte	0xb
+	.long	0x1acc
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x4d
+	.byte	0xb
+	.long	0x2531
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x4d
+	.byte	0xb
+	.long	0x2555
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x54
+	.byte	0xb
+	.long	0x2579
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x57
+	.byte	0xb
+	.long	0x2594
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x5d
+	.byte	0xb
+	.long	0x25ab
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x5e
+	.byte	0xb
+	.long	0x25c7
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x5f
+	.byte	0xb
+	.long	0x25e7
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x5f
+	.byte	0xb
+	.long	0x2606
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x60
+	.byte	0xb
+	.long	0x2625
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x60
+	.byte	0xb
+	.long	0x2645
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x61
+	.byte	0xb
+	.long	0x2665
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x61
+	.byte	0xb
+	.long	0x2685
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x62
+	.byte	0xb
+	.long	0x26a5
+	.uleb128 0x2
+	.byte	0x16
+	.byte	0x62
+	.byte	0xb
+	.long	0x26c5
+	.byte	0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF58
+	.uleb128 0x6
+	.long	0xa4
+	.uleb128 0x6
+	.long	0x112
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF59
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF60
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF61
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF62
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF63
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF64
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF65
+	.uleb128 0x52
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0xa31
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF66
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF67
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x5
+	.long	.LASF68
+	.uleb128 0xa
+	.long	0xa4b
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x7
+	.long	.LASF69
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x10
+	.long	.LASF70
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x10
+	.long	.LASF71
+	.uleb128 0x53
+	.long	.LASF72
+	.byte	0x5
+	.value	0x14d
+	.byte	0xb
+	.long	0xb28
+	.uleb128 0x1a
+	.long	.LASF73
+	.byte	0x17
+	.byte	0x25
+	.byte	0xb
+	.uleb128 0x2
+	.byte	0xc
+	.byte	0xfb
+	.byte	0xb
+	.long	0x1a42
+	.uleb128 0x10
+	.value	0x104
+	.byte	0xb
+	.long	0x1a5e
+	.uleb128 0x10
+	.value	0x105
+	.byte	0xb
+	.long	0x1a7f
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xc8
+	.byte	0xb
+	.long	0x1d01
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xd8
+	.byte	0xb
+	.long	0x1f8d
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xe3
+	.byte	0xb
+	.long	0x1fa9
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xe4
+	.byte	0xb
+	.long	0x1fc0
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xe5
+	.byte	0xb
+	.long	0x1fe0
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xe7
+	.byte	0xb
+	.long	0x2000
+	.uleb128 0x2
+	.byte	0x11
+	.byte	0xe8
+	.byte	0xb
+	.long	0x201b
+	.uleb128 0x54
+	.string	"div"
+	.byte	0x11
+	.byte	0xd5
+	.byte	0x3
+	.long	.LASF454
+	.long	0x1d01
+	.long	0xaf0
+	.uleb128 0x1
+	.long	0xa44
+	.uleb128 0x1
+	.long	0xa44
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF455
+	.byte	0x7
+	.byte	0x4
+	.long	0xa15
+	.byte	0x34
+	.byte	0x31
+	.byte	0x8
+	.long	0xb15
+	.uleb128 0x1d
+	.long	.LASF74
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF75
+	.byte	0x1
+	.uleb128 0x1d
+	.long	.LASF76
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	0xaf0
+	.uleb128 0x56
+	.long	.LASF456
+	.byte	0x34
+	.byte	0x35
+	.byte	0x1d
+	.long	0xb15
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF77
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF78
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF79
+	.uleb128 0x1b
+	.long	.LASF80
+	.byte	0x3
+	.byte	0xd
+	.byte	0xb
+	.long	0xd3c
+	.uleb128 0x27
+	.byte	0x3
+	.byte	0xf
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0x14
+	.long	.LASF81
+	.byte	0x1
+	.byte	0x3
+	.byte	0x18
+	.byte	0x8
+	.long	0xc2a
+	.uleb128 0x15
+	.long	.LASF81
+	.byte	0x3
+	.byte	0x1c
+	.byte	0xd
+	.long	.LASF82
+	.long	0xb72
+	.long	0xb78
+	.uleb128 0x7
+	.long	0xd3c
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF83
+	.byte	0x3
+	.byte	0x21
+	.byte	0xd
+	.long	.LASF84
+	.long	0xb8c
+	.long	0xb97
+	.uleb128 0x7
+	.long	0xd3c
+	.uleb128 0x7
+	.long	0xa31
+	.byte	0
+	.uleb128 0x57
+	.long	.LASF457
+	.byte	0x3
+	.byte	0x23
+	.byte	0x28
+	.long	.LASF458
+	.long	0xb51
+	.uleb128 0x15
+	.long	.LASF85
+	.byte	0x3
+	.byte	0x1f
+	.byte	0xd
+	.long	.LASF86
+	.long	0xbc2
+	.long	0xbcd
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2b5b
+	.uleb128 0x7
+	.long	0xd3c
+	.uleb128 0x1
+	.long	0x2878
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF94
+	.byte	0x3
+	.byte	0x1f
+	.byte	0xd
+	.long	0xbe4
+	.long	0xbef
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2bdb
+	.uleb128 0x7
+	.long	0xd3c
+	.uleb128 0x1
+	.long	0x28ca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF87
+	.byte	0x3
+	.byte	0x26
+	.byte	0x28
+	.long	.LASF88
+	.long	0xb51
+	.long	0xc10
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2b5b
+	.uleb128 0x1
+	.long	0x2878
+	.byte	0
+	.uleb128 0x59
+	.long	.LASF459
+	.byte	0x3
+	.byte	0x26
+	.byte	0x28
+	.long	0xb51
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2bdb
+	.uleb128 0x1
+	.long	0x28ca
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.byte	0x18
+	.byte	0x37
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0x5a
+	.long	.LASF460
+	.byte	0x5
+	.byte	0x4
+	.long	0xa31
+	.byte	0x18
+	.byte	0x3c
+	.byte	0xc
+	.long	0xc57
+	.uleb128 0x1d
+	.long	.LASF89
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF90
+	.byte	0x1
+	.uleb128 0x1d
+	.long	.LASF91
+	.byte	0x2
+	.byte	0
+	.uleb128 0x27
+	.byte	0x2
+	.byte	0x16
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0xc
+	.long	.LASF92
+	.byte	0x3
+	.byte	0x4d
+	.byte	0xa
+	.long	.LASF93
+	.long	0x26e5
+	.long	0xc87
+	.uleb128 0x9
+	.string	"T"
+	.long	0x26e5
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2b5b
+	.uleb128 0x1
+	.long	0x2878
+	.byte	0
+	.uleb128 0x5b
+	.long	.LASF99
+	.byte	0x18
+	.value	0x102
+	.byte	0x10
+	.long	.LASF461
+	.long	0xcaa
+	.uleb128 0x9
+	.string	"T"
+	.long	0x26e5
+	.uleb128 0x1
+	.long	0xc32
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF95
+	.byte	0x4d
+	.long	0x278c
+	.long	0xccc
+	.uleb128 0x9
+	.string	"T"
+	.long	0x278c
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2bdb
+	.uleb128 0x1
+	.long	0x28ca
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF96
+	.byte	0x44
+	.long	0x2761
+	.long	0xcf3
+	.uleb128 0x9
+	.string	"T"
+	.long	0x2761
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2ce8
+	.uleb128 0x1
+	.long	0xced
+	.uleb128 0x23
+	.long	0x2ce8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF97
+	.byte	0x2
+	.byte	0x63
+	.byte	0xe
+	.long	.LASF98
+	.long	0x2757
+	.long	0xd1e
+	.uleb128 0x9
+	.string	"T"
+	.long	0x26e5
+	.uleb128 0x1
+	.long	0x2757
+	.uleb128 0x1
+	.long	0x2757
+	.uleb128 0x1
+	.long	0x2757
+	.byte	0
+	.uleb128 0x5c
+	.long	.LASF100
+	.byte	0x2
+	.byte	0x40
+	.byte	0xd
+	.long	.LASF416
+	.long	0x26e5
+	.uleb128 0x9
+	.string	"T"
+	.long	0x26e5
+	.uleb128 0x1
+	.long	0x2757
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xb51
+	.uleb128 0xa
+	.long	0xd3c
+	.uleb128 0xb
+	.byte	0x10
+	.byte	0x5
+	.long	.LASF101
+	.uleb128 0x1b
+	.long	.LASF102
+	.byte	0x19
+	.byte	0x2b
+	.byte	0xb
+	.long	0xd62
+	.uleb128 0x27
+	.byte	0xb
+	.byte	0x3a
+	.byte	0x18
+	.long	0x1d1
+	.byte	0
+	.uleb128 0x6
+	.long	0xd67
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF103
+	.uleb128 0xa
+	.long	0xd67
+	.uleb128 0x6
+	.long	0xd78
+	.uleb128 0x5d
+	.uleb128 0x6
+	.long	0xa4b
+	.uleb128 0x5e
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF104
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x15
+	.long	0xa23
+	.uleb128 0x4
+	.long	.LASF105
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x17
+	.long	0xa07
+	.uleb128 0x4
+	.long	.LASF106
+	.byte	0x1a
+	.byte	0x27
+	.byte	0x1a
+	.long	0xa2a
+	.uleb128 0x4
+	.long	.LASF107
+	.byte	0x1a
+	.byte	0x28
+	.byte	0x1c
+	.long	0xa0e
+	.uleb128 0x4
+	.long	.LASF108
+	.byte	0x1a
+	.byte	0x29
+	.byte	0x14
+	.long	0xa31
+	.uleb128 0xa
+	.long	0xdb0
+	.uleb128 0x4
+	.long	.LASF109
+	.byte	0x1a
+	.byte	0x2a
+	.byte	0x16
+	.long	0xa15
+	.uleb128 0x4
+	.long	.LASF110
+	.byte	0x1a
+	.byte	0x2c
+	.byte	0x19
+	.long	0xa3d
+	.uleb128 0x4
+	.long	.LASF111
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0x1b
+	.long	0xa00
+	.uleb128 0x4
+	.long	.LASF112
+	.byte	0x1a
+	.byte	0x34
+	.byte	0x12
+	.long	0xd80
+	.uleb128 0x4
+	.long	.LASF113
+	.byte	0x1a
+	.byte	0x35
+	.byte	0x13
+	.long	0xd8c
+	.uleb128 0x4
+	.long	.LASF114
+	.byte	0x1a
+	.byte	0x36
+	.byte	0x13
+	.long	0xd98
+	.uleb128 0x4
+	.long	.LASF115
+	.byte	0x1a
+	.byte	0x37
+	.byte	0x14
+	.long	0xda4
+	.uleb128 0x4
+	.long	.LASF116
+	.byte	0x1a
+	.byte	0x38
+	.byte	0x13
+	.long	0xdb0
+	.uleb128 0x4
+	.long	.LASF117
+	.byte	0x1a
+	.byte	0x39
+	.byte	0x14
+	.long	0xdc1
+	.uleb128 0x4
+	.long	.LASF118
+	.byte	0x1a
+	.byte	0x3a
+	.byte	0x13
+	.long	0xdcd
+	.uleb128 0x4
+	.long	.LASF119
+	.byte	0x1a
+	.byte	0x3b
+	.byte	0x14
+	.long	0xdd9
+	.uleb128 0x4
+	.long	.LASF120
+	.byte	0x1a
+	.byte	0x48
+	.byte	0x12
+	.long	0xa3d
+	.uleb128 0x4
+	.long	.LASF121
+	.byte	0x1a
+	.byte	0x49
+	.byte	0x1b
+	.long	0xa00
+	.uleb128 0x4
+	.long	.LASF122
+	.byte	0x1a
+	.byte	0x98
+	.byte	0x19
+	.long	0xa3d
+	.uleb128 0x4
+	.long	.LASF123
+	.byte	0x1a
+	.byte	0x99
+	.byte	0x1b
+	.long	0xa3d
+	.uleb128 0x4
+	.long	.LASF124
+	.byte	0x1b
+	.byte	0x18
+	.byte	0x12
+	.long	0xd80
+	.uleb128 0x4
+	.long	.LASF125
+	.byte	0x1b
+	.byte	0x19
+	.byte	0x13
+	.long	0xd98
+	.uleb128 0x4
+	.long	.LASF126
+	.byte	0x1b
+	.byte	0x1a
+	.byte	0x13
+	.long	0xdb0
+	.uleb128 0x4
+	.long	.LASF127
+	.byte	0x1b
+	.byte	0x1b
+	.byte	0x13
+	.long	0xdcd
+	.uleb128 0x4
+	.long	.LASF128
+	.byte	0x1c
+	.byte	0x18
+	.byte	0x13
+	.long	0xd8c
+	.uleb128 0x4
+	.long	.LASF129
+	.byte	0x1c
+	.byte	0x19
+	.byte	0x14
+	.long	0xda4
+	.uleb128 0x4
+	.long	.LASF130
+	.byte	0x1c
+	.byte	0x1a
+	.byte	0x14
+	.long	0xdc1
+	.uleb128 0x4
+	.long	.LASF131
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x14
+	.long	0xdd9
+	.uleb128 0x4
+	.long	.LASF132
+	.byte	0x1d
+	.byte	0x2b
+	.byte	0x18
+	.long	0xde5
+	.uleb128 0x4
+	.long	.LASF133
+	.byte	0x1d
+	.byte	0x2c
+	.byte	0x19
+	.long	0xdfd
+	.uleb128 0x4
+	.long	.LASF134
+	.byte	0x1d
+	.byte	0x2d
+	.byte	0x19
+	.long	0xe15
+	.uleb128 0x4
+	.long	.LASF135
+	.byte	0x1d
+	.byte	0x2e
+	.byte	0x19
+	.long	0xe2d
+	.uleb128 0x4
+	.long	.LASF136
+	.byte	0x1d
+	.byte	0x31
+	.byte	0x19
+	.long	0xdf1
+	.uleb128 0x4
+	.long	.LASF137
+	.byte	0x1d
+	.byte	0x32
+	.byte	0x1a
+	.long	0xe09
+	.uleb128 0x4
+	.long	.LASF138
+	.byte	0x1d
+	.byte	0x33
+	.byte	0x1a
+	.long	0xe21
+	.uleb128 0x4
+	.long	.LASF139
+	.byte	0x1d
+	.byte	0x34
+	.byte	0x1a
+	.long	0xe39
+	.uleb128 0x4
+	.long	.LASF140
+	.byte	0x1d
+	.byte	0x3a
+	.byte	0x16
+	.long	0xa23
+	.uleb128 0x4
+	.long	.LASF141
+	.byte	0x1d
+	.byte	0x3c
+	.byte	0x13
+	.long	0xa3d
+	.uleb128 0x4
+	.long	.LASF142
+	.byte	0x1d
+	.byte	0x3d
+	.byte	0x13
+	.long	0xa3d
+	.uleb128 0x4
+	.long	.LASF143
+	.byte	0x1d
+	.byte	0x3e
+	.byte	0x13
+	.long	0xa3d
+	.uleb128 0x4
+	.long	.LASF144
+	.byte	0x1d
+	.byte	0x47
+	.byte	0x18
+	.long	0xa07
+	.uleb128 0x4
+	.long	.LASF145
+	.byte	0x1d
+	.byte	0x49
+	.byte	0x1b
+	.long	0xa00
+	.uleb128 0x4
+	.long	.LASF146
+	.byte	0x1d
+	.byte	0x4a
+	.byte	0x1b
+	.long	0xa00
+	.uleb128 0x4
+	.long	.LASF147
+	.byte	0x1d
+	.byte	0x4b
+	.byte	0x1b
+	.long	0xa00
+	.uleb128 0x4
+	.long	.LASF148
+	.byte	0x1d
+	.byte	0x57
+	.byte	0x13
+	.long	0xa3d
+	.uleb128 0x4
+	.long	.LASF149
+	.byte	0x1d
+	.byte	0x5a
+	.byte	0x1b
+	.long	0xa00
+	.uleb128 0x4
+	.long	.LASF150
+	.byte	0x1d
+	.byte	0x65
+	.byte	0x15
+	.long	0xe45
+	.uleb128 0x4
+	.long	.LASF151
+	.byte	0x1d
+	.byte	0x66
+	.byte	0x16
+	.long	0xe51
+	.uleb128 0x5f
+	.long	.LASF462
+	.uleb128 0xb
+	.byte	0x20
+	.byte	0x3
+	.long	.LASF152
+	.uleb128 0xb
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF153
+	.uleb128 0x4
+	.long	.LASF13
+	.byte	0x1e
+	.byte	0xd6
+	.byte	0x17
+	.long	0xa00
+	.uleb128 0x60
+	.long	.LASF436
+	.byte	0x18
+	.byte	0x1f
+	.byte	0
+	.long	0x1019
+	.uleb128 0x28
+	.long	.LASF154
+	.long	0xa15
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF155
+	.long	0xa15
+	.byte	0x4
+	.uleb128 0x28
+	.long	.LASF156
+	.long	0xd7e
+	.byte	0x8
+	.uleb128 0x28
+	.long	.LASF157
+	.long	0xd7e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF158
+	.byte	0x20
+	.byte	0x14
+	.byte	0x17
+	.long	0xa15
+	.uleb128 0x29
+	.byte	0x8
+	.byte	0x21
+	.byte	0xe
+	.byte	0x1
+	.long	.LASF304
+	.long	0x106d
+	.uleb128 0x61
+	.byte	0x4
+	.byte	0x21
+	.byte	0x11
+	.byte	0x3
+	.long	0x1052
+	.uleb128 0x39
+	.long	.LASF159
+	.byte	0x12
+	.byte	0x13
+	.long	0xa15
+	.uleb128 0x39
+	.long	.LASF160
+	.byte	0x13
+	.byte	0xa
+	.long	0x106d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF162
+	.byte	0x21
+	.byte	0xf
+	.byte	0x7
+	.long	0xa31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF163
+	.byte	0x21
+	.byte	0x14
+	.byte	0x5
+	.long	0x1032
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2a
+	.long	0xd67
+	.long	0x107d
+	.uleb128 0x2b
+	.long	0xa00
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF164
+	.byte	0x21
+	.byte	0x15
+	.byte	0x3
+	.long	0x1025
+	.uleb128 0x4
+	.long	.LASF165
+	.byte	0x22
+	.byte	0x6
+	.byte	0x15
+	.long	0x107d
+	.uleb128 0xa
+	.long	0x1089
+	.uleb128 0x4
+	.long	.LASF166
+	.byte	0x23
+	.byte	0x5
+	.byte	0x19
+	.long	0x10a6
+	.uleb128 0x14
+	.long	.LASF167
+	.byte	0xd8
+	.byte	0x24
+	.byte	0x31
+	.byte	0x8
+	.long	0x122d
+	.uleb128 0x3
+	.long	.LASF168
+	.byte	0x24
+	.byte	0x33
+	.byte	0x7
+	.long	0xa31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF169
+	.byte	0x24
+	.byte	0x36
+	.byte	0x9
+	.long	0xd62
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF170
+	.byte	0x24
+	.byte	0x37
+	.byte	0x9
+	.long	0xd62
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF171
+	.byte	0x24
+	.byte	0x38
+	.byte	0x9
+	.long	0xd62
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF172
+	.byte	0x24
+	.byte	0x39
+	.byte	0x9
+	.long	0xd62
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF173
+	.byte	0x24
+	.byte	0x3a
+	.byte	0x9
+	.long	0xd62
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF174
+	.byte	0x24
+	.byte	0x3b
+	.byte	0x9
+	.long	0xd62
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF175
+	.byte	0x24
+	.byte	0x3c
+	.byte	0x9
+	.long	0xd62
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF176
+	.byte	0x24
+	.byte	0x3d
+	.byte	0x9
+	.long	0xd62
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF177
+	.byte	0x24
+	.byte	0x40
+	.byte	0x9
+	.long	0xd62
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF178
+	.byte	0x24
+	.byte	0x41
+	.byte	0x9
+	.long	0xd62
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF179
+	.byte	0x24
+	.byte	0x42
+	.byte	0x9
+	.long	0xd62
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF180
+	.byte	0x24
+	.byte	0x44
+	.byte	0x16
+	.long	0x2077
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF181
+	.byte	0x24
+	.byte	0x46
+	.byte	0x14
+	.long	0x207c
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF182
+	.byte	0x24
+	.byte	0x48
+	.byte	0x7
+	.long	0xa31
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF183
+	.byte	0x24
+	.byte	0x49
+	.byte	0x7
+	.long	0xa31
+	.byte	0x74
+	.uleb128 0x3
+	.long	.LASF184
+	.byte	0x24
+	.byte	0x4a
+	.byte	0xb
+	.long	0xe5d
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF185
+	.byte	0x24
+	.byte	0x4d
+	.byte	0x12
+	.long	0xa0e
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF186
+	.byte	0x24
+	.byte	0x4e
+	.byte	0xf
+	.long	0xa23
+	.byte	0x82
+	.uleb128 0x3
+	.long	.LASF187
+	.byte	0x24
+	.byte	0x4f
+	.byte	0x8
+	.long	0x2081
+	.byte	0x83
+	.uleb128 0x3
+	.long	.LASF188
+	.byte	0x24
+	.byte	0x51
+	.byte	0xf
+	.long	0x2091
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF189
+	.byte	0x24
+	.byte	0x59
+	.byte	0xd
+	.long	0xe69
+	.byte	0x90
+	.uleb128 0x3
+	.long	.LASF190
+	.byte	0x24
+	.byte	0x5b
+	.byte	0x17
+	.long	0x209b
+	.byte	0x98
+	.uleb128 0x3
+	.long	.LASF191
+	.byte	0x24
+	.byte	0x5c
+	.byte	0x19
+	.long	0x20a5
+	.byte	0xa0
+	.uleb128 0x3
+	.long	.LASF192
+	.byte	0x24
+	.byte	0x5d
+	.byte	0x14
+	.long	0x207c
+	.byte	0xa8
+	.uleb128 0x3
+	.long	.LASF193
+	.byte	0x24
+	.byte	0x5e
+	.byte	0x9
+	.long	0xd7e
+	.byte	0xb0
+	.uleb128 0x3
+	.long	.LASF194
+	.byte	0x24
+	.byte	0x5f
+	.byte	0xa
+	.long	0xfd8
+	.byte	0xb8
+	.uleb128 0x3
+	.long	.LASF195
+	.byte	0x24
+	.byte	0x60
+	.byte	0x7
+	.long	0xa31
+	.byte	0xc0
+	.uleb128 0x3
+	.long	.LASF196
+	.byte	0x24
+	.byte	0x62
+	.byte	0x8
+	.long	0x20aa
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF197
+	.byte	0x25
+	.byte	0x7
+	.byte	0x19
+	.long	0x10a6
+	.uleb128 0x6
+	.long	0xd6e
+	.uleb128 0x5
+	.long	.LASF198
+	.byte	0x26
+	.value	0x13f
+	.byte	0x1
+	.long	0x1019
+	.long	0x1255
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF199
+	.byte	0x26
+	.value	0x2e8
+	.byte	0xf
+	.long	0x1019
+	.long	0x126c
+	.uleb128 0x1
+	.long	0x126c
+	.byte	0
+	.uleb128 0x6
+	.long	0x109a
+	.uleb128 0x5
+	.long	.LASF200
+	.byte	0x26
+	.value	0x305
+	.byte	0x11
+	.long	0xd79
+	.long	0x1292
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0xa31
+	.uleb128 0x1
+	.long	0x126c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF201
+	.byte	0x26
+	.value	0x2f6
+	.byte	0xf
+	.long	0x1019
+	.long	0x12ae
+	.uleb128 0x1
+	.long	0xa4b
+	.uleb128 0x1
+	.long	0x126c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF202
+	.byte	0x26
+	.value	0x30c
+	.byte	0xc
+	.long	0xa31
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x126c
+	.byte	0
+	.uleb128 0x6
+	.long	0xa52
+	.uleb128 0x5
+	.long	.LASF203
+	.byte	0x26
+	.value	0x24c
+	.byte	0xc
+	.long	0xa31
+	.long	0x12eb
+	.uleb128 0x1
+	.long	0x126c
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF204
+	.byte	0x26
+	.value	0x253
+	.byte	0xc
+	.long	0xa31
+	.long	0x1308
+	.uleb128 0x1
+	.long	0x126c
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF205
+	.byte	0x26
+	.value	0x291
+	.byte	0xc
+	.long	.LASF215
+	.long	0xa31
+	.long	0x1329
+	.uleb128 0x1
+	.long	0x126c
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF206
+	.byte	0x26
+	.value	0x2e9
+	.byte	0xf
+	.long	0x1019
+	.long	0x1340
+	.uleb128 0x1
+	.long	0x126c
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF301
+	.byte	0x26
+	.value	0x2ef
+	.byte	0xf
+	.long	0x1019
+	.uleb128 0x5
+	.long	.LASF207
+	.byte	0x26
+	.value	0x14a
+	.byte	0x1
+	.long	0xfd8
+	.long	0x136e
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0x136e
+	.byte	0
+	.uleb128 0x6
+	.long	0x1089
+	.uleb128 0x5
+	.long	.LASF208
+	.byte	0x26
+	.value	0x129
+	.byte	0xf
+	.long	0xfd8
+	.long	0x1399
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0x136e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF209
+	.byte	0x26
+	.value	0x125
+	.byte	0xc
+	.long	0xa31
+	.long	0x13b0
+	.uleb128 0x1
+	.long	0x13b0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1095
+	.uleb128 0x5
+	.long	.LASF210
+	.byte	0x26
+	.value	0x152
+	.byte	0xf
+	.long	0xfd8
+	.long	0x13db
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x13db
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0x136e
+	.byte	0
+	.uleb128 0x6
+	.long	0x1239
+	.uleb128 0x5
+	.long	.LASF211
+	.byte	0x26
+	.value	0x2f7
+	.byte	0xf
+	.long	0x1019
+	.long	0x13fc
+	.uleb128 0x1
+	.long	0xa4b
+	.uleb128 0x1
+	.long	0x126c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF212
+	.byte	0x26
+	.value	0x2fd
+	.byte	0xf
+	.long	0x1019
+	.long	0x1413
+	.uleb128 0x1
+	.long	0xa4b
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF213
+	.byte	0x26
+	.value	0x25d
+	.byte	0xc
+	.long	0xa31
+	.long	0x1435
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF214
+	.byte	0x26
+	.value	0x298
+	.byte	0xc
+	.long	.LASF216
+	.long	0xa31
+	.long	0x1456
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF217
+	.byte	0x26
+	.value	0x314
+	.byte	0xf
+	.long	0x1019
+	.long	0x1472
+	.uleb128 0x1
+	.long	0x1019
+	.uleb128 0x1
+	.long	0x126c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF218
+	.byte	0x26
+	.value	0x265
+	.byte	0xc
+	.long	0xa31
+	.long	0x1493
+	.uleb128 0x1
+	.long	0x126c
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1493
+	.byte	0
+	.uleb128 0x6
+	.long	0xfe4
+	.uleb128 0xf
+	.long	.LASF219
+	.byte	0x26
+	.value	0x2c7
+	.byte	0xc
+	.long	.LASF220
+	.long	0xa31
+	.long	0x14bd
+	.uleb128 0x1
+	.long	0x126c
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1493
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF221
+	.byte	0x26
+	.value	0x272
+	.byte	0xc
+	.long	0xa31
+	.long	0x14e3
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1493
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF222
+	.byte	0x26
+	.value	0x2ce
+	.byte	0xc
+	.long	.LASF223
+	.long	0xa31
+	.long	0x1508
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1493
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF224
+	.byte	0x26
+	.value	0x26d
+	.byte	0xc
+	.long	0xa31
+	.long	0x1524
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1493
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF225
+	.byte	0x26
+	.value	0x2cb
+	.byte	0xc
+	.long	.LASF226
+	.long	0xa31
+	.long	0x1544
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1493
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF227
+	.byte	0x26
+	.value	0x12e
+	.byte	0xf
+	.long	0xfd8
+	.long	0x1565
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0xa4b
+	.uleb128 0x1
+	.long	0x136e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF228
+	.byte	0x26
+	.byte	0x61
+	.byte	0x11
+	.long	0xd79
+	.long	0x1580
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x12ca
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF229
+	.byte	0x26
+	.byte	0x6a
+	.byte	0xc
+	.long	0xa31
+	.long	0x159b
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x12ca
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF230
+	.byte	0x26
+	.byte	0x83
+	.byte	0xc
+	.long	0xa31
+	.long	0x15b6
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x12ca
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF231
+	.byte	0x26
+	.byte	0x57
+	.byte	0x11
+	.long	0xd79
+	.long	0x15d1
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x12ca
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF232
+	.byte	0x26
+	.byte	0xbc
+	.byte	0xf
+	.long	0xfd8
+	.long	0x15ec
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x12ca
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF233
+	.byte	0x26
+	.value	0x354
+	.byte	0xf
+	.long	0xfd8
+	.long	0x1612
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1612
+	.byte	0
+	.uleb128 0x6
+	.long	0x16b3
+	.uleb128 0x62
+	.string	"tm"
+	.byte	0x38
+	.byte	0x27
+	.byte	0x7
+	.byte	0x8
+	.long	0x16b3
+	.uleb128 0x3
+	.long	.LASF234
+	.byte	0x27
+	.byte	0x9
+	.byte	0x7
+	.long	0xa31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF235
+	.byte	0x27
+	.byte	0xa
+	.byte	0x7
+	.long	0xa31
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF236
+	.byte	0x27
+	.byte	0xb
+	.byte	0x7
+	.long	0xa31
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF237
+	.byte	0x27
+	.byte	0xc
+	.byte	0x7
+	.long	0xa31
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF238
+	.byte	0x27
+	.byte	0xd
+	.byte	0x7
+	.long	0xa31
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF239
+	.byte	0x27
+	.byte	0xe
+	.byte	0x7
+	.long	0xa31
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF240
+	.byte	0x27
+	.byte	0xf
+	.byte	0x7
+	.long	0xa31
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF241
+	.byte	0x27
+	.byte	0x10
+	.byte	0x7
+	.long	0xa31
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF242
+	.byte	0x27
+	.byte	0x11
+	.byte	0x7
+	.long	0xa31
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF243
+	.byte	0x27
+	.byte	0x14
+	.byte	0xc
+	.long	0xa3d
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF244
+	.byte	0x27
+	.byte	0x15
+	.byte	0xf
+	.long	0x1239
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.long	0x1617
+	.uleb128 0x8
+	.long	.LASF245
+	.byte	0x26
+	.byte	0xdf
+	.byte	0xf
+	.long	0xfd8
+	.long	0x16ce
+	.uleb128 0x1
+	.long	0x12ca
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF246
+	.byte	0x26
+	.byte	0x65
+	.byte	0x11
+	.long	0xd79
+	.long	0x16ee
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF247
+	.byte	0x26
+	.byte	0x6d
+	.byte	0xc
+	.long	0xa31
+	.long	0x170e
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF248
+	.byte	0x26
+	.byte	0x5c
+	.byte	0x11
+	.long	0xd79
+	.long	0x172e
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF249
+	.byte	0x26
+	.value	0x158
+	.byte	0xf
+	.long	0xfd8
+	.long	0x1754
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0x1754
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0x136e
+	.byte	0
+	.uleb128 0x6
+	.long	0x12ca
+	.uleb128 0x8
+	.long	.LASF250
+	.byte	0x26
+	.byte	0xc0
+	.byte	0xf
+	.long	0xfd8
+	.long	0x1774
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x12ca
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF251
+	.byte	0x26
+	.value	0x17a
+	.byte	0xf
+	.long	0xb2f
+	.long	0x1790
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1790
+	.byte	0
+	.uleb128 0x6
+	.long	0xd79
+	.uleb128 0x5
+	.long	.LASF252
+	.byte	0x26
+	.value	0x17f
+	.byte	0xe
+	.long	0xb36
+	.long	0x17b1
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1790
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF253
+	.byte	0x26
+	.byte	0xda
+	.byte	0x11
+	.long	0xd79
+	.long	0x17d1
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1790
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF254
+	.byte	0x26
+	.value	0x1ad
+	.byte	0x11
+	.long	0xa3d
+	.long	0x17f2
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1790
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF255
+	.byte	0x26
+	.value	0x1b2
+	.byte	0x1a
+	.long	0xa00
+	.long	0x1813
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1790
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF256
+	.byte	0x26
+	.byte	0x87
+	.byte	0xf
+	.long	0xfd8
+	.long	0x1833
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF257
+	.byte	0x26
+	.value	0x145
+	.byte	0x1
+	.long	0xa31
+	.long	0x184a
+	.uleb128 0x1
+	.long	0x1019
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF258
+	.byte	0x26
+	.value	0x103
+	.byte	0xc
+	.long	0xa31
+	.long	0x186b
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF259
+	.byte	0x26
+	.value	0x107
+	.byte	0x11
+	.long	0xd79
+	.long	0x188c
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF260
+	.byte	0x26
+	.value	0x10c
+	.byte	0x11
+	.long	0xd79
+	.long	0x18ad
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF261
+	.byte	0x26
+	.value	0x110
+	.byte	0x11
+	.long	0xd79
+	.long	0x18ce
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0xa4b
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF262
+	.byte	0x26
+	.value	0x25a
+	.byte	0xc
+	.long	0xa31
+	.long	0x18e6
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF263
+	.byte	0x26
+	.value	0x295
+	.byte	0xc
+	.long	.LASF264
+	.long	0xa31
+	.long	0x1902
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF265
+	.byte	0x26
+	.byte	0xa2
+	.byte	0x1d
+	.long	.LASF265
+	.long	0x12ca
+	.long	0x1921
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0xa4b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF265
+	.byte	0x26
+	.byte	0xa0
+	.byte	0x17
+	.long	.LASF265
+	.long	0xd79
+	.long	0x1940
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0xa4b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF266
+	.byte	0x26
+	.byte	0xc6
+	.byte	0x1d
+	.long	.LASF266
+	.long	0x12ca
+	.long	0x195f
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x12ca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF266
+	.byte	0x26
+	.byte	0xc4
+	.byte	0x17
+	.long	.LASF266
+	.long	0xd79
+	.long	0x197e
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x12ca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF267
+	.byte	0x26
+	.byte	0xac
+	.byte	0x1d
+	.long	.LASF267
+	.long	0x12ca
+	.long	0x199d
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0xa4b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF267
+	.byte	0x26
+	.byte	0xaa
+	.byte	0x17
+	.long	.LASF267
+	.long	0xd79
+	.long	0x19bc
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0xa4b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF268
+	.byte	0x26
+	.byte	0xd1
+	.byte	0x1d
+	.long	.LASF268
+	.long	0x12ca
+	.long	0x19db
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x12ca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF268
+	.byte	0x26
+	.byte	0xcf
+	.byte	0x17
+	.long	.LASF268
+	.long	0xd79
+	.long	0x19fa
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x12ca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF269
+	.byte	0x26
+	.byte	0xfa
+	.byte	0x1d
+	.long	.LASF269
+	.long	0x12ca
+	.long	0x1a1e
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0xa4b
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF269
+	.byte	0x26
+	.byte	0xf8
+	.byte	0x17
+	.long	.LASF269
+	.long	0xd79
+	.long	0x1a42
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0xa4b
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF270
+	.byte	0x26
+	.value	0x181
+	.byte	0x14
+	.long	0xb28
+	.long	0x1a5e
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1790
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF271
+	.byte	0x26
+	.value	0x1ba
+	.byte	0x16
+	.long	0xa44
+	.long	0x1a7f
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1790
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF272
+	.byte	0x26
+	.value	0x1c1
+	.byte	0x1f
+	.long	0xa1c
+	.long	0x1aa0
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0x1790
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x63
+	.byte	0x20
+	.byte	0x10
+	.byte	0x1e
+	.value	0x1a8
+	.byte	0x10
+	.long	.LASF463
+	.long	0x1acc
+	.uleb128 0x3b
+	.long	.LASF273
+	.value	0x1a9
+	.byte	0xd
+	.long	0xa44
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF274
+	.value	0x1aa
+	.byte	0xf
+	.long	0xb28
+	.byte	0x10
+	.byte	0x10
+	.byte	0
+	.uleb128 0x64
+	.long	.LASF464
+	.byte	0x1e
+	.value	0x1b3
+	.byte	0x3
+	.long	0x1aa0
+	.byte	0x10
+	.uleb128 0x6
+	.long	0x446
+	.uleb128 0x6
+	.long	0x5f7
+	.uleb128 0x16
+	.long	0x5f7
+	.uleb128 0x23
+	.long	0x446
+	.uleb128 0x16
+	.long	0x446
+	.uleb128 0x6
+	.long	0x628
+	.uleb128 0x14
+	.long	.LASF275
+	.byte	0x60
+	.byte	0x28
+	.byte	0x33
+	.byte	0x8
+	.long	0x1c3e
+	.uleb128 0x3
+	.long	.LASF276
+	.byte	0x28
+	.byte	0x37
+	.byte	0x9
+	.long	0xd62
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF277
+	.byte	0x28
+	.byte	0x38
+	.byte	0x9
+	.long	0xd62
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF278
+	.byte	0x28
+	.byte	0x3e
+	.byte	0x9
+	.long	0xd62
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF279
+	.byte	0x28
+	.byte	0x44
+	.byte	0x9
+	.long	0xd62
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF280
+	.byte	0x28
+	.byte	0x45
+	.byte	0x9
+	.long	0xd62
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF281
+	.byte	0x28
+	.byte	0x46
+	.byte	0x9
+	.long	0xd62
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF282
+	.byte	0x28
+	.byte	0x47
+	.byte	0x9
+	.long	0xd62
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF283
+	.byte	0x28
+	.byte	0x48
+	.byte	0x9
+	.long	0xd62
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF284
+	.byte	0x28
+	.byte	0x49
+	.byte	0x9
+	.long	0xd62
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF285
+	.byte	0x28
+	.byte	0x4a
+	.byte	0x9
+	.long	0xd62
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF286
+	.byte	0x28
+	.byte	0x4b
+	.byte	0x8
+	.long	0xd67
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF287
+	.byte	0x28
+	.byte	0x4c
+	.byte	0x8
+	.long	0xd67
+	.byte	0x51
+	.uleb128 0x3
+	.long	.LASF288
+	.byte	0x28
+	.byte	0x4e
+	.byte	0x8
+	.long	0xd67
+	.byte	0x52
+	.uleb128 0x3
+	.long	.LASF289
+	.byte	0x28
+	.byte	0x50
+	.byte	0x8
+	.long	0xd67
+	.byte	0x53
+	.uleb128 0x3
+	.long	.LASF290
+	.byte	0x28
+	.byte	0x52
+	.byte	0x8
+	.long	0xd67
+	.byte	0x54
+	.uleb128 0x3
+	.long	.LASF291
+	.byte	0x28
+	.byte	0x54
+	.byte	0x8
+	.long	0xd67
+	.byte	0x55
+	.uleb128 0x3
+	.long	.LASF292
+	.byte	0x28
+	.byte	0x5b
+	.byte	0x8
+	.long	0xd67
+	.byte	0x56
+	.uleb128 0x3
+	.long	.LASF293
+	.byte	0x28
+	.byte	0x5c
+	.byte	0x8
+	.long	0xd67
+	.byte	0x57
+	.uleb128 0x3
+	.long	.LASF294
+	.byte	0x28
+	.byte	0x5f
+	.byte	0x8
+	.long	0xd67
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF295
+	.byte	0x28
+	.byte	0x61
+	.byte	0x8
+	.long	0xd67
+	.byte	0x59
+	.uleb128 0x3
+	.long	.LASF296
+	.byte	0x28
+	.byte	0x63
+	.byte	0x8
+	.long	0xd67
+	.byte	0x5a
+	.uleb128 0x3
+	.long	.LASF297
+	.byte	0x28
+	.byte	0x65
+	.byte	0x8
+	.long	0xd67
+	.byte	0x5b
+	.uleb128 0x3
+	.long	.LASF298
+	.byte	0x28
+	.byte	0x6c
+	.byte	0x8
+	.long	0xd67
+	.byte	0x5c
+	.uleb128 0x3
+	.long	.LASF299
+	.byte	0x28
+	.byte	0x6d
+	.byte	0x8
+	.long	0xd67
+	.byte	0x5d
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF300
+	.byte	0x28
+	.byte	0x7a
+	.byte	0xe
+	.long	0xd62
+	.long	0x1c59
+	.uleb128 0x1
+	.long	0xa31
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF302
+	.byte	0x28
+	.byte	0x7d
+	.byte	0x16
+	.long	0x1c65
+	.uleb128 0x6
+	.long	0x1af8
+	.uleb128 0xb
+	.byte	0x10
+	.byte	0x7
+	.long	.LASF303
+	.uleb128 0x29
+	.byte	0x8
+	.byte	0x29
+	.byte	0x3c
+	.byte	0x3
+	.long	.LASF305
+	.long	0x1c99
+	.uleb128 0x3
+	.long	.LASF306
+	.byte	0x29
+	.byte	0x3d
+	.byte	0x9
+	.long	0xa31
+	.byte	0
+	.uleb128 0x24
+	.string	"rem"
+	.byte	0x29
+	.byte	0x3e
+	.byte	0x9
+	.long	0xa31
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF307
+	.byte	0x29
+	.byte	0x3f
+	.byte	0x5
+	.long	0x1c71
+	.uleb128 0x29
+	.byte	0x10
+	.byte	0x29
+	.byte	0x44
+	.byte	0x3
+	.long	.LASF308
+	.long	0x1ccd
+	.uleb128 0x3
+	.long	.LASF306
+	.byte	0x29
+	.byte	0x45
+	.byte	0xe
+	.long	0xa3d
+	.byte	0
+	.uleb128 0x24
+	.string	"rem"
+	.byte	0x29
+	.byte	0x46
+	.byte	0xe
+	.long	0xa3d
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF309
+	.byte	0x29
+	.byte	0x47
+	.byte	0x5
+	.long	0x1ca5
+	.uleb128 0x29
+	.byte	0x10
+	.byte	0x29
+	.byte	0x4e
+	.byte	0x3
+	.long	.LASF310
+	.long	0x1d01
+	.uleb128 0x3
+	.long	.LASF306
+	.byte	0x29
+	.byte	0x4f
+	.byte	0x13
+	.long	0xa44
+	.byte	0
+	.uleb128 0x24
+	.string	"rem"
+	.byte	0x29
+	.byte	0x50
+	.byte	0x13
+	.long	0xa44
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF311
+	.byte	0x29
+	.byte	0x51
+	.byte	0x5
+	.long	0x1cd9
+	.uleb128 0x2f
+	.long	.LASF312
+	.byte	0x29
+	.value	0x33d
+	.byte	0xf
+	.long	0x1d1a
+	.uleb128 0x6
+	.long	0x1d1f
+	.uleb128 0x25
+	.long	0xa31
+	.long	0x1d33
+	.uleb128 0x1
+	.long	0xd73
+	.uleb128 0x1
+	.long	0xd73
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF313
+	.byte	0x29
+	.value	0x267
+	.byte	0xc
+	.long	0xa31
+	.long	0x1d4a
+	.uleb128 0x1
+	.long	0x1d4a
+	.byte	0
+	.uleb128 0x6
+	.long	0x1d4f
+	.uleb128 0x65
+	.uleb128 0xf
+	.long	.LASF314
+	.byte	0x29
+	.value	0x26c
+	.byte	0x12
+	.long	.LASF314
+	.long	0xa31
+	.long	0x1d6b
+	.uleb128 0x1
+	.long	0x1d4a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF315
+	.byte	0x2a
+	.byte	0x19
+	.byte	0x1
+	.long	0xb2f
+	.long	0x1d81
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF316
+	.byte	0x29
+	.value	0x16a
+	.byte	0x1
+	.long	0xa31
+	.long	0x1d98
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF317
+	.byte	0x29
+	.value	0x16f
+	.byte	0x1
+	.long	0xa3d
+	.long	0x1daf
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF318
+	.byte	0x2b
+	.byte	0x14
+	.byte	0x1
+	.long	0xd7e
+	.long	0x1dd9
+	.uleb128 0x1
+	.long	0xd73
+	.uleb128 0x1
+	.long	0xd73
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0x1d0d
+	.byte	0
+	.uleb128 0x66
+	.string	"div"
+	.byte	0x29
+	.value	0x369
+	.byte	0xe
+	.long	0x1c99
+	.long	0x1df5
+	.uleb128 0x1
+	.long	0xa31
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF319
+	.byte	0x29
+	.value	0x28e
+	.byte	0xe
+	.long	0xd62
+	.long	0x1e0c
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF320
+	.byte	0x29
+	.value	0x36b
+	.byte	0xf
+	.long	0x1ccd
+	.long	0x1e28
+	.uleb128 0x1
+	.long	0xa3d
+	.uleb128 0x1
+	.long	0xa3d
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF321
+	.byte	0x29
+	.value	0x3af
+	.byte	0xc
+	.long	0xa31
+	.long	0x1e44
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF322
+	.byte	0x29
+	.value	0x3ba
+	.byte	0xf
+	.long	0xfd8
+	.long	0x1e65
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF323
+	.byte	0x29
+	.value	0x3b2
+	.byte	0xc
+	.long	0xa31
+	.long	0x1e86
+	.uleb128 0x1
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF326
+	.byte	0x29
+	.value	0x353
+	.long	0x1ea7
+	.uleb128 0x1
+	.long	0xd7e
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0x1d0d
+	.byte	0
+	.uleb128 0x67
+	.long	.LASF324
+	.byte	0x29
+	.value	0x283
+	.byte	0xd
+	.long	0x1eba
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF325
+	.byte	0x29
+	.value	0x1c6
+	.byte	0xc
+	.long	0xa31
+	.uleb128 0x1f
+	.long	.LASF327
+	.byte	0x29
+	.value	0x1c8
+	.long	0x1ed9
+	.uleb128 0x1
+	.long	0xa15
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF328
+	.byte	0x29
+	.byte	0x76
+	.byte	0xf
+	.long	0xb2f
+	.long	0x1ef4
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1ef4
+	.byte	0
+	.uleb128 0x6
+	.long	0xd62
+	.uleb128 0x8
+	.long	.LASF329
+	.byte	0x29
+	.byte	0xb1
+	.byte	0x11
+	.long	0xa3d
+	.long	0x1f19
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1ef4
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF330
+	.byte	0x29
+	.byte	0xb5
+	.byte	0x1a
+	.long	0xa00
+	.long	0x1f39
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1ef4
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF331
+	.byte	0x29
+	.value	0x324
+	.byte	0xc
+	.long	0xa31
+	.long	0x1f50
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF332
+	.byte	0x29
+	.value	0x3be
+	.byte	0xf
+	.long	0xfd8
+	.long	0x1f71
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0x12ca
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF333
+	.byte	0x29
+	.value	0x3b6
+	.byte	0xc
+	.long	0xa31
+	.long	0x1f8d
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0xa4b
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF334
+	.byte	0x29
+	.value	0x36f
+	.byte	0x1e
+	.long	0x1d01
+	.long	0x1fa9
+	.uleb128 0x1
+	.long	0xa44
+	.uleb128 0x1
+	.long	0xa44
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF335
+	.byte	0x29
+	.value	0x176
+	.byte	0x1
+	.long	0xa44
+	.long	0x1fc0
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF336
+	.byte	0x29
+	.byte	0xc9
+	.byte	0x16
+	.long	0xa44
+	.long	0x1fe0
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1ef4
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF337
+	.byte	0x29
+	.byte	0xce
+	.byte	0x1f
+	.long	0xa1c
+	.long	0x2000
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1ef4
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF338
+	.byte	0x29
+	.byte	0x7c
+	.byte	0xe
+	.long	0xb36
+	.long	0x201b
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1ef4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF339
+	.byte	0x29
+	.byte	0x7f
+	.byte	0x14
+	.long	0xb28
+	.long	0x2036
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1ef4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF340
+	.byte	0x10
+	.byte	0x2c
+	.byte	0xa
+	.byte	0x10
+	.long	0x205e
+	.uleb128 0x3
+	.long	.LASF341
+	.byte	0x2c
+	.byte	0xc
+	.byte	0xb
+	.long	0xe5d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF342
+	.byte	0x2c
+	.byte	0xd
+	.byte	0xf
+	.long	0x107d
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF343
+	.byte	0x2c
+	.byte	0xe
+	.byte	0x3
+	.long	0x2036
+	.uleb128 0x68
+	.long	.LASF465
+	.byte	0x24
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x32
+	.long	.LASF344
+	.uleb128 0x6
+	.long	0x2072
+	.uleb128 0x6
+	.long	0x10a6
+	.uleb128 0x2a
+	.long	0xd67
+	.long	0x2091
+	.uleb128 0x2b
+	.long	0xa00
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x206a
+	.uleb128 0x32
+	.long	.LASF345
+	.uleb128 0x6
+	.long	0x2096
+	.uleb128 0x32
+	.long	.LASF346
+	.uleb128 0x6
+	.long	0x20a0
+	.uleb128 0x2a
+	.long	0xd67
+	.long	0x20ba
+	.uleb128 0x2b
+	.long	0xa00
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF347
+	.byte	0x2d
+	.byte	0x54
+	.byte	0x12
+	.long	0x205e
+	.uleb128 0xa
+	.long	0x20ba
+	.uleb128 0x6
+	.long	0x122d
+	.uleb128 0x1f
+	.long	.LASF348
+	.byte	0x2d
+	.value	0x312
+	.long	0x20e2
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF349
+	.byte	0x2d
+	.byte	0xb2
+	.byte	0xc
+	.long	0xa31
+	.long	0x20f8
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF350
+	.byte	0x2d
+	.value	0x314
+	.byte	0xc
+	.long	0xa31
+	.long	0x210f
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF351
+	.byte	0x2d
+	.value	0x316
+	.byte	0xc
+	.long	0xa31
+	.long	0x2126
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF352
+	.byte	0x2d
+	.byte	0xe6
+	.byte	0xc
+	.long	0xa31
+	.long	0x213c
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF353
+	.byte	0x2d
+	.value	0x201
+	.byte	0xc
+	.long	0xa31
+	.long	0x2153
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF354
+	.byte	0x2d
+	.value	0x2f8
+	.byte	0xc
+	.long	0xa31
+	.long	0x216f
+	.uleb128 0x1
+	.long	0x20cb
+	.uleb128 0x1
+	.long	0x216f
+	.byte	0
+	.uleb128 0x6
+	.long	0x20ba
+	.uleb128 0x5
+	.long	.LASF355
+	.byte	0x2d
+	.value	0x250
+	.byte	0xe
+	.long	0xd62
+	.long	0x2195
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0xa31
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF356
+	.byte	0x2d
+	.value	0x102
+	.byte	0xe
+	.long	0x20cb
+	.long	0x21b1
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF357
+	.byte	0x2d
+	.value	0x2a3
+	.byte	0xf
+	.long	0xfd8
+	.long	0x21d7
+	.uleb128 0x1
+	.long	0xd7e
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0xfd8
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF358
+	.byte	0x2d
+	.value	0x109
+	.byte	0xe
+	.long	0x20cb
+	.long	0x21f8
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF359
+	.byte	0x2d
+	.value	0x2c9
+	.byte	0xc
+	.long	0xa31
+	.long	0x2219
+	.uleb128 0x1
+	.long	0x20cb
+	.uleb128 0x1
+	.long	0xa3d
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF360
+	.byte	0x2d
+	.value	0x2fd
+	.byte	0xc
+	.long	0xa31
+	.long	0x2235
+	.uleb128 0x1
+	.long	0x20cb
+	.uleb128 0x1
+	.long	0x2235
+	.byte	0
+	.uleb128 0x6
+	.long	0x20c6
+	.uleb128 0x5
+	.long	.LASF361
+	.byte	0x2d
+	.value	0x2ce
+	.byte	0x11
+	.long	0xa3d
+	.long	0x2251
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF362
+	.byte	0x2d
+	.value	0x202
+	.byte	0xc
+	.long	0xa31
+	.long	0x2268
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF363
+	.byte	0x2e
+	.byte	0x2f
+	.byte	0x1
+	.long	0xa31
+	.uleb128 0x1f
+	.long	.LASF364
+	.byte	0x2d
+	.value	0x324
+	.long	0x2286
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF365
+	.byte	0x2d
+	.byte	0x98
+	.byte	0xc
+	.long	0xa31
+	.long	0x229c
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF366
+	.byte	0x2d
+	.byte	0x9a
+	.byte	0xc
+	.long	0xa31
+	.long	0x22b7
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF367
+	.byte	0x2d
+	.value	0x2d3
+	.long	0x22c9
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF368
+	.byte	0x2d
+	.value	0x148
+	.long	0x22e0
+	.uleb128 0x1
+	.long	0x20cb
+	.uleb128 0x1
+	.long	0xd62
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF369
+	.byte	0x2d
+	.value	0x14c
+	.byte	0xc
+	.long	0xa31
+	.long	0x2306
+	.uleb128 0x1
+	.long	0x20cb
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0xa31
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF370
+	.byte	0x2d
+	.byte	0xbc
+	.byte	0xe
+	.long	0x20cb
+	.uleb128 0x8
+	.long	.LASF371
+	.byte	0x2d
+	.byte	0xcd
+	.byte	0xe
+	.long	0xd62
+	.long	0x2328
+	.uleb128 0x1
+	.long	0xd62
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF372
+	.byte	0x2d
+	.value	0x29c
+	.byte	0xc
+	.long	0xa31
+	.long	0x2344
+	.uleb128 0x1
+	.long	0xa31
+	.uleb128 0x1
+	.long	0x20cb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF373
+	.byte	0x2f
+	.byte	0x26
+	.byte	0x1b
+	.long	0xa00
+	.uleb128 0x4
+	.long	.LASF374
+	.byte	0x30
+	.byte	0x30
+	.byte	0x1a
+	.long	0x235c
+	.uleb128 0x6
+	.long	0xdbc
+	.uleb128 0x8
+	.long	.LASF375
+	.byte	0x2f
+	.byte	0x9f
+	.byte	0xc
+	.long	0xa31
+	.long	0x237c
+	.uleb128 0x1
+	.long	0x1019
+	.uleb128 0x1
+	.long	0x2344
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF376
+	.byte	0x30
+	.byte	0x37
+	.byte	0xf
+	.long	0x1019
+	.long	0x2397
+	.uleb128 0x1
+	.long	0x1019
+	.uleb128 0x1
+	.long	0x2350
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF377
+	.byte	0x30
+	.byte	0x34
+	.byte	0x12
+	.long	0x2350
+	.long	0x23ad
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF378
+	.byte	0x2f
+	.byte	0x9b
+	.byte	0x11
+	.long	0x2344
+	.long	0x23c3
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x17
+	.long	0xb1a
+	.uleb128 0x17
+	.long	0x19a
+	.uleb128 0x17
+	.long	0x1a6
+	.uleb128 0x17
+	.long	0x1b2
+	.uleb128 0x1b
+	.long	.LASF379
+	.byte	0x31
+	.byte	0xf
+	.byte	0xb
+	.long	0x251d
+	.uleb128 0x69
+	.long	.LASF466
+	.byte	0x31
+	.byte	0x11
+	.byte	0xb
+	.uleb128 0x6a
+	.string	"v1"
+	.byte	0x31
+	.byte	0x13
+	.byte	0x12
+	.uleb128 0x22
+	.long	.LASF380
+	.byte	0x1
+	.byte	0x31
+	.byte	0x17
+	.byte	0x7
+	.long	0x242a
+	.uleb128 0x11
+	.long	.LASF381
+	.byte	0x1c
+	.long	.LASF383
+	.long	0x117
+	.uleb128 0x11
+	.long	.LASF382
+	.byte	0x21
+	.long	.LASF384
+	.long	0x117
+	.uleb128 0x11
+	.long	.LASF385
+	.byte	0x26
+	.long	.LASF386
+	.long	0x117
+	.byte	0
+	.uleb128 0xa
+	.long	0x23f2
+	.uleb128 0x22
+	.long	.LASF387
+	.byte	0x1
+	.byte	0x31
+	.byte	0x2d
+	.byte	0x7
+	.long	0x2467
+	.uleb128 0x11
+	.long	.LASF381
+	.byte	0x32
+	.long	.LASF388
+	.long	0x117
+	.uleb128 0x11
+	.long	.LASF382
+	.byte	0x37
+	.long	.LASF389
+	.long	0x117
+	.uleb128 0x11
+	.long	.LASF385
+	.byte	0x3c
+	.long	.LASF390
+	.long	0x1d9
+	.byte	0
+	.uleb128 0xa
+	.long	0x242f
+	.uleb128 0x22
+	.long	.LASF391
+	.byte	0x1
+	.byte	0x31
+	.byte	0x43
+	.byte	0x7
+	.long	0x24a4
+	.uleb128 0x11
+	.long	.LASF381
+	.byte	0x48
+	.long	.LASF392
+	.long	0x1d9
+	.uleb128 0x11
+	.long	.LASF382
+	.byte	0x4d
+	.long	.LASF393
+	.long	0x1d9
+	.uleb128 0x11
+	.long	.LASF385
+	.byte	0x52
+	.long	.LASF394
+	.long	0x1d9
+	.byte	0
+	.uleb128 0xa
+	.long	0x246c
+	.uleb128 0x22
+	.long	.LASF395
+	.byte	0x1
+	.byte	0x31
+	.byte	0x58
+	.byte	0x7
+	.long	0x24e1
+	.uleb128 0x11
+	.long	.LASF381
+	.byte	0x5d
+	.long	.LASF396
+	.long	0x1d9
+	.uleb128 0x11
+	.long	.LASF382
+	.byte	0x62
+	.long	.LASF397
+	.long	0x1d9
+	.uleb128 0x11
+	.long	.LASF385
+	.byte	0x67
+	.long	.LASF398
+	.long	0x117
+	.byte	0
+	.uleb128 0xa
+	.long	0x24a9
+	.uleb128 0x3c
+	.string	"seq"
+	.byte	0x6e
+	.byte	0x1c
+	.long	0x242a
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3c
+	.string	"par"
+	.byte	0x6f
+	.byte	0x1b
+	.long	0x2467
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF399
+	.byte	0x70
+	.byte	0x27
+	.long	0x24a4
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF400
+	.byte	0x71
+	.byte	0x1e
+	.long	0x24e1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x24e6
+	.uleb128 0x17
+	.long	0x24f3
+	.uleb128 0x17
+	.long	0x2500
+	.uleb128 0x17
+	.long	0x250d
+	.uleb128 0xc
+	.long	.LASF401
+	.byte	0x32
+	.byte	0x64
+	.byte	0x1
+	.long	.LASF401
+	.long	0xd73
+	.long	0x2555
+	.uleb128 0x1
+	.long	0xd73
+	.uleb128 0x1
+	.long	0xa31
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF401
+	.byte	0x32
+	.byte	0x5e
+	.byte	0x1
+	.long	.LASF401
+	.long	0xd7e
+	.long	0x2579
+	.uleb128 0x1
+	.long	0xd7e
+	.uleb128 0x1
+	.long	0xa31
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF402
+	.byte	0x32
+	.byte	0xa3
+	.byte	0xc
+	.long	0xa31
+	.long	0x2594
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF403
+	.byte	0x32
+	.value	0x1a3
+	.byte	0xe
+	.long	0xd62
+	.long	0x25ab
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF404
+	.byte	0x32
+	.value	0x164
+	.byte	0xe
+	.long	0xd62
+	.long	0x25c7
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF405
+	.byte	0x32
+	.byte	0xa6
+	.byte	0xf
+	.long	0xfd8
+	.long	0x25e7
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF406
+	.byte	0x32
+	.byte	0xef
+	.byte	0x1
+	.long	.LASF406
+	.long	0x1239
+	.long	0x2606
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF406
+	.byte	0x32
+	.byte	0xe9
+	.byte	0x1
+	.long	.LASF406
+	.long	0xd62
+	.long	0x2625
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF407
+	.byte	0x32
+	.value	0x13c
+	.byte	0x1
+	.long	.LASF407
+	.long	0x1239
+	.long	0x2645
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF407
+	.byte	0x32
+	.value	0x136
+	.byte	0x1
+	.long	.LASF407
+	.long	0xd62
+	.long	0x2665
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF408
+	.byte	0x32
+	.value	0x10a
+	.byte	0x1
+	.long	.LASF408
+	.long	0x1239
+	.long	0x2685
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF408
+	.byte	0x32
+	.value	0x104
+	.byte	0x1
+	.long	.LASF408
+	.long	0xd62
+	.long	0x26a5
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0xa31
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF409
+	.byte	0x32
+	.value	0x157
+	.byte	0x1
+	.long	.LASF409
+	.long	0x1239
+	.long	0x26c5
+	.uleb128 0x1
+	.long	0x1239
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF409
+	.byte	0x32
+	.value	0x151
+	.byte	0x1
+	.long	.LASF409
+	.long	0xd62
+	.long	0x26e5
+	.uleb128 0x1
+	.long	0xd62
+	.uleb128 0x1
+	.long	0x1239
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF410
+	.byte	0x18
+	.byte	0x1
+	.byte	0x14
+	.byte	0x8
+	.long	0x2752
+	.uleb128 0x3
+	.long	.LASF411
+	.byte	0x1
+	.byte	0x16
+	.byte	0x10
+	.long	0x2752
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF412
+	.byte	0x1
+	.byte	0x17
+	.byte	0x10
+	.long	0x123
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF413
+	.byte	0x1
+	.byte	0x18
+	.byte	0x10
+	.long	0x123
+	.byte	0x10
+	.uleb128 0x15
+	.long	.LASF410
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x3
+	.long	.LASF414
+	.long	0x272d
+	.long	0x2738
+	.uleb128 0x7
+	.long	0x2757
+	.uleb128 0x1
+	.long	0x275c
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF415
+	.byte	0x1b
+	.long	.LASF417
+	.long	0x2746
+	.uleb128 0x7
+	.long	0x2757
+	.uleb128 0x7
+	.long	0xa31
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xa31
+	.uleb128 0x6
+	.long	0x26e5
+	.uleb128 0x23
+	.long	0x26e5
+	.uleb128 0x14
+	.long	.LASF418
+	.byte	0x20
+	.byte	0x1
+	.byte	0x21
+	.byte	0x8
+	.long	0x277c
+	.uleb128 0x24
+	.string	"m_v"
+	.byte	0x1
+	.byte	0x23
+	.byte	0x8
+	.long	0x277c
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	0xa3d
+	.long	0x278c
+	.uleb128 0x2b
+	.long	0xa00
+	.byte	0x3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF419
+	.byte	0x20
+	.byte	0x1
+	.byte	0x27
+	.byte	0x8
+	.long	0x27f9
+	.uleb128 0x24
+	.string	"m_v"
+	.byte	0x1
+	.byte	0x29
+	.byte	0x8
+	.long	0x277c
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF419
+	.byte	0x1
+	.byte	0x2b
+	.byte	0x3
+	.long	.LASF420
+	.long	0x27ba
+	.long	0x27c0
+	.uleb128 0x7
+	.long	0x27fe
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF419
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x3
+	.long	.LASF421
+	.long	0x27d4
+	.long	0x27df
+	.uleb128 0x7
+	.long	0x27fe
+	.uleb128 0x1
+	.long	0x2803
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF422
+	.byte	0x2d
+	.long	.LASF423
+	.long	0x27ed
+	.uleb128 0x7
+	.long	0x27fe
+	.uleb128 0x7
+	.long	0xa31
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x278c
+	.uleb128 0x6
+	.long	0x278c
+	.uleb128 0x16
+	.long	0x27f9
+	.uleb128 0x6
+	.long	0x2ce8
+	.uleb128 0x6
+	.long	0x2d0f
+	.uleb128 0x6
+	.long	0x2761
+	.uleb128 0x6
+	.long	0x2bdb
+	.uleb128 0x6
+	.long	0x2c02
+	.uleb128 0x6
+	.long	0x2b5b
+	.uleb128 0x6b
+	.long	.LASF424
+	.byte	0x1
+	.byte	0x30
+	.byte	0x11
+	.long	0x2838
+	.uleb128 0x1
+	.long	0xd7e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF425
+	.byte	0x32
+	.byte	0x2f
+	.byte	0xe
+	.long	0xd7e
+	.long	0x2858
+	.uleb128 0x1
+	.long	0xd7e
+	.uleb128 0x1
+	.long	0xd73
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF426
+	.byte	0x32
+	.byte	0x2b
+	.byte	0xe
+	.long	0xd7e
+	.long	0x2878
+	.uleb128 0x1
+	.long	0xd7e
+	.uleb128 0x1
+	.long	0xd73
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x23
+	.long	0x2b5b
+	.uleb128 0x3f
+	.long	0xba7
+	.long	0x2891
+	.long	0x28a7
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2b5b
+	.uleb128 0x18
+	.long	.LASF427
+	.long	0xd41
+	.uleb128 0xd
+	.long	.LASF428
+	.byte	0x3
+	.byte	0x1f
+	.byte	0x25
+	.long	0x2878
+	.byte	0
+	.uleb128 0x6c
+	.long	0x287d
+	.long	.LASF467
+	.long	0x28bf
+	.long	0x28ca
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2b5b
+	.uleb128 0xe
+	.long	0x2891
+	.uleb128 0xe
+	.long	0x289a
+	.byte	0
+	.uleb128 0x23
+	.long	0x2bdb
+	.uleb128 0x3f
+	.long	0xbcd
+	.long	0x28e3
+	.long	0x28f9
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2bdb
+	.uleb128 0x18
+	.long	.LASF427
+	.long	0xd41
+	.uleb128 0xd
+	.long	.LASF428
+	.byte	0x3
+	.byte	0x1f
+	.byte	0x25
+	.long	0x28ca
+	.byte	0
+	.uleb128 0x40
+	.long	0x28cf
+	.long	0x290d
+	.long	0x2918
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2bdb
+	.uleb128 0xe
+	.long	0x28e3
+	.uleb128 0xe
+	.long	0x28ec
+	.byte	0
+	.uleb128 0x19
+	.long	0xc5f
+	.long	0x297b
+	.uleb128 0x9
+	.string	"T"
+	.long	0x26e5
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2b5b
+	.uleb128 0xd
+	.long	.LASF428
+	.byte	0x3
+	.byte	0x4d
+	.byte	0x21
+	.long	0x2878
+	.uleb128 0x4
+	.long	.LASF429
+	.byte	0x3
+	.byte	0x4f
+	.byte	0x9
+	.long	0x2947
+	.uleb128 0x16
+	.long	0x294c
+	.uleb128 0x25
+	.long	0x26e5
+	.long	0x295b
+	.uleb128 0x1
+	.long	0x2878
+	.byte	0
+	.uleb128 0x25
+	.long	0xb51
+	.long	0x296a
+	.uleb128 0x1
+	.long	0x2878
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF430
+	.byte	0x50
+	.byte	0x19
+	.long	0x2975
+	.uleb128 0x16
+	.long	0x295b
+	.byte	0
+	.uleb128 0x19
+	.long	0xbef
+	.long	0x2998
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2b5b
+	.uleb128 0xd
+	.long	.LASF428
+	.byte	0x3
+	.byte	0x26
+	.byte	0x3c
+	.long	0x2878
+	.byte	0
+	.uleb128 0x19
+	.long	0xc87
+	.long	0x29b3
+	.uleb128 0x9
+	.string	"T"
+	.long	0x26e5
+	.uleb128 0x1
+	.long	0xc32
+	.uleb128 0x1
+	.long	0xfd8
+	.byte	0
+	.uleb128 0x19
+	.long	0xcaa
+	.long	0x2a16
+	.uleb128 0x9
+	.string	"T"
+	.long	0x278c
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2bdb
+	.uleb128 0xd
+	.long	.LASF428
+	.byte	0x3
+	.byte	0x4d
+	.byte	0x21
+	.long	0x28ca
+	.uleb128 0x4
+	.long	.LASF429
+	.byte	0x3
+	.byte	0x4f
+	.byte	0x9
+	.long	0x29e2
+	.uleb128 0x16
+	.long	0x29e7
+	.uleb128 0x25
+	.long	0x278c
+	.long	0x29f6
+	.uleb128 0x1
+	.long	0x28ca
+	.byte	0
+	.uleb128 0x25
+	.long	0xb51
+	.long	0x2a05
+	.uleb128 0x1
+	.long	0x28ca
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF430
+	.byte	0x50
+	.byte	0x19
+	.long	0x2a10
+	.uleb128 0x16
+	.long	0x29f6
+	.byte	0
+	.uleb128 0x19
+	.long	0xc10
+	.long	0x2a33
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2bdb
+	.uleb128 0xd
+	.long	.LASF428
+	.byte	0x3
+	.byte	0x26
+	.byte	0x3c
+	.long	0x28ca
+	.byte	0
+	.uleb128 0x19
+	.long	0xccc
+	.long	0x2b0c
+	.uleb128 0x9
+	.string	"T"
+	.long	0x2761
+	.uleb128 0x9
+	.string	"F"
+	.long	0x2ce8
+	.uleb128 0xd
+	.long	.LASF428
+	.byte	0x3
+	.byte	0x44
+	.byte	0x21
+	.long	0xced
+	.uleb128 0x6d
+	.string	"Tu"
+	.byte	0x20
+	.byte	0x3
+	.byte	0x46
+	.byte	0x9
+	.long	0x2b00
+	.uleb128 0x6e
+	.string	"Tu"
+	.long	0x2a6e
+	.long	0x2a88
+	.uleb128 0x7
+	.long	0x2a73
+	.uleb128 0x6
+	.long	0x2a56
+	.uleb128 0x1
+	.long	0x2a7d
+	.uleb128 0x16
+	.long	0x2a82
+	.uleb128 0xa
+	.long	0x2a56
+	.byte	0
+	.uleb128 0x41
+	.string	"m_c"
+	.byte	0x46
+	.byte	0x13
+	.long	0xd67
+	.uleb128 0x41
+	.string	"m_t"
+	.byte	0x46
+	.byte	0x1a
+	.long	0x2761
+	.uleb128 0x42
+	.string	"Tu"
+	.byte	0x46
+	.byte	0x1f
+	.long	0x2aac
+	.long	0x2ab6
+	.uleb128 0x18
+	.long	.LASF427
+	.long	0x2ace
+	.byte	0
+	.uleb128 0x42
+	.string	"~Tu"
+	.byte	0x46
+	.byte	0x29
+	.long	0x2ac5
+	.long	0x2add
+	.uleb128 0x18
+	.long	.LASF427
+	.long	0x2ace
+	.uleb128 0xa
+	.long	0x2a73
+	.uleb128 0x18
+	.long	.LASF431
+	.long	0xa38
+	.byte	0
+	.uleb128 0x40
+	.long	0x2a9e
+	.long	0x2aea
+	.long	0x2af0
+	.uleb128 0xe
+	.long	0x2aac
+	.byte	0
+	.uleb128 0x6f
+	.long	0x2ab6
+	.long	0x2af9
+	.uleb128 0xe
+	.long	0x2ac5
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF432
+	.byte	0x47
+	.byte	0x6
+	.long	0x2a56
+	.byte	0
+	.uleb128 0x19
+	.long	0xcf3
+	.long	0x2b41
+	.uleb128 0x9
+	.string	"T"
+	.long	0x26e5
+	.uleb128 0xd
+	.long	.LASF433
+	.byte	0x2
+	.byte	0x63
+	.byte	0x1a
+	.long	0x2757
+	.uleb128 0xd
+	.long	.LASF434
+	.byte	0x2
+	.byte	0x63
+	.byte	0x24
+	.long	0x2757
+	.uleb128 0xd
+	.long	.LASF435
+	.byte	0x2
+	.byte	0x63
+	.byte	0x2d
+	.long	0x2757
+	.byte	0
+	.uleb128 0x19
+	.long	0xd1e
+	.long	0x2bba
+	.uleb128 0x9
+	.string	"T"
+	.long	0x26e5
+	.uleb128 0x2c
+	.string	"p"
+	.byte	0x2
+	.byte	0x40
+	.byte	0x1e
+	.long	0x2757
+	.uleb128 0x70
+	.long	.LASF437
+	.byte	0x8
+	.byte	0x2
+	.byte	0x42
+	.byte	0xb
+	.uleb128 0x71
+	.long	.LASF438
+	.long	.LASF468
+	.long	0x2b75
+	.long	0x2b80
+	.uleb128 0x7
+	.long	0x2821
+	.uleb128 0x7
+	.long	0xa31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF439
+	.byte	0x2
+	.byte	0x44
+	.byte	0xb
+	.long	0xd7e
+	.byte	0
+	.uleb128 0x72
+	.long	.LASF3
+	.byte	0x2
+	.byte	0x45
+	.byte	0xa
+	.long	.LASF440
+	.long	0x2b9e
+	.byte	0x3
+	.uleb128 0x18
+	.long	.LASF427
+	.long	0x2ba7
+	.uleb128 0xa
+	.long	0x2821
+	.uleb128 0x2c
+	.string	"to"
+	.byte	0x2
+	.byte	0x45
+	.byte	0x1b
+	.long	0xd7e
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF441
+	.byte	0x4e
+	.byte	0x13
+	.long	0x278c
+	.quad	.LFB3273
+	.quad	.LFE3273-.LFB3273
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2cc7
+	.uleb128 0x43
+	.byte	0x50
+	.long	0x2c21
+	.uleb128 0x44
+	.long	.LASF442
+	.long	0x2bee
+	.long	0x2bf9
+	.uleb128 0x7
+	.long	0x2817
+	.uleb128 0x7
+	.long	0xa31
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF3
+	.long	0x2c07
+	.uleb128 0xa
+	.long	0x2bdb
+	.uleb128 0x18
+	.long	.LASF443
+	.long	0x2c10
+	.uleb128 0xa
+	.long	0x281c
+	.uleb128 0x2c
+	.string	"p"
+	.byte	0x1
+	.byte	0x50
+	.byte	0x34
+	.long	0xd7e
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x29b3
+	.quad	.LBI96
+	.byte	.LVU52
+	.long	.LLRL16
+	.byte	0x1
+	.byte	0x50
+	.byte	0x42
+	.uleb128 0xe
+	.long	0x29ca
+	.uleb128 0x2e
+	.long	.LLRL16
+	.uleb128 0x46
+	.long	0x2a05
+	.uleb128 0x13
+	.long	0x2a16
+	.quad	.LBI98
+	.byte	.LVU53
+	.long	.LLRL16
+	.byte	0x3
+	.byte	0x51
+	.byte	0x48
+	.uleb128 0xe
+	.long	0x2a26
+	.uleb128 0x13
+	.long	0x28cf
+	.quad	.LBI99
+	.byte	.LVU54
+	.long	.LLRL16
+	.byte	0x3
+	.byte	0x27
+	.byte	0x2a
+	.uleb128 0xe
+	.long	0x28ec
+	.uleb128 0x12
+	.long	0x28e3
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x13
+	.long	0x2bf9
+	.quad	.LBI100
+	.byte	.LVU55
+	.long	.LLRL16
+	.byte	0x3
+	.byte	0x20
+	.byte	0x20
+	.uleb128 0x12
+	.long	0x2c15
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xe
+	.long	0x2c07
+	.uleb128 0x34
+	.quad	.LVL16
+	.long	0x2826
+	.uleb128 0x26
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF444
+	.byte	0x4a
+	.byte	0x13
+	.long	0x2761
+	.quad	.LFB3268
+	.quad	.LFE3268-.LFB3268
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2e04
+	.uleb128 0x43
+	.byte	0x4c
+	.long	0x2d2e
+	.uleb128 0x44
+	.long	.LASF442
+	.long	0x2cfb
+	.long	0x2d06
+	.uleb128 0x7
+	.long	0x2808
+	.uleb128 0x7
+	.long	0xa31
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF3
+	.long	0x2d14
+	.uleb128 0xa
+	.long	0x2ce8
+	.uleb128 0x18
+	.long	.LASF443
+	.long	0x2d1d
+	.uleb128 0xa
+	.long	0x280d
+	.uleb128 0x2c
+	.string	"p"
+	.byte	0x1
+	.byte	0x4c
+	.byte	0x36
+	.long	0x2812
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x2a33
+	.quad	.LBI77
+	.byte	.LVU34
+	.long	.LLRL9
+	.byte	0x1
+	.byte	0x4c
+	.byte	0x2a
+	.uleb128 0xe
+	.long	0x2a4a
+	.uleb128 0x2e
+	.long	.LLRL11
+	.uleb128 0x73
+	.long	0x2b00
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x47
+	.long	0x2a9e
+	.quad	.LBI79
+	.byte	.LVU36
+	.quad	.LBB79
+	.quad	.LBE79-.LBB79
+	.byte	0x47
+	.byte	0x6
+	.long	0x2d87
+	.uleb128 0x12
+	.long	0x2aac
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.uleb128 0x47
+	.long	0x2d06
+	.quad	.LBI80
+	.byte	.LVU38
+	.quad	.LBB80
+	.quad	.LBE80-.LBB80
+	.byte	0x48
+	.byte	0x1c
+	.long	0x2dd2
+	.uleb128 0x12
+	.long	0x2d22
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xe
+	.long	0x2d14
+	.uleb128 0x34
+	.quad	.LVL12
+	.long	0x2826
+	.uleb128 0x26
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x74
+	.long	0x2ab6
+	.quad	.LBI82
+	.byte	.LVU46
+	.quad	.LBB82
+	.quad	.LBE82-.LBB82
+	.byte	0x3
+	.byte	0x4a
+	.byte	0x1
+	.uleb128 0x12
+	.long	0x2ac5
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x75
+	.long	.LASF445
+	.byte	0x1
+	.byte	0x44
+	.byte	0x14
+	.long	0x2757
+	.long	0x2e39
+	.uleb128 0xd
+	.long	.LASF433
+	.byte	0x1
+	.byte	0x44
+	.byte	0x2d
+	.long	0x2757
+	.uleb128 0xd
+	.long	.LASF434
+	.byte	0x1
+	.byte	0x44
+	.byte	0x3c
+	.long	0x2757
+	.uleb128 0xd
+	.long	.LASF435
+	.byte	0x1
+	.byte	0x44
+	.byte	0x4a
+	.long	0x2757
+	.byte	0
+	.uleb128 0x76
+	.long	.LASF446
+	.byte	0x1
+	.byte	0x3f
+	.byte	0x14
+	.long	0x2757
+	.byte	0x1
+	.long	0x2e6f
+	.uleb128 0xd
+	.long	.LASF433
+	.byte	0x1
+	.byte	0x3f
+	.byte	0x2c
+	.long	0x2757
+	.uleb128 0xd
+	.long	.LASF434
+	.byte	0x1
+	.byte	0x3f
+	.byte	0x3b
+	.long	0x2757
+	.uleb128 0xd
+	.long	.LASF435
+	.byte	0x1
+	.byte	0x3f
+	.byte	0x49
+	.long	0x2757
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF447
+	.byte	0x38
+	.byte	0x13
+	.long	0x26e5
+	.quad	.LFB3264
+	.quad	.LFE3264-.LFB3264
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2f58
+	.uleb128 0x48
+	.long	.LASF449
+	.byte	0x38
+	.byte	0x2b
+	.long	0x2757
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x13
+	.long	0x2b41
+	.quad	.LBI61
+	.byte	.LVU8
+	.long	.LLRL0
+	.byte	0x1
+	.byte	0x3a
+	.byte	0x22
+	.uleb128 0x12
+	.long	0x2b51
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x2e
+	.long	.LLRL0
+	.uleb128 0x13
+	.long	0x2918
+	.quad	.LBI63
+	.byte	.LVU9
+	.long	.LLRL0
+	.byte	0x2
+	.byte	0x4f
+	.byte	0x34
+	.uleb128 0xe
+	.long	0x292f
+	.uleb128 0x2e
+	.long	.LLRL0
+	.uleb128 0x46
+	.long	0x296a
+	.uleb128 0x13
+	.long	0x297b
+	.quad	.LBI65
+	.byte	.LVU10
+	.long	.LLRL0
+	.byte	0x3
+	.byte	0x51
+	.byte	0x48
+	.uleb128 0xe
+	.long	0x298b
+	.uleb128 0x13
+	.long	0x287d
+	.quad	.LBI66
+	.byte	.LVU11
+	.long	.LLRL0
+	.byte	0x3
+	.byte	0x27
+	.byte	0x2a
+	.uleb128 0xe
+	.long	0x289a
+	.uleb128 0x12
+	.long	0x2891
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x13
+	.long	0x2b8d
+	.quad	.LBI67
+	.byte	.LVU12
+	.long	.LLRL0
+	.byte	0x3
+	.byte	0x20
+	.byte	0x20
+	.uleb128 0x12
+	.long	0x2bac
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xe
+	.long	0x2b9e
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF448
+	.byte	0x34
+	.byte	0x12
+	.long	0xd7e
+	.quad	.LFB3263
+	.quad	.LFE3263-.LFB3263
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2f94
+	.uleb128 0x77
+	.string	"to"
+	.byte	0x1
+	.byte	0x34
+	.byte	0x26
+	.long	0xd7e
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x48
+	.long	.LASF449
+	.byte	0x34
+	.byte	0x32
+	.long	0x2757
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x78
+	.long	0x2e39
+	.quad	.LFB3266
+	.quad	.LFE3266-.LFB3266
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x12
+	.long	0x2e4a
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x12
+	.long	0x2e56
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x12
+	.long	0x2e62
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x34
+	.quad	.LVL8
+	.long	0x2838
+	.uleb128 0x26
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x26
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x26
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x42
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x3a
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 31
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xa
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xa
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 44
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x2
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6d
+	.uleb128 0x19
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x60
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x62
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x63
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x64
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x65
+	.uleb128 0x15
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x66
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x67
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x68
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x69
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6a
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x6b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x70
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x71
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x72
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x73
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x74
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x75
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x76
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x77
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x78
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS19:
+	.uleb128 .LVU54
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU55
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU36
+	.uleb128 .LVU37
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU37
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU46
+	.uleb128 .LVU47
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU8
+	.uleb128 .LVU16
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU11
+	.uleb128 .LVU16
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU12
+	.uleb128 .LVU16
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LFE3266-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE3266-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LFE3266-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF319:
+	.string	"getenv"
+.LASF226:
+	.string	"__isoc99_vwscanf"
+.LASF145:
+	.string	"uint_fast16_t"
+.LASF66:
+	.string	"long int"
+.LASF29:
+	.string	"__debug"
+.LASF201:
+	.string	"fputwc"
+.LASF34:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EPv"
+.LASF434:
+	.string	"last"
+.LASF337:
+	.string	"strtoull"
+.LASF443:
+	.string	"__closure"
+.LASF256:
+	.string	"wcsxfrm"
+.LASF447:
+	.string	"relocate_handle"
+.LASF80:
+	.string	"xstd"
+.LASF48:
+	.string	"~exception_ptr"
+.LASF317:
+	.string	"atol"
+.LASF325:
+	.string	"rand"
+.LASF449:
+	.string	"from"
+.LASF187:
+	.string	"_shortbuf"
+.LASF12:
+	.string	"false_type"
+.LASF465:
+	.string	"_IO_lock_t"
+.LASF273:
+	.string	"__max_align_ll"
+.LASF466:
+	.string	"execution"
+.LASF103:
+	.string	"char"
+.LASF154:
+	.string	"gp_offset"
+.LASF365:
+	.string	"remove"
+.LASF331:
+	.string	"system"
+.LASF241:
+	.string	"tm_yday"
+.LASF176:
+	.string	"_IO_buf_end"
+.LASF122:
+	.string	"__off_t"
+.LASF369:
+	.string	"setvbuf"
+.LASF17:
+	.string	"__cust_swap"
+.LASF457:
+	.string	"default_factory"
+.LASF352:
+	.string	"fflush"
+.LASF47:
+	.string	"_ZNSt15__exception_ptr13exception_ptraSEOS0_"
+.LASF270:
+	.string	"wcstold"
+.LASF444:
+	.string	"uninit_zeroed"
+.LASF264:
+	.string	"__isoc99_wscanf"
+.LASF219:
+	.string	"vfwscanf"
+.LASF83:
+	.string	"~internal_dummy_type"
+.LASF288:
+	.string	"p_cs_precedes"
+.LASF51:
+	.string	"_ZNSt15__exception_ptr13exception_ptr4swapERS0_"
+.LASF376:
+	.string	"towctrans"
+.LASF174:
+	.string	"_IO_write_end"
+.LASF62:
+	.string	"unsigned int"
+.LASF380:
+	.string	"sequenced_policy"
+.LASF113:
+	.string	"__uint_least8_t"
+.LASF72:
+	.string	"__gnu_cxx"
+.LASF192:
+	.string	"_freeres_list"
+.LASF32:
+	.string	"__exception_ptr"
+.LASF452:
+	.string	"_ZNKSt15__exception_ptr13exception_ptrcvbEv"
+.LASF150:
+	.string	"intmax_t"
+.LASF286:
+	.string	"int_frac_digits"
+.LASF95:
+	.string	"make_uninitialized<Filled, uninit_filled()::<lambda(void*)> >"
+.LASF141:
+	.string	"int_fast16_t"
+.LASF108:
+	.string	"__int32_t"
+.LASF185:
+	.string	"_cur_column"
+.LASF394:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy16__allow_parallelEv"
+.LASF68:
+	.string	"wchar_t"
+.LASF410:
+	.string	"Handle"
+.LASF430:
+	.string	"factory"
+.LASF403:
+	.string	"strerror"
+.LASF121:
+	.string	"__uintmax_t"
+.LASF225:
+	.string	"vwscanf"
+.LASF392:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy19__allow_unsequencedEv"
+.LASF14:
+	.string	"__swappable_details"
+.LASF180:
+	.string	"_markers"
+.LASF237:
+	.string	"tm_mday"
+.LASF98:
+	.string	"_ZN4xstd8relocateI6HandleEEPT_S3_S3_S3_"
+.LASF407:
+	.string	"strpbrk"
+.LASF454:
+	.string	"_ZN9__gnu_cxx3divExx"
+.LASF216:
+	.string	"__isoc99_swscanf"
+.LASF116:
+	.string	"__int_least32_t"
+.LASF467:
+	.string	"_ZN4xstd19internal_dummy_typeC2IZNS_13relocate_fromI6HandleEET_PS4_E17trivial_relocatorEEOS4_"
+.LASF31:
+	.string	"nullptr_t"
+.LASF115:
+	.string	"__uint_least16_t"
+.LASF73:
+	.string	"__ops"
+.LASF419:
+	.string	"Filled"
+.LASF69:
+	.string	"char8_t"
+.LASF464:
+	.string	"max_align_t"
+.LASF372:
+	.string	"ungetc"
+.LASF231:
+	.string	"wcscpy"
+.LASF423:
+	.string	"_ZN6FilledD4Ev"
+.LASF162:
+	.string	"__count"
+.LASF388:
+	.string	"_ZN6__pstl9execution2v115parallel_policy19__allow_unsequencedEv"
+.LASF4:
+	.string	"_ZNKSt17integral_constantIbLb0EEcvbEv"
+.LASF274:
+	.string	"__max_align_ld"
+.LASF228:
+	.string	"wcscat"
+.LASF275:
+	.string	"lconv"
+.LASF276:
+	.string	"decimal_point"
+.LASF291:
+	.string	"n_sep_by_space"
+.LASF50:
+	.string	"swap"
+.LASF342:
+	.string	"__state"
+.LASF168:
+	.string	"_flags"
+.LASF97:
+	.string	"relocate<Handle>"
+.LASF239:
+	.string	"tm_year"
+.LASF3:
+	.string	"operator()"
+.LASF9:
+	.string	"operator std::integral_constant<bool, true>::value_type"
+.LASF143:
+	.string	"int_fast64_t"
+.LASF102:
+	.string	"__gnu_debug"
+.LASF205:
+	.string	"fwscanf"
+.LASF437:
+	.string	"trivial_relocator"
+.LASF130:
+	.string	"uint32_t"
+.LASF124:
+	.string	"int8_t"
+.LASF289:
+	.string	"p_sep_by_space"
+.LASF397:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy14__allow_vectorEv"
+.LASF303:
+	.string	"__int128 unsigned"
+.LASF323:
+	.string	"mbtowc"
+.LASF238:
+	.string	"tm_mon"
+.LASF179:
+	.string	"_IO_save_end"
+.LASF28:
+	.string	"__cmp_alg"
+.LASF43:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EDn"
+.LASF79:
+	.string	"float"
+.LASF425:
+	.string	"memmove"
+.LASF354:
+	.string	"fgetpos"
+.LASF345:
+	.string	"_IO_codecvt"
+.LASF25:
+	.string	"__atomic_spin_count"
+.LASF223:
+	.string	"__isoc99_vswscanf"
+.LASF15:
+	.string	"__swappable_with_details"
+.LASF63:
+	.string	"long long unsigned int"
+.LASF463:
+	.string	"11max_align_t"
+.LASF125:
+	.string	"int16_t"
+.LASF87:
+	.string	"emplace_factory<xstd::relocate_from<Handle>(Handle*)::trivial_relocator>"
+.LASF373:
+	.string	"wctype_t"
+.LASF133:
+	.string	"int_least16_t"
+.LASF151:
+	.string	"uintmax_t"
+.LASF206:
+	.string	"getwc"
+.LASF429:
+	.string	"T_factory"
+.LASF440:
+	.string	"_ZZN4xstd13relocate_fromI6HandleEET_PS2_EN17trivial_relocatorclEPv"
+.LASF460:
+	.string	"relocation_path"
+.LASF421:
+	.string	"_ZN6FilledC4ERKS_"
+.LASF114:
+	.string	"__int_least16_t"
+.LASF120:
+	.string	"__intmax_t"
+.LASF44:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EOS0_"
+.LASF439:
+	.string	"m_from"
+.LASF85:
+	.string	"internal_dummy_type<xstd::relocate_from<Handle>(Handle*)::trivial_relocator>"
+.LASF424:
+	.string	"fill"
+.LASF255:
+	.string	"wcstoul"
+.LASF86:
+	.string	"_ZN4xstd19internal_dummy_typeC4IZNS_13relocate_fromI6HandleEET_PS4_E17trivial_relocatorEEOS4_"
+.LASF360:
+	.string	"fsetpos"
+.LASF299:
+	.string	"int_n_sign_posn"
+.LASF107:
+	.string	"__uint16_t"
+.LASF411:
+	.string	"m_data"
+.LASF318:
+	.string	"bsearch"
+.LASF302:
+	.string	"localeconv"
+.LASF166:
+	.string	"__FILE"
+.LASF178:
+	.string	"_IO_backup_base"
+.LASF18:
+	.string	"__cust_imove"
+.LASF189:
+	.string	"_offset"
+.LASF258:
+	.string	"wmemcmp"
+.LASF227:
+	.string	"wcrtomb"
+.LASF139:
+	.string	"uint_least64_t"
+.LASF161:
+	.string	"_M_exception_object"
+.LASF334:
+	.string	"lldiv"
+.LASF335:
+	.string	"atoll"
+.LASF222:
+	.string	"vswscanf"
+.LASF218:
+	.string	"vfwprintf"
+.LASF389:
+	.string	"_ZN6__pstl9execution2v115parallel_policy14__allow_vectorEv"
+.LASF37:
+	.string	"_ZNSt15__exception_ptr13exception_ptr9_M_addrefEv"
+.LASF93:
+	.string	"_ZN4xstd18make_uninitializedI6HandleZNS_13relocate_fromIS1_EET_PS3_E17trivial_relocatorEES3_OT0_"
+.LASF292:
+	.string	"p_sign_posn"
+.LASF382:
+	.string	"__allow_vector"
+.LASF13:
+	.string	"size_t"
+.LASF328:
+	.string	"strtod"
+.LASF132:
+	.string	"int_least8_t"
+.LASF127:
+	.string	"int64_t"
+.LASF418:
+	.string	"Zeroed"
+.LASF135:
+	.string	"int_least64_t"
+.LASF11:
+	.string	"_ZNKSt17integral_constantIbLb1EEclEv"
+.LASF211:
+	.string	"putwc"
+.LASF243:
+	.string	"tm_gmtoff"
+.LASF404:
+	.string	"strtok"
+.LASF136:
+	.string	"uint_least8_t"
+.LASF171:
+	.string	"_IO_read_base"
+.LASF117:
+	.string	"__uint_least32_t"
+.LASF2:
+	.string	"operator std::integral_constant<bool, false>::value_type"
+.LASF30:
+	.string	"true_type"
+.LASF153:
+	.string	"__float128"
+.LASF442:
+	.string	"~<lambda>"
+.LASF348:
+	.string	"clearerr"
+.LASF203:
+	.string	"fwide"
+.LASF296:
+	.string	"int_n_cs_precedes"
+.LASF232:
+	.string	"wcscspn"
+.LASF422:
+	.string	"~Filled"
+.LASF294:
+	.string	"int_p_cs_precedes"
+.LASF298:
+	.string	"int_p_sign_posn"
+.LASF285:
+	.string	"negative_sign"
+.LASF358:
+	.string	"freopen"
+.LASF99:
+	.string	"record_relocation<Handle>"
+.LASF163:
+	.string	"__value"
+.LASF402:
+	.string	"strcoll"
+.LASF401:
+	.string	"memchr"
+.LASF22:
+	.string	"__cmp_cat"
+.LASF278:
+	.string	"grouping"
+.LASF428:
+	.string	"emplacer"
+.LASF263:
+	.string	"wscanf"
+.LASF90:
+	.string	"member_hook"
+.LASF20:
+	.string	"__cust_access"
+.LASF88:
+	.string	"_ZN4xstd19internal_dummy_type15emplace_factoryIZNS_13relocate_fromI6HandleEET_PS4_E17trivial_relocatorEES0_OS4_"
+.LASF147:
+	.string	"uint_fast64_t"
+.LASF458:
+	.string	"_ZN4xstd19internal_dummy_type15default_factoryEv"
+.LASF195:
+	.string	"_mode"
+.LASF305:
+	.string	"5div_t"
+.LASF214:
+	.string	"swscanf"
+.LASF416:
+	.string	"_ZN4xstd13relocate_fromI6HandleEET_PS2_"
+.LASF96:
+	.string	"make_uninitialized<Zeroed, uninit_zeroed()::<lambda(Zeroed*)> >"
+.LASF351:
+	.string	"ferror"
+.LASF344:
+	.string	"_IO_marker"
+.LASF326:
+	.string	"qsort"
+.LASF172:
+	.string	"_IO_write_base"
+.LASF378:
+	.string	"wctype"
+.LASF309:
+	.string	"ldiv_t"
+.LASF111:
+	.string	"__uint64_t"
+.LASF324:
+	.string	"quick_exit"
+.LASF159:
+	.string	"__wch"
+.LASF82:
+	.string	"_ZN4xstd19internal_dummy_typeC4Ev"
+.LASF128:
+	.string	"uint8_t"
+.LASF49:
+	.string	"_ZNSt15__exception_ptr13exception_ptrD4Ev"
+.LASF417:
+	.string	"_ZN6HandleD4Ev"
+.LASF306:
+	.string	"quot"
+.LASF157:
+	.string	"reg_save_area"
+.LASF210:
+	.string	"mbsrtowcs"
+.LASF366:
+	.string	"rename"
+.LASF341:
+	.string	"__pos"
+.LASF374:
+	.string	"wctrans_t"
+.LASF363:
+	.string	"getchar"
+.LASF33:
+	.string	"exception_ptr"
+.LASF252:
+	.string	"wcstof"
+.LASF250:
+	.string	"wcsspn"
+.LASF371:
+	.string	"tmpnam"
+.LASF450:
+	.string	"GNU C++23 12.2.0 -mtune=generic -march=x86-64 -g -O2 -std=c++23 -fasynchronous-unwind-tables"
+.LASF156:
+	.string	"overflow_arg_area"
+.LASF412:
+	.string	"m_size"
+.LASF67:
+	.string	"long long int"
+.LASF364:
+	.string	"perror"
+.LASF414:
+	.string	"_ZN6HandleC4EOS_"
+.LASF144:
+	.string	"uint_fast8_t"
+.LASF393:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy14__allow_vectorEv"
+.LASF405:
+	.string	"strxfrm"
+.LASF177:
+	.string	"_IO_save_base"
+.LASF399:
+	.string	"par_unseq"
+.LASF283:
+	.string	"mon_grouping"
+.LASF272:
+	.string	"wcstoull"
+.LASF58:
+	.string	"bool"
+.LASF57:
+	.string	"__cxx11"
+.LASF106:
+	.string	"__int16_t"
+.LASF213:
+	.string	"swprintf"
+.LASF10:
+	.string	"_ZNKSt17integral_constantIbLb1EEcvbEv"
+.LASF199:
+	.string	"fgetwc"
+.LASF140:
+	.string	"int_fast8_t"
+.LASF359:
+	.string	"fseek"
+.LASF19:
+	.string	"__cust_iswap"
+.LASF368:
+	.string	"setbuf"
+.LASF320:
+	.string	"ldiv"
+.LASF200:
+	.string	"fgetws"
+.LASF45:
+	.string	"operator="
+.LASF39:
+	.string	"_M_get"
+.LASF193:
+	.string	"_freeres_buf"
+.LASF327:
+	.string	"srand"
+.LASF91:
+	.string	"move_destroy"
+.LASF455:
+	.string	"_Lock_policy"
+.LASF395:
+	.string	"unsequenced_policy"
+.LASF146:
+	.string	"uint_fast32_t"
+.LASF459:
+	.string	"emplace_factory<uninit_filled()::<lambda(void*)> >"
+.LASF390:
+	.string	"_ZN6__pstl9execution2v115parallel_policy16__allow_parallelEv"
+.LASF152:
+	.string	"__unknown__"
+.LASF361:
+	.string	"ftell"
+.LASF194:
+	.string	"__pad5"
+.LASF217:
+	.string	"ungetwc"
+.LASF24:
+	.string	"__atomic_spin_count_relax"
+.LASF353:
+	.string	"fgetc"
+.LASF356:
+	.string	"fopen"
+.LASF408:
+	.string	"strrchr"
+.LASF186:
+	.string	"_vtable_offset"
+.LASF104:
+	.string	"__int8_t"
+.LASF355:
+	.string	"fgets"
+.LASF164:
+	.string	"__mbstate_t"
+.LASF343:
+	.string	"__fpos_t"
+.LASF438:
+	.string	"~trivial_relocator"
+.LASF385:
+	.string	"__allow_parallel"
+.LASF23:
+	.string	"__platform_wait_alignment"
+.LASF26:
+	.string	"__cmp_cust"
+.LASF77:
+	.string	"long double"
+.LASF148:
+	.string	"intptr_t"
+.LASF461:
+	.string	"_ZN4xstd17record_relocationI6HandleEEvNS_15relocation_pathEm"
+.LASF230:
+	.string	"wcscoll"
+.LASF427:
+	.string	"this"
+.LASF202:
+	.string	"fputws"
+.LASF191:
+	.string	"_wide_data"
+.LASF41:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4Ev"
+.LASF160:
+	.string	"__wchb"
+.LASF27:
+	.string	"__cust"
+.LASF118:
+	.string	"__int_least64_t"
+.LASF198:
+	.string	"btowc"
+.LASF224:
+	.string	"vwprintf"
+.LASF242:
+	.string	"tm_isdst"
+.LASF142:
+	.string	"int_fast32_t"
+.LASF54:
+	.string	"rethrow_exception"
+.LASF170:
+	.string	"_IO_read_end"
+.LASF406:
+	.string	"strchr"
+.LASF375:
+	.string	"iswctype"
+.LASF209:
+	.string	"mbsinit"
+.LASF269:
+	.string	"wmemchr"
+.LASF65:
+	.string	"short int"
+.LASF21:
+	.string	"__detail"
+.LASF249:
+	.string	"wcsrtombs"
+.LASF279:
+	.string	"int_curr_symbol"
+.LASF322:
+	.string	"mbstowcs"
+.LASF52:
+	.string	"__cxa_exception_type"
+.LASF281:
+	.string	"mon_decimal_point"
+.LASF287:
+	.string	"frac_digits"
+.LASF182:
+	.string	"_fileno"
+.LASF207:
+	.string	"mbrlen"
+.LASF100:
+	.string	"relocate_from<Handle>"
+.LASF347:
+	.string	"fpos_t"
+.LASF259:
+	.string	"wmemcpy"
+.LASF357:
+	.string	"fread"
+.LASF383:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy19__allow_unsequencedEv"
+.LASF453:
+	.string	"type_info"
+.LASF293:
+	.string	"n_sign_posn"
+.LASF391:
+	.string	"parallel_unsequenced_policy"
+.LASF304:
+	.string	"11__mbstate_t"
+.LASF313:
+	.string	"atexit"
+.LASF212:
+	.string	"putwchar"
+.LASF267:
+	.string	"wcsrchr"
+.LASF436:
+	.string	"typedef __va_list_tag __va_list_tag"
+.LASF301:
+	.string	"getwchar"
+.LASF346:
+	.string	"_IO_wide_data"
+.LASF384:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy14__allow_vectorEv"
+.LASF446:
+	.string	"memmove_handles"
+.LASF131:
+	.string	"uint64_t"
+.LASF297:
+	.string	"int_n_sep_by_space"
+.LASF349:
+	.string	"fclose"
+.LASF308:
+	.string	"6ldiv_t"
+.LASF134:
+	.string	"int_least32_t"
+.LASF94:
+	.string	"internal_dummy_type<uninit_filled()::<lambda(void*)> >"
+.LASF247:
+	.string	"wcsncmp"
+.LASF71:
+	.string	"char32_t"
+.LASF386:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy16__allow_parallelEv"
+.LASF420:
+	.string	"_ZN6FilledC4Ev"
+.LASF16:
+	.string	"ranges"
+.LASF310:
+	.string	"7lldiv_t"
+.LASF387:
+	.string	"parallel_policy"
+.LASF432:
+	.string	"ret_u"
+.LASF208:
+	.string	"mbrtowc"
+.LASF468:
+	.string	"_ZZN4xstd13relocate_fromI6HandleEET_PS2_EN17trivial_relocatorD4Ev"
+.LASF155:
+	.string	"fp_offset"
+.LASF105:
+	.string	"__uint8_t"
+.LASF233:
+	.string	"wcsftime"
+.LASF284:
+	.string	"positive_sign"
+.LASF268:
+	.string	"wcsstr"
+.LASF35:
+	.string	"_M_addref"
+.LASF362:
+	.string	"getc"
+.LASF138:
+	.string	"uint_least32_t"
+.LASF451:
+	.string	"operator bool"
+.LASF53:
+	.string	"_ZNKSt15__exception_ptr13exception_ptr20__cxa_exception_typeEv"
+.LASF314:
+	.string	"at_quick_exit"
+.LASF5:
+	.string	"_ZNKSt17integral_constantIbLb0EEclEv"
+.LASF340:
+	.string	"_G_fpos_t"
+.LASF84:
+	.string	"_ZN4xstd19internal_dummy_typeD4Ev"
+.LASF260:
+	.string	"wmemmove"
+.LASF112:
+	.string	"__int_least8_t"
+.LASF149:
+	.string	"uintptr_t"
+.LASF445:
+	.string	"relocate_handles"
+.LASF6:
+	.string	"integral_constant<bool, false>"
+.LASF89:
+	.string	"trivial"
+.LASF262:
+	.string	"wprintf"
+.LASF188:
+	.string	"_lock"
+.LASF330:
+	.string	"strtoul"
+.LASF59:
+	.string	"long unsigned int"
+.LASF184:
+	.string	"_old_offset"
+.LASF167:
+	.string	"_IO_FILE"
+.LASF448:
+	.string	"memcpy_handle"
+.LASF158:
+	.string	"wint_t"
+.LASF409:
+	.string	"strstr"
+.LASF126:
+	.string	"int32_t"
+.LASF56:
+	.string	"numbers"
+.LASF251:
+	.string	"wcstod"
+.LASF266:
+	.string	"wcspbrk"
+.LASF235:
+	.string	"tm_min"
+.LASF165:
+	.string	"mbstate_t"
+.LASF253:
+	.string	"wcstok"
+.LASF254:
+	.string	"wcstol"
+.LASF244:
+	.string	"tm_zone"
+.LASF101:
+	.string	"__int128"
+.LASF110:
+	.string	"__int64_t"
+.LASF261:
+	.string	"wmemset"
+.LASF300:
+	.string	"setlocale"
+.LASF379:
+	.string	"__pstl"
+.LASF38:
+	.string	"_ZNSt15__exception_ptr13exception_ptr10_M_releaseEv"
+.LASF129:
+	.string	"uint16_t"
+.LASF307:
+	.string	"div_t"
+.LASF60:
+	.string	"unsigned char"
+.LASF109:
+	.string	"__uint32_t"
+.LASF370:
+	.string	"tmpfile"
+.LASF55:
+	.string	"_ZSt17rethrow_exceptionNSt15__exception_ptr13exception_ptrE"
+.LASF173:
+	.string	"_IO_write_ptr"
+.LASF381:
+	.string	"__allow_unsequenced"
+.LASF277:
+	.string	"thousands_sep"
+.LASF36:
+	.string	"_M_release"
+.LASF462:
+	.string	"decltype(nullptr)"
+.LASF441:
+	.string	"uninit_filled"
+.LASF338:
+	.string	"strtof"
+.LASF433:
+	.string	"first"
+.LASF350:
+	.string	"feof"
+.LASF413:
+	.string	"m_capacity"
+.LASF332:
+	.string	"wcstombs"
+.LASF329:
+	.string	"strtol"
+.LASF204:
+	.string	"fwprintf"
+.LASF321:
+	.string	"mblen"
+.LASF119:
+	.string	"__uint_least64_t"
+.LASF312:
+	.string	"__compar_fn_t"
+.LASF456:
+	.string	"__default_lock_policy"
+.LASF257:
+	.string	"wctob"
+.LASF415:
+	.string	"~Handle"
+.LASF280:
+	.string	"currency_symbol"
+.LASF271:
+	.string	"wcstoll"
+.LASF190:
+	.string	"_codecvt"
+.LASF240:
+	.string	"tm_wday"
+.LASF42:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4ERKS0_"
+.LASF81:
+	.string	"internal_dummy_type"
+.LASF8:
+	.string	"value_type"
+.LASF339:
+	.string	"strtold"
+.LASF215:
+	.string	"__isoc99_fwscanf"
+.LASF367:
+	.string	"rewind"
+.LASF236:
+	.string	"tm_hour"
+.LASF64:
+	.string	"signed char"
+.LASF282:
+	.string	"mon_thousands_sep"
+.LASF336:
+	.string	"strtoll"
+.LASF61:
+	.string	"short unsigned int"
+.LASF234:
+	.string	"tm_sec"
+.LASF311:
+	.string	"lldiv_t"
+.LASF426:
+	.string	"memcpy"
+.LASF315:
+	.string	"atof"
+.LASF7:
+	.string	"integral_constant<bool, true>"
+.LASF396:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy19__allow_unsequencedEv"
+.LASF316:
+	.string	"atoi"
+.LASF290:
+	.string	"n_cs_precedes"
+.LASF40:
+	.string	"_ZNKSt15__exception_ptr13exception_ptr6_M_getEv"
+.LASF46:
+	.string	"_ZNSt15__exception_ptr13exception_ptraSERKS0_"
+.LASF169:
+	.string	"_IO_read_ptr"
+.LASF248:
+	.string	"wcsncpy"
+.LASF333:
+	.string	"wctomb"
+.LASF295:
+	.string	"int_p_sep_by_space"
+.LASF76:
+	.string	"_S_atomic"
+.LASF78:
+	.string	"double"
+.LASF229:
+	.string	"wcscmp"
+.LASF246:
+	.string	"wcsncat"
+.LASF431:
+	.string	"__in_chrg"
+.LASF137:
+	.string	"uint_least16_t"
+.LASF181:
+	.string	"_chain"
+.LASF265:
+	.string	"wcschr"
+.LASF70:
+	.string	"char16_t"
+.LASF398:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy16__allow_parallelEv"
+.LASF197:
+	.string	"FILE"
+.LASF377:
+	.string	"wctrans"
+.LASF221:
+	.string	"vswprintf"
+.LASF183:
+	.string	"_flags2"
+.LASF435:
+	.string	"dest"
+.LASF74:
+	.string	"_S_single"
+.LASF245:
+	.string	"wcslen"
+.LASF123:
+	.string	"__off64_t"
+.LASF196:
+	.string	"_unused2"
+.LASF175:
+	.string	"_IO_buf_base"
+.LASF400:
+	.string	"unseq"
+.LASF92:
+	.string	"make_uninitialized<Handle, xstd::relocate_from<Handle>(Handle*)::trivial_relocator>"
+.LASF220:
+	.string	"__isoc99_vfwscanf"
+.LASF75:
+	.string	"_S_mutex"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/relocation"
+.LASF0:
+	.string	"relocate_from.codegen.cpp"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,74 @@
+/* relocate_elementwise.h                                             -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// Element-by-element relocation of a possibly overlapping range, shared by
+/// `relocate_from.h` and `member_relocate_to.h`, which differ only in how a
+/// single element is relocated.
+
+#ifndef INCLUDED_RELOCATE_ELEMENTWISE
+#define INCLUDED_RELOCATE_ELEMENTWISE
+
+#include <memory>
+#include <utility>
+
+namespace xstd {
+
+/// Relocate the objects in `[first, last)` to the uninitialized storage
+/// starting at `dest` by calling `relocate_one(to, from)` for each element,
+/// and return the end of the destination range. The ranges may overlap.
+/// Usable in constant evaluation, where it is also the fallback for trivially
+/// relocatable types.
+template <class T, class RelocateOne>
+constexpr T* __relocate_elementwise(T* first, T* last, T* dest,
+                                    RelocateOne relocate_one) noexcept
+{
+  if (dest == first)
+    return last;
+
+  // Pointers into different objects cannot be ordered during constant
+  // evaluation, so test for overlap by equality only.
+  bool dest_in_source = false;
+  if consteval {
+    for (T* p = first; p != last && ! dest_in_source; ++p)
+      dest_in_source = (p == dest);
+  }
+  else {
+    dest_in_source = first < dest && dest < last;
+  }
+
+  if (dest_in_source) {
+    // Overlapping with `dest` to the right: relocate from the back.
+    T* dest_end = dest + (last - first);
+    for (T* cursor = dest_end; last != first; )
+      relocate_one(--cursor, *--last);
+    return dest_end;
+  }
+  else {
+    for (; first != last; ++first, ++dest)
+      relocate_one(dest, *first);
+    return dest;
+  }
+}
+
+/// Relocate the objects in `[first, last)` to the uninitialized storage
+/// starting at `dest` by move-constructing each destination element and
+/// destroying its source.
+template <class T>
+constexpr T* __relocate_elementwise(T* first, T* last, T* dest) noexcept
+{
+  return __relocate_elementwise(first, last, dest, [](T* to, T& from) {
+    std::construct_at(to, std::move(from));
+    from.~T();
+  });
+}
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_RELOCATE_ELEMENTWISE)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
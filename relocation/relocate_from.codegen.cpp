@@ -0,0 +1,85 @@
+/* relocate_from.codegen.cpp                                          -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// Codegen test: relocating a trivially relocatable type is a plain copy of
+// its bytes, with no calls to its move constructor or destructor, and
+// `make_uninitialized` hands its emplacer raw storage without first
+// initializing it. The constructors and destructors below are declared but
+// not defined, so any use of them would show up as a call. Run with
+// `make relocate_from.codegen`.
+
+#include <relocate_from.h>
+
+#include <cstddef>
+#include <cstring>
+
+// Non-trivial, but warranted trivially relocatable.
+struct Handle
+{
+  int         *m_data;
+  std::size_t  m_size;
+  std::size_t  m_capacity;
+
+  Handle(Handle&&) noexcept;
+  ~Handle();
+};
+
+template <> struct xstd::is_trivially_relocatable<Handle> : std::true_type { };
+
+// Trivially copyable, but default construction would write to memory.
+struct Zeroed
+{
+  long m_v[4] = { };
+};
+
+// Neither trivially copyable nor trivially default constructible.
+struct Filled
+{
+  long m_v[4] = { 1, 2, 3, 4 };
+
+  Filled();
+  Filled(const Filled&);
+  ~Filled();
+};
+
+extern "C" void fill(void *p);  // Opaque emplacer
+
+// CHECK-SAME: memcpy_handle relocate_handle
+// CHECK-NO-CALL: relocate_handle
+extern "C" void *memcpy_handle(void *to, Handle *from)
+{
+  return std::memcpy(to, from, sizeof(Handle));
+}
+extern "C" Handle relocate_handle(Handle *from)
+{
+  return xstd::relocate_from(from);
+}
+
+// Relocating a whole array is a single `memmove` call.
+// CHECK-SAME: memmove_handles relocate_handles
+extern "C" Handle *memmove_handles(Handle *first, Handle *last, Handle *dest)
+{
+  std::memmove((void*) dest, (void*) first, (last - first) * sizeof(Handle));
+  return dest + (last - first);
+}
+extern "C" Handle *relocate_handles(Handle *first, Handle *last, Handle *dest)
+{
+  return xstd::relocate(first, last, dest);
+}
+
+// CHECK-NO-STORE-BEFORE-CALL: uninit_zeroed uninit_filled
+extern "C" Zeroed uninit_zeroed()
+{
+  return xstd::make_uninitialized<Zeroed>([](Zeroed *p){ fill(p); });
+}
+extern "C" Filled uninit_filled()
+{
+  return xstd::make_uninitialized<Filled>([](void *p){ fill(p); });
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
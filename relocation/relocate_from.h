@@ -8,7 +8,12 @@
 #define INCLUDED_RELOCATE_FROM
 
 #include <make_uninitialized.h>
+#include <relocate_elementwise.h>
+#include <relocation_builtins.h>
+#include <relocation_telemetry.h>
 
+#include <memory>
+#include <new>
 #include <utility>
 #include <cstring>
 
@@ -16,10 +21,14 @@ namespace xstd {
 
 using namespace std;
 
+/// By default, a type is trivially relocatable if the compiler says so or if
+/// it is trivially move constructible and trivially destructible. Specialize
+/// this trait to warrant that other types are trivially relocatable.
 template <class T>
 struct is_trivially_relocatable
-    : conjunction<is_trivially_move_constructible<T>,
-                  is_trivially_destructible<T>>
+    : disjunction<bool_constant<builtin_is_trivially_relocatable_v<T>>,
+                  conjunction<is_trivially_move_constructible<T>,
+                              is_trivially_destructible<T>>>
 {
 };
 
@@ -27,22 +36,32 @@ template <class T>
 inline constexpr bool is_trivially_relocatable_v =
     is_trivially_relocatable<T>::value;
 
+/// The destructor of this `struct` invokes the destructor for `obj`.
+template <class T>
+struct __relocation_destroyer
+{
+  T *obj;
+  constexpr ~__relocation_destroyer() { obj->~T(); }
+};
+
 /// This overload of `relocate_from` simply uses the trivial move constructor.
 template <class T>
 requires (is_trivially_move_constructible_v<T> &&
           is_trivially_destructible_v<T>)
-T relocate_from(T *p)
+constexpr T relocate_from(T *p)
 {
+  record_relocation<T>(relocation_path::trivial);
   return std::move(*p);
 }
 
 /// This overload  of `relocate_from` trivially relocates from `*p` to the
-/// return-value object.
+/// return-value object. `memcpy` cannot be used in constant evaluation, so
+/// there it falls back to move+destroy.
 template <class T>
 requires (is_trivially_relocatable_v<T> &&
           ! (is_trivially_move_constructible_v<T> &&
              is_trivially_destructible_v<T>))
-T relocate_from(T *p)
+constexpr T relocate_from(T *p)
 {
   struct  trivial_relocator
   {
@@ -50,6 +69,13 @@ T relocate_from(T *p)
     void operator()(void *to) { std::memcpy(to, m_from, sizeof(T)); }
   };
 
+  record_relocation<T>(relocation_path::trivial);
+  if constexpr (is_move_constructible_v<T>) {
+    if consteval {
+      __relocation_destroyer<T> tr{p};
+      return std::move(*p);
+    }
+  }
   return make_uninitialized<T>(trivial_relocator{p});
 }
 
@@ -57,19 +83,56 @@ T relocate_from(T *p)
 /// return-value object.
 template <class T>
 requires (is_nothrow_move_constructible_v<T> && !is_trivially_relocatable_v<T>)
-T relocate_from(T *p)
+constexpr T relocate_from(T *p)
 {
-  /// The destructor of this `struct` invokes the destructor for `obj`.
-  struct destroyer
-  {
-    T *obj;
-    ~destroyer() { obj->~T(); }
-  };
-
-  destroyer tr{p};
+  record_relocation<T>(relocation_path::move_destroy);
+  __relocation_destroyer<T> tr{p};
   return std::move(*p);
 }
 
+/// Relocate the trivially relocatable objects in `[first, last)` to the
+/// uninitialized storage starting at `dest` with a single `memmove` and
+/// return the end of the destination range. The ranges may overlap. In
+/// constant evaluation, the objects are relocated by move+destroy instead.
+template <class T>
+requires (is_trivially_relocatable_v<T>)
+constexpr T* relocate(T* first, T* last, T* dest) noexcept
+{
+  record_relocation<T>(relocation_path::trivial, last - first);
+  if constexpr (is_move_constructible_v<T>) {
+    if consteval {
+      return __relocate_elementwise(first, last, dest);
+    }
+  }
+  std::memmove((void*) dest, (void*) first, (last - first) * sizeof(T));
+  return dest + (last - first);
+}
+
+/// Relocate the objects in `[first, last)` to the uninitialized storage
+/// starting at `dest` by move-constructing each destination element and
+/// destroying its source. The ranges may overlap.
+template <class T>
+requires (is_nothrow_move_constructible_v<T> && !is_trivially_relocatable_v<T>)
+constexpr T* relocate(T* first, T* last, T* dest) noexcept
+{
+  record_relocation<T>(relocation_path::move_destroy, last - first);
+  return __relocate_elementwise(first, last, dest);
+}
+
+/// An object of this type converts to `T` by relocating from `*m_from`.
+/// The conversion yields a prvalue, so a compiler that implements CWG2327
+/// (e.g., GCC) initializes a `T` that is direct-initialized from a
+/// `relocation_source<T>` (e.g., via `optional<T>::emplace` or
+/// `construct_at`) in place, without an intervening move. The standard does
+/// not yet require that; where it matters, use `relocate_from` directly.
+template <class T>
+struct relocation_source
+{
+  T *m_from;
+
+  constexpr operator T() const { return relocate_from(m_from); }
+};
+
 } // close namespace xstd
 
 
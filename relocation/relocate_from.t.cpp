@@ -7,8 +7,12 @@
 // #include <relocate_construction.h>  // OLD
 #include <relocate_from.h>
 
+#include <array>
+#include <memory>
 #include <new>
 #include <iostream>
+#include <sstream>
+#include <cassert>
 
 /// CRTP Class that counts constructors and destructors for `T`
 template <class T>
@@ -93,11 +97,145 @@ void simple_test(const char* objnm)
   print_counters<Obj>(std::cout) << std::endl;
 }
 
+/// Relocate a range of 4 `Obj` objects one position to the right and then
+/// two positions to the left, i.e., to overlapping destinations.
+template <class Obj>
+void range_test(const char* objnm)
+{
+  union ObjBuf { Obj buf[6]; ObjBuf(){} ~ObjBuf(){} } ob;
+
+  std::cout << objnm << ": ";
+  for (int i = 0; i < 4; ++i)
+    new(&ob.buf[i]) Obj(i + 1);
+  Obj *e = xstd::relocate(ob.buf, ob.buf + 4, ob.buf + 1);
+  e = xstd::relocate(ob.buf + 1, e, ob.buf);
+  std::cout << "| ";
+  for (Obj *p = ob.buf; p != e; ++p) {
+    std::cout << *p << ' ';
+    p->~Obj();
+  }
+  std::cout << "| ";
+  print_counters<Obj>(std::cout) << std::endl;
+}
+
+/// Minimal growable array, usable in constant evaluation, that relocates its
+/// elements into new storage when it grows and out of storage when popped.
+template <class T>
+class ct_vector
+{
+  std::allocator<T> m_alloc;
+  T                *m_data = nullptr;
+  std::size_t       m_size = 0, m_capacity = 0;
+
+public:
+  constexpr ct_vector() = default;
+  ct_vector(const ct_vector&) = delete;
+  constexpr ~ct_vector()
+  {
+    for (std::size_t i = 0; i < m_size; ++i)
+      m_data[i].~T();
+    if (m_data)
+      m_alloc.deallocate(m_data, m_capacity);
+  }
+
+  constexpr void push_back(T v)
+  {
+    if (m_size == m_capacity) {
+      std::size_t new_capacity = m_capacity ? 2 * m_capacity : 1;
+      T* new_data = m_alloc.allocate(new_capacity);
+      if (m_data) {
+        xstd::relocate(m_data, m_data + m_size, new_data);
+        m_alloc.deallocate(m_data, m_capacity);
+      }
+      m_data = new_data;
+      m_capacity = new_capacity;
+    }
+    std::construct_at(m_data + m_size++, std::move(v));
+  }
+
+  constexpr T pop_back() { return xstd::relocate_from(m_data + --m_size); }
+
+  /// Relocate the elements one position to the left, discarding the first.
+  constexpr void pop_front()
+  {
+    m_data->~T();
+    xstd::relocate(m_data + 1, m_data + m_size, m_data);
+    --m_size;
+  }
+
+  constexpr const T& operator[](std::size_t i) const { return m_data[i]; }
+  constexpr std::size_t size() const { return m_size; }
+};
+
+/// Trivially relocatable (by opt-in) but not trivially copyable.
+struct CX
+{
+  int v;
+  constexpr CX(int i) : v(i) { }
+  constexpr CX(const CX& other) : v(other.v) { }
+  constexpr ~CX() { }
+};
+
+namespace xstd {
+template <> struct is_trivially_relocatable<CX> : true_type { };
+} // close namespace xstd
+
+/// Not trivially relocatable.
+struct CY
+{
+  int v;
+  constexpr CY(int i) : v(i) { }
+  constexpr CY(CY&& other) noexcept : v(other.v) { other.v = -1; }
+  constexpr ~CY() { }
+};
+
+/// Build a lookup table at compile time using a relocating container.
+template <class T, std::size_t N>
+constexpr std::array<int, N> make_squares()
+{
+  ct_vector<T> v;
+  v.push_back(T(-1));
+  for (int i = 0; i <= int(N); ++i)
+    v.push_back(T(i * i));
+  int last = v.pop_back().v;
+  v.pop_front();
+  v.push_back(T(last));
+
+  std::array<int, N> ret{ };
+  for (std::size_t i = 0; i < N; ++i)
+    ret[i] = v[i].v;
+  return ret;
+}
+
+static_assert(xstd::is_trivially_relocatable_v<CX>);
+constexpr auto cx_squares = make_squares<CX, 8>();
+static_assert(0 == cx_squares[0] && 49 == cx_squares[7]);
+
+static_assert(! xstd::is_trivially_relocatable_v<CY>);
+constexpr auto cy_squares = make_squares<CY, 8>();
+static_assert(0 == cy_squares[0] && 49 == cy_squares[7]);
+
 int main()
 {
+  // With telemetry disabled, its entry points remain callable and do nothing.
+  static_assert(! xstd::relocation_telemetry_enabled);
+  xstd::reset_relocation_telemetry();
+  std::ostringstream telemetry;
+  xstd::dump_relocation_telemetry(telemetry);
+  xstd::dump_all_relocation_telemetry(telemetry);
+  assert(telemetry.str().empty());
+
   simple_test<int>("int");
   simple_test<X>("X");
   simple_test<Y>("Y");
+
+  range_test<int>("int");
+  range_test<X>("X");
+  range_test<Y>("Y");
+
+  // The same code works at run time.
+  auto cx_rt = make_squares<CX, 8>();
+  assert(cx_squares == cx_rt);
 }
 
 // Local Variables:
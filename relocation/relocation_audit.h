@@ -0,0 +1,220 @@
+/* relocation_audit.h                                                 -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// Audit facility for finding types that are relocated by move+destroy but
+/// could be trivially relocated with little effort. At namespace scope,
+///
+///     XSTD_AUDIT_RELOCATION(T, M1, M2, ...);
+///
+/// audits type `T`, where `M1, M2, ...` are the types of `T`'s base classes
+/// and non-static data members. (Without reflection, the subobject types
+/// cannot be discovered automatically; the list may be empty, in which case
+/// no member breakdown is possible.) If `T` is not trivially relocatable, a
+/// compile-time warning is issued whose text says what is preventing trivial
+/// relocation. Every audit is also enrolled in a list that
+/// `print_relocation_audit` prints as a checklist.
+///
+/// Define `XSTD_AUDIT_RELOCATION_WARNINGS` to 0 to suppress the warnings and
+/// keep only the printed report. `T` must be a single token sequence without
+/// top-level commas; use an alias for a template-id with several arguments.
+
+#ifndef INCLUDED_RELOCATION_AUDIT
+#define INCLUDED_RELOCATION_AUDIT
+
+#ifndef XSTD_AUDIT_RELOCATION_WARNINGS
+# define XSTD_AUDIT_RELOCATION_WARNINGS 1
+#endif
+
+#include <defaulted_relocation_ref.h>
+
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace xstd {
+
+/// Classification of a type produced by an audit.
+enum class relocation_verdict
+{
+  trivial,       // Trivially relocatable; nothing to do
+  needs_ctor,    // Eligible, but lacks a defaulted relocation constructor
+  candidate,     // Not eligible, but every listed subobject is TR
+  blocked,       // At least one listed subobject is not TR
+  unknown        // Not TR and no subobjects were listed
+};
+
+inline const char* relocation_verdict_text(relocation_verdict v)
+{
+  switch (v) {
+    case relocation_verdict::trivial:
+      return "trivially relocatable";
+    case relocation_verdict::needs_ctor:
+      return "eligible; add T(defaulted_relocation_ref<T>)";
+    case relocation_verdict::candidate:
+      return "all subobjects TR; declare T::is_eligible_for_TR()";
+    case relocation_verdict::blocked:
+      return "blocked by a non-TR subobject";
+    case relocation_verdict::unknown:
+      return "not TR; list subobjects for a breakdown";
+  }
+  return "";
+}
+
+/// One line of the report.
+struct relocation_audit_entry
+{
+  struct member
+  {
+    string m_name;
+    size_t m_size;
+    bool   m_trivially_relocatable;
+  };
+
+  string             m_name;
+  size_t             m_size;
+  bool               m_eligible;
+  bool               m_trivially_relocatable;
+  relocation_verdict m_verdict;
+  vector<member>     m_members;
+};
+
+/// Return the list of audits enrolled by `XSTD_AUDIT_RELOCATION`.
+inline vector<relocation_audit_entry>& relocation_audit_entries()
+{
+  static vector<relocation_audit_entry> entries;
+  return entries;
+}
+
+/// Split the stringized subobject list at top-level commas.
+inline vector<string> split_relocation_audit_names(string_view names)
+{
+  vector<string> ret;
+  int            depth = 0;
+  string         cur;
+  for (char c : names) {
+    if (',' == c && 0 == depth) {
+      ret.push_back(cur);
+      cur.clear();
+      continue;
+    }
+    if ('<' == c || '(' == c || '[' == c) ++depth;
+    else if ('>' == c || ')' == c || ']' == c) --depth;
+    if (! (' ' == c && cur.empty()))
+      cur += c;
+  }
+  if (! cur.empty())
+    ret.push_back(cur);
+  return ret;
+}
+
+#if XSTD_AUDIT_RELOCATION_WARNINGS
+/// Each member is "called" only to produce a diagnostic that names `T` (in
+/// the instantiation context) and the reason it is not TR.
+template <class T>
+struct relocation_audit_warning
+{
+  [[deprecated("relocated by move+destroy: T is declared eligible for TR "
+               "but has no T(defaulted_relocation_ref<T>) constructor")]]
+  static constexpr void needs_ctor() { }
+
+  [[deprecated("relocated by move+destroy: every subobject of T is TR; "
+               "declaring T::is_eligible_for_TR() would enable memcpy")]]
+  static constexpr void candidate() { }
+
+  [[deprecated("relocated by move+destroy: T has a subobject that is not "
+               "trivially relocatable")]]
+  static constexpr void blocked() { }
+
+  [[deprecated("relocated by move+destroy: T is not trivially relocatable")]]
+  static constexpr void unknown() { }
+};
+#endif
+
+template <class T, class... Members>
+struct relocation_audit
+{
+  static constexpr bool eligible = is_eligible_for_TR_v<T>;
+  static constexpr bool trivially_relocatable = is_trivially_relocatable_v<T>;
+  static constexpr bool members_trivially_relocatable =
+    (is_trivially_relocatable_v<Members> && ...);
+
+  static constexpr relocation_verdict verdict =
+    trivially_relocatable         ? relocation_verdict::trivial    :
+    eligible                      ? relocation_verdict::needs_ctor :
+    0 == sizeof...(Members)       ? relocation_verdict::unknown    :
+    members_trivially_relocatable ? relocation_verdict::candidate  :
+                                    relocation_verdict::blocked;
+
+  /// Issue the compile-time warning for `T`, if any, and add `T` to the
+  /// report under `name`. `members` is the stringized subobject list.
+  static bool enroll(const char* name, const char* members)
+  {
+#if XSTD_AUDIT_RELOCATION_WARNINGS
+    using warning = relocation_audit_warning<T>;
+    if constexpr (relocation_verdict::needs_ctor == verdict)
+      warning::needs_ctor();
+    else if constexpr (relocation_verdict::candidate == verdict)
+      warning::candidate();
+    else if constexpr (relocation_verdict::blocked == verdict)
+      warning::blocked();
+    else if constexpr (relocation_verdict::unknown == verdict)
+      warning::unknown();
+#endif
+
+    vector<string> names = split_relocation_audit_names(members);
+    relocation_audit_entry e{ name, sizeof(T), eligible,
+                              trivially_relocatable, verdict, { } };
+    size_t i = 0;
+    ((e.m_members.push_back({ i < names.size() ? names[i] : string("?"),
+                              sizeof(Members),
+                              is_trivially_relocatable_v<Members> }), ++i),
+     ...);
+    relocation_audit_entries().push_back(std::move(e));
+    return true;
+  }
+};
+
+/// Print every enrolled audit to `os`, one line per type followed by one
+/// indented line per listed subobject. Non-TR types are marked `[ ]`, so
+/// that the report reads as a checklist.
+inline ostream& print_relocation_audit(ostream& os)
+{
+  os << "    " << left << setw(28) << "type" << right << setw(6) << "size"
+     << setw(10) << "eligible" << setw(6) << "TR" << "  verdict\n";
+  for (const relocation_audit_entry& e : relocation_audit_entries()) {
+    bool done = relocation_verdict::trivial == e.m_verdict;
+    os << (done ? "[x] " : "[ ] ") << left << setw(28) << e.m_name
+       << right << setw(6) << e.m_size
+       << setw(10) << (e.m_eligible ? "yes" : "no")
+       << setw(6) << (e.m_trivially_relocatable ? "yes" : "no")
+       << "  " << relocation_verdict_text(e.m_verdict) << '\n';
+    for (const relocation_audit_entry::member& m : e.m_members)
+      os << "      " << left << setw(26) << m.m_name << right
+         << setw(6) << m.m_size << setw(16)
+         << (m.m_trivially_relocatable ? "yes" : "no") << '\n';
+  }
+  return os;
+}
+
+} // close namespace xstd
+
+#define XSTD_AUDIT_RELOCATION_CAT2(a, b) a ## b
+#define XSTD_AUDIT_RELOCATION_CAT(a, b) XSTD_AUDIT_RELOCATION_CAT2(a, b)
+
+#define XSTD_AUDIT_RELOCATION(T, ...)                                       \
+  [[maybe_unused]] static const bool                                        \
+  XSTD_AUDIT_RELOCATION_CAT(xstd_relocation_audit_, __COUNTER__) =          \
+    ::xstd::relocation_audit<T __VA_OPT__(,) __VA_ARGS__>::enroll(          \
+      #T, "" #__VA_ARGS__)
+
+#endif // ! defined(INCLUDED_RELOCATION_AUDIT)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
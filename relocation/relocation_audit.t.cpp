@@ -0,0 +1,155 @@
+/* relocation_audit.t.cpp                                             -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// The compile-time warnings are suppressed here. `make relocation_audit.test`
+// also builds this file as `relocation_audit_warnings.t`, with the warnings
+// enabled, and checks that exactly the expected ones are issued.
+#ifndef XSTD_AUDIT_RELOCATION_WARNINGS
+# define XSTD_AUDIT_RELOCATION_WARNINGS 0
+#endif
+
+#include <relocation_audit.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <iostream>
+#include <cassert>
+
+// Trivially copyable, hence TR
+struct W
+{
+  int v;
+};
+
+// Not trivially destructible, hence not TR; `unique_ptr` is not TR by the
+// current trait, either.
+struct X
+{
+  int                  v;
+  std::unique_ptr<int> p;
+
+  ~X() { }
+};
+
+// Not trivially destructible, hence not TR, but every subobject is TR.
+struct X2
+{
+  int v;
+  W   w;
+
+  ~X2() { }
+};
+
+// Declared eligible for TR, but does not have a defaulted relocation ctor,
+// hence not TR.
+struct Y
+{
+  int v;
+
+  static Y is_eligible_for_TR();
+
+  ~Y() { }
+};
+
+// Declared eligible for TR and has a defaulted relocation ctor, hence TR.
+struct Z
+{
+  int v;
+
+  static Z is_eligible_for_TR();
+
+  Z();
+  Z(xstd::defaulted_relocation_ref<Z>);
+
+  ~Z() { }
+};
+
+// Has a member that is not TR.
+struct S
+{
+  std::string s;
+  int         n;
+};
+
+template <class A, class B>
+struct Pair
+{
+  A a;
+  B b;
+
+  ~Pair() { }
+};
+
+using PairIntW = Pair<int, W>;
+
+// Has a member whose type is a template-id with a comma in it.
+struct Holder
+{
+  Pair<int, W> p;
+  W            w;
+};
+
+XSTD_AUDIT_RELOCATION(W, int);
+XSTD_AUDIT_RELOCATION(X, int, std::unique_ptr<int>);
+XSTD_AUDIT_RELOCATION(X2, int, W);
+XSTD_AUDIT_RELOCATION(Y, int);
+XSTD_AUDIT_RELOCATION(Z, int);
+XSTD_AUDIT_RELOCATION(S, std::string, int);
+XSTD_AUDIT_RELOCATION(S);
+XSTD_AUDIT_RELOCATION(PairIntW, int, W);
+XSTD_AUDIT_RELOCATION(Holder, Pair<int, W>, W);
+
+using xstd::relocation_audit;
+using xstd::relocation_verdict;
+
+static_assert(relocation_verdict::trivial    == relocation_audit<W, int>::verdict);
+static_assert(relocation_verdict::blocked ==
+              relocation_audit<X, int, std::unique_ptr<int>>::verdict);
+static_assert(relocation_verdict::candidate  == relocation_audit<X2, int, W>::verdict);
+static_assert(relocation_verdict::needs_ctor == relocation_audit<Y, int>::verdict);
+static_assert(relocation_verdict::trivial    == relocation_audit<Z, int>::verdict);
+static_assert(relocation_verdict::blocked ==
+              relocation_audit<S, std::string, int>::verdict);
+static_assert(relocation_verdict::unknown    == relocation_audit<S>::verdict);
+static_assert(relocation_verdict::candidate ==
+              relocation_audit<PairIntW, int, W>::verdict);
+static_assert(relocation_verdict::blocked ==
+              relocation_audit<Holder, Pair<int, W>, W>::verdict);
+
+int main()
+{
+  const auto& entries = xstd::relocation_audit_entries();
+  assert(9 == entries.size());
+
+  assert("X2" == entries[2].m_name);
+  assert(relocation_verdict::candidate == entries[2].m_verdict);
+  assert(2 == entries[2].m_members.size());
+  assert("W" == entries[2].m_members[1].m_name);
+  assert(entries[2].m_members[1].m_trivially_relocatable);
+
+  assert("std::string" == entries[5].m_members[0].m_name);
+  assert(! entries[5].m_members[0].m_trivially_relocatable);
+  assert(entries[6].m_members.empty());
+
+  assert(relocation_verdict::candidate == entries[7].m_verdict);
+  assert("int" == entries[7].m_members[0].m_name);
+
+  // Template-ids with commas are split only at top-level commas.
+  assert(2 == entries[8].m_members.size());
+  assert("Pair<int, W>" == entries[8].m_members[0].m_name);
+  assert(! entries[8].m_members[0].m_trivially_relocatable);
+
+  std::ostringstream os;
+  xstd::print_relocation_audit(os);
+  std::cout << os.str();
+  assert(std::string::npos != os.str().find("[x] W "));
+  assert(std::string::npos != os.str().find("[ ] X2 "));
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
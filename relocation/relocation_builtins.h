@@ -0,0 +1,74 @@
+/* relocation_builtins.h                                              -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// Compiler support for trivial relocation, where available. The compiler
+/// knows that many types are safe to relocate with `memcpy` (e.g., types
+/// marked `[[clang::trivial_abi]]` or, under P2786, types declared
+/// `trivially_relocatable_if_eligible` or implicitly trivially relocatable)
+/// that cannot be detected by the library traits. The trait headers in this
+/// directory combine `builtin_is_trivially_relocatable_v` with their own
+/// opt-in mechanisms.
+///
+/// `XSTD_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE` expands to the P2786
+/// class-property specifier when the compiler supports it, and to nothing
+/// otherwise, so a class can be written portably as
+///
+///     class C XSTD_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE { ... };
+
+#ifndef INCLUDED_RELOCATION_BUILTINS
+#define INCLUDED_RELOCATION_BUILTINS
+
+#if defined(__has_builtin)
+# if __has_builtin(__builtin_is_cpp_trivially_relocatable)
+    // P2786 semantics (Clang 21 and later)
+#   define XSTD_BUILTIN_IS_TRIVIALLY_RELOCATABLE(...) \
+      __builtin_is_cpp_trivially_relocatable(__VA_ARGS__)
+# elif __has_builtin(__is_trivially_relocatable)
+    // Older Clang (honors `[[clang::trivial_abi]]`) and GCC, where available
+#   define XSTD_BUILTIN_IS_TRIVIALLY_RELOCATABLE(...) \
+      __is_trivially_relocatable(__VA_ARGS__)
+# endif
+#endif
+
+#ifdef XSTD_BUILTIN_IS_TRIVIALLY_RELOCATABLE
+# define XSTD_HAS_BUILTIN_IS_TRIVIALLY_RELOCATABLE 1
+#else
+# define XSTD_BUILTIN_IS_TRIVIALLY_RELOCATABLE(...) false
+# define XSTD_HAS_BUILTIN_IS_TRIVIALLY_RELOCATABLE 0
+#endif
+
+#if defined(__cpp_trivial_relocatability)
+# define XSTD_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE \
+    trivially_relocatable_if_eligible
+#else
+# define XSTD_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE
+#endif
+
+#include <type_traits>
+
+namespace xstd {
+
+inline constexpr bool has_builtin_is_trivially_relocatable =
+  XSTD_HAS_BUILTIN_IS_TRIVIALLY_RELOCATABLE;
+
+/// True if the compiler reports that `T` is trivially relocatable; always
+/// false if the compiler provides no such builtin. Incomplete, `void`, and
+/// reference types are never trivially relocatable.
+template <class T>
+inline constexpr bool builtin_is_trivially_relocatable_v = false;
+
+template <class T>
+  requires (std::is_object_v<T> && requires { sizeof(T); })
+inline constexpr bool builtin_is_trivially_relocatable_v<T> =
+  XSTD_BUILTIN_IS_TRIVIALLY_RELOCATABLE(T);
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_RELOCATION_BUILTINS)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -0,0 +1,103 @@
+/* relocation_builtins.t.cpp                                          -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+#include <relocate_from.h>
+
+#include <new>
+#include <iostream>
+#include <cassert>
+
+struct Incomplete;
+
+// Trivially copyable, hence TR with or without compiler support.
+struct W
+{
+  int v;
+};
+
+// Not trivially destructible; TR only if the compiler supports P2786.
+class X XSTD_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE
+{
+  int m_value;
+
+public:
+  explicit X(int v = 0) : m_value(v) { }
+  X(X&& other) noexcept : m_value(other.m_value) { }
+  ~X() { }
+
+  int value() const { return m_value; }
+};
+
+// Not trivially destructible and not marked; TR only with an opt-in.
+class Y
+{
+  int m_value;
+
+public:
+  explicit Y(int v = 0) : m_value(v) { }
+  Y(Y&& other) noexcept : m_value(other.m_value) { other.m_value = -1; }
+  ~Y() { }
+};
+
+#if defined(__clang__)
+// Clang's older builtin honors `trivial_abi`.
+struct [[clang::trivial_abi]] Z
+{
+  int *m_p = nullptr;
+
+  Z() = default;
+  Z(Z&& other) noexcept : m_p(other.m_p) { other.m_p = nullptr; }
+  ~Z() { }
+};
+#endif
+
+constexpr bool has_builtin = xstd::has_builtin_is_trivially_relocatable;
+
+static_assert(! xstd::builtin_is_trivially_relocatable_v<void>);
+static_assert(! xstd::builtin_is_trivially_relocatable_v<int&>);
+static_assert(! xstd::builtin_is_trivially_relocatable_v<Incomplete>);
+
+static_assert(has_builtin == xstd::builtin_is_trivially_relocatable_v<int>);
+static_assert(has_builtin == xstd::builtin_is_trivially_relocatable_v<W>);
+static_assert(! xstd::builtin_is_trivially_relocatable_v<Y>);
+
+// The library trait is true whenever the builtin is true.
+static_assert(xstd::is_trivially_relocatable_v<int>);
+static_assert(xstd::is_trivially_relocatable_v<W>);
+static_assert(! xstd::is_trivially_relocatable_v<Y>);
+static_assert(xstd::is_trivially_relocatable_v<X> ==
+              xstd::builtin_is_trivially_relocatable_v<X>);
+
+#if defined(__cpp_trivial_relocatability)
+static_assert(xstd::is_trivially_relocatable_v<X>);
+#endif
+
+#if defined(__clang__) && XSTD_HAS_BUILTIN_IS_TRIVIALLY_RELOCATABLE
+static_assert(xstd::is_trivially_relocatable_v<Z>);
+#endif
+
+int main()
+{
+  // `X` is relocated by `memcpy` if the compiler knows it is TR and by
+  // move+destroy otherwise; either way the value is preserved.
+  union XBuf { X x; XBuf() { } ~XBuf() { } } b;
+  ::new (&b.x) X(5);
+  X x = xstd::relocate_from(&b.x);
+  assert(5 == x.value());
+
+  std::cout << "builtin TR detection: " << (has_builtin ? "yes" : "no")
+            << ", P2786 keyword: "
+#if defined(__cpp_trivial_relocatability)
+            << "yes"
+#else
+            << "no"
+#endif
+            << std::endl;
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
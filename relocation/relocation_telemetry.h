@@ -0,0 +1,274 @@
+/* relocation_telemetry.h                                             -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// Optional instrumentation for the relocation primitives (`relocate_from`,
+/// `relocate`, and `relocate_at`). When the build switch
+/// `XSTD_RELOCATION_TELEMETRY` is defined to a non-zero value, every call to
+/// a primitive records, per type, the number of calls and the number of bytes
+/// relocated via each of three paths: trivial relocation (`memcpy`), a
+/// user-supplied `relocate_at` member (the _member hook_), and move
+/// construction followed by destruction. The counters are thread-local, so
+/// recording costs no synchronization; `dump_relocation_telemetry` prints the
+/// counters of the calling thread. When a thread exits, its counters are
+/// added, under a mutex, to process-wide totals, so that relocations done by
+/// worker and consumer threads are not lost:
+/// `dump_all_relocation_telemetry` prints those totals plus the counters of
+/// the calling thread. (The counters of other threads that are still running
+/// cannot be read safely and are not included.)
+///
+/// When `XSTD_RELOCATION_TELEMETRY` is zero or undefined (the default),
+/// `record_relocation` and `reset_relocation_telemetry` are empty functions,
+/// the dump functions print nothing, and the instrumentation compiles away to
+/// nothing. The switch must have the same value in every
+/// translation unit of a program.
+
+#ifndef INCLUDED_RELOCATION_TELEMETRY
+#define INCLUDED_RELOCATION_TELEMETRY
+
+#ifndef XSTD_RELOCATION_TELEMETRY
+# define XSTD_RELOCATION_TELEMETRY 0
+#endif
+
+#include <cstddef>
+#include <type_traits>
+
+#if XSTD_RELOCATION_TELEMETRY
+# include <cstdlib>
+# include <iomanip>
+# include <mutex>
+# include <ostream>
+# include <string>
+# include <typeinfo>
+# include <vector>
+# if __has_include(<cxxabi.h>)
+#   include <cxxabi.h>
+# endif
+#else
+# include <iosfwd>
+#endif
+
+namespace xstd {
+
+using namespace std;
+
+inline constexpr bool relocation_telemetry_enabled = XSTD_RELOCATION_TELEMETRY;
+
+/// The mechanism by which an object was relocated.
+enum class relocation_path { trivial, member_hook, move_destroy };
+
+inline constexpr size_t relocation_path_count = 3;
+
+#if XSTD_RELOCATION_TELEMETRY
+
+/// Per-type, per-thread relocation counters.
+struct relocation_stats
+{
+  struct counts
+  {
+    size_t m_calls = 0;
+    size_t m_bytes = 0;
+  };
+
+  const type_info  *m_type;
+  size_t            m_object_size;
+  counts            m_counts[relocation_path_count];
+  relocation_stats *m_next;  // Next entry in this thread's list
+
+  const counts& operator[](relocation_path p) const
+    { return m_counts[size_t(p)]; }
+
+  /// Return the head of the calling thread's list of counters, which
+  /// contains an entry for each type relocated by this thread.
+  static relocation_stats*& thread_list()
+  {
+    static thread_local relocation_stats *head = nullptr;
+    return head;
+  }
+
+  relocation_stats(const type_info& type, size_t object_size)
+    : m_type(&type), m_object_size(object_size), m_counts{ }
+    , m_next(thread_list())
+  {
+    thread_list() = this;
+  }
+
+  relocation_stats(const relocation_stats&) = delete;
+  relocation_stats& operator=(const relocation_stats&) = delete;
+
+  // Add the counters to the process-wide totals when the thread exits.
+  ~relocation_stats();
+};
+
+/// Process-wide relocation counters for one type.
+struct relocation_totals
+{
+  const type_info          *m_type;
+  size_t                    m_object_size;
+  relocation_stats::counts  m_counts[relocation_path_count];
+
+  const relocation_stats::counts& operator[](relocation_path p) const
+    { return m_counts[size_t(p)]; }
+};
+
+// Totals of the counters of all threads that have exited.
+struct __relocation_registry
+{
+  mutex                     m_mutex;
+  vector<relocation_totals> m_retired;
+
+  static __relocation_registry& get()
+  {
+    static __relocation_registry registry;
+    return registry;
+  }
+
+  // Add the counters in `stats` to the entry for its type in `totals`.
+  static void add(vector<relocation_totals>& totals,
+                  const relocation_stats& stats)
+  {
+    auto t = totals.begin();
+    while (t != totals.end() && *t->m_type != *stats.m_type)
+      ++t;
+    if (t == totals.end())
+      t = totals.insert(t, { stats.m_type, stats.m_object_size, { } });
+    for (size_t p = 0; p < relocation_path_count; ++p) {
+      t->m_counts[p].m_calls += stats.m_counts[p].m_calls;
+      t->m_counts[p].m_bytes += stats.m_counts[p].m_bytes;
+    }
+  }
+};
+
+inline relocation_stats::~relocation_stats()
+{
+  // Thread-local objects are destroyed in the reverse order of their
+  // construction, so this is the head of the thread's list.
+  thread_list() = m_next;
+
+  __relocation_registry& registry = __relocation_registry::get();
+  lock_guard<mutex> guard(registry.m_mutex);
+  __relocation_registry::add(registry.m_retired, *this);
+}
+
+/// Return the calling thread's relocation counters for type `T`.
+template <class T>
+relocation_stats& relocation_stats_for()
+{
+  static thread_local relocation_stats stats(typeid(T), sizeof(T));
+  return stats;
+}
+
+/// Record that `n` objects of type `T` were relocated by one call to a
+/// relocation primitive via path `p`.
+template <class T>
+constexpr void record_relocation(relocation_path p, size_t n = 1) noexcept
+{
+  if (! is_constant_evaluated()) {
+    relocation_stats::counts& c = relocation_stats_for<T>().m_counts[size_t(p)];
+    ++c.m_calls;
+    c.m_bytes += n * sizeof(T);
+  }
+}
+
+/// Zero all of the calling thread's counters.
+inline void reset_relocation_telemetry()
+{
+  for (relocation_stats *s = relocation_stats::thread_list(); s; s = s->m_next)
+    for (relocation_stats::counts& c : s->m_counts)
+      c = { };
+}
+
+/// Return a human-readable name for `type`.
+inline string relocation_type_name(const type_info& type)
+{
+  string ret = type.name();
+#if __has_include(<cxxabi.h>)
+  int status = 0;
+  if (char *demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr,
+                                            &status)) {
+    ret = demangled;
+    std::free(demangled);
+  }
+#endif
+  return ret;
+}
+
+/// Return, for each type relocated by any thread that has exited or by the
+/// calling thread, the sum of the counters of all of those threads.
+inline vector<relocation_totals> all_relocation_telemetry()
+{
+  vector<relocation_totals> ret;
+  {
+    __relocation_registry& registry = __relocation_registry::get();
+    lock_guard<mutex> guard(registry.m_mutex);
+    ret = registry.m_retired;
+  }
+  for (const relocation_stats *s = relocation_stats::thread_list(); s;
+       s = s->m_next)
+    __relocation_registry::add(ret, *s);
+  return ret;
+}
+
+inline void __dump_relocation_header(ostream& os)
+{
+  os << left << setw(24) << "type" << right << setw(6) << "size"
+     << setw(10) << "trivial" << setw(12) << "bytes"
+     << setw(10) << "member" << setw(12) << "bytes"
+     << setw(10) << "move+dtor" << setw(12) << "bytes" << '\n';
+}
+
+inline void __dump_relocation_row(ostream&                        os,
+                                  const type_info&                type,
+                                  size_t                          object_size,
+                                  const relocation_stats::counts *counts)
+{
+  os << left << setw(24) << relocation_type_name(type)
+     << right << setw(6) << object_size;
+  for (size_t p = 0; p < relocation_path_count; ++p)
+    os << setw(10) << counts[p].m_calls << setw(12) << counts[p].m_bytes;
+  os << '\n';
+}
+
+/// Print a table of the calling thread's counters to `os`, one line per
+/// type, listing calls and bytes for each relocation path.
+inline ostream& dump_relocation_telemetry(ostream& os)
+{
+  __dump_relocation_header(os);
+  for (const relocation_stats *s = relocation_stats::thread_list(); s;
+       s = s->m_next)
+    __dump_relocation_row(os, *s->m_type, s->m_object_size, s->m_counts);
+  return os;
+}
+
+/// Print the same table for `all_relocation_telemetry()`: the counters of
+/// the calling thread and of every thread that has exited.
+inline ostream& dump_all_relocation_telemetry(ostream& os)
+{
+  __dump_relocation_header(os);
+  for (const relocation_totals& t : all_relocation_telemetry())
+    __dump_relocation_row(os, *t.m_type, t.m_object_size, t.m_counts);
+  return os;
+}
+
+#else // if ! XSTD_RELOCATION_TELEMETRY
+
+template <class T>
+constexpr void record_relocation(relocation_path, size_t = 1) noexcept { }
+
+inline void reset_relocation_telemetry() { }
+
+/// Print nothing; there are no counters.
+inline ostream& dump_relocation_telemetry(ostream& os) { return os; }
+inline ostream& dump_all_relocation_telemetry(ostream& os) { return os; }
+
+#endif // ! XSTD_RELOCATION_TELEMETRY
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_RELOCATION_TELEMETRY)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -0,0 +1,175 @@
+/* relocation_telemetry.t.cpp                                         -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+#define XSTD_RELOCATION_TELEMETRY 1
+
+#include <relocate_from.h>
+
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <iostream>
+#include <sstream>
+#include <cassert>
+
+static_assert(xstd::relocation_telemetry_enabled);
+
+/// Not trivially copyable, but warranted trivially relocatable.
+class X
+{
+  int m_value;
+
+public:
+  explicit X(int v = 0) : m_value(v) { }
+  X(const X& other) : m_value(other.m_value) { }
+  ~X() { }
+
+  int value() const { return m_value; }
+};
+
+namespace xstd {
+template <> struct is_trivially_relocatable<X> : true_type { };
+} // close namespace xstd
+
+/// Neither trivially copyable nor trivially relocatable.
+class Y
+{
+  int m_value;
+
+public:
+  explicit Y(int v = 0) : m_value(v) { }
+  Y(Y&& other) noexcept : m_value(other.m_value) { other.m_value = -1; }
+  ~Y() { }
+
+  int value() const { return m_value; }
+};
+
+template <class T>
+union Buf
+{
+  T objs[8];
+  Buf() { }
+  ~Buf() { }
+};
+
+using xstd::relocation_path;
+using xstd::relocation_stats_for;
+
+template <class T>
+void relocate_some()
+{
+  Buf<T> b;
+  for (int i = 0; i < 4; ++i)
+    ::new (&b.objs[i]) T(i);
+
+  T t = xstd::relocate_from(&b.objs[0]);               // 1 object
+  (void) t;
+  T *e = xstd::relocate(b.objs + 1, b.objs + 4, b.objs + 4);  // 3 objects
+  for (T *p = b.objs + 4; p != e; ++p)
+    p->~T();
+}
+
+void test_counters()
+{
+  xstd::reset_relocation_telemetry();
+
+  relocate_some<int>();
+  relocate_some<X>();
+  relocate_some<Y>();
+  relocate_some<Y>();
+
+  const xstd::relocation_stats& si = relocation_stats_for<int>();
+  assert(2 == si[relocation_path::trivial].m_calls);
+  assert(4 * sizeof(int) == si[relocation_path::trivial].m_bytes);
+  assert(0 == si[relocation_path::move_destroy].m_calls);
+
+  const xstd::relocation_stats& sx = relocation_stats_for<X>();
+  assert(2 == sx[relocation_path::trivial].m_calls);
+  assert(4 * sizeof(X) == sx[relocation_path::trivial].m_bytes);
+  assert(0 == sx[relocation_path::move_destroy].m_calls);
+
+  const xstd::relocation_stats& sy = relocation_stats_for<Y>();
+  assert(0 == sy[relocation_path::trivial].m_calls);
+  assert(4 == sy[relocation_path::move_destroy].m_calls);
+  assert(8 * sizeof(Y) == sy[relocation_path::move_destroy].m_bytes);
+  assert(0 == sy[relocation_path::member_hook].m_calls);
+
+  std::ostringstream os;
+  xstd::dump_relocation_telemetry(os);
+  std::cout << os.str();
+  assert(std::string::npos != os.str().find("move+dtor"));
+  assert(std::string::npos != os.str().find("\nY "));
+
+  xstd::reset_relocation_telemetry();
+  assert(0 == sy[relocation_path::move_destroy].m_calls);
+}
+
+void test_thread_local()
+{
+  xstd::reset_relocation_telemetry();
+  relocate_some<Y>();
+
+  std::thread([]{
+    relocate_some<Y>();
+    relocate_some<Y>();
+    assert(4 == relocation_stats_for<Y>()[relocation_path::move_destroy]
+                  .m_calls);
+  }).join();
+
+  assert(2 == relocation_stats_for<Y>()[relocation_path::move_destroy]
+                .m_calls);
+}
+
+/// Relocated only by other threads.
+class Z : public Y
+{
+public:
+  using Y::Y;
+};
+
+void test_exited_threads()
+{
+  xstd::reset_relocation_telemetry();
+  relocate_some<Y>();
+
+  std::thread([]{
+    relocate_some<Y>();
+    relocate_some<Z>();
+  }).join();
+  std::thread([]{ relocate_some<Z>(); }).join();
+
+  // The counters of exited threads are kept in the process-wide totals, and
+  // added to those of the calling thread.
+  assert(0 == relocation_stats_for<Z>()[relocation_path::move_destroy]
+                .m_calls);
+  auto totals = xstd::all_relocation_telemetry();
+  auto count = [&](const std::type_info& type) {
+    for (const xstd::relocation_totals& t : totals)
+      if (*t.m_type == type)
+        return t[relocation_path::move_destroy].m_calls;
+    return std::size_t(0);
+  };
+  assert(4 == count(typeid(Z)));
+  assert(2 + 2 + 4 == count(typeid(Y)));  // Incl. `test_thread_local`'s
+  assert(2 == relocation_stats_for<Y>()[relocation_path::move_destroy]
+                .m_calls);
+
+  std::ostringstream os;
+  xstd::dump_all_relocation_telemetry(os);
+  std::cout << os.str();
+  assert(std::string::npos != os.str().find("\nZ "));
+}
+
+int main()
+{
+  test_counters();
+  test_thread_local();
+  test_exited_threads();
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
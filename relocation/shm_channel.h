@@ -0,0 +1,361 @@
+/* shm_channel.h                                                      -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// This header implements `shm_channel<T>`, a bounded ring buffer that lives
+/// in a POSIX shared-memory object and through which processes on the same
+/// host can hand objects to one another without serializing them. A producer
+/// relocates an object into a slot of the ring and the consumer relocates it
+/// out again using `relocate_from`, so a message costs one byte copy in and
+/// one byte copy out.
+///
+/// Only trivially relocatable types whose value does not depend on the
+/// address space they live in can travel through the channel. A pointer, for
+/// example, is trivially relocatable, but is meaningless in the receiving
+/// process. Because there is no way to detect pointer members in a class, the
+/// `is_address_free` trait is true only for arithmetic and enumeration types
+/// (and arrays of them); a class type must opt in by specializing it.
+///
+/// The ring uses per-slot sequence numbers (as in Dmitry Vyukov's bounded
+/// queue). Every process attached to the channel may push if `MultiProducer`
+/// is true; otherwise only one process at a time may push. In both cases,
+/// only one process at a time may pop.
+
+#ifndef INCLUDED_SHM_CHANNEL
+#define INCLUDED_SHM_CHANNEL
+
+#include <relocate_from.h>
+
+#include <atomic>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <new>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace xstd {
+
+using namespace std;
+
+/// True if the value of a `T` object has the same meaning in every process,
+/// i.e., it contains no pointers, references, or other handles into the
+/// address space of the process that created it.
+template <class T>
+struct is_address_free : bool_constant<is_arithmetic_v<T> || is_enum_v<T>>
+{
+};
+
+template <class T, size_t N>
+struct is_address_free<T[N]> : is_address_free<T> { };
+
+template <class T>
+inline constexpr bool is_address_free_v = is_address_free<T>::value;
+
+template <class T, bool MultiProducer = false>
+requires (is_trivially_relocatable_v<T> && is_address_free_v<T>)
+class shm_channel
+{
+  // Indexes and sequence numbers are shared between processes, so they must
+  // be address free, i.e., lock free.
+  static_assert(atomic<uint64_t>::is_always_lock_free);
+
+  static constexpr uint64_t s_magic = 0x78737464'73686d63;  // "xstdshmc"
+  static constexpr size_t   s_cache_line = 64;
+
+  struct slot
+  {
+    atomic<uint64_t>               m_seq;
+    alignas(T) unsigned char       m_bytes[sizeof(T)];
+  };
+
+  struct header
+  {
+    atomic<uint64_t>               m_magic;       // Set last by the creator
+    uint64_t                       m_value_size;  // `sizeof(T)`
+    uint64_t                       m_capacity;    // Power of 2
+    alignas(s_cache_line) atomic<uint64_t> m_tail;  // Next position to push
+    alignas(s_cache_line) atomic<uint64_t> m_head;  // Next position to pop
+  };
+
+  static constexpr size_t s_slots_offset =
+    (sizeof(header) + alignof(slot) - 1) / alignof(slot) * alignof(slot);
+
+  header *m_header   = nullptr;
+  slot   *m_slots    = nullptr;
+  size_t  m_mask     = 0;
+  size_t  m_map_size = 0;
+  char    m_name[NAME_MAX + 1] = { };  // Non-empty only for the owner
+
+  [[noreturn]] static void throw_errno(const char* what)
+    { throw system_error(errno, generic_category(), what); }
+
+  static size_t map_size(size_t capacity)
+    { return s_slots_offset + capacity * sizeof(slot); }
+
+  void map(int fd, size_t size)
+  {
+    void *addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                        fd, 0);
+    int err = errno;
+    ::close(fd);
+    if (MAP_FAILED == addr) {
+      errno = err;
+      throw_errno("mmap");
+    }
+
+    m_map_size = size;
+    m_header   = static_cast<header*>(addr);
+    m_slots    = reinterpret_cast<slot*>(static_cast<char*>(addr) +
+                                         s_slots_offset);
+  }
+
+  shm_channel() = default;
+
+public:
+  using value_type = T;
+
+  /// Create a new shared-memory object named `name` holding a channel of at
+  /// least `min_capacity` slots, and never fewer than 2: in a one-slot ring,
+  /// the sequence number of a full slot equals that of a slot free for the
+  /// next lap. The returned channel owns the name and unlinks it on
+  /// destruction. Throws `system_error` on failure, including if an object
+  /// named `name` already exists.
+  static shm_channel create(const char* name, size_t min_capacity)
+  {
+    size_t capacity = 2;
+    while (capacity < min_capacity)
+      capacity <<= 1;
+
+    int fd = ::shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+      throw_errno("shm_open");
+
+    if (::ftruncate(fd, map_size(capacity)) < 0) {
+      int err = errno;
+      ::close(fd);
+      ::shm_unlink(name);
+      errno = err;
+      throw_errno("ftruncate");
+    }
+
+    // From here on, `ret` owns the name and is the only one to unlink it.
+    shm_channel ret;
+    std::strncpy(ret.m_name, name, NAME_MAX);
+    ret.map(fd, map_size(capacity));  // On throw, `ret` unlinks `name`
+    ret.m_mask = capacity - 1;
+
+    header *h = ::new (ret.m_header) header;
+    h->m_value_size = sizeof(T);
+    h->m_capacity   = capacity;
+    h->m_tail.store(0, memory_order_relaxed);
+    h->m_head.store(0, memory_order_relaxed);
+    for (size_t i = 0; i < capacity; ++i)
+      ::new (&ret.m_slots[i].m_seq) atomic<uint64_t>(i);
+    h->m_magic.store(s_magic, memory_order_release);
+
+    return ret;
+  }
+
+  /// Attach to the existing channel named `name`, which must have been
+  /// created for the same `T`. Throws `system_error` on failure.
+  static shm_channel open(const char* name)
+  {
+    int fd = ::shm_open(name, O_RDWR, 0);
+    if (fd < 0)
+      throw_errno("shm_open");
+
+    struct stat st;
+    if (::fstat(fd, &st) < 0 || size_t(st.st_size) < sizeof(header)) {
+      int err = errno;
+      ::close(fd);
+      errno = err ? err : EINVAL;
+      throw_errno("fstat");
+    }
+
+    shm_channel ret;
+    ret.map(fd, st.st_size);
+    header *h = ret.m_header;
+    if (h->m_magic.load(memory_order_acquire) != s_magic ||
+        h->m_value_size != sizeof(T) || h->m_capacity < 2 ||
+        map_size(h->m_capacity) > ret.m_map_size) {
+      errno = EINVAL;
+      throw_errno("shm_channel::open");
+    }
+    ret.m_mask = h->m_capacity - 1;
+
+    return ret;
+  }
+
+  shm_channel(shm_channel&& other) noexcept
+    : m_header(exchange(other.m_header, nullptr))
+    , m_slots(exchange(other.m_slots, nullptr))
+    , m_mask(other.m_mask)
+    , m_map_size(other.m_map_size)
+  {
+    std::memcpy(m_name, other.m_name, sizeof(m_name));
+    other.m_name[0] = '\0';
+  }
+
+  shm_channel& operator=(shm_channel&& other) noexcept
+  {
+    shm_channel(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  ~shm_channel()
+  {
+    if (m_header)
+      ::munmap(m_header, m_map_size);
+    if (m_name[0])
+      ::shm_unlink(m_name);
+  }
+
+  void swap(shm_channel& other) noexcept
+  {
+    std::swap(m_header,   other.m_header);
+    std::swap(m_slots,    other.m_slots);
+    std::swap(m_mask,     other.m_mask);
+    std::swap(m_map_size, other.m_map_size);
+    std::swap(m_name,     other.m_name);
+  }
+
+  size_t capacity() const { return m_mask + 1; }
+
+  /// If there is room in the channel, relocate `*from` into it and return
+  /// `true`; the lifetime of `*from` has then ended. Otherwise, return `false`
+  /// and leave `*from` untouched.
+  bool try_push(T *from)
+  {
+    slot *s = claim_slot();
+    if (! s)
+      return false;
+
+    ::new (s->m_bytes) T(relocate_from(from));
+    publish(s);
+    return true;
+  }
+
+  /// Relocate `*from` into the channel, waiting for room if necessary.
+  void push(T *from)
+  {
+    while (! try_push(from))
+      this_thread::yield();
+  }
+
+  /// If there is room in the channel, construct a `T` in it from `args` and
+  /// return `true`; otherwise, return `false`.
+  template <class... Args>
+  bool try_emplace(Args&&... args)
+  {
+    slot *s = claim_slot();
+    if (! s)
+      return false;
+
+    ::new (s->m_bytes) T(std::forward<Args>(args)...);
+    publish(s);
+    return true;
+  }
+
+  /// Relocate the oldest object out of the channel and return it, or return
+  /// `nullopt` if the channel is empty.
+  optional<T> try_pop()
+  {
+    optional<T> ret;
+    if (slot *s = ready_slot()) {
+      releaser r = consume(s);
+      ret.emplace(relocation_source<T>{ object_in(s) });
+    }
+    return ret;
+  }
+
+  /// Relocate the oldest object out of the channel and return it, waiting
+  /// for one to arrive if necessary.
+  T pop()
+  {
+    slot *s;
+    while (! (s = ready_slot()))
+      this_thread::yield();
+
+    releaser r = consume(s);
+    return relocate_from(object_in(s));
+  }
+
+private:
+  /// The destructor of this `struct` releases a slot for reuse by producers
+  /// after the consumer has relocated the object out of it.
+  struct releaser
+  {
+    slot     *m_slot;
+    uint64_t  m_seq;
+    ~releaser() { m_slot->m_seq.store(m_seq, memory_order_release); }
+  };
+
+  static T *object_in(slot *s)
+    { return std::launder(reinterpret_cast<T*>(s->m_bytes)); }
+
+  /// Reserve the slot at the tail of the ring for writing, or return null if
+  /// the ring is full.
+  slot *claim_slot()
+  {
+    atomic<uint64_t>& tail = m_header->m_tail;
+    uint64_t pos = tail.load(memory_order_relaxed);
+    for (;;) {
+      slot *s = &m_slots[pos & m_mask];
+      int64_t dif = int64_t(s->m_seq.load(memory_order_acquire) - pos);
+      if (dif < 0)
+        return nullptr;  // Full
+      else if (dif > 0)
+        pos = tail.load(memory_order_relaxed);  // Another producer won
+      else if constexpr (! MultiProducer) {
+        tail.store(pos + 1, memory_order_relaxed);
+        return s;
+      }
+      else if (tail.compare_exchange_weak(pos, pos + 1,
+                                          memory_order_relaxed))
+        return s;
+    }
+  }
+
+  /// Make the object in the claimed slot `s` visible to the consumer.
+  void publish(slot *s)
+  {
+    uint64_t seq = s->m_seq.load(memory_order_relaxed);
+    s->m_seq.store(seq + 1, memory_order_release);
+  }
+
+  /// Return the slot at the head of the ring if it holds an object, else null.
+  slot *ready_slot()
+  {
+    uint64_t pos = m_header->m_head.load(memory_order_relaxed);
+    slot *s = &m_slots[pos & m_mask];
+    return s->m_seq.load(memory_order_acquire) == pos + 1 ? s : nullptr;
+  }
+
+  /// Advance the head past the ready slot `s` and return a `releaser` that
+  /// will hand `s` back to the producers for the next lap of the ring.
+  releaser consume(slot *s)
+  {
+    uint64_t pos = m_header->m_head.load(memory_order_relaxed);
+    m_header->m_head.store(pos + 1, memory_order_relaxed);
+    return { s, pos + capacity() };
+  }
+};
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_SHM_CHANNEL)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -0,0 +1,274 @@
+/* shm_channel.t.cpp                                                  -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// Run the benchmarks with `make shm_channel.test TEST_ARGS=bench`.
+
+#include <shm_channel.h>
+
+#include <chrono>
+#include <string>
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+/// A market-data record: trivially copyable and free of pointers.
+struct Quote
+{
+  std::uint64_t m_seq;
+  int           m_producer;
+  char          m_symbol[12];
+  double        m_bid;
+  double        m_ask;
+  std::int64_t  m_timestamp_ns;
+};
+
+namespace xstd {
+template <> struct is_address_free<Quote> : true_type { };
+} // close namespace xstd
+
+/// Trivially relocatable, but not address free.
+struct Node
+{
+  Node *m_next;
+};
+
+template <class T>
+concept channel_value = requires { typename xstd::shm_channel<T>; };
+
+static_assert(  channel_value<Quote>);
+static_assert(  channel_value<double>);
+static_assert(  xstd::is_address_free_v<double[4]>);
+static_assert(! channel_value<int*>);
+static_assert(! channel_value<Node>);
+
+std::string channel_name(const char* tag)
+{
+  return "/xstd_shm_channel_" + std::to_string(::getpid()) + '_' + tag;
+}
+
+Quote make_quote(int producer, std::uint64_t seq)
+{
+  Quote q{ seq, producer, "XSTD", 100.0 + seq, 100.5 + seq, 0 };
+  return q;
+}
+
+std::int64_t now_ns()
+{
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(
+    steady_clock::now().time_since_epoch()).count();
+}
+
+/// Fork a child process that runs `f` and exits with the status returned by
+/// `f`.
+template <class F>
+pid_t spawn_process(F f)
+{
+  pid_t pid = ::fork();
+  assert(pid >= 0);
+  if (0 == pid) {
+    int status = 1;
+    try { status = f(); } catch (...) { }
+    std::_Exit(status);
+  }
+  return pid;
+}
+
+void wait_for(pid_t pid)
+{
+  int status = 0;
+  ::waitpid(pid, &status, 0);
+  assert(WIFEXITED(status) && 0 == WEXITSTATUS(status));
+}
+
+void test_single_process()
+{
+  std::string name = channel_name("single");
+  auto ch = xstd::shm_channel<Quote>::create(name.c_str(), 3);
+  assert(4 == ch.capacity());
+
+  assert(! ch.try_pop());
+
+  union QuoteBuf { Quote q; QuoteBuf() { } } buf;
+  for (std::uint64_t i = 0; i < 4; ++i) {
+    ::new (&buf.q) Quote(make_quote(0, i));
+    assert(ch.try_push(&buf.q));
+  }
+  ::new (&buf.q) Quote(make_quote(0, 4));
+  assert(! ch.try_push(&buf.q));  // Full; `buf.q` is untouched
+  assert(4 == buf.q.m_seq);
+
+  for (std::uint64_t i = 0; i < 4; ++i) {
+    std::optional<Quote> q = ch.try_pop();
+    assert(q && i == q->m_seq && 0 == std::strcmp(q->m_symbol, "XSTD"));
+  }
+  assert(! ch.try_pop());
+
+  assert(ch.try_emplace(make_quote(1, 99)));
+  assert(99 == ch.pop().m_seq);
+
+  // A second channel of the same name cannot be created, but can be opened.
+  bool threw = false;
+  try { xstd::shm_channel<Quote>::create(name.c_str(), 4); }
+  catch (const std::system_error&) { threw = true; }
+  assert(threw);
+
+  auto other = xstd::shm_channel<Quote>::open(name.c_str());
+  assert(other.try_emplace(make_quote(2, 7)));
+  assert(7 == ch.pop().m_seq);
+
+  // A requested capacity of 1 gets 2 slots; a one-slot ring would overwrite
+  // unread values.
+  std::string tiny_name = channel_name("tiny");
+  auto tiny = xstd::shm_channel<Quote>::create(tiny_name.c_str(), 1);
+  assert(2 == tiny.capacity());
+  assert(tiny.try_emplace(make_quote(3, 1)));
+  assert(tiny.try_emplace(make_quote(3, 2)));
+  assert(! tiny.try_emplace(make_quote(3, 3)));
+  assert(1 == tiny.pop().m_seq);
+  assert(2 == tiny.pop().m_seq);
+  assert(! tiny.try_pop());
+}
+
+void test_two_processes()
+{
+  constexpr std::uint64_t count = 100000;
+
+  std::string name = channel_name("spsc");
+  auto ch = xstd::shm_channel<Quote>::create(name.c_str(), 64);
+
+  pid_t producer = spawn_process([&]{
+    auto out = xstd::shm_channel<Quote>::open(name.c_str());
+    union QuoteBuf { Quote q; QuoteBuf() { } } buf;
+    for (std::uint64_t i = 0; i < count; ++i) {
+      ::new (&buf.q) Quote(make_quote(1, i));
+      out.push(&buf.q);
+    }
+    return 0;
+  });
+
+  for (std::uint64_t i = 0; i < count; ++i) {
+    Quote q = ch.pop();
+    assert(i == q.m_seq && 1 == q.m_producer && 100.0 + i == q.m_bid);
+  }
+  assert(! ch.try_pop());
+
+  wait_for(producer);
+}
+
+void test_multiple_producers()
+{
+  constexpr int           producers = 3;
+  constexpr std::uint64_t count     = 20000;
+
+  using channel = xstd::shm_channel<Quote, true>;
+
+  std::string name = channel_name("mpsc");
+  auto ch = channel::create(name.c_str(), 16);
+
+  pid_t pids[producers];
+  for (int p = 0; p < producers; ++p)
+    pids[p] = spawn_process([&, p]{
+      auto out = channel::open(name.c_str());
+      for (std::uint64_t i = 0; i < count; ++i)
+        while (! out.try_emplace(make_quote(p, i)))
+          std::this_thread::yield();
+      return 0;
+    });
+
+  // Messages from each producer must arrive in order.
+  std::uint64_t next[producers] = { };
+  for (std::uint64_t i = 0; i < producers * count; ++i) {
+    Quote q = ch.pop();
+    assert(0 <= q.m_producer && q.m_producer < producers);
+    assert(next[q.m_producer]++ == q.m_seq);
+  }
+  for (int p = 0; p < producers; ++p) {
+    assert(count == next[p]);
+    wait_for(pids[p]);
+  }
+}
+
+void bench_throughput()
+{
+  constexpr std::uint64_t count = 2000000;
+
+  std::string name = channel_name("bench_tp");
+  auto ch = xstd::shm_channel<Quote>::create(name.c_str(), 4096);
+
+  std::int64_t start = now_ns();
+  pid_t producer = spawn_process([&]{
+    auto out = xstd::shm_channel<Quote>::open(name.c_str());
+    for (std::uint64_t i = 0; i < count; ++i)
+      while (! out.try_emplace(make_quote(1, i)))
+        std::this_thread::yield();
+    return 0;
+  });
+
+  std::uint64_t sum = 0;
+  for (std::uint64_t i = 0; i < count; ++i)
+    sum += ch.pop().m_seq;
+  std::int64_t elapsed = now_ns() - start;
+  wait_for(producer);
+  assert(count * (count - 1) / 2 == sum);
+
+  std::cout << "throughput: " << count << " x " << sizeof(Quote)
+            << "-byte messages in " << elapsed / 1000000 << " ms ("
+            << double(count) * 1e3 / elapsed << " M msg/s)\n";
+}
+
+void bench_latency()
+{
+  constexpr std::uint64_t count = 100000;
+
+  std::string ping_name = channel_name("bench_ping");
+  std::string pong_name = channel_name("bench_pong");
+  auto ping = xstd::shm_channel<Quote>::create(ping_name.c_str(), 1);
+  auto pong = xstd::shm_channel<Quote>::create(pong_name.c_str(), 1);
+
+  pid_t echo = spawn_process([&]{
+    auto in  = xstd::shm_channel<Quote>::open(ping_name.c_str());
+    auto out = xstd::shm_channel<Quote>::open(pong_name.c_str());
+    union QuoteBuf { Quote q; QuoteBuf() { } } buf;
+    for (std::uint64_t i = 0; i < count; ++i) {
+      ::new (&buf.q) Quote(in.pop());
+      out.push(&buf.q);
+    }
+    return 0;
+  });
+
+  std::int64_t total = 0;
+  for (std::uint64_t i = 0; i < count; ++i) {
+    Quote q = make_quote(0, i);
+    q.m_timestamp_ns = now_ns();
+    ping.try_emplace(q);
+    total += now_ns() - pong.pop().m_timestamp_ns;
+  }
+  wait_for(echo);
+
+  std::cout << "latency: " << total / count / 2 << " ns one-way (average of "
+            << count << " round trips)\n";
+}
+
+int main(int argc, char *argv[])
+{
+  test_single_process();
+  test_two_processes();
+  test_multiple_producers();
+
+  if (argc > 1 && std::string(argv[1]) == "bench") {
+    bench_throughput();
+    bench_latency();
+  }
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
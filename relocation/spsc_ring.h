@@ -0,0 +1,213 @@
+/* spsc_ring.h                                                        -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// This header implements `spsc_ring<T>`, a bounded single-producer/
+/// single-consumer ring buffer optimized for handing off objects in batches.
+///
+/// `push_bulk` and `pop_bulk` move a batch with one call to `relocate` for
+/// each contiguous segment of the ring (at most two) and publish the whole
+/// batch with a single store to the shared tail or head index. For trivially
+/// relocatable types, each segment is thus a single `memmove`.
+///
+/// The producer and consumer each keep a private, cached copy of the other
+/// side's index and re-read the shared index only when the cached value says
+/// the ring is full (for the producer) or empty (for the consumer), so the
+/// cache lines holding the shared indexes do not bounce between the two
+/// threads on every operation.
+
+#ifndef INCLUDED_SPSC_RING
+#define INCLUDED_SPSC_RING
+
+#include <relocate_from.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <span>
+#include <thread>
+#include <new>
+#include <cstddef>
+
+namespace xstd {
+
+using namespace std;
+
+template <class T>
+class spsc_ring
+{
+  static constexpr size_t s_cache_line = 64;
+
+  struct alignas(T) storage { unsigned char m_bytes[sizeof(T)]; };
+
+  // Written by the producer
+  alignas(s_cache_line) atomic<size_t> m_tail;  // Next position to push
+  size_t                               m_cached_head;
+
+  // Written by the consumer
+  alignas(s_cache_line) atomic<size_t> m_head;  // Next position to pop
+  size_t                               m_cached_tail;
+
+  // Read-only after construction
+  alignas(s_cache_line) unique_ptr<storage[]> m_storage;
+  size_t                                      m_mask;
+
+  T *at(size_t pos)
+    { return std::launder(reinterpret_cast<T*>(&m_storage[pos & m_mask])); }
+
+  /// Return the number of free slots, re-reading the head only if the cached
+  /// copy does not show at least `wanted` free slots.
+  size_t free_slots(size_t tail, size_t wanted)
+  {
+    size_t n = capacity() - (tail - m_cached_head);
+    if (n < wanted) {
+      m_cached_head = m_head.load(memory_order_acquire);
+      n = capacity() - (tail - m_cached_head);
+    }
+    return n;
+  }
+
+  /// Return the number of filled slots, re-reading the tail only if the
+  /// cached copy does not show at least `wanted` filled slots.
+  size_t filled_slots(size_t head, size_t wanted)
+  {
+    size_t n = m_cached_tail - head;
+    if (n < wanted) {
+      m_cached_tail = m_tail.load(memory_order_acquire);
+      n = m_cached_tail - head;
+    }
+    return n;
+  }
+
+public:
+  using value_type = T;
+
+  /// Create a ring with room for at least `min_capacity` objects.
+  explicit spsc_ring(size_t min_capacity)
+    : m_tail(0), m_cached_head(0), m_head(0), m_cached_tail(0)
+  {
+    size_t capacity = 1;
+    while (capacity < min_capacity)
+      capacity <<= 1;
+
+    m_storage.reset(new storage[capacity]);
+    m_mask = capacity - 1;
+  }
+
+  spsc_ring(const spsc_ring&) = delete;
+  spsc_ring& operator=(const spsc_ring&) = delete;
+
+  ~spsc_ring()
+  {
+    size_t tail = m_tail.load(memory_order_relaxed);
+    for (size_t pos = m_head.load(memory_order_relaxed); pos != tail; ++pos)
+      at(pos)->~T();
+  }
+
+  size_t capacity() const { return m_mask + 1; }
+
+  // Producer operations
+
+  /// If there is room in the ring, relocate `*from` into it and return
+  /// `true`; the lifetime of `*from` has then ended. Otherwise, return `false`
+  /// and leave `*from` untouched.
+  bool try_push(T *from)
+  {
+    size_t tail = m_tail.load(memory_order_relaxed);
+    if (0 == free_slots(tail, 1))
+      return false;
+
+    ::new ((void*) at(tail)) T(relocate_from(from));
+    m_tail.store(tail + 1, memory_order_release);
+    return true;
+  }
+
+  /// Relocate `*from` into the ring, waiting for room if necessary.
+  void push(T *from)
+  {
+    while (! try_push(from))
+      this_thread::yield();
+  }
+
+  /// Relocate as many objects as will fit, up to `src.size()`, from the front
+  /// of `src` into the ring and return the number relocated. The lifetimes of
+  /// the relocated objects have ended; the rest of `src` is untouched.
+  size_t push_bulk(span<T> src)
+  {
+    size_t tail = m_tail.load(memory_order_relaxed);
+    size_t n    = std::min(src.size(), free_slots(tail, src.size()));
+    if (0 == n)
+      return 0;
+
+    // Relocate into (at most) two contiguous segments, then publish once.
+    size_t first_seg = std::min(n, capacity() - (tail & m_mask));
+    relocate(src.data(), src.data() + first_seg, at(tail));
+    relocate(src.data() + first_seg, src.data() + n, at(0));
+    m_tail.store(tail + n, memory_order_release);
+    return n;
+  }
+
+  // Consumer operations
+
+  /// Relocate the oldest object out of the ring and return it, or return
+  /// `nullopt` if the ring is empty.
+  optional<T> try_pop()
+  {
+    optional<T> ret;
+    size_t head = m_head.load(memory_order_relaxed);
+    if (filled_slots(head, 1)) {
+      ret.emplace(relocation_source<T>{ at(head) });
+      m_head.store(head + 1, memory_order_release);
+    }
+    return ret;
+  }
+
+  /// Relocate the oldest object out of the ring and return it, waiting for
+  /// one to arrive if necessary.
+  T pop()
+  {
+    size_t head = m_head.load(memory_order_relaxed);
+    while (! filled_slots(head, 1))
+      this_thread::yield();
+
+    /// The destructor of this `struct` releases the slot to the producer
+    /// after the return value has been relocated out of it.
+    struct releaser
+    {
+      atomic<size_t> &m_head;
+      size_t          m_pos;
+      ~releaser() { m_head.store(m_pos, memory_order_release); }
+    };
+
+    releaser r{ m_head, head + 1 };
+    return relocate_from(at(head));
+  }
+
+  /// Relocate up to `n` of the oldest objects out of the ring into the
+  /// uninitialized storage starting at `out` and return the number relocated.
+  size_t pop_bulk(T *out, size_t n)
+  {
+    size_t head = m_head.load(memory_order_relaxed);
+    n = std::min(n, filled_slots(head, n));
+    if (0 == n)
+      return 0;
+
+    // Relocate from (at most) two contiguous segments, then release once.
+    size_t first_seg = std::min(n, capacity() - (head & m_mask));
+    out = relocate(at(head), at(head) + first_seg, out);
+    relocate(at(0), at(0) + (n - first_seg), out);
+    m_head.store(head + n, memory_order_release);
+    return n;
+  }
+};
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_SPSC_RING)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
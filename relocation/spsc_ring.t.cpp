@@ -0,0 +1,232 @@
+/* spsc_ring.t.cpp                                                    -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// Run the benchmarks with `make spsc_ring.test TEST_ARGS=bench`.
+
+#include <spsc_ring.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <iostream>
+#include <cassert>
+
+/// A small record, as handed between pipeline stages.
+struct Record
+{
+  long m_seq;
+  int  m_stage;
+  int  m_flags;
+};
+
+/// An object that is not trivially relocatable. Counts live objects.
+class Tracked
+{
+  static int s_live;
+
+  long             m_value;
+  std::string      m_text;
+
+public:
+  explicit Tracked(long v) : m_value(v), m_text(std::to_string(v)) { ++s_live; }
+  Tracked(Tracked&& other) noexcept
+    : m_value(other.m_value), m_text(std::move(other.m_text)) { ++s_live; }
+  ~Tracked() { --s_live; }
+
+  long value() const { return m_value; }
+  const std::string& text() const { return m_text; }
+
+  static int live() { return s_live; }
+};
+
+int Tracked::s_live = 0;
+
+template <class T>
+union Buf
+{
+  T objs[16];
+  Buf() { }
+  ~Buf() { }
+};
+
+template <class T>
+void test_bulk()
+{
+  {
+    xstd::spsc_ring<T> r(8);
+    assert(8 == r.capacity());
+    Buf<T> in, out;
+
+    long next_in = 0, next_out = 0;
+
+    // Push and pop in uneven batches so that the batches wrap around the
+    // end of the ring.
+    for (int round = 0; round < 10; ++round) {
+      for (int i = 0; i < 5; ++i)
+        ::new (&in.objs[i]) T(next_in++);
+      assert(5 == r.push_bulk(std::span<T>(in.objs, 5)));
+
+      std::size_t n = r.pop_bulk(out.objs, 3);
+      assert(3 == n);
+      for (std::size_t i = 0; i < n; ++i) {
+        assert(next_out++ == out.objs[i].value());
+        out.objs[i].~T();
+      }
+
+      n = r.pop_bulk(out.objs, 16);
+      assert(2 == n);
+      for (std::size_t i = 0; i < n; ++i) {
+        assert(next_out++ == out.objs[i].value());
+        out.objs[i].~T();
+      }
+    }
+
+    // A batch that does not fit is pushed partially.
+    for (int i = 0; i < 10; ++i)
+      ::new (&in.objs[i]) T(next_in++);
+    assert(8 == r.push_bulk(std::span<T>(in.objs, 10)));
+    assert(0 == r.push_bulk(std::span<T>(in.objs + 8, 2)));
+    in.objs[8].~T();
+    in.objs[9].~T();
+    assert(0 == r.pop_bulk(out.objs, 0));
+
+    // Single-element operations interoperate with bulk ones.
+    assert(next_out++ == r.pop().value());
+    assert(next_out++ == r.try_pop()->value());
+    // Six objects are left in the ring to be destroyed with it.
+  }
+}
+
+void test_tracked_lifetimes()
+{
+  test_bulk<Tracked>();
+  assert(0 == Tracked::live());
+}
+
+struct Value
+{
+  long m_value;
+  explicit Value(long v) : m_value(v) { }
+  long value() const { return m_value; }
+};
+
+void test_two_threads()
+{
+  constexpr long count = 200000;
+
+  xstd::spsc_ring<Record> r(256);
+  std::thread producer([&]{
+    Record batch[32];
+    for (long seq = 0; seq < count; ) {
+      std::size_t n = std::min<long>(1 + seq % 32, count - seq);
+      for (std::size_t i = 0; i < n; ++i)
+        batch[i] = Record{ seq + long(i), 1, 0 };
+      std::size_t pushed = 0;
+      while (pushed < n) {
+        std::size_t k = r.push_bulk(std::span<Record>(batch + pushed,
+                                                      n - pushed));
+        if (0 == k)
+          std::this_thread::yield();
+        pushed += k;
+      }
+      seq += n;
+    }
+  });
+
+  Record out[20];
+  for (long seq = 0; seq < count; ) {
+    std::size_t n = r.pop_bulk(out, 20);
+    if (0 == n)
+      std::this_thread::yield();
+    for (std::size_t i = 0; i < n; ++i)
+      assert(seq++ == out[i].m_seq);
+  }
+  producer.join();
+}
+
+/// Pass `count` records from a producer thread to the consumer in batches of
+/// `batch` (using single-element operations if `batch` is 1) and return the
+/// elapsed time in nanoseconds per record.
+double bench_transfer(long count, std::size_t batch)
+{
+  xstd::spsc_ring<Record> r(1024);
+  auto start = std::chrono::steady_clock::now();
+
+  std::thread producer([&]{
+    Record buf[256];
+    for (long seq = 0; seq < count; ) {
+      if (1 == batch) {
+        buf[0] = Record{ seq, 1, 0 };
+        while (! r.try_push(buf))
+          std::this_thread::yield();
+        ++seq;
+        continue;
+      }
+      std::size_t n = std::min<long>(batch, count - seq);
+      for (std::size_t i = 0; i < n; ++i)
+        buf[i] = Record{ seq + long(i), 1, 0 };
+      for (std::size_t pushed = 0; pushed < n; ) {
+        std::size_t k = r.push_bulk(std::span<Record>(buf + pushed,
+                                                      n - pushed));
+        if (0 == k)
+          std::this_thread::yield();
+        pushed += k;
+      }
+      seq += n;
+    }
+  });
+
+  long sum = 0;
+  Record out[256];
+  for (long received = 0; received < count; ) {
+    if (1 == batch) {
+      if (std::optional<Record> rec = r.try_pop()) {
+        sum += rec->m_seq;
+        ++received;
+      }
+      else
+        std::this_thread::yield();
+      continue;
+    }
+    std::size_t n = r.pop_bulk(out, batch);
+    if (0 == n)
+      std::this_thread::yield();
+    for (std::size_t i = 0; i < n; ++i)
+      sum += out[i].m_seq;
+    received += n;
+  }
+  producer.join();
+
+  std::chrono::duration<double, std::nano> elapsed =
+    std::chrono::steady_clock::now() - start;
+  assert(count * (count - 1) / 2 == sum);
+  return elapsed.count() / count;
+}
+
+void bench_batching()
+{
+  constexpr long count = 4000000;
+
+  std::cout << "batch  ns/record\n";
+  for (std::size_t batch = 1; batch <= 256; batch *= 4)
+    std::cout << batch << (1 == batch ? " (push/pop)" : "") << '\t'
+              << bench_transfer(count, batch) << '\n';
+}
+
+int main(int argc, char *argv[])
+{
+  test_bulk<Value>();
+  test_tracked_lifetimes();
+  test_two_threads();
+
+  if (argc > 1 && std::string(argv[1]) == "bench")
+    bench_batching();
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
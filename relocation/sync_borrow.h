@@ -0,0 +1,299 @@
+/* sync_borrow.h                                                      -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// Thread-safe variant of the `RustObj`/`RustRef` borrow model in `borrow.h`.
+/// A `SyncRustObj<T>` can be borrowed from any thread, either shared
+/// (`SyncRustRef<const T>`) or mutably (`SyncRustRef<T>`). Rather than
+/// asserting, a conflicting borrow waits, as with a reader-writer lock. All
+/// of the borrow state is kept in a single atomic word:
+///
+///     bit  0      a mutable borrow is outstanding
+///     bit  1      a mutable borrow is waiting; new shared borrows wait
+///     bits 2-31   number of outstanding shared borrows
+///     bits 32-63  version, incremented when each mutable borrow ends
+///
+/// The version makes the word double as a seqlock: `optimistic_apply` copies
+/// the value without taking a borrow and retries if a mutable borrow was
+/// outstanding or ended in the meantime, so optimistic readers never write to
+/// the shared cache line. Because the callback sees a byte-wise snapshot that
+/// may have been torn (and is discarded if so), `optimistic_apply` requires
+/// `T` to be trivially copyable.
+///
+/// Borrowers access the value itself with ordinary loads and stores, which
+/// must not race with the optimistic readers. So for a trivially copyable
+/// `T`, the object also keeps a copy of the value's bytes as an array of
+/// words, which only optimistic readers read and which is rewritten, with
+/// relaxed atomic stores, when each mutable borrow ends (while the writer bit
+/// is still set). Optimistic readers copy these words, again atomically, into
+/// a buffer of their own. Every access that may be concurrent is thus atomic,
+/// and the seqlock is free of data races; TSAN reports none.
+
+#ifndef INCLUDED_SYNC_BORROW
+#define INCLUDED_SYNC_BORROW
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace xstd {
+
+template <class T>
+class SyncRustObj;
+
+template <class T>
+class SyncRustRef;
+
+template <class T>
+class SyncRustObj
+{
+  static_assert(! std::is_const_v<T>, "Use SyncRustObj<T>, not <const T>");
+
+  friend class SyncRustRef<T>;
+  friend class SyncRustRef<const T>;
+
+  static constexpr std::uint64_t writer_bit  = 1;
+  static constexpr std::uint64_t pending_bit = 2;
+  static constexpr std::uint64_t reader_one  = 4;
+  static constexpr std::uint64_t reader_mask = 0xfffffffc;
+  static constexpr std::uint64_t version_one = std::uint64_t(1) << 32;
+
+  static constexpr std::size_t num_words =
+    (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+  using word_ref = std::atomic_ref<std::uint64_t>;
+  using words    = std::array<std::uint64_t, num_words>;
+  struct no_words { };
+
+  alignas(64) std::atomic<std::uint64_t> m_word = 0;
+  T                                      m_value;
+
+  // Copy of the bytes of `m_value` for optimistic readers, accessed only
+  // through `word_ref`.
+  alignas(word_ref::required_alignment) [[no_unique_address]]
+  std::conditional_t<std::is_trivially_copyable_v<T>, words, no_words>
+    m_snapshot;
+
+  // Publish the value to optimistic readers. Called at construction and,
+  // with the writer bit set, at the end of each mutable borrow.
+  void publish()
+  {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      words w{};
+      std::memcpy(w.data(), std::addressof(m_value), sizeof(T));
+      for (std::size_t i = 0; i < num_words; ++i)
+        word_ref(m_snapshot[i]).store(w[i], std::memory_order_relaxed);
+    }
+  }
+
+  static void pause() { std::this_thread::yield(); }
+
+  bool try_lock_shared()
+  {
+    std::uint64_t w = m_word.load(std::memory_order_relaxed);
+    while (! (w & (writer_bit | pending_bit)))
+      if (m_word.compare_exchange_weak(w, w + reader_one,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed))
+        return true;
+    return false;
+  }
+
+  void lock_shared()
+  {
+    while (! try_lock_shared())
+      pause();
+  }
+
+  void unlock_shared()
+    { m_word.fetch_sub(reader_one, std::memory_order_release); }
+
+  bool try_lock()
+  {
+    std::uint64_t w = m_word.load(std::memory_order_relaxed);
+    while (! (w & (writer_bit | reader_mask)))
+      if (m_word.compare_exchange_weak(w, (w | writer_bit) & ~pending_bit,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed)) {
+        // Order the mutations after the writer bit for optimistic readers.
+        std::atomic_thread_fence(std::memory_order_release);
+        return true;
+      }
+    return false;
+  }
+
+  void lock()
+  {
+    while (! try_lock()) {
+      // Keep new shared borrows out until this mutable borrow gets in.
+      m_word.fetch_or(pending_bit, std::memory_order_relaxed);
+      pause();
+    }
+  }
+
+  void unlock()
+  {
+    publish();
+
+    // Clear the writer bit and bump the version in one step.
+    m_word.fetch_add(version_one - writer_bit, std::memory_order_release);
+  }
+
+public:
+  template <class... Args>
+    requires std::is_constructible_v<T, Args...>
+  explicit SyncRustObj(Args&&... args) : m_value(std::forward<Args>(args)...)
+  {
+    publish();
+  }
+
+  SyncRustObj(const SyncRustObj&) = delete;
+  SyncRustObj& operator=(const SyncRustObj&) = delete;
+
+  /// Borrow the value immutably, waiting for any mutable borrow to end.
+  SyncRustRef<const T> borrow()
+    { lock_shared(); return SyncRustRef<const T>(this); }
+
+  /// Borrow the value mutably, waiting for all other borrows to end.
+  SyncRustRef<T> borrow_mut() { lock(); return SyncRustRef<T>(this); }
+
+  std::optional<SyncRustRef<const T>> try_borrow()
+  {
+    if (! try_lock_shared())
+      return std::nullopt;
+    return SyncRustRef<const T>(this);
+  }
+
+  std::optional<SyncRustRef<T>> try_borrow_mut()
+  {
+    if (! try_lock())
+      return std::nullopt;
+    return SyncRustRef<T>(this);
+  }
+
+  template <class F, class... Args>
+  decltype(auto) apply(F&& f, Args&&... args)
+  {
+    return borrow().apply(std::forward<F>(f), std::forward<Args>(args)...);
+  }
+
+  template <class F, class... Args>
+  decltype(auto) mapply(F&& f, Args&&... args)
+  {
+    return borrow_mut().mapply(std::forward<F>(f),
+                               std::forward<Args>(args)...);
+  }
+
+  /// Invoke `f` on a consistent snapshot of the value without taking a
+  /// borrow, retrying while a mutable borrow is outstanding or if one ended
+  /// during the copy. `f` must not retain the reference it is passed.
+  template <class F, class... Args>
+    requires std::is_trivially_copyable_v<T>
+  auto optimistic_apply(F&& f, Args&&... args)
+  {
+    words snap;
+    for (;;) {
+      std::uint64_t before = m_word.load(std::memory_order_acquire);
+      if (before & writer_bit) {
+        pause();
+        continue;
+      }
+      for (std::size_t i = 0; i < num_words; ++i)
+        snap[i] = word_ref(m_snapshot[i]).load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      std::uint64_t after = m_word.load(std::memory_order_relaxed);
+      if (! (after & writer_bit) &&
+          (before ^ after) < version_one)  // Same version
+        break;
+    }
+
+    // Copying the bytes into suitable storage implicitly creates a `T`.
+    alignas(T) unsigned char value[sizeof(T)];
+    std::memcpy(value, snap.data(), sizeof(T));
+    const T& v = *std::launder(reinterpret_cast<const T*>(value));
+    return std::forward<F>(f)(v, std::forward<Args>(args)...);
+  }
+};
+
+/// Mutable borrow of a `SyncRustObj<T>`.
+template <class T>
+class SyncRustRef
+{
+  friend class SyncRustObj<T>;
+
+  SyncRustObj<T>* m_obj_p;
+
+  explicit SyncRustRef(SyncRustObj<T>* obj_p) : m_obj_p(obj_p) { }
+
+public:
+  SyncRustRef(SyncRustRef&& rhs) : m_obj_p(std::exchange(rhs.m_obj_p, nullptr))
+    { }
+
+  ~SyncRustRef() { if (m_obj_p) m_obj_p->unlock(); }
+
+  void drop() { m_obj_p->unlock(); m_obj_p = nullptr; }
+
+  template <class F, class... Args>
+  decltype(auto) apply(F&& f, Args&&... args)
+  {
+    return std::forward<F>(f)(const_cast<const T&>(m_obj_p->m_value),
+                              std::forward<Args>(args)...);
+  }
+
+  template <class F, class... Args>
+  decltype(auto) mapply(F&& f, Args&&... args)
+  {
+    return std::forward<F>(f)(m_obj_p->m_value, std::forward<Args>(args)...);
+  }
+};
+
+/// Shared borrow of a `SyncRustObj<T>`.
+template <class T>
+class SyncRustRef<const T>
+{
+  friend class SyncRustObj<T>;
+
+  SyncRustObj<T>* m_obj_p;
+
+  explicit SyncRustRef(SyncRustObj<T>* obj_p) : m_obj_p(obj_p) { }
+
+public:
+  /// Copying a shared borrow does not wait for a pending mutable borrow,
+  /// which could not proceed until this borrow ends anyway.
+  SyncRustRef(const SyncRustRef& rhs) : m_obj_p(rhs.m_obj_p)
+  {
+    m_obj_p->m_word.fetch_add(SyncRustObj<T>::reader_one,
+                              std::memory_order_relaxed);
+  }
+
+  SyncRustRef(SyncRustRef&& rhs) : m_obj_p(std::exchange(rhs.m_obj_p, nullptr))
+    { }
+
+  ~SyncRustRef() { if (m_obj_p) m_obj_p->unlock_shared(); }
+
+  void drop() { m_obj_p->unlock_shared(); m_obj_p = nullptr; }
+
+  template <class F, class... Args>
+  decltype(auto) apply(F&& f, Args&&... args)
+  {
+    return std::forward<F>(f)(const_cast<const T&>(m_obj_p->m_value),
+                              std::forward<Args>(args)...);
+  }
+};
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_SYNC_BORROW)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -0,0 +1,161 @@
+/* sync_borrow.t.cpp                                                  -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// Run the benchmarks with `make sync_borrow.test TEST_ARGS=bench CXXOPT=-O2`.
+
+#include <sync_borrow.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <cassert>
+
+/// Value whose fields must always be mutually consistent.
+struct Quad
+{
+  long a = 0, b = 0, c = 0, d = 0;
+
+  bool consistent() const { return b == 2 * a && c == 3 * a && d == 4 * a; }
+  void set(long v) { a = v; b = 2 * v; c = 3 * v; d = 4 * v; }
+};
+
+void test_single_thread()
+{
+  xstd::SyncRustObj<std::string> s("hello");
+
+  {
+    auto r1 = s.borrow();
+    auto r2 = r1;
+    assert(5 == r2.apply([](const std::string& v){ return v.size(); }));
+    assert(! s.try_borrow_mut());       // Shared borrows exclude mutation
+    assert(s.try_borrow());             // ... but not other shared borrows
+  }
+
+  {
+    auto m = s.borrow_mut();
+    m.mapply([](std::string& v, const char* t){ v += t; }, " world");
+    assert(! s.try_borrow());           // A mutable borrow excludes all
+    assert(! s.try_borrow_mut());
+    auto m2 = std::move(m);
+    m2.drop();
+    assert(s.try_borrow_mut());
+  }
+
+  assert(11 == s.apply([](const std::string& v){ return v.size(); }));
+  s.mapply([](std::string& v){ v.clear(); });
+  assert(s.apply([](const std::string& v){ return v.empty(); }));
+
+  xstd::SyncRustObj<Quad> q;
+  q.mapply([](Quad& v){ v.set(7); });
+  assert(28 == q.optimistic_apply([](const Quad& v){ return v.d; }));
+}
+
+/// Readers check that they never observe a half-updated `Quad`, whether
+/// they borrow or read optimistically.
+void test_threads()
+{
+  constexpr int writes = 20000;
+
+  xstd::SyncRustObj<Quad> q;
+  std::atomic<bool> done = false;
+  std::atomic<long> reads = 0;
+
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 3; ++i)
+    readers.emplace_back([&, i]{
+      do {  // At least once, even if the writer finishes first
+        bool ok = (i % 2)
+          ? q.apply([](const Quad& v){ return v.consistent(); })
+          : q.optimistic_apply([](const Quad& v){ return v.consistent(); });
+        assert(ok);
+        ++reads;
+      } while (! done);
+    });
+
+  for (long v = 1; v <= writes; ++v)
+    q.mapply([v](Quad& x){ x.set(v); });
+  done = true;
+  for (std::thread& t : readers)
+    t.join();
+
+  assert(writes == q.apply([](const Quad& v){ return v.a; }));
+  assert(reads > 0);
+}
+
+/// Run `threads` threads for a fixed number of operations each, one in
+/// `write_every` of which writes, and return millions of operations per
+/// second.
+template <class Read, class Write>
+double bench(int threads, int write_every, Read read, Write write)
+{
+  constexpr int ops = 400000;
+
+  std::vector<std::thread> pool;
+  auto start = std::chrono::steady_clock::now();
+  for (int t = 0; t < threads; ++t)
+    pool.emplace_back([&, t]{
+      long sum = 0;
+      for (int i = 0; i < ops; ++i) {
+        if (0 == (i + t) % write_every)
+          write(i);
+        else
+          sum += read();
+      }
+      assert(sum >= 0);
+    });
+  for (std::thread& t : pool)
+    t.join();
+  std::chrono::duration<double, std::micro> elapsed =
+    std::chrono::steady_clock::now() - start;
+  return threads * ops / elapsed.count();
+}
+
+void bench_read_heavy()
+{
+  xstd::SyncRustObj<Quad> q;
+  std::shared_mutex       mtx;
+  Quad                    guarded;
+
+  auto borrow_read  = [&]{ return q.apply([](const Quad& v){ return v.b; }); };
+  auto optimistic   = [&]{
+    return q.optimistic_apply([](const Quad& v){ return v.b; });
+  };
+  auto borrow_write = [&](long v){ q.mapply([v](Quad& x){ x.set(v); }); };
+  auto mutex_read   = [&]{
+    std::shared_lock lk(mtx);
+    return guarded.b;
+  };
+  auto mutex_write  = [&](long v){
+    std::unique_lock lk(mtx);
+    guarded.set(v);
+  };
+
+  std::cout << "Mops/s; one write per 100 operations\n"
+            << "threads  shared_mutex  borrow  optimistic\n";
+  for (int threads = 1; threads <= 8; threads *= 2)
+    std::cout << threads
+              << "\t " << bench(threads, 100, mutex_read, mutex_write)
+              << "\t\t" << bench(threads, 100, borrow_read, borrow_write)
+              << "\t" << bench(threads, 100, optimistic, borrow_write) << '\n';
+}
+
+int main(int argc, char *argv[])
+{
+  test_single_thread();
+  test_threads();
+
+  if (argc > 1 && std::string(argv[1]) == "bench")
+    bench_read_heavy();
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
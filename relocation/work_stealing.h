@@ -0,0 +1,532 @@
+/* work_stealing.h                                                    -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+/// This header implements a fork-join executor built from three pieces:
+///
+/// * `inline_task`: a type-erased, move-only `void()` callable that occupies
+///   exactly one cache line. A callable that is trivially relocatable and fits
+///   in the task's small buffer is stored inline; any other callable is
+///   stored on the heap and the task holds only a pointer to it. Either way,
+///   an `inline_task` is itself trivially relocatable, so spawning and
+///   stealing a task is a copy of one cache line, with no move constructor.
+///
+/// * `ws_deque<T>`: a Chase-Lev work-stealing deque of trivially relocatable
+///   objects. The owning thread pushes and pops at the bottom; any thread may
+///   steal from the top.
+///
+/// * `work_stealing_pool`, `task_group`, and `parallel_for`: a thread pool
+///   with one `ws_deque<inline_task>` per worker and an `mpmc_queue` for tasks
+///   submitted from outside the pool. `task_group::spawn` forks a task and
+///   `task_group::sync` joins all tasks in the group, executing queued tasks
+///   (rather than blocking) while it waits.
+
+#ifndef INCLUDED_WORK_STEALING
+#define INCLUDED_WORK_STEALING
+
+#include <relocate_from.h>
+#include <mpmc_queue.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace xstd {
+
+using namespace std;
+
+inline constexpr size_t task_cache_line = 64;
+
+/// Type-erased `void()` callable occupying one cache line.
+class alignas(task_cache_line) inline_task
+{
+  struct ops
+  {
+    void (*m_run)(void *buf);      // Invoke, then destroy, the callable
+    void (*m_destroy)(void *buf);  // Destroy the callable without invoking
+  };
+
+  union buf
+  {
+    array<void*, task_cache_line / sizeof(void*) - 1> sizer;  // Set size
+    char bytes[sizeof(sizer)];
+    constexpr buf() {}
+  };
+
+  const ops *m_ops = nullptr;
+  buf        m_buffer;
+
+  template <class F>
+  static constexpr bool is_inline_v =
+    is_trivially_relocatable_v<F> && sizeof(F) <= sizeof(buf) &&
+    alignof(F) <= alignof(buf);
+
+  template <class F>
+  static void run_inline(void *p)
+  {
+    /// The destructor of this `struct` invokes the destructor for `obj`.
+    struct destroyer
+    {
+      F *obj;
+      ~destroyer() { obj->~F(); }
+    };
+
+    destroyer d{ static_cast<F*>(p) };
+    (*d.obj)();
+  }
+
+  template <class F>
+  static void destroy_inline(void *p) { static_cast<F*>(p)->~F(); }
+
+  template <class F>
+  static void run_boxed(void *p)
+    { unique_ptr<F> f(*static_cast<F**>(p)); (*f)(); }
+
+  template <class F>
+  static void destroy_boxed(void *p) { delete *static_cast<F**>(p); }
+
+  template <class F>
+  static constexpr ops s_ops = is_inline_v<F> ?
+    ops{ run_inline<F>, destroy_inline<F> } :
+    ops{ run_boxed<F>, destroy_boxed<F> };
+
+public:
+  inline_task() = default;
+
+  template <class F>
+  requires (! is_same_v<decay_t<F>, inline_task> &&
+            is_invocable_r_v<void, decay_t<F>&>)
+  inline_task(F&& f) : m_ops(&s_ops<decay_t<F>>)
+  {
+    using Fn = decay_t<F>;
+    if constexpr (is_inline_v<Fn>)
+      ::new ((void*) m_buffer.bytes) Fn(std::forward<F>(f));
+    else
+      ::new ((void*) m_buffer.bytes) Fn*(new Fn(std::forward<F>(f)));
+  }
+
+  inline_task(inline_task&& other) noexcept
+    : m_ops(exchange(other.m_ops, nullptr))
+  {
+    std::memcpy(m_buffer.bytes, other.m_buffer.bytes, sizeof(buf));
+  }
+
+  inline_task& operator=(inline_task&& other) noexcept
+  {
+    if (this != &other) {
+      this->~inline_task();
+      ::new ((void*) this) inline_task(std::move(other));
+    }
+    return *this;
+  }
+
+  ~inline_task() { if (m_ops) m_ops->m_destroy(m_buffer.bytes); }
+
+  explicit operator bool() const { return m_ops; }
+
+  /// Return true if a callable of type `F` would be stored inline.
+  template <class F>
+  static constexpr bool stores_inline() { return is_inline_v<decay_t<F>>; }
+
+  /// Invoke the stored callable, leaving this task empty.
+  void operator()() { exchange(m_ops, nullptr)->m_run(m_buffer.bytes); }
+};
+
+static_assert(sizeof(inline_task) == task_cache_line);
+
+template <>
+struct is_trivially_relocatable<inline_task> : true_type { };
+
+/// Chase-Lev work-stealing deque (in the formulation of Lê, Pop, Cohen, and
+/// Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory
+/// Models", 2013) holding trivially relocatable objects. Elements are stored
+/// as arrays of words that are read and written with relaxed atomic
+/// operations, so a thief may copy an element that the owner is concurrently
+/// overwriting; such a copy is discarded when the thief loses the race for
+/// the top index. The deque grows as needed; retired arrays are kept until
+/// the deque is destroyed, because a thief might still be reading one.
+template <class T>
+requires (is_trivially_relocatable_v<T>)
+class ws_deque
+{
+  static constexpr size_t s_words = (sizeof(T) + 7) / 8;
+
+  struct slot { atomic<uint64_t> m_words[s_words]; };
+
+  struct ring
+  {
+    int64_t          m_capacity;  // Power of 2
+    unique_ptr<slot[]> m_slots;
+
+    explicit ring(int64_t capacity)
+      : m_capacity(capacity), m_slots(new slot[capacity]) { }
+
+    /// Relocate `*from` into position `i`.
+    void put(int64_t i, T *from)
+    {
+      alignas(T) uint64_t words[s_words] = { };
+      relocate(from, from + 1, reinterpret_cast<T*>(words));
+      slot& s = m_slots[i & (m_capacity - 1)];
+      for (size_t w = 0; w < s_words; ++w)
+        s.m_words[w].store(words[w], memory_order_relaxed);
+    }
+
+    /// Copy the bytes of the element at position `i` into `*to`. The result
+    /// is an object only if the caller then wins the element.
+    void get(int64_t i, uint64_t *to) const
+    {
+      const slot& s = m_slots[i & (m_capacity - 1)];
+      for (size_t w = 0; w < s_words; ++w)
+        to[w] = s.m_words[w].load(memory_order_relaxed);
+    }
+  };
+
+  /// Raw storage for an element copied out of the deque.
+  union element
+  {
+    uint64_t m_words[s_words];
+    T        m_obj;
+    element() { }
+    ~element() { }
+  };
+
+  alignas(task_cache_line) atomic<int64_t> m_top;
+  alignas(task_cache_line) atomic<int64_t> m_bottom;
+  atomic<ring*>                            m_ring;
+  vector<unique_ptr<ring>>                 m_rings;  // Owner only
+
+  ring *grow(ring *r, int64_t top, int64_t bottom)
+  {
+    m_rings.push_back(make_unique<ring>(r->m_capacity * 2));
+    ring *bigger = m_rings.back().get();
+    element e;
+    for (int64_t i = top; i < bottom; ++i) {
+      r->get(i, e.m_words);
+      bigger->put(i, &e.m_obj);
+    }
+    m_ring.store(bigger, memory_order_release);
+    return bigger;
+  }
+
+public:
+  explicit ws_deque(int64_t initial_capacity = 64)
+    : m_top(0), m_bottom(0)
+  {
+    int64_t capacity = 2;
+    while (capacity < initial_capacity)
+      capacity <<= 1;
+    m_rings.push_back(make_unique<ring>(capacity));
+    m_ring.store(m_rings.back().get(), memory_order_relaxed);
+  }
+
+  ws_deque(const ws_deque&) = delete;
+  ws_deque& operator=(const ws_deque&) = delete;
+
+  ~ws_deque() { while (pop()) { } }
+
+  /// Owner only: relocate `*from` onto the bottom of the deque.
+  void push(T *from)
+  {
+    int64_t b = m_bottom.load(memory_order_relaxed);
+    int64_t t = m_top.load(memory_order_acquire);
+    ring   *r = m_ring.load(memory_order_relaxed);
+    if (b - t > r->m_capacity - 1)
+      r = grow(r, t, b);
+    r->put(b, from);
+    atomic_thread_fence(memory_order_release);
+    m_bottom.store(b + 1, memory_order_relaxed);
+  }
+
+  /// Owner only: construct a `T` from `args` on the bottom of the deque.
+  template <class... Args>
+  void emplace(Args&&... args)
+  {
+    element e;
+    ::new ((void*) &e.m_obj) T(std::forward<Args>(args)...);
+    push(&e.m_obj);
+  }
+
+  /// Owner only: relocate the most recently pushed element out of the deque
+  /// and return it, or return `nullopt` if the deque is empty.
+  optional<T> pop()
+  {
+    int64_t b = m_bottom.load(memory_order_relaxed) - 1;
+    ring   *r = m_ring.load(memory_order_relaxed);
+    m_bottom.store(b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t t = m_top.load(memory_order_relaxed);
+
+    optional<T> ret;
+    if (t <= b) {
+      element e;
+      r->get(b, e.m_words);
+      if (t == b) {
+        // Last element: race thieves for it.
+        bool won = m_top.compare_exchange_strong(t, t + 1,
+                                                 memory_order_seq_cst,
+                                                 memory_order_relaxed);
+        m_bottom.store(b + 1, memory_order_relaxed);
+        if (! won)
+          return ret;
+      }
+      ret.emplace(relocation_source<T>{ &e.m_obj });
+    }
+    else
+      m_bottom.store(b + 1, memory_order_relaxed);
+    return ret;
+  }
+
+  /// Any thread: relocate the least recently pushed element out of the deque
+  /// and return it, or return `nullopt` if the deque is empty or another
+  /// thread won the race for the element.
+  optional<T> steal()
+  {
+    int64_t t = m_top.load(memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t b = m_bottom.load(memory_order_acquire);
+
+    optional<T> ret;
+    if (t < b) {
+      element e;
+      m_ring.load(memory_order_acquire)->get(t, e.m_words);
+      if (m_top.compare_exchange_strong(t, t + 1, memory_order_seq_cst,
+                                        memory_order_relaxed))
+        ret.emplace(relocation_source<T>{ &e.m_obj });
+    }
+    return ret;
+  }
+
+  /// Return an estimate of the number of elements in the deque.
+  int64_t size() const
+  {
+    int64_t b = m_bottom.load(memory_order_relaxed);
+    int64_t t = m_top.load(memory_order_relaxed);
+    return b > t ? b - t : 0;
+  }
+};
+
+/// Fixed-size pool of worker threads that execute `inline_task`s, stealing
+/// from one another when their own deques run dry.
+class work_stealing_pool
+{
+  struct worker
+  {
+    work_stealing_pool *m_pool;
+    size_t              m_index;
+    ws_deque<inline_task> m_deque;
+    minstd_rand         m_rng;
+
+    worker(work_stealing_pool *pool, size_t index)
+      : m_pool(pool), m_index(index), m_rng(unsigned(index) + 1) { }
+  };
+
+  vector<unique_ptr<worker>> m_workers;
+  vector<thread>             m_threads;
+  mpmc_queue<inline_task>    m_injected;  // Tasks spawned by non-workers
+  atomic<bool>               m_stop;
+
+  static inline thread_local worker *tl_worker = nullptr;
+
+  worker *current_worker() const
+    { return tl_worker && tl_worker->m_pool == this ? tl_worker : nullptr; }
+
+  void worker_loop(worker *w)
+  {
+    tl_worker = w;
+    unsigned idle = 0;
+    while (! m_stop.load(memory_order_acquire)) {
+      if (run_one())
+        idle = 0;
+      else if (++idle < 64)
+        this_thread::yield();
+      else
+        this_thread::sleep_for(chrono::microseconds(100));
+    }
+    tl_worker = nullptr;
+  }
+
+  /// Return a task from the calling worker's deque, from the injection
+  /// queue, or stolen from a random victim; return an empty task if none was
+  /// found.
+  inline_task find_task()
+  {
+    worker *w = current_worker();
+    if (w)
+      if (optional<inline_task> t = w->m_deque.pop())
+        return std::move(*t);
+
+    if (optional<inline_task> t = m_injected.try_pop())
+      return std::move(*t);
+
+    size_t n = m_workers.size();
+    size_t start = w ? w->m_rng() : 0;
+    for (size_t i = 0; i < n; ++i) {
+      worker *victim = m_workers[(start + i) % n].get();
+      if (victim != w)
+        if (optional<inline_task> t = victim->m_deque.steal())
+          return std::move(*t);
+    }
+    return { };
+  }
+
+public:
+  /// Start `threads` worker threads (by default, one per hardware thread).
+  explicit work_stealing_pool(size_t threads = thread::hardware_concurrency())
+    : m_injected(1024), m_stop(false)
+  {
+    if (0 == threads)
+      threads = 1;
+    for (size_t i = 0; i < threads; ++i)
+      m_workers.push_back(make_unique<worker>(this, i));
+    for (size_t i = 0; i < threads; ++i)
+      m_threads.emplace_back(&work_stealing_pool::worker_loop, this,
+                             m_workers[i].get());
+  }
+
+  work_stealing_pool(const work_stealing_pool&) = delete;
+  work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+  /// Stop the workers. Tasks that have not started are destroyed unrun.
+  ~work_stealing_pool()
+  {
+    m_stop.store(true, memory_order_release);
+    for (thread& t : m_threads)
+      t.join();
+  }
+
+  size_t size() const { return m_workers.size(); }
+
+  /// Schedule `task` for execution. A task spawned from a worker goes onto
+  /// that worker's own deque; other tasks go onto the injection queue.
+  void spawn(inline_task task)
+  {
+    if (worker *w = current_worker())
+      w->m_deque.push(&task);
+    else
+      m_injected.push(&task);
+    // The lifetime of `task` ended when it was relocated. Re-create an empty
+    // task so that the destructor for the parameter does nothing.
+    ::new ((void*) &task) inline_task();
+  }
+
+  /// Execute one queued task, if any, on the calling thread and return
+  /// `true`; return `false` if no task was found.
+  bool run_one()
+  {
+    inline_task t = find_task();
+    if (! t)
+      return false;
+    t();
+    return true;
+  }
+};
+
+/// A set of tasks that can be forked with `spawn` and joined with `sync`.
+/// An exception thrown by a task is captured and rethrown by `sync`.
+class task_group
+{
+  work_stealing_pool&    m_pool;
+  atomic<size_t>         m_pending;
+  mutex                  m_mutex;
+  exception_ptr          m_exception;  // First exception thrown by a task
+
+  void complete(exception_ptr e)
+  {
+    if (e) {
+      lock_guard<mutex> lock(m_mutex);
+      if (! m_exception)
+        m_exception = e;
+    }
+    m_pending.fetch_sub(1, memory_order_release);
+  }
+
+public:
+  explicit task_group(work_stealing_pool& pool)
+    : m_pool(pool), m_pending(0) { }
+
+  task_group(const task_group&) = delete;
+  task_group& operator=(const task_group&) = delete;
+
+  /// Wait for outstanding tasks; a `task_group` must not be destroyed while
+  /// its tasks are running.
+  ~task_group()
+  {
+    while (m_pending.load(memory_order_acquire))
+      m_pool.run_one();
+  }
+
+  /// Fork `f` for execution by the pool.
+  template <class F>
+  void spawn(F&& f)
+  {
+    m_pending.fetch_add(1, memory_order_relaxed);
+    m_pool.spawn([group = this, fn = std::forward<F>(f)]() mutable {
+      exception_ptr e;
+      try { fn(); }
+      catch (...) { e = current_exception(); }
+      group->complete(e);
+    });
+  }
+
+  /// Wait until every task spawned in this group has completed, executing
+  /// queued tasks in the meantime. Rethrow the first exception (if any)
+  /// thrown by a task.
+  void sync()
+  {
+    unsigned idle = 0;
+    while (m_pending.load(memory_order_acquire)) {
+      if (m_pool.run_one())
+        idle = 0;
+      else if (++idle < 64)
+        this_thread::yield();
+      else
+        this_thread::sleep_for(chrono::microseconds(50));
+    }
+    if (m_exception)
+      rethrow_exception(exchange(m_exception, nullptr));
+  }
+};
+
+/// Invoke `f(i)` for every `i` in `[first, last)`, in parallel on `pool`,
+/// recursively splitting the range in half until pieces are no larger than
+/// `grain`. Return after every invocation has completed.
+template <class F>
+void parallel_for(work_stealing_pool& pool, size_t first, size_t last,
+                  const F& f, size_t grain = 1)
+{
+  if (0 == grain)
+    grain = 1;
+
+  task_group group(pool);
+  while (last - first > grain) {
+    size_t mid = first + (last - first) / 2;
+    group.spawn([&pool, mid, last, &f, grain]{
+      parallel_for(pool, mid, last, f, grain);
+    });
+    last = mid;
+  }
+  for (; first < last; ++first)
+    f(first);
+  group.sync();
+}
+
+} // close namespace xstd
+
+#endif // ! defined(INCLUDED_WORK_STEALING)
+
+// Local Variables:
+// c-basic-offset: 2
+// End:
@@ -0,0 +1,262 @@
+/* work_stealing.t.cpp                                                -*-C++-*-
+ *
+ * Copyright (C) 2024 Pablo Halpern <phalpern@halpernwightsoftware.com>
+ * Distributed under the Boost Software License - Version 1.0
+ */
+
+// Run the benchmarks with `make work_stealing.test TEST_ARGS=bench`.
+
+#include <work_stealing.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <cassert>
+
+static int s_live_functors = 0;
+
+/// Functor that counts live instances. `IsTR` determines whether it opts in
+/// to trivial relocation.
+template <bool IsTR>
+struct Counted
+{
+  int *m_target;
+
+  explicit Counted(int *t) : m_target(t) { ++s_live_functors; }
+  Counted(const Counted& other) : m_target(other.m_target)
+    { ++s_live_functors; }
+  ~Counted() { --s_live_functors; }
+
+  void operator()() const { ++*m_target; }
+};
+
+namespace xstd {
+template <> struct is_trivially_relocatable<Counted<true>> : true_type { };
+} // close namespace xstd
+
+void test_inline_task()
+{
+  using xstd::inline_task;
+
+  int n = 0;
+  auto small = [&n]{ ++n; };
+  auto large = [&n, pad = std::array<char, 64>()]{ n += 1 + pad[0]; };
+  auto non_tr = [&n, s = std::string("hello")]{ n += s.size(); };
+  static_assert(  inline_task::stores_inline<decltype(small)>());
+  static_assert(! inline_task::stores_inline<decltype(large)>());
+  static_assert(! inline_task::stores_inline<decltype(non_tr)>());
+  static_assert(  inline_task::stores_inline<Counted<true>>());
+  static_assert(! inline_task::stores_inline<Counted<false>>());
+  static_assert(  xstd::is_trivially_relocatable_v<inline_task>);
+
+  inline_task t1(small), t2(large), t3(non_tr);
+  assert(t1 && t2 && t3);
+  t1(); t2(); t3();
+  assert(! t1 && ! t2 && ! t3);
+  assert(7 == n);
+
+  // Tasks that are run or destroyed destroy their callables exactly once.
+  {
+    inline_task a{ Counted<true>(&n) }, b{ Counted<false>(&n) };
+    inline_task c{ Counted<true>(&n) }, d{ Counted<false>(&n) };
+    assert(4 == s_live_functors);
+    inline_task e(std::move(a));
+    assert(! a && e);
+    e(); b();
+    assert(2 == s_live_functors);
+  }
+  assert(0 == s_live_functors);
+  assert(9 == n);
+}
+
+void test_deque_single_thread()
+{
+  xstd::ws_deque<long> d(2);
+  assert(! d.pop() && ! d.steal());
+
+  for (long i = 0; i < 100; ++i)  // Forces growth
+    d.emplace(i);
+  assert(100 == d.size());
+  assert(99 == *d.pop());        // Owner pops LIFO
+  assert(0 == *d.steal());       // Thieves steal FIFO
+  assert(1 == *d.steal());
+  for (long i = 98; i >= 2; --i)
+    assert(i == *d.pop());
+  assert(! d.pop() && ! d.steal());
+}
+
+void test_deque_stealing()
+{
+  constexpr long count = 100000;
+  constexpr int  thieves = 3;
+
+  xstd::ws_deque<long> d;
+  std::atomic<long> sum = 0, taken = 0;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < thieves; ++i)
+    threads.emplace_back([&]{
+      while (taken < count) {
+        if (std::optional<long> v = d.steal()) {
+          sum += *v;
+          ++taken;
+        }
+        else
+          std::this_thread::yield();
+      }
+    });
+
+  for (long i = 0; i < count; ++i) {
+    d.emplace(i);
+    if (i % 3 == 0)
+      if (std::optional<long> v = d.pop()) {
+        sum += *v;
+        ++taken;
+      }
+  }
+  while (std::optional<long> v = d.pop()) {
+    sum += *v;
+    ++taken;
+  }
+  for (std::thread& t : threads)
+    t.join();
+
+  assert(count == taken);
+  assert(count * (count - 1) / 2 == sum);
+}
+
+void test_pool()
+{
+  xstd::work_stealing_pool pool(4);
+  assert(4 == pool.size());
+
+  // Flat fork-join
+  std::atomic<int> n = 0;
+  {
+    xstd::task_group g(pool);
+    for (int i = 0; i < 1000; ++i)
+      g.spawn([&n]{ ++n; });
+    g.sync();
+    assert(1000 == n);
+  }
+
+  // Recursive fork-join
+  struct fib
+  {
+    xstd::work_stealing_pool& m_pool;
+    long operator()(int k) const
+    {
+      if (k < 2)
+        return k;
+      long a, b;
+      xstd::task_group g(m_pool);
+      g.spawn([&a, this, k]{ a = (*this)(k - 1); });
+      b = (*this)(k - 2);
+      g.sync();
+      return a + b;
+    }
+  };
+  assert(6765 == fib{ pool }(20));
+
+  // Exceptions propagate to `sync`
+  xstd::task_group g(pool);
+  for (int i = 0; i < 10; ++i)
+    g.spawn([i]{ if (7 == i) throw std::runtime_error("seven"); });
+  bool caught = false;
+  try { g.sync(); }
+  catch (const std::runtime_error& e) { caught = std::string("seven") == e.what(); }
+  assert(caught);
+}
+
+void test_parallel_for()
+{
+  xstd::work_stealing_pool pool(3);
+
+  std::vector<long> v(100000);
+  xstd::parallel_for(pool, 0, v.size(), [&v](std::size_t i){ v[i] = i * 2; },
+                     1000);
+  for (std::size_t i = 0; i < v.size(); ++i)
+    assert(long(i * 2) == v[i]);
+
+  std::atomic<long> sum = 0;
+  xstd::parallel_for(pool, 10, 20, [&](std::size_t i){ sum += i; });
+  assert(145 == sum);
+
+  xstd::parallel_for(pool, 5, 5, [](std::size_t){ assert(false); });
+
+  // Nested parallel loops
+  std::atomic<int> cells = 0;
+  xstd::parallel_for(pool, 0, 50, [&](std::size_t) {
+    xstd::parallel_for(pool, 0, 40, [&](std::size_t){ ++cells; }, 8);
+  }, 4);
+  assert(2000 == cells);
+}
+
+/// Time `parallel_for` over a compute-bound loop with `threads` workers and
+/// return the elapsed time in milliseconds.
+double bench_parallel_for(std::size_t threads, std::size_t grain)
+{
+  constexpr std::size_t count = 1 << 20;
+
+  std::vector<double> v(count);
+  xstd::work_stealing_pool pool(threads);
+  auto start = std::chrono::steady_clock::now();
+  for (int rep = 0; rep < 4; ++rep)
+    xstd::parallel_for(pool, 0, count, [&v](std::size_t i) {
+      v[i] = std::sqrt(double(i)) * std::sin(double(i));
+    }, grain);
+  std::chrono::duration<double, std::milli> elapsed =
+    std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+/// Time spawning and syncing `count` trivial tasks from one worker.
+double bench_spawn(std::size_t threads)
+{
+  constexpr int count = 200000;
+
+  xstd::work_stealing_pool pool(threads);
+  std::atomic<int> n = 0;
+  auto start = std::chrono::steady_clock::now();
+  xstd::task_group outer(pool);
+  outer.spawn([&]{
+    xstd::task_group g(pool);
+    for (int i = 0; i < count; ++i)
+      g.spawn([&n]{ n.fetch_add(1, std::memory_order_relaxed); });
+    g.sync();
+  });
+  outer.sync();
+  std::chrono::duration<double, std::nano> elapsed =
+    std::chrono::steady_clock::now() - start;
+  assert(count == n);
+  return elapsed.count() / count;
+}
+
+void bench_scaling()
+{
+  std::cout << "threads  parallel_for (ms)  spawn+run (ns/task)\n";
+  for (std::size_t threads = 1; threads <= 16; threads *= 2)
+    std::cout << threads << "\t " << bench_parallel_for(threads, 4096)
+              << "\t\t    " << bench_spawn(threads) << '\n';
+}
+
+int main(int argc, char *argv[])
+{
+  test_inline_task();
+  test_deque_single_thread();
+  test_deque_stealing();
+  test_pool();
+  test_parallel_for();
+
+  if (argc > 1 && std::string(argv[1]) == "bench")
+    bench_scaling();
+}
+
+// Local Variables:
+// c-basic-offset: 2
+// End: